@@ -28,22 +28,20 @@ public class BeamEyeTracker : ModuleRules
 			"EnhancedInput"
 		});
 
-		// Debug overlay dependencies (only when feature is enabled)
-		if (Target.Configuration == UnrealTargetConfiguration.Development)
-		{
-			PublicDefinitions.Add("BEAM_FEATURE_DEBUG_OVERLAY=1");
-		}
-		else
-		{
-			PublicDefinitions.Add("BEAM_FEATURE_DEBUG_OVERLAY=0");
-		}
+		// Tooling feature gates (see Private/BeamFeatures.h): shipping keeps only the core ring, filters and mapping
+		bool bShipping = Target.Configuration == UnrealTargetConfiguration.Shipping;
+		bool bTest = Target.Configuration == UnrealTargetConfiguration.Test;
+		PublicDefinitions.Add("BEAM_FEATURE_DEBUG_OVERLAY=" + (bShipping || bTest ? "0" : "1"));
+		PublicDefinitions.Add("BEAM_FEATURE_RECORDED_DATA=" + (bShipping ? "0" : "1"));
+		PublicDefinitions.Add("BEAM_FEATURE_UNREAL_INSIGHTS=" + (bShipping ? "0" : "1"));
+		PublicDefinitions.Add("BEAM_FEATURE_ANALYTICS=" + (bShipping ? "0" : "1"));
+		PublicDefinitions.Add("BEAM_FEATURE_SYNTHETIC_DATA=" + (bShipping ? "0" : "1"));
 
 		// Lean wrapper: minimal dependencies only
 		// Note: BlueprintGraph removed - not needed for runtime
 		// Note: DeveloperSettings removed - not essential for core functionality
-		// Note: External eye tracking bridge removed - can be added via feature flag if needed
-
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		// EyeTracker: IEyeTracker bridge (BEAM_FEATURE_EYETRACKER_BRIDGE)
+		PrivateDependencyModuleNames.AddRange(new string[] { "RenderCore", "Renderer", "RHI", "Sockets", "Networking", "NetCore", "BeamEyeTrackerShaders", "EyeTracker" });
 
 		// Get the plugin directory and resolve ThirdParty path
 		string PluginDir = Path.GetFullPath(Path.Combine(ModuleDirectory, "..", ".."));
@@ -1,11 +1,25 @@
 ﻿#include "BeamAnalyticsSubsystem.h"
+#include "BeamAnalyticsWorker.h"
 #include "BeamEyeTrackerSubsystem.h"
+#include "BeamEyeTrackerSettings.h"
+#include "BeamFeatures.h"
+#include "BeamResources.h"
 #include "Engine/Engine.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "BeamStats.h"
+#include "BeamExport.h"
+#include "HAL/FileManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Analytics Gaze Update"), STAT_BeamAnalyticsGaze, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("Analytics Performance Update"), STAT_BeamAnalyticsPerformance, STATGROUP_Beam);
+
+// Session log cap: hours of fixations and saccades in about 10 MB; later events are counted as dropped
+static constexpr int32 BeamMaxSessionGazeEvents = 256 * 1024;
 
 UBeamAnalyticsSubsystem::UBeamAnalyticsSubsystem()
+    : SessionEvents(&SessionArena, BeamMaxSessionGazeEvents)
 {
     bAnalyticsActive = false;
     bPerformanceMonitoringActive = false;
@@ -19,17 +33,16 @@ void UBeamAnalyticsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     
-    if (UGameInstance* GameInstance = GetGameInstance())
+    // The tracking subsystem owns the ring the worker reads, so it must exist first
+    BeamSubsystem = Collection.InitializeDependency<UBeamEyeTrackerSubsystem>();
+    if (BeamSubsystem)
     {
-        BeamSubsystem = GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>();
-        if (BeamSubsystem)
-        {
-            UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem initialized successfully"));
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("BeamAnalyticsSubsystem: Failed to get BeamEyeTrackerSubsystem"));
-        }
+        BeamSubsystem->OnFrameRingReleased.AddUObject(this, &UBeamAnalyticsSubsystem::HandleFrameRingReleased);
+        UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem initialized successfully"));
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BeamAnalyticsSubsystem: Failed to get BeamEyeTrackerSubsystem"));
     }
 }
 
@@ -44,12 +57,25 @@ void UBeamAnalyticsSubsystem::Deinitialize()
     {
         StopPerformanceMonitoring();
     }
+
+    DestroyAnalyticsWorker();
+    if (BeamSubsystem)
+    {
+        BeamSubsystem->OnFrameRingReleased.RemoveAll(this);
+    }
+
+    // The game instance is ending, so the blocks are not kept for another session
+    SessionEvents.Reset();
+    SessionArena.Trim();
     
     Super::Deinitialize();
 }
 
 void UBeamAnalyticsSubsystem::StartGazeAnalytics()
 {
+#if !BEAM_FEATURE_ANALYTICS
+    UE_LOG(LogTemp, Warning, TEXT("BeamAnalyticsSubsystem: Gaze analytics are not available in this build"));
+#else
     if (!BeamSubsystem)
     {
         UE_LOG(LogTemp, Warning, TEXT("BeamAnalyticsSubsystem: Cannot start analytics - no Beam subsystem"));
@@ -61,12 +87,28 @@ void UBeamAnalyticsSubsystem::StartGazeAnalytics()
         UE_LOG(LogTemp, Warning, TEXT("BeamAnalyticsSubsystem: Analytics already active"));
         return;
     }
+
+    const FBeamFrameRing* Ring = BeamSubsystem->GetFrameRing();
+    if (!Ring)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BeamAnalyticsSubsystem: Cannot start analytics - no frame ring"));
+        return;
+    }
+
+    AnalyticsWorker = new FBeamAnalyticsWorker(*Ring, MakeWorkerConfig());
+    if (!AnalyticsWorker->Start())
+    {
+        DestroyAnalyticsWorker();
+        return;
+    }
     
     bAnalyticsActive = true;
     ResetGazeAnalytics();
+    UpdateTicker();
     OnAnalyticsStarted();
     
     UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem: Gaze analytics started"));
+#endif
 }
 
 void UBeamAnalyticsSubsystem::StopGazeAnalytics()
@@ -77,6 +119,8 @@ void UBeamAnalyticsSubsystem::StopGazeAnalytics()
     }
     
     bAnalyticsActive = false;
+    DestroyAnalyticsWorker();
+    UpdateTicker();
     OnAnalyticsStopped();
     
     UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem: Gaze analytics stopped"));
@@ -90,8 +134,15 @@ FGazeAnalytics UBeamAnalyticsSubsystem::GetGazeAnalytics() const
 void UBeamAnalyticsSubsystem::ResetGazeAnalytics()
 {
     CurrentAnalytics = FGazeAnalytics();
-    GazeHistory.Empty();
-    GazeTimestamps.Empty();
+    LastSnapshotSequence = 0;
+    NextGazeEventId = 0;
+    SessionEvents.Reset();
+    SessionArena.Reset();
+    if (AnalyticsWorker)
+    {
+        // The worker restarts its event ids too, so NextGazeEventId = 0 matches the first event after the reset
+        AnalyticsGeneration = AnalyticsWorker->RequestReset();
+    }
     LastUpdateTime = 0.0f;
 }
 
@@ -108,6 +159,14 @@ void UBeamAnalyticsSubsystem::AssessCalibration()
         return;
     }
 
+    // A measured validation session outranks the estimate below
+    if (CurrentCalibrationQuality.NumSamples > 0)
+    {
+        OnCalibrationAssessed(CurrentCalibrationQuality);
+        UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem: Calibration assessment from validation - Score: %.1f, %d samples"), CurrentCalibrationQuality.OverallScore, CurrentCalibrationQuality.NumSamples);
+        return;
+    }
+
     bool bIsCalibrated = BeamSubsystem->IsCalibrated();
     
     if (bIsCalibrated)
@@ -146,6 +205,16 @@ void UBeamAnalyticsSubsystem::AssessCalibration()
     UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem: Calibration assessment complete - Score: %.1f"), CurrentCalibrationQuality.OverallScore);
 }
 
+void UBeamAnalyticsSubsystem::SetCalibrationQuality(const FCalibrationQuality& Quality)
+{
+    CurrentCalibrationQuality = Quality;
+    if (BeamSubsystem)
+    {
+        BeamSubsystem->SetCalibrationQuality(Quality);
+    }
+    OnCalibrationAssessed(CurrentCalibrationQuality);
+}
+
 float UBeamAnalyticsSubsystem::GetCalibrationScore() const
 {
     return CurrentCalibrationQuality.OverallScore;
@@ -161,6 +230,7 @@ void UBeamAnalyticsSubsystem::StartPerformanceMonitoring()
     
     bPerformanceMonitoringActive = true;
     CurrentPerformanceMetrics = FBeamPerformanceMetrics();
+    UpdateTicker();
     OnPerformanceMonitoringStarted();
     
     UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem: Performance monitoring started"));
@@ -174,6 +244,7 @@ void UBeamAnalyticsSubsystem::StopPerformanceMonitoring()
     }
     
     bPerformanceMonitoringActive = false;
+    UpdateTicker();
     OnPerformanceMonitoringStopped();
     
     UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem: Performance monitoring stopped"));
@@ -207,30 +278,23 @@ bool UBeamAnalyticsSubsystem::ExportAnalyticsData(const FString& FilePath)
         return false;
     }
     
-    FString CSVData = TEXT("Timestamp,AverageFixationDuration,SaccadeVelocity,FixationCount,ScanPathLength\n");
-    
-    // Add current analytics data
-    FString Row = FString::Printf(TEXT("%.3f,%.3f,%.3f,%d,%.3f\n"),
-        CurrentAnalytics.TimeStamp,
-        CurrentAnalytics.AverageFixationDuration,
-        CurrentAnalytics.SaccadeVelocity,
-        CurrentAnalytics.FixationCount,
-        CurrentAnalytics.ScanPathLength);
-    
-    CSVData += Row;
-
-    bool bSuccess = FFileHelper::SaveStringToFile(CSVData, *FilePath);
-    
-    if (bSuccess)
-    {
-        UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem: Analytics data exported to %s"), *FilePath);
-    }
-    else
+    // Snapshot on the game thread, write on the pool
+    BeamExport::Launch(TEXT("Analytics data"), FilePath, [FilePath, Analytics = CurrentAnalytics]()
     {
-        UE_LOG(LogTemp, Error, TEXT("BeamAnalyticsSubsystem: Failed to export analytics data to %s"), *FilePath);
-    }
-    
-    return bSuccess;
+        TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*FilePath));
+        if (!Archive)
+        {
+            return false;
+        }
+
+        FBeamCsvWriter Writer(*Archive);
+        Writer.WriteHeader("Timestamp,AverageFixationDuration,SaccadeVelocity,FixationCount,ScanPathLength");
+        Writer.Add(Analytics.TimeStamp, 3).Add(Analytics.AverageFixationDuration, 3).Add(Analytics.SaccadeVelocity, 3)
+            .Add(Analytics.FixationCount).Add(Analytics.ScanPathLength, 3);
+        Writer.EndRow();
+        return Writer.Flush() && Archive->Close();
+    }, MakeExportFinishedHandler(FilePath));
+    return true;
 }
 
 bool UBeamAnalyticsSubsystem::ExportPerformanceData(const FString& FilePath)
@@ -241,32 +305,70 @@ bool UBeamAnalyticsSubsystem::ExportPerformanceData(const FString& FilePath)
         return false;
     }
     
-    FString CSVData = TEXT("Timestamp,AverageFrameTime,MinFrameTime,MaxFrameTime,CPUUsage,MemoryUsage,DroppedFrames\n");
-    
-    // Add current performance data
-    FString Row = FString::Printf(TEXT("%.3f,%.3f,%.3f,%.3f,%.2f,%.2f,%d\n"),
-        CurrentPerformanceMetrics.TimeStamp,
-        CurrentPerformanceMetrics.AverageFrameTime,
-        CurrentPerformanceMetrics.MinFrameTime,
-        CurrentPerformanceMetrics.MaxFrameTime,
-        CurrentPerformanceMetrics.CPUUsage,
-        CurrentPerformanceMetrics.MemoryUsage,
-        CurrentPerformanceMetrics.DroppedFrames);
-    
-    CSVData += Row;
+    BeamExport::Launch(TEXT("Performance data"), FilePath, [FilePath, Metrics = CurrentPerformanceMetrics]()
+    {
+        TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*FilePath));
+        if (!Archive)
+        {
+            return false;
+        }
 
-    bool bSuccess = FFileHelper::SaveStringToFile(CSVData, *FilePath);
-    
-    if (bSuccess)
+        FBeamCsvWriter Writer(*Archive);
+        Writer.WriteHeader("Timestamp,AverageFrameTime,MinFrameTime,MaxFrameTime,CPUUsage,MemoryUsage,DroppedFrames");
+        Writer.Add(Metrics.TimeStamp, 3).Add(Metrics.AverageFrameTime, 3).Add(Metrics.MinFrameTime, 3).Add(Metrics.MaxFrameTime, 3)
+            .Add(Metrics.CPUUsage, 2).Add(Metrics.MemoryUsage, 2).Add(Metrics.DroppedFrames);
+        Writer.EndRow();
+        return Writer.Flush() && Archive->Close();
+    }, MakeExportFinishedHandler(FilePath));
+    return true;
+}
+
+bool UBeamAnalyticsSubsystem::ExportGazeEvents(const FString& FilePath)
+{
+    if (SessionEvents.Num() == 0)
     {
-        UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem: Performance data exported to %s"), *FilePath);
+        UE_LOG(LogTemp, Warning, TEXT("BeamAnalyticsSubsystem: Cannot export - no gaze events this session"));
+        return false;
     }
-    else
+    if (SessionEvents.GetNumDropped() > 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("BeamAnalyticsSubsystem: Failed to export performance data to %s"), *FilePath);
+        UE_LOG(LogTemp, Warning, TEXT("BeamAnalyticsSubsystem: Session event log was full, %d later events are missing from the export"), SessionEvents.GetNumDropped());
     }
-    
-    return bSuccess;
+
+    // The arena is rewound by the next reset, so the writer gets its own copy
+    TArray<FBeamGazeEvent> Events;
+    SessionEvents.CopyTo(Events);
+    BeamExport::Launch(TEXT("Gaze events"), FilePath, [FilePath, Events = MoveTemp(Events)]()
+    {
+        TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*FilePath));
+        if (!Archive)
+        {
+            return false;
+        }
+
+        FBeamCsvWriter Writer(*Archive);
+        Writer.WriteHeader("Type,StartSeconds,EndSeconds,PositionX,PositionY,Amplitude,PeakVelocity");
+        for (const FBeamGazeEvent& Event : Events)
+        {
+            Writer.Add(Event.Type == EBeamGazeEventType::Fixation ? TEXT("Fixation") : TEXT("Saccade"))
+                .Add(Event.StartSeconds, 4).Add(Event.EndSeconds, 4).Add(Event.Position.X, 4).Add(Event.Position.Y, 4)
+                .Add(Event.Amplitude, 4).Add(Event.PeakVelocity, 3);
+            Writer.EndRow();
+        }
+        return Writer.Flush() && Archive->Close();
+    }, MakeExportFinishedHandler(FilePath));
+    return true;
+}
+
+TUniqueFunction<void(bool)> UBeamAnalyticsSubsystem::MakeExportFinishedHandler(const FString& FilePath)
+{
+    return [WeakThis = TWeakObjectPtr<UBeamAnalyticsSubsystem>(this), FilePath](bool bSuccess)
+    {
+        if (UBeamAnalyticsSubsystem* This = WeakThis.Get())
+        {
+            This->OnExportFinished(FilePath, bSuccess);
+        }
+    };
 }
 
 void UBeamAnalyticsSubsystem::SetAnalyticsSettings(float InSamplingRate, float InMinFixationDuration, float InMaxGapTime)
@@ -274,6 +376,10 @@ void UBeamAnalyticsSubsystem::SetAnalyticsSettings(float InSamplingRate, float I
     SamplingRate = FMath::Max(1.0f, InSamplingRate);
     MinFixationDuration = FMath::Max(0.01f, InMinFixationDuration);
     MaxGapTime = FMath::Max(0.1f, InMaxGapTime);
+    if (AnalyticsWorker)
+    {
+        AnalyticsWorker->SetConfig(MakeWorkerConfig());
+    }
     
     UE_LOG(LogTemp, Log, TEXT("BeamAnalyticsSubsystem: Settings updated - Rate: %.1f, MinFix: %.3f, MaxGap: %.3f"),
         SamplingRate, MinFixationDuration, MaxGapTime);
@@ -286,45 +392,97 @@ void UBeamAnalyticsSubsystem::GetAnalyticsSettings(float& OutSamplingRate, float
     OutMaxGapTime = MaxGapTime;
 }
 
+FBeamAnalyticsWorkerConfig UBeamAnalyticsSubsystem::MakeWorkerConfig() const
+{
+    FBeamAnalyticsWorkerConfig Config;
+    Config.SamplingRate = SamplingRate;
+    Config.MinFixationDuration = MinFixationDuration;
+
+    const float BudgetWindowSeconds = GetDefault<UBeamEyeTrackerSettings>()->GetMemoryBudget().AnalyticsWindowSeconds;
+    if (BudgetWindowSeconds > 0.0f)
+    {
+        Config.WindowSeconds = BudgetWindowSeconds;
+    }
+    return Config;
+}
+
+void UBeamAnalyticsSubsystem::DestroyAnalyticsWorker()
+{
+    if (AnalyticsWorker)
+    {
+        AnalyticsWorker->Shutdown();
+        delete AnalyticsWorker;
+        AnalyticsWorker = nullptr;
+    }
+}
+
+void UBeamAnalyticsSubsystem::HandleFrameRingReleased()
+{
+    // The worker reads the ring directly, so it must stop before the ring goes away
+    if (bAnalyticsActive)
+    {
+        StopGazeAnalytics();
+    }
+    DestroyAnalyticsWorker();
+}
+
+void UBeamAnalyticsSubsystem::UpdateTicker()
+{
+    const bool bNeedsTicker = bAnalyticsActive || bPerformanceMonitoringActive;
+    if (bNeedsTicker && !TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamAnalyticsSubsystem::Tick));
+    }
+    else if (!bNeedsTicker && TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+}
+
+bool UBeamAnalyticsSubsystem::Tick(float DeltaTime)
+{
+    UpdateGazeAnalytics();
+    UpdatePerformanceMetrics(DeltaTime);
+    return true;
+}
+
 void UBeamAnalyticsSubsystem::UpdateGazeAnalytics()
 {
-    if (!bAnalyticsActive || !BeamSubsystem)
+    SCOPE_CYCLE_COUNTER(STAT_BeamAnalyticsGaze);
+    if (!bAnalyticsActive || !AnalyticsWorker)
     {
         return;
     }
-    
-    float CurrentTime = FPlatformTime::Seconds();
 
-    if (CurrentTime - LastUpdateTime < (1.0f / SamplingRate))
+    // All analysis happened on the worker; applying it is one pointer copy
+    const FBeamAnalyticsSnapshotPtr Snapshot = AnalyticsWorker->GetLatestSnapshot();
+    if (!Snapshot.IsValid() || Snapshot->Generation != AnalyticsGeneration || Snapshot->Sequence == LastSnapshotSequence)
     {
         return;
     }
+    LastSnapshotSequence = Snapshot->Sequence;
+    CurrentAnalytics = Snapshot->Analytics;
+    LastUpdateTime = CurrentAnalytics.TimeStamp;
 
-    FGazePoint CurrentGaze = BeamSubsystem->CurrentGaze();
-    
-    if (CurrentGaze.Confidence > 0.5f)
+    // Snapshots skipped since the last tick still had their events carried forward
+    for (int32 i = 0; i < Snapshot->RecentEvents.Num(); ++i)
     {
-        // Add to history
-        GazeHistory.Add(CurrentGaze.Screen01);
-        GazeTimestamps.Add(CurrentTime);
-
-        CleanupOldData();
-        
-        // Calculate analytics
-        CalculateFixations();
-        CalculateSaccades();
-
-        CurrentAnalytics.TimeStamp = CurrentTime;
-        
-        // Trigger Blueprint event
-        OnAnalyticsUpdated(CurrentAnalytics);
+        if (Snapshot->FirstEventId + i >= NextGazeEventId)
+        {
+            SessionEvents.Add(Snapshot->RecentEvents[i]);
+            OnGazeEvent(Snapshot->RecentEvents[i]);
+        }
     }
+    NextGazeEventId = FMath::Max(NextGazeEventId, Snapshot->FirstEventId + Snapshot->RecentEvents.Num());
     
-    LastUpdateTime = CurrentTime;
+    // Trigger Blueprint event
+    OnAnalyticsUpdated(CurrentAnalytics);
 }
 
-void UBeamAnalyticsSubsystem::UpdatePerformanceMetrics()
+void UBeamAnalyticsSubsystem::UpdatePerformanceMetrics(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_BeamAnalyticsPerformance);
     if (!bPerformanceMonitoringActive)
     {
         return;
@@ -334,8 +492,6 @@ void UBeamAnalyticsSubsystem::UpdatePerformanceMetrics()
 
     if (GEngine)
     {
-        float DeltaTime = 1.0f / 60.0f; // Use fixed delta time for performance monitoring
-        
         if (DeltaTime > 0.0f)
         {
             
@@ -363,149 +519,13 @@ void UBeamAnalyticsSubsystem::UpdatePerformanceMetrics()
         }
     }
     
-    // Simulate CPU and memory usage (in real implementation, get from platform)
-    CurrentPerformanceMetrics.CPUUsage = FMath::RandRange(5.0f, 25.0f);
-    CurrentPerformanceMetrics.MemoryUsage = FMath::RandRange(100.0f, 500.0f);
+    // Measured by the background sampler: Beam threads only, and memory the plugin owns
+    const FBeamResourceUsage Usage = GBeamResources.GetLatest();
+    CurrentPerformanceMetrics.CPUUsage = Usage.CPUPercent;
+    CurrentPerformanceMetrics.MemoryUsage = static_cast<float>(Usage.MemoryBytes / (1024.0 * 1024.0));
     
     CurrentPerformanceMetrics.TimeStamp = CurrentTime;
     
     // Trigger Blueprint event
     OnPerformanceUpdated(CurrentPerformanceMetrics);
 }
-
-void UBeamAnalyticsSubsystem::CalculateFixations()
-{
-    if (GazeHistory.Num() < 2)
-    {
-        return;
-    }
-    
-    TArray<float> FixationDurations;
-    TArray<FVector2D> FixationCenters;
-    
-    int32 StartIndex = 0;
-    FVector2D StartPoint = GazeHistory[0];
-    
-    for (int32 i = 1; i < GazeHistory.Num(); ++i)
-    {
-        float Distance = CalculateDistance(StartPoint, GazeHistory[i]);
-        
-        // If gaze moved significantly, end current fixation
-        if (Distance > 0.05f) // 5% of screen size threshold
-        {
-            float Duration = GazeTimestamps[i - 1] - GazeTimestamps[StartIndex];
-            
-            if (Duration >= MinFixationDuration)
-            {
-                FixationDurations.Add(Duration);
-                
-                // Calculate fixation center
-                FVector2D Center = FVector2D::ZeroVector;
-                for (int32 j = StartIndex; j < i; ++j)
-                {
-                    Center += GazeHistory[j];
-                }
-                Center /= (i - StartIndex);
-                FixationCenters.Add(Center);
-            }
-            
-            StartIndex = i;
-            StartPoint = GazeHistory[i];
-        }
-    }
-    
-    // Handle last fixation
-    if (StartIndex < GazeHistory.Num() - 1)
-    {
-        float Duration = GazeTimestamps.Last() - GazeTimestamps[StartIndex];
-        if (Duration >= MinFixationDuration)
-        {
-            FixationDurations.Add(Duration);
-            
-            FVector2D Center = FVector2D::ZeroVector;
-            for (int32 j = StartIndex; j < GazeHistory.Num(); ++j)
-            {
-                Center += GazeHistory[j];
-            }
-            Center /= (GazeHistory.Num() - StartIndex);
-            FixationCenters.Add(Center);
-        }
-    }
-
-    CurrentAnalytics.FixationCount = FixationCenters.Num();
-    CurrentAnalytics.FixationPoints = FixationCenters;
-    
-    if (FixationDurations.Num() > 0)
-    {
-        float TotalDuration = 0.0f;
-        for (float Duration : FixationDurations)
-        {
-            TotalDuration += Duration;
-        }
-        CurrentAnalytics.AverageFixationDuration = TotalDuration / FixationDurations.Num();
-    }
-}
-
-void UBeamAnalyticsSubsystem::CalculateSaccades()
-{
-    if (GazeHistory.Num() < 2)
-    {
-        return;
-    }
-    
-    float TotalVelocity = 0.0f;
-    int32 SaccadeCount = 0;
-    
-    for (int32 i = 1; i < GazeHistory.Num(); ++i)
-    {
-        float Distance = CalculateDistance(GazeHistory[i - 1], GazeHistory[i]);
-        float TimeDelta = GazeTimestamps[i] - GazeTimestamps[i - 1];
-        
-        if (TimeDelta > 0.0f && Distance > 0.01f) // Significant movement threshold
-        {
-            float Velocity = Distance / TimeDelta;
-            TotalVelocity += Velocity;
-            SaccadeCount++;
-        }
-    }
-    
-    if (SaccadeCount > 0)
-    {
-        CurrentAnalytics.SaccadeVelocity = TotalVelocity / SaccadeCount;
-    }
-    
-    // Calculate scan path length
-    float ScanLength = 0.0f;
-    for (int32 i = 1; i < GazeHistory.Num(); ++i)
-    {
-        ScanLength += CalculateDistance(GazeHistory[i - 1], GazeHistory[i]);
-    }
-    CurrentAnalytics.ScanPathLength = ScanLength;
-}
-
-float UBeamAnalyticsSubsystem::CalculateDistance(const FVector2D& Point1, const FVector2D& Point2)
-{
-    return FVector2D::Distance(Point1, Point2);
-}
-
-void UBeamAnalyticsSubsystem::CleanupOldData()
-{
-    float CurrentTime = FPlatformTime::Seconds();
-    float MaxAge = 10.0f; // Keep 10 seconds of data
-    
-    // Remove old gaze points
-    while (GazeHistory.Num() > 0 && GazeTimestamps.Num() > 0)
-    {
-        if (CurrentTime - GazeTimestamps[0] > MaxAge)
-        {
-            GazeHistory.RemoveAt(0);
-            GazeTimestamps.RemoveAt(0);
-        }
-        else
-        {
-            break;
-        }
-    }
-}
-
-
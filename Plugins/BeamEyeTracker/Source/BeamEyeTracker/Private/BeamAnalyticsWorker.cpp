@@ -0,0 +1,224 @@
+// Implements the ring-following background gaze analytics worker
+
+#include "BeamAnalyticsWorker.h"
+#include "BeamLogging.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "BeamStats.h"
+#include "BeamResources.h"
+
+DECLARE_CYCLE_STAT(TEXT("Analytics Worker Frame"), STAT_BeamAnalyticsWorkerFrame, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("Analytics Worker Snapshot"), STAT_BeamAnalyticsWorkerSnapshot, STATGROUP_Beam);
+
+// Nap between ring checks when nothing new was published; analytics tolerate a few milliseconds of lag
+#define BEAM_ANALYTICS_IDLE_SECONDS 0.002f
+
+FBeamAnalyticsWorker::FBeamAnalyticsWorker(const FBeamFrameRing& InRing, const FBeamAnalyticsWorkerConfig& InConfig)
+	: Ring(InRing)
+	, bStopRequested(false)
+	, ResetGeneration(0)
+	, PendingConfig(InConfig)
+	, Config(InConfig)
+	, LastSampleSeconds(-TNumericLimits<double>::Max())
+{
+	Scratch.Reserve(FBeamFrameRing::BufferSize);
+	RecentEvents.Reserve(MaxRecentEvents);
+	ResetAnalysis();
+}
+
+FBeamAnalyticsWorker::~FBeamAnalyticsWorker()
+{
+	Shutdown();
+}
+
+bool FBeamAnalyticsWorker::Start()
+{
+	if (Thread)
+	{
+		return true;
+	}
+
+	bStopRequested.store(false, std::memory_order_release);
+	Thread = FRunnableThread::Create(this, TEXT("BeamAnalyticsWorker"), 0, TPri_BelowNormal);
+	if (!Thread)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Could not start the analytics worker thread"));
+		return false;
+	}
+	return true;
+}
+
+void FBeamAnalyticsWorker::Shutdown()
+{
+	if (Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+}
+
+void FBeamAnalyticsWorker::Stop()
+{
+	bStopRequested.store(true, std::memory_order_release);
+}
+
+void FBeamAnalyticsWorker::SetConfig(const FBeamAnalyticsWorkerConfig& InConfig)
+{
+	FScopeLock Lock(&ConfigLock);
+	PendingConfig = InConfig;
+	bConfigDirty = true;
+}
+
+uint32 FBeamAnalyticsWorker::RequestReset()
+{
+	// Under the lock so a snapshot the worker is publishing right now cannot land after the reset
+	FScopeLock Lock(&SnapshotLock);
+	LatestSnapshot.Reset();
+	return ResetGeneration.fetch_add(1, std::memory_order_acq_rel) + 1;
+}
+
+FBeamAnalyticsSnapshotPtr FBeamAnalyticsWorker::GetLatestSnapshot() const
+{
+	FScopeLock Lock(&SnapshotLock);
+	return LatestSnapshot;
+}
+
+void FBeamAnalyticsWorker::ApplyPendingControl()
+{
+	const uint32 RequestedGeneration = ResetGeneration.load(std::memory_order_acquire);
+	bool bRestart = RequestedGeneration != AppliedGeneration;
+	if (bRestart)
+	{
+		// The game thread restarts its event ids along with ours
+		AppliedGeneration = RequestedGeneration;
+		NextEventId = 0;
+	}
+
+	{
+		FScopeLock Lock(&ConfigLock);
+		if (bConfigDirty)
+		{
+			bRestart |= PendingConfig.WindowSeconds != Config.WindowSeconds;
+			Config = PendingConfig;
+			bConfigDirty = false;
+			Analyzer.SetMinFixationDuration(Config.MinFixationDuration);
+			Analyzer.ReserveForRate(Config.SamplingRate);
+		}
+	}
+
+	if (bRestart)
+	{
+		ResetAnalysis();
+	}
+}
+
+void FBeamAnalyticsWorker::ResetAnalysis()
+{
+	Analyzer = FBeamGazeAnalyzer(Config.MinFixationDuration, Config.WindowSeconds);
+	Analyzer.ReserveForRate(Config.SamplingRate);
+	Analyzer.SetEventCapture(true);
+	RecentEvents.Reset();
+	LastSampleSeconds = -TNumericLimits<double>::Max();
+}
+
+bool FBeamAnalyticsWorker::AddFrame(const FBeamFrame& Frame)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamAnalyticsWorkerFrame);
+	if (!Frame.Gaze.bValid || Frame.Gaze.Confidence <= Config.MinConfidence)
+	{
+		return false;
+	}
+
+	// Pace on the tracker clock so results do not depend on when this thread wakes up
+	const double FrameSeconds = Frame.SDKTimestampMs * 0.001;
+	const double Interval = Config.SamplingRate > 0.0f ? 1.0 / Config.SamplingRate : 0.0;
+	if (FrameSeconds - LastSampleSeconds < Interval)
+	{
+		return false;
+	}
+
+	Analyzer.AddSample(Frame.Gaze.Screen01, FrameSeconds);
+	LastSampleSeconds = FrameSeconds;
+	LastSampleUESeconds = Frame.UETimestampSeconds;
+	return true;
+}
+
+void FBeamAnalyticsWorker::PublishSnapshot()
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamAnalyticsWorkerSnapshot);
+	TSharedRef<FBeamAnalyticsSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FBeamAnalyticsSnapshot, ESPMode::ThreadSafe>();
+	Snapshot->Sequence = NextSequence++;
+	Snapshot->Generation = AppliedGeneration;
+	Analyzer.Analyze(Snapshot->Analytics);
+	Snapshot->Analytics.TimeStamp = static_cast<float>(LastSampleUESeconds);
+
+	DrainedEvents.Reset();
+	Analyzer.DrainEvents(DrainedEvents);
+	RecentEvents.Append(DrainedEvents);
+	NextEventId += DrainedEvents.Num();
+	if (RecentEvents.Num() > MaxRecentEvents)
+	{
+		RecentEvents.RemoveAt(0, RecentEvents.Num() - MaxRecentEvents, EAllowShrinking::No);
+	}
+	Snapshot->RecentEvents = RecentEvents;
+	Snapshot->FirstEventId = NextEventId - RecentEvents.Num();
+
+	// Analyzed before a reset that arrived mid-batch; the next batch publishes from the cleared state
+	FScopeLock Lock(&SnapshotLock);
+	if (Snapshot->Generation == ResetGeneration.load(std::memory_order_relaxed))
+	{
+		LatestSnapshot = Snapshot;
+	}
+}
+
+uint32 FBeamAnalyticsWorker::Run()
+{
+	LLM_SCOPE_BYTAG(BeamEyeTracker);
+	GBeamResources.RegisterCurrentThread(TEXT("BeamAnalyticsWorker"));
+
+	// Analytics describe gaze from the moment the worker starts
+	const int32 ConsumerId = Ring.RegisterConsumer(TEXT("Analytics"));
+	if (ConsumerId == INDEX_NONE)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: No free frame ring cursor for the analytics worker"));
+		GBeamResources.UnregisterCurrentThread();
+		return 1;
+	}
+	uint32 ClearCount = Ring.GetClearCount();
+
+	while (!bStopRequested.load(std::memory_order_acquire))
+	{
+		ApplyPendingControl();
+
+		// A cleared ring restarts with a new timestamp origin that the open windows cannot span
+		const uint32 CurrentClearCount = Ring.GetClearCount();
+		if (CurrentClearCount != ClearCount)
+		{
+			ClearCount = CurrentClearCount;
+			ResetAnalysis();
+		}
+
+		if (Ring.ConsumeFrames(ConsumerId, Scratch) == 0)
+		{
+			FPlatformProcess::Sleep(BEAM_ANALYTICS_IDLE_SECONDS);
+			continue;
+		}
+
+		int32 NumSampled = 0;
+		for (const FBeamFrame& Frame : Scratch)
+		{
+			NumSampled += AddFrame(Frame) ? 1 : 0;
+		}
+
+		if (NumSampled > 0)
+		{
+			PublishSnapshot();
+		}
+	}
+
+	Ring.UnregisterConsumer(ConsumerId);
+	GBeamResources.UnregisterCurrentThread();
+	return 0;
+}
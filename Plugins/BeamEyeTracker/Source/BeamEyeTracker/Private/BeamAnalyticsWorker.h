@@ -0,0 +1,147 @@
+/*=============================================================================
+    BeamAnalyticsWorker.h: Background gaze analytics for Beam SDK.
+
+    Follows the subsystem frame ring on a dedicated thread, runs the
+    streaming fixation/saccade classifier there and publishes immutable
+    snapshots that the game thread picks up with one pointer copy.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamGazeAnalyzer.h"
+#include "BeamRing.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+class FRunnableThread;
+
+/** Analytics sampling and classification parameters */
+struct FBeamAnalyticsWorkerConfig
+{
+	/** Samples per second fed to the classifier, paced on the tracker clock */
+	float SamplingRate = 60.0f;
+	float MinFixationDuration = 0.1f;
+	double WindowSeconds = 10.0;
+
+	/** Frames at or below this gaze confidence are skipped */
+	float MinConfidence = 0.5f;
+};
+
+/** Analytics state as of one worker update; never modified after publication */
+struct FBeamAnalyticsSnapshot
+{
+	/** Completed events carried in each snapshot; far more than close between two game frames */
+	static constexpr int32 MaxRecentEvents = 64;
+
+	/** Held inline, so publishing allocates the snapshot and nothing more for its events */
+	using FRecentEvents = TArray<FBeamGazeEvent, TInlineAllocator<MaxRecentEvents>>;
+
+	/** Increases with every published snapshot */
+	uint64 Sequence = 0;
+
+	/** Reset generation the snapshot was analyzed in; see FBeamAnalyticsWorker::RequestReset */
+	uint32 Generation = 0;
+
+	FGazeAnalytics Analytics;
+
+	/** Most recent completed events, oldest first; RecentEvents[i] has id FirstEventId + i */
+	FRecentEvents RecentEvents;
+	uint64 FirstEventId = 0;
+};
+
+using FBeamAnalyticsSnapshotPtr = TSharedPtr<const FBeamAnalyticsSnapshot, ESPMode::ThreadSafe>;
+
+/**
+ * Runs gaze analytics off the game thread.
+ *
+ * The worker drains the ring through its own consumer cursor, like the
+ * network stream sender, so it never contends with the producer. After
+ * each batch that added samples it publishes a new snapshot; consumers
+ * that fall behind skip straight to the newest one and use the event ids
+ * to fire every event exactly once. The owner must Shutdown() the worker
+ * before the ring is freed.
+ */
+class FBeamAnalyticsWorker : public FRunnable
+{
+public:
+	static constexpr int32 MaxRecentEvents = FBeamAnalyticsSnapshot::MaxRecentEvents;
+
+	FBeamAnalyticsWorker(const FBeamFrameRing& InRing, const FBeamAnalyticsWorkerConfig& InConfig);
+	virtual ~FBeamAnalyticsWorker() override;
+
+	/** Starts the worker thread (game thread) */
+	bool Start();
+
+	/** Stops the worker thread and waits for it (game thread) */
+	void Shutdown();
+
+	bool IsRunning() const { return Thread != nullptr; }
+
+	/** Applied by the worker before its next batch; a window change restarts the analysis */
+	void SetConfig(const FBeamAnalyticsWorkerConfig& InConfig);
+
+	/**
+	 * Clears all analytics state, event ids included, before the next batch. Returns the new reset
+	 * generation; only snapshots carrying it describe gaze after the reset (game thread).
+	 */
+	uint32 RequestReset();
+
+	/** Newest published snapshot, or null if none since start or the last reset */
+	FBeamAnalyticsSnapshotPtr GetLatestSnapshot() const;
+
+	//~ Begin FRunnable Interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	//~ End FRunnable Interface
+
+private:
+	const FBeamFrameRing& Ring;
+	FRunnableThread* Thread = nullptr;
+
+	std::atomic<bool> bStopRequested;
+
+	/** Bumped under SnapshotLock by every reset request; the worker catches AppliedGeneration up to it */
+	std::atomic<uint32> ResetGeneration;
+
+	mutable FCriticalSection ConfigLock;
+	FBeamAnalyticsWorkerConfig PendingConfig;
+	bool bConfigDirty = false;
+
+	/** Guards only the pointer; snapshots themselves are immutable */
+	mutable FCriticalSection SnapshotLock;
+	FBeamAnalyticsSnapshotPtr LatestSnapshot;
+
+	/** Worker thread state */
+	FBeamAnalyticsWorkerConfig Config;
+	FBeamGazeAnalyzer Analyzer;
+	TArray<FBeamFrame> Scratch;
+	TArray<FBeamGazeEvent> DrainedEvents;
+	FBeamAnalyticsSnapshot::FRecentEvents RecentEvents;
+	uint64 NextEventId = 0;
+	uint64 NextSequence = 1;
+	uint32 AppliedGeneration = 0;
+	double LastSampleSeconds;
+	double LastSampleUESeconds = 0.0;
+
+	/** Applies a pending config or reset (worker thread) */
+	void ApplyPendingControl();
+
+	/** Rebuilds the classifier for the current config (worker thread) */
+	void ResetAnalysis();
+
+	/** Feeds one frame to the classifier if it passes confidence and pacing; returns true if it was sampled */
+	bool AddFrame(const FBeamFrame& Frame);
+
+	void PublishSnapshot();
+};
+
+/*=============================================================================
+    End of BeamAnalyticsWorker.h
+=============================================================================*/
@@ -0,0 +1,112 @@
+// Implements the commandlet running gaze analytics over many recordings in parallel
+
+#include "BeamAnalyzeCommandlet.h"
+#include "BeamOfflineAnalytics.h"
+#include "BeamRecording.h"
+#include "BeamLogging.h"
+#include "BeamStats.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BeamAnalyzeCommandlet)
+
+DECLARE_CYCLE_STAT(TEXT("Beam Analyze Recording"), STAT_BeamAnalyzeRecording, STATGROUP_Beam);
+
+UBeamAnalyzeCommandlet::UBeamAnalyzeCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	HelpDescription = TEXT("Runs fixation, saccade and tracking quality analysis over every recording in a directory, in parallel");
+	HelpUsage = TEXT("-run=BeamAnalyze -Input=<dir> [-Report=<file.csv>] [-SamplingRate=60] [-MinFixation=0.1] [-MinConfidence=0.5]");
+}
+
+int32 UBeamAnalyzeCommandlet::Main(const FString& Params)
+{
+	FString InputDir;
+	if (FParse::Param(*Params, TEXT("Help")) || !FParse::Value(*Params, TEXT("Input="), InputDir))
+	{
+		UE_LOG(LogBeam, Display, TEXT("%s\n%s"), *HelpDescription, *HelpUsage);
+		return FParse::Param(*Params, TEXT("Help")) ? 0 : 1;
+	}
+
+	FBeamAnalyticsWorkerConfig Config;
+	BeamOfflineAnalytics::ParseConfig(Params, Config);
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *InputDir, TEXT("*.beamrec"), true, false);
+	if (Files.Num() == 0)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamAnalyze: No recordings found under %s"), *InputDir);
+		return 1;
+	}
+
+	// Largest first, so the long sessions start early and the short ones fill in behind them
+	TArray<TPair<int64, FString>> BySize;
+	BySize.Reserve(Files.Num());
+	for (FString& File : Files)
+	{
+		BySize.Emplace(IFileManager::Get().FileSize(*File), MoveTemp(File));
+	}
+	BySize.Sort([](const TPair<int64, FString>& A, const TPair<int64, FString>& B) { return A.Key > B.Key; });
+
+	TArray<FBeamSessionResult> Results;
+	Results.SetNum(BySize.Num());
+	std::atomic<int64> TotalFrames{ 0 };
+
+	UE_LOG(LogBeam, Display, TEXT("BeamAnalyze: Analyzing %d recordings on %d worker threads"), BySize.Num(), FPlatformMisc::NumberOfWorkerThreadsToSpawn() + 1);
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	// One recording per task; Unbalanced lets idle workers pull the next file instead of owning a fixed range
+	ParallelFor(BySize.Num(), [&BySize, &Results, &Config, &TotalFrames](int32 Index)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_BeamAnalyzeRecording);
+
+		const FString& Path = BySize[Index].Value;
+		FBeamSessionResult& Result = Results[Index];
+		Result.Name = FPaths::GetBaseFilename(Path);
+		Result.Tag = FPaths::GetCleanFilename(FPaths::GetPath(Path));
+
+		FBeamRecording Reader;
+		if (!Reader.StartPlayback(Path, true))
+		{
+			UE_LOG(LogBeam, Warning, TEXT("BeamAnalyze: Skipping unreadable recording %s"), *Path);
+			return;
+		}
+
+		FBeamSessionAnalysis Analysis(Config);
+		FBeamFrame Frame;
+		while (Reader.GetNextFrame(Frame))
+		{
+			Analysis.AddFrame(Frame.SDKTimestampMs, Frame.Gaze.Screen01, Frame.Gaze.bValid ? Frame.Gaze.Confidence : 0.0);
+		}
+		Reader.StopPlayback();
+
+		Analysis.GetResult(Result);
+		TotalFrames.fetch_add(Result.NumFrames, std::memory_order_relaxed);
+	}, EParallelForFlags::Unbalanced);
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+	const int64 Frames = TotalFrames.load(std::memory_order_relaxed);
+	UE_LOG(LogBeam, Display, TEXT("BeamAnalyze: %lld frames in %.2f s (%.1f M frames/s)"),
+		Frames, ElapsedSeconds, ElapsedSeconds > 0.0 ? Frames / ElapsedSeconds / 1.0e6 : 0.0);
+
+	TMap<FString, FBeamAnalyticsAccumulator> ByTag;
+	BeamOfflineAnalytics::AggregateByTag(Results, ByTag);
+	BeamOfflineAnalytics::LogByTag(ByTag);
+
+	FString ReportPath;
+	if (FParse::Value(*Params, TEXT("Report="), ReportPath) && !BeamOfflineAnalytics::WriteReport(ReportPath, Results, ByTag))
+	{
+		return 1;
+	}
+
+	const int32 NumFailed = Results.FilterByPredicate([](const FBeamSessionResult& Result) { return !Result.bValid; }).Num();
+	return NumFailed == Results.Num() ? 1 : 0;
+}
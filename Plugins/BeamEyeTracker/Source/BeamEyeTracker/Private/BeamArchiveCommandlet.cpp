@@ -0,0 +1,131 @@
+// Implements the commandlet that packs recordings into a session archive and queries it
+
+#include "BeamArchiveCommandlet.h"
+#include "BeamOfflineAnalytics.h"
+#include "BeamSessionArchive.h"
+#include "BeamLogging.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BeamArchiveCommandlet)
+
+UBeamArchiveCommandlet::UBeamArchiveCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	HelpDescription = TEXT("Packs .beamrec recordings into a columnar session archive, or runs gaze analytics per tag over one");
+	HelpUsage = TEXT("-run=BeamArchive -Input=<dir> -Output=<file.beamarc> | -Archive=<file.beamarc> [-Tag=] [-Report=<file.csv>]");
+}
+
+int32 UBeamArchiveCommandlet::Main(const FString& Params)
+{
+	if (FParse::Param(*Params, TEXT("Help")))
+	{
+		UE_LOG(LogBeam, Display, TEXT("%s\n%s"), *HelpDescription, *HelpUsage);
+		return 0;
+	}
+
+	FString Unused;
+	if (FParse::Value(*Params, TEXT("Archive="), Unused))
+	{
+		return RunQuery(Params);
+	}
+	return RunPack(Params);
+}
+
+int32 UBeamArchiveCommandlet::RunPack(const FString& Params)
+{
+	FString InputDir;
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Input="), InputDir) || !FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamArchive: -Input=<dir> and -Output=<file> are required. %s"), *HelpUsage);
+		return 1;
+	}
+
+	EBeamRecordingCompression Compression = EBeamRecordingCompression::Oodle;
+	FString CompressionName;
+	if (FParse::Value(*Params, TEXT("Compression="), CompressionName))
+	{
+		Compression = CompressionName.Equals(TEXT("None"), ESearchCase::IgnoreCase) ? EBeamRecordingCompression::None
+			: CompressionName.Equals(TEXT("Zlib"), ESearchCase::IgnoreCase) ? EBeamRecordingCompression::Zlib
+			: EBeamRecordingCompression::Oodle;
+	}
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *InputDir, TEXT("*.beamrec"), true, false);
+	Files.Sort();
+	if (Files.Num() == 0)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamArchive: No recordings found under %s"), *InputDir);
+		return 1;
+	}
+
+	TArray<FBeamArchiveSource> Sources;
+	Sources.Reserve(Files.Num());
+	for (const FString& File : Files)
+	{
+		Sources.Add({ File, FPaths::GetCleanFilename(FPaths::GetPath(File)) });
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	if (!FBeamSessionArchiveWriter::Pack(Sources, OutputPath, Compression))
+	{
+		return 1;
+	}
+
+	UE_LOG(LogBeam, Display, TEXT("BeamArchive: Packed %d recordings in %.1f s (%lld bytes)"),
+		Sources.Num(), FPlatformTime::Seconds() - StartSeconds, IFileManager::Get().FileSize(*OutputPath));
+	return 0;
+}
+
+int32 UBeamArchiveCommandlet::RunQuery(const FString& Params)
+{
+	FString ArchivePath;
+	FParse::Value(*Params, TEXT("Archive="), ArchivePath);
+
+	FBeamSessionArchiveReader Reader;
+	if (!Reader.Open(ArchivePath))
+	{
+		return 1;
+	}
+
+	FString Tag;
+	double StartMs = TNumericLimits<double>::Lowest();
+	double EndMs = TNumericLimits<double>::Max();
+	FParse::Value(*Params, TEXT("Tag="), Tag);
+	FParse::Value(*Params, TEXT("StartMs="), StartMs);
+	FParse::Value(*Params, TEXT("EndMs="), EndMs);
+
+	FBeamAnalyticsWorkerConfig Config;
+	BeamOfflineAnalytics::ParseConfig(Params, Config);
+
+	TArray<int32> SessionIndices;
+	Reader.FindSessions(Tag, StartMs, EndMs, SessionIndices);
+	if (SessionIndices.Num() == 0)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamArchive: No sessions in %s match the query"), *ArchivePath);
+		return 0;
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	TArray<FBeamSessionResult> Results;
+	Reader.AnalyzeSessions(SessionIndices, Config, StartMs, EndMs, Results);
+
+	TMap<FString, FBeamAnalyticsAccumulator> ByTag;
+	BeamOfflineAnalytics::AggregateByTag(Results, ByTag);
+
+	UE_LOG(LogBeam, Display, TEXT("BeamArchive: Analyzed %d sessions in %.2f s"), SessionIndices.Num(), FPlatformTime::Seconds() - StartSeconds);
+	BeamOfflineAnalytics::LogByTag(ByTag);
+
+	FString ReportPath;
+	if (FParse::Value(*Params, TEXT("Report="), ReportPath) && !BeamOfflineAnalytics::WriteReport(ReportPath, Results, ByTag))
+	{
+		return 1;
+	}
+	return 0;
+}
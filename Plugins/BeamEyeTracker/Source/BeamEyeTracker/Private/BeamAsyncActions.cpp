@@ -2,6 +2,7 @@
 
 #include "BeamAsyncActions.h"
 #include "BeamEyeTrackerSubsystem.h"
+#include "BeamFocusSubsystem.h"
 #include "BeamLogging.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
@@ -46,49 +47,26 @@ void UBeamWaitForValidGaze::Activate()
 		return;
 	}
 
-	// Start polling timer for gaze data
-	World->GetTimerManager().SetTimer(
-		PollingTimerHandle,
-		this,
-		&UBeamWaitForValidGaze::PollForValidGaze,
-		ThrottleIntervalMs / 1000.0f, // Convert to seconds
-		true // Repeat
-	);
-}
-
-void UBeamWaitForValidGaze::PollForValidGaze()
-{
-	if (!WorldContext)
-	{
-		CompleteAction();
-		return;
-	}
-
-	UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::LogAndReturnNull);
-	if (!World)
+	// The focus dispatcher walks the ring once per tick for every listener, so no per-action timer is needed
+	UBeamFocusSubsystem* Focus = World->GetSubsystem<UBeamFocusSubsystem>();
+	if (!Focus)
 	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamAsyncActions: No focus dispatcher in this world, completing action"));
 		CompleteAction();
 		return;
 	}
 
-	UBeamEyeTrackerSubsystem* Subsystem = nullptr;
-	if (UGameInstance* GameInstance = World->GetGameInstance())
-	{
-		Subsystem = GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>();
-	}
-	
-	if (!Subsystem)
-	{
-		CompleteAction();
-		return;
-	}
-
-	FGazePoint GazePoint = Subsystem->CurrentGaze();
+	FocusSubsystem = Focus;
+	NewFrameHandle = Focus->OnNewFrame.AddUObject(this, &UBeamWaitForValidGaze::HandleNewFrame);
+}
 
+void UBeamWaitForValidGaze::HandleNewFrame(const FBeamFrame& Frame)
+{
+	const FGazePoint& GazePoint = Frame.Gaze;
 	if (GazePoint.bValid && GazePoint.Confidence >= MinimumConfidence)
 	{
 		// Throttle callbacks to avoid excessive firing
-		double CurrentTime = World->GetTimeSeconds();
+		const double CurrentTime = Frame.UETimestampSeconds;
 		if (CurrentTime - LastCallbackTime >= (ThrottleIntervalMs / 1000.0f))
 		{
 			// Broadcast OnGazeReceived delegate when valid gaze is found
@@ -102,13 +80,12 @@ void UBeamWaitForValidGaze::PollForValidGaze()
 void UBeamWaitForValidGaze::CompleteAction()
 {
 	
-	if (WorldContext)
+	if (UBeamFocusSubsystem* Focus = FocusSubsystem.Get())
 	{
-		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::LogAndReturnNull))
-		{
-			World->GetTimerManager().ClearTimer(PollingTimerHandle);
-		}
+		Focus->OnNewFrame.Remove(NewFrameHandle);
 	}
+	FocusSubsystem.Reset();
+	NewFrameHandle.Reset();
 	
 	// Log completion of async operation for debugging
 	UE_LOG(LogBeam, Log, TEXT("BeamAsyncActions: Completed WaitForValidGaze operation"));
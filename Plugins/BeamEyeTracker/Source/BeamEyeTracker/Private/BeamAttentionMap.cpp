@@ -0,0 +1,243 @@
+// Implements the sparse voxel gaze attention accumulator
+
+#include "BeamAttentionMap.h"
+#include "BeamLogging.h"
+#include "Components/PrimitiveComponent.h"
+#include "DrawDebugHelpers.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+FBeamAttentionMap::FBeamAttentionMap(float InVoxelSize, int32 InMaxCells, int32 InMaxPrimitives)
+	: VoxelSize(FMath::Max(InVoxelSize, 1.0f))
+	, MaxCells(FMath::Max(InMaxCells, 64))
+	, MaxPrimitives(FMath::Max(InMaxPrimitives, 1))
+{
+}
+
+void FBeamAttentionMap::AddSample(const FVector& WorldLocation, float Weight, const UPrimitiveComponent* Primitive)
+{
+	AddSample(WorldLocation, Weight, Primitive ? FName(*Primitive->GetPathName()) : NAME_None);
+}
+
+void FBeamAttentionMap::AddSample(const FVector& WorldLocation, float Weight, FName PrimitiveName)
+{
+	AddToCell(GetCellKey(WorldLocation), Weight, 1);
+	AddToPrimitive(PrimitiveName, Weight, 1);
+	++TotalSamples;
+}
+
+void FBeamAttentionMap::Merge(const FBeamAttentionMap& Other)
+{
+	while (VoxelSize < Other.VoxelSize * 0.999f)
+	{
+		Coarsen();
+	}
+
+	for (const TPair<FIntVector, FBeamAttentionCell>& Pair : Other.Cells)
+	{
+		AddToCell(GetCellKey(Other.GetCellCenter(Pair.Key)), Pair.Value.Weight, Pair.Value.Count);
+	}
+	for (const TPair<FName, FBeamAttentionCell>& Pair : Other.Primitives)
+	{
+		AddToPrimitive(Pair.Key, Pair.Value.Weight, Pair.Value.Count);
+	}
+	TotalSamples += Other.TotalSamples;
+}
+
+void FBeamAttentionMap::Reset()
+{
+	Cells.Reset();
+	Primitives.Reset();
+	TotalSamples = 0;
+}
+
+FIntVector FBeamAttentionMap::GetCellKey(const FVector& WorldLocation) const
+{
+	const FVector Scaled = WorldLocation / VoxelSize;
+	return FIntVector(FMath::FloorToInt32(Scaled.X), FMath::FloorToInt32(Scaled.Y), FMath::FloorToInt32(Scaled.Z));
+}
+
+void FBeamAttentionMap::AddToCell(const FIntVector& Key, float Weight, uint32 Count)
+{
+	if (FBeamAttentionCell* Existing = Cells.Find(Key))
+	{
+		Existing->Weight += Weight;
+		Existing->Count += Count;
+		return;
+	}
+
+	FIntVector FinalKey = Key;
+	while (Cells.Num() >= MaxCells)
+	{
+		Coarsen();
+		FinalKey = FIntVector(FinalKey.X >> 1, FinalKey.Y >> 1, FinalKey.Z >> 1);
+	}
+
+	FBeamAttentionCell& Cell = Cells.FindOrAdd(FinalKey);
+	Cell.Weight += Weight;
+	Cell.Count += Count;
+}
+
+void FBeamAttentionMap::AddToPrimitive(FName PrimitiveName, float Weight, uint32 Count)
+{
+	FBeamAttentionCell* Cell = Primitives.Find(PrimitiveName);
+	if (!Cell)
+	{
+		Cell = &Primitives.FindOrAdd(Primitives.Num() < MaxPrimitives ? PrimitiveName : NAME_None);
+	}
+	Cell->Weight += Weight;
+	Cell->Count += Count;
+}
+
+void FBeamAttentionMap::Coarsen()
+{
+	// Arithmetic shift floors negative keys too, so every old cell lands inside its new parent
+	TMap<FIntVector, FBeamAttentionCell> Coarse;
+	Coarse.Reserve(Cells.Num() / 2);
+	for (const TPair<FIntVector, FBeamAttentionCell>& Pair : Cells)
+	{
+		FBeamAttentionCell& Cell = Coarse.FindOrAdd(FIntVector(Pair.Key.X >> 1, Pair.Key.Y >> 1, Pair.Key.Z >> 1));
+		Cell.Weight += Pair.Value.Weight;
+		Cell.Count += Pair.Value.Count;
+	}
+	Cells = MoveTemp(Coarse);
+	VoxelSize *= 2.0f;
+
+	UE_LOG(LogBeam, Verbose, TEXT("BeamEyeTracker: Attention map coarsened to %.0f cm voxels (%d cells)"), VoxelSize, Cells.Num());
+}
+
+bool FBeamAttentionMap::SaveToFile(const FString& FilePath) const
+{
+	TArray<uint8> Bytes;
+	Bytes.Reserve(32 + Cells.Num() * 20);
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	float Size = VoxelSize;
+	uint64 Samples = TotalSamples;
+	int32 NumCells = Cells.Num();
+	int32 NumPrimitives = Primitives.Num();
+	Writer << Magic << Version << Size << Samples << NumCells << NumPrimitives;
+
+	for (const TPair<FIntVector, FBeamAttentionCell>& Pair : Cells)
+	{
+		FIntVector Key = Pair.Key;
+		FBeamAttentionCell Cell = Pair.Value;
+		Writer << Key.X << Key.Y << Key.Z << Cell.Weight << Cell.Count;
+	}
+	for (const TPair<FName, FBeamAttentionCell>& Pair : Primitives)
+	{
+		FString Name = Pair.Key.IsNone() ? FString() : Pair.Key.ToString();
+		FBeamAttentionCell Cell = Pair.Value;
+		Writer << Name << Cell.Weight << Cell.Count;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Failed to write attention map %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool FBeamAttentionMap::LoadFromFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Failed to read attention map %s"), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	float Size = 0.0f;
+	uint64 Samples = 0;
+	int32 NumCells = 0;
+	int32 NumPrimitives = 0;
+	Reader << Magic << Version << Size << Samples << NumCells << NumPrimitives;
+
+	if (Reader.IsError() || Magic != FileMagic || Version != FileVersion || Size < 1.0f || NumCells < 0 || NumPrimitives < 0
+		|| static_cast<int64>(NumCells) * 20 > Bytes.Num())
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: %s is not a valid attention map"), *FilePath);
+		return false;
+	}
+
+	Reset();
+	VoxelSize = Size;
+	TotalSamples = Samples;
+	Cells.Reserve(NumCells);
+	for (int32 i = 0; i < NumCells && !Reader.IsError(); ++i)
+	{
+		FIntVector Key;
+		FBeamAttentionCell Cell;
+		Reader << Key.X << Key.Y << Key.Z << Cell.Weight << Cell.Count;
+		Cells.Add(Key, Cell);
+	}
+	for (int32 i = 0; i < NumPrimitives && !Reader.IsError(); ++i)
+	{
+		FString Name;
+		FBeamAttentionCell Cell;
+		Reader << Name << Cell.Weight << Cell.Count;
+		Primitives.Add(Name.IsEmpty() ? NAME_None : FName(*Name), Cell);
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Attention map %s is truncated"), *FilePath);
+		Reset();
+		return false;
+	}
+
+	// Files from a finer map than this one allows are coarsened on load
+	while (Cells.Num() > MaxCells)
+	{
+		Coarsen();
+	}
+	return true;
+}
+
+void FBeamAttentionMap::DrawDebug(UWorld* World, float Duration, int32 MaxCellsToDraw) const
+{
+#if ENABLE_DRAW_DEBUG
+	if (!World || Cells.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<TPair<FIntVector, FBeamAttentionCell>> Sorted = Cells.Array();
+	Sorted.Sort([](const TPair<FIntVector, FBeamAttentionCell>& A, const TPair<FIntVector, FBeamAttentionCell>& B)
+	{
+		return A.Value.Weight > B.Value.Weight;
+	});
+
+	const int32 NumToDraw = FMath::Min(Sorted.Num(), FMath::Max(MaxCellsToDraw, 1));
+	const float MaxWeight = FMath::Max(Sorted[0].Value.Weight, UE_SMALL_NUMBER);
+	const FVector Extent(VoxelSize * 0.5f);
+
+	for (int32 i = 0; i < NumToDraw; ++i)
+	{
+		// Square root spreads the low end so faint attention stays visible next to hot spots
+		const float Heat = FMath::Sqrt(Sorted[i].Value.Weight / MaxWeight);
+		const FColor Color = FLinearColor::LerpUsingHSV(FLinearColor(0.0f, 0.2f, 1.0f), FLinearColor(1.0f, 0.0f, 0.0f), Heat).ToFColor(true);
+		DrawDebugSolidBox(World, GetCellCenter(Sorted[i].Key), Extent * FMath::Lerp(0.4f, 1.0f, Heat), FColor(Color.R, Color.G, Color.B, 160), false, Duration);
+	}
+#endif
+}
+
+void FBeamAttentionMap::GetTopPrimitives(int32 MaxEntries, TArray<TPair<FName, FBeamAttentionCell>>& OutEntries) const
+{
+	OutEntries = Primitives.Array();
+	OutEntries.Sort([](const TPair<FName, FBeamAttentionCell>& A, const TPair<FName, FBeamAttentionCell>& B)
+	{
+		return A.Value.Weight > B.Value.Weight;
+	});
+	if (OutEntries.Num() > MaxEntries)
+	{
+		OutEntries.SetNum(FMath::Max(MaxEntries, 0));
+	}
+}
@@ -0,0 +1,116 @@
+// Implements session attention collection and the attention console commands
+
+#include "BeamAttentionSubsystem.h"
+#include "BeamLogging.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+void UBeamAttentionSubsystem::RecordGazeInteraction(const FGazeInteraction& Interaction)
+{
+	if (Interaction.bIsValid)
+	{
+		const float Weight = Interaction.InteractionTime > 0.0f ? Interaction.InteractionTime : Interaction.Confidence;
+		AttentionMap.AddSample(Interaction.WorldLocation, Weight, Interaction.TargetComponent);
+	}
+}
+
+void UBeamAttentionSubsystem::RecordGazeHit(const FHitResult& Hit, float Confidence)
+{
+	if (Hit.bBlockingHit)
+	{
+		AttentionMap.AddSample(Hit.ImpactPoint, Confidence, Hit.GetComponent());
+	}
+}
+
+void UBeamAttentionSubsystem::ClearAttention()
+{
+	AttentionMap.Reset();
+}
+
+bool UBeamAttentionSubsystem::SaveAttention(const FString& FilePath) const
+{
+	return AttentionMap.SaveToFile(FilePath);
+}
+
+bool UBeamAttentionSubsystem::MergeAttention(const FString& FilePath)
+{
+	FBeamAttentionMap Loaded;
+	if (!Loaded.LoadFromFile(FilePath))
+	{
+		return false;
+	}
+	AttentionMap.Merge(Loaded);
+	return true;
+}
+
+void UBeamAttentionSubsystem::DrawAttention(const UObject* WorldContextObject, float Duration, int32 MaxCells) const
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	AttentionMap.DrawDebug(World, Duration, MaxCells);
+}
+
+TArray<FBeamAttentionEntry> UBeamAttentionSubsystem::GetTopAttendedPrimitives(int32 MaxEntries) const
+{
+	TArray<TPair<FName, FBeamAttentionCell>> Top;
+	AttentionMap.GetTopPrimitives(MaxEntries, Top);
+
+	TArray<FBeamAttentionEntry> Result;
+	Result.Reserve(Top.Num());
+	for (const TPair<FName, FBeamAttentionCell>& Pair : Top)
+	{
+		FBeamAttentionEntry& Entry = Result.AddDefaulted_GetRef();
+		Entry.PrimitiveName = Pair.Key.IsNone() ? FString() : Pair.Key.ToString();
+		Entry.Weight = Pair.Value.Weight;
+		Entry.Samples = static_cast<int32>(FMath::Min<uint32>(Pair.Value.Count, MAX_int32));
+	}
+	return Result;
+}
+
+static UBeamAttentionSubsystem* GetAttentionSubsystem(UWorld* World)
+{
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UBeamAttentionSubsystem>() : nullptr;
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BeamAttentionDrawCommand(
+	TEXT("Beam.Attention.Draw"),
+	TEXT("Draw attention for 30 s: the session map, or the merge of the .beamattn files given as arguments (works in the editor)"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (Args.Num() == 0)
+		{
+			if (UBeamAttentionSubsystem* Attention = GetAttentionSubsystem(World))
+			{
+				Attention->GetAttentionMap().DrawDebug(World, 30.0f);
+			}
+			return;
+		}
+
+		FBeamAttentionMap Merged;
+		for (const FString& FilePath : Args)
+		{
+			FBeamAttentionMap Session;
+			if (Session.LoadFromFile(FilePath))
+			{
+				Merged.Merge(Session);
+			}
+		}
+		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Drawing %llu attention samples from %d files (%d cells of %.0f cm)"),
+			Merged.GetTotalSamples(), Args.Num(), Merged.GetNumCells(), Merged.GetVoxelSize());
+		Merged.DrawDebug(World, 30.0f);
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs BeamAttentionSaveCommand(
+	TEXT("Beam.Attention.Save"),
+	TEXT("Save the session attention map to the given .beamattn file"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UBeamAttentionSubsystem* Attention = GetAttentionSubsystem(World);
+		if (Attention && Args.Num() > 0 && Attention->SaveAttention(Args[0]))
+		{
+			UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Saved attention map to %s"), *Args[0]);
+		}
+	}));
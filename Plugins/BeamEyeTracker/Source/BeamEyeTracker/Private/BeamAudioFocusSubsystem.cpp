@@ -0,0 +1,231 @@
+// Implements per-frame gaze focus scoring for audio emitters
+
+#include "BeamAudioFocusSubsystem.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamGazeTargetSubsystem.h"
+#include "BeamRing.h"
+#include "Components/AudioComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+// Cutoff a fully focused emitter returns to when the unfocused cutoff is applied
+#define BEAM_AUDIO_FOCUS_OPEN_LOWPASS_HZ 20000.0f
+
+bool UBeamAudioFocusSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UBeamAudioFocusSubsystem::Deinitialize()
+{
+	for (TPair<TObjectKey<AActor>, FFocusActor>& Pair : Managed)
+	{
+		Release(Pair.Key, Pair.Value);
+	}
+	Managed.Empty();
+	NumEmitters = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UBeamAudioFocusSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBeamAudioFocusSubsystem, STATGROUP_Tickables);
+}
+
+void UBeamAudioFocusSubsystem::RegisterEmitter(UAudioComponent* Component)
+{
+	AActor* Owner = Component ? Component->GetOwner() : nullptr;
+	if (!Owner)
+	{
+		return;
+	}
+
+	FFocusActor& Entry = Managed.FindOrAdd(Owner);
+	if (Entry.Emitters.ContainsByPredicate([Component](const FFocusEmitter& Emitter) { return Emitter.Component.Get() == Component; }))
+	{
+		return;
+	}
+
+	FFocusEmitter& Emitter = Entry.Emitters.AddDefaulted_GetRef();
+	Emitter.Component = Component;
+	Emitter.OriginalVolume = Component->VolumeMultiplier;
+	Emitter.OriginalLowPassHz = Component->LowPassFilterFrequency;
+	Emitter.bOriginalLowPassEnabled = Component->bEnableLowPassFilter;
+	++NumEmitters;
+
+	// Projection comes from the gaze target grid, which is built once per frame for every registered target
+	UBeamGazeTargetSubsystem* Targets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>();
+	if (Targets && !Entry.bRegisteredGazeTarget && !Targets->IsGazeTargetRegistered(Owner))
+	{
+		Targets->RegisterGazeTarget(Owner);
+		Entry.bRegisteredGazeTarget = true;
+	}
+}
+
+void UBeamAudioFocusSubsystem::UnregisterEmitter(UAudioComponent* Component)
+{
+	AActor* Owner = Component ? Component->GetOwner() : nullptr;
+	FFocusActor* Entry = Owner ? Managed.Find(Owner) : nullptr;
+	if (!Entry)
+	{
+		return;
+	}
+
+	const int32 Index = Entry->Emitters.IndexOfByPredicate([Component](const FFocusEmitter& Emitter) { return Emitter.Component.Get() == Component; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	Restore(Entry->Emitters[Index]);
+	Entry->Emitters.RemoveAtSwap(Index);
+	--NumEmitters;
+
+	if (Entry->Emitters.Num() == 0)
+	{
+		Release(Owner, *Entry);
+		Managed.Remove(Owner);
+	}
+}
+
+float UBeamAudioFocusSubsystem::GetAudioFocus(const UAudioComponent* Component) const
+{
+	const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+	const FFocusActor* Entry = Owner ? Managed.Find(Owner) : nullptr;
+	return Entry ? Entry->Focus : 1.0f;
+}
+
+void UBeamAudioFocusSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Managed.Num() == 0)
+	{
+		return;
+	}
+
+	UpdateTargetFocus();
+
+	// Frame-rate independent one-pole easing
+	const float AttackAlpha = AttackSeconds > 0.0f ? 1.0f - FMath::Exp(-DeltaTime / AttackSeconds) : 1.0f;
+	const float ReleaseAlpha = ReleaseSeconds > 0.0f ? 1.0f - FMath::Exp(-DeltaTime / ReleaseSeconds) : 1.0f;
+
+	for (auto It = Managed.CreateIterator(); It; ++It)
+	{
+		FFocusActor& Entry = It.Value();
+		Entry.Focus += (Entry.TargetFocus - Entry.Focus) * (Entry.TargetFocus > Entry.Focus ? AttackAlpha : ReleaseAlpha);
+
+		for (int32 Index = Entry.Emitters.Num() - 1; Index >= 0; --Index)
+		{
+			FFocusEmitter& Emitter = Entry.Emitters[Index];
+			if (!Emitter.Component.IsValid())
+			{
+				Entry.Emitters.RemoveAtSwap(Index);
+				--NumEmitters;
+				continue;
+			}
+			ApplyFocus(Emitter, Entry.Focus);
+		}
+
+		if (Entry.Emitters.Num() == 0)
+		{
+			Release(It.Key(), Entry);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UBeamAudioFocusSubsystem::UpdateTargetFocus()
+{
+	UBeamGazeTargetSubsystem* Targets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>();
+	UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	const UBeamEyeTrackerSubsystem* Beam = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	const FBeamFrameRing* Ring = Beam ? Beam->GetFrameRing() : nullptr;
+
+	// Without gaze or a view the mix returns to neutral rather than ducking everything
+	FBeamFrame Frame;
+	FIntRect ViewRect;
+	FVector2f GazePx;
+	const bool bHasGaze = Targets && Targets->GetViewRect(ViewRect) && Ring && Ring->ReadLatest(Frame) && Frame.Gaze.bValid
+		&& Targets->Screen01ToViewportPx(Frame.Gaze.Screen01, GazePx);
+
+	const float NeutralFocus = bHasGaze ? 0.0f : 1.0f;
+	for (TPair<TObjectKey<AActor>, FFocusActor>& Pair : Managed)
+	{
+		Pair.Value.TargetFocus = NeutralFocus;
+	}
+	if (!bHasGaze)
+	{
+		return;
+	}
+
+	// Only on-screen targets are visited; emitters behind the camera keep the zero set above
+	const float FalloffPx = FMath::Max(GazeFalloff, 0.01f) * FVector2f(ViewRect.Size()).Size();
+	Targets->ForEachScreenTarget([this, &GazePx, FalloffPx](AActor* Actor, const FBox2f& ScreenRect, float Depth)
+	{
+		if (FFocusActor* Entry = Managed.Find(Actor))
+		{
+			const float Distance = UBeamGazeTargetSubsystem::DistanceToRect(ScreenRect, GazePx) / FalloffPx;
+			Entry->TargetFocus = 1.0f / (1.0f + Distance * Distance);
+		}
+	});
+}
+
+void UBeamAudioFocusSubsystem::ApplyFocus(FFocusEmitter& Emitter, float Focus) const
+{
+	if (Emitter.AppliedFocus >= 0.0f && FMath::Abs(Focus - Emitter.AppliedFocus) < ApplyThreshold)
+	{
+		return;
+	}
+	Emitter.AppliedFocus = Focus;
+
+	UAudioComponent* Component = Emitter.Component.Get();
+	Component->SetVolumeMultiplier(Emitter.OriginalVolume * FMath::Lerp(UnfocusedVolume, 1.0f, Focus));
+
+	if (UnfocusedLowPassHz > 0.0f)
+	{
+		const float OpenHz = Emitter.bOriginalLowPassEnabled ? Emitter.OriginalLowPassHz : BEAM_AUDIO_FOCUS_OPEN_LOWPASS_HZ;
+		Component->SetLowPassFilterEnabled(true);
+		Component->SetLowPassFilterFrequency(FMath::Lerp(FMath::Min(UnfocusedLowPassHz, OpenHz), OpenHz, Focus));
+	}
+
+	if (!FocusParameterName.IsNone())
+	{
+		Component->SetFloatParameter(FocusParameterName, Focus);
+	}
+}
+
+void UBeamAudioFocusSubsystem::Restore(const FFocusEmitter& Emitter) const
+{
+	UAudioComponent* Component = Emitter.Component.Get();
+	if (!Component || Emitter.AppliedFocus < 0.0f)
+	{
+		return;
+	}
+
+	Component->SetVolumeMultiplier(Emitter.OriginalVolume);
+	Component->SetLowPassFilterFrequency(Emitter.OriginalLowPassHz);
+	Component->SetLowPassFilterEnabled(Emitter.bOriginalLowPassEnabled);
+	if (!FocusParameterName.IsNone())
+	{
+		Component->SetFloatParameter(FocusParameterName, 1.0f);
+	}
+}
+
+void UBeamAudioFocusSubsystem::Release(const TObjectKey<AActor>& Owner, FFocusActor& Entry)
+{
+	for (const FFocusEmitter& Emitter : Entry.Emitters)
+	{
+		Restore(Emitter);
+	}
+
+	AActor* Actor = Owner.ResolveObjectPtr();
+	UBeamGazeTargetSubsystem* Targets = GetWorld() ? GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>() : nullptr;
+	if (Actor && Targets && Entry.bRegisteredGazeTarget)
+	{
+		Targets->UnregisterGazeTarget(Actor);
+	}
+	Entry.bRegisteredGazeTarget = false;
+}
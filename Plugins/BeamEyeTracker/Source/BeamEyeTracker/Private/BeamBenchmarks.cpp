@@ -0,0 +1,780 @@
+// Implements console micro-benchmarks for the Beam runtime data paths
+
+#include "BeamRing.h"
+#include "BeamFrameCompact.h"
+#include "BeamLogging.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamFilters.h"
+#include "BeamGazeAnalyzer.h"
+#include "BeamSDK_Wrapper.h"
+#include "BeamSyntheticDataSource.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MallocBase.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+#if !UE_BUILD_SHIPPING
+
+// Benchmark Helpers
+
+namespace BeamBenchmarks
+{
+	/** Frames per analysis window used by the ring benchmarks */
+	static constexpr int32 WindowSize = FBeamFrameRing::BufferSize;
+
+	/** Repetitions averaged per measurement */
+	static constexpr int32 Iterations = 64;
+
+	/** Builds a frame with monotonically increasing SDK timestamps at 250 Hz */
+	static FBeamFrame MakeSyntheticFrame(int64 Index)
+	{
+		FBeamFrame Frame;
+		Frame.FrameId = Index;
+		Frame.SDKTimestampMs = Index * 4.0;
+		Frame.UETimestampSeconds = Frame.SDKTimestampMs * 0.001;
+		Frame.Gaze.bValid = true;
+		Frame.Gaze.Screen01 = FVector2D(FMath::Frac(Index * 0.013), FMath::Frac(Index * 0.007));
+		Frame.Gaze.Confidence = 1.0;
+		Frame.Head.PositionCm = FVector(0.0, 0.0, 60.0);
+		Frame.Head.Confidence = 1.0;
+		return Frame;
+	}
+
+	/** Publishes one full window into the ring */
+	static void FillWindow(FBeamFrameRing& Ring, int64& NextIndex)
+	{
+		for (int32 i = 0; i < WindowSize; ++i)
+		{
+			Ring.Publish(MakeSyntheticFrame(NextIndex++));
+		}
+	}
+
+	/**
+	 * Forwards to the real allocator and counts calls made by one thread.
+	 *
+	 * Swapped into GMalloc only around a measured region. Other threads keep
+	 * allocating through it while it is installed, so it never changes what
+	 * the inner allocator sees; blocks are owned by the inner allocator and
+	 * may be freed after the proxy is uninstalled. Allocations served by
+	 * inlined fast paths that bypass GMalloc are not seen.
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInner)
+			: Inner(InInner)
+		{
+		}
+
+		void BeginCounting()
+		{
+			Allocations.store(0, std::memory_order_relaxed);
+			CountedThreadId.store(FPlatformTLS::GetCurrentThreadId(), std::memory_order_release);
+		}
+
+		uint64 EndCounting()
+		{
+			CountedThreadId.store(0, std::memory_order_release);
+			return Allocations.load(std::memory_order_relaxed);
+		}
+
+		FMalloc* GetInner() const { return Inner; }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override { Note(); return Inner->Malloc(Count, Alignment); }
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override { Note(); return Inner->TryMalloc(Count, Alignment); }
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override { Note(); return Inner->Realloc(Original, Count, Alignment); }
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override { Note(); return Inner->TryRealloc(Original, Count, Alignment); }
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("BeamBenchCounting"); }
+
+	private:
+		FMalloc* Inner;
+		std::atomic<uint32> CountedThreadId{ 0 };
+		std::atomic<uint64> Allocations{ 0 };
+
+		void Note()
+		{
+			if (CountedThreadId.load(std::memory_order_relaxed) == FPlatformTLS::GetCurrentThreadId())
+			{
+				Allocations.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+	};
+
+	/** One row of the suite report; AllocsPerOp < 0 means allocations were not measured */
+	struct FBenchResult
+	{
+		FString Name;
+		int64 Ops = 0;
+		double NsPerOp = 0.0;
+		double AllocsPerOp = -1.0;
+	};
+
+	/** Results collected since the last ResetResults, in run order */
+	static TArray<FBenchResult> Results;
+
+	/** Keeps benchmark outputs observable so loops are not optimized away */
+	static volatile double Sink = 0.0;
+
+	static void ResetResults()
+	{
+		Results.Reset();
+	}
+
+	static void AddResult(const TCHAR* Name, int64 Ops, double Seconds, double AllocsPerOp)
+	{
+		FBenchResult& Result = Results.AddDefaulted_GetRef();
+		Result.Name = Name;
+		Result.Ops = Ops;
+		Result.NsPerOp = Ops > 0 ? Seconds * 1e9 / Ops : 0.0;
+		Result.AllocsPerOp = AllocsPerOp;
+
+		if (AllocsPerOp >= 0.0)
+		{
+			UE_LOG(LogBeam, Log, TEXT("  %-36s %10.1f ns/op %8.3f allocs/op  (%lld ops)"), Name, Result.NsPerOp, AllocsPerOp, Ops);
+		}
+		else
+		{
+			UE_LOG(LogBeam, Log, TEXT("  %-36s %10.1f ns/op        - allocs/op  (%lld ops)"), Name, Result.NsPerOp, Ops);
+		}
+	}
+
+	/**
+	 * Runs Body once to warm caches, then times a second run that performs Ops
+	 * operations and counts the allocations it makes on this thread.
+	 */
+	template <typename FuncType>
+	static void Measure(const TCHAR* Name, int64 Ops, FuncType&& Body)
+	{
+		Body();
+
+		// Never destroyed: late frees from other threads may still route through it
+		static FCountingMalloc* Counter = nullptr;
+		if (!Counter)
+		{
+			Counter = new FCountingMalloc(GMalloc);
+		}
+
+		FMalloc* Previous = GMalloc;
+		GMalloc = Counter;
+		Counter->BeginCounting();
+		const double StartSeconds = FPlatformTime::Seconds();
+
+		Body();
+
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+		const uint64 Allocations = Counter->EndCounting();
+		GMalloc = Previous;
+
+		AddResult(Name, Ops, ElapsedSeconds, Ops > 0 ? static_cast<double>(Allocations) / Ops : 0.0);
+	}
+
+	/** Writes the collected results as CSV, or as JSON when the path ends in .json */
+	static bool WriteResults(const FString& Path)
+	{
+		FString Output;
+		const bool bJson = Path.EndsWith(TEXT(".json"), ESearchCase::IgnoreCase);
+		if (bJson)
+		{
+			Output = TEXT("[\n");
+			for (int32 i = 0; i < Results.Num(); ++i)
+			{
+				const FBenchResult& Result = Results[i];
+				Output += FString::Printf(TEXT("  { \"name\": \"%s\", \"ops\": %lld, \"ns_per_op\": %.3f, \"allocs_per_op\": %.4f }%s\n"),
+					*Result.Name, Result.Ops, Result.NsPerOp, Result.AllocsPerOp, i + 1 < Results.Num() ? TEXT(",") : TEXT(""));
+			}
+			Output += TEXT("]\n");
+		}
+		else
+		{
+			Output = TEXT("Name,Ops,NsPerOp,AllocsPerOp\n");
+			for (const FBenchResult& Result : Results)
+			{
+				Output += FString::Printf(TEXT("%s,%lld,%.3f,%.4f\n"), *Result.Name, Result.Ops, Result.NsPerOp, Result.AllocsPerOp);
+			}
+		}
+
+		if (!FFileHelper::SaveStringToFile(Output, *Path))
+		{
+			UE_LOG(LogBeam, Error, TEXT("Failed to write benchmark results to %s"), *Path);
+			return false;
+		}
+		UE_LOG(LogBeam, Log, TEXT("Benchmark results written to %s"), *Path);
+		return true;
+	}
+
+	/** Builds a tracker-shaped SDK user state; the rotation is a small yaw */
+	static EW_BET_UserState MakeUserState(int64 Index)
+	{
+		EW_BET_UserState UserState = {};
+		UserState.timestamp_in_seconds = 1.0 + Index * 0.004;
+		UserState.unified_screen_gaze.point_of_regard.x = static_cast<int32>(FMath::Frac(Index * 0.013) * 1920.0);
+		UserState.unified_screen_gaze.point_of_regard.y = static_cast<int32>(FMath::Frac(Index * 0.007) * 1080.0);
+		UserState.unified_screen_gaze.confidence = EW_BET_HIGH;
+		UserState.viewport_gaze.normalized_point_of_regard.x = UserState.unified_screen_gaze.point_of_regard.x / 1920.0f;
+		UserState.viewport_gaze.normalized_point_of_regard.y = UserState.unified_screen_gaze.point_of_regard.y / 1080.0f;
+		UserState.viewport_gaze.confidence = EW_BET_HIGH;
+		UserState.head_pose.confidence = EW_BET_HIGH;
+
+		const float Yaw = 0.1f;
+		UserState.head_pose.rotation_from_hcs_to_wcs[0][0] = FMath::Cos(Yaw);
+		UserState.head_pose.rotation_from_hcs_to_wcs[0][1] = -FMath::Sin(Yaw);
+		UserState.head_pose.rotation_from_hcs_to_wcs[1][0] = FMath::Sin(Yaw);
+		UserState.head_pose.rotation_from_hcs_to_wcs[1][1] = FMath::Cos(Yaw);
+		UserState.head_pose.rotation_from_hcs_to_wcs[2][2] = 1.0f;
+		UserState.head_pose.translation_from_hcs_to_wcs.z = 0.6f;
+		UserState.head_pose.track_session_uid = 1;
+		return UserState;
+	}
+
+	/** Produces a realistic gaze trace for the analytics benchmark */
+	static void MakeGazeTrace(int32 NumSamples, TArray<FBeamFrame>& OutFrames)
+	{
+		OutFrames.Reset(NumSamples);
+#if BEAM_FEATURE_SYNTHETIC_DATA
+		FBeamSyntheticParams Params;
+		Params.RateHz = 120.0f;
+		Params.bRealtime = false;
+		FBeamSyntheticDataSource Source(Params);
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			Source.GenerateFrame(OutFrames.AddDefaulted_GetRef());
+		}
+#else
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			OutFrames.Add(MakeSyntheticFrame(i));
+		}
+#endif
+	}
+}
+
+// Ring Benchmarks
+
+/**
+ * @brief Compares pulling a 1024-frame window via per-frame GetFrameAt against one TakeSnapshot flip
+ *
+ * Expected Outcome: the snapshot path is at least an order of magnitude cheaper per window
+ */
+void BenchBeamRingSnapshot()
+{
+	using namespace BeamBenchmarks;
+
+	UE_LOG(LogBeam, Log, TEXT("=== Beam.Bench.RingSnapshot (%d-frame windows, %d iterations) ==="), WindowSize, Iterations);
+
+	FBeamFrameRing Ring(false, true);
+	TArray<FBeamFrame> Window;
+	Window.Reserve(WindowSize);
+	int64 NextIndex = 0;
+
+	double PerFrameSeconds = 0.0;
+	double SnapshotSeconds = 0.0;
+
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		FillWindow(Ring, NextIndex);
+		const double FirstTimestampMs = (NextIndex - WindowSize) * 4.0;
+
+		// Per-frame path: one timestamp lookup and copy per sample
+		Window.Reset();
+		const double PerFrameStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < WindowSize; ++i)
+		{
+			FBeamFrame Frame;
+			if (Ring.GetFrameAt(FirstTimestampMs + i * 4.0, Frame))
+			{
+				Window.Add(Frame);
+			}
+		}
+		PerFrameSeconds += FPlatformTime::Seconds() - PerFrameStart;
+
+		// Snapshot path: one pointer flip and two contiguous copies
+		const double SnapshotStart = FPlatformTime::Seconds();
+		const int32 Captured = Ring.TakeSnapshot(Window);
+		SnapshotSeconds += FPlatformTime::Seconds() - SnapshotStart;
+
+		if (Captured != WindowSize)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Snapshot returned %d frames, expected %d"), Captured, WindowSize);
+		}
+	}
+
+	const double PerFrameUs = PerFrameSeconds * 1e6 / Iterations;
+	const double SnapshotUs = SnapshotSeconds * 1e6 / Iterations;
+
+	UE_LOG(LogBeam, Log, TEXT("GetFrameAt x%d: %.2f us/window"), WindowSize, PerFrameUs);
+	UE_LOG(LogBeam, Log, TEXT("TakeSnapshot:    %.2f us/window"), SnapshotUs);
+	UE_LOG(LogBeam, Log, TEXT("Speedup:         %.1fx"), SnapshotUs > 0.0 ? PerFrameUs / SnapshotUs : 0.0);
+	UE_LOG(LogBeam, Log, TEXT("=== Beam.Bench.RingSnapshot Complete ==="));
+}
+
+// Suite Benchmarks
+
+/**
+ * @brief Single-threaded and contended publish/read throughput
+ *
+ * Expected Outcome: zero allocations per op; contended publish stays within a small factor of uncontended
+ */
+void BenchBeamRingThroughput()
+{
+	using namespace BeamBenchmarks;
+
+	static constexpr int64 NumOps = 1 << 18;
+	static constexpr int32 NumReaders = 3;
+
+	FBeamFrameRing Ring;
+	int64 NextIndex = 0;
+
+	Measure(TEXT("Ring.Publish"), NumOps, [&Ring, &NextIndex]()
+	{
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			Ring.Publish(MakeSyntheticFrame(NextIndex++));
+		}
+	});
+
+	Measure(TEXT("Ring.ReadLatest"), NumOps, [&Ring]()
+	{
+		FBeamFrame Frame;
+		double Sum = 0.0;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			Ring.ReadLatest(Frame);
+			Sum += Frame.SDKTimestampMs;
+		}
+		Sink = Sum;
+	});
+
+	Measure(TEXT("Ring.GetPerformanceStats"), NumOps, [&Ring]()
+	{
+		int32 FrameCount = 0;
+		double Average = 0.0;
+		double Peak = 0.0;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			Ring.GetPerformanceStats(FrameCount, Average, Peak);
+		}
+		Sink = Average + Peak + FrameCount;
+	});
+
+	// Contended: readers spin on ReadLatest on their own threads while this thread publishes
+	std::atomic<bool> bStop(false);
+	std::atomic<int64> TotalReads(0);
+	TArray<TFuture<void>> Readers;
+	for (int32 ReaderIndex = 0; ReaderIndex < NumReaders; ++ReaderIndex)
+	{
+		Readers.Add(Async(EAsyncExecution::Thread, [&Ring, &bStop, &TotalReads]()
+		{
+			FBeamFrame Frame;
+			int64 Reads = 0;
+			double Sum = 0.0;
+			while (!bStop.load(std::memory_order_relaxed))
+			{
+				Ring.ReadLatest(Frame);
+				Sum += Frame.SDKTimestampMs;
+				++Reads;
+			}
+			Sink = Sum;
+			TotalReads.fetch_add(Reads, std::memory_order_relaxed);
+		}));
+	}
+
+	// Let the readers spin up before timing the producer
+	FPlatformProcess::Sleep(0.01f);
+	const int64 ReadsBefore = TotalReads.load();
+	const double ContendedStart = FPlatformTime::Seconds();
+
+	Measure(TEXT("Ring.Publish.Contended"), NumOps, [&Ring, &NextIndex]()
+	{
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			Ring.Publish(MakeSyntheticFrame(NextIndex++));
+		}
+	});
+
+	bStop.store(true);
+	for (TFuture<void>& Reader : Readers)
+	{
+		Reader.Wait();
+	}
+	const double ContendedSeconds = FPlatformTime::Seconds() - ContendedStart;
+
+	// Per-read cost as seen by one reader thread; allocations are only counted on the producer
+	const int64 Reads = TotalReads.load() - ReadsBefore;
+	AddResult(TEXT("Ring.ReadLatest.Contended"), Reads, ContendedSeconds * NumReaders, -1.0);
+}
+
+/**
+ * @brief Timestamp lookups at several fill levels, plus the component ring
+ *
+ * Expected Outcome: lookup cost grows at most logarithmically with fill level
+ */
+void BenchBeamRingLookup()
+{
+	using namespace BeamBenchmarks;
+
+	static constexpr int64 NumOps = 1 << 16;
+	static constexpr int32 FillLevels[] = { 64, 256, 1024 };
+
+	for (const int32 FillLevel : FillLevels)
+	{
+		FBeamFrameRing Ring;
+		for (int32 i = 0; i < FillLevel; ++i)
+		{
+			Ring.Publish(MakeSyntheticFrame(i));
+		}
+
+		const FString Name = FString::Printf(TEXT("Ring.GetFrameAt.%d"), FillLevel);
+		Measure(*Name, NumOps, [&Ring, FillLevel]()
+		{
+			FBeamFrame Frame;
+			double Sum = 0.0;
+			for (int64 i = 0; i < NumOps; ++i)
+			{
+				// Stride through the stored span, landing between samples to exercise interpolation
+				const double TimestampMs = ((i * 37) % FillLevel) * 4.0 + 1.5;
+				if (Ring.GetFrameAt(TimestampMs, Frame))
+				{
+					Sum += Frame.Gaze.Screen01.X;
+				}
+			}
+			Sink = Sum;
+		});
+	}
+
+	FBeamComponentFrameRing ComponentRing;
+	for (int32 i = 0; i < FBeamComponentFrameRing::BufferSize; ++i)
+	{
+		ComponentRing.Publish(FBeamFrameCompact::FromFrame(MakeSyntheticFrame(i)));
+	}
+	Measure(TEXT("ComponentRing.GetFrameAt.64"), NumOps, [&ComponentRing]()
+	{
+		FBeamFrameCompact Frame;
+		double Sum = 0.0;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			if (ComponentRing.GetFrameAt(((i * 37) % FBeamComponentFrameRing::BufferSize) * 4.0, Frame))
+			{
+				Sum += Frame.GetGazeX01();
+			}
+		}
+		Sink = Sum;
+	});
+}
+
+/**
+ * @brief Per-sample cost of the gaze smoothing filters
+ *
+ * Expected Outcome: tens of nanoseconds per sample and no allocations
+ */
+void BenchBeamFilters()
+{
+	using namespace BeamBenchmarks;
+
+	static constexpr int64 NumOps = 1 << 20;
+
+	Measure(TEXT("Filter.OneEuro"), NumOps, []()
+	{
+		FOneEuroFilter Filter;
+		FVector2D Output = FVector2D::ZeroVector;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			Output += Filter.Filter(MakeSyntheticFrame(i).Gaze.Screen01, 1.0 / 120.0);
+		}
+		Sink = Output.X + Output.Y;
+	});
+
+	Measure(TEXT("Filter.Ema"), NumOps, []()
+	{
+		FEmaFilter Filter;
+		FVector2D Output = FVector2D::ZeroVector;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			Output += Filter.Filter(MakeSyntheticFrame(i).Gaze.Screen01);
+		}
+		Sink = Output.X + Output.Y;
+	});
+
+	// Gaze, head position and head rotation together; should land close to Filter.OneEuro
+	Measure(TEXT("Filter.BankFullFrame"), NumOps, []()
+	{
+		FBeamFilterBank Bank;
+		double Output = 0.0;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			FBeamFrame Frame = MakeSyntheticFrame(i);
+			Frame.Head.SetRotation(FRotator(i * 0.01, i * 0.02, 0.0));
+			Bank.Filter(Frame, 1.0 / 120.0);
+			Output += Frame.Gaze.Screen01.X + Frame.Head.Rotation.Yaw;
+		}
+		Sink = Output;
+	});
+
+	// Eight 2x2 updates per frame, smoothed state and velocity in one pass
+	Measure(TEXT("Filter.KalmanFullFrame"), NumOps, []()
+	{
+		FBeamKalmanFilter Kalman;
+		double Output = 0.0;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			FBeamFrame Frame = MakeSyntheticFrame(i);
+			Frame.Head.SetRotation(FRotator(i * 0.01, i * 0.02, 0.0));
+			Kalman.Filter(Frame, 1.0 / 120.0);
+			Output += Frame.Gaze.Screen01.X + Frame.GazeVelocity01.X + Frame.Head.Rotation.Yaw;
+		}
+		Sink = Output;
+	});
+}
+
+/**
+ * @brief SDK user state to FBeamFrame conversion, the per-frame cost of the live path,
+ *        and FBeamFrame to FBeamFrameCompact quantization in both directions
+ *
+ * Expected Outcome: well under a microsecond per frame and no allocations; the direct
+ * matrix-to-quaternion path beats the FMatrix-to-FRotator path it replaced; packing a
+ * window costs less than copying it as full frames
+ */
+void BenchBeamConversion()
+{
+	using namespace BeamBenchmarks;
+
+	static constexpr int64 NumOps = 1 << 18;
+	static constexpr int32 NumStates = 256;
+
+	TArray<EW_BET_UserState> States;
+	States.Reserve(NumStates);
+	for (int32 i = 0; i < NumStates; ++i)
+	{
+		States.Add(MakeUserState(i));
+	}
+
+	Measure(TEXT("SDK.ConvertUserStateToFrame"), NumOps, [&States]()
+	{
+		FBeamFrame Frame;
+		double Sum = 0.0;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			if (FBeamSDK_Wrapper::ConvertUserStateToFrame(States[i % NumStates], Frame))
+			{
+				Sum += Frame.Head.Rotation.Yaw;
+			}
+		}
+		Sink = Sum;
+	});
+
+	// Previous head rotation path: fill an FMatrix element by element and go through FMatrix::Rotator
+	Measure(TEXT("SDK.HeadRotation.FMatrix"), NumOps, [&States]()
+	{
+		double Sum = 0.0;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			const EW_BET_Matrix3x3& Source = States[i % NumStates].head_pose.rotation_from_hcs_to_wcs;
+			FMatrix RotationMatrix = FMatrix::Identity;
+			for (int32 Row = 0; Row < 3; ++Row)
+			{
+				for (int32 Column = 0; Column < 3; ++Column)
+				{
+					RotationMatrix.M[Row][Column] = Source[Row][Column];
+				}
+			}
+			const FRotator Rotation = RotationMatrix.Rotator();
+			const FQuat Quat = Rotation.Quaternion();
+			Sum += Rotation.Yaw + Quat.W;
+		}
+		Sink = Sum;
+	});
+
+	// Current path: quaternion straight from the SDK matrix, rotator derived once
+	Measure(TEXT("SDK.HeadRotation.Quat"), NumOps, [&States]()
+	{
+		double Sum = 0.0;
+		FHeadPose Head;
+		for (int64 i = 0; i < NumOps; ++i)
+		{
+			Head.SetRotation(FBeamSDK_Wrapper::RotationMatrixToQuat(States[i % NumStates].head_pose.rotation_from_hcs_to_wcs));
+			Sum += Head.Rotation.Yaw + Head.RotationQuat.W;
+		}
+		Sink = Sum;
+	});
+
+	// Window conversions are timed per frame; all buffers are sized before measuring
+	TArray<FBeamFrame> Frames;
+	Frames.SetNum(WindowSize);
+	for (int32 i = 0; i < WindowSize; ++i)
+	{
+		Frames[i] = MakeSyntheticFrame(i);
+	}
+	TArray<FBeamFrame> FrameCopies;
+	FrameCopies.SetNum(WindowSize);
+	TArray<FBeamFrameCompact> CompactFrames;
+	CompactFrames.SetNum(WindowSize);
+
+	static constexpr int64 NumWindows = NumOps / WindowSize;
+	Measure(TEXT("Frame.CopyWindow"), NumWindows * WindowSize, [&Frames, &FrameCopies]()
+	{
+		for (int64 i = 0; i < NumWindows; ++i)
+		{
+			for (int32 Index = 0; Index < Frames.Num(); ++Index)
+			{
+				FrameCopies[Index] = Frames[Index];
+			}
+		}
+		Sink = FrameCopies[0].Gaze.Screen01.X;
+	});
+
+	Measure(TEXT("Frame.PackCompact"), NumWindows * WindowSize, [&Frames, &CompactFrames]()
+	{
+		for (int64 i = 0; i < NumWindows; ++i)
+		{
+			BeamFrameCompact::PackFrames(Frames, CompactFrames);
+		}
+		Sink = CompactFrames[0].GazeX;
+	});
+
+	Measure(TEXT("Frame.UnpackCompact"), NumWindows * WindowSize, [&CompactFrames, &FrameCopies]()
+	{
+		for (int64 i = 0; i < NumWindows; ++i)
+		{
+			BeamFrameCompact::UnpackFrames(CompactFrames, FrameCopies);
+		}
+		Sink = FrameCopies[0].Gaze.Screen01.X;
+	});
+}
+
+/**
+ * @brief Sample ingestion and full recomputation over a 10 s, 120 Hz window
+ *
+ * Expected Outcome: AddSample amortizes to zero allocations; Analyze is linear in the window
+ */
+void BenchBeamAnalytics()
+{
+	using namespace BeamBenchmarks;
+
+	static constexpr int32 WindowSamples = 1200;
+	static constexpr int64 NumAnalyze = 256;
+
+	TArray<FBeamFrame> Trace;
+	MakeGazeTrace(WindowSamples * 4, Trace);
+
+	FBeamGazeAnalyzer Analyzer(0.1f, 10.0);
+	Measure(TEXT("Analytics.AddSample"), Trace.Num(), [&Analyzer, &Trace]()
+	{
+		Analyzer.Reset();
+		for (int32 i = 0; i < Trace.Num(); ++i)
+		{
+			// Timestamps keep advancing across the trace so the window slides
+			Analyzer.AddSample(Trace[i].Gaze.Screen01, i / 120.0);
+		}
+	});
+
+	Measure(TEXT("Analytics.Analyze.1200"), NumAnalyze, [&Analyzer]()
+	{
+		FGazeAnalytics Analytics;
+		for (int64 i = 0; i < NumAnalyze; ++i)
+		{
+			Analyzer.Analyze(Analytics);
+		}
+		Sink = Analytics.ScanPathLength;
+	});
+}
+
+/** Runs the whole suite; an optional argument names a .csv or .json file for the results */
+void BenchBeamAll(const TArray<FString>& Args)
+{
+	using namespace BeamBenchmarks;
+
+	UE_LOG(LogBeam, Log, TEXT("=== Beam.Bench.All ==="));
+	ResetResults();
+
+	BenchBeamRingThroughput();
+	BenchBeamRingLookup();
+	BenchBeamFilters();
+	BenchBeamConversion();
+	BenchBeamAnalytics();
+
+	if (Args.Num() > 0)
+	{
+		FString Path = Args[0];
+		if (FPaths::IsRelative(Path))
+		{
+			Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), Path);
+		}
+		WriteResults(Path);
+	}
+
+	UE_LOG(LogBeam, Log, TEXT("=== Beam.Bench.All Complete (%d results) ==="), Results.Num());
+}
+
+// Benchmark Command Registration
+
+// Usage: Type "Beam.Bench.RingSnapshot" in console
+static FAutoConsoleCommand BenchBeamRingSnapshotCommand(
+	TEXT("Beam.Bench.RingSnapshot"),
+	TEXT("Benchmark FBeamFrameRing snapshot flips against per-frame GetFrameAt copies"),
+	FConsoleCommandDelegate::CreateStatic(&BenchBeamRingSnapshot)
+);
+
+// Usage: "Beam.Bench.All [Results.csv|Results.json]"; relative paths land in Saved/Profiling
+static FAutoConsoleCommand BenchBeamAllCommand(
+	TEXT("Beam.Bench.All"),
+	TEXT("Run the full Beam benchmark suite and report ns/op and allocs/op, optionally writing CSV or JSON"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchBeamAll)
+);
+
+static FAutoConsoleCommand BenchBeamRingThroughputCommand(
+	TEXT("Beam.Bench.Ring"),
+	TEXT("Benchmark FBeamFrameRing publish/read throughput, with and without reader contention, and timestamp lookups"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		BeamBenchmarks::ResetResults();
+		BenchBeamRingThroughput();
+		BenchBeamRingLookup();
+	})
+);
+
+static FAutoConsoleCommand BenchBeamFiltersCommand(
+	TEXT("Beam.Bench.Filters"),
+	TEXT("Benchmark per-sample cost of FOneEuroFilter, FEmaFilter and the full-frame FBeamFilterBank"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		BeamBenchmarks::ResetResults();
+		BenchBeamFilters();
+	})
+);
+
+static FAutoConsoleCommand BenchBeamConversionCommand(
+	TEXT("Beam.Bench.Conversion"),
+	TEXT("Benchmark SDK user state to FBeamFrame conversion"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		BeamBenchmarks::ResetResults();
+		BenchBeamConversion();
+	})
+);
+
+static FAutoConsoleCommand BenchBeamAnalyticsCommand(
+	TEXT("Beam.Bench.Analytics"),
+	TEXT("Benchmark gaze analytics sample ingestion and recomputation"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		BeamBenchmarks::ResetResults();
+		BenchBeamAnalytics();
+	})
+);
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,77 @@
+// Implements the per-world subsystem cache shared by the Blueprint libraries
+
+#include "BeamBlueprintAccess.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+
+namespace BeamBlueprintAccess
+{
+	/** Enough for a listen server plus several PIE clients; the oldest pair is recycled beyond that */
+	static constexpr int32 MaxCachedWorlds = 8;
+
+	struct FCachedWorld
+	{
+		TWeakObjectPtr<const UWorld> World;
+		TWeakObjectPtr<UBeamEyeTrackerSubsystem> Subsystem;
+	};
+
+	static FCachedWorld GCachedWorlds[MaxCachedWorlds];
+	static int32 GNextCachedWorld = 0;
+
+	static UBeamEyeTrackerSubsystem* FindSubsystemUncached(const UWorld* World)
+	{
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	}
+
+	UBeamEyeTrackerSubsystem* FindSubsystem(const UObject* WorldContextObject)
+	{
+		if (!WorldContextObject)
+		{
+			return nullptr;
+		}
+
+		// Actors, components and widgets answer GetWorld() directly; GEngine only handles the rest and logs failures
+		const UWorld* World = WorldContextObject->GetWorld();
+		if (!World && GEngine)
+		{
+			World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+		}
+		if (!World)
+		{
+			return nullptr;
+		}
+
+		// The cache is not synchronized; other threads always take the full lookup
+		if (!IsInGameThread())
+		{
+			return FindSubsystemUncached(World);
+		}
+
+		for (FCachedWorld& Entry : GCachedWorlds)
+		{
+			// Entries for destroyed worlds resolve to nullptr, so a new world at a recycled address never matches one
+			if (Entry.World.Get() == World)
+			{
+				if (UBeamEyeTrackerSubsystem* Subsystem = Entry.Subsystem.Get())
+				{
+					return Subsystem;
+				}
+				Entry.Subsystem = FindSubsystemUncached(World);
+				return Entry.Subsystem.Get();
+			}
+		}
+
+		UBeamEyeTrackerSubsystem* Subsystem = FindSubsystemUncached(World);
+		if (Subsystem)
+		{
+			FCachedWorld& Slot = GCachedWorlds[GNextCachedWorld];
+			GNextCachedWorld = (GNextCachedWorld + 1) % MaxCachedWorlds;
+			Slot.World = World;
+			Slot.Subsystem = Subsystem;
+		}
+		return Subsystem;
+	}
+}
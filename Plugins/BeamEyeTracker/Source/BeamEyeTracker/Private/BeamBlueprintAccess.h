@@ -0,0 +1,31 @@
+/*=============================================================================
+    BeamBlueprintAccess.h: Cached subsystem lookup for Blueprint libraries.
+
+    Blueprint library nodes receive only a world context object, and
+    resolving it through GEngine, the world and the game instance's
+    subsystem map on every call adds up when a graph evaluates dozens of
+    pure nodes a frame. The game thread keeps a handful of weak
+    world-to-subsystem pairs instead, so a repeat lookup is one virtual
+    GetWorld() and a pointer compare.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBeamEyeTrackerSubsystem;
+class UObject;
+
+namespace BeamBlueprintAccess
+{
+	/** Subsystem of the context object's game instance, cached per world on the game thread; nullptr if there is none */
+	UBeamEyeTrackerSubsystem* FindSubsystem(const UObject* WorldContextObject);
+}
+
+/*=============================================================================
+    End of BeamBlueprintAccess.h
+=============================================================================*/
@@ -4,12 +4,18 @@
 
 #include "BeamBlueprintLibrary.h"
 #include "BeamEyeTrackerSubsystem.h"
+#include "BeamGazeTargetSubsystem.h"
+#include "BeamFocusSubsystem.h"
+#include "BeamGazeCursorSubsystem.h"
+#include "Blueprint/UserWidget.h"
+#include "Engine/GameInstance.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Camera/CameraComponent.h"
 #include "BeamLogging.h"
+#include "BeamBlueprintAccess.h"
 
 bool UBeamBlueprintLibrary::InitializeEyeTracking(const UObject* WorldContextObject)
 {
@@ -149,6 +155,14 @@ bool UBeamBlueprintLibrary::IsLookingAtActor(const UObject* WorldContextObject,
     {
         return false;
     }
+
+    // Registered targets are answered from the per-frame screen grid
+    UWorld* World = TargetActor->GetWorld();
+    UBeamGazeTargetSubsystem* GazeTargets = World ? World->GetSubsystem<UBeamGazeTargetSubsystem>() : nullptr;
+    if (GazeTargets && GazeTargets->IsGazeTargetRegistered(TargetActor))
+    {
+        return GazeTargets->IsGazeOnTarget(TargetActor);
+    }
     
     FVector GazeWorldPos = ScreenToWorldPosition(GetGazePoint2D(WorldContextObject));
     FVector ActorLocation = TargetActor->GetActorLocation();
@@ -157,7 +171,7 @@ bool UBeamBlueprintLibrary::IsLookingAtActor(const UObject* WorldContextObject,
     return Distance <= MaxDistance;
 }
 
-AActor* UBeamBlueprintLibrary::GetClosestActorToGaze(const UObject* WorldContextObject, TArray<AActor*> ActorList, float MaxDistance)
+AActor* UBeamBlueprintLibrary::GetClosestActorToGaze(const UObject* WorldContextObject, const TArray<AActor*>& ActorList, float MaxDistance)
 {
     if (ActorList.Num() == 0)
     {
@@ -183,8 +197,113 @@ AActor* UBeamBlueprintLibrary::GetClosestActorToGaze(const UObject* WorldContext
     
     return ClosestActor;
 }
+
+bool UBeamBlueprintLibrary::StartDwellDetection(const UObject* WorldContextObject, UObject* Target, float DwellTime)
+{
+    AActor* TargetActor = Cast<AActor>(Target);
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+    UBeamFocusSubsystem* Focus = World ? World->GetSubsystem<UBeamFocusSubsystem>() : nullptr;
+    if (!TargetActor || !Focus)
+    {
+        UE_LOG(LogBeam, Warning, TEXT("BeamBlueprintLibrary: Dwell detection needs an actor target in a game world"));
+        return false;
+    }
+
+    Focus->RegisterDwellTarget(TargetActor, DwellTime);
+    return true;
+}
+
+UWidget* UBeamBlueprintLibrary::GetWidgetUnderGaze(const UObject* WorldContextObject, FVector2D& OutLocalPos)
+{
+    OutLocalPos = FVector2D::ZeroVector;
+
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    const UBeamGazeCursorSubsystem* GazeCursor = GameInstance ? GameInstance->GetSubsystem<UBeamGazeCursorSubsystem>() : nullptr;
+    return GazeCursor ? GazeCursor->GetGazedWidget(OutLocalPos) : nullptr;
+}
+
+void UBeamBlueprintLibrary::GetRecentGazeSamples(const UObject* WorldContextObject, int32 Count, TArray<FBeamFrame>& OutSamples)
+{
+    OutSamples.Reset();
+
+    UBeamEyeTrackerSubsystem* Subsystem = GetSubsystemSafe(WorldContextObject);
+    if (!Subsystem || Count <= 0)
+    {
+        return;
+    }
+
+    Subsystem->CopyLatestFrames(Count, OutSamples);
+}
+
+FGazePoint UBeamBlueprintLibrary::PredictGaze(const UObject* WorldContextObject, const FGazePoint& InSample, int32 HorizonMs)
+{
+    UBeamEyeTrackerSubsystem* Subsystem = GetSubsystemSafe(WorldContextObject);
+    if (!Subsystem || HorizonMs <= 0)
+    {
+        return InSample;
+    }
+
+    return Subsystem->PredictGazePoint(InSample, static_cast<float>(HorizonMs));
+}
 //~ End Advanced Data Access
 
+//~ Begin Node Entry Points
+bool UBeamBlueprintLibrary::IsTrackingFresh(const UObject* WorldContextObject, float FreshnessSec)
+{
+    const UBeamEyeTrackerSubsystem* Subsystem = BeamBlueprintAccess::FindSubsystem(WorldContextObject);
+    if (!Subsystem || !Subsystem->IsBeamTracking() || Subsystem->IsTrackingStale())
+    {
+        return false;
+    }
+    if (FreshnessSec <= 0.0f)
+    {
+        return true;
+    }
+
+    const FBeamFrame* Frame = IsInGameThread() ? Subsystem->PeekCurrentFrame() : nullptr;
+    return Frame && FPlatformTime::Seconds() - Frame->PublishedSeconds <= FreshnessSec;
+}
+
+bool UBeamBlueprintLibrary::ProjectGazeRay(const UObject* WorldContextObject, const APlayerController* PlayerController, FVector& OutOrigin, FVector& OutDirection)
+{
+    OutOrigin = FVector::ZeroVector;
+    OutDirection = FVector::ForwardVector;
+
+    const UBeamEyeTrackerSubsystem* Subsystem = BeamBlueprintAccess::FindSubsystem(WorldContextObject);
+    if (!Subsystem)
+    {
+        return false;
+    }
+
+    if (!PlayerController)
+    {
+        const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+        PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+        if (!PlayerController)
+        {
+            return false;
+        }
+    }
+
+    return Subsystem->ProjectGazeToWorld(PlayerController, OutOrigin, OutDirection);
+}
+
+bool UBeamBlueprintLibrary::TraceFromGaze(const UObject* WorldContextObject, const APlayerController* PlayerController, float MaxDistance, ECollisionChannel Channel, FHitResult& OutHit)
+{
+    OutHit = FHitResult();
+
+    FVector Origin;
+    FVector Direction;
+    if (MaxDistance <= 0.0f || !ProjectGazeRay(WorldContextObject, PlayerController, Origin, Direction))
+    {
+        return false;
+    }
+
+    return UBeamGazeTraceSubsystem::GazeTrace(WorldContextObject, Origin, Origin + Direction * MaxDistance, Channel, OutHit);
+}
+//~ End Node Entry Points
+
 //~ Begin Control Functions
 bool UBeamBlueprintLibrary::StartEyeTracking(const UObject* WorldContextObject)
 {
@@ -295,18 +414,8 @@ UBeamEyeTrackerSubsystem* UBeamBlueprintLibrary::GetSubsystemSafe(const UObject*
         return nullptr;
     }
     
-    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
-    if (!World)
-    {
-        UE_LOG(LogBeam, Warning, TEXT("BeamBlueprintLibrary: Could not get World from context"));
-        return nullptr;
-    }
-    
-    if (UGameInstance* GameInstance = World->GetGameInstance())
-    {
-        return GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>();
-    }
-    return nullptr;
+    // Cached per world; a missing world is logged by the GEngine fallback inside the lookup
+    return BeamBlueprintAccess::FindSubsystem(WorldContextObject);
 }
 
 bool UBeamBlueprintLibrary::ValidateWorldContext(const UObject* WorldContextObject, FString& OutErrorMessage)
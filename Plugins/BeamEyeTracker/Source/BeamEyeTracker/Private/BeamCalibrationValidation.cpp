@@ -0,0 +1,187 @@
+// Implements streaming calibration validation over the frame ring
+
+#include "BeamCalibrationValidation.h"
+
+void FBeamCalibrationValidator::FRunningStats::Add(const FVector2D& Gaze)
+{
+	if (NumSamples > 0)
+	{
+		SumSquaredStep += FVector2D::DistSquared(Gaze, PreviousGaze);
+	}
+	PreviousGaze = Gaze;
+
+	++NumSamples;
+	const FVector2D Delta = Gaze - Mean;
+	Mean += Delta / NumSamples;
+	M2 += Delta | (Gaze - Mean);
+	SumSquaredError += FVector2D::DistSquared(Gaze, Target);
+}
+
+FBeamCalibrationValidator::FBeamCalibrationValidator(const FBeamCalibrationValidationParams& InParams)
+	: Params(InParams)
+{
+}
+
+void FBeamCalibrationValidator::Reset()
+{
+	Active = FRunningStats();
+	Completed.Reset();
+	bTargetActive = false;
+	ConsumedUntilMs = 0.0;
+	WindowStartMs = 0.0;
+}
+
+void FBeamCalibrationValidator::BeginTarget(const FBeamFrameRing& Ring, const FVector2D& Target)
+{
+	Active = FRunningStats();
+	Active.Target = Target;
+	bTargetActive = true;
+
+	// The window is anchored on the tracker clock; without a frame yet, the first one to arrive anchors it
+	FBeamFrame Latest;
+	if (Ring.ReadLatest(Latest))
+	{
+		ConsumedUntilMs = Latest.SDKTimestampMs;
+		WindowStartMs = ConsumedUntilMs + Params.SettleMs;
+	}
+	else
+	{
+		ConsumedUntilMs = 0.0;
+		WindowStartMs = -1.0;
+	}
+}
+
+void FBeamCalibrationValidator::Consume(const FBeamFrameRing& Ring)
+{
+	if (!bTargetActive)
+	{
+		return;
+	}
+
+	// Accumulate into a copy; a window lapped by the producer is discarded and retried next time
+	FRunningStats Pending = Active;
+	double PendingConsumedMs = ConsumedUntilMs;
+	double PendingWindowStartMs = WindowStartMs;
+	const bool bVisited = Ring.VisitFramesInRange(ConsumedUntilMs, MAX_dbl, [&](TArrayView<const FBeamFrame> Frames)
+	{
+		for (const FBeamFrame& Frame : Frames)
+		{
+			if (Frame.SDKTimestampMs <= PendingConsumedMs)
+			{
+				continue;
+			}
+			PendingConsumedMs = Frame.SDKTimestampMs;
+
+			if (PendingWindowStartMs < 0.0)
+			{
+				PendingWindowStartMs = Frame.SDKTimestampMs + Params.SettleMs;
+			}
+			if (Frame.SDKTimestampMs >= PendingWindowStartMs && Frame.Gaze.bValid && Frame.Gaze.Confidence >= Params.MinConfidence)
+			{
+				Pending.Add(Frame.Gaze.Screen01);
+			}
+		}
+	});
+
+	if (bVisited)
+	{
+		Active = Pending;
+		ConsumedUntilMs = PendingConsumedMs;
+		WindowStartMs = PendingWindowStartMs;
+	}
+}
+
+FBeamCalibrationTargetStats FBeamCalibrationValidator::EndTarget(const FBeamFrameRing& Ring)
+{
+	Consume(Ring);
+
+	const FBeamCalibrationTargetStats Stats = Finish(Active);
+	if (bTargetActive)
+	{
+		Completed.Add(Stats);
+	}
+	bTargetActive = false;
+	return Stats;
+}
+
+bool FBeamCalibrationValidator::IsTargetConverged() const
+{
+	if (!bTargetActive || Active.NumSamples < Params.MinSamples)
+	{
+		return false;
+	}
+
+	const double Variance = Active.M2 / Active.NumSamples;
+	return FMath::Sqrt(Variance / Active.NumSamples) < Params.MaxStandardError;
+}
+
+FBeamCalibrationTargetStats FBeamCalibrationValidator::Finish(const FRunningStats& Stats) const
+{
+	FBeamCalibrationTargetStats Result;
+	Result.Target = Stats.Target;
+	Result.NumSamples = Stats.NumSamples;
+	if (Stats.NumSamples == 0)
+	{
+		return Result;
+	}
+
+	Result.AccuracyRms = static_cast<float>(FMath::Sqrt(Stats.SumSquaredError / Stats.NumSamples));
+	Result.PrecisionStd = static_cast<float>(FMath::Sqrt(Stats.M2 / Stats.NumSamples));
+	Result.PrecisionRms = Stats.NumSamples > 1 ? static_cast<float>(FMath::Sqrt(Stats.SumSquaredStep / (Stats.NumSamples - 1))) : 0.0f;
+	Result.Bias = Stats.Mean - Stats.Target;
+	Result.Score = FMath::Clamp(1.0f - Result.AccuracyRms / FMath::Max(Params.ZeroScoreError, UE_KINDA_SMALL_NUMBER), 0.0f, 1.0f);
+	return Result;
+}
+
+FCalibrationQuality FBeamCalibrationValidator::MakeQuality(float TimeSeconds) const
+{
+	FCalibrationQuality Quality;
+	Quality.LastCalibrationTime = TimeSeconds;
+
+	double SumSquaredError = 0.0;
+	double SumStd = 0.0;
+	double SumRms = 0.0;
+	FVector2D SumBias = FVector2D::ZeroVector;
+	int32 NumMeasured = 0;
+
+	for (const FBeamCalibrationTargetStats& Target : Completed)
+	{
+		Quality.CalibrationPoints.Add(Target.Target);
+		Quality.PointScores.Add(Target.Score * 100.0f);
+		if (Target.NumSamples == 0)
+		{
+			continue;
+		}
+
+		// Pooled over samples for accuracy; precision and bias are per-target properties, so they are averaged
+		SumSquaredError += FMath::Square(static_cast<double>(Target.AccuracyRms)) * Target.NumSamples;
+		SumStd += Target.PrecisionStd;
+		SumRms += Target.PrecisionRms;
+		SumBias += Target.Bias;
+		Quality.NumSamples += Target.NumSamples;
+		++NumMeasured;
+	}
+
+	if (NumMeasured == 0)
+	{
+		return Quality;
+	}
+
+	Quality.bValidated = true;
+
+	Quality.AccuracyRms = static_cast<float>(FMath::Sqrt(SumSquaredError / Quality.NumSamples));
+	Quality.PrecisionStd = static_cast<float>(SumStd / NumMeasured);
+	Quality.PrecisionRms = static_cast<float>(SumRms / NumMeasured);
+	Quality.Bias = SumBias / NumMeasured;
+
+	// Unmeasured targets count as zero, so a session with dropouts cannot score well
+	float ScoreSum = 0.0f;
+	for (const float PointScore : Quality.PointScores)
+	{
+		ScoreSum += PointScore;
+	}
+	Quality.OverallScore = ScoreSum / Quality.PointScores.Num();
+
+	// The tracker reports one combined gaze point, so the per-eye scores stay unset
+	return Quality;
+}
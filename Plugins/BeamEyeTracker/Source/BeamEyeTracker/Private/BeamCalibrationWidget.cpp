@@ -8,6 +8,9 @@
 #include "Components/CanvasPanel.h"
 #include "Engine/Engine.h"
 #include "Blueprint/WidgetTree.h"
+#include "BeamStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Calibration Widget Tick"), STAT_BeamCalibrationWidgetTick, STATGROUP_Beam);
 
 UBeamCalibrationWidget::UBeamCalibrationWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -68,13 +71,20 @@ void UBeamCalibrationWidget::NativeConstruct()
 
 void UBeamCalibrationWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_BeamCalibrationWidgetTick);
     Super::NativeTick(MyGeometry, InDeltaTime);
 
     if (bCalibrationActive && CurrentPointIndex >= 0)
     {
         float CurrentTime = GetWorld()->GetTimeSeconds();
+
+        // Every frame since the last tick counts, so a point can also close early once its estimate is stable
+        if (const FBeamFrameRing* Ring = BeamSubsystem ? BeamSubsystem->GetFrameRing() : nullptr)
+        {
+            Validator.Consume(*Ring);
+        }
         
-        if (CurrentTime - PointStartTime >= PointDuration)
+        if (CurrentTime - PointStartTime >= PointDuration || Validator.IsTargetConverged())
         {
             CompleteCurrentPoint();
         }
@@ -118,6 +128,7 @@ void UBeamCalibrationWidget::StartCalibration()
     SuccessfulPoints = 0;
     FailedPoints = 0;
     AverageQuality = 0.0f;
+    Validator.Reset();
 
     // Clear previous quality data
     for (int32 i = 0; i < PointQualities.Num(); ++i)
@@ -283,6 +294,10 @@ void UBeamCalibrationWidget::ActivateNextPoint()
 
     // Activate current point
     PointStartTime = GetWorld()->GetTimeSeconds();
+    if (const FBeamFrameRing* Ring = BeamSubsystem ? BeamSubsystem->GetFrameRing() : nullptr)
+    {
+        Validator.BeginTarget(*Ring, CalibrationPoints[CurrentPointIndex]);
+    }
 
     UpdateCalibrationDisplay();
     UpdateInstructions();
@@ -301,10 +316,20 @@ void UBeamCalibrationWidget::CompleteCurrentPoint()
         return;
     }
 
-    FGazePoint CurrentGaze = BeamSubsystem->CurrentGaze();
-    
-    // Calculate quality for this point
-    float Quality = CalculatePointQuality(CalibrationPoints[CurrentPointIndex], CurrentGaze.Screen01);
+    // Without a ring (no session yet) fall back to the single current sample
+    float Quality = 0.0f;
+    const FBeamFrameRing* Ring = BeamSubsystem ? BeamSubsystem->GetFrameRing() : nullptr;
+    if (Ring && Validator.IsTargetActive())
+    {
+        const FBeamCalibrationTargetStats Stats = Validator.EndTarget(*Ring);
+        Quality = Stats.Score;
+        UE_LOG(LogTemp, Verbose, TEXT("BeamCalibrationWidget: Point %d - %d samples, RMS %.4f, STD %.4f, bias (%.4f, %.4f)"),
+            CurrentPointIndex + 1, Stats.NumSamples, Stats.AccuracyRms, Stats.PrecisionStd, Stats.Bias.X, Stats.Bias.Y);
+    }
+    else if (BeamSubsystem)
+    {
+        Quality = CalculatePointQuality(CalibrationPoints[CurrentPointIndex], BeamSubsystem->CurrentGaze().Screen01);
+    }
     PointQualities[CurrentPointIndex] = Quality;
     
     // Determine if point was successful
@@ -346,6 +371,18 @@ void UBeamCalibrationWidget::CalculateOverallQuality()
     }
 
     LastCalibrationTime = GetWorld()->GetTimeSeconds();
+
+    // Both FCalibrationQuality consumers see the same measured session
+    if (Validator.GetCompletedTargets().Num() > 0)
+    {
+        CurrentCalibrationQuality = Validator.MakeQuality(FPlatformTime::Seconds());
+        AverageQuality = CurrentCalibrationQuality.OverallScore / 100.0f;
+        if (AnalyticsSubsystem)
+        {
+            AnalyticsSubsystem->SetCalibrationQuality(CurrentCalibrationQuality);
+        }
+        OnQualityAssessed(CurrentCalibrationQuality);
+    }
     
     UE_LOG(LogTemp, Log, TEXT("BeamCalibrationWidget: Overall quality calculated: %.2f (%.1f%% success rate)"), 
         AverageQuality, (float)SuccessfulPoints / CalibrationPoints.Num() * 100.0f);
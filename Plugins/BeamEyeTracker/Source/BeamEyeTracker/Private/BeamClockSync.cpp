@@ -0,0 +1,39 @@
+// Implements the lower-envelope tracker clock offset estimator
+
+#include "BeamClockSync.h"
+
+double FBeamClockSync::AddSample(double DeviceSeconds, double LocalSeconds)
+{
+	const double Sample = LocalSeconds - DeviceSeconds;
+	double Offset = OffsetSeconds.load(std::memory_order_relaxed);
+
+	if (!bHasEstimate.load(std::memory_order_relaxed) || FMath::Abs(Sample - Offset) > ResyncThresholdSeconds)
+	{
+		Offset = Sample;
+	}
+	else if (Sample < Offset)
+	{
+		// Delivery can only add delay, so the fastest arrival seen is the best bound
+		Offset = Sample;
+	}
+	else
+	{
+		const double Elapsed = FMath::Max(0.0, LocalSeconds - LastLocalSeconds.load(std::memory_order_relaxed));
+		Offset += (Sample - Offset) * FMath::Min(1.0, Elapsed / DriftTimeConstantSeconds);
+	}
+
+	OffsetSeconds.store(Offset, std::memory_order_relaxed);
+	LastLocalSeconds.store(LocalSeconds, std::memory_order_relaxed);
+	LastDeliverySeconds.store(Sample - Offset, std::memory_order_relaxed);
+	bHasEstimate.store(true, std::memory_order_release);
+
+	return DeviceSeconds + Offset;
+}
+
+void FBeamClockSync::Reset()
+{
+	OffsetSeconds.store(0.0, std::memory_order_relaxed);
+	LastLocalSeconds.store(0.0, std::memory_order_relaxed);
+	LastDeliverySeconds.store(0.0, std::memory_order_relaxed);
+	bHasEstimate.store(false, std::memory_order_release);
+}
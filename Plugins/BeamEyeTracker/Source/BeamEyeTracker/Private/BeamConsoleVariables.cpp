@@ -87,13 +87,12 @@ static FAutoConsoleCommand CmdBeamApplySettings(
 		float TraceDistance = CVarBeamTraceDistance.GetValueOnGameThread();
 		bool bAutoStart = CVarBeamAutoStart.GetValueOnGameThread();
 
-		UBeamEyeTrackerSettings TempSettings;
-		TempSettings.PollingHz = PollingHz;
-		TempSettings.bEnableSmoothing = bEnableSmoothing;
-		TempSettings.MinCutoff = MinCutoff;
-		TempSettings.Beta = Beta;
-		TempSettings.TraceDistance = TraceDistance;
-		TempSettings.bAutoStart = bAutoStart;
+		FBeamRuntimeSettings NewSettings;
+		NewSettings.PollingHz = PollingHz;
+		NewSettings.bEnableSmoothing = bEnableSmoothing;
+		NewSettings.OneEuro = FOneEuroFilterParams(MinCutoff, Beta, static_cast<float>(PollingHz));
+		NewSettings.TraceDistance = TraceDistance;
+		NewSettings.bAutoStart = bAutoStart;
 
 		// Apply to the subsystem if available
 		if (GEngine)
@@ -104,7 +103,12 @@ static FAutoConsoleCommand CmdBeamApplySettings(
 				{
 					if (UBeamEyeTrackerSubsystem* Subsystem = GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>())
 					{
-						Subsystem->ApplyRuntimeSettings(&TempSettings);
+						// Keep a filter type chosen at runtime; the console variables only toggle smoothing
+						if (const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Current = Subsystem->GetRuntimeSettings())
+						{
+							NewSettings.FilterType = Current->FilterType;
+						}
+						Subsystem->ApplyRuntimeSnapshot(NewSettings);
 						UE_LOG(LogBeam, Log, TEXT("Beam: Applied console variable settings to runtime"));
 						return;
 					}
@@ -294,6 +298,36 @@ static FAutoConsoleCommand CmdBeamSetViewport(
 	})
 );
 
+static FAutoConsoleCommand CmdBeamConsumers(
+	TEXT("Beam.Consumers"),
+	TEXT("Log lag and dropped frames of every frame ring consumer, and the pipeline drop totals"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		UWorld* World = GEngine ? GEngine->GetWorld() : nullptr;
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		UBeamEyeTrackerSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+		if (!Subsystem)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Beam: Subsystem not available"));
+			return;
+		}
+
+		TArray<FBeamRingConsumerStats> Stats;
+		Subsystem->GetFrameConsumerStats(Stats);
+		UE_LOG(LogBeam, Log, TEXT("=== Beam Frame Ring Consumers (%d) ==="), Stats.Num());
+		for (const FBeamRingConsumerStats& Consumer : Stats)
+		{
+			UE_LOG(LogBeam, Log, TEXT("  [%d] %s: lag %llu, dropped %llu, lapped %u%s"),
+				Consumer.ConsumerId, *Consumer.Name.ToString(), Consumer.LagFrames, Consumer.DroppedFrames, Consumer.LapCount,
+				Consumer.bSlow ? TEXT(" (slow)") : TEXT(""));
+		}
+
+		const FBeamDropCounts Counts = Subsystem->GetDropCounts();
+		UE_LOG(LogBeam, Log, TEXT("  Source dropped %lld, decimated %lld | ring overwritten %lld | consumers dropped %lld"),
+			Counts.SourceDropped, Counts.SourceDecimated, Counts.RingOverwritten, Counts.ConsumerDropped);
+	})
+);
+
 // Function to sync console variables with project settings on startup
 void FBeamConsoleVariables::SyncWithProjectSettings()
 {
@@ -12,6 +12,13 @@ TAutoConsoleVariable<bool> FBeamDebugCVars::CVarDebugHUD(
 	ECVF_Default
 );
 
+TAutoConsoleVariable<bool> FBeamDebugCVars::CVarDebugOverlay(
+	TEXT("beam.debug.overlay"),
+	false,
+	TEXT("Enable/disable the batched Beam debug overlay (status panel, gaze crosshair and trail)"),
+	ECVF_Default
+);
+
 // Individual drawing toggles
 TAutoConsoleVariable<bool> FBeamDebugCVars::CVarDrawText(
 	TEXT("beam.debug.text"),
@@ -115,6 +122,11 @@ bool FBeamDebugCVars::IsDebugHUDEnabled()
 	return CVarDebugHUD.GetValueOnGameThread() != 0;
 }
 
+bool FBeamDebugCVars::IsDebugOverlayEnabled()
+{
+	return IsDebugHUDEnabled() && CVarDebugOverlay.GetValueOnGameThread() != 0;
+}
+
 bool FBeamDebugCVars::IsDrawGazeEnabled()
 {
 	return CVarDrawGaze.GetValueOnGameThread() != 0;
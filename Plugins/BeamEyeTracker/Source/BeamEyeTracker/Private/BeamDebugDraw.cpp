@@ -8,10 +8,44 @@
 #include "BeamEyeTrackerSubsystem.h"
 #include "BeamEyeTrackerComponent.h"
 #include "BeamDebugCVars.h"
+#include "BeamGazeTrail.h"
 
 #if BEAM_FEATURE_DEBUG_OVERLAY
 
 // Debug Drawing Implementation
 
+void FBeamDebugDraw::DrawTrail(FCanvas* Canvas, const TArray<FVector2D>& TrailPoints,
+    const FLinearColor& Color, float Thickness, int32 MaxPoints)
+{
+    // Debug drawing runs on the game thread only, so one scratch list serves every call
+    static TArray<FCanvasUVTri> Triangles;
+
+    const int32 NumPoints = FMath::Min(TrailPoints.Num(), FMath::Max(MaxPoints, 2));
+    const int32 First = TrailPoints.Num() - NumPoints;
+    FBeamGazeTrail::DrawPolyline(Canvas, [&TrailPoints, First](int32 Index) { return TrailPoints[First + Index]; },
+        NumPoints, Color, Thickness, Triangles);
+}
+
+FLinearColor FBeamDebugDraw::GetHealthColor(EBeamHealth Health)
+{
+    switch (Health)
+    {
+    case EBeamHealth::Ok:
+        return FLinearColor::Green;
+    case EBeamHealth::Warning:
+    case EBeamHealth::NoData:
+        return FLinearColor::Yellow;
+    case EBeamHealth::Recovering:
+        return FLinearColor(1.0f, 0.5f, 0.0f, 1.0f);
+    default:
+        return FLinearColor::Red;
+    }
+}
+
+FString FBeamDebugDraw::GetHealthText(EBeamHealth Health)
+{
+    return StaticEnum<EBeamHealth>()->GetDisplayNameTextByValue(static_cast<int64>(Health)).ToString();
+}
+
 #endif // BEAM_FEATURE_DEBUG_OVERLAY
 
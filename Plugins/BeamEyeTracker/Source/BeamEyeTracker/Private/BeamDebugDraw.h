@@ -13,6 +13,7 @@
 
 #include "CoreMinimal.h"
 #include "BeamEyeTrackerTypes.h"
+#include "BeamFeatures.h"
 
 #if BEAM_FEATURE_DEBUG_OVERLAY
 
@@ -32,7 +33,7 @@ public:
         EBeamHealth Health, float FPS, int32 PollHz, const FString& Profile, 
         const FString& Source, const FString& SDKVersion, bool bAppRunning);
     
-    /** Draw a gaze trail showing recent gaze point history */
+    /** Draw a gaze trail showing recent gaze point history, newest last, as one triangle batch (see FBeamGazeTrail) */
     static void DrawTrail(FCanvas* Canvas, const TArray<FVector2D>& TrailPoints,
         const FLinearColor& Color, float Thickness = 1.0f, int32 MaxPoints = 256);
     
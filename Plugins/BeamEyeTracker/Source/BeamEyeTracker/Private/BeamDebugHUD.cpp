@@ -12,6 +12,9 @@
 #include "Components/CheckBox.h"
 #include "Blueprint/UserWidget.h"
 #include "BeamLogging.h"
+#include "BeamStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Debug HUD Tick"), STAT_BeamDebugHUDTick, STATGROUP_Beam);
 
 UBeamDebugHUD::UBeamDebugHUD(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -51,6 +54,7 @@ void UBeamDebugHUD::NativeDestruct()
 
 void UBeamDebugHUD::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_BeamDebugHUDTick);
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
 	if (GEngine && GEngine->IsEditor())
@@ -161,6 +165,16 @@ FText UBeamDebugHUD::GetBufferUtilizationText() const
 	return FText::FromString(TEXT("Buffer: Unknown"));
 }
 
+FText UBeamDebugHUD::GetDroppedFramesText() const
+{
+	if (BeamSubsystem)
+	{
+		const FBeamDropCounts Counts = BeamSubsystem->GetDropCounts();
+		return FText::FromString(FString::Printf(TEXT("Dropped: %lld source, %lld consumer"), Counts.SourceDropped, Counts.ConsumerDropped));
+	}
+	return FText::FromString(TEXT("Dropped: Unknown"));
+}
+
 FText UBeamDebugHUD::GetGazePositionText() const
 {
 	if (BeamSubsystem)
@@ -1,6 +1,8 @@
 ﻿#include "BeamDebugHUDWidget.h"
 #include "BeamEyeTrackerSubsystem.h"
 #include "BeamEyeTrackerComponent.h"
+#include "BeamHeatmapSubsystem.h"
+#include "Engine/TextureRenderTarget2D.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "Components/TextBlock.h"
@@ -10,6 +12,10 @@
 #include "Components/Overlay.h"
 #include "Components/OverlaySlot.h"
 #include "TimerManager.h"
+#include "BeamStats.h"
+#include "BeamWidgetUpdates.h"
+
+DECLARE_CYCLE_STAT(TEXT("Debug HUD Widget Tick"), STAT_BeamDebugHUDWidgetTick, STATGROUP_Beam);
 
 UBeamDebugHUDWidget::UBeamDebugHUDWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -48,11 +54,33 @@ void UBeamDebugHUDWidget::NativeConstruct()
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().SetTimer(UpdateTimerHandle, FTimerDelegate::CreateUObject(this, &UBeamDebugHUDWidget::UpdateDebugDisplay), UpdateInterval, true);
+		if (bLowOverheadUpdates)
+		{
+			World->GetTimerManager().SetTimer(TextUpdateTimerHandle, FTimerDelegate::CreateUObject(this, &UBeamDebugHUDWidget::UpdateTextFields), TextUpdateInterval, true);
+		}
+	}
+}
+
+void UBeamDebugHUDWidget::NativeDestruct()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+		World->GetTimerManager().ClearTimer(TextUpdateTimerHandle);
 	}
+
+	Super::NativeDestruct();
+}
+
+TSharedRef<SWidget> UBeamDebugHUDWidget::RebuildWidget()
+{
+	TSharedRef<SWidget> Content = Super::RebuildWidget();
+	return bLowOverheadUpdates ? BeamWidgetUpdates::WrapInInvalidationPanel(Content) : Content;
 }
 
 void UBeamDebugHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_BeamDebugHUDWidgetTick);
 	Super::NativeTick(MyGeometry, InDeltaTime);
 }
 
@@ -60,17 +88,56 @@ void UBeamDebugHUDWidget::InitializeWidgetBindings()
 {
 	// Widget bindings are handled by the meta = (BindWidget) system
 	// No manual binding needed for basic functionality
+
+	if (const UCanvasPanelSlot* CanvasSlot = GazeCrosshair ? Cast<UCanvasPanelSlot>(GazeCrosshair->Slot) : nullptr)
+	{
+		CrosshairSlotOrigin = CanvasSlot->GetPosition();
+	}
 }
 
 void UBeamDebugHUDWidget::UpdateDebugDisplay()
 {
-	
+	// One fetch feeds every element of this update
+	UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UBeamEyeTrackerSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	bHasLatestFrame = Subsystem && Subsystem->FetchCurrentFrame(LatestFrame);
+
 	UpdateGazeCrosshair();
 	UpdateHeadPoseIndicator();
+	UpdateHeatmapImage();
+
+	if (!bLowOverheadUpdates)
+	{
+		UpdateTextFields();
+	}
+}
+
+void UBeamDebugHUDWidget::UpdateTextFields()
+{
 	UpdatePerformanceMetrics();
 	UpdateConnectionStatus();
 }
 
+void UBeamDebugHUDWidget::UpdateHeatmapImage()
+{
+	if (!HeatmapImage)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UBeamHeatmapSubsystem* Heatmap = GameInstance ? GameInstance->GetSubsystem<UBeamHeatmapSubsystem>() : nullptr;
+	UTextureRenderTarget2D* Texture = Heatmap ? Heatmap->GetHeatmapTexture() : nullptr;
+
+	// The texture updates on the GPU, so the brush only changes when the target is (re)created
+	if (Texture && HeatmapImage->GetBrush().GetResourceObject() != Texture)
+	{
+		HeatmapImage->SetBrushResourceObject(Texture);
+	}
+}
+
 void UBeamDebugHUDWidget::UpdateGazeCrosshair()
 {
 	if (!bShowGazeCrosshair || !GazeCrosshair)
@@ -78,33 +145,46 @@ void UBeamDebugHUDWidget::UpdateGazeCrosshair()
 		return;
 	}
 
-	if (UWorld* World = GetWorld())
+	if (!bHasLatestFrame)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
+		return;
+	}
+
+	const FBeamFrame& Frame = LatestFrame;
+	bGazeValid = Frame.Gaze.bValid;
+	if (bGazeValid)
+	{
+		CurrentGazeScreen01 = Frame.Gaze.Screen01;
+		CurrentGazeScreenPos = Frame.Gaze.ScreenPx;
+		CurrentGazeConfidence = Frame.Gaze.Confidence;
+	}
+
+	// Low-overhead mode keeps the slot and visibility fixed; moving the slot would invalidate the canvas layout
+	if (bLowOverheadUpdates)
+	{
+		BeamWidgetUpdates::SetShownByOpacity(GazeCrosshair, bGazeValid);
+		if (bGazeValid)
+		{
+			BeamWidgetUpdates::SetTranslationIfChanged(GazeCrosshair, CurrentGazeScreenPos - CrosshairSlotOrigin);
+		}
+		return;
+	}
+
+	if (bGazeValid)
+	{
+		if (UCanvasPanelSlot* CanvasSlot = Cast<UCanvasPanelSlot>(GazeCrosshair->Slot))
 		{
-			FBeamFrame Frame;
-			if (Subsystem->FetchCurrentFrame(Frame))
+			if (CanvasSlot->GetPosition() != CurrentGazeScreenPos)
 			{
-				bGazeValid = Frame.Gaze.bValid;
-				if (bGazeValid)
-				{
-					CurrentGazeScreen01 = Frame.Gaze.Screen01;
-					CurrentGazeScreenPos = Frame.Gaze.ScreenPx;
-					CurrentGazeConfidence = Frame.Gaze.Confidence;
-
-					if (UCanvasPanelSlot* CanvasSlot = Cast<UCanvasPanelSlot>(GazeCrosshair->Slot))
-					{
-						CanvasSlot->SetPosition(CurrentGazeScreenPos);
-						GazeCrosshair->SetVisibility(ESlateVisibility::Visible);
-					}
-				}
-				else
-				{
-					GazeCrosshair->SetVisibility(ESlateVisibility::Hidden);
-				}
+				CanvasSlot->SetPosition(CurrentGazeScreenPos);
 			}
+			BeamWidgetUpdates::SetVisibilityIfChanged(GazeCrosshair, ESlateVisibility::Visible);
 		}
 	}
+	else
+	{
+		BeamWidgetUpdates::SetVisibilityIfChanged(GazeCrosshair, ESlateVisibility::Hidden);
+	}
 }
 
 void UBeamDebugHUDWidget::UpdateHeadPoseIndicator()
@@ -114,28 +194,27 @@ void UBeamDebugHUDWidget::UpdateHeadPoseIndicator()
 		return;
 	}
 
-	if (UWorld* World = GetWorld())
+	if (!bHasLatestFrame)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			FBeamFrame Frame;
-			if (Subsystem->FetchCurrentFrame(Frame))
-			{
-				bHeadValid = Frame.Head.Confidence > 0.0f;
-				if (bHeadValid)
-				{
-					CurrentHeadPosition = Frame.Head.PositionCm;
-					CurrentHeadRotation = Frame.Head.Rotation;
-					CurrentHeadConfidence = Frame.Head.Confidence;
-
-					HeadPoseIndicator->SetVisibility(ESlateVisibility::Visible);
-				}
-				else
-				{
-					HeadPoseIndicator->SetVisibility(ESlateVisibility::Hidden);
-				}
-			}
-		}
+		return;
+	}
+
+	const FBeamFrame& Frame = LatestFrame;
+	bHeadValid = Frame.Head.Confidence > 0.0f;
+	if (bHeadValid)
+	{
+		CurrentHeadPosition = Frame.Head.PositionCm;
+		CurrentHeadRotation = Frame.Head.Rotation;
+		CurrentHeadConfidence = Frame.Head.Confidence;
+	}
+
+	if (bLowOverheadUpdates)
+	{
+		BeamWidgetUpdates::SetShownByOpacity(HeadPoseIndicator, bHeadValid);
+	}
+	else
+	{
+		BeamWidgetUpdates::SetVisibilityIfChanged(HeadPoseIndicator, bHeadValid ? ESlateVisibility::Visible : ESlateVisibility::Hidden);
 	}
 }
 
@@ -152,16 +231,21 @@ void UBeamDebugHUDWidget::UpdatePerformanceMetrics()
 		{
 			CurrentFPS = Subsystem->GetCurrentFPS();
 			CurrentBufferUtilization = Subsystem->GetBufferUtilization();
-			
+			CurrentLostFrames = Subsystem->GetDropCounts().GetTotalLost();
 		}
 	}
 
-	if (PerformanceText)
+	if (PerformanceText && (CurrentFPS != ShownFPS || CurrentBufferUtilization != ShownBufferUtilization || CurrentLostFrames != ShownLostFrames))
 	{
+		ShownFPS = CurrentFPS;
+		ShownBufferUtilization = CurrentBufferUtilization;
+		ShownLostFrames = CurrentLostFrames;
+
 		FText PerformanceInfo = FText::Format(
-			NSLOCTEXT("Beam", "PerformanceFormat", "FPS: {0} | Buffer: {1}%"),
+			NSLOCTEXT("Beam", "PerformanceFormat", "FPS: {0} | Buffer: {1}% | Dropped: {2}"),
 			FText::AsNumber(CurrentFPS),
-			FText::AsNumber(CurrentBufferUtilization)
+			FText::AsNumber(CurrentBufferUtilization),
+			FText::AsNumber(CurrentLostFrames)
 		);
 		PerformanceText->SetText(PerformanceInfo);
 	}
@@ -192,8 +276,12 @@ void UBeamDebugHUDWidget::UpdateConnectionStatus()
 		}
 	}
 
-	if (ConnectionText)
+	if (ConnectionText && (!bHasShownConnection || bIsConnected != bShownConnected || bIsTracking != bShownTracking))
 	{
+		bHasShownConnection = true;
+		bShownConnected = bIsConnected;
+		bShownTracking = bIsTracking;
+
 		FText ConnectionInfo = FText::Format(
 			NSLOCTEXT("Beam", "ConnectionFormat", "Status: {0} | Tracking: {1}"),
 			FText::FromString(ConnectionStatus),
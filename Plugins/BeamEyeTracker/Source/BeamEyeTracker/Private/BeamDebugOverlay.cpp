@@ -0,0 +1,272 @@
+// Implements the batched debug overlay drawn once per frame through UDebugDrawService
+
+#include "BeamDebugOverlay.h"
+#include "BeamDebugCVars.h"
+#include "BeamDebugDraw.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamFeatures.h"
+#include "BeamStats.h"
+#include "CanvasItem.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+#include "TextureResource.h"
+
+DECLARE_CYCLE_STAT(TEXT("Debug Overlay"), STAT_BeamDebugOverlay, STATGROUP_Beam);
+
+FBeamDebugOverlay GBeamDebugOverlay;
+
+namespace BeamDebugOverlay
+{
+	static constexpr float PanelWidth = 260.0f;
+	static constexpr float PanelPadding = 8.0f;
+	static constexpr float LineHeight = 16.0f;
+	static constexpr float SwatchSize = 8.0f;
+
+	static void AddQuad(TArray<FCanvasUVTri>& Triangles, const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D, const FLinearColor& Color)
+	{
+		FCanvasUVTri& First = Triangles.AddDefaulted_GetRef();
+		First.V0_Pos = A;
+		First.V1_Pos = B;
+		First.V2_Pos = C;
+		First.V0_Color = Color;
+		First.V1_Color = Color;
+		First.V2_Color = Color;
+
+		FCanvasUVTri& Second = Triangles.AddDefaulted_GetRef();
+		Second.V0_Pos = A;
+		Second.V1_Pos = C;
+		Second.V2_Pos = D;
+		Second.V0_Color = Color;
+		Second.V1_Color = Color;
+		Second.V2_Color = Color;
+	}
+}
+
+// FBeamDebugBatch
+
+void FBeamDebugBatch::AddLine(const FVector2D& Start, const FVector2D& End, const FLinearColor& Color, float Thickness)
+{
+	const FVector2D Delta = End - Start;
+	const double Length = Delta.Size();
+	if (Length < UE_KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	const FVector2D Offset = FVector2D(-Delta.Y, Delta.X) / Length * (0.5f * FMath::Max(Thickness, 1.0f));
+	BeamDebugOverlay::AddQuad(Triangles, Start + Offset, Start - Offset, End - Offset, End + Offset, Color);
+}
+
+void FBeamDebugBatch::AddBox(const FVector2D& Position, const FVector2D& Size, const FLinearColor& Color)
+{
+	BeamDebugOverlay::AddQuad(Triangles, Position, Position + FVector2D(Size.X, 0.0f), Position + Size, Position + FVector2D(0.0f, Size.Y), Color);
+}
+
+void FBeamDebugBatch::AddCrosshair(const FVector2D& Center, float Size, const FLinearColor& Color, float Thickness)
+{
+	AddLine(Center - FVector2D(Size, 0.0f), Center + FVector2D(Size, 0.0f), Color, Thickness);
+	AddLine(Center - FVector2D(0.0f, Size), Center + FVector2D(0.0f, Size), Color, Thickness);
+}
+
+void FBeamDebugBatch::AddTrail(const FBeamGazeTrail& Trail, const FLinearColor& Color, float Thickness)
+{
+	FBeamGazeTrail::AppendPolyline([&Trail](int32 Index) { return Trail.GetPoint(Index); }, Trail.Num(), Color, Thickness, Triangles);
+}
+
+void FBeamDebugBatch::AddText(const FVector2D& Position, const FText& Text, const FLinearColor& Color)
+{
+	if (NumTextRuns == TextRuns.Num())
+	{
+		TextRuns.AddDefaulted();
+	}
+
+	FTextRun& Run = TextRuns[NumTextRuns++];
+	Run.Position = Position;
+	Run.Text = Text;
+	Run.Color = Color;
+}
+
+void FBeamDebugBatch::Flush(FCanvas* Canvas)
+{
+	if (Canvas && Triangles.Num() > 0)
+	{
+		FCanvasTriangleItem TriangleItem(Triangles, GWhiteTexture);
+		TriangleItem.BlendMode = SE_BLEND_Translucent;
+		Canvas->DrawItem(TriangleItem);
+	}
+
+	// Back to back in one font, so the glyph quads land in the same canvas batch
+	if (Canvas && NumTextRuns > 0 && GEngine)
+	{
+		FCanvasTextItem TextItem(FVector2D::ZeroVector, FText::GetEmpty(), GEngine->GetSmallFont(), FLinearColor::White);
+		for (int32 Index = 0; Index < NumTextRuns; ++Index)
+		{
+			const FTextRun& Run = TextRuns[Index];
+			TextItem.Text = Run.Text;
+			TextItem.SetColor(Run.Color);
+			Canvas->DrawItem(TextItem, Run.Position);
+		}
+	}
+
+	Reset();
+}
+
+void FBeamDebugBatch::Reset()
+{
+	Triangles.Reset();
+	NumTextRuns = 0;
+}
+
+// FBeamDebugOverlay
+
+void FBeamDebugOverlay::Start()
+{
+#if BEAM_FEATURE_DEBUG_OVERLAY
+	if (!IsActive())
+	{
+		DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateRaw(this, &FBeamDebugOverlay::Draw));
+	}
+#endif
+}
+
+void FBeamDebugOverlay::Stop()
+{
+#if BEAM_FEATURE_DEBUG_OVERLAY
+	if (IsActive())
+	{
+		UDebugDrawService::Unregister(DrawHandle);
+		DrawHandle.Reset();
+	}
+#endif
+
+	Batch.Reset();
+	Trail.Reset();
+	PanelLines.Reset();
+}
+
+FBeamDebugBatch& FBeamDebugOverlay::GetFrameBatch()
+{
+	// Primitives that missed last frame's pass (no viewport drew) are dropped rather than piling up
+	if (BatchFrame != GFrameCounter)
+	{
+		Batch.Reset();
+		BatchFrame = GFrameCounter;
+	}
+	return Batch;
+}
+
+#if BEAM_FEATURE_DEBUG_OVERLAY
+
+void FBeamDebugOverlay::Draw(UCanvas* Canvas, APlayerController* PlayerController)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamDebugOverlay);
+
+	if (!Canvas || !Canvas->Canvas)
+	{
+		return;
+	}
+
+	FBeamDebugBatch& FrameBatch = GetFrameBatch();
+
+	const UGameInstance* GameInstance = PlayerController ? PlayerController->GetGameInstance() : nullptr;
+	const UBeamEyeTrackerSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	if (Subsystem && FBeamDebugCVars::IsDebugOverlayEnabled())
+	{
+		const FVector2D ViewportSize(Canvas->ClipX, Canvas->ClipY);
+		const FBeamFrame* Frame = Subsystem->PeekCurrentFrame();
+		const bool bGazeValid = Frame && Frame->Gaze.bValid;
+		const FVector2D GazePx = bGazeValid ? Frame->Gaze.Screen01 * ViewportSize : FVector2D::ZeroVector;
+
+		if (FBeamDebugCVars::IsDrawTrailEnabled())
+		{
+			Trail.SetCapacity(FBeamDebugCVars::GetSampleWindow());
+			if (bGazeValid && Frame->FrameId != LastTrailFrameId)
+			{
+				Trail.AddPoint(GazePx);
+				LastTrailFrameId = Frame->FrameId;
+			}
+			FrameBatch.AddTrail(Trail, FLinearColor(0.2f, 0.8f, 1.0f, 0.8f), FBeamDebugCVars::CVarTrailWidth.GetValueOnGameThread());
+		}
+
+		if (bGazeValid && FBeamDebugCVars::IsDrawGazeEnabled())
+		{
+			FrameBatch.AddCrosshair(GazePx, FBeamDebugCVars::CVarCrosshairSize.GetValueOnGameThread(), FLinearColor::Red,
+				FBeamDebugCVars::CVarCrosshairThickness.GetValueOnGameThread());
+		}
+
+		if (FBeamDebugCVars::IsDrawTextEnabled())
+		{
+			AddStatusPanel(*Subsystem, ViewportSize);
+		}
+	}
+
+	FrameBatch.Flush(Canvas->Canvas);
+}
+
+void FBeamDebugOverlay::AddStatusPanel(const UBeamEyeTrackerSubsystem& Subsystem, const FVector2D& ViewportSize)
+{
+	using namespace BeamDebugOverlay;
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (NowSeconds - PanelRefreshSeconds >= FBeamDebugCVars::CVarUpdateInterval.GetValueOnGameThread())
+	{
+		RefreshPanelText(Subsystem);
+		PanelRefreshSeconds = NowSeconds;
+	}
+
+	const FVector2D PanelSize(PanelWidth, PanelLines.Num() * LineHeight + 2.0f * PanelPadding);
+	const FVector2D Anchor = FBeamDebugCVars::GetAnchorPosition();
+	const FVector2D Origin(
+		FMath::Clamp(Anchor.X * ViewportSize.X, 0.0, FMath::Max(ViewportSize.X - PanelSize.X, 0.0)),
+		FMath::Clamp(Anchor.Y * ViewportSize.Y, 0.0, FMath::Max(ViewportSize.Y - PanelSize.Y, 0.0)));
+
+	FBeamDebugBatch& FrameBatch = GetFrameBatch();
+	FrameBatch.AddBox(Origin, PanelSize, FLinearColor(0.0f, 0.0f, 0.0f, 0.6f));
+
+	// The health line is the second one; its color goes on a swatch so every line shares one text color
+	const FVector2D TextOrigin = Origin + FVector2D(PanelPadding + SwatchSize + 4.0f, PanelPadding);
+	FrameBatch.AddBox(FVector2D(Origin.X + PanelPadding, TextOrigin.Y + LineHeight + 0.5f * (LineHeight - SwatchSize)),
+		FVector2D(SwatchSize, SwatchSize), FBeamDebugDraw::GetHealthColor(PanelHealth));
+
+	for (int32 Line = 0; Line < PanelLines.Num(); ++Line)
+	{
+		FrameBatch.AddText(TextOrigin + FVector2D(0.0f, Line * LineHeight), PanelLines[Line], FLinearColor::White);
+	}
+}
+
+void FBeamDebugOverlay::RefreshPanelText(const UBeamEyeTrackerSubsystem& Subsystem)
+{
+	PanelHealth = Subsystem.GetBeamHealth();
+	const FBeamDropCounts Drops = Subsystem.GetDropCounts();
+	const FString SourceName = StaticEnum<EBeamDataSourceType>()->GetNameStringByValue(static_cast<int64>(Subsystem.GetDataSourceType()));
+
+	PanelLines.Reset();
+	PanelLines.Add(FText::FromString(FString::Printf(TEXT("Beam %s (%s)"), Subsystem.IsBeamTracking() ? TEXT("tracking") : TEXT("stopped"), *SourceName)));
+	PanelLines.Add(FText::FromString(FString::Printf(TEXT("Health: %s"), *FBeamDebugDraw::GetHealthText(PanelHealth))));
+	PanelLines.Add(FText::FromString(FString::Printf(TEXT("Tracker: %.1f Hz"), Subsystem.GetTrackingFPS())));
+	PanelLines.Add(FText::FromString(FString::Printf(TEXT("Dropped: %lld source, %lld consumer"), Drops.SourceDropped, Drops.ConsumerDropped)));
+
+	if (const FBeamFrame* Frame = Subsystem.PeekCurrentFrame(); Frame && Frame->Gaze.bValid)
+	{
+		PanelLines.Add(FText::FromString(FString::Printf(TEXT("Gaze: (%.3f, %.3f) conf %.2f"), Frame->Gaze.Screen01.X, Frame->Gaze.Screen01.Y, Frame->Gaze.Confidence)));
+	}
+	else
+	{
+		PanelLines.Add(FText::FromString(TEXT("Gaze: invalid")));
+	}
+
+	if (Subsystem.IsRecording())
+	{
+		PanelLines.Add(FText::FromString(TEXT("Recording")));
+	}
+	if (Subsystem.IsPlayingBack())
+	{
+		PanelLines.Add(FText::FromString(TEXT("Playing back")));
+	}
+}
+
+#endif // BEAM_FEATURE_DEBUG_OVERLAY
@@ -0,0 +1,109 @@
+/*=============================================================================
+    BeamDebugOverlay.h: Single-pass batched debug overlay.
+
+    One renderer registered with UDebugDrawService draws every Beam debug
+    primitive of the frame: the overlay's own status panel, crosshair and
+    gaze trail, plus anything HUDs queued before the debug draw pass.
+    Geometry goes out as one triangle list and text as consecutive runs
+    in one font, so the canvas flushes them as two batches whatever the
+    number of primitives.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CanvasTypes.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamGazeTrail.h"
+
+class UCanvas;
+class APlayerController;
+class UBeamEyeTrackerSubsystem;
+
+/**
+ * Screen-space primitives collected over a frame and drawn in one pass.
+ * Lines and boxes become untextured triangles in a single list; text runs
+ * are drawn back to back in the small engine font, whose glyph pages
+ * batch into one canvas element. Game thread only.
+ */
+class BEAMEYETRACKER_API FBeamDebugBatch
+{
+public:
+	void AddLine(const FVector2D& Start, const FVector2D& End, const FLinearColor& Color, float Thickness = 1.0f);
+	void AddBox(const FVector2D& Position, const FVector2D& Size, const FLinearColor& Color);
+	void AddCrosshair(const FVector2D& Center, float Size, const FLinearColor& Color, float Thickness = 2.0f);
+	void AddTrail(const FBeamGazeTrail& Trail, const FLinearColor& Color, float Thickness = 2.0f);
+
+	/** Text is taken as FText so callers that keep theirs between frames pay no per-frame conversion */
+	void AddText(const FVector2D& Position, const FText& Text, const FLinearColor& Color);
+
+	bool IsEmpty() const { return Triangles.Num() == 0 && NumTextRuns == 0; }
+
+	/** Draws everything queued and clears the batch, keeping its storage */
+	void Flush(FCanvas* Canvas);
+	void Reset();
+
+private:
+	struct FTextRun
+	{
+		FVector2D Position = FVector2D::ZeroVector;
+		FText Text;
+		FLinearColor Color = FLinearColor::White;
+	};
+
+	TArray<FCanvasUVTri> Triangles;
+
+	/** Runs past NumTextRuns are stale and overwritten in place */
+	TArray<FTextRun> TextRuns;
+	int32 NumTextRuns = 0;
+};
+
+/**
+ * The plugin's debug overlay, drawn in the "Game" debug draw pass.
+ *
+ * With beam.debug.hud and beam.debug.overlay on, it adds the status
+ * panel (beam.debug.text), gaze crosshair (beam.debug.gaze) and trail
+ * (beam.debug.trail) to the frame's batch; HUDs add to the same batch
+ * through GetFrameBatch before the pass. Panel text is formatted at most
+ * every beam.debug.update.interval seconds and reused in between.
+ */
+class BEAMEYETRACKER_API FBeamDebugOverlay
+{
+public:
+	/** Registers with UDebugDrawService; game thread. No-op without BEAM_FEATURE_DEBUG_OVERLAY */
+	void Start();
+	void Stop();
+
+	bool IsActive() const { return DrawHandle.IsValid(); }
+
+	/** Batch flushed by this frame's debug draw pass; starts empty every engine frame */
+	FBeamDebugBatch& GetFrameBatch();
+
+private:
+	void Draw(UCanvas* Canvas, APlayerController* PlayerController);
+	void AddStatusPanel(const UBeamEyeTrackerSubsystem& Subsystem, const FVector2D& ViewportSize);
+	void RefreshPanelText(const UBeamEyeTrackerSubsystem& Subsystem);
+
+	FBeamDebugBatch Batch;
+	uint64 BatchFrame = 0;
+
+	FDelegateHandle DrawHandle;
+
+	FBeamGazeTrail Trail;
+	int64 LastTrailFrameId = -1;
+
+	/** Formatted panel lines, rebuilt on the update interval */
+	TArray<FText> PanelLines;
+	EBeamHealth PanelHealth = EBeamHealth::Error;
+	double PanelRefreshSeconds = -DBL_MAX;
+};
+
+extern BEAMEYETRACKER_API FBeamDebugOverlay GBeamDebugOverlay;
+
+/*=============================================================================
+    End of BeamDebugOverlay.h
+=============================================================================*/
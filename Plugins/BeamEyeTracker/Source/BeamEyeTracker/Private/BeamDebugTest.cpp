@@ -2,6 +2,8 @@
 
 #include "BeamDebugCVars.h"
 #include "BeamLogging.h"
+#include "BeamMemoryBudget.h"
+#include "BeamRing.h"
 #include "Engine/Engine.h"
 #include "HAL/IConsoleManager.h"
 
@@ -60,3 +62,141 @@ static FAutoConsoleCommand TestBeamDebugCVarsCommand(
 );
 
 #endif // BEAM_FEATURE_DEBUG_OVERLAY
+
+#if !UE_BUILD_SHIPPING
+
+// Memory Budget Test Suite
+
+/**
+ * @brief Verifies that every memory preset charges at least what the subsystem rings really allocate
+ * 
+ * Builds the main and raw frame rings exactly as the subsystem would under each preset
+ * and compares their allocated bytes with the budget's fixed ring charge.
+ * 
+ * Test Cases:
+ * - Ring charge: FixedRingBytes is at least the rings' GetAllocatedSize
+ * - Feasibility: the planned total of every preset fits its budget
+ * 
+ * Expected Outcome: Every preset passes both checks
+ */
+void TestBeamMemoryBudget()
+{
+    UE_LOG(LogBeam, Log, TEXT("=== Testing Beam Memory Budget ==="));
+
+    int32 NumFailed = 0;
+    for (const EBeamMemoryProfile Profile : { EBeamMemoryProfile::LowMemoryKiosk, EBeamMemoryProfile::Default, EBeamMemoryProfile::Research })
+    {
+        const FBeamMemoryBudget Budget = FBeamMemoryBudget::FromBudget(Profile, FBeamMemoryBudget::GetProfileBudgetBytes(Profile));
+
+        // The raw ring is only built for raw capture users, but the budget charges it regardless
+        const FBeamFrameRing MainRing(Budget.bFrameRingGazeColumns, Budget.bFrameRingSnapshots);
+        const FBeamFrameRing RawRing;
+        const int64 AllocatedBytes = static_cast<int64>(MainRing.GetAllocatedSize() + RawRing.GetAllocatedSize());
+
+        const bool bCharged = Budget.FixedRingBytes >= AllocatedBytes;
+        const bool bFits = Budget.GetPlannedBytes() <= Budget.BudgetBytes;
+        NumFailed += (bCharged ? 0 : 1) + (bFits ? 0 : 1);
+
+        UE_LOG(LogBeam, Log, TEXT("%s: rings charged %.1f KB, allocated %.1f KB [%s]; planned %.1f KB of %.1f KB [%s]"),
+            FBeamMemoryBudget::GetProfileName(Profile), Budget.FixedRingBytes / 1024.0, AllocatedBytes / 1024.0, bCharged ? TEXT("PASS") : TEXT("FAIL"),
+            Budget.GetPlannedBytes() / 1024.0, Budget.BudgetBytes / 1024.0, bFits ? TEXT("PASS") : TEXT("FAIL"));
+    }
+
+    if (NumFailed > 0)
+    {
+        UE_LOG(LogBeam, Error, TEXT("=== Beam Memory Budget Test FAILED (%d checks) ==="), NumFailed);
+    }
+    else
+    {
+        UE_LOG(LogBeam, Log, TEXT("=== Beam Memory Budget Test Complete ==="));
+    }
+}
+
+// Usage: Type "Beam.TestMemoryBudget" in console to run the test
+static FAutoConsoleCommand TestBeamMemoryBudgetCommand(
+    TEXT("Beam.TestMemoryBudget"),
+    TEXT("Test that the memory budget presets charge at least the ring memory really allocated"),
+    FConsoleCommandDelegate::CreateStatic(&TestBeamMemoryBudget)
+);
+
+// Ring Consumer Test Suite
+
+/**
+ * @brief Verifies that a consumer cursor restarts with the stream when the ring is cleared
+ * 
+ * Consumes a first stream, clears the ring and publishes a longer second stream before
+ * the consumer reads again, so the write index has already passed the cursor's old index.
+ * 
+ * Test Cases:
+ * - Refill past the cursor: every frame of the second stream is returned
+ * - Order: the first frame returned is the first frame published after the clear
+ * - Accounting: the clear is not counted as dropped frames
+ * 
+ * Expected Outcome: All three checks pass
+ */
+void TestBeamRingClearRefill()
+{
+    UE_LOG(LogBeam, Log, TEXT("=== Testing Beam Ring Clear And Refill ==="));
+
+    constexpr int32 FirstStream = 10;
+    constexpr int32 SecondStream = 20;
+
+    FBeamFrameRing Ring;
+    const int32 ConsumerId = Ring.RegisterConsumer(TEXT("ClearRefillTest"));
+    if (ConsumerId == INDEX_NONE)
+    {
+        UE_LOG(LogBeam, Error, TEXT("=== Beam Ring Clear And Refill Test FAILED (no free cursor) ==="));
+        return;
+    }
+
+    FBeamFrame Frame;
+    TArray<FBeamFrame> Consumed;
+    for (int32 i = 0; i < FirstStream; ++i)
+    {
+        Frame.FrameId = i;
+        Frame.SDKTimestampMs = 1000.0 + i;
+        Ring.Publish(Frame);
+    }
+    Ring.ConsumeFrames(ConsumerId, Consumed);
+
+    Ring.Clear();
+    for (int32 i = 0; i < SecondStream; ++i)
+    {
+        Frame.FrameId = 100 + i;
+        Frame.SDKTimestampMs = 5000.0 + i;
+        Ring.Publish(Frame);
+    }
+    const int32 NumRefilled = Ring.ConsumeFrames(ConsumerId, Consumed);
+
+    FBeamRingConsumerStats Stats;
+    Ring.GetConsumerStats(ConsumerId, Stats);
+    Ring.UnregisterConsumer(ConsumerId);
+
+    const bool bComplete = NumRefilled == SecondStream;
+    const bool bOrdered = Consumed.Num() > 0 && Consumed[0].FrameId == 100;
+    const bool bNoDrops = Stats.DroppedFrames == 0;
+    const int32 NumFailed = (bComplete ? 0 : 1) + (bOrdered ? 0 : 1) + (bNoDrops ? 0 : 1);
+
+    UE_LOG(LogBeam, Log, TEXT("Refill: consumed %d of %d [%s]; first frame %lld [%s]; dropped %llu [%s]"),
+        NumRefilled, SecondStream, bComplete ? TEXT("PASS") : TEXT("FAIL"),
+        Consumed.Num() > 0 ? Consumed[0].FrameId : INDEX_NONE, bOrdered ? TEXT("PASS") : TEXT("FAIL"),
+        Stats.DroppedFrames, bNoDrops ? TEXT("PASS") : TEXT("FAIL"));
+
+    if (NumFailed > 0)
+    {
+        UE_LOG(LogBeam, Error, TEXT("=== Beam Ring Clear And Refill Test FAILED (%d checks) ==="), NumFailed);
+    }
+    else
+    {
+        UE_LOG(LogBeam, Log, TEXT("=== Beam Ring Clear And Refill Test Complete ==="));
+    }
+}
+
+// Usage: Type "Beam.TestRingClearRefill" in console to run the test
+static FAutoConsoleCommand TestBeamRingClearRefillCommand(
+    TEXT("Beam.TestRingClearRefill"),
+    TEXT("Test that a ring consumer reads the whole new stream after the ring is cleared and refilled"),
+    FConsoleCommandDelegate::CreateStatic(&TestBeamRingClearRefill)
+);
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,569 @@
+// Implements the streaming CSV and columnar exporters
+
+#include "BeamExport.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamLogging.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CString.h"
+#include "Misc/Compression.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+namespace
+{
+	std::atomic<int32> GPendingExports{ 0 };
+
+	/** Bytes zero-padded in front of a column chunk so every chunk starts 8-byte aligned */
+	void PadToAlignment(FArchive& Archive)
+	{
+		static const uint8 Zeros[8] = { 0 };
+		const int64 Misalignment = Archive.Tell() & 7;
+		if (Misalignment != 0)
+		{
+			Archive.Serialize(const_cast<uint8*>(Zeros), 8 - Misalignment);
+		}
+	}
+
+	/** Frame columns shared by the CSV and columnar layouts, in file order */
+	const FBeamColumnDesc GFrameColumns[] =
+	{
+		{ TEXT("Timestamp"), EBeamColumnType::Float64 },
+		{ TEXT("GazeX"), EBeamColumnType::Float32 },
+		{ TEXT("GazeY"), EBeamColumnType::Float32 },
+		{ TEXT("GazeConfidence"), EBeamColumnType::Float32 },
+		{ TEXT("HeadPitch"), EBeamColumnType::Float32 },
+		{ TEXT("HeadYaw"), EBeamColumnType::Float32 },
+		{ TEXT("HeadRoll"), EBeamColumnType::Float32 },
+		{ TEXT("HeadConfidence"), EBeamColumnType::Float32 },
+		{ TEXT("FrameId"), EBeamColumnType::Int64 },
+		{ TEXT("SDKTimestampMs"), EBeamColumnType::Float64 },
+		{ TEXT("GazeValid"), EBeamColumnType::UInt8 },
+		{ TEXT("HeadX"), EBeamColumnType::Float32 },
+		{ TEXT("HeadY"), EBeamColumnType::Float32 },
+		{ TEXT("HeadZ"), EBeamColumnType::Float32 }
+	};
+
+	/** Compression format for a stored chunk codec; Oodle degrades to zlib where it is not compiled in */
+	FName GetChunkFormatName(EBeamRecordingCompression Codec)
+	{
+		return Codec == EBeamRecordingCompression::Oodle ? NAME_Oodle : NAME_Zlib;
+	}
+
+	static constexpr const ANSICHAR* FrameCsvHeader =
+		"Timestamp,GazeX,GazeY,GazeConfidence,HeadPitch,HeadYaw,HeadRoll,HeadConfidence,FrameId,SDKTimestampMs,GazeValid,HeadX,HeadY,HeadZ";
+}
+
+int32 BeamColumnTypeSize(EBeamColumnType Type)
+{
+	switch (Type)
+	{
+	case EBeamColumnType::Float64: return 8;
+	case EBeamColumnType::Float32: return 4;
+	case EBeamColumnType::Int64:   return 8;
+	case EBeamColumnType::Int32:   return 4;
+	case EBeamColumnType::UInt8:   return 1;
+	default:                       return 0;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// FBeamCsvWriter
+//-----------------------------------------------------------------------------
+
+FBeamCsvWriter::FBeamCsvWriter(FArchive& InArchive, int32 InBufferBytes)
+	: Archive(InArchive)
+	, BufferBytes(FMath::Max(InBufferBytes, 1024))
+{
+	Buffer.Reserve(BufferBytes);
+}
+
+FBeamCsvWriter::~FBeamCsvWriter()
+{
+	Flush();
+}
+
+void FBeamCsvWriter::WriteHeader(const ANSICHAR* Columns)
+{
+	Append(Columns, FCStringAnsi::Strlen(Columns));
+	Append("\n", 1);
+}
+
+FBeamCsvWriter& FBeamCsvWriter::Add(double Value, int32 Decimals)
+{
+	BeginCell();
+	ANSICHAR Scratch[64];
+	const int32 Length = FCStringAnsi::Snprintf(Scratch, UE_ARRAY_COUNT(Scratch), "%.*f", Decimals, Value);
+	Append(Scratch, FMath::Clamp(Length, 0, static_cast<int32>(UE_ARRAY_COUNT(Scratch)) - 1));
+	return *this;
+}
+
+FBeamCsvWriter& FBeamCsvWriter::Add(int64 Value)
+{
+	BeginCell();
+	ANSICHAR Scratch[32];
+	const int32 Length = FCStringAnsi::Snprintf(Scratch, UE_ARRAY_COUNT(Scratch), "%lld", static_cast<long long>(Value));
+	Append(Scratch, FMath::Clamp(Length, 0, static_cast<int32>(UE_ARRAY_COUNT(Scratch)) - 1));
+	return *this;
+}
+
+FBeamCsvWriter& FBeamCsvWriter::Add(const TCHAR* Text)
+{
+	BeginCell();
+	for (const TCHAR* Char = Text; Char && *Char; ++Char)
+	{
+		// Names in these exports are ASCII identifiers; anything else would break the cell and is replaced
+		const TCHAR C = *Char;
+		const ANSICHAR Out = (C < 0x20 || C > 0x7E || C == TEXT(',') || C == TEXT('"')) ? '_' : static_cast<ANSICHAR>(C);
+		Append(&Out, 1);
+	}
+	return *this;
+}
+
+void FBeamCsvWriter::EndRow()
+{
+	Append("\n", 1);
+	bRowStarted = false;
+}
+
+bool FBeamCsvWriter::Flush()
+{
+	if (Buffer.Num() > 0)
+	{
+		Archive.Serialize(Buffer.GetData(), Buffer.Num());
+		Buffer.Reset();
+	}
+	return !Archive.IsError();
+}
+
+void FBeamCsvWriter::BeginCell()
+{
+	if (bRowStarted)
+	{
+		Append(",", 1);
+	}
+	bRowStarted = true;
+}
+
+void FBeamCsvWriter::Append(const ANSICHAR* Text, int32 Length)
+{
+	if (Buffer.Num() + Length > BufferBytes)
+	{
+		Flush();
+	}
+	Buffer.Append(Text, Length);
+}
+
+//-----------------------------------------------------------------------------
+// FBeamColumnarWriter
+//-----------------------------------------------------------------------------
+
+FBeamColumnarWriter::FBeamColumnarWriter(FArchive& InArchive, TArray<FBeamColumnDesc> InColumns, int32 InRowsPerGroup)
+	: Archive(InArchive)
+	, RowsPerGroup(FMath::Max(InRowsPerGroup, 1))
+{
+	Columns.Reserve(InColumns.Num());
+	for (FBeamColumnDesc& Desc : InColumns)
+	{
+		FColumnState& State = Columns.AddDefaulted_GetRef();
+		State.Values.Reserve(RowsPerGroup * BeamColumnTypeSize(Desc.Type));
+		State.Desc = MoveTemp(Desc);
+	}
+
+	// Fixed 16-byte header: magic, version, column count, reserved
+	uint32 HeaderMagic = Magic;
+	uint32 HeaderVersion = Version;
+	uint32 NumColumns = Columns.Num();
+	uint32 Reserved = 0;
+	Archive << HeaderMagic << HeaderVersion << NumColumns << Reserved;
+}
+
+void FBeamColumnarWriter::SetCompression(EBeamRecordingCompression InCompression)
+{
+	Compression = InCompression == EBeamRecordingCompression::Oodle && !FCompression::IsFormatValid(NAME_Oodle)
+		? EBeamRecordingCompression::Zlib
+		: InCompression;
+}
+
+void FBeamColumnarWriter::Add(int32 Column, double Value)
+{
+	FColumnState& State = Columns[Column];
+	switch (State.Desc.Type)
+	{
+	case EBeamColumnType::Float64: { const double V = Value; Store(State, V, &V, sizeof(V)); break; }
+	case EBeamColumnType::Float32: { const float V = static_cast<float>(Value); Store(State, V, &V, sizeof(V)); break; }
+	case EBeamColumnType::Int64:   { const int64 V = static_cast<int64>(Value); Store(State, static_cast<double>(V), &V, sizeof(V)); break; }
+	case EBeamColumnType::Int32:   { const int32 V = static_cast<int32>(Value); Store(State, V, &V, sizeof(V)); break; }
+	case EBeamColumnType::UInt8:   { const uint8 V = static_cast<uint8>(FMath::Clamp(Value, 0.0, 255.0)); Store(State, V, &V, sizeof(V)); break; }
+	}
+}
+
+void FBeamColumnarWriter::Add(int32 Column, int64 Value)
+{
+	FColumnState& State = Columns[Column];
+	if (State.Desc.Type == EBeamColumnType::Int64)
+	{
+		// Kept exact; only the statistics go through double
+		Store(State, static_cast<double>(Value), &Value, sizeof(Value));
+		return;
+	}
+	Add(Column, static_cast<double>(Value));
+}
+
+void FBeamColumnarWriter::Store(FColumnState& State, double AsDouble, const void* Value, int32 Size)
+{
+	if (State.Values.Num() == 0)
+	{
+		State.Min = AsDouble;
+		State.Max = AsDouble;
+	}
+	else
+	{
+		State.Min = FMath::Min(State.Min, AsDouble);
+		State.Max = FMath::Max(State.Max, AsDouble);
+	}
+	State.Values.Append(static_cast<const uint8*>(Value), Size);
+}
+
+void FBeamColumnarWriter::EndRow()
+{
+	++NumRows;
+	if (++RowsInGroup >= static_cast<uint32>(RowsPerGroup))
+	{
+		WriteRowGroup();
+	}
+}
+
+bool FBeamColumnarWriter::Finish()
+{
+	if (!bFinished)
+	{
+		bFinished = true;
+		WriteRowGroup();
+		WriteFooter();
+	}
+	return !Archive.IsError();
+}
+
+void FBeamColumnarWriter::WriteRowGroup()
+{
+	if (RowsInGroup == 0)
+	{
+		return;
+	}
+
+	FBeamColumnRowGroup& Group = RowGroups.AddDefaulted_GetRef();
+	Group.NumRows = RowsInGroup;
+	Group.Chunks.Reserve(Columns.Num());
+	for (FColumnState& State : Columns)
+	{
+		PadToAlignment(Archive);
+
+		FBeamColumnChunk& Chunk = Group.Chunks.AddDefaulted_GetRef();
+		Chunk.Offset = Archive.Tell();
+		Chunk.RawBytes = State.Values.Num();
+		Chunk.Min = State.Min;
+		Chunk.Max = State.Max;
+
+		// Each chunk is compressed on its own so readers can still skip columns and groups
+		if (Compression != EBeamRecordingCompression::None)
+		{
+			const FName FormatName = GetChunkFormatName(Compression);
+			int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, State.Values.Num());
+			CompressScratch.SetNumUninitialized(CompressedSize, EAllowShrinking::No);
+			if (FCompression::CompressMemory(FormatName, CompressScratch.GetData(), CompressedSize, State.Values.GetData(), State.Values.Num())
+				&& CompressedSize < State.Values.Num())
+			{
+				Chunk.Codec = static_cast<uint8>(Compression);
+				Chunk.StoredBytes = CompressedSize;
+				Archive.Serialize(CompressScratch.GetData(), CompressedSize);
+				State.Values.Reset();
+				continue;
+			}
+		}
+
+		Chunk.StoredBytes = State.Values.Num();
+		Archive.Serialize(State.Values.GetData(), State.Values.Num());
+
+		State.Values.Reset();
+	}
+	RowsInGroup = 0;
+}
+
+void FBeamColumnarWriter::WriteFooter()
+{
+	PadToAlignment(Archive);
+	uint64 FooterOffset = Archive.Tell();
+
+	// Schema: type and UTF-8 name per column
+	uint32 NumColumns = Columns.Num();
+	Archive << NumColumns;
+	for (FColumnState& State : Columns)
+	{
+		uint8 Type = static_cast<uint8>(State.Desc.Type);
+		FTCHARToUTF8 Name(*State.Desc.Name);
+		uint16 NameLength = static_cast<uint16>(Name.Length());
+		Archive << Type << NameLength;
+		Archive.Serialize(const_cast<ANSICHAR*>(Name.Get()), NameLength);
+	}
+
+	// Row-group directory with per-chunk location and statistics, enough to skip groups by value range
+	uint32 NumGroups = RowGroups.Num();
+	Archive << NumGroups;
+	for (FBeamColumnRowGroup& Group : RowGroups)
+	{
+		Archive << Group.NumRows;
+		for (FBeamColumnChunk& Chunk : Group.Chunks)
+		{
+			Archive << Chunk.Offset << Chunk.StoredBytes << Chunk.RawBytes << Chunk.Codec << Chunk.Min << Chunk.Max;
+		}
+	}
+
+	uint32 ExtensionBytes = FooterExtension.Num();
+	Archive << ExtensionBytes;
+	Archive.Serialize(FooterExtension.GetData(), ExtensionBytes);
+
+	// Trailer: readers seek to the end, check the magic and jump to the footer
+	uint32 TrailerMagic = Magic;
+	Archive << FooterOffset << TrailerMagic;
+}
+
+//-----------------------------------------------------------------------------
+// FBeamColumnarReader
+//-----------------------------------------------------------------------------
+
+bool FBeamColumnarReader::Open(const FString& InFilePath)
+{
+	FilePath = InFilePath;
+	Columns.Reset();
+	RowGroups.Reset();
+	FooterExtension.Reset();
+
+	TUniquePtr<FArchive> Archive = OpenArchive();
+	constexpr int64 HeaderBytes = 16;
+	constexpr int64 TrailerBytes = sizeof(uint64) + sizeof(uint32);
+	if (!Archive || Archive->TotalSize() < HeaderBytes + TrailerBytes)
+	{
+		return false;
+	}
+
+	uint32 HeaderMagic = 0;
+	uint32 HeaderVersion = 0;
+	*Archive << HeaderMagic << HeaderVersion;
+	if (HeaderMagic != FBeamColumnarWriter::Magic || HeaderVersion == 0 || HeaderVersion > FBeamColumnarWriter::Version)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: %s is not a supported columnar file"), *FilePath);
+		return false;
+	}
+
+	uint64 FooterOffset = 0;
+	uint32 TrailerMagic = 0;
+	Archive->Seek(Archive->TotalSize() - TrailerBytes);
+	*Archive << FooterOffset << TrailerMagic;
+	if (TrailerMagic != FBeamColumnarWriter::Magic || FooterOffset >= static_cast<uint64>(Archive->TotalSize()))
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: %s has no footer; the export did not finish"), *FilePath);
+		return false;
+	}
+
+	Archive->Seek(FooterOffset);
+	uint32 NumColumns = 0;
+	*Archive << NumColumns;
+	for (uint32 ColumnIndex = 0; ColumnIndex < NumColumns && !Archive->IsError(); ++ColumnIndex)
+	{
+		uint8 Type = 0;
+		uint16 NameLength = 0;
+		*Archive << Type << NameLength;
+		TArray<ANSICHAR> Name;
+		Name.SetNumZeroed(NameLength + 1);
+		Archive->Serialize(Name.GetData(), NameLength);
+
+		FBeamColumnDesc& Desc = Columns.AddDefaulted_GetRef();
+		Desc.Name = FString(UTF8_TO_TCHAR(Name.GetData()));
+		Desc.Type = static_cast<EBeamColumnType>(Type);
+	}
+
+	uint32 NumGroups = 0;
+	*Archive << NumGroups;
+	for (uint32 GroupIndex = 0; GroupIndex < NumGroups && !Archive->IsError(); ++GroupIndex)
+	{
+		FBeamColumnRowGroup& Group = RowGroups.AddDefaulted_GetRef();
+		*Archive << Group.NumRows;
+		Group.Chunks.SetNum(NumColumns);
+		for (FBeamColumnChunk& Chunk : Group.Chunks)
+		{
+			*Archive << Chunk.Offset << Chunk.StoredBytes << Chunk.RawBytes << Chunk.Codec << Chunk.Min << Chunk.Max;
+		}
+	}
+
+	if (HeaderVersion >= 2)
+	{
+		uint32 ExtensionBytes = 0;
+		*Archive << ExtensionBytes;
+		if (ExtensionBytes > 0 && Archive->Tell() + ExtensionBytes <= Archive->TotalSize() - TrailerBytes)
+		{
+			FooterExtension.SetNumUninitialized(ExtensionBytes);
+			Archive->Serialize(FooterExtension.GetData(), ExtensionBytes);
+		}
+	}
+	return !Archive->IsError();
+}
+
+int32 FBeamColumnarReader::FindColumn(const TCHAR* Name) const
+{
+	return Columns.IndexOfByPredicate([Name](const FBeamColumnDesc& Desc) { return Desc.Name.Equals(Name); });
+}
+
+TUniquePtr<FArchive> FBeamColumnarReader::OpenArchive() const
+{
+	return TUniquePtr<FArchive>(IFileManager::Get().CreateFileReader(*FilePath));
+}
+
+bool FBeamColumnarReader::ReadChunk(FArchive& Archive, int32 RowGroup, int32 Column, TArray<uint8>& OutValues, TArray<uint8>& Scratch) const
+{
+	if (!RowGroups.IsValidIndex(RowGroup) || !Columns.IsValidIndex(Column))
+	{
+		return false;
+	}
+
+	const FBeamColumnChunk& Chunk = RowGroups[RowGroup].Chunks[Column];
+	const EBeamRecordingCompression Codec = static_cast<EBeamRecordingCompression>(Chunk.Codec);
+	Archive.Seek(Chunk.Offset);
+	OutValues.SetNumUninitialized(static_cast<int32>(Chunk.RawBytes), EAllowShrinking::No);
+	if (Codec == EBeamRecordingCompression::None)
+	{
+		Archive.Serialize(OutValues.GetData(), OutValues.Num());
+		return !Archive.IsError();
+	}
+
+	Scratch.SetNumUninitialized(static_cast<int32>(Chunk.StoredBytes), EAllowShrinking::No);
+	Archive.Serialize(Scratch.GetData(), Scratch.Num());
+	return !Archive.IsError()
+		&& FCompression::UncompressMemory(GetChunkFormatName(Codec), OutValues.GetData(), OutValues.Num(), Scratch.GetData(), Scratch.Num());
+}
+
+bool FBeamColumnarReader::ReadChunkAsDouble(FArchive& Archive, int32 RowGroup, int32 Column, TArray<double>& OutValues, TArray<uint8>& Scratch) const
+{
+	TArray<uint8> Raw;
+	if (!ReadChunk(Archive, RowGroup, Column, Raw, Scratch))
+	{
+		return false;
+	}
+
+	const int32 Count = RowGroups[RowGroup].NumRows;
+	const EBeamColumnType Type = Columns[Column].Type;
+	if (Raw.Num() != Count * BeamColumnTypeSize(Type))
+	{
+		return false;
+	}
+
+	const int32 First = OutValues.AddUninitialized(Count);
+	double* Out = OutValues.GetData() + First;
+	const uint8* In = Raw.GetData();
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		switch (Type)
+		{
+		case EBeamColumnType::Float64: Out[Index] = reinterpret_cast<const double*>(In)[Index]; break;
+		case EBeamColumnType::Float32: Out[Index] = reinterpret_cast<const float*>(In)[Index]; break;
+		case EBeamColumnType::Int64:   Out[Index] = static_cast<double>(reinterpret_cast<const int64*>(In)[Index]); break;
+		case EBeamColumnType::Int32:   Out[Index] = reinterpret_cast<const int32*>(In)[Index]; break;
+		case EBeamColumnType::UInt8:   Out[Index] = In[Index]; break;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// BeamExport
+//-----------------------------------------------------------------------------
+
+EBeamExportFormat BeamExport::FormatFromPath(const FString& FilePath)
+{
+	return FPaths::GetExtension(FilePath).Equals(TEXT("beamcol"), ESearchCase::IgnoreCase) ? EBeamExportFormat::Columnar : EBeamExportFormat::Csv;
+}
+
+void BeamExport::Launch(const FString& Description, const FString& FilePath, TUniqueFunction<bool()> Task, TUniqueFunction<void(bool)> OnFinished)
+{
+	GPendingExports.fetch_add(1, std::memory_order_relaxed);
+	Async(EAsyncExecution::ThreadPool, [Description, FilePath, Task = MoveTemp(Task), OnFinished = MoveTemp(OnFinished)]() mutable
+	{
+		const double StartSeconds = FPlatformTime::Seconds();
+		const bool bSucceeded = Task();
+		if (OnFinished)
+		{
+			AsyncTask(ENamedThreads::GameThread, [OnFinished = MoveTemp(OnFinished), bSucceeded]()
+			{
+				OnFinished(bSucceeded);
+			});
+		}
+
+		if (bSucceeded)
+		{
+			UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: %s exported to %s in %.2f s"), *Description, *FilePath, FPlatformTime::Seconds() - StartSeconds);
+		}
+		else
+		{
+			UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Failed to export %s to %s"), *Description, *FilePath);
+		}
+		GPendingExports.fetch_sub(1, std::memory_order_release);
+	});
+}
+
+void BeamExport::WaitForPendingExports()
+{
+	while (GPendingExports.load(std::memory_order_acquire) > 0)
+	{
+		FPlatformProcess::Sleep(0.005f);
+	}
+}
+
+bool BeamExport::WriteFrames(const FString& FilePath, EBeamExportFormat Format, TFunctionRef<bool(FBeamFrame&)> NextFrame)
+{
+	TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Archive)
+	{
+		return false;
+	}
+
+	FBeamFrame Frame;
+	if (Format == EBeamExportFormat::Columnar)
+	{
+		FBeamColumnarWriter Writer(*Archive, TArray<FBeamColumnDesc>(GFrameColumns, UE_ARRAY_COUNT(GFrameColumns)));
+		while (NextFrame(Frame))
+		{
+			int32 Column = 0;
+			Writer.Add(Column++, Frame.UETimestampSeconds);
+			Writer.Add(Column++, Frame.Gaze.Screen01.X);
+			Writer.Add(Column++, Frame.Gaze.Screen01.Y);
+			Writer.Add(Column++, Frame.Gaze.Confidence);
+			Writer.Add(Column++, Frame.Head.Rotation.Pitch);
+			Writer.Add(Column++, Frame.Head.Rotation.Yaw);
+			Writer.Add(Column++, Frame.Head.Rotation.Roll);
+			Writer.Add(Column++, Frame.Head.Confidence);
+			Writer.Add(Column++, Frame.FrameId);
+			Writer.Add(Column++, Frame.SDKTimestampMs);
+			Writer.Add(Column++, Frame.Gaze.bValid ? 1.0 : 0.0);
+			Writer.Add(Column++, Frame.Head.PositionCm.X);
+			Writer.Add(Column++, Frame.Head.PositionCm.Y);
+			Writer.Add(Column++, Frame.Head.PositionCm.Z);
+			Writer.EndRow();
+		}
+		return Writer.Finish() && Archive->Close();
+	}
+
+	FBeamCsvWriter Writer(*Archive);
+	Writer.WriteHeader(FrameCsvHeader);
+	while (NextFrame(Frame))
+	{
+		Writer.Add(Frame.UETimestampSeconds)
+			.Add(Frame.Gaze.Screen01.X).Add(Frame.Gaze.Screen01.Y).Add(Frame.Gaze.Confidence)
+			.Add(Frame.Head.Rotation.Pitch).Add(Frame.Head.Rotation.Yaw).Add(Frame.Head.Rotation.Roll).Add(Frame.Head.Confidence)
+			.Add(Frame.FrameId).Add(Frame.SDKTimestampMs, 3).Add(Frame.Gaze.bValid ? 1 : 0)
+			.Add(Frame.Head.PositionCm.X, 3).Add(Frame.Head.PositionCm.Y, 3).Add(Frame.Head.PositionCm.Z, 3);
+		Writer.EndRow();
+	}
+	return Writer.Flush() && Archive->Close();
+}
@@ -0,0 +1,224 @@
+/*=============================================================================
+    BeamExport.h: Streaming CSV and columnar exporters.
+
+    Exports write rows straight into a buffered FArchive instead of
+    building the whole file in memory, format numbers into a stack buffer
+    rather than temporary FStrings, and run on the thread pool so long
+    sessions never stall the game thread.
+
+    The columnar .beamcol layout follows Parquet's shape (row groups,
+    per-column chunks, a footer with min/max statistics) while keeping each
+    column chunk a plain little-endian, 8-byte aligned array, the same
+    memory layout as an Arrow fixed-width buffer, so tools can map columns
+    without decoding. Chunks may optionally be compressed individually, so
+    a reader still inflates only the columns and row groups it needs.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "BeamRecording.h"
+
+struct FBeamFrame;
+
+enum class EBeamExportFormat : uint8
+{
+	Csv,
+	Columnar
+};
+
+/** Value type of a columnar export column; the value is the on-disk element size selector */
+enum class EBeamColumnType : uint8
+{
+	Float64,
+	Float32,
+	Int64,
+	Int32,
+	UInt8
+};
+
+/** Buffered CSV writer; owns nothing but the row buffer, the archive belongs to the caller */
+class FBeamCsvWriter
+{
+public:
+	explicit FBeamCsvWriter(FArchive& InArchive, int32 InBufferBytes = 64 * 1024);
+	~FBeamCsvWriter();
+
+	/** Writes a header row from a comma-separated column list */
+	void WriteHeader(const ANSICHAR* Columns);
+
+	FBeamCsvWriter& Add(double Value, int32 Decimals = 6);
+	FBeamCsvWriter& Add(int64 Value);
+	FBeamCsvWriter& Add(uint32 Value) { return Add(static_cast<int64>(Value)); }
+	FBeamCsvWriter& Add(int32 Value) { return Add(static_cast<int64>(Value)); }
+
+	/** Text cells are expected to be identifiers; commas and quotes are replaced rather than escaped */
+	FBeamCsvWriter& Add(const TCHAR* Text);
+
+	void EndRow();
+
+	/** Hands the buffered bytes to the archive; false once the archive reported an error */
+	bool Flush();
+
+private:
+	void BeginCell();
+	void Append(const ANSICHAR* Text, int32 Length);
+
+	FArchive& Archive;
+	TArray<ANSICHAR> Buffer;
+	int32 BufferBytes;
+	bool bRowStarted = false;
+};
+
+/** Schema entry of a columnar export */
+struct FBeamColumnDesc
+{
+	FString Name;
+	EBeamColumnType Type = EBeamColumnType::Float64;
+};
+
+/** Location, encoding and statistics of one column chunk */
+struct FBeamColumnChunk
+{
+	uint64 Offset = 0;
+	uint64 StoredBytes = 0;
+	uint64 RawBytes = 0;
+
+	/** EBeamRecordingCompression of the stored bytes */
+	uint8 Codec = 0;
+
+	double Min = 0.0;
+	double Max = 0.0;
+};
+
+/** One row group: the same rows of every column, one chunk per column in schema order */
+struct FBeamColumnRowGroup
+{
+	uint32 NumRows = 0;
+	TArray<FBeamColumnChunk> Chunks;
+};
+
+/** Row-group columnar writer producing .beamcol files */
+class FBeamColumnarWriter
+{
+public:
+	static constexpr uint32 Magic = 0x4C4F4342; // "BCOL"
+
+	/** v2 adds per-chunk compression and a footer extension block */
+	static constexpr uint32 Version = 2;
+
+	FBeamColumnarWriter(FArchive& InArchive, TArray<FBeamColumnDesc> InColumns, int32 InRowsPerGroup = 64 * 1024);
+
+	/** Codec for chunks written after the call; a chunk that does not shrink is stored raw */
+	void SetCompression(EBeamRecordingCompression InCompression);
+
+	/** Opaque bytes stored in the footer, e.g. an index over the row groups */
+	void SetFooterExtension(TArray<uint8> InExtension) { FooterExtension = MoveTemp(InExtension); }
+
+	/** Appends one value to Column of the current row; every column gets exactly one value per row */
+	void Add(int32 Column, double Value);
+	void Add(int32 Column, int64 Value);
+
+	/** Closes the current row; a full row group is written out immediately */
+	void EndRow();
+
+	/** Writes out the current partial row group, so following rows start a new one */
+	void EndRowGroup() { WriteRowGroup(); }
+
+	/** Row groups written so far; the next one gets this index */
+	int32 GetNumRowGroups() const { return RowGroups.Num(); }
+
+	/** Writes the last row group and the footer; false if the archive failed at any point */
+	bool Finish();
+
+	int64 GetNumRows() const { return NumRows; }
+
+private:
+	struct FColumnState
+	{
+		FBeamColumnDesc Desc;
+		TArray<uint8> Values;
+		double Min = 0.0;
+		double Max = 0.0;
+	};
+
+	void Store(FColumnState& State, double AsDouble, const void* Value, int32 Size);
+	void WriteRowGroup();
+	void WriteFooter();
+
+	FArchive& Archive;
+	TArray<FColumnState> Columns;
+	TArray<FBeamColumnRowGroup> RowGroups;
+	TArray<uint8> CompressScratch;
+	TArray<uint8> FooterExtension;
+	EBeamRecordingCompression Compression = EBeamRecordingCompression::None;
+	int32 RowsPerGroup;
+	uint32 RowsInGroup = 0;
+	int64 NumRows = 0;
+	bool bFinished = false;
+};
+
+/**
+ * Reads the schema and row-group directory of a .beamcol file.
+ * The reader holds no file handle, so any number of threads can read chunks
+ * concurrently, each through its own archive.
+ */
+class FBeamColumnarReader
+{
+public:
+	/** Reads the trailer and footer; false if the file is missing or not a .beamcol */
+	bool Open(const FString& InFilePath);
+
+	const FString& GetFilePath() const { return FilePath; }
+	const TArray<FBeamColumnDesc>& GetColumns() const { return Columns; }
+	const TArray<FBeamColumnRowGroup>& GetRowGroups() const { return RowGroups; }
+	const TArray<uint8>& GetFooterExtension() const { return FooterExtension; }
+
+	/** Schema index of a column, INDEX_NONE if absent */
+	int32 FindColumn(const TCHAR* Name) const;
+
+	/** Opens a reader archive on the file; one per thread */
+	TUniquePtr<FArchive> OpenArchive() const;
+
+	/** Reads and inflates one chunk into its raw little-endian values */
+	bool ReadChunk(FArchive& Archive, int32 RowGroup, int32 Column, TArray<uint8>& OutValues, TArray<uint8>& Scratch) const;
+
+	/** Reads one chunk and widens its values to double, appending to OutValues */
+	bool ReadChunkAsDouble(FArchive& Archive, int32 RowGroup, int32 Column, TArray<double>& OutValues, TArray<uint8>& Scratch) const;
+
+private:
+	FString FilePath;
+	TArray<FBeamColumnDesc> Columns;
+	TArray<FBeamColumnRowGroup> RowGroups;
+	TArray<uint8> FooterExtension;
+};
+
+/** Element size in bytes of a column type */
+int32 BeamColumnTypeSize(EBeamColumnType Type);
+
+namespace BeamExport
+{
+	/** ".beamcol" selects the columnar format, anything else CSV */
+	EBeamExportFormat FormatFromPath(const FString& FilePath);
+
+	/**
+	 * Runs Task on the thread pool and logs its outcome; the caller moves all data the task needs into it.
+	 * OnFinished, when set, receives the outcome on the game thread.
+	 */
+	void Launch(const FString& Description, const FString& FilePath, TUniqueFunction<bool()> Task, TUniqueFunction<void(bool)> OnFinished = nullptr);
+
+	/** Blocks until every launched export has finished; called at module shutdown */
+	void WaitForPendingExports();
+
+	/** Streams frames pulled from NextFrame, until it returns false, into FilePath in Format */
+	bool WriteFrames(const FString& FilePath, EBeamExportFormat Format, TFunctionRef<bool(FBeamFrame&)> NextFrame);
+}
+
+/*=============================================================================
+    End of BeamExport.h
+=============================================================================*/
@@ -10,17 +10,21 @@
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "BeamLogging.h"
+#include "BeamBlueprintAccess.h"
 
-UBeamEyeTrackerSubsystem* UBeamEyeTrackerBlueprintLibrary::GetBeamEyeTrackerSubsystem(const UObject* WorldContextObject)
+namespace
 {
-	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	/** Latest frame in the subsystem's per-engine-frame cache; Blueprint graphs run on the game thread */
+	const FBeamFrame* PeekLatestFrame(const UObject* WorldContextObject)
 	{
-		if (UGameInstance* GameInstance = World->GetGameInstance())
-		{
-			return GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>();
-		}
+		const UBeamEyeTrackerSubsystem* Subsystem = BeamBlueprintAccess::FindSubsystem(WorldContextObject);
+		return Subsystem && IsInGameThread() ? Subsystem->PeekCurrentFrame() : nullptr;
 	}
-	return nullptr;
+}
+
+UBeamEyeTrackerSubsystem* UBeamEyeTrackerBlueprintLibrary::GetBeamEyeTrackerSubsystem(const UObject* WorldContextObject)
+{
+	return BeamBlueprintAccess::FindSubsystem(WorldContextObject);
 }
 
 bool UBeamEyeTrackerBlueprintLibrary::IsBeamEyeTrackingAvailable(const UObject* WorldContextObject)
@@ -298,9 +302,9 @@ FVector UBeamEyeTrackerBlueprintLibrary::ProjectGazeToWorld(const UObject* World
 			
 			if (APlayerController* PC = World->GetFirstPlayerController())
 			{
-				// Project screen position to world using player controller
+				// Project screen position through the subsystem's cached view for this player
 				FVector WorldLocation, WorldDirection;
-				if (PC->DeprojectScreenPositionToWorld(ScreenPosition.X, ScreenPosition.Y, WorldLocation, WorldDirection))
+				if (Subsystem->DeprojectScreenPosition(PC, ScreenPosition, WorldLocation, WorldDirection))
 				{
 					// Return the world position at the specified distance
 					return WorldLocation + (WorldDirection * Distance);
@@ -362,13 +366,23 @@ bool UBeamEyeTrackerBlueprintLibrary::IsCameraConnected(const UObject* WorldCont
 }
 
 FBeamFrame UBeamEyeTrackerBlueprintLibrary::GetLatestRawFrame(const UObject* WorldContextObject)
+{
+	// Copied once into the return value rather than through an intermediate frame
+	if (const FBeamFrame* Frame = PeekLatestFrame(WorldContextObject))
+	{
+		return *Frame;
+	}
+	return FBeamFrame();
+}
+
+FBeamFrame UBeamEyeTrackerBlueprintLibrary::GetRawFrameAtTime(const UObject* WorldContextObject, float TimeSeconds)
 {
 	UBeamEyeTrackerSubsystem* Subsystem = GetBeamEyeTrackerSubsystem(WorldContextObject);
 	if (Subsystem)
 	{
 		
 		FBeamFrame Frame;
-		if (Subsystem->FetchCurrentFrame(Frame))
+		if (Subsystem->GetFrameAt(TimeSeconds * 1000.0, Frame))
 		{
 			return Frame;
 		}
@@ -376,19 +390,50 @@ FBeamFrame UBeamEyeTrackerBlueprintLibrary::GetLatestRawFrame(const UObject* Wor
 	return FBeamFrame();
 }
 
-FBeamFrame UBeamEyeTrackerBlueprintLibrary::GetRawFrameAtTime(const UObject* WorldContextObject, float TimeSeconds)
+FVector2D UBeamEyeTrackerBlueprintLibrary::GetLatestGazeScreen01(const UObject* WorldContextObject, bool& bValid)
 {
+	const FBeamFrame* Frame = PeekLatestFrame(WorldContextObject);
+	bValid = Frame && Frame->Gaze.bValid;
+	return Frame ? Frame->Gaze.Screen01 : FVector2D::ZeroVector;
+}
+
+FVector2D UBeamEyeTrackerBlueprintLibrary::GetLatestGazeVelocity(const UObject* WorldContextObject)
+{
+	const FBeamFrame* Frame = PeekLatestFrame(WorldContextObject);
+	return Frame && Frame->bHasVelocity ? Frame->GazeVelocity01 : FVector2D::ZeroVector;
+}
+
+FVector UBeamEyeTrackerBlueprintLibrary::GetLatestHeadPositionCm(const UObject* WorldContextObject)
+{
+	const FBeamFrame* Frame = PeekLatestFrame(WorldContextObject);
+	return Frame ? Frame->Head.PositionCm : FVector::ZeroVector;
+}
+
+FRotator UBeamEyeTrackerBlueprintLibrary::GetLatestHeadRotation(const UObject* WorldContextObject)
+{
+	const FBeamFrame* Frame = PeekLatestFrame(WorldContextObject);
+	return Frame ? Frame->Head.Rotation : FRotator::ZeroRotator;
+}
+
+int64 UBeamEyeTrackerBlueprintLibrary::GetLatestFrameId(const UObject* WorldContextObject)
+{
+	const FBeamFrame* Frame = PeekLatestFrame(WorldContextObject);
+	return Frame ? Frame->FrameId : -1;
+}
+
+FVector2D UBeamEyeTrackerBlueprintLibrary::GetGazeScreen01AtTime(const UObject* WorldContextObject, float TimeSeconds, bool& bValid)
+{
+	bValid = false;
 	UBeamEyeTrackerSubsystem* Subsystem = GetBeamEyeTrackerSubsystem(WorldContextObject);
 	if (Subsystem)
 	{
-		
 		FBeamFrame Frame;
 		if (Subsystem->GetFrameAt(TimeSeconds * 1000.0, Frame))
 		{
-			return Frame;
+			bValid = Frame.Gaze.bValid;
+			return Frame.Gaze.Screen01;
 		}
 	}
-	return FBeamFrame();
+	return FVector2D::ZeroVector;
 }
 
-
@@ -0,0 +1,133 @@
+// Implements the IEyeTracker adapter that serves engine eye tracking queries from the frame ring
+
+#include "BeamEyeTrackerBridge.h"
+
+#if BEAM_FEATURE_EYETRACKER_BRIDGE
+
+#include "BeamEyeTrackerSettings.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamLogging.h"
+#include "BeamRing.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "Features/IModularFeatures.h"
+#include "GameFramework/PlayerController.h"
+
+namespace
+{
+	TUniquePtr<FBeamEyeTrackerBridgeModule> GBeamEyeTrackerBridge;
+}
+
+void FBeamEyeTracker::SetEyeTrackedPlayer(APlayerController* PlayerController)
+{
+	TrackedPlayer = PlayerController;
+}
+
+APlayerController* FBeamEyeTracker::ResolvePlayer() const
+{
+	if (APlayerController* PlayerController = TrackedPlayer.Get())
+	{
+		return PlayerController;
+	}
+
+	UWorld* World = GEngine && GEngine->GameViewport ? GEngine->GameViewport->GetWorld() : nullptr;
+	return World ? GEngine->GetFirstLocalPlayerController(World) : nullptr;
+}
+
+UBeamEyeTrackerSubsystem* FBeamEyeTracker::ResolveSubsystem(const APlayerController* PlayerController) const
+{
+	UGameInstance* GameInstance = PlayerController ? PlayerController->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+}
+
+bool FBeamEyeTracker::GetEyeTrackerGazeData(FEyeTrackerGazeData& OutGazeData) const
+{
+	APlayerController* PlayerController = ResolvePlayer();
+	UBeamEyeTrackerSubsystem* Subsystem = ResolveSubsystem(PlayerController);
+	const FBeamFrameRing* Ring = Subsystem ? Subsystem->GetFrameRing() : nullptr;
+
+	FBeamFrame Frame;
+	if (!Ring || !Ring->ReadLatest(Frame) || !Frame.Gaze.bValid)
+	{
+		return false;
+	}
+
+	int32 ViewportX = 0;
+	int32 ViewportY = 0;
+	PlayerController->GetViewportSize(ViewportX, ViewportY);
+	if (ViewportX <= 0 || ViewportY <= 0)
+	{
+		return false;
+	}
+
+	FVector Origin;
+	FVector Direction;
+	if (!Subsystem->DeprojectScreenPosition(PlayerController, Frame.Gaze.Screen01 * FVector2D(ViewportX, ViewportY), Origin, Direction))
+	{
+		return false;
+	}
+
+	OutGazeData.GazeOrigin = Origin;
+	OutGazeData.GazeDirection = Direction;
+	OutGazeData.FixationPoint = FVector::ZeroVector; // A screen-space tracker has no vergence depth
+	OutGazeData.ConfidenceValue = static_cast<float>(Frame.Gaze.Confidence);
+	OutGazeData.bIsLeftEyeBlink = false;
+	OutGazeData.bIsRightEyeBlink = false;
+	return true;
+}
+
+bool FBeamEyeTracker::GetEyeTrackerStereoGazeData(FEyeTrackerStereoGazeData& OutGazeData) const
+{
+	return false;
+}
+
+EEyeTrackerStatus FBeamEyeTracker::GetEyeTrackerStatus() const
+{
+	UBeamEyeTrackerSubsystem* Subsystem = ResolveSubsystem(ResolvePlayer());
+	if (!Subsystem || !Subsystem->IsBeamTracking())
+	{
+		return EEyeTrackerStatus::NotConnected;
+	}
+
+	const FBeamFrameRing* Ring = Subsystem->GetFrameRing();
+	FBeamFrame Frame;
+	return Ring && Ring->ReadLatest(Frame) && Frame.Gaze.bValid ? EEyeTrackerStatus::Tracking : EEyeTrackerStatus::NotTracking;
+}
+
+void FBeamEyeTrackerBridgeModule::Register()
+{
+	const UBeamEyeTrackerSettings* Settings = GetDefault<UBeamEyeTrackerSettings>();
+	if (GBeamEyeTrackerBridge || !Settings || !Settings->bRegisterEyeTrackerBridge)
+	{
+		return;
+	}
+
+	GBeamEyeTrackerBridge = MakeUnique<FBeamEyeTrackerBridgeModule>();
+	IModularFeatures::Get().RegisterModularFeature(IEyeTrackerModule::GetModularFeatureName(), GBeamEyeTrackerBridge.Get());
+	UE_LOG(LogBeam, Log, TEXT("Registered Beam as an engine eye tracker"));
+}
+
+void FBeamEyeTrackerBridgeModule::Unregister()
+{
+	if (GBeamEyeTrackerBridge)
+	{
+		IModularFeatures::Get().UnregisterModularFeature(IEyeTrackerModule::GetModularFeatureName(), GBeamEyeTrackerBridge.Get());
+		GBeamEyeTrackerBridge.Reset();
+	}
+}
+
+bool FBeamEyeTrackerBridgeModule::IsEyeTrackerConnected() const
+{
+	// The engine asks once at startup, before any game instance exists; the tracker resolves the
+	// subsystem lazily and reports NotConnected through its status until tracking starts
+	return true;
+}
+
+TSharedPtr<IEyeTracker, ESPMode::ThreadSafe> FBeamEyeTrackerBridgeModule::CreateEyeTracker()
+{
+	return MakeShared<FBeamEyeTracker, ESPMode::ThreadSafe>();
+}
+
+#endif // BEAM_FEATURE_EYETRACKER_BRIDGE
@@ -0,0 +1,65 @@
+/*=============================================================================
+    BeamEyeTrackerBridge.h: Engine IEyeTracker adapter for Beam.
+
+    Registers Beam as an IEyeTrackerModule so GEngine->EyeTrackingDevice
+    and UEyeTrackerFunctionLibrary report Beam gaze. Reads come straight
+    from the subsystem's frame ring; nothing is pushed per tick.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamFeatures.h"
+
+#if BEAM_FEATURE_EYETRACKER_BRIDGE
+
+#include "IEyeTracker.h"
+#include "IEyeTrackerModule.h"
+
+class APlayerController;
+class UBeamEyeTrackerSubsystem;
+
+/** IEyeTracker over the frame ring; gaze rays are deprojected through the tracked player's view */
+class FBeamEyeTracker : public IEyeTracker
+{
+public:
+	//~ Begin IEyeTracker Interface
+	virtual void SetEyeTrackedPlayer(APlayerController* PlayerController) override;
+	virtual bool GetEyeTrackerGazeData(FEyeTrackerGazeData& OutGazeData) const override;
+	virtual bool GetEyeTrackerStereoGazeData(FEyeTrackerStereoGazeData& OutGazeData) const override;
+	virtual EEyeTrackerStatus GetEyeTrackerStatus() const override;
+	virtual bool IsStereoGazeDataAvailable() const override { return false; }
+	//~ End IEyeTracker Interface
+
+private:
+	/** Explicitly tracked player, or the first local player when none was set */
+	APlayerController* ResolvePlayer() const;
+	UBeamEyeTrackerSubsystem* ResolveSubsystem(const APlayerController* PlayerController) const;
+
+	TWeakObjectPtr<APlayerController> TrackedPlayer;
+};
+
+/** Modular feature the engine enumerates when it creates its eye tracking device */
+class FBeamEyeTrackerBridgeModule : public IEyeTrackerModule
+{
+public:
+	/** Registers the feature when UBeamEyeTrackerSettings::bRegisterEyeTrackerBridge is set */
+	static void Register();
+	static void Unregister();
+
+	//~ Begin IEyeTrackerModule Interface
+	virtual FString GetModuleKeyName() const override { return TEXT("BeamEyeTracker"); }
+	virtual bool IsEyeTrackerConnected() const override;
+	virtual TSharedPtr<IEyeTracker, ESPMode::ThreadSafe> CreateEyeTracker() override;
+	//~ End IEyeTrackerModule Interface
+};
+
+#endif // BEAM_FEATURE_EYETRACKER_BRIDGE
+
+/*=============================================================================
+    End of BeamEyeTrackerBridge.h
+=============================================================================*/
@@ -14,19 +14,20 @@
 #include "BeamEyeTrackerTypes.h"
 #include "BeamEyeTrackerSettings.h"
 #include "BeamFilters.h"
+#include "BeamPipeline.h"
 #include "BeamLogging.h"
 #include "BeamDebugCVars.h"
+#include "BeamGazeTraceSubsystem.h"
+#include "BeamSimCameraModifier.h"
 #include "Engine/Engine.h"
 
 // Performance optimization flags
-#define BEAM_COMPONENT_USE_SIMD 1
 #define BEAM_COMPONENT_USE_BATCH_PROCESSING 1
-#define BEAM_COMPONENT_USE_FAST_MATH 1
-#define BEAM_COMPONENT_USE_LOOP_UNROLLING 1
 
 #include "BeamLogging.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
+#include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/PlayerCameraManager.h"
 #include "Camera/CameraComponent.h"
@@ -35,10 +36,6 @@
 #include "HAL/PlatformMath.h"
 #include "Misc/App.h"
 
-#if BEAM_COMPONENT_USE_SIMD && PLATFORM_ENABLE_VECTORINTRINSICS
-#include <immintrin.h>
-#endif
-
 // Performance optimization constants
 static constexpr int32 MAX_BATCH_SIZE = 16;
 static constexpr float PERFORMANCE_UPDATE_INTERVAL = 0.1f; // 10 FPS updates
@@ -52,6 +49,14 @@ static constexpr float PERFORMANCE_UPDATE_INTERVAL = 0.1f; // 10 FPS updates
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "TimerManager.h"
+#include "UnrealClient.h"
+#include "Engine/GameViewportClient.h"
+#include "BeamStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("EyeTracker Component Tick"), STAT_BeamComponentTick, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("EyeTracker Component Frame Update"), STAT_BeamComponentFrameUpdate, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("EyeTracker Component Batch Gating"), STAT_BeamComponentBatchGating, STATGROUP_Beam);
 
 // Performance optimization constants
 static constexpr int32 PROFILING_SAMPLE_WINDOW = 1000; // 1000 frames for profiling
@@ -71,6 +76,7 @@ UBeamEyeTrackerComponent::UBeamEyeTrackerComponent()
 	PerformanceMetrics.PeakProcessingTime = 0.0f;
 
 	BatchFrameBuffer.Reserve(MAX_BATCH_SIZE);
+	BatchColumns.SetNum(MAX_BATCH_SIZE + 4);
 }
 
 void UBeamEyeTrackerComponent::BeginPlay()
@@ -122,6 +128,18 @@ void UBeamEyeTrackerComponent::BeginPlay()
 
 	InitializeFiltersAndBuffers();
 
+	if (bEnableFoveatedRendering && Subsystem)
+	{
+		Subsystem->AddFoveationUser();
+		bRegisteredFoveationUser = true;
+	}
+
+	if (bEnableAdaptivePolling && Subsystem)
+	{
+		Subsystem->AddAdaptivePollingUser();
+		bRegisteredAdaptivePollingUser = true;
+	}
+
 	UpdateComponentSettings();
 }
 
@@ -135,11 +153,33 @@ void UBeamEyeTrackerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		DisableDebugHUD();
 	}
 
+	if (bRegisteredFoveationUser && Subsystem)
+	{
+		Subsystem->RemoveFoveationUser();
+	}
+	bRegisteredFoveationUser = false;
+
+	if (bRegisteredAdaptivePollingUser && Subsystem)
+	{
+		Subsystem->RemoveAdaptivePollingUser();
+	}
+	bRegisteredAdaptivePollingUser = false;
+
+	if (FrameChangeHandle.IsValid() && Subsystem)
+	{
+		Subsystem->UnsubscribeFromFrameChanges(FrameChangeHandle);
+	}
+	FrameChangeHandle.Reset();
+
+	ApplyUpdateMode(/*bEndingPlay=*/ true);
+	ApplySimCameraModifier(/*bEndingPlay=*/ true);
+
 	Subsystem = nullptr;
 }
 
 void UBeamEyeTrackerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	SCOPE_CYCLE_COUNTER(STAT_BeamComponentTick);
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	if (bProjectFromOwnerCamera)
@@ -147,17 +187,74 @@ void UBeamEyeTrackerComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 		UpdateViewportGeometry();
 	}
 
-	// Periodically check for viewport changes (every 5 seconds)
-	static float ViewportCheckTimer = 0.0f;
-	ViewportCheckTimer += DeltaTime;
-	if (ViewportCheckTimer >= 5.0f)
+	UpdateFromLatestFrame(DeltaTime);
+}
+
+void UBeamEyeTrackerComponent::ApplyUpdateMode(bool bEndingPlay)
+{
+	UWorld* World = GetWorld();
+	const bool bBind = !bEndingPlay && bEventDriven && Subsystem && HasBegunPlay();
+
+	if (bBind && !NewFrameHandle.IsValid())
+	{
+		SetComponentTickEnabled(false);
+		LastUpdateSeconds = FPlatformTime::Seconds();
+		LastProcessedFrameId = -1;
+		NewFrameHandle = Subsystem->AddNewFrameListener(FSimpleDelegate::CreateUObject(this, &UBeamEyeTrackerComponent::HandleNewFrame));
+		ViewportResizedHandle = FViewport::ViewportResizedEvent.AddUObject(this, &UBeamEyeTrackerComponent::HandleViewportResized);
+
+		// Health can change after frames stop arriving, when no new-frame event will come
+		if (World)
+		{
+			World->GetTimerManager().SetTimer(HealthCheckTimerHandle, FTimerDelegate::CreateUObject(this, &UBeamEyeTrackerComponent::BroadcastHealthChangeIfNeeded), 1.0f, true);
+		}
+	}
+	else if (!bBind && NewFrameHandle.IsValid())
 	{
-		ViewportCheckTimer = 0.0f;
 		if (Subsystem)
 		{
-			Subsystem->AutoUpdateViewport();
+			Subsystem->RemoveNewFrameListener(NewFrameHandle);
 		}
+		NewFrameHandle.Reset();
+		FViewport::ViewportResizedEvent.Remove(ViewportResizedHandle);
+		ViewportResizedHandle.Reset();
+		if (World)
+		{
+			World->GetTimerManager().ClearTimer(HealthCheckTimerHandle);
+		}
+		if (!bEndingPlay)
+		{
+			SetComponentTickEnabled(true);
+		}
+	}
+}
+
+void UBeamEyeTrackerComponent::HandleNewFrame()
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	const float DeltaTime = static_cast<float>(NowSeconds - LastUpdateSeconds);
+	LastUpdateSeconds = NowSeconds;
+	UpdateFromLatestFrame(DeltaTime);
+}
+
+void UBeamEyeTrackerComponent::HandleViewportResized(FViewport* Viewport, uint32 Unused)
+{
+	UWorld* World = GetWorld();
+	UGameViewportClient* ViewportClient = World ? World->GetGameViewport() : nullptr;
+	if (!Subsystem || !ViewportClient || ViewportClient->Viewport != Viewport)
+	{
+		return;
+	}
+
+	if (bProjectFromOwnerCamera)
+	{
+		UpdateViewportGeometry();
 	}
+}
+
+void UBeamEyeTrackerComponent::UpdateFromLatestFrame(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamComponentFrameUpdate);
 
 	if (bEnableDebugHUD)
 	{
@@ -171,48 +268,55 @@ void UBeamEyeTrackerComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 		
 		// Cache the latest frame to avoid multiple subsystem calls
 		FBeamFrame LatestFrame;
-		if (Subsystem->FetchCurrentFrame(LatestFrame))
+		const bool bFetched = Subsystem->FetchCurrentFrame(LatestFrame);
+
+		// Coalesced wake-ups and fast ticks can see a frame already handled; it is still the one being served
+		const bool bAlreadyProcessed = bFetched && bHasValidCachedFrame && LatestFrame.FrameId == LastProcessedFrameId;
+
+		if (bFetched && !bAlreadyProcessed)
 		{
-			// Store previous values for change detection - used in filtering algorithms
-			PreviousGazePoint = LatestFrame.Gaze;
-			PreviousHeadPose = LatestFrame.Head;
+			// Taken before gating moves the previous raw sample on
+			FBeamPipelineContext PipelineContext = MakePipelineContext();
 
 #if BEAM_COMPONENT_USE_BATCH_PROCESSING
-			// Batch processing for performance optimization
+			// Every sample published since the last update, oldest first, gated together; the chain only smooths
+			DrainNewFrames(LatestFrame);
+			ProcessBatchFrames();
+			SelectBeamPipeline(GetEnabledPipelineStages() & EBeamPipelineStages::Smoothing)(BatchFrameBuffer, PipelineContext);
+#else
+			BatchFrameBuffer.Reset();
 			BatchFrameBuffer.Add(LatestFrame);
-			
-			// Process batch when buffer is full or on specific intervals
-			if (BatchFrameBuffer.Num() >= MAX_BATCH_SIZE)
-			{
-				ProcessBatchFrames();
-				BatchFrameBuffer.Empty();
-			}
+			SelectBeamPipeline(GetEnabledPipelineStages())(BatchFrameBuffer, PipelineContext);
+			PreviousGazePoint = PipelineContext.PreviousGaze;
+			PreviousHeadPose = PipelineContext.PreviousHead;
+			AcceptedGazePoint = PipelineContext.AcceptedGaze;
+			AcceptedHeadPose = PipelineContext.AcceptedHead;
 #endif
 
-			// Apply data quality filtering - removes low-confidence data
-			ApplyDataQualityFiltering(LatestFrame);
-
-			// Apply outlier detection - removes anomalous data points
-			ApplyOutlierDetection(LatestFrame);
-
-			// Apply adaptive smoothing - reduces jitter while preserving responsiveness
-			ApplyAdaptiveSmoothing(LatestFrame);
-
-			// Store filtered frame in component buffer - local data storage
-			if (ComponentFrameBuffer)
+			for (const FBeamFrame& Frame : BatchFrameBuffer)
 			{
-				ComponentFrameBuffer->Publish(LatestFrame);
+				// Store filtered frame in component buffer - local data storage, quantized to 48 bytes a frame
+				if (ComponentFrameBuffer)
+				{
+					ComponentFrameBuffer->Publish(FBeamFrameCompact::FromFrame(Frame));
+				}
+				else if (LargeComponentFrameBuffer)
+				{
+					LargeComponentFrameBuffer->Publish(FBeamFrameCompact::FromFrame(Frame));
+				}
 			}
 
 			// Cache the processed frame for this tick
-			CachedFrame = LatestFrame;
+			CachedFrame = BatchFrameBuffer.Last();
 			bHasValidCachedFrame = true;
+			LastProcessedFrameId = LatestFrame.FrameId;
+			LastProcessedTimestampMs = LatestFrame.SDKTimestampMs;
 
 			const double ProcessingEndTime = FPlatformTime::Seconds();
 			const double ProcessingTime = (ProcessingEndTime - ProcessingStartTime) * 1000.0; // Convert to ms
 			UpdateProcessingMetrics(ProcessingTime);
 		}
-		else
+		else if (!bFetched)
 		{
 			// No new frame available, use cached data if available
 			bHasValidCachedFrame = false;
@@ -290,26 +394,18 @@ bool UBeamEyeTrackerComponent::GetGazeWorldRay(FVector& OutOrigin, FVector& OutD
 		return false;
 	}
 
+	// The origin stays at the camera; the direction comes from the subsystem's per-frame view
 	APlayerController* PC = GetWorld()->GetFirstPlayerController();
-	if (!PC)
+	FVector WorldLocation, WorldDirection;
+	if (!PC || !DeprojectGazeToWorld(GazePoint, WorldLocation, WorldDirection))
 	{
 		return false;
 	}
 
-	FVector CameraLocation;
 	FRotator CameraRotation;
-	PC->GetPlayerViewPoint(CameraLocation, CameraRotation);
-	
-	// Convert screen coordinates to world ray
-	FVector WorldLocation, WorldDirection;
-	if (PC->DeprojectScreenPositionToWorld(GazePoint.ScreenPx.X, GazePoint.ScreenPx.Y, WorldLocation, WorldDirection))
-	{
-		OutOrigin = CameraLocation;
-		OutDirection = WorldDirection;
-		return true;
-	}
-	
-	return false;
+	PC->GetPlayerViewPoint(OutOrigin, CameraRotation);
+	OutDirection = WorldDirection;
+	return true;
 }
 
 bool UBeamEyeTrackerComponent::IsTrackingActive() const
@@ -420,8 +516,9 @@ void UBeamEyeTrackerComponent::UpdateDebugHUD()
 		FBeamDebugCVars::CVarDrawTrail->Set(0, ECVF_SetByCode);
 	}
 
-	// Enable the master debug HUD toggle
+	// Enable the master debug HUD toggle and the overlay that draws the elements above
 	FBeamDebugCVars::CVarDebugHUD->Set(1, ECVF_SetByCode);
+	FBeamDebugCVars::CVarDebugOverlay->Set(1, ECVF_SetByCode);
 #else
 	// Debug HUD not available in shipping builds
 			UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Debug HUD requested but not available in this build configuration"));
@@ -439,6 +536,7 @@ void UBeamEyeTrackerComponent::DisableDebugHUD()
 	
 	// Disable the master debug HUD toggle
 	FBeamDebugCVars::CVarDebugHUD->Set(0, ECVF_SetByCode);
+	FBeamDebugCVars::CVarDebugOverlay->Set(0, ECVF_SetByCode);
 #else
 	// Debug HUD not available in shipping builds
 			UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Debug HUD disable requested but not available in this build configuration"));
@@ -542,7 +640,11 @@ float UBeamEyeTrackerComponent::GetBufferUtilization() const
 {
 	if (ComponentFrameBuffer)
 	{
-		return static_cast<float>(ComponentFrameBuffer->GetCount()) / static_cast<float>(ComponentFrameBuffer->GetSize());
+		return static_cast<float>(ComponentFrameBuffer->GetNum()) / static_cast<float>(FBeamComponentFrameRing::GetMaxSize());
+	}
+	if (LargeComponentFrameBuffer)
+	{
+		return static_cast<float>(LargeComponentFrameBuffer->GetNum()) / static_cast<float>(FBeamCompactFrameRing::GetMaxSize());
 	}
 	return 0.0f;
 }
@@ -581,138 +683,146 @@ void UBeamEyeTrackerComponent::UpdateComponentSettings()
 		HeadParams.MinCutoff = 1.0;
 		HeadPoseFilter->UpdateParams(HeadParams);
 	}
+
+	UpdateChangeSubscription();
+	ApplyUpdateMode();
+	ApplySimCameraModifier();
 }
 
-void UBeamEyeTrackerComponent::ApplyDataQualityFiltering(FBeamFrame& Frame)
+void UBeamEyeTrackerComponent::ApplySimCameraModifier(bool bEndingPlay)
 {
-	if (!bEnableDataValidation)
+	const bool bWanted = !bEndingPlay && bEnableSimGameCamera && HasBegunPlay();
+	UBeamSimCameraModifier* Modifier = SimCameraModifier.Get();
+
+	if (!bWanted)
 	{
+		if (Modifier && Modifier->CameraOwner)
+		{
+			Modifier->CameraOwner->RemoveCameraModifier(Modifier);
+		}
+		SimCameraModifier.Reset();
 		return;
 	}
 
-	// Check gaze confidence
-	if (Frame.Gaze.Confidence < MinGazeConfidence)
+	if (!Modifier)
 	{
-		Frame.Gaze.bValid = false;
-	}
+		// Works on a possessed pawn as well as on a player controller
+		APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+		if (!PlayerController)
+		{
+			const APawn* Pawn = Cast<APawn>(GetOwner());
+			PlayerController = Pawn ? Pawn->GetController<APlayerController>() : nullptr;
+		}
+		if (!PlayerController || !PlayerController->PlayerCameraManager)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Sim game camera needs an owner controlled by a local player"));
+			return;
+		}
 
-	// Check head pose confidence
-	if (Frame.Head.Confidence < MinHeadPoseConfidence)
-	{
-		Frame.Head.PositionCm = FVector::ZeroVector;
-		Frame.Head.Rotation = FRotator::ZeroRotator;
+		Modifier = Cast<UBeamSimCameraModifier>(PlayerController->PlayerCameraManager->AddNewCameraModifier(UBeamSimCameraModifier::StaticClass()));
+		SimCameraModifier = Modifier;
 	}
 
-	// Check data age
-	const double CurrentTime = FPlatformTime::Seconds();
-	if (Frame.SDKTimestampMs > 0)
+	if (Modifier)
 	{
-		const double DataAge = (CurrentTime * 1000.0) - Frame.SDKTimestampMs;
-		if (DataAge > (MaxGazeAgeSeconds * 1000.0))
-		{
-			Frame.Gaze.bValid = false;
-			Frame.Head.PositionCm = FVector::ZeroVector;
-			Frame.Head.Rotation = FRotator::ZeroRotator;
-		}
+		Modifier->Sensitivity = CameraSensitivity;
 	}
 }
 
-void UBeamEyeTrackerComponent::ApplyOutlierDetection(FBeamFrame& Frame)
+void UBeamEyeTrackerComponent::UpdateChangeSubscription()
 {
-	if (!bEnableOutlierDetection)
+	if (!Subsystem)
 	{
 		return;
 	}
 
-	// Simple outlier detection based on previous values
-	if (PreviousGazePoint.bValid && Frame.Gaze.bValid)
+	if (FrameChangeHandle.IsValid())
 	{
-		const FVector2D GazeDelta = Frame.Gaze.ScreenPx - PreviousGazePoint.ScreenPx;
-		const float GazeDistance = GazeDelta.Size();
-		
-		// If gaze moved too far, it might be an outlier
-		if (GazeDistance > (OutlierThreshold * 100.0f)) // Convert to pixels
-		{
-			Frame.Gaze.bValid = false;
-		}
+		Subsystem->UnsubscribeFromFrameChanges(FrameChangeHandle);
+		FrameChangeHandle.Reset();
 	}
 
-	if (PreviousHeadPose.PositionCm != FVector::ZeroVector && Frame.Head.PositionCm != FVector::ZeroVector)
+	if (!bEnableGazeChangeNotifications && !bEnableHeadPoseChangeNotifications)
 	{
-		const FVector HeadDelta = Frame.Head.PositionCm - PreviousHeadPose.PositionCm;
-		const float HeadDistance = HeadDelta.Size();
-		
-		// If head moved too far, it might be an outlier
-		if (HeadDistance > (OutlierThreshold * 50.0f)) // Convert to cm
-		{
-			Frame.Head.PositionCm = PreviousHeadPose.PositionCm;
-			Frame.Head.Rotation = PreviousHeadPose.Rotation;
-		}
+		return;
 	}
+
+	// The subsystem fetches once per tick for every component; components with equal settings share one evaluation
+	FBeamChangeThresholds Thresholds;
+	Thresholds.GazePixels = bEnableGazeChangeNotifications ? static_cast<float>(GazeChangeThresholdPixels) : 0.0f;
+	Thresholds.HeadDegrees = bEnableHeadPoseChangeNotifications ? HeadPoseChangeThresholdDegrees : 0.0f;
+	Thresholds.MaxRateHz = MaxNotificationRateHz;
+
+	FrameChangeHandle = Subsystem->SubscribeToFrameChanges(Thresholds,
+		FOnBeamFrameChangedNative::FDelegate::CreateUObject(this, &UBeamEyeTrackerComponent::HandleFrameChanged));
 }
 
-void UBeamEyeTrackerComponent::ApplyAdaptiveSmoothing(FBeamFrame& Frame)
+void UBeamEyeTrackerComponent::HandleFrameChanged(const FBeamFrame& Frame, bool bGazeChanged, bool bHeadChanged)
 {
-	if (!bEnableAdaptiveSmoothing || !GazeFilter || !HeadPoseFilter)
-	{
-		return;
-	}
-
-	// Apply adaptive smoothing based on confidence
-	if (Frame.Gaze.bValid)
+	if (bGazeChanged)
 	{
-		const float SmoothingMultiplier = Frame.Gaze.Confidence < 0.7f ? LowConfidenceSmoothingMultiplier : 1.0f;
-		const FVector2D SmoothedGaze = GazeFilter->Filter(Frame.Gaze.ScreenPx, Frame.DeltaTimeSeconds * SmoothingMultiplier);
-		Frame.Gaze.ScreenPx = SmoothedGaze;
+		OnGazeUpdated.Broadcast(Frame.Gaze);
 	}
-
-	if (Frame.Head.Confidence > 0.5f)
+	if (bHeadChanged)
 	{
-		const float SmoothingMultiplier = Frame.Head.Confidence < 0.7f ? LowConfidenceSmoothingMultiplier : 1.0f;
-		// Apply smoothing to head pose (simplified)
-		Frame.Head.PositionCm = FMath::Lerp(PreviousHeadPose.PositionCm, Frame.Head.PositionCm, 1.0f / SmoothingMultiplier);
+		OnHeadPoseUpdated.Broadcast(Frame.Head);
 	}
 }
 
-bool UBeamEyeTrackerComponent::MeetsQualityThresholds(const FBeamFrame& Frame) const
+FBeamPipelineContext UBeamEyeTrackerComponent::MakePipelineContext() const
 {
-	if (!bEnableDataValidation)
-	{
-		return true;
-	}
+	FBeamPipelineContext Context;
+	Context.MinGazeConfidence = MinGazeConfidence;
+	Context.MinHeadPoseConfidence = MinHeadPoseConfidence;
+	Context.MaxAgeSeconds = MaxGazeAgeSeconds;
+	Context.NowSeconds = FPlatformTime::Seconds();
+
+	// Thresholds in pixels and centimeters
+	const double GazeOutlierPx = OutlierThreshold * 100.0;
+	const double HeadOutlierCm = OutlierThreshold * 50.0;
+	Context.GazeOutlierPxSq = GazeOutlierPx * GazeOutlierPx;
+	Context.HeadOutlierCmSq = HeadOutlierCm * HeadOutlierCm;
+
+	Context.GazeFilter = GazeFilter.Get();
+	Context.LowConfidenceSmoothingMultiplier = LowConfidenceSmoothingMultiplier;
+
+	Context.PreviousGaze = PreviousGazePoint;
+	Context.PreviousHead = PreviousHeadPose;
+	Context.AcceptedGaze = AcceptedGazePoint;
+	Context.AcceptedHead = AcceptedHeadPose;
+	return Context;
+}
 
-	// Check gaze quality
-	if (Frame.Gaze.bValid && Frame.Gaze.Confidence < MinGazeConfidence)
+EBeamPipelineStages UBeamEyeTrackerComponent::GetEnabledPipelineStages() const
+{
+	EBeamPipelineStages Stages = EBeamPipelineStages::None;
+	if (bEnableDataValidation)
 	{
-		return false;
+		Stages |= EBeamPipelineStages::QualityGate;
 	}
-
-	// Check head pose quality
-	if (Frame.Head.Confidence < MinHeadPoseConfidence)
+	if (bEnableOutlierDetection)
 	{
-		return false;
+		Stages |= EBeamPipelineStages::OutlierRejection;
 	}
-
-	// Check data age
-	const double CurrentTime = FPlatformTime::Seconds();
-	if (Frame.SDKTimestampMs > 0)
+	if (bEnableAdaptiveSmoothing && GazeFilter && HeadPoseFilter)
 	{
-		const double DataAge = (CurrentTime * 1000.0) - Frame.SDKTimestampMs;
-		if (DataAge > (MaxGazeAgeSeconds * 1000.0))
-		{
-			return false;
-		}
+		Stages |= EBeamPipelineStages::Smoothing;
 	}
+	return Stages;
+}
 
-	return true;
+bool UBeamEyeTrackerComponent::MeetsQualityThresholds(const FBeamFrame& Frame) const
+{
+	return !bEnableDataValidation || FBeamQualityGateStage::Passes(Frame, MakePipelineContext());
 }
 
 void UBeamEyeTrackerComponent::UpdateBufferSize()
 {
-	if (!ComponentFrameBuffer || ComponentFrameBuffer->GetSize() != FrameBufferSize)
+	// Only rebuild when the setting crosses between the two ring instantiations
+	const bool bWantsSmallRing = GetBudgetedFrameBufferSize() <= FBeamComponentFrameRing::GetMaxSize();
+	if (bWantsSmallRing ? !ComponentFrameBuffer.IsValid() : !LargeComponentFrameBuffer.IsValid())
 	{
-
-		ComponentFrameBuffer = MakeUnique<FBeamFrameBuffer>(FrameBufferSize);
+		CreateComponentFrameBuffer();
 	}
 }
 
@@ -731,7 +841,27 @@ void UBeamEyeTrackerComponent::InitializeFiltersAndBuffers()
 	HeadParams.MinCutoff = 1.0;
 	HeadPoseFilter = MakeUnique<FOneEuroFilter>(HeadParams);
 
-	ComponentFrameBuffer = MakeUnique<FBeamFrameBuffer>(FrameBufferSize);
+	CreateComponentFrameBuffer();
+}
+
+int32 UBeamEyeTrackerComponent::GetBudgetedFrameBufferSize() const
+{
+	return FMath::Min(FrameBufferSize, GetDefault<UBeamEyeTrackerSettings>()->GetMemoryBudget().MaxComponentHistoryFrames);
+}
+
+void UBeamEyeTrackerComponent::CreateComponentFrameBuffer()
+{
+	ComponentFrameBuffer.Reset();
+	LargeComponentFrameBuffer.Reset();
+
+	if (GetBudgetedFrameBufferSize() <= FBeamComponentFrameRing::GetMaxSize())
+	{
+		ComponentFrameBuffer = MakeUnique<FBeamComponentFrameRing>();
+	}
+	else
+	{
+		LargeComponentFrameBuffer = MakeUnique<FBeamCompactFrameRing>();
+	}
 }
 
 void UBeamEyeTrackerComponent::BroadcastHealthChangeIfNeeded()
@@ -820,155 +950,172 @@ void UBeamEyeTrackerComponent::LogAdvancedPerformanceMetrics()
 // This class has been removed to simplify the component and fix compilation errors
 // It can be re-implemented later if advanced profiling is needed
 
-void UBeamEyeTrackerComponent::ProcessBatchFrames()
+void UBeamEyeTrackerComponent::FBatchColumns::SetNum(int32 NumSlots)
 {
-#if BEAM_COMPONENT_USE_SIMD && PLATFORM_ENABLE_VECTORINTRINSICS
-	if (PLATFORM_ENABLE_VECTORINTRINSICS && BatchFrameBuffer.Num() >= 4)
-	{
-		// SIMD-optimized batch processing for 4+ frames
-		ProcessBatchFramesSIMD();
-	}
-	else
-#endif
+	for (TArray<float>* Column : { &GazeX, &GazeY, &GazeValid, &GazeConfidence, &HeadX, &HeadY, &HeadZ, &HeadConfidence, &AgeSeconds })
 	{
-		// Standard batch processing
-		ProcessBatchFramesStandard();
+		Column->SetNumZeroed(NumSlots, EAllowShrinking::No);
 	}
+	const int32 NumGroups = NumSlots / 4;
+	GazeValidBits.SetNumUninitialized(NumGroups, EAllowShrinking::No);
+	HeadResetBits.SetNumUninitialized(NumGroups, EAllowShrinking::No);
+	GazeJumpBits.SetNumUninitialized(NumGroups, EAllowShrinking::No);
+	HeadJumpBits.SetNumUninitialized(NumGroups, EAllowShrinking::No);
 }
 
-void UBeamEyeTrackerComponent::ProcessBatchFramesStandard()
+void UBeamEyeTrackerComponent::FBatchColumns::Write(int32 Slot, const FGazePoint& Gaze, const FHeadPose& Head, float InAgeSeconds)
 {
-	// Standard batch processing with loop unrolling
-	const int32 NumFrames = BatchFrameBuffer.Num();
-	
-#if BEAM_COMPONENT_USE_LOOP_UNROLLING
-	// Loop unrolling for better performance
-	const int32 UnrollSize = 4;
-	const int32 UnrolledEnd = (NumFrames / UnrollSize) * UnrollSize;
-	
-	for (int32 i = 0; i < UnrolledEnd; i += UnrollSize)
-	{
-		// Process 4 frames at once
-		ProcessFrameOptimized(BatchFrameBuffer[i]);
-		ProcessFrameOptimized(BatchFrameBuffer[i + 1]);
-		ProcessFrameOptimized(BatchFrameBuffer[i + 2]);
-		ProcessFrameOptimized(BatchFrameBuffer[i + 3]);
-	}
-	
-	// Process remaining frames
-	for (int32 i = UnrolledEnd; i < NumFrames; ++i)
-	{
-		ProcessFrameOptimized(BatchFrameBuffer[i]);
-	}
-#else
-	// Standard loop processing
-	for (int32 i = 0; i < NumFrames; ++i)
-	{
-		ProcessFrameOptimized(BatchFrameBuffer[i]);
-	}
-#endif
+	GazeX[Slot] = static_cast<float>(Gaze.ScreenPx.X);
+	GazeY[Slot] = static_cast<float>(Gaze.ScreenPx.Y);
+	GazeValid[Slot] = Gaze.bValid ? 1.0f : 0.0f;
+	GazeConfidence[Slot] = static_cast<float>(Gaze.Confidence);
+	HeadX[Slot] = static_cast<float>(Head.PositionCm.X);
+	HeadY[Slot] = static_cast<float>(Head.PositionCm.Y);
+	HeadZ[Slot] = static_cast<float>(Head.PositionCm.Z);
+	HeadConfidence[Slot] = static_cast<float>(Head.Confidence);
+	AgeSeconds[Slot] = InAgeSeconds;
 }
 
-void UBeamEyeTrackerComponent::ProcessFrameOptimized(FBeamFrame& Frame)
+int32 UBeamEyeTrackerComponent::DrainNewFrames(const FBeamFrame& LatestFrame)
 {
-	// Optimized frame processing with minimal branching
-	if (Frame.Gaze.bValid)
+	BatchFrameBuffer.Reset();
+
+	// Samples between the last processed frame and LatestFrame only exist in the subsystem ring; a lower id means the source restarted
+	if (Subsystem && LastProcessedFrameId >= 0 && LatestFrame.FrameId > LastProcessedFrameId + 1)
 	{
-		// Apply quality filtering with fast math
-		if (Frame.Gaze.Confidence < MinGazeConfidence)
-		{
-			Frame.Gaze.bValid = false;
-		}
-		else
+		Subsystem->CopyFramesInRange(LastProcessedTimestampMs, LatestFrame.SDKTimestampMs, BatchFrameBuffer);
+		BatchFrameBuffer.RemoveAll([this, &LatestFrame](const FBeamFrame& Frame)
 		{
-			// Apply outlier detection with optimized distance calculation
-			if (PreviousGazePoint.bValid)
-			{
-				const FVector2D Delta = Frame.Gaze.ScreenPx - PreviousGazePoint.ScreenPx;
-#if BEAM_COMPONENT_USE_FAST_MATH
-				// Fast distance calculation using Manhattan distance approximation
-				const float Distance = FMath::Abs(Delta.X) + FMath::Abs(Delta.Y);
-#else
-				// Standard Euclidean distance
-				const float Distance = Delta.Size();
-#endif
-				
-				if (Distance > (OutlierThreshold * 100.0f))
-				{
-					Frame.Gaze.bValid = false;
-				}
-			}
-		}
-	}
-	
-	// Similar optimization for head pose data
-	if (Frame.Head.Confidence > 0.0f)
-	{
-		if (Frame.Head.Confidence < MinHeadPoseConfidence)
+			return Frame.FrameId <= LastProcessedFrameId || Frame.FrameId >= LatestFrame.FrameId;
+		});
+
+		// After a long hitch only the newest samples are worth filtering
+		if (BatchFrameBuffer.Num() >= MAX_BATCH_SIZE)
 		{
-			Frame.Head.PositionCm = FVector::ZeroVector;
-			Frame.Head.Rotation = FRotator::ZeroRotator;
+			BatchFrameBuffer.RemoveAt(0, BatchFrameBuffer.Num() - (MAX_BATCH_SIZE - 1), EAllowShrinking::No);
 		}
 	}
+
+	BatchFrameBuffer.Add(LatestFrame);
+	return BatchFrameBuffer.Num();
 }
 
-void UBeamEyeTrackerComponent::ProcessBatchFramesSIMD()
+void UBeamEyeTrackerComponent::ProcessBatchFrames()
 {
-#if BEAM_COMPONENT_USE_SIMD && PLATFORM_ENABLE_VECTORINTRINSICS
-	if (!PLATFORM_ENABLE_VECTORINTRINSICS)
-	{
-		ProcessBatchFramesStandard();
-		return;
-	}
-	
+	SCOPE_CYCLE_COUNTER(STAT_BeamComponentBatchGating);
+
 	const int32 NumFrames = BatchFrameBuffer.Num();
-	if (NumFrames < 4)
+	if (NumFrames == 0)
 	{
-		ProcessBatchFramesStandard();
 		return;
 	}
-	
-	// SIMD-optimized batch processing for gaze confidence validation
-	// Process 4 frames at once using 128-bit SIMD registers
-	const int32 SIMDSize = 4;
-	const int32 SIMDEnd = (NumFrames / SIMDSize) * SIMDSize;
-	
-	// Load confidence thresholds into SIMD register
-	__m128 ConfidenceThreshold = _mm_set1_ps(MinGazeConfidence);
-	__m128 OutlierThresholdVec = _mm_set1_ps(OutlierThreshold * 100.0f);
-	
-	for (int32 i = 0; i < SIMDEnd; i += SIMDSize)
-	{
-		// Load 4 gaze confidence values
-		__m128 GazeConfidences = _mm_set_ps(
-			BatchFrameBuffer[i + 3].Gaze.Confidence,
-			BatchFrameBuffer[i + 2].Gaze.Confidence,
-			BatchFrameBuffer[i + 1].Gaze.Confidence,
-			BatchFrameBuffer[i + 0].Gaze.Confidence
-		);
-		
-		// Compare confidence values with threshold
-		__m128 ConfidenceMask = _mm_cmpge_ps(GazeConfidences, ConfidenceThreshold);
-		
-		// Apply confidence filtering
-		
-		// to handle the boolean results and apply them to the frame data
-		
-		// Process individual frames for complex operations
-		for (int32 j = 0; j < SIMDSize; ++j)
+
+	// Lane i reads sample i from slot i + 1 and its predecessor from slot i; padding lanes are zero and never written back
+	const int32 NumLanes = Align(NumFrames, 4);
+	BatchColumns.SetNum(NumLanes + 4);
+	BatchColumns.Write(0, PreviousGazePoint, PreviousHeadPose, 0.0f);
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumFrames; ++Index)
+	{
+		const FBeamFrame& Frame = BatchFrameBuffer[Index];
+
+		// Capture time on the local clock; SDKTimestampMs is on the tracker's clock and not comparable
+		const float AgeSeconds = Frame.UETimestampSeconds > 0.0 ? static_cast<float>(NowSeconds - Frame.UETimestampSeconds) : 0.0f;
+		BatchColumns.Write(Index + 1, Frame.Gaze, Frame.Head, AgeSeconds);
+	}
+
+	// Disabled stages get thresholds every lane passes, so the passes stay branch-free
+	const float MaxFloat = TNumericLimits<float>::Max();
+	const float GazeOutlierPx = OutlierThreshold * 100.0f;
+	const float HeadOutlierCm = OutlierThreshold * 50.0f;
+	const VectorRegister4Float MinGazeConf = VectorSetFloat1(bEnableDataValidation ? MinGazeConfidence : -1.0f);
+	const VectorRegister4Float MinHeadConf = VectorSetFloat1(bEnableDataValidation ? MinHeadPoseConfidence : -1.0f);
+	const VectorRegister4Float MaxAge = VectorSetFloat1(bEnableDataValidation ? MaxGazeAgeSeconds : MaxFloat);
+	const VectorRegister4Float GazeOutlierSq = VectorSetFloat1(bEnableOutlierDetection ? GazeOutlierPx * GazeOutlierPx : MaxFloat);
+	const VectorRegister4Float HeadOutlierSq = VectorSetFloat1(bEnableOutlierDetection ? HeadOutlierCm * HeadOutlierCm : MaxFloat);
+	const VectorRegister4Float Zero = GlobalVectorConstants::FloatZero;
+
+	FBatchColumns& C = BatchColumns;
+	for (int32 Lane = 0; Lane < NumLanes; Lane += 4)
+	{
+		const int32 Cur = Lane + 1;
+		const int32 Prev = Lane;
+
+		// Confidence and age gating
+		const VectorRegister4Float Fresh = VectorCompareLE(VectorLoad(&C.AgeSeconds[Cur]), MaxAge);
+		VectorRegister4Float GazeValid = VectorCompareNE(VectorLoad(&C.GazeValid[Cur]), Zero);
+		GazeValid = VectorBitwiseAnd(GazeValid, VectorBitwiseAnd(VectorCompareGE(VectorLoad(&C.GazeConfidence[Cur]), MinGazeConf), Fresh));
+		const VectorRegister4Float HeadKept = VectorBitwiseAnd(VectorCompareGE(VectorLoad(&C.HeadConfidence[Cur]), MinHeadConf), Fresh);
+
+		// Outlier candidates: a jump from the previous raw sample larger than the threshold
+		const VectorRegister4Float GazeDX = VectorSubtract(VectorLoad(&C.GazeX[Cur]), VectorLoad(&C.GazeX[Prev]));
+		const VectorRegister4Float GazeDY = VectorSubtract(VectorLoad(&C.GazeY[Cur]), VectorLoad(&C.GazeY[Prev]));
+		const VectorRegister4Float GazeDistSq = VectorMultiplyAdd(GazeDX, GazeDX, VectorMultiply(GazeDY, GazeDY));
+		const VectorRegister4Float PrevGazeValid = VectorCompareNE(VectorLoad(&C.GazeValid[Prev]), Zero);
+		const VectorRegister4Float GazeJump = VectorBitwiseAnd(GazeValid, VectorBitwiseAnd(PrevGazeValid, VectorCompareGT(GazeDistSq, GazeOutlierSq)));
+
+		const VectorRegister4Float CurX = VectorLoad(&C.HeadX[Cur]);
+		const VectorRegister4Float CurY = VectorLoad(&C.HeadY[Cur]);
+		const VectorRegister4Float CurZ = VectorLoad(&C.HeadZ[Cur]);
+		const VectorRegister4Float PrevX = VectorLoad(&C.HeadX[Prev]);
+		const VectorRegister4Float PrevY = VectorLoad(&C.HeadY[Prev]);
+		const VectorRegister4Float PrevZ = VectorLoad(&C.HeadZ[Prev]);
+		const VectorRegister4Float CurKnown = VectorBitwiseOr(VectorCompareNE(CurX, Zero), VectorBitwiseOr(VectorCompareNE(CurY, Zero), VectorCompareNE(CurZ, Zero)));
+		const VectorRegister4Float PrevKnown = VectorBitwiseOr(VectorCompareNE(PrevX, Zero), VectorBitwiseOr(VectorCompareNE(PrevY, Zero), VectorCompareNE(PrevZ, Zero)));
+		const VectorRegister4Float HeadDX = VectorSubtract(CurX, PrevX);
+		const VectorRegister4Float HeadDY = VectorSubtract(CurY, PrevY);
+		const VectorRegister4Float HeadDZ = VectorSubtract(CurZ, PrevZ);
+		const VectorRegister4Float HeadDistSq = VectorMultiplyAdd(HeadDX, HeadDX, VectorMultiplyAdd(HeadDY, HeadDY, VectorMultiply(HeadDZ, HeadDZ)));
+		const VectorRegister4Float HeadJump = VectorBitwiseAnd(VectorBitwiseAnd(HeadKept, CurKnown), VectorBitwiseAnd(PrevKnown, VectorCompareGT(HeadDistSq, HeadOutlierSq)));
+
+		const int32 Group = Lane / 4;
+		C.GazeValidBits[Group] = static_cast<uint8>(VectorMaskBits(GazeValid));
+		C.GazeJumpBits[Group] = static_cast<uint8>(VectorMaskBits(GazeJump));
+		C.HeadResetBits[Group] = static_cast<uint8>(~VectorMaskBits(HeadKept) & 0xF);
+		C.HeadJumpBits[Group] = static_cast<uint8>(VectorMaskBits(HeadJump));
+	}
+
+	// The next batch compares against this batch's newest raw sample
+	PreviousGazePoint = BatchFrameBuffer.Last().Gaze;
+	PreviousHeadPose = BatchFrameBuffer.Last().Head;
+
+	// Oldest first: a candidate is an outlier only when it also jumped from the last accepted sample, which each kept sample moves on
+	const float GazeOutlierPxSq = GazeOutlierPx * GazeOutlierPx;
+	const float HeadOutlierCmSq = HeadOutlierCm * HeadOutlierCm;
+	for (int32 Index = 0; Index < NumFrames; ++Index)
+	{
+		const int32 Group = Index / 4;
+		const uint8 LaneBit = static_cast<uint8>(1 << (Index % 4));
+		FBeamFrame& Frame = BatchFrameBuffer[Index];
+
+		Frame.Gaze.bValid = (C.GazeValidBits[Group] & LaneBit) != 0;
+		if ((C.GazeJumpBits[Group] & LaneBit) && AcceptedGazePoint.bValid
+			&& FVector2D::DistSquared(Frame.Gaze.ScreenPx, AcceptedGazePoint.ScreenPx) > GazeOutlierPxSq)
 		{
-			ProcessFrameOptimized(BatchFrameBuffer[i + j]);
+			Frame.Gaze.bValid = false;
+		}
+		if (Frame.Gaze.bValid)
+		{
+			AcceptedGazePoint = Frame.Gaze;
+		}
+
+		if (C.HeadResetBits[Group] & LaneBit)
+		{
+			Frame.Head.PositionCm = FVector::ZeroVector;
+			Frame.Head.SetRotation(FQuat::Identity);
+		}
+		else if ((C.HeadJumpBits[Group] & LaneBit) && !AcceptedHeadPose.PositionCm.IsZero()
+			&& FVector::DistSquared(Frame.Head.PositionCm, AcceptedHeadPose.PositionCm) > HeadOutlierCmSq)
+		{
+			Frame.Head.PositionCm = AcceptedHeadPose.PositionCm;
+			Frame.Head.SetRotation(AcceptedHeadPose.RotationQuat);
+		}
+		else if (!Frame.Head.PositionCm.IsZero())
+		{
+			AcceptedHeadPose = Frame.Head;
 		}
 	}
-	
-	// Process remaining frames
-	for (int32 i = SIMDEnd; i < NumFrames; ++i)
-	{
-		ProcessFrameOptimized(BatchFrameBuffer[i]);
-	}
-#else
-	ProcessBatchFramesStandard();
-#endif
 }
 
 void UBeamEyeTrackerComponent::ApplyProjectDefaults()
@@ -1080,32 +1227,52 @@ void UBeamEyeTrackerComponent::TestGazeRay()
 		FVector WorldLocation, WorldDirection;
 		if (DeprojectGazeToWorld(GazePoint, WorldLocation, WorldDirection))
 		{
-			// Perform line trace
-			FHitResult HitResult;
-			FVector TraceEnd = WorldLocation + (WorldDirection * TraceDistance);
-			
-			FCollisionQueryParams QueryParams;
-			QueryParams.bTraceComplex = false;
-			QueryParams.bReturnPhysicalMaterial = false;
-			
-			bool bHit = GetWorld()->LineTraceSingleByChannel(HitResult, WorldLocation, TraceEnd, ECC_Visibility, QueryParams);
-			
-			if (bHit)
+			// Traced through the batched service; the result is logged next frame
+			UBeamGazeTraceSubsystem* Traces = GetWorld()->GetSubsystem<UBeamGazeTraceSubsystem>();
+			if (!Traces)
 			{
-				UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Ray hit %s at distance %.1f cm"),
-					*HitResult.GetActor()->GetName(), HitResult.Distance);
+				return;
 			}
-			else
+
+			const float Distance = TraceDistance;
+			Traces->RequestTrace(WorldLocation, WorldLocation + (WorldDirection * TraceDistance), ECC_Visibility, [Distance](bool bHit, const FHitResult& HitResult)
 			{
-				UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Ray trace completed - no hit within %.0f cm"), TraceDistance);
-			}
+				if (bHit)
+				{
+					UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Ray hit %s at distance %.1f cm"),
+						*GetNameSafe(HitResult.GetActor()), HitResult.Distance);
+				}
+				else
+				{
+					UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Ray trace completed - no hit within %.0f cm"), Distance);
+				}
+			});
 		}
 	}
 }
 
+bool UBeamEyeTrackerComponent::RequestGazeTrace(FOnBeamGazeTraceResult OnResult, ECollisionChannel Channel)
+{
+	FGazePoint GazePoint;
+	FVector WorldLocation, WorldDirection;
+	if (!Subsystem || !GetCurrentGazePoint(GazePoint) || !DeprojectGazeToWorld(GazePoint, WorldLocation, WorldDirection))
+	{
+		return false;
+	}
+
+	UBeamGazeTraceSubsystem* Traces = GetWorld()->GetSubsystem<UBeamGazeTraceSubsystem>();
+	if (!Traces)
+	{
+		return false;
+	}
+
+	Traces->RequestGazeTrace(WorldLocation, WorldLocation + (WorldDirection * TraceDistance), Channel, OnResult);
+	return true;
+}
+
 bool UBeamEyeTrackerComponent::DeprojectGazeToWorld(const FGazePoint& GazePoint, FVector& OutWorldLocation, FVector& OutWorldDirection) const
 {
-	if (!GetWorld())
+	if (!GetWorld() || !Subsystem)
 	{
 		return false;
 	}
@@ -1121,8 +1288,8 @@ bool UBeamEyeTrackerComponent::DeprojectGazeToWorld(const FGazePoint& GazePoint,
 			// Convert normalized coordinates to pixel coordinates
 			FVector2D PixelCoords = GazePoint.Screen01 * ViewportSize;
 			
-			// Deproject to world
-			if (PC->DeprojectScreenPositionToWorld(PixelCoords.X, PixelCoords.Y, OutWorldLocation, OutWorldDirection))
+			// Deproject through the view the subsystem captured this frame
+			if (Subsystem->DeprojectScreenPosition(PC, PixelCoords, OutWorldLocation, OutWorldDirection))
 			{
 				return true;
 			}
@@ -15,9 +15,11 @@
 #include "BeamEyeTracker.h"
 #include "BeamEyeTrackerSubsystem.h"
 #include "BeamEyeTrackerProvider.h"
+#include "BeamEyeTrackerBridge.h"
 #include "BeamLogging.h"
-
-#include "BeamLogging.h"
+#include "BeamExport.h"
+#include "BeamFlightRecorder.h"
+#include "BeamDebugOverlay.h"
 
 #define LOCTEXT_NAMESPACE "FBeamEyeTrackerModule"
 
@@ -28,10 +30,30 @@ void FBeamEyeTrackerModule::StartupModule()
 	UE_LOG(LogBeam, Log, TEXT("Beam Eye Tracker module started"));
 	
 	// Subsystems are automatically registered by Unreal Engine
+
+	// Started before any subsystem so the first frames are already kept
+	GBeamFlightRecorder.Start();
+
+	// One debug draw pass for every Beam overlay primitive; does nothing when the overlay is compiled out
+	GBeamDebugOverlay.Start();
+
+#if BEAM_FEATURE_EYETRACKER_BRIDGE
+	// Registered before engine init, which is when the engine picks its eye tracking device
+	FBeamEyeTrackerBridgeModule::Register();
+#endif
 }
 
 void FBeamEyeTrackerModule::ShutdownModule()
 {
+#if BEAM_FEATURE_EYETRACKER_BRIDGE
+	FBeamEyeTrackerBridgeModule::Unregister();
+#endif
+
+	// Background exports hold file handles and may still reference module code
+	BeamExport::WaitForPendingExports();
+	GBeamFlightRecorder.Stop();
+	GBeamDebugOverlay.Stop();
+
 	UE_LOG(LogBeam, Log, TEXT("Beam Eye Tracker module shutdown"));
 }
 
@@ -33,12 +33,13 @@ FBeamEyeTrackerProvider::~FBeamEyeTrackerProvider()
 
 bool FBeamEyeTrackerProvider::Initialize()
 {
-	if (!SDKWrapper.IsValid())
+	if (!InitializeSDKSource())
 	{
 		return false;
 	}
 
-	return SDKWrapper->InitSDK(TEXT("BeamEyeTracker"), 1920, 1080);
+	// Registers the SDK listener when a frame sink or frame event has been provided
+	return SDKWrapper->Start();
 }
 
 void FBeamEyeTrackerProvider::Shutdown()
@@ -81,6 +82,14 @@ EBeamHealth FBeamEyeTrackerProvider::GetHealth() const
 	}
 }
 
+void FBeamEyeTrackerProvider::RefreshHealth()
+{
+	if (SDKWrapper)
+	{
+		SDKWrapper->RefreshReceptionStatus();
+	}
+}
+
 bool FBeamEyeTrackerProvider::StartCameraRecentering()
 {
 	if (!IsValid())
@@ -110,22 +119,18 @@ bool FBeamEyeTrackerProvider::InitializeSDKSource()
 		return false;
 	}
 
-	return SDKWrapper->InitSDK(TEXT("BeamEyeTracker"), 1920, 1080);
+	return SDKWrapper->InitSDK(ApplicationName, ViewportSizePx.X, ViewportSizePx.Y);
 }
 
 bool FBeamEyeTrackerProvider::InitializeFileSource()
 {
-	// File-based data source for playback
-	// This would read from a CSV file and simulate live data
-	
+	// Recorded playback is served by FBeamFileDataSource without loading the SDK wrapper
 	return false;
 }
 
 bool FBeamEyeTrackerProvider::InitializeNetworkSource()
 {
-	// Network-based data source for remote tracking
-	// This would connect to a remote Beam server
-	
+	// Remote tracking is served by FBeamNetworkDataSource
 	return false;
 }
 
@@ -137,7 +142,9 @@ bool FBeamEyeTrackerProvider::InitSDK(const FString& AppName, int32 ViewportWidt
 	{
 		return false;
 	}
-	return SDKWrapper->InitSDK(AppName, ViewportWidth, ViewportHeight);
+	ApplicationName = AppName;
+	ViewportSizePx = FIntPoint(ViewportWidth, ViewportHeight);
+	return SDKWrapper->InitSDK(AppName, ViewportWidth, ViewportHeight) && SDKWrapper->Start();
 }
 
 bool FBeamEyeTrackerProvider::IsSDKInitialized() const
@@ -145,14 +152,73 @@ bool FBeamEyeTrackerProvider::IsSDKInitialized() const
 	return SDKWrapper && SDKWrapper->IsSDKInitialized();
 }
 
+void FBeamEyeTrackerProvider::SetFrameSink(FBeamFrameRing* InFrameSink)
+{
+	if (SDKWrapper)
+	{
+		SDKWrapper->SetFrameSink(InFrameSink);
+	}
+}
+
+bool FBeamEyeTrackerProvider::IsPushingFrames() const
+{
+	return SDKWrapper && SDKWrapper->IsPushIngestionActive();
+}
+
+bool FBeamEyeTrackerProvider::SetFrameEvent(FEvent* InEvent)
+{
+	return SDKWrapper && SDKWrapper->SetFrameEvent(InEvent);
+}
+
+bool FBeamEyeTrackerProvider::GetClockOffsetSeconds(double& OutOffsetSeconds) const
+{
+	if (!SDKWrapper || !SDKWrapper->GetClockSync().HasEstimate())
+	{
+		return false;
+	}
+	OutOffsetSeconds = SDKWrapper->GetClockSync().GetOffsetSeconds();
+	return true;
+}
+
+bool FBeamEyeTrackerProvider::GetLastActivitySeconds(double& OutSeconds) const
+{
+	if (!SDKWrapper || SDKWrapper->GetLastStateSetSeconds() <= 0.0)
+	{
+		return false;
+	}
+	OutSeconds = SDKWrapper->GetLastStateSetSeconds();
+	return true;
+}
+
+bool FBeamEyeTrackerProvider::WaitForNextFrame(FBeamFrame& OutFrame, uint32 TimeoutMs)
+{
+	if (!IsValid())
+	{
+		FPlatformProcess::Sleep(TimeoutMs * 0.001f);
+		return false;
+	}
+
+	return SDKWrapper->WaitForNewFrame(OutFrame, TimeoutMs);
+}
+
 void FBeamEyeTrackerProvider::UpdateViewportGeometry(int32 ViewportWidth, int32 ViewportHeight)
 {
 	if (SDKWrapper)
 	{
+		ViewportSizePx = FIntPoint(ViewportWidth, ViewportHeight);
 		SDKWrapper->UpdateViewportGeometry(ViewportWidth, ViewportHeight);
 	}
 }
 
+void FBeamEyeTrackerProvider::UpdateViewportRect(const FIntPoint& OriginPx, const FIntPoint& SizePx)
+{
+	if (SDKWrapper && SizePx.X > 0 && SizePx.Y > 0)
+	{
+		ViewportSizePx = SizePx;
+		SDKWrapper->UpdateViewportRect(OriginPx, SizePx);
+	}
+}
+
 bool FBeamEyeTrackerProvider::StartCalibration(const FString& ProfileId)
 {
 	if (!IsValid())
@@ -19,6 +19,7 @@ public:
 	virtual bool IsValid() const override;
 	virtual bool FetchCurrentFrame(FBeamFrame& OutFrame) override;
 	virtual EBeamHealth GetHealth() const override;
+	virtual void RefreshHealth() override;
 	virtual bool StartCameraRecentering() override;
 	virtual void EndCameraRecentering() override;
 	
@@ -26,8 +27,15 @@ public:
 	virtual bool InitSDK(const FString& AppName, int32 ViewportWidth, int32 ViewportHeight) override;
 	virtual bool IsSDKInitialized() const override;
 	virtual void UpdateViewportGeometry(int32 ViewportWidth, int32 ViewportHeight) override;
+	virtual void UpdateViewportRect(const FIntPoint& OriginPx, const FIntPoint& SizePx) override;
 	virtual bool StartCalibration(const FString& ProfileId) override;
 	virtual void StopCalibration() override;
+	virtual void SetFrameSink(FBeamFrameRing* InFrameSink) override;
+	virtual bool IsPushingFrames() const override;
+	virtual bool SetFrameEvent(FEvent* InEvent) override;
+	virtual bool WaitForNextFrame(FBeamFrame& OutFrame, uint32 TimeoutMs) override;
+	virtual bool GetClockOffsetSeconds(double& OutOffsetSeconds) const override;
+	virtual bool GetLastActivitySeconds(double& OutSeconds) const override;
 
 private:
 	/** SDK wrapper instance */
@@ -39,6 +47,10 @@ private:
 	/** File path for file-based data source */
 	FString FilePath;
 
+	/** Name and viewport size used when Initialize builds the SDK instance; kept from the last InitSDK or viewport update */
+	FString ApplicationName = TEXT("BeamEyeTracker");
+	FIntPoint ViewportSizePx = FIntPoint(1920, 1080);
+
 	/** Initialize SDK-based data source */
 	bool InitializeSDKSource();
 
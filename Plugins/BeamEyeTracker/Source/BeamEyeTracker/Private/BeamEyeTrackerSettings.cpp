@@ -1,6 +1,9 @@
 ﻿// Implements config loading & editor integration for settings
 
 #include "BeamEyeTrackerSettings.h"
+#include "BeamRuntimeSettings.h"
+#include "BeamRing.h"
+#include "BeamFeatures.h"
 
 UBeamEyeTrackerSettings::UBeamEyeTrackerSettings()
 {
@@ -88,3 +91,57 @@ void UBeamEyeTrackerSettings::ApplyActiveProfile(UBeamEyeTrackerSettings* Target
 	TargetSettings->TraceDistance = ActiveProfilePtr->TraceDistance;
 }
 
+
+FBeamPredictorParams UBeamEyeTrackerSettings::GetPredictorParams() const
+{
+	FBeamPredictorParams Params;
+	Params.Model = PredictionModel;
+	Params.MaxHorizonMs = PredictionMaxHorizonMs;
+	Params.SaccadeVelocityThreshold = PredictionSaccadeVelocityThreshold;
+	Params.SaccadeMaxHorizonMs = PredictionSaccadeMaxHorizonMs;
+	Params.FixationVelocityThreshold = PredictionFixationVelocityThreshold;
+	return Params;
+}
+
+FBeamMemoryBudget UBeamEyeTrackerSettings::GetMemoryBudget() const
+{
+#if BEAM_FEATURE_PROFILES
+	if (MemoryProfile != EBeamMemoryProfile::Custom)
+	{
+		const int64 BudgetBytes = MemoryBudgetOverrideKB > 0 ? static_cast<int64>(MemoryBudgetOverrideKB) * 1024 : FBeamMemoryBudget::GetProfileBudgetBytes(MemoryProfile);
+		return FBeamMemoryBudget::FromBudget(MemoryProfile, BudgetBytes);
+	}
+#endif
+
+	// No budget: the analytics window and flight recorder stay on their own defaults
+	FBeamMemoryBudget Budget = FBeamMemoryBudget::FromBudget(EBeamMemoryProfile::Custom, 0);
+	Budget.RecordingBlockSizeBytes = FMath::Max(4, RecordingBlockSizeKB) * 1024;
+	Budget.RecordingMaxPendingBlocks = RecordingMaxPendingBlocks;
+	Budget.RecordingMaxInMemoryFrames = RecordingMaxInMemoryFrames;
+	Budget.MaxComponentHistoryFrames = FBeamCompactFrameRing::GetMaxSize();
+	Budget.AnalyticsWindowSeconds = 0.0f;
+	Budget.FlightRecorderSeconds = 0.0f;
+	return Budget;
+}
+
+FBeamRuntimeSettings FBeamRuntimeSettings::FromSettings(const UBeamEyeTrackerSettings& Settings)
+{
+	FBeamRuntimeSettings Result;
+	Result.PollingHz = Settings.PollingHz;
+	Result.bEnableSmoothing = Settings.bEnableSmoothing;
+	Result.bAutoStart = Settings.bAutoStart;
+	Result.TraceDistance = Settings.TraceDistance;
+	Result.OneEuro = FOneEuroFilterParams(Settings.MinCutoff, Settings.Beta, static_cast<float>(Settings.PollingHz));
+	Result.FilterType = EBeamFilterType::OneEuro;
+	return Result;
+}
+
+void FBeamRuntimeSettings::CopyToSettings(UBeamEyeTrackerSettings& Settings) const
+{
+	Settings.PollingHz = PollingHz;
+	Settings.bEnableSmoothing = bEnableSmoothing;
+	Settings.bAutoStart = bAutoStart;
+	Settings.TraceDistance = TraceDistance;
+	Settings.MinCutoff = OneEuro.MinCutoff;
+	Settings.Beta = OneEuro.Beta;
+}
@@ -11,21 +11,60 @@
 #include "BeamEyeTrackerSubsystem.h"
 #include "BeamEyeTrackerSettings.h"
 #include "BeamRing.h"
+#include "BeamPredictor.h"
+#include "BeamGazeViewExtension.h"
+#include "RenderingThread.h"
 #include "BeamEyeTrackerProvider.h"
+#include "BeamFileDataSource.h"
+#include "BeamNetworkDataSource.h"
+#include "BeamNetStreamServer.h"
+#include "BeamSyntheticDataSource.h"
 #include "BeamConsoleVariables.h"
 #include "BeamLogging.h"
 #include "BeamEyeTrackerTypes.h"
 #include "Engine/Engine.h"
+#include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/PlatformAffinity.h"
+#include "HAL/Event.h"
+#include "Misc/App.h"
+#include "Widgets/SWindow.h"
 #include "Misc/ScopeLock.h"
+#include "Async/Async.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
 #include "IBeamDataSource.h"
 #include "BeamRecording.h"
 #include "BeamTrace.h"
+#include "BeamLatency.h"
+#include "BeamFlightRecorder.h"
+#include "BeamResources.h"
+#include "BeamStats.h"
+#include "BeamViewportMapping.h"
+#include "BeamTrackerRegistry.h"
+#include "BeamPollingScheduler.h"
+#include "BeamExport.h"
+#include "Slate/SceneViewport.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/LocalPlayer.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "BeamStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Fetch Current Frame"), STAT_BeamFetchFrame, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("Capture Gaze Ray"), STAT_BeamGazeRay, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("Frame Rate Views"), STAT_BeamRateViews, STATGROUP_Beam);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Source Frames Dropped"), STAT_BeamSourceDropped, STATGROUP_Beam);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Source Frames Decimated"), STAT_BeamSourceDecimated, STATGROUP_Beam);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ring Frames Overwritten"), STAT_BeamRingOverwritten, STATGROUP_Beam);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Consumer Frames Dropped"), STAT_BeamConsumerDropped, STATGROUP_Beam);
 
 // Subsystem Initialization
 
@@ -34,17 +73,16 @@ UBeamEyeTrackerSubsystem::UBeamEyeTrackerSubsystem()
 	, FrameBuffer(nullptr)
 	, DataSource(nullptr)
 	, Filters(nullptr)
-	, Recording(nullptr)
-	, Tracing(nullptr)
+	, Predictor(nullptr)
 	, PollingThread(nullptr)
+	, PollingRunnable(nullptr)
 	, bStopPolling(false)
-	, RecordingFile(nullptr)
 {
 }
 
 void UBeamEyeTrackerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
-	
+	LLM_SCOPE_BYTAG(BeamEyeTracker);
 	const UBeamEyeTrackerSettings* DefaultSettings = GetDefault<UBeamEyeTrackerSettings>();
 	
 #if !UE_BUILD_SHIPPING
@@ -61,66 +99,239 @@ void UBeamEyeTrackerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 		return;
 	}
 
-	FrameBuffer = new FBeamRing(1024); // Default buffer size
+	// 1024 frames; gaze columns serve analytics consumers and snapshots TakeFrameSnapshot, unless the budget drops them
+	const FBeamMemoryBudget MemoryBudget = Settings->GetMemoryBudget();
+	FrameBuffer = new FBeamFrameRing(MemoryBudget.bFrameRingGazeColumns, MemoryBudget.bFrameRingSnapshots);
+
+	SET_MEMORY_STAT(STAT_BeamMemoryBudget, MemoryBudget.BudgetBytes);
+	if (MemoryBudget.IsBudgeted())
+	{
+		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: %s memory profile, %.1f KB budget (%.1f KB planned)"),
+			FBeamMemoryBudget::GetProfileName(MemoryBudget.Profile), MemoryBudget.BudgetBytes / 1024.0, MemoryBudget.GetPlannedBytes() / 1024.0);
+	}
 	
 #if !UE_BUILD_SHIPPING
 	check(FrameBuffer != nullptr);
 #endif
 
-	DataSource = new FBeamEyeTrackerProvider();
+	DataSource = CreateDataSource(DataSourceType);
+
+	Filters = new FBeamFilters();
+	PublishRuntimeSettings(FBeamRuntimeSettings::FromSettings(*Settings));
+
+	FBeamGapFillParams GapFillParams;
+	GapFillParams.MaxGapMs = Settings->MaxGapFillMs;
+	GapFillParams.MaxExtrapolationMs = Settings->GapExtrapolationMs;
+	Filters->UpdateGapFillParams(GapFillParams);
+
+	Predictor = new FBeamGazePredictor(Settings->GetPredictorParams());
+	PredictorScratch.Reserve(16);
+
+#if BEAM_FEATURE_RECORDED_DATA
+	Recording = new FBeamRecording();
+#endif
+
+#if BEAM_FEATURE_UNREAL_INSIGHTS
+	InitializeTracing();
+#endif
+
+	// Percentiles are recomputed a few times a second; recording itself never waits on this
+	LatencyStatsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickLatencyStats), 0.25f);
+	WatchdogTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickWatchdog), 0.25f);
+	PollingScheduleTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickPollingSchedule), 0.25f);
+	MonitorSnapshotTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickMonitorSnapshot), 1.0f / MonitorSnapshotRateHz);
+	GBeamResources.Start();
+
+	// Without the producer thread, live frames are pushed into the ring from the SDK callback thread
+	if (!Settings->bUseProducerThread)
+	{
+		DataSource->SetFrameSink(FrameBuffer);
+	}
+
+	// The game viewport usually does not exist yet; it is registered as soon as it is created
+	ViewportRegistry = new FBeamViewportRegistry();
+	ViewportCreatedHandle = UGameViewportClient::OnViewportCreated().AddUObject(this, &UBeamEyeTrackerSubsystem::RegisterGameViewport);
+	ViewportResizedHandle = FViewport::ViewportResizedEvent.AddUObject(this, &UBeamEyeTrackerSubsystem::HandleViewportResized);
+	ViewportMoveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickViewportMapping), 0.2f);
+	RegisterGameViewport();
+
+	TrackerRegistry = new FBeamTrackerRegistry();
+	TrackerRegistry->SetRuntimeSettings(GetRuntimeSettings());
+
+	// Player cameras update at the end of the world tick; cached gaze rays are recaptured right after
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UBeamEyeTrackerSubsystem::HandlePostActorTick);
 	
 	// Sync console variables with project settings - ensures runtime consistency
 	FBeamConsoleVariables::SyncWithProjectSettings();
 	
-	// Auto-start if configured - convenience feature for development
+	// Auto-start if configured - convenience feature for development; never blocks PIE start on the SDK
 	if (Settings && Settings->bAutoStartOnPIE)
 	{
-		StartBeamTracking();
+		StartBeamTrackingAsync();
+	}
+
+	if (Settings && Settings->bEnableNetworkStreaming)
+	{
+		StartNetworkStreaming();
 	}
 }
 
 void UBeamEyeTrackerSubsystem::Deinitialize()
 {
+#if BEAM_FEATURE_RECORDED_DATA
+	// Finalize any open recording while the ring is still alive
+	if (IsRecording())
+	{
+		StopRecording();
+	}
+	if (IsPlayingBack())
+	{
+		Recording->StopPlayback();
+	}
+	UpdateRecordingTicker();
+#endif
+
+	if (SubscriptionTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SubscriptionTickerHandle);
+		SubscriptionTickerHandle.Reset();
+	}
+	FrameSubscriptions = FBeamFrameSubscriptions();
+
+	StopFrameRateViews();
+	FrameRateViews = FBeamFrameRateViews();
+
+	if (NewFrameTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(NewFrameTickerHandle);
+		NewFrameTickerHandle.Reset();
+	}
+	NewFrameListeners.Clear();
+	NumNewFrameListeners.store(0, std::memory_order_relaxed);
+
+	if (LatencyStatsTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(LatencyStatsTickerHandle);
+		LatencyStatsTickerHandle.Reset();
+		GBeamResources.Stop();
+	}
+
+	if (MonitorSnapshotTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(MonitorSnapshotTickerHandle);
+		MonitorSnapshotTickerHandle.Reset();
+	}
+	MonitorHistory.Reset();
+
+	// A change still inside its debounce window would otherwise be lost
+	FlushSettingsSave();
+
+	if (WatchdogTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(WatchdogTickerHandle);
+		WatchdogTickerHandle.Reset();
+	}
+
+	if (PollingScheduleTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PollingScheduleTickerHandle);
+		PollingScheduleTickerHandle.Reset();
+	}
+	AdaptivePollingUserCount = 0;
+
+	UGameViewportClient::OnViewportCreated().Remove(ViewportCreatedHandle);
+	FViewport::ViewportResizedEvent.Remove(ViewportResizedHandle);
+	ViewportCreatedHandle.Reset();
+	ViewportResizedHandle.Reset();
+	if (ViewportMoveTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ViewportMoveTickerHandle);
+		ViewportMoveTickerHandle.Reset();
+	}
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+	GazeRayViews.Reset();
+
 	// Stop tracking before cleanup - ensures clean shutdown
 	StopBeamTracking();
 
+	// The render thread and background ring readers must be done with the ring before it is freed below
+	ReleaseGazeViewExtension();
+	StopNetworkStreaming();
+	OnFrameRingReleased.Broadcast();
+	OnFrameRingReleased.Clear();
+	FoveationUserCount = 0;
+
+	// Added trackers share nothing with the primary pipeline, but their tasks must be done before the module goes
+	if (TrackerRegistry)
+	{
+		TrackerRegistry->Shutdown();
+		delete TrackerRegistry;
+		TrackerRegistry = nullptr;
+	}
+
 	// Manual cleanup for raw pointers
 	if (DataSource)
 	{
 		delete DataSource;
 		DataSource = nullptr;
 	}
+	if (SDKDllHandle)
+	{
+		FPlatformProcess::FreeDllHandle(SDKDllHandle);
+		SDKDllHandle = nullptr;
+	}
 	if (FrameBuffer)
 	{
 		delete FrameBuffer;
 		FrameBuffer = nullptr;
 	}
+	RawFrameSink.store(nullptr);
+	RawCaptureUserCount = 0;
+	if (RawFrameBuffer)
+	{
+		delete RawFrameBuffer;
+		RawFrameBuffer = nullptr;
+	}
 	if (Filters)
 	{
 		delete Filters;
 		Filters = nullptr;
 	}
+	if (ViewportRegistry)
+	{
+		delete ViewportRegistry;
+		ViewportRegistry = nullptr;
+	}
+	if (Predictor)
+	{
+		delete Predictor;
+		Predictor = nullptr;
+	}
+#if BEAM_FEATURE_RECORDED_DATA
 	if (Recording)
 	{
 		delete Recording;
 		Recording = nullptr;
 	}
+#endif
+	if (PollingThread)
+	{
+		StopPollingThread();
+	}
+
+#if BEAM_FEATURE_UNREAL_INSIGHTS
+	// Every recording thread is stopped by now
 	if (Tracing)
 	{
+		if (GBeamTracer == Tracing)
+		{
+			GBeamTracer = nullptr;
+		}
 		delete Tracing;
 		Tracing = nullptr;
 	}
-	if (RecordingFile)
-	{
-		delete RecordingFile;
-		RecordingFile = nullptr;
-	}
-	if (PollingThread)
-	{
-		PollingThread->Kill(true);
-		delete PollingThread;
-		PollingThread = nullptr;
-	}
+#endif
 }
 
 // Tracking Lifecycle Management
@@ -137,6 +348,12 @@ bool UBeamEyeTrackerSubsystem::StartBeamTracking()
 		return false;
 	}
 
+	if (IsStartPending())
+	{
+		UE_LOG(LogBeam, Warning, TEXT("Cannot start tracking - an asynchronous start is still running"));
+		return false;
+	}
+
 	// The subsystem runs after GameInstance init, ensuring proper initialization order
 	if (!DataSource->IsValid())
 	{
@@ -153,6 +370,7 @@ bool UBeamEyeTrackerSubsystem::StartBeamTracking()
 #if !UE_BUILD_SHIPPING
 			check(ViewportWidth > 0 && ViewportHeight > 0);
 #endif
+			PushPrimaryViewportRect();
 
 			if (!DataSource->Initialize())
 			{
@@ -171,8 +389,7 @@ bool UBeamEyeTrackerSubsystem::StartBeamTracking()
 	
 	if (DataSource->IsValid())
 	{
-		LastErrorMessage.Empty();
-		UE_LOG(LogBeam, Log, TEXT("Beam tracking started successfully"));
+		BeginTrackingSession();
 		return true;
 	}
 	else
@@ -183,31 +400,211 @@ bool UBeamEyeTrackerSubsystem::StartBeamTracking()
 	}
 }
 
+bool UBeamEyeTrackerSubsystem::StartBeamTrackingAsync()
+{
+	if (!DataSource || IsBeamTracking() || IsStartPending())
+	{
+		UE_LOG(LogBeam, Warning, TEXT("Cannot start tracking - data source invalid, already tracking or start pending"));
+		return false;
+	}
+
+	// Already initialized sources (file, synthetic, a restarted live session) have nothing slow left to do
+	if (DataSource->IsValid())
+	{
+		return StartBeamTracking();
+	}
+
+	// Last game-thread access to the source before the worker takes it
+	PushPrimaryViewportRect();
+
+	bStartPending.store(true, std::memory_order_release);
+	IBeamDataSource* Source = DataSource;
+	const bool bLiveSource = DataSourceType == EBeamDataSourceType::Live;
+	const uint32 Serial = ++StartSerial;
+	TWeakObjectPtr<UBeamEyeTrackerSubsystem> WeakThis(this);
+
+	// The worker is the only one touching DataSource until it completes; StopBeamTracking and
+	// Deinitialize wait for it before shutting the source down or freeing it
+	PendingStart = Async(EAsyncExecution::ThreadPool, [this, Source, bLiveSource, Serial, WeakThis]()
+	{
+		const bool bDllSafe = !bLiveSource || VerifyDLLSafety();
+		const bool bInitialized = bDllSafe && Source->Initialize();
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, bDllSafe, bInitialized]()
+		{
+			if (UBeamEyeTrackerSubsystem* Subsystem = WeakThis.Get())
+			{
+				Subsystem->FinishAsyncStart(Serial, bDllSafe, bInitialized);
+			}
+		});
+	});
+
+	UE_LOG(LogBeam, Log, TEXT("Beam tracking start queued"));
+	return true;
+}
+
+void UBeamEyeTrackerSubsystem::FinishAsyncStart(uint32 Serial, bool bDllSafe, bool bInitialized)
+{
+	// A stop during the start already waited for the worker and cleared the flag; its result is stale
+	if (!IsStartPending() || Serial != StartSerial)
+	{
+		return;
+	}
+	PendingStart.Reset();
+	bStartPending.store(false, std::memory_order_release);
+
+	if (!bDllSafe)
+	{
+		LastErrorMessage = TEXT("Beam SDK client library could not be loaded");
+		SetHealth(EBeamHealth::DllMissing);
+		return;
+	}
+
+	if (!bInitialized || !DataSource || !DataSource->IsValid())
+	{
+		LastErrorMessage = TEXT("Failed to initialize data source");
+		UE_LOG(LogBeam, Error, TEXT("Failed to initialize Beam data source"));
+		SetHealth(EBeamHealth::AppNotRunning);
+		return;
+	}
+
+	BeginTrackingSession();
+	SetHealth(EvaluateHealth());
+}
+
+void UBeamEyeTrackerSubsystem::WaitForPendingStart()
+{
+	if (PendingStart.IsValid())
+	{
+		PendingStart.Wait();
+		PendingStart.Reset();
+	}
+	bStartPending.store(false, std::memory_order_release);
+}
+
+void UBeamEyeTrackerSubsystem::BeginTrackingSession()
+{
+	LastErrorMessage.Empty();
+	bTrackingSessionActive = true;
+	LastDataTime.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+
+	// Frame ids may restart with the new session
+	if (Predictor)
+	{
+		Predictor->Reset();
+	}
+
+	// Producer thread is the single writer into the ring when enabled
+	if (Settings && Settings->bUseProducerThread && !PollingThread && !IsPlayingBack())
+	{
+		FrameBuffer->Clear();
+		if (RawFrameBuffer)
+		{
+			RawFrameBuffer->Clear();
+		}
+		FrameCacheCounter = MAX_uint64;
+		StartPollingThread();
+	}
+
+	UE_LOG(LogBeam, Log, TEXT("Beam tracking started successfully"));
+}
+
 void UBeamEyeTrackerSubsystem::StopBeamTracking()
 {
+	// The source may still be mid-initialize on a worker, or being rebuilt by the watchdog
+	WaitForPendingStart();
+	bTrackingSessionActive = false;
+	StopWatchdogRecovery();
+
+	FrameCacheCounter = MAX_uint64;
+
+	// Producer must stop touching the data source before it shuts down
+	if (PollingThread)
+	{
+		StopPollingThread();
+	}
+
 	if (DataSource)
 	{
 		DataSource->Shutdown();
 	}
+
+	// Otherwise the Ok from the session outlives it, and health waiters resolve against a stopped tracker
+	SetHealth(EvaluateHealth());
 }
 
 bool UBeamEyeTrackerSubsystem::IsBeamTracking() const
 {
-	return DataSource && DataSource->IsValid();
+	if (!DataSource || IsStartPending())
+	{
+		return false;
+	}
+
+	// The session stays up while the watchdog reconnects; the source itself is off limits until it is done
+	return IsTrackingStale() || DataSource->IsValid();
 }
 
 // Data Access
 
 bool UBeamEyeTrackerSubsystem::FetchCurrentFrame(FBeamFrame& OutFrame) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_BeamFetchFrame);
 #if !UE_BUILD_SHIPPING
 	check(&OutFrame != nullptr);
 #endif
-	
-	if (!DataSource)
+
+	// Components, widgets, HUDs and Blueprint calls all land here; only the first of each engine frame reaches the source
+	if (IsInGameThread())
+	{
+		const FBeamFrame* Cached = PeekCurrentFrame();
+		if (!Cached)
+		{
+			return false;
+		}
+		OutFrame = *Cached;
+		return true;
+	}
+
+	return FetchCurrentFrameUncached(OutFrame);
+}
+
+const FBeamFrame* UBeamEyeTrackerSubsystem::PeekCurrentFrame() const
+{
+	check(IsInGameThread());
+
+	if (FrameCacheCounter == GFrameCounter)
+	{
+		return &FrameCache;
+	}
+
+	// Failures are not cached so a source that comes up mid-frame is visible immediately
+	if (!FetchCurrentFrameUncached(FrameCache))
+	{
+		FrameCacheCounter = MAX_uint64;
+		return nullptr;
+	}
+	FrameCacheCounter = GFrameCounter;
+	GBeamLatency.NoteConsumed(FrameCache, FPlatformTime::Seconds());
+	return &FrameCache;
+}
+
+bool UBeamEyeTrackerSubsystem::FetchCurrentFrameUncached(FBeamFrame& OutFrame) const
+{
+	if (!DataSource || IsStartPending())
 	{
 		return false;
 	}
+
+	// During watchdog recovery the ring still holds the last good frame
+	const bool bStale = IsTrackingStale();
+
+	// Push ingestion already converted the frame; reading the ring costs no SDK round trip
+	if (FrameBuffer && (bStale || PollingThread || DataSource->IsPushingFrames() || IsPlayingBack()))
+	{
+		const bool bRead = FrameBuffer->ReadLatest(OutFrame);
+		OutFrame.bStale = bStale;
+		return bRead;
+	}
 	
 	return DataSource->FetchCurrentFrame(OutFrame);
 }
@@ -218,6 +615,12 @@ FGazePoint UBeamEyeTrackerSubsystem::CurrentGaze() const
 	// This function is safe to call without validation
 #endif
 	
+	if (IsInGameThread())
+	{
+		const FBeamFrame* Cached = PeekCurrentFrame();
+		return Cached ? Cached->Gaze : FGazePoint();
+	}
+
 	FBeamFrame Frame;
 	if (FetchCurrentFrame(Frame))
 	{
@@ -232,6 +635,12 @@ FHeadPose UBeamEyeTrackerSubsystem::HeadPosition() const
 	// This function is safe to call without validation
 #endif
 	
+	if (IsInGameThread())
+	{
+		const FBeamFrame* Cached = PeekCurrentFrame();
+		return Cached ? Cached->Head : FHeadPose();
+	}
+
 	FBeamFrame Frame;
 	if (FetchCurrentFrame(Frame))
 	{
@@ -253,7 +662,7 @@ FString UBeamEyeTrackerSubsystem::GetSDKVersion() const
 bool UBeamEyeTrackerSubsystem::IsBeamAppRunning() const
 {
 	
-	if (DataSource)
+	if (DataSource && !IsStartPending() && !IsTrackingStale())
 	{
 		return DataSource->GetHealth() == EBeamHealth::Ok;
 	}
@@ -297,36 +706,198 @@ void UBeamEyeTrackerSubsystem::StartPollingThread()
 		class FBeamSubsystemRunnable : public FRunnable
 		{
 		public:
-			FBeamSubsystemRunnable(UBeamEyeTrackerSubsystem* InSubsystem) : Subsystem(InSubsystem) {}
+			FBeamSubsystemRunnable(UBeamEyeTrackerSubsystem* InSubsystem, double InStallTimeoutSeconds)
+				: Subsystem(InSubsystem)
+				, StallTimeoutSeconds(InStallTimeoutSeconds)
+			{
+			}
 			
-			virtual bool Init() override { return true; }
+			virtual bool Init() override { return Subsystem && Subsystem->DataSource && Subsystem->FrameBuffer; }
 			virtual uint32 Run() override 
 			{ 
-				// Simple background thread that just sleeps
-				// The actual data polling is handled by the data source
+				LLM_SCOPE_BYTAG(BeamEyeTracker);
+				GBeamResources.RegisterCurrentThread(TEXT("BeamEyeTracker_Producer"));
+
+				// Producer loop: the game thread picks how to wake up, see BeamPollingScheduler.h
+				FBeamFrame Frame;
+				double LastSDKTimestampMs = 0.0;
+				int64 LastFrameId = INDEX_NONE;
+
+				// Zero so the snapshot current at thread start is applied before the first frame
+				uint32 AppliedSettingsVersion = 0;
+
+				// This reference keeps a removed observer alive until the producer has moved on to the new list
+				TSharedPtr<const FFrameObserverList, ESPMode::ThreadSafe> Observers = Subsystem->GetFrameObservers();
+				uint32 AppliedObserversVersion = Subsystem->FrameObserversVersion.load(std::memory_order_acquire);
+
+				// Out-of-range value so the schedule current at thread start is applied before the first wait
+				uint32 AppliedSchedule = MAX_uint32;
+				FBeamProducerSchedule Schedule;
 				while (!Subsystem->bStopPolling)
 				{
-					FPlatformProcess::Sleep(0.016f); // ~60Hz sleep
+					const uint32 PackedSchedule = Subsystem->ProducerSchedule.load(std::memory_order_relaxed);
+					if (PackedSchedule != AppliedSchedule)
+					{
+						// Only an event-driven schedule keeps the source signalling; a timed poll must not be woken per frame
+						Schedule = FBeamProducerSchedule::Unpack(PackedSchedule);
+						const bool bSignalling = Subsystem->DataSource->SetFrameEvent(Schedule.Mode == EBeamProducerWakeMode::EventDriven ? Subsystem->ProducerWakeEvent : nullptr);
+						if (Schedule.Mode == EBeamProducerWakeMode::EventDriven && !bSignalling)
+						{
+							Schedule.Mode = EBeamProducerWakeMode::BlockingWait;
+						}
+						Subsystem->ActiveWakeMode.store(static_cast<uint8>(Schedule.Mode), std::memory_order_relaxed);
+						AppliedSchedule = PackedSchedule;
+					}
+
+					bool bHasFrame = false;
+					if (Schedule.Mode == EBeamProducerWakeMode::BlockingWait)
+					{
+						bHasFrame = Subsystem->DataSource->WaitForNextFrame(Frame, Schedule.IntervalMs);
+					}
+					else
+					{
+						// Event-driven: the source triggers the event per frame; timed poll: only schedule changes and shutdown do
+						Subsystem->ProducerWakeEvent->Wait(Schedule.IntervalMs);
+						bHasFrame = !Subsystem->bStopPolling && Subsystem->DataSource->WaitForNextFrame(Frame, 0);
+					}
+
+					if (!bHasFrame)
+					{
+						// The producer owns the source, so it rebuilds the listener itself; the game thread only sees the stale flag
+						if (StallTimeoutSeconds > 0.0 && Subsystem->GetSecondsSinceSourceActivity(FPlatformTime::Seconds()) > StallTimeoutSeconds)
+						{
+							Subsystem->RunWatchdogRecovery(Subsystem->bStopPolling);
+							LastSDKTimestampMs = 0.0;
+							LastFrameId = INDEX_NONE;
+						}
+						continue;
+					}
+
+					BEAM_TRACE_BEGIN(FBeamTrace::ETraceCategory::Polling, TEXT("Beam.ProduceFrame"));
+					BEAM_TRACE_FRAME(Frame);
+
+					// Sources number frames in their own sequence, so a gap is frames that never reached the ring; a lower id is a restart
+					if (LastFrameId != INDEX_NONE && Frame.FrameId > LastFrameId + 1)
+					{
+						const uint64 Missed = static_cast<uint64>(Frame.FrameId - LastFrameId - 1);
+						if (Schedule.Mode == EBeamProducerWakeMode::TimedPoll)
+						{
+							Subsystem->SourceDecimatedFrames.fetch_add(Missed, std::memory_order_relaxed);
+						}
+						else
+						{
+							Subsystem->SourceDroppedFrames.fetch_add(Missed, std::memory_order_relaxed);
+							BEAM_TRACE_INSTANT(FBeamTrace::ETraceCategory::QueueDepth, TEXT("Beam.SourceDrop"));
+						}
+					}
+					LastFrameId = Frame.FrameId;
+
+					// Filter step uses the tracker clock so jitter in wake-up time does not leak into smoothing
+					const double DeltaSeconds = LastSDKTimestampMs > 0.0 ? (Frame.SDKTimestampMs - LastSDKTimestampMs) * 0.001 : 0.0;
+					LastSDKTimestampMs = Frame.SDKTimestampMs;
+					Frame.DeltaTimeSeconds = DeltaSeconds;
+
+					// Polled intervals measure the poll, not the tracker, so the estimate holds while polling
+					if (Schedule.Mode != EBeamProducerWakeMode::TimedPoll)
+					{
+						const float TrackerHz = BeamPollingScheduler::UpdateRateEstimate(Subsystem->ObservedTrackerHz.load(std::memory_order_relaxed), DeltaSeconds);
+						Subsystem->ObservedTrackerHz.store(TrackerHz, std::memory_order_relaxed);
+					}
+
+					if (FBeamFrameRing* RawSink = Subsystem->RawFrameSink.load(std::memory_order_acquire))
+					{
+						RawSink->Publish(Frame);
+					}
+
+					if (Subsystem->Filters)
+					{
+						// One atomic load per frame; the snapshot pointer is only fetched when a new one was published
+						if (Subsystem->GetRuntimeSettingsVersion() != AppliedSettingsVersion)
+						{
+							if (const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Snapshot = Subsystem->GetRuntimeSettings())
+							{
+								Subsystem->ApplyRuntimeSettingsToFilters(*Snapshot);
+								AppliedSettingsVersion = Snapshot->Version;
+							}
+						}
+						Subsystem->Filters->ApplyFilters(Frame, DeltaSeconds);
+					}
+
+					GBeamLatency.StampPublish(Frame);
+					Subsystem->FrameBuffer->Publish(Frame);
+					BEAM_TRACE_FRAME_PUBLISHED(Frame);
+					GBeamFlightRecorder.RecordFrame(Frame);
+
+					const uint32 ObserversVersion = Subsystem->FrameObserversVersion.load(std::memory_order_acquire);
+					if (ObserversVersion != AppliedObserversVersion)
+					{
+						Observers = Subsystem->GetFrameObservers();
+						AppliedObserversVersion = ObserversVersion;
+					}
+					if (Observers.IsValid())
+					{
+						for (const FBeamFrameObserverRef& Observer : *Observers)
+						{
+							Observer->OnFramePublished(Frame);
+						}
+					}
+					Subsystem->QueueNewFrameDispatch();
 				}
+
+				// The wake event is returned to the pool once this thread is gone, so the source must stop triggering it first
+				Subsystem->DataSource->SetFrameEvent(nullptr);
+				GBeamResources.UnregisterCurrentThread();
 				return 0; 
 			}
-			virtual void Stop() override {}
+			virtual void Stop() override
+			{
+				Subsystem->bStopPolling = true;
+				Subsystem->ProducerWakeEvent->Trigger();
+			}
 			virtual void Exit() override {}
 			
 		private:
 			UBeamEyeTrackerSubsystem* Subsystem;
+			double StallTimeoutSeconds;
 		};
 		
-		FRunnable* Runnable = new FBeamSubsystemRunnable(this);
+		EThreadPriority ThreadPriority = TPri_AboveNormal;
+		uint64 AffinityMask = FPlatformAffinity::GetNoAffinityMask();
+		if (Settings)
+		{
+			switch (Settings->ProducerThreadPriority)
+			{
+			case EBeamThreadPriority::Normal:       ThreadPriority = TPri_Normal; break;
+			case EBeamThreadPriority::AboveNormal:  ThreadPriority = TPri_AboveNormal; break;
+			case EBeamThreadPriority::Highest:      ThreadPriority = TPri_Highest; break;
+			case EBeamThreadPriority::TimeCritical: ThreadPriority = TPri_TimeCritical; break;
+			}
+			if (Settings->ProducerThreadAffinityMask != 0)
+			{
+				AffinityMask = static_cast<uint64>(Settings->ProducerThreadAffinityMask);
+			}
+		}
+
+		// The producer reads its first schedule before the ticker has run
+		ProducerWakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		UpdatePollingSchedule();
+
+		// 0 disables stall detection on the producer
+		const double StallTimeoutSeconds = IsWatchdogActive() ? Settings->WatchdogStallTimeoutMs * 0.001 : 0.0;
+		PollingRunnable = new FBeamSubsystemRunnable(this, StallTimeoutSeconds);
 		
-		PollingThread = FRunnableThread::Create(Runnable, TEXT("BeamEyeTracker_Subsystem"), 0, TPri_Normal);
+		PollingThread = FRunnableThread::Create(PollingRunnable, TEXT("BeamEyeTracker_Producer"), 0, ThreadPriority, AffinityMask);
 		if (PollingThread)
 		{
-			UE_LOG(LogBeam, Log, TEXT("Beam Eye Tracker: Polling thread started successfully"));
+			UE_LOG(LogBeam, Log, TEXT("Beam Eye Tracker: Producer thread started successfully"));
 		}
 		else
 		{
-			UE_LOG(LogBeam, Warning, TEXT("Beam Eye Tracker: Failed to start polling thread"));
+			UE_LOG(LogBeam, Warning, TEXT("Beam Eye Tracker: Failed to start producer thread"));
+			delete PollingRunnable;
+			PollingRunnable = nullptr;
+			FPlatformProcess::ReturnSynchEventToPool(ProducerWakeEvent);
+			ProducerWakeEvent = nullptr;
 		}
 	}
 }
@@ -341,10 +912,24 @@ void UBeamEyeTrackerSubsystem::StopPollingThread()
 	
 	if (PollingThread)
 	{
+		// Kill(true) waits for the producer to leave its current blocking wait
 		PollingThread->Kill(true);
 		delete PollingThread;
 		PollingThread = nullptr;
 	}
+
+	if (PollingRunnable)
+	{
+		delete PollingRunnable;
+		PollingRunnable = nullptr;
+	}
+
+	if (ProducerWakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(ProducerWakeEvent);
+		ProducerWakeEvent = nullptr;
+	}
+	ActiveWakeMode.store(static_cast<uint8>(EBeamProducerWakeMode::BlockingWait), std::memory_order_relaxed);
 }
 
 uint32 UBeamEyeTrackerSubsystem::PollingThreadFunction(void* Param)
@@ -363,107 +948,145 @@ uint32 UBeamEyeTrackerSubsystem::PollingThreadFunction(void* Param)
 
 void UBeamEyeTrackerSubsystem::ApplyRuntimeSettings(const UBeamEyeTrackerSettings* NewSettings)
 {
-	// Store the new settings
-	if (Settings && NewSettings)
+	if (!NewSettings)
 	{
-#if !UE_BUILD_SHIPPING
-		check(NewSettings != nullptr);
-#endif
-
-		UBeamEyeTrackerSettings* MutableSettings = GetMutableDefault<UBeamEyeTrackerSettings>();
-		if (MutableSettings)
-		{
-			// Copy the new values
-			MutableSettings->PollingHz = NewSettings->PollingHz;
-			MutableSettings->bEnableSmoothing = NewSettings->bEnableSmoothing;
-			MutableSettings->MinCutoff = NewSettings->MinCutoff;
-			MutableSettings->Beta = NewSettings->Beta;
-			MutableSettings->TraceDistance = NewSettings->TraceDistance;
-			MutableSettings->bAutoStart = NewSettings->bAutoStart;
-			
-			// Save to config
-			MutableSettings->SaveConfig();
-			
-			UE_LOG(LogBeam, Log, TEXT("Beam Eye Tracker: Applied runtime settings and saved to config"));
-		}
+		return;
 	}
-	
-	// Apply the new settings to the data source if it exists
-	if (DataSource)
+
+	FBeamRuntimeSettings NewSnapshot = FBeamRuntimeSettings::FromSettings(*NewSettings);
+
+	// Settings objects carry no filter type, so a non-default type chosen at runtime survives the apply
+	if (const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Current = GetRuntimeSettings())
 	{
-		// Restart tracking if polling frequency changed
-		bool bWasTracking = IsBeamTracking();
-		if (bWasTracking)
-		{
-			StopBeamTracking();
-		}
-		
-		// Reinitialize with new settings
-		if (Settings)
-		{
-			
-			int32 ViewportWidth = 1920;
-			int32 ViewportHeight = 1080;
-			
-			if (GEngine && GEngine->GameViewport)
-			{
-				FVector2D ViewportSize;
-				GEngine->GameViewport->GetViewportSize(ViewportSize);
-				ViewportWidth = static_cast<int32>(ViewportSize.X);
-				ViewportHeight = static_cast<int32>(ViewportSize.Y);
-			}
-			
-			DataSource->InitSDK(Settings->ApplicationName, ViewportWidth, ViewportHeight);
-		}
-		
-		// Restart if it was running before
-		if (bWasTracking)
-		{
-			StartBeamTracking();
-		}
+		NewSnapshot.FilterType = Current->FilterType;
 	}
+	ApplyRuntimeSnapshot(NewSnapshot);
 }
 
-void UBeamEyeTrackerSubsystem::GetEffectiveRuntimeSettings(int32& OutPollingHz, bool& OutEnableSmoothing, float& OutMinCutoff, float& OutBeta, float& OutTraceDistance) const
+void UBeamEyeTrackerSubsystem::ApplyRuntimeSnapshot(const FBeamRuntimeSettings& NewSettings)
 {
-#if !UE_BUILD_SHIPPING
-	check(Settings != nullptr);
-#endif
-	
-	if (Settings)
+	// Hot-applied: the producer picks the snapshot up before its next frame, tracking keeps running
+	PublishRuntimeSettings(NewSettings);
+	RequestSettingsSave(NewSettings);
+
+	UE_LOG(LogBeam, Log, TEXT("Beam Eye Tracker: Applied runtime settings (version %u)"), GetRuntimeSettingsVersion());
+}
+
+TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> UBeamEyeTrackerSubsystem::GetRuntimeSettings() const
+{
+	FScopeLock Lock(&RuntimeSettingsLock);
+	return RuntimeSettings;
+}
+
+void UBeamEyeTrackerSubsystem::PublishRuntimeSettings(FBeamRuntimeSettings NewSettings)
+{
+	check(IsInGameThread());
+
+	NewSettings.OneEuro.DataRate = static_cast<float>(NewSettings.PollingHz);
+	NewSettings.Version = RuntimeSettingsVersion.load(std::memory_order_relaxed) + 1;
+	OneEuroParams = NewSettings.OneEuro;
+	CurrentFilterType = NewSettings.GetEffectiveFilterType();
+
+	const TSharedRef<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Snapshot = MakeShared<const FBeamRuntimeSettings, ESPMode::ThreadSafe>(NewSettings);
 	{
-		OutPollingHz = Settings->PollingHz;
-		OutEnableSmoothing = Settings->bEnableSmoothing;
-		OutMinCutoff = Settings->MinCutoff;
-		OutBeta = Settings->Beta;
-		OutTraceDistance = Settings->TraceDistance;
+		FScopeLock Lock(&RuntimeSettingsLock);
+		RuntimeSettings = Snapshot;
 	}
-	else
+	RuntimeSettingsVersion.store(Snapshot->Version, std::memory_order_release);
+
+	if (TrackerRegistry)
 	{
-		// Fallback defaults
-		OutPollingHz = 120;
-		OutEnableSmoothing = true;
-		OutMinCutoff = 1.0f;
-		OutBeta = 0.2f;
-		OutTraceDistance = 5000.0f;
+		TrackerRegistry->SetRuntimeSettings(Snapshot);
 	}
-}
 
-bool UBeamEyeTrackerSubsystem::StartCameraRecentering()
-{
-	if (!DataSource)
+	// The producer owns the filters while it runs; otherwise nothing else touches them
+	if (Filters && !PollingThread)
 	{
-		return false;
+		ApplyRuntimeSettingsToFilters(*Snapshot);
 	}
-	
-	// Call the SDK to start camera recentering
-	return DataSource->StartCameraRecentering();
 }
 
-void UBeamEyeTrackerSubsystem::EndCameraRecentering()
+void UBeamEyeTrackerSubsystem::ApplyRuntimeSettingsToFilters(const FBeamRuntimeSettings& Snapshot)
 {
-	if (DataSource)
-	{
+	Filters->UpdateOneEuroParams(Snapshot.OneEuro);
+	Filters->SetFilterType(Snapshot.GetEffectiveFilterType());
+}
+
+void UBeamEyeTrackerSubsystem::RequestSettingsSave(const FBeamRuntimeSettings& Snapshot)
+{
+	// Every change pushes the deadline out, so dragging a slider writes the file once
+	PendingSettingsSave = Snapshot;
+	SettingsSaveDueSeconds = FPlatformTime::Seconds() + SettingsSaveDelaySeconds;
+
+	if (!SettingsSaveTickerHandle.IsValid())
+	{
+		SettingsSaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickSettingsSave), 0.5f);
+	}
+}
+
+bool UBeamEyeTrackerSubsystem::TickSettingsSave(float DeltaTime)
+{
+	if (PendingSettingsSave.IsSet() && FPlatformTime::Seconds() < SettingsSaveDueSeconds)
+	{
+		return true;
+	}
+
+	// Config objects may only be written on the game thread, which is where core tickers run
+	SettingsSaveTickerHandle.Reset();
+	FlushSettingsSave();
+	return false;
+}
+
+void UBeamEyeTrackerSubsystem::FlushSettingsSave()
+{
+	if (SettingsSaveTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SettingsSaveTickerHandle);
+		SettingsSaveTickerHandle.Reset();
+	}
+
+	if (!PendingSettingsSave.IsSet())
+	{
+		return;
+	}
+
+	if (UBeamEyeTrackerSettings* MutableSettings = GetMutableDefault<UBeamEyeTrackerSettings>())
+	{
+		PendingSettingsSave->CopyToSettings(*MutableSettings);
+		MutableSettings->SaveConfig();
+		UE_LOG(LogBeam, Log, TEXT("Beam Eye Tracker: Saved runtime settings to config"));
+	}
+	PendingSettingsSave.Reset();
+}
+
+void UBeamEyeTrackerSubsystem::GetEffectiveRuntimeSettings(int32& OutPollingHz, bool& OutEnableSmoothing, float& OutMinCutoff, float& OutBeta, float& OutTraceDistance) const
+{
+	// Fallback defaults until Initialize has published the first snapshot
+	const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Snapshot = GetRuntimeSettings();
+	const FBeamRuntimeSettings Effective = Snapshot.IsValid() ? *Snapshot : FBeamRuntimeSettings();
+
+	OutPollingHz = Effective.PollingHz;
+	OutEnableSmoothing = Effective.bEnableSmoothing;
+	OutMinCutoff = Effective.OneEuro.MinCutoff;
+	OutBeta = Effective.OneEuro.Beta;
+	OutTraceDistance = Effective.TraceDistance;
+}
+
+bool UBeamEyeTrackerSubsystem::StartCameraRecentering()
+{
+	if (!DataSource)
+	{
+		return false;
+	}
+	
+	// Call the SDK to start camera recentering
+	return DataSource->StartCameraRecentering();
+}
+
+void UBeamEyeTrackerSubsystem::EndCameraRecentering()
+{
+	if (DataSource)
+	{
 		DataSource->EndCameraRecentering();
 	}
 }
@@ -481,6 +1104,16 @@ void UBeamEyeTrackerSubsystem::GetViewportDimensions(int32& OutWidth, int32& Out
 	// Default to common resolution if we can't get actual viewport
 	OutWidth = 1920;
 	OutHeight = 1080;
+
+	// The primary registered viewport is what the tracker normalizes against
+	FIntPoint PrimaryOriginPx;
+	FIntPoint PrimarySizePx;
+	if (ViewportRegistry && ViewportRegistry->GetRect(ViewportRegistry->GetPrimaryId(), PrimaryOriginPx, PrimarySizePx))
+	{
+		OutWidth = PrimarySizePx.X;
+		OutHeight = PrimarySizePx.Y;
+		return;
+	}
 	
 	// Try to get the actual viewport dimensions from the game viewport
 	if (GEngine && GEngine->GameViewport)
@@ -566,8 +1199,18 @@ check(ViewportWidth <= 7680 && ViewportHeight <= 4320);
 
 void UBeamEyeTrackerSubsystem::AutoUpdateViewport()
 {
-	if (!DataSource || !DataSource->IsSDKInitialized())
+	if (!DataSource || IsStartPending() || IsTrackingStale() || !DataSource->IsSDKInitialized())
+	{
+		return;
+	}
+
+	// With a registered viewport the rectangle, origin included, comes from the registry; unchanged rectangles cost nothing
+	if (ViewportRegistry && ViewportRegistry->Num() > 0)
 	{
+		if (ViewportRegistry->Refresh())
+		{
+			PushPrimaryViewportRect();
+		}
 		return;
 	}
 
@@ -577,6 +1220,134 @@ void UBeamEyeTrackerSubsystem::AutoUpdateViewport()
 	UpdateViewportGeometry(ViewportWidth, ViewportHeight);
 }
 
+// VIEWPORT MAPPING
+
+void UBeamEyeTrackerSubsystem::RegisterGameViewport()
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	UGameViewportClient* ViewportClient = GameInstance ? GameInstance->GetGameViewportClient() : nullptr;
+	FSceneViewport* Viewport = ViewportClient ? ViewportClient->GetGameViewport() : nullptr;
+	if (!ViewportRegistry || !Viewport || ViewportRegistry->FindId(Viewport) != FBeamViewportRegistry::InvalidId)
+	{
+		return;
+	}
+
+	const int32 ViewportId = ViewportRegistry->Register(Viewport);
+	if (ViewportRegistry->GetPrimaryId() == ViewportId)
+	{
+		PushPrimaryViewportRect();
+	}
+}
+
+int32 UBeamEyeTrackerSubsystem::RegisterGazeViewport(FSceneViewport* Viewport)
+{
+	if (!ViewportRegistry)
+	{
+		return FBeamViewportRegistry::InvalidId;
+	}
+
+	const bool bFirst = ViewportRegistry->Num() == 0;
+	const int32 ViewportId = ViewportRegistry->Register(Viewport);
+	if (bFirst && ViewportId != FBeamViewportRegistry::InvalidId)
+	{
+		PushPrimaryViewportRect();
+	}
+	return ViewportId;
+}
+
+void UBeamEyeTrackerSubsystem::UnregisterGazeViewport(int32 ViewportId)
+{
+	if (!ViewportRegistry)
+	{
+		return;
+	}
+
+	const bool bWasPrimary = ViewportRegistry->GetPrimaryId() == ViewportId;
+	ViewportRegistry->Unregister(ViewportId);
+	if (bWasPrimary)
+	{
+		PushPrimaryViewportRect();
+	}
+}
+
+bool UBeamEyeTrackerSubsystem::SetPrimaryGazeViewport(int32 ViewportId)
+{
+	if (!ViewportRegistry || !ViewportRegistry->SetPrimary(ViewportId))
+	{
+		return false;
+	}
+
+	PushPrimaryViewportRect();
+	return true;
+}
+
+int32 UBeamEyeTrackerSubsystem::GetPrimaryGazeViewport() const
+{
+	return ViewportRegistry ? ViewportRegistry->GetPrimaryId() : FBeamViewportRegistry::InvalidId;
+}
+
+bool UBeamEyeTrackerSubsystem::GetGazeInViewport(int32 ViewportId, FVector2D& OutScreen01) const
+{
+	FBeamFrame Frame;
+	return ViewportRegistry
+		&& FetchCurrentFrame(Frame)
+		&& Frame.Gaze.bValid
+		&& ViewportRegistry->MapToViewport(ViewportId, Frame.Gaze.Screen01, OutScreen01);
+}
+
+bool UBeamEyeTrackerSubsystem::GetGazeForPlayer(const APlayerController* PlayerController, FVector2D& OutScreen01) const
+{
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	UGameViewportClient* ViewportClient = LocalPlayer ? LocalPlayer->ViewportClient.Get() : nullptr;
+	FSceneViewport* Viewport = ViewportClient ? ViewportClient->GetGameViewport() : nullptr;
+	if (!ViewportRegistry || !Viewport || LocalPlayer->Size.X <= 0.0f || LocalPlayer->Size.Y <= 0.0f)
+	{
+		return false;
+	}
+
+	FVector2D Viewport01;
+	if (!GetGazeInViewport(ViewportRegistry->FindId(Viewport), Viewport01))
+	{
+		return false;
+	}
+
+	// Split-screen players own an Origin/Size sub-rectangle of the viewport, both as viewport fractions
+	OutScreen01 = (Viewport01 - FVector2D(LocalPlayer->Origin)) / FVector2D(LocalPlayer->Size);
+	return true;
+}
+
+void UBeamEyeTrackerSubsystem::HandleViewportResized(FViewport* Viewport, uint32 Unused)
+{
+	// Resize events fire for every viewport in the process; only registered ones have a cached transform
+	const FSceneViewport* SceneViewport = static_cast<const FSceneViewport*>(Viewport);
+	if (ViewportRegistry && ViewportRegistry->FindId(SceneViewport) != FBeamViewportRegistry::InvalidId && ViewportRegistry->Refresh(SceneViewport))
+	{
+		PushPrimaryViewportRect();
+	}
+}
+
+bool UBeamEyeTrackerSubsystem::TickViewportMapping(float DeltaTime)
+{
+	if (ViewportRegistry && ViewportRegistry->Num() > 0 && ViewportRegistry->Refresh())
+	{
+		PushPrimaryViewportRect();
+	}
+	return true;
+}
+
+void UBeamEyeTrackerSubsystem::PushPrimaryViewportRect()
+{
+	FIntPoint OriginPx;
+	FIntPoint SizePx;
+	if (!DataSource || IsStartPending() || IsTrackingStale() || !ViewportRegistry
+		|| !ViewportRegistry->GetRect(ViewportRegistry->GetPrimaryId(), OriginPx, SizePx))
+	{
+		return;
+	}
+
+	DataSource->UpdateViewportRect(OriginPx, SizePx);
+}
+
 // CALIBRATION METHODS
 
 bool UBeamEyeTrackerSubsystem::StartCalibration(const FString& ProfileId)
@@ -624,8 +1395,8 @@ check(bIsCalibrating);
 		return;
 	}
 
+	// The profile stays current for per-user state such as tuned filters until ResetCalibration
 	bIsCalibrating = false;
-	CurrentCalibrationProfile.Empty();
 
 	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Calibration stopped"));
 }
@@ -642,8 +1413,9 @@ void UBeamEyeTrackerSubsystem::ResetCalibration()
 		StopCalibration();
 	}
 
-	// Reset calibration state
+	// Reset calibration state; the last validation measured the old calibration
 	CurrentCalibrationProfile.Empty();
+	LastCalibrationQuality = FCalibrationQuality();
 
 	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Calibration reset"));
 }
@@ -674,199 +1446,1043 @@ check(&OutFrame != nullptr);
 	return FrameBuffer->GetFrameAt(TimestampMs, OutFrame);
 }
 
-bool UBeamEyeTrackerSubsystem::GetLatestInterpolatedFrame(double DeltaSeconds, FBeamFrame& OutFrame) const
+bool UBeamEyeTrackerSubsystem::GetFrameAtPlatformTime(double PlatformSeconds, FBeamFrame& OutFrame) const
 {
-#if !UE_BUILD_SHIPPING
-check(DeltaSeconds >= 0.0);
-check(&OutFrame != nullptr);
-#endif
-	
 	if (!FrameBuffer)
 	{
 		return false;
 	}
-	
-	return FrameBuffer->GetLatestInterpolatedFrame(DeltaSeconds, OutFrame);
-}
-
-// HEALTH AND STATUS METHODS
-
-EBeamHealth UBeamEyeTrackerSubsystem::GetHealth() const
-{
-	if (!DataSource)
-	{
-		return EBeamHealth::Error;
-	}
-	
-	if (!DataSource->IsSDKInitialized())
-	{
-		return EBeamHealth::AppNotRunning;
-	}
 
-	if (!DataSource->IsValid())
+	// Sources without a tracker clock still pair both timestamps on every frame
+	double OffsetSeconds = 0.0;
+	if (!DataSource || !DataSource->GetClockOffsetSeconds(OffsetSeconds))
 	{
-		return EBeamHealth::AppNotRunning;
+		FBeamFrame Latest;
+		if (!FrameBuffer->ReadLatest(Latest))
+		{
+			return false;
+		}
+		OffsetSeconds = Latest.UETimestampSeconds - Latest.SDKTimestampMs * 0.001;
 	}
 
-	if (FrameBuffer && FrameBuffer->GetBufferUtilization() > 0.0f)
-	{
-		return EBeamHealth::Ok;
-	}
-	
-	return EBeamHealth::NoData;
+	return FrameBuffer->GetFrameAt((PlatformSeconds - OffsetSeconds) * 1000.0, OutFrame);
 }
 
-// DATA SOURCE CONFIGURATION
-
-void UBeamEyeTrackerSubsystem::SetDataSourceType(EBeamDataSourceType NewType, const FString& FilePath)
+bool UBeamEyeTrackerSubsystem::GetInterpolatedFrameAt(double TimestampMs, FBeamFrame& OutFrame) const
 {
 #if !UE_BUILD_SHIPPING
-			check(NewType != EBeamDataSourceType::Live);
+check(TimestampMs >= 0.0);
 #endif
 	
-	DataSourceType = NewType;
-	
-	// Reinitialize data source if needed
-	if (DataSource && DataSource->IsSDKInitialized())
+	if (!FrameBuffer)
 	{
-		
-		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Data source type changed to %d with path '%s'"), 
-			static_cast<int32>(NewType), *FilePath);
+		return false;
 	}
+	
+	return FrameBuffer->GetInterpolatedFrameAt(TimestampMs, OutFrame);
 }
 
-// WORLD MAPPING METHODS
-
-bool UBeamEyeTrackerSubsystem::ProjectGazeToWorld(const APlayerController* PlayerController, FVector& OutRayOrigin, FVector& OutRayDirection) const
+bool UBeamEyeTrackerSubsystem::GetLatestInterpolatedFrame(double DeltaSeconds, FBeamFrame& OutFrame) const
 {
 #if !UE_BUILD_SHIPPING
-check(PlayerController != nullptr);
+check(DeltaSeconds >= 0.0);
+check(&OutFrame != nullptr);
 #endif
 	
-	if (!PlayerController || !FrameBuffer)
-	{
-		return false;
-	}
-
-	FGazePoint GazePoint = CurrentGaze();
-	if (!GazePoint.bValid)
+	if (!FrameBuffer)
 	{
 		return false;
 	}
-
-	FVector CameraLocation;
-	FRotator CameraRotation;
-	PlayerController->GetPlayerViewPoint(CameraLocation, CameraRotation);
-
-	OutRayOrigin = CameraLocation;
-	
-	// Convert screen coordinates to world direction
-	FVector WorldDirection;
-	if (PlayerController->DeprojectScreenPositionToWorld(GazePoint.ScreenPx.X, GazePoint.ScreenPx.Y, OutRayOrigin, WorldDirection))
-	{
-		OutRayDirection = WorldDirection;
-		return true;
-	}
 	
-	return false;
+	return FrameBuffer->GetLatestInterpolatedFrame(DeltaSeconds, OutFrame);
 }
 
-// PERFORMANCE METRICS
-
-float UBeamEyeTrackerSubsystem::GetBufferUtilization() const
+void UBeamEyeTrackerSubsystem::UpdatePredictor()
 {
-	if (!FrameBuffer)
+	// Between game frames at most a handful of samples arrive; anything older than the window only affects history
+	static constexpr int32 MaxCatchUpFrames = 16;
+	FrameBuffer->CopyLatestFrames(MaxCatchUpFrames, PredictorScratch);
+
+	const int64 LastFrameId = Predictor->GetLastFrameId();
+	for (const FBeamFrame& Frame : PredictorScratch)
 	{
-		return 0.0f;
+		if (Frame.FrameId > LastFrameId)
+		{
+			Predictor->AddSample(Frame);
+		}
 	}
-	
-	return static_cast<float>(FrameBuffer->GetBufferUtilization()) / 100.0f;
 }
 
-float UBeamEyeTrackerSubsystem::GetTrackingFPS() const
+bool UBeamEyeTrackerSubsystem::GetPredictedFrame(FBeamFrame& OutFrame)
 {
-	if (!DataSource)
+	if (!FrameBuffer || !Predictor || !Settings)
 	{
-		return 0.0f;
+		return false;
 	}
-	
-	// Calculate actual FPS based on frame timing
-	if (FrameBuffer && FrameCount > 1)
+
+	UpdatePredictor();
+
+	FBeamFrame Latest;
+	if (!FrameBuffer->ReadLatest(Latest))
 	{
-		const double CurrentTime = FPlatformTime::Seconds();
-		const double TimeSpan = CurrentTime - LastFrameTime;
-		
-		if (TimeSpan > 0.0)
-		{
-			return 1.0f / static_cast<float>(TimeSpan);
-		}
+		return false;
 	}
-	
-	// Return a reasonable default if we can't calculate
-	return 60.0f;
-}
 
-// DEBUG AND SETTINGS METHODS
+	const double HorizonMs = FBeamGazePredictor::GetDisplayHorizonMs(Latest.UETimestampSeconds, Settings->PredictionRenderLatencyFrames);
+	return Predictor->Predict(HorizonMs, OutFrame);
+}
 
-void UBeamEyeTrackerSubsystem::SetDebugHUDEnabled(bool bEnabled)
+bool UBeamEyeTrackerSubsystem::PredictFrame(float HorizonMs, FBeamFrame& OutFrame)
 {
-	// This would typically update a debug HUD flag in the subsystem
-	
-	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Debug HUD %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+	if (!FrameBuffer || !Predictor)
+	{
+		return false;
+	}
+
+	UpdatePredictor();
+	return Predictor->Predict(HorizonMs, OutFrame);
 }
 
-void UBeamEyeTrackerSubsystem::SetPollingRate(int32 NewRateHz)
+void UBeamEyeTrackerSubsystem::AddFoveationUser()
 {
-	if (NewRateHz <= 0 || NewRateHz > 1000)
+	++FoveationUserCount;
+	if (GazeViewExtension.IsValid() || !FrameBuffer || !Settings)
 	{
-		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Invalid polling rate %d Hz, must be 1-1000"), NewRateHz);
 		return;
 	}
 
-	if (DataSource)
-	{
-		// This would typically call a method on the data source to update polling rate
-		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Polling rate changed to %d Hz"), NewRateHz);
-	}
+	FBeamFoveationConfig Config;
+	Config.NormalizedRadii[0] = Settings->FoveationInnerRadius;
+	Config.NormalizedRadii[1] = Settings->FoveationMiddleRadius;
+	Config.NormalizedRadii[2] = Settings->FoveationOuterRadius;
+	Config.RenderLatencyFrames = Settings->FoveationRenderLatencyFrames;
+	Config.PredictorParams = Settings->GetPredictorParams();
+	Config.bBuildShadingRateImage = Settings->bFoveationShadingRateImage;
+	Config.ConfidenceExpansion = Settings->FoveationConfidenceExpansion;
+	Config.PredictionErrorScale = Settings->FoveationPredictionErrorScale;
+	Config.FallbackRadiusScale = Settings->FoveationFallbackRadiusScale;
+
+	GazeViewExtension = FSceneViewExtensions::NewExtension<FBeamGazeViewExtension>(FrameBuffer, Config);
+	GazeViewExtension->SetHealth(GetBeamHealth());
+	UE_LOG(LogBeam, Log, TEXT("Gaze view extension registered for foveation"));
 }
 
-void UBeamEyeTrackerSubsystem::SetSmoothingEnabled(bool bEnabled)
+void UBeamEyeTrackerSubsystem::RemoveFoveationUser()
 {
-	
-	if (Filters)
+	FoveationUserCount = FMath::Max(0, FoveationUserCount - 1);
+	if (FoveationUserCount == 0)
 	{
-		// This would typically call a method on the filters to enable/disable smoothing
-		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Smoothing %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+		ReleaseGazeViewExtension();
 	}
 }
 
-void UBeamEyeTrackerSubsystem::SetMinCutoff(float NewMinCutoff)
+void UBeamEyeTrackerSubsystem::ReleaseGazeViewExtension()
 {
-	if (NewMinCutoff < 0.0f || NewMinCutoff > 100.0f)
+	if (!GazeViewExtension.IsValid())
 	{
-		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Invalid min cutoff %f, must be 0.0-100.0"), NewMinCutoff);
 		return;
 	}
 
-	if (Filters)
-	{
-		// This would typically call a method on the filters to update min cutoff
-		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Min cutoff changed to %f"), NewMinCutoff);
-	}
+	GazeViewExtension->Detach();
+	GazeViewExtension.Reset();
+	FlushRenderingCommands();
 }
 
-void UBeamEyeTrackerSubsystem::SetBeta(float NewBeta)
+FGazePoint UBeamEyeTrackerSubsystem::PredictGazePoint(const FGazePoint& InSample, float HorizonMs)
 {
-	if (NewBeta < 0.0f || NewBeta > 1.0f)
+	if (!FrameBuffer || !Predictor)
 	{
-		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Invalid beta %f, must be 0.0-1.0"), NewBeta);
+		return InSample;
 	}
 
-	if (Filters)
-	{
-		// This would typically call a method on the filters to update beta
-		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Beta changed to %f"), NewBeta);
-	}
+	UpdatePredictor();
+	return Predictor->PredictGaze(InSample, HorizonMs);
+}
+
+int32 UBeamEyeTrackerSubsystem::TakeFrameSnapshot(TArray<FBeamFrame>& OutFrames)
+{
+	if (!FrameBuffer)
+	{
+		OutFrames.Reset();
+		return 0;
+	}
+
+	return FrameBuffer->TakeSnapshot(OutFrames);
+}
+
+int32 UBeamEyeTrackerSubsystem::CopyFramesInRange(double T0Ms, double T1Ms, TArray<FBeamFrame>& OutFrames) const
+{
+	if (!FrameBuffer)
+	{
+		OutFrames.Reset();
+		return 0;
+	}
+
+	return FrameBuffer->CopyFramesInRange(T0Ms, T1Ms, OutFrames);
+}
+
+int32 UBeamEyeTrackerSubsystem::CopyLatestFrames(int32 Count, TArray<FBeamFrame>& OutFrames) const
+{
+	if (!FrameBuffer)
+	{
+		OutFrames.Reset();
+		return 0;
+	}
+
+	return FrameBuffer->CopyLatestFrames(Count, OutFrames);
+}
+
+bool UBeamEyeTrackerSubsystem::VisitFramesInRange(double T0Ms, double T1Ms, TFunctionRef<void(TArrayView<const FBeamFrame>)> Visitor) const
+{
+	return FrameBuffer ? FrameBuffer->VisitFramesInRange(T0Ms, T1Ms, Visitor) : true;
+}
+
+bool UBeamEyeTrackerSubsystem::VisitGazeColumnsInRange(double T0Ms, double T1Ms, TFunctionRef<void(const FBeamGazeColumns&)> Visitor) const
+{
+	return FrameBuffer ? FrameBuffer->VisitGazeColumnsInRange(T0Ms, T1Ms, Visitor) : false;
+}
+
+// HEALTH AND STATUS METHODS
+
+EBeamHealth UBeamEyeTrackerSubsystem::EvaluateHealth() const
+{
+	if (!DataSource)
+	{
+		return EBeamHealth::Error;
+	}
+
+	if (IsStartPending())
+	{
+		return EBeamHealth::AppNotRunning;
+	}
+
+	if (IsTrackingStale())
+	{
+		return EBeamHealth::Recovering;
+	}
+	
+	if (!DataSource->IsSDKInitialized())
+	{
+		return EBeamHealth::AppNotRunning;
+	}
+
+	// Cached by the source from the SDK's status events, so this does not call into the SDK
+	if (!DataSource->IsValid() || DataSource->GetHealth() == EBeamHealth::AppNotRunning)
+	{
+		return EBeamHealth::AppNotRunning;
+	}
+
+	// Frames a stopped session left in the ring are not live data
+	if (bTrackingSessionActive && FrameBuffer && FrameBuffer->GetBufferUtilization() > 0.0f)
+	{
+		return EBeamHealth::Ok;
+	}
+	
+	return EBeamHealth::NoData;
+}
+
+void UBeamEyeTrackerSubsystem::SetHealth(EBeamHealth NewHealth)
+{
+	if (CurrentHealth.exchange(NewHealth, std::memory_order_relaxed) != NewHealth)
+	{
+		if (GazeViewExtension.IsValid())
+		{
+			GazeViewExtension->SetHealth(NewHealth);
+		}
+		OnHealthChanged.Broadcast(NewHealth);
+	}
+}
+
+bool UBeamEyeTrackerSubsystem::VerifyDLLSafety()
+{
+#if PLATFORM_WINDOWS
+	// Runs on the start worker: resolving the delay-loaded client here keeps the load off the game thread,
+	// and a missing DLL becomes a health state rather than a delay-load exception on the first SDK call
+	if (SDKDllHandle)
+	{
+		return true;
+	}
+
+	const TCHAR* DllName = TEXT("beam_eye_tracker_client_MT.dll");
+	void* Handle = FPlatformProcess::GetDllHandle(DllName);
+	if (!Handle)
+	{
+		const FString PluginBinDir = FPaths::Combine(FPaths::ProjectPluginsDir(), TEXT("BeamEyeTracker"), TEXT("ThirdParty"), TEXT("BeamSDK"), TEXT("bin"), TEXT("win64"));
+		Handle = FPlatformProcess::GetDllHandle(*FPaths::Combine(PluginBinDir, DllName));
+	}
+
+	if (!Handle)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: %s could not be loaded"), DllName);
+		return false;
+	}
+
+	SDKDllHandle = Handle;
+	return true;
+#else
+	return !BEAM_STUB_PLATFORM;
+#endif
+}
+
+// WATCHDOG
+
+bool UBeamEyeTrackerSubsystem::IsWatchdogActive() const
+{
+	return Settings && Settings->bEnableWatchdog && DataSource && bTrackingSessionActive
+		&& DataSourceType == EBeamDataSourceType::Live && !IsPlayingBack() && !IsStartPending();
+}
+
+double UBeamEyeTrackerSubsystem::GetSecondsSinceSourceActivity(double NowSeconds) const
+{
+	double LastSeconds = LastDataTime.load(std::memory_order_relaxed);
+	FBeamFrame Latest;
+	if (FrameBuffer && FrameBuffer->ReadLatest(Latest))
+	{
+		LastSeconds = FMath::Max(LastSeconds, Latest.PublishedSeconds);
+	}
+
+	// An absent user stops frames but not state sets; only the SDK going quiet is a stall
+	double ActivitySeconds = 0.0;
+	if (DataSource && DataSource->GetLastActivitySeconds(ActivitySeconds))
+	{
+		LastSeconds = FMath::Max(LastSeconds, ActivitySeconds);
+	}
+	return NowSeconds - LastSeconds;
+}
+
+void UBeamEyeTrackerSubsystem::GetWatchdogStatus(int32& OutStatus, float& OutRetryDelay) const
+{
+	EBeamWatchdogState State = EBeamWatchdogState::Disabled;
+	if (IsTrackingStale())
+	{
+		State = EBeamWatchdogState::Recovering;
+	}
+	else if (IsWatchdogActive())
+	{
+		State = EBeamWatchdogState::Monitoring;
+	}
+
+	OutStatus = static_cast<int32>(State);
+	OutRetryDelay = static_cast<float>(RecoveryBackoffTime.load(std::memory_order_relaxed));
+}
+
+void UBeamEyeTrackerSubsystem::RunWatchdogRecovery(const FThreadSafeBool& bStop)
+{
+	bWatchdogRecovering.store(true, std::memory_order_release);
+	UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: No data from the SDK for %.1fs, reconnecting to the Beam app"), GetSecondsSinceSourceActivity(FPlatformTime::Seconds()));
+
+	const double InitialBackoff = FMath::Max(Settings->WatchdogInitialBackoffMs, 10) * 0.001;
+	const double MaxBackoff = FMath::Max(Settings->WatchdogMaxBackoffMs, Settings->WatchdogInitialBackoffMs) * 0.001;
+
+	while (!bStop)
+	{
+		// Shutdown unregisters the listener before the API goes, Initialize builds both again
+		DataSource->Shutdown();
+		if (DataSource->Initialize())
+		{
+			UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Reconnected after %d failed attempts"), ConsecutiveFailures.load(std::memory_order_relaxed));
+			break;
+		}
+
+		const int32 Failures = ConsecutiveFailures.fetch_add(1, std::memory_order_relaxed) + 1;
+		const double Backoff = FMath::Min(InitialBackoff * FMath::Pow(2.0, static_cast<double>(FMath::Min(Failures - 1, 30))), MaxBackoff);
+		RecoveryBackoffTime.store(Backoff, std::memory_order_relaxed);
+		UE_LOG(LogBeam, Verbose, TEXT("BeamEyeTracker: Reconnect attempt %d failed, retrying in %.2fs"), Failures, Backoff);
+
+		// Sleep in slices so a stop is never held up by a long backoff
+		const double RetrySeconds = FPlatformTime::Seconds() + Backoff;
+		while (!bStop && FPlatformTime::Seconds() < RetrySeconds)
+		{
+			FPlatformProcess::Sleep(0.05f);
+		}
+	}
+
+	ConsecutiveFailures.store(0, std::memory_order_relaxed);
+	RecoveryBackoffTime.store(0.0, std::memory_order_relaxed);
+	LastDataTime.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+	bWatchdogRecovering.store(false, std::memory_order_release);
+}
+
+bool UBeamEyeTrackerSubsystem::TickWatchdog(float DeltaTime)
+{
+	// Health follows the recovery in both modes; the producer runs its own recovery, push mode gets a pool task
+	if (IsTrackingStale())
+	{
+		// Dumped once as the stall begins, with the frames leading up to it still in the recorder
+		if (GetBeamHealth() != EBeamHealth::Recovering)
+		{
+			GBeamFlightRecorder.RequestDump(EBeamFlightDumpReason::Stall);
+		}
+		SetHealth(EBeamHealth::Recovering);
+		return true;
+	}
+
+	// Sources without status events are polled here, once per watchdog tick, instead of by every health reader
+	if (DataSource)
+	{
+		DataSource->RefreshHealth();
+	}
+	// Idle health is re-evaluated too, so it follows the Beam app between sessions; a missing DLL holds until the next start
+	if (bTrackingSessionActive || CurrentHealth.load(std::memory_order_relaxed) != EBeamHealth::DllMissing)
+	{
+		SetHealth(EvaluateHealth());
+	}
+
+	if (WatchdogRecoveryTask.IsValid() && WatchdogRecoveryTask.IsReady())
+	{
+		WatchdogRecoveryTask.Reset();
+	}
+
+	if (PollingThread || WatchdogRecoveryTask.IsValid() || !IsWatchdogActive())
+	{
+		return true;
+	}
+
+	if (GetSecondsSinceSourceActivity(FPlatformTime::Seconds()) > Settings->WatchdogStallTimeoutMs * 0.001)
+	{
+		// Raised here rather than on the worker so no game-thread read can reach the source before the task starts
+		bWatchdogRecovering.store(true, std::memory_order_release);
+		bStopWatchdogRecovery = false;
+		GBeamFlightRecorder.RequestDump(EBeamFlightDumpReason::Stall);
+		SetHealth(EBeamHealth::Recovering);
+		WatchdogRecoveryTask = Async(EAsyncExecution::ThreadPool, [this]()
+		{
+			RunWatchdogRecovery(bStopWatchdogRecovery);
+		});
+	}
+	return true;
+}
+
+void UBeamEyeTrackerSubsystem::StopWatchdogRecovery()
+{
+	if (WatchdogRecoveryTask.IsValid())
+	{
+		bStopWatchdogRecovery = true;
+		WatchdogRecoveryTask.Wait();
+		WatchdogRecoveryTask.Reset();
+	}
+}
+
+// DATA SOURCE CONFIGURATION
+
+void UBeamEyeTrackerSubsystem::SetDataSourceType(EBeamDataSourceType NewType, const FString& FilePath)
+{
+#if !UE_BUILD_SHIPPING
+	check(FrameBuffer != nullptr);
+#endif
+
+	if (!FrameBuffer)
+	{
+		return;
+	}
+
+	// Keep the current source if the new one cannot be created
+	IBeamDataSource* NewSource = CreateDataSource(NewType, FilePath);
+	if (!NewSource)
+	{
+		LastErrorMessage = FString::Printf(TEXT("Data source type %d is not available"), static_cast<int32>(NewType));
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Cannot switch to data source type %d with path '%s'"), static_cast<int32>(NewType), *FilePath);
+		return;
+	}
+
+	// Recording playback owns the ring until it stops, and stopping it re-attaches the old source
+	if (IsPlayingBack())
+	{
+		StopPlayback();
+	}
+
+	const bool bWasTracking = IsBeamTracking();
+	StopBeamTracking();
+
+	if (DataSource)
+	{
+		DataSource->SetFrameSink(nullptr);
+		delete DataSource;
+	}
+	DataSource = NewSource;
+	DataSourceType = NewType;
+
+	// Nothing produces into the ring at this point, so frames from the old source can be dropped safely
+	FrameBuffer->Clear();
+	if (RawFrameBuffer)
+	{
+		RawFrameBuffer->Clear();
+	}
+	FrameCacheCounter = MAX_uint64;
+	if (Predictor)
+	{
+		Predictor->Reset();
+	}
+
+	if (Settings && !Settings->bUseProducerThread)
+	{
+		DataSource->SetFrameSink(FrameBuffer);
+	}
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Data source type changed to %d with path '%s'"), static_cast<int32>(NewType), *FilePath);
+
+	if (bWasTracking)
+	{
+		StartBeamTracking();
+	}
+}
+
+IBeamDataSource* UBeamEyeTrackerSubsystem::CreateDataSource(EBeamDataSourceType Type, const FString& FilePath)
+{
+	switch (Type)
+	{
+	case EBeamDataSourceType::Live:
+		return new FBeamEyeTrackerProvider();
+
+	case EBeamDataSourceType::File:
+	case EBeamDataSourceType::Recorded:
+		if (FilePath.IsEmpty() || !FPlatformFileManager::Get().GetPlatformFile().FileExists(*FilePath))
+		{
+			UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Recording '%s' for the file data source does not exist"), *FilePath);
+			return nullptr;
+		}
+		return new FBeamFileDataSource(FilePath, !Settings || Settings->bLoopFileDataSource);
+
+	case EBeamDataSourceType::Network:
+		return new FBeamNetworkDataSource(FilePath.IsEmpty() ? GetDefaultNetworkEndpoint() : FilePath, Settings ? Settings->NetworkJitterBufferMaxMs : 2.0f);
+
+#if BEAM_FEATURE_SYNTHETIC_DATA
+	case EBeamDataSourceType::Synthetic:
+	{
+		FBeamSyntheticParams SyntheticParams;
+		if (Settings)
+		{
+			SyntheticParams.RateHz = Settings->SyntheticRateHz;
+			SyntheticParams.Seed = Settings->SyntheticSeed;
+			SyntheticParams.bRealtime = Settings->bSyntheticRealtime;
+		}
+		return new FBeamSyntheticDataSource(SyntheticParams);
+	}
+#endif
+
+	default:
+		return nullptr;
+	}
+}
+
+// ADDITIONAL TRACKERS
+
+int32 UBeamEyeTrackerSubsystem::AddTracker(EBeamDataSourceType SourceType, const FString& Endpoint, FName Name)
+{
+	check(IsInGameThread());
+
+	if (!TrackerRegistry)
+	{
+		return INDEX_NONE;
+	}
+
+	if (SourceType == EBeamDataSourceType::Live && !VerifyDLLSafety())
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Cannot add a live tracker - Beam SDK client library could not be loaded"));
+		return INDEX_NONE;
+	}
+
+	IBeamDataSource* Source = CreateDataSource(SourceType, Endpoint);
+	if (!Source)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Cannot add a tracker of source type %d with endpoint '%s'"), static_cast<int32>(SourceType), *Endpoint);
+		return INDEX_NONE;
+	}
+
+	// Last game-thread access to the source; from here on only the tracker's task touches it
+	FIntPoint OriginPx;
+	FIntPoint SizePx;
+	if (ViewportRegistry && ViewportRegistry->GetRect(ViewportRegistry->GetPrimaryId(), OriginPx, SizePx))
+	{
+		Source->UpdateViewportRect(OriginPx, SizePx);
+	}
+
+	return TrackerRegistry->Add(Name.IsNone() ? FName(TEXT("Tracker")) : Name, SourceType, Source);
+}
+
+bool UBeamEyeTrackerSubsystem::RemoveTracker(int32 TrackerId)
+{
+	check(IsInGameThread());
+	return TrackerId != FBeamTrackerRegistry::PrimaryTrackerId && TrackerRegistry && TrackerRegistry->Remove(TrackerId);
+}
+
+void UBeamEyeTrackerSubsystem::GetTrackerIds(TArray<int32>& OutTrackerIds) const
+{
+	if (TrackerRegistry)
+	{
+		TrackerRegistry->GetIds(OutTrackerIds);
+	}
+	else
+	{
+		OutTrackerIds.Reset();
+	}
+	OutTrackerIds.Insert(FBeamTrackerRegistry::PrimaryTrackerId, 0);
+}
+
+bool UBeamEyeTrackerSubsystem::FetchTrackerFrame(int32 TrackerId, FBeamFrame& OutFrame) const
+{
+	if (TrackerId == FBeamTrackerRegistry::PrimaryTrackerId)
+	{
+		return FetchCurrentFrame(OutFrame);
+	}
+
+	const FBeamTrackerPipelinePtr Pipeline = TrackerRegistry ? TrackerRegistry->Find(TrackerId) : FBeamTrackerPipelinePtr();
+	return Pipeline.IsValid() && Pipeline->Ring.ReadLatest(OutFrame);
+}
+
+FBeamTrackerStats UBeamEyeTrackerSubsystem::GetTrackerStats(int32 TrackerId) const
+{
+	const FBeamTrackerPipelinePtr Pipeline = TrackerRegistry ? TrackerRegistry->Find(TrackerId) : FBeamTrackerPipelinePtr();
+	return Pipeline.IsValid() ? Pipeline->GetStats() : FBeamTrackerStats();
+}
+
+const FBeamFrameRing* UBeamEyeTrackerSubsystem::GetTrackerRing(int32 TrackerId) const
+{
+	check(IsInGameThread());
+
+	if (TrackerId == FBeamTrackerRegistry::PrimaryTrackerId)
+	{
+		return FrameBuffer;
+	}
+
+	// Only RemoveTracker and Deinitialize drop the registry's reference, both on the game thread
+	const FBeamTrackerPipelinePtr Pipeline = TrackerRegistry ? TrackerRegistry->Find(TrackerId) : FBeamTrackerPipelinePtr();
+	return Pipeline.IsValid() ? &Pipeline->Ring : nullptr;
+}
+
+// WORLD MAPPING METHODS
+
+bool UBeamEyeTrackerSubsystem::ProjectGazeToWorld(const APlayerController* PlayerController, FVector& OutRayOrigin, FVector& OutRayDirection) const
+{
+#if !UE_BUILD_SHIPPING
+check(PlayerController != nullptr);
+#endif
+	
+	if (!PlayerController || !FrameBuffer)
+	{
+		return false;
+	}
+
+	FBeamWorldRay Ray;
+	if (!GetGazeWorldRay(PlayerController, Ray))
+	{
+		return false;
+	}
+
+	OutRayOrigin = Ray.Origin;
+	OutRayDirection = Ray.Direction;
+	return true;
+}
+
+bool UBeamEyeTrackerSubsystem::GetGazeWorldRay(const APlayerController* PlayerController, FBeamWorldRay& OutRay) const
+{
+	const FGazeRayView* View = FindGazeRayView(PlayerController);
+	OutRay = View ? View->GazeRay : FBeamWorldRay();
+	return OutRay.bValid;
+}
+
+bool UBeamEyeTrackerSubsystem::DeprojectScreenPosition(const APlayerController* PlayerController, const FVector2D& ScreenPositionPx, FVector& OutOrigin, FVector& OutDirection) const
+{
+	const FGazeRayView* View = FindGazeRayView(PlayerController);
+	if (!View || !View->bViewValid)
+	{
+		return false;
+	}
+
+	FSceneView::DeprojectScreenToWorld(ScreenPositionPx, View->ViewRect, View->InvViewProjection, OutOrigin, OutDirection);
+	return true;
+}
+
+const UBeamEyeTrackerSubsystem::FGazeRayView* UBeamEyeTrackerSubsystem::FindGazeRayView(const APlayerController* PlayerController) const
+{
+	if (!IsInGameThread())
+	{
+		return nullptr;
+	}
+
+	if (!PlayerController)
+	{
+		const UGameInstance* GameInstance = GetGameInstance();
+		PlayerController = GameInstance ? GameInstance->GetFirstLocalPlayerController() : nullptr;
+		if (!PlayerController)
+		{
+			return nullptr;
+		}
+	}
+
+	FGazeRayView* Found = nullptr;
+	for (FGazeRayView& View : GazeRayViews)
+	{
+		if (View.PlayerController.Get() == PlayerController)
+		{
+			Found = &View;
+			break;
+		}
+	}
+
+	if (!Found)
+	{
+		// Players that left are dropped before a new one is added
+		GazeRayViews.RemoveAllSwap([](const FGazeRayView& View) { return !View.PlayerController.IsValid(); });
+		Found = &GazeRayViews.AddDefaulted_GetRef();
+		Found->PlayerController = PlayerController;
+	}
+
+	// Calls made before this frame's camera update see the previous camera, as a direct deprojection would
+	if (Found->FrameCounter != GFrameCounter)
+	{
+		CaptureGazeRayView(*Found);
+	}
+	return Found;
+}
+
+void UBeamEyeTrackerSubsystem::CaptureGazeRayView(FGazeRayView& View) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamGazeRay);
+
+	View.FrameCounter = GFrameCounter;
+	View.bViewValid = false;
+	View.GazeRay = FBeamWorldRay();
+
+	const APlayerController* PlayerController = View.PlayerController.Get();
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	FViewport* Viewport = LocalPlayer && LocalPlayer->ViewportClient ? LocalPlayer->ViewportClient->Viewport : nullptr;
+	if (!Viewport)
+	{
+		return;
+	}
+
+	// The same projection UGameplayStatics::DeprojectScreenToWorld builds, kept for the rest of the frame
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer->GetProjectionData(Viewport, ProjectionData))
+	{
+		return;
+	}
+	View.InvViewProjection = ProjectionData.ComputeViewProjectionMatrix().InverseFast();
+	View.ViewRect = ProjectionData.GetConstrainedViewRect();
+	View.ViewportSize = FVector2D(Viewport->GetSizeXY());
+	View.bViewValid = true;
+
+	const FBeamFrame* Frame = PeekCurrentFrame();
+	if (Frame && Frame->Gaze.bValid)
+	{
+		FSceneView::DeprojectScreenToWorld(Frame->Gaze.Screen01 * View.ViewportSize, View.ViewRect, View.InvViewProjection, View.GazeRay.Origin, View.GazeRay.Direction);
+		View.GazeRay.bValid = true;
+	}
+}
+
+void UBeamEyeTrackerSubsystem::HandlePostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (!World || World->GetGameInstance() != GetGameInstance() || (GazeRayViews.Num() == 0 && !GazeViewExtension.IsValid()))
+	{
+		return;
+	}
+
+	for (FGazeRayView& View : GazeRayViews)
+	{
+		CaptureGazeRayView(View);
+	}
+
+	// Render-thread consumers get the primary player's post-camera ray through the view extension
+	if (GazeViewExtension.IsValid())
+	{
+		FBeamWorldRay Ray;
+		GetGazeWorldRay(nullptr, Ray);
+		GazeViewExtension->SetGazeWorldRay(Ray);
+	}
+}
+
+// PERFORMANCE METRICS
+
+float UBeamEyeTrackerSubsystem::GetBufferUtilization() const
+{
+	if (!FrameBuffer)
+	{
+		return 0.0f;
+	}
+	
+	return static_cast<float>(FrameBuffer->GetBufferUtilization()) / 100.0f;
+}
+
+float UBeamEyeTrackerSubsystem::GetCaptureLatencyMs() const
+{
+	// UETimestampSeconds is the capture time on FPlatformTime for every source, offset by the minimum delivery delay
+	FBeamFrame Latest;
+	if (!FetchCurrentFrame(Latest) || Latest.UETimestampSeconds <= 0.0)
+	{
+		return -1.0f;
+	}
+	return static_cast<float>((FPlatformTime::Seconds() - Latest.UETimestampSeconds) * 1000.0);
+}
+
+bool UBeamEyeTrackerSubsystem::GetTrackerClockOffsetMs(double& OutOffsetMs) const
+{
+	double OffsetSeconds = 0.0;
+	if (!DataSource || !DataSource->GetClockOffsetSeconds(OffsetSeconds))
+	{
+		return false;
+	}
+	OutOffsetMs = OffsetSeconds * 1000.0;
+	return true;
+}
+
+float UBeamEyeTrackerSubsystem::GetTrackingFPS() const
+{
+	if (!DataSource)
+	{
+		return 0.0f;
+	}
+	
+	// Calculate actual FPS based on frame timing
+	if (FrameBuffer && FrameCount > 1)
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		const double TimeSpan = CurrentTime - LastFrameTime;
+		
+		if (TimeSpan > 0.0)
+		{
+			return 1.0f / static_cast<float>(TimeSpan);
+		}
+	}
+	
+	// Return a reasonable default if we can't calculate
+	return 60.0f;
+}
+
+// DEBUG AND SETTINGS METHODS
+
+void UBeamEyeTrackerSubsystem::SetDebugHUDEnabled(bool bEnabled)
+{
+	// This would typically update a debug HUD flag in the subsystem
+	
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Debug HUD %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+}
+
+void UBeamEyeTrackerSubsystem::SetPollingRate(int32 NewRateHz)
+{
+	if (NewRateHz <= 0 || NewRateHz > 1000)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Invalid polling rate %d Hz, must be 1-1000"), NewRateHz);
+		return;
+	}
+
+	const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Current = GetRuntimeSettings();
+	if (!Current)
+	{
+		return;
+	}
+
+	// The tracker delivers frames at its own rate; the polling rate drives the filters' nominal data rate
+	FBeamRuntimeSettings NewSettings = *Current;
+	NewSettings.PollingHz = NewRateHz;
+	PublishRuntimeSettings(NewSettings);
+	UpdatePollingSchedule();
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Polling rate changed to %d Hz"), NewRateHz);
+}
+
+EBeamProducerWakeMode UBeamEyeTrackerSubsystem::GetProducerWakeMode() const
+{
+	return static_cast<EBeamProducerWakeMode>(ActiveWakeMode.load(std::memory_order_relaxed));
+}
+
+float UBeamEyeTrackerSubsystem::GetObservedTrackerRateHz() const
+{
+	return ObservedTrackerHz.load(std::memory_order_relaxed);
+}
+
+void UBeamEyeTrackerSubsystem::AddAdaptivePollingUser()
+{
+	++AdaptivePollingUserCount;
+	UpdatePollingSchedule();
+}
+
+void UBeamEyeTrackerSubsystem::RemoveAdaptivePollingUser()
+{
+	AdaptivePollingUserCount = FMath::Max(0, AdaptivePollingUserCount - 1);
+	UpdatePollingSchedule();
+}
+
+bool UBeamEyeTrackerSubsystem::TickPollingSchedule(float DeltaTime)
+{
+	EngineFrameHz = BeamPollingScheduler::UpdateRateEstimate(EngineFrameHz, FApp::GetDeltaTime());
+	UpdatePollingSchedule();
+	return true;
+}
+
+void UBeamEyeTrackerSubsystem::UpdatePollingSchedule()
+{
+	// Without a producer the SDK callback or the caller sets the pace
+	if (!Settings || !ProducerWakeEvent)
+	{
+		return;
+	}
+
+	FBeamPollingPolicy Policy;
+	Policy.bAdaptive = Settings->bAdaptiveProducerWake || AdaptivePollingUserCount > 0;
+	Policy.WaitTimeoutMs = Settings->ProducerWaitTimeoutMs;
+	Policy.BackgroundPollingHz = Settings->BackgroundPollingHz;
+	Policy.MinimizedPollingHz = Settings->MinimizedPollingHz;
+	Policy.bThrottleOnBattery = Settings->bThrottleOnBattery;
+
+	FBeamPollingInputs Inputs;
+	Inputs.TrackerHz = ObservedTrackerHz.load(std::memory_order_relaxed);
+	Inputs.EngineHz = EngineFrameHz;
+	if (const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Current = GetRuntimeSettings())
+	{
+		Inputs.PollingHz = Current->PollingHz;
+	}
+	Inputs.bHasFocus = FApp::HasFocus();
+	Inputs.bOnBattery = FPlatformMisc::IsRunningOnBattery();
+
+	const UGameInstance* GameInstance = GetGameInstance();
+	const UGameViewportClient* ViewportClient = GameInstance ? GameInstance->GetGameViewportClient() : nullptr;
+	const TSharedPtr<SWindow> Window = ViewportClient ? ViewportClient->GetWindow() : nullptr;
+	Inputs.bMinimized = Window.IsValid() && Window->IsWindowMinimized();
+
+	const FBeamProducerSchedule Schedule = BeamPollingScheduler::Choose(Inputs, Policy);
+	const uint32 Packed = Schedule.Pack();
+	if (ProducerSchedule.exchange(Packed, std::memory_order_relaxed) != Packed)
+	{
+		// A producer asleep in a long background poll takes the new schedule now instead of at its next wake
+		if (ProducerWakeEvent)
+		{
+			ProducerWakeEvent->Trigger();
+		}
+		UE_LOG(LogBeam, Verbose, TEXT("BeamEyeTracker: Producer wake mode %d, interval %u ms (tracker %.0f Hz, engine %.0f Hz, focus %d, minimized %d, battery %d)"),
+			static_cast<int32>(Schedule.Mode), Schedule.IntervalMs, Inputs.TrackerHz, Inputs.EngineHz, Inputs.bHasFocus, Inputs.bMinimized, Inputs.bOnBattery);
+	}
+}
+
+void UBeamEyeTrackerSubsystem::SetSmoothingEnabled(bool bEnabled)
+{
+	const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Current = GetRuntimeSettings();
+	if (!Current)
+	{
+		return;
+	}
+
+	FBeamRuntimeSettings NewSettings = *Current;
+	NewSettings.bEnableSmoothing = bEnabled;
+	PublishRuntimeSettings(NewSettings);
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Smoothing %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+}
+
+void UBeamEyeTrackerSubsystem::SetMinCutoff(float NewMinCutoff)
+{
+	if (NewMinCutoff < 0.0f || NewMinCutoff > 100.0f)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Invalid min cutoff %f, must be 0.0-100.0"), NewMinCutoff);
+		return;
+	}
+
+	SetOneEuroParams(NewMinCutoff, OneEuroParams.Beta);
+}
+
+void UBeamEyeTrackerSubsystem::SetBeta(float NewBeta)
+{
+	if (NewBeta < 0.0f || NewBeta > 1.0f)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Invalid beta %f, must be 0.0-1.0"), NewBeta);
+		return;
+	}
+
+	SetOneEuroParams(OneEuroParams.MinCutoff, NewBeta);
+}
+
+void UBeamEyeTrackerSubsystem::SetOneEuroParams(float NewMinCutoff, float NewBeta)
+{
+	const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Current = GetRuntimeSettings();
+	if (!Current)
+	{
+		return;
+	}
+
+	FBeamRuntimeSettings NewSettings = *Current;
+	NewSettings.OneEuro.MinCutoff = FMath::Max(NewMinCutoff, 0.0f);
+	NewSettings.OneEuro.Beta = FMath::Max(NewBeta, 0.0f);
+	PublishRuntimeSettings(NewSettings);
+
+	UE_LOG(LogBeam, Verbose, TEXT("BeamEyeTracker: One-Euro params set to MinCutoff %f, Beta %f"), OneEuroParams.MinCutoff, OneEuroParams.Beta);
+}
+
+void UBeamEyeTrackerSubsystem::GetOneEuroParams(float& OutMinCutoff, float& OutBeta) const
+{
+	OutMinCutoff = OneEuroParams.MinCutoff;
+	OutBeta = OneEuroParams.Beta;
+}
+
+const FBeamFrameRing* UBeamEyeTrackerSubsystem::GetRawFrameRing() const
+{
+	// Only the producer thread filters; push ingestion and playback publish frames as they arrive
+	const bool bRingIsFiltered = PollingThread && Filters && Filters->ModifiesFrames() && !IsPlayingBack();
+	return bRingIsFiltered ? RawFrameSink.load(std::memory_order_relaxed) : FrameBuffer;
+}
+
+void UBeamEyeTrackerSubsystem::AddRawCaptureUser()
+{
+	if (RawCaptureUserCount++ > 0)
+	{
+		return;
+	}
+	if (!RawFrameBuffer)
+	{
+		RawFrameBuffer = new FBeamFrameRing();
+	}
+	RawFrameSink.store(RawFrameBuffer, std::memory_order_release);
+}
+
+void UBeamEyeTrackerSubsystem::AddFrameObserver(const FBeamFrameObserverRef& Observer)
+{
+	check(IsInGameThread());
+	TSharedRef<FFrameObserverList, ESPMode::ThreadSafe> NewList = MakeShared<FFrameObserverList, ESPMode::ThreadSafe>();
+	FScopeLock Lock(&FrameObserversLock);
+	if (FrameObservers.IsValid())
+	{
+		*NewList = *FrameObservers;
+	}
+	NewList->AddUnique(Observer);
+	FrameObservers = NewList;
+	FrameObserversVersion.fetch_add(1, std::memory_order_release);
+}
+
+void UBeamEyeTrackerSubsystem::RemoveFrameObserver(const FBeamFrameObserverRef& Observer)
+{
+	check(IsInGameThread());
+	FScopeLock Lock(&FrameObserversLock);
+	if (!FrameObservers.IsValid() || !FrameObservers->Contains(Observer))
+	{
+		return;
+	}
+
+	TSharedRef<FFrameObserverList, ESPMode::ThreadSafe> NewList = MakeShared<FFrameObserverList, ESPMode::ThreadSafe>(*FrameObservers);
+	NewList->Remove(Observer);
+	FrameObservers = NewList;
+	if (NewList->Num() == 0)
+	{
+		FrameObservers.Reset();
+	}
+	FrameObserversVersion.fetch_add(1, std::memory_order_release);
+}
+
+TSharedPtr<const UBeamEyeTrackerSubsystem::FFrameObserverList, ESPMode::ThreadSafe> UBeamEyeTrackerSubsystem::GetFrameObservers() const
+{
+	FScopeLock Lock(&FrameObserversLock);
+	return FrameObservers;
+}
+
+void UBeamEyeTrackerSubsystem::RemoveRawCaptureUser()
+{
+	if (RawCaptureUserCount <= 0)
+	{
+		return;
+	}
+	// The ring itself stays allocated: the producer may still be publishing into it
+	if (--RawCaptureUserCount == 0)
+	{
+		RawFrameSink.store(nullptr, std::memory_order_release);
+	}
 }
 
 bool UBeamEyeTrackerSubsystem::IsCalibrated() const
@@ -878,226 +2494,758 @@ bool UBeamEyeTrackerSubsystem::IsCalibrated() const
 		FBeamFrame LatestFrame;
 		if (FetchCurrentFrame(LatestFrame))
 		{
-			// Consider calibrated if we have valid data with medium or high confidence
-			bool bGazeCalibrated = LatestFrame.Gaze.bValid && LatestFrame.Gaze.Confidence >= 0.5f;
-			bool bHeadCalibrated = LatestFrame.Head.Confidence >= 0.5f;
-			
-			return bGazeCalibrated && bHeadCalibrated;
+			// Consider calibrated if we have valid data with medium or high confidence
+			bool bGazeCalibrated = LatestFrame.Gaze.bValid && LatestFrame.Gaze.Confidence >= 0.5f;
+			bool bHeadCalibrated = LatestFrame.Head.Confidence >= 0.5f;
+			
+			return bGazeCalibrated && bHeadCalibrated;
+		}
+	}
+	
+	return false;
+}
+
+// UTILITY METHODS
+
+void UBeamEyeTrackerSubsystem::OpenBeamDownloads() const
+{
+#if !UE_BUILD_SHIPPING
+	// This function is safe to call without validation
+#endif
+	
+	// Open the Beam downloads page in the default browser
+	FString URL = TEXT("https://eyeware.tech/beam-eye-tracker/downloads/");
+	FPlatformProcess::LaunchURL(*URL, nullptr, nullptr);
+}
+
+// FILTER CONFIGURATION
+
+EBeamFilterType UBeamEyeTrackerSubsystem::GetFilterType() const
+{
+#if !UE_BUILD_SHIPPING
+	// This function is safe to call without validation
+#endif
+	
+	return CurrentFilterType;
+}
+
+void UBeamEyeTrackerSubsystem::SetFilterType(EBeamFilterType NewFilterType)
+{
+	const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Current = GetRuntimeSettings();
+	if (!Current)
+	{
+		return;
+	}
+
+	// Selecting a filter turns smoothing on; selecting None leaves the last type for re-enabling
+	FBeamRuntimeSettings NewSettings = *Current;
+	NewSettings.bEnableSmoothing = NewFilterType != EBeamFilterType::None;
+	if (NewFilterType != EBeamFilterType::None)
+	{
+		NewSettings.FilterType = NewFilterType;
+	}
+	PublishRuntimeSettings(NewSettings);
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Filter type changed to %d"), static_cast<int32>(NewFilterType));
+}
+
+// RECORDING METHODS
+
+#if BEAM_FEATURE_RECORDED_DATA
+
+bool UBeamEyeTrackerSubsystem::StartRecording(const FString& FilePath)
+{
+#if !UE_BUILD_SHIPPING
+check(Recording != nullptr);
+#endif
+	
+	if (!Recording || !FrameBuffer)
+	{
+		return false;
+	}
+
+	if (Recording->IsRecording())
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Recording already in progress"));
+		return false;
+	}
+
+	// An empty path records into a timestamped file under Saved/BeamRecordings
+	const FString ResolvedPath = FilePath.IsEmpty()
+		? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BeamRecordings"), FString::Printf(TEXT("Beam_%s.beamrec"), *FDateTime::Now().ToString()))
+		: FilePath;
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(ResolvedPath), true);
+
+	FBeamRecordingOptions Options;
+	if (Settings)
+	{
+		const FBeamMemoryBudget Budget = Settings->GetMemoryBudget();
+		Options.BlockSizeBytes = Budget.RecordingBlockSizeBytes;
+		Options.MaxPendingBlocks = Budget.RecordingMaxPendingBlocks;
+		Options.MaxInMemoryFrames = Budget.RecordingMaxInMemoryFrames;
+		Options.Compression = Settings->bCompressRecordings ? EBeamRecordingCompression::Oodle : EBeamRecordingCompression::None;
+	}
+
+	// Only frames published from now on are recorded
+	RecordingConsumerId = FrameBuffer->RegisterConsumer(TEXT("Recording"));
+	if (RecordingConsumerId == INDEX_NONE)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: No free frame ring cursor for recording"));
+		return false;
+	}
+
+	if (!Recording->StartRecording(ResolvedPath, Options))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Failed to create recording file '%s'"), *ResolvedPath);
+		FrameBuffer->UnregisterConsumer(RecordingConsumerId);
+		RecordingConsumerId = INDEX_NONE;
+		return false;
+	}
+
+	RecordingScratch.Reserve(FBeamFrameRing::BufferSize);
+	RecordingFilePath = ResolvedPath;
+	UpdateRecordingTicker();
+	
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Started recording to '%s'"), *ResolvedPath);
+	return true;
+}
+
+void UBeamEyeTrackerSubsystem::StopRecording()
+{
+#if !UE_BUILD_SHIPPING
+check(IsRecording());
+#endif
+	
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	// Pick up anything published since the last tick before the file is finalized
+	RecordNewFrames();
+	Recording->StopRecording();
+	FrameBuffer->UnregisterConsumer(RecordingConsumerId);
+	RecordingConsumerId = INDEX_NONE;
+
+	RecordingFilePath.Empty();
+	RecordingScratch.Empty();
+	UpdateRecordingTicker();
+	
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Stopped recording"));
+}
+
+bool UBeamEyeTrackerSubsystem::IsRecording() const
+{
+#if !UE_BUILD_SHIPPING
+	// This function is safe to call without validation
+#endif
+	
+	return Recording && Recording->IsRecording();
+}
+
+// PLAYBACK METHODS
+
+bool UBeamEyeTrackerSubsystem::StartPlayback(const FString& FilePath)
+{
+#if !UE_BUILD_SHIPPING
+check(!FilePath.IsEmpty());
+#endif
+	
+	if (!Recording || !FrameBuffer)
+	{
+		return false;
+	}
+
+	if (Recording->IsPlayingBack())
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Playback already in progress"));
+		return false;
+	}
+
+	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*FilePath))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Playback file '%s' does not exist"), *FilePath);
+		return false;
+	}
+
+	if (!Recording->StartPlayback(FilePath))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Playback file '%s' is not a valid .beamrec recording"), *FilePath);
+		return false;
+	}
+
+	if (!Recording->PeekNextFrameTimestamp(PlaybackFirstTimestampMs))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Playback file '%s' is empty"), *FilePath);
+		Recording->StopPlayback();
+		return false;
+	}
+
+	// Playback becomes the ring's only producer until it stops
+	if (PollingThread)
+	{
+		StopPollingThread();
+	}
+	if (DataSource)
+	{
+		DataSource->SetFrameSink(nullptr);
+	}
+	FrameBuffer->Clear();
+	if (RawFrameBuffer)
+	{
+		RawFrameBuffer->Clear();
+	}
+	FrameCacheCounter = MAX_uint64;
+	if (Predictor)
+	{
+		Predictor->Reset();
+	}
+
+	PlaybackFilePath = FilePath;
+	PlaybackStartTime = FPlatformTime::Seconds();
+	UpdateRecordingTicker();
+	
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Started playback from '%s' with %d frames"), *FilePath, Recording->GetPlaybackFrameCount());
+	return true;
+}
+
+void UBeamEyeTrackerSubsystem::StopPlayback()
+{
+#if !UE_BUILD_SHIPPING
+check(IsPlayingBack());
+#endif
+	
+	if (!IsPlayingBack())
+	{
+		return;
+	}
+	
+	Recording->StopPlayback();
+	PlaybackFilePath.Empty();
+	RestoreLiveIngestion();
+	UpdateRecordingTicker();
+	
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Stopped playback"));
+}
+
+bool UBeamEyeTrackerSubsystem::IsPlayingBack() const
+{
+#if !UE_BUILD_SHIPPING
+	// This function is safe to call without validation
+#endif
+	
+	return Recording && Recording->IsPlayingBack();
+}
+
+#else
+
+bool UBeamEyeTrackerSubsystem::StartRecording(const FString& FilePath)
+{
+	UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Recording is not available in this build"));
+	return false;
+}
+
+void UBeamEyeTrackerSubsystem::StopRecording()
+{
+}
+
+bool UBeamEyeTrackerSubsystem::IsRecording() const
+{
+	return false;
+}
+
+bool UBeamEyeTrackerSubsystem::StartPlayback(const FString& FilePath)
+{
+	UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Playback is not available in this build"));
+	return false;
+}
+
+void UBeamEyeTrackerSubsystem::StopPlayback()
+{
+}
+
+bool UBeamEyeTrackerSubsystem::IsPlayingBack() const
+{
+	return false;
+}
+
+#endif // BEAM_FEATURE_RECORDED_DATA
+
+// NETWORK STREAMING METHODS
+
+bool UBeamEyeTrackerSubsystem::StartNetworkStreaming(const FString& Destinations)
+{
+	if (!FrameBuffer)
+	{
+		return false;
+	}
+
+	if (NetStreamServer)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Network streaming already running"));
+		return false;
+	}
+
+	FString ResolvedDestinations = Destinations;
+	if (ResolvedDestinations.IsEmpty() && Settings)
+	{
+		if (!Settings->NetworkMulticastGroup.IsEmpty())
+		{
+			ResolvedDestinations = GetDefaultNetworkEndpoint();
+		}
+		if (!Settings->NetworkStreamDestinations.IsEmpty())
+		{
+			ResolvedDestinations = ResolvedDestinations.IsEmpty()
+				? Settings->NetworkStreamDestinations
+				: ResolvedDestinations + TEXT(",") + Settings->NetworkStreamDestinations;
 		}
 	}
-	
-	return false;
-}
 
-// UTILITY METHODS
+	NetStreamServer = new FBeamNetStreamServer(*FrameBuffer);
+	if (!NetStreamServer->Start(ResolvedDestinations, Settings ? Settings->NetworkMulticastTtl : 1))
+	{
+		delete NetStreamServer;
+		NetStreamServer = nullptr;
+		return false;
+	}
+	AddFrameObserver(NetStreamServer->GetFrameObserver());
+	return true;
+}
 
-void UBeamEyeTrackerSubsystem::OpenBeamDownloads() const
+void UBeamEyeTrackerSubsystem::StopNetworkStreaming()
 {
-#if !UE_BUILD_SHIPPING
-	// This function is safe to call without validation
-#endif
-	
-	// Open the Beam downloads page in the default browser
-	FString URL = TEXT("https://eyeware.tech/beam-eye-tracker/downloads/");
-	FPlatformProcess::LaunchURL(*URL, nullptr, nullptr);
+	if (NetStreamServer)
+	{
+		RemoveFrameObserver(NetStreamServer->GetFrameObserver());
+		delete NetStreamServer;
+		NetStreamServer = nullptr;
+	}
 }
 
-// FILTER CONFIGURATION
+bool UBeamEyeTrackerSubsystem::IsNetworkStreaming() const
+{
+	return NetStreamServer && NetStreamServer->IsRunning();
+}
 
-EBeamFilterType UBeamEyeTrackerSubsystem::GetFilterType() const
+#if BEAM_FEATURE_UNREAL_INSIGHTS
+void UBeamEyeTrackerSubsystem::InitializeTracing()
 {
-#if !UE_BUILD_SHIPPING
-	// This function is safe to call without validation
+	// Rings are allocated on first enable ("Beam.Trace 1"), so an idle tracer costs nothing
+	Tracing = new FBeamTrace();
+	if (!GBeamTracer)
+	{
+		GBeamTracer = Tracing;
+	}
+}
 #endif
-	
-	return CurrentFilterType;
+
+FString UBeamEyeTrackerSubsystem::GetDefaultNetworkEndpoint() const
+{
+	const int32 Port = Settings ? Settings->NetworkListenPort : 47810;
+	if (Settings && !Settings->NetworkMulticastGroup.IsEmpty())
+	{
+		return FString::Printf(TEXT("%s:%d"), *Settings->NetworkMulticastGroup, Port);
+	}
+	return FString::FromInt(Port);
 }
 
-void UBeamEyeTrackerSubsystem::SetFilterType(EBeamFilterType NewFilterType)
+#if BEAM_FEATURE_RECORDED_DATA
+void UBeamEyeTrackerSubsystem::RestoreLiveIngestion()
 {
-#if !UE_BUILD_SHIPPING
-			check(NewFilterType != EBeamFilterType::None);
+	// Played-back frames would otherwise be read as live ones
+	FrameBuffer->Clear();
+	if (RawFrameBuffer)
+	{
+		RawFrameBuffer->Clear();
+	}
+	FrameCacheCounter = MAX_uint64;
+	if (Predictor)
+	{
+		Predictor->Reset();
+	}
+
+	if (!Settings || !DataSource)
+	{
+		return;
+	}
+
+	if (!Settings->bUseProducerThread)
+	{
+		DataSource->SetFrameSink(FrameBuffer);
+	}
+	else if (IsBeamTracking() && !PollingThread)
+	{
+		StartPollingThread();
+	}
+}
 #endif
-	
-	CurrentFilterType = NewFilterType;
-	
-	// Apply the new filter type to components
-	// This would typically iterate through all components and update their filters
-	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Filter type changed to %d"), static_cast<int32>(NewFilterType));
+
+FDelegateHandle UBeamEyeTrackerSubsystem::SubscribeToFrameChanges(const FBeamChangeThresholds& Thresholds, FOnBeamFrameChangedNative::FDelegate&& Delegate)
+{
+	const FDelegateHandle Handle = FrameSubscriptions.Add(Thresholds, MoveTemp(Delegate));
+	if (!SubscriptionTickerHandle.IsValid())
+	{
+		LastSubscriptionFrameId = -1;
+		SubscriptionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickFrameSubscriptions));
+	}
+	return Handle;
 }
 
-// RECORDING METHODS
+void UBeamEyeTrackerSubsystem::UnsubscribeFromFrameChanges(FDelegateHandle Handle)
+{
+	FrameSubscriptions.Remove(Handle);
+	if (FrameSubscriptions.IsEmpty() && SubscriptionTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SubscriptionTickerHandle);
+		SubscriptionTickerHandle.Reset();
+	}
+}
 
-bool UBeamEyeTrackerSubsystem::StartRecording(const FString& FilePath)
+FDelegateHandle UBeamEyeTrackerSubsystem::SubscribeToFrameRate(const FBeamFrameRateView& View, FOnBeamRateViewFrameNative::FDelegate&& Delegate)
 {
-#if !UE_BUILD_SHIPPING
-check(!FilePath.IsEmpty());
-#endif
-	
-	if (bIsRecording)
+	check(IsInGameThread());
+	const FDelegateHandle Handle = FrameRateViews.Add(View, MoveTemp(Delegate));
+	if (!RateViewTickerHandle.IsValid() && FrameBuffer)
 	{
-		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Recording already in progress"));
-		return false;
+		// Only frames published from now on reach the views
+		RateViewConsumerId = FrameBuffer->RegisterConsumer(TEXT("RateViews"));
+		if (RateViewConsumerId == INDEX_NONE)
+		{
+			UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: No free frame ring cursor for rate views"));
+		}
+		RateViewClearCount = FrameBuffer->GetClearCount();
+		RateViewScratch.Reserve(FBeamFrameRing::BufferSize);
+		RateViewTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickFrameRateViews));
 	}
+	return Handle;
+}
 
-	RecordingFile = IFileManager::Get().CreateFileWriter(*FilePath);
-	if (!RecordingFile)
+void UBeamEyeTrackerSubsystem::UnsubscribeFromFrameRate(FDelegateHandle Handle)
+{
+	check(IsInGameThread());
+	FrameRateViews.Remove(Handle);
+	if (FrameRateViews.IsEmpty())
 	{
-		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Failed to create recording file '%s'"), *FilePath);
-		return false;
+		StopFrameRateViews();
+	}
+}
+
+void UBeamEyeTrackerSubsystem::StopFrameRateViews()
+{
+	if (RateViewTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RateViewTickerHandle);
+		RateViewTickerHandle.Reset();
 	}
+	if (RateViewConsumerId != INDEX_NONE && FrameBuffer)
+	{
+		FrameBuffer->UnregisterConsumer(RateViewConsumerId);
+	}
+	RateViewConsumerId = INDEX_NONE;
+	RateViewScratch.Empty();
+}
 
-	FString Header = TEXT("Timestamp,GazeX,GazeY,GazeConfidence,HeadPitch,HeadYaw,HeadRoll,HeadConfidence\n");
-	RecordingFile->Serialize(TCHAR_TO_UTF8(*Header), Header.Len());
-	
-	bIsRecording = true;
-	RecordingFilePath = FilePath;
-	RecordingStartTime = FPlatformTime::Seconds();
-	
-	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Started recording to '%s'"), *FilePath);
+FDelegateHandle UBeamEyeTrackerSubsystem::AddNewFrameListener(FSimpleDelegate&& Delegate)
+{
+	check(IsInGameThread());
+	const FDelegateHandle Handle = NewFrameListeners.Add(MoveTemp(Delegate));
+	NumNewFrameListeners.fetch_add(1, std::memory_order_relaxed);
+
+	if (Settings && !Settings->bUseProducerThread && !NewFrameTickerHandle.IsValid())
+	{
+		LastNewFrameId = -1;
+		NewFrameTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickNewFrameListeners));
+	}
+	return Handle;
+}
+
+void UBeamEyeTrackerSubsystem::RemoveNewFrameListener(FDelegateHandle Handle)
+{
+	check(IsInGameThread());
+	if (!NewFrameListeners.Remove(Handle))
+	{
+		return;
+	}
+	if (NumNewFrameListeners.fetch_sub(1, std::memory_order_relaxed) == 1 && NewFrameTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(NewFrameTickerHandle);
+		NewFrameTickerHandle.Reset();
+	}
+}
+
+void UBeamEyeTrackerSubsystem::QueueNewFrameDispatch()
+{
+	// One dispatch in flight at a time: frames published before it runs are folded into it
+	if (NumNewFrameListeners.load(std::memory_order_relaxed) == 0 || bNewFrameDispatchQueued.exchange(true, std::memory_order_acq_rel))
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UBeamEyeTrackerSubsystem> WeakThis(this);
+	AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+	{
+		if (UBeamEyeTrackerSubsystem* StrongThis = WeakThis.Get())
+		{
+			StrongThis->DispatchNewFrame();
+		}
+	});
+}
+
+void UBeamEyeTrackerSubsystem::DispatchNewFrame()
+{
+	// Cleared first so a frame published while listeners run queues the next dispatch
+	bNewFrameDispatchQueued.store(false, std::memory_order_release);
+	NewFrameListeners.Broadcast();
+}
+
+bool UBeamEyeTrackerSubsystem::TickNewFrameListeners(float DeltaTime)
+{
+	FBeamFrame Frame;
+	if (FrameBuffer && FrameBuffer->ReadLatest(Frame) && Frame.FrameId != LastNewFrameId)
+	{
+		LastNewFrameId = Frame.FrameId;
+		NewFrameListeners.Broadcast();
+	}
 	return true;
 }
 
-void UBeamEyeTrackerSubsystem::StopRecording()
+bool UBeamEyeTrackerSubsystem::TickLatencyStats(float DeltaTime)
 {
-#if !UE_BUILD_SHIPPING
-check(bIsRecording);
-#endif
-	
-	if (!bIsRecording)
+	GBeamLatency.PublishStats();
+	PublishDropStats();
+	ReportSlowConsumers();
+	return true;
+}
+
+FBeamDropCounts UBeamEyeTrackerSubsystem::GetDropCounts() const
+{
+	FBeamDropCounts Counts;
+	Counts.SourceDropped = static_cast<int64>(SourceDroppedFrames.load(std::memory_order_relaxed));
+	Counts.SourceDecimated = static_cast<int64>(SourceDecimatedFrames.load(std::memory_order_relaxed));
+	if (FrameBuffer)
+	{
+		Counts.RingOverwritten = static_cast<int64>(FrameBuffer->GetOverwrittenFrames());
+		Counts.ConsumerDropped = static_cast<int64>(FrameBuffer->GetConsumerDroppedFrames());
+	}
+	return Counts;
+}
+
+void UBeamEyeTrackerSubsystem::PublishDropStats() const
+{
+	const FBeamDropCounts Counts = GetDropCounts();
+	SET_DWORD_STAT(STAT_BeamSourceDropped, Counts.SourceDropped);
+	SET_DWORD_STAT(STAT_BeamSourceDecimated, Counts.SourceDecimated);
+	SET_DWORD_STAT(STAT_BeamRingOverwritten, Counts.RingOverwritten);
+	SET_DWORD_STAT(STAT_BeamConsumerDropped, Counts.ConsumerDropped);
+
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::QueueDepth, TEXT("Beam.Drops.Source"), static_cast<double>(Counts.SourceDropped));
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::QueueDepth, TEXT("Beam.Drops.Decimated"), static_cast<double>(Counts.SourceDecimated));
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::QueueDepth, TEXT("Beam.Drops.RingOverwritten"), static_cast<double>(Counts.RingOverwritten));
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::QueueDepth, TEXT("Beam.Drops.Consumer"), static_cast<double>(Counts.ConsumerDropped));
+}
+
+int32 UBeamEyeTrackerSubsystem::GetFrameConsumerStats(TArray<FBeamRingConsumerStats>& OutStats) const
+{
+	OutStats.Reset();
+	return FrameBuffer ? FrameBuffer->GetAllConsumerStats(OutStats) : 0;
+}
+
+void UBeamEyeTrackerSubsystem::ReportSlowConsumers()
+{
+	if (!FrameBuffer)
 	{
 		return;
 	}
-	
-	// Close the recording file
-	if (RecordingFile)
+
+	TArray<FBeamRingConsumerStats> Stats;
+	FrameBuffer->GetAllConsumerStats(Stats);
+	for (const FBeamRingConsumerStats& Consumer : Stats)
 	{
-		RecordingFile->Close();
-		delete RecordingFile;
-		RecordingFile = nullptr;
+		uint64& Reported = ReportedConsumerDrops[Consumer.ConsumerId];
+
+		// A lower count means the slot was released and claimed again
+		if (Consumer.DroppedFrames < Reported)
+		{
+			Reported = 0;
+		}
+		if (Consumer.DroppedFrames > Reported)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Consumer '%s' fell behind the frame ring and lost %llu frames (lag %llu, lapped %u times)"),
+				*Consumer.Name.ToString(), Consumer.DroppedFrames - Reported, Consumer.LagFrames, Consumer.LapCount);
+			Reported = Consumer.DroppedFrames;
+		}
 	}
-	
-	bIsRecording = false;
-	RecordingFilePath.Empty();
-	
-	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Stopped recording"));
 }
 
-bool UBeamEyeTrackerSubsystem::IsRecording() const
+bool UBeamEyeTrackerSubsystem::TickMonitorSnapshot(float DeltaTime)
 {
-#if !UE_BUILD_SHIPPING
-	// This function is safe to call without validation
-#endif
-	
-	return bIsPlayingBack;
+	FBeamMonitorSnapshot Snapshot;
+	Snapshot.Sequence = ++MonitorSequence;
+	Snapshot.TimeSeconds = FPlatformTime::Seconds();
+	Snapshot.TrackingFPS = GetTrackingFPS();
+	Snapshot.BufferUtilization = FrameBuffer ? static_cast<float>(FrameBuffer->GetBufferUtilization()) : 0.0f;
+	Snapshot.Health = GetBeamHealth();
+	Snapshot.bTracking = IsBeamTracking();
+	Snapshot.bRecording = IsRecording();
+	Snapshot.bPlayingBack = IsPlayingBack();
+
+	// One fetch serves every field; it is the same per-frame cached read the other consumers get
+	FBeamFrame Frame;
+	if (FetchCurrentFrame(Frame))
+	{
+		Snapshot.bHasFrame = true;
+		Snapshot.bGazeValid = Frame.Gaze.bValid;
+		Snapshot.GazeScreen01 = FVector2f(Frame.Gaze.Screen01);
+		Snapshot.bHeadValid = Frame.Head.Confidence > 0.0f;
+		Snapshot.HeadPositionCm = FVector3f(Frame.Head.PositionCm);
+		Snapshot.bCalibrated = IsCalibrated();
+		if (Frame.UETimestampSeconds > 0.0)
+		{
+			Snapshot.LatencyMs = static_cast<float>(FMath::Max(Snapshot.TimeSeconds - Frame.UETimestampSeconds, 0.0) * 1000.0);
+		}
+	}
+
+	MonitorHistory.Push(Snapshot);
+	return true;
 }
 
-// PLAYBACK METHODS
+bool UBeamEyeTrackerSubsystem::TickFrameSubscriptions(float DeltaTime)
+{
+	FBeamFrame Frame;
+	if (!FetchCurrentFrame(Frame) || Frame.FrameId == LastSubscriptionFrameId)
+	{
+		return true;
+	}
 
-bool UBeamEyeTrackerSubsystem::StartPlayback(const FString& FilePath)
+	// A timestamp behind the last one evaluated means the ring restarted; notify everyone afresh
+	if (LastSubscriptionFrameId >= 0 && Frame.SDKTimestampMs < LastSubscriptionTimestampMs)
+	{
+		FrameSubscriptions.Rearm();
+	}
+	LastSubscriptionFrameId = Frame.FrameId;
+	LastSubscriptionTimestampMs = Frame.SDKTimestampMs;
+
+	FrameSubscriptions.ProcessFrame(Frame, FPlatformTime::Seconds());
+	return true;
+}
+
+bool UBeamEyeTrackerSubsystem::TickFrameRateViews(float DeltaTime)
 {
-#if !UE_BUILD_SHIPPING
-check(!FilePath.IsEmpty());
-#endif
-	
-	if (bIsPlayingBack)
+	SCOPE_CYCLE_COUNTER(STAT_BeamRateViews);
+
+	if (RateViewConsumerId == INDEX_NONE || !FrameBuffer)
 	{
-		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Playback already in progress"));
-		return false;
+		return true;
 	}
 
-	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*FilePath))
+	// A cleared ring starts a new stream; an average spanning both would blend unrelated samples
+	const uint32 ClearCount = FrameBuffer->GetClearCount();
+	if (ClearCount != RateViewClearCount)
 	{
-		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Playback file '%s' does not exist"), *FilePath);
-		return false;
+		RateViewClearCount = ClearCount;
+		FrameRateViews.Rearm();
 	}
-	
-	// Read the CSV file header to validate format
-	FString FileContent;
-	if (!FFileHelper::LoadFileToString(FileContent, *FilePath))
+
+	RateViewScratch.Reset();
+	FrameBuffer->ConsumeFrames(RateViewConsumerId, RateViewScratch);
+	FrameRateViews.ProcessFrames(RateViewScratch);
+	return true;
+}
+
+#if BEAM_FEATURE_RECORDED_DATA
+void UBeamEyeTrackerSubsystem::UpdateRecordingTicker()
+{
+	const bool bNeedsTicker = IsRecording() || IsPlayingBack();
+	if (bNeedsTicker && !RecordingTickerHandle.IsValid())
 	{
-		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Failed to read playback file '%s'"), *FilePath);
-		return false;
+		RecordingTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamEyeTrackerSubsystem::TickRecordingAndPlayback));
 	}
-	
-	// Parse CSV header
-	TArray<FString> Lines;
-	FileContent.ParseIntoArrayLines(Lines);
-	if (Lines.Num() == 0)
+	else if (!bNeedsTicker && RecordingTickerHandle.IsValid())
 	{
-		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Playback file '%s' is empty"), *FilePath);
-		return false;
+		FTSTicker::GetCoreTicker().RemoveTicker(RecordingTickerHandle);
+		RecordingTickerHandle.Reset();
 	}
+}
 
-	FString Header = Lines[0];
-	if (!Header.Contains(TEXT("Timestamp")) || !Header.Contains(TEXT("GazeX")) || !Header.Contains(TEXT("HeadPitch")))
+bool UBeamEyeTrackerSubsystem::TickRecordingAndPlayback(float DeltaTime)
+{
+	if (IsPlayingBack())
 	{
-		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Playback file '%s' has invalid format"), *FilePath);
-		return false;
+		PumpPlayback();
+	}
+	if (IsRecording())
+	{
+		RecordNewFrames();
 	}
-	
-	// Store playback data in memory for now
-	// In a full implementation, this would stream from disk
-	bIsPlayingBack = true;
-	PlaybackFilePath = FilePath;
-	PlaybackLines = Lines;
-	CurrentPlaybackLine = 1; // Skip header
-	PlaybackStartTime = FPlatformTime::Seconds();
-	
-	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Started playback from '%s' with %d data lines"), *FilePath, Lines.Num() - 1);
 	return true;
 }
 
-void UBeamEyeTrackerSubsystem::StopPlayback()
+void UBeamEyeTrackerSubsystem::RecordNewFrames()
 {
-#if !UE_BUILD_SHIPPING
-check(bIsPlayingBack);
-#endif
-	
-	if (!bIsPlayingBack)
+	// The ring holds about four seconds at 250 Hz; a hitch longer than that shows up as dropped frames on this cursor
+	FrameBuffer->ConsumeFrames(RecordingConsumerId, RecordingScratch);
+	for (const FBeamFrame& Frame : RecordingScratch)
 	{
-		return;
+		RecordFrame(Frame);
 	}
-	
-	bIsPlayingBack = false;
-	PlaybackFilePath.Empty();
-	
-	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Stopped playback"));
 }
 
-bool UBeamEyeTrackerSubsystem::IsPlayingBack() const
+void UBeamEyeTrackerSubsystem::PumpPlayback()
 {
-#if !UE_BUILD_SHIPPING
-	// This function is safe to call without validation
-#endif
-	
-	return bIsPlayingBack;
+	// Recorded frames are released on the wall clock, offset so the first frame plays at StartPlayback
+	const double Now = FPlatformTime::Seconds();
+	const double PlaybackTimeMs = PlaybackFirstTimestampMs + (Now - PlaybackStartTime) * 1000.0;
+
+	double NextTimestampMs = 0.0;
+	double PreviousTimestampMs = 0.0;
+	FBeamFrame Frame;
+	bool bPublished = false;
+	const TSharedPtr<const FFrameObserverList, ESPMode::ThreadSafe> Observers = GetFrameObservers();
+	while (Recording->PeekNextFrameTimestamp(NextTimestampMs) && NextTimestampMs <= PlaybackTimeMs)
+	{
+		Recording->GetNextFrame(Frame);
+		Frame.UETimestampSeconds = PlaybackStartTime + (Frame.SDKTimestampMs - PlaybackFirstTimestampMs) * 0.001;
+		Frame.DeltaTimeSeconds = PreviousTimestampMs > 0.0 ? (Frame.SDKTimestampMs - PreviousTimestampMs) * 0.001 : 0.0;
+		PreviousTimestampMs = Frame.SDKTimestampMs;
+		FrameBuffer->Publish(Frame);
+		BEAM_TRACE_FRAME_PUBLISHED(Frame);
+		GBeamFlightRecorder.RecordFrame(Frame);
+		if (Observers.IsValid())
+		{
+			for (const FBeamFrameObserverRef& Observer : *Observers)
+			{
+				Observer->OnFramePublished(Frame);
+			}
+		}
+		bPublished = true;
+	}
+	if (bPublished)
+	{
+		QueueNewFrameDispatch();
+	}
+
+	if (!Recording->PeekNextFrameTimestamp(NextTimestampMs))
+	{
+		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Playback of '%s' finished"), *PlaybackFilePath);
+		StopPlayback();
+	}
 }
 
 void UBeamEyeTrackerSubsystem::RecordFrame(const FBeamFrame& Frame)
 {
 #if !UE_BUILD_SHIPPING
-check(bIsRecording);
-check(RecordingFile != nullptr);
+check(IsRecording());
 #endif
 	
-	if (!bIsRecording || !RecordingFile)
+	if (!IsRecording())
 	{
 		return;
 	}
-	
-	// Calculate timestamp relative to recording start
-	const double CurrentTime = FPlatformTime::Seconds();
-	const double RelativeTime = CurrentTime - RecordingStartTime;
-	
-	// Format frame data as CSV using the correct field names
-	FString FrameData = FString::Printf(TEXT("%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f\n"),
-		RelativeTime,
-		Frame.Gaze.Screen01.X, Frame.Gaze.Screen01.Y, Frame.Gaze.Confidence,
-		Frame.Head.Rotation.Pitch, Frame.Head.Rotation.Yaw, Frame.Head.Rotation.Roll, Frame.Head.Confidence);
 
-	RecordingFile->Serialize(TCHAR_TO_UTF8(*FrameData), FrameData.Len());
+	// Binary record into the chunked writer; no formatting or I/O on this thread
+	Recording->RecordFrame(Frame);
 }
+#endif // BEAM_FEATURE_RECORDED_DATA
 
 // PHASE 2: ADVANCED ANALYTICS AND PERFORMANCE FEATURES
 
@@ -1117,7 +3265,7 @@ FBeamPerformanceMetrics UBeamEyeTrackerSubsystem::GetPerformanceMetrics() const
     
     Metrics.CPUUsage = CPUUsage;
     Metrics.MemoryUsage = MemoryUsage;
-    Metrics.DroppedFrames = 0; // Would calculate from frame timing analysis
+    Metrics.DroppedFrames = static_cast<int32>(FMath::Min<int64>(GetDropCounts().GetTotalLost(), MAX_int32));
     Metrics.TimeStamp = FPlatformTime::Seconds();
     
     return Metrics;
@@ -1149,82 +3297,85 @@ FGazeAnalytics UBeamEyeTrackerSubsystem::GetGazeAnalytics() const
 
 FCalibrationQuality UBeamEyeTrackerSubsystem::GetCalibrationQuality() const
 {
-    FCalibrationQuality Quality;
+	// Default-constructed, and so not validated, until a validation session publishes a result
+	return LastCalibrationQuality;
+}
 
-    if (bIsCalibrating)
-    {
-        Quality.OverallScore = 0.0f; // Still calibrating
-    }
-    else
-    {
-        // Simulate calibration quality based on system state
-        Quality.OverallScore = FMath::RandRange(75.0f, 95.0f);
-        Quality.LeftEyeScore = FMath::RandRange(70.0f, 95.0f);
-        Quality.RightEyeScore = FMath::RandRange(70.0f, 95.0f);
-        Quality.LastCalibrationTime = FPlatformTime::Seconds();
-        
-        // Generate sample calibration points
-        Quality.CalibrationPoints = {
-            FVector2D(0.1f, 0.1f), FVector2D(0.5f, 0.1f), FVector2D(0.9f, 0.1f),
-            FVector2D(0.1f, 0.5f), FVector2D(0.5f, 0.5f), FVector2D(0.9f, 0.5f),
-            FVector2D(0.1f, 0.9f), FVector2D(0.5f, 0.9f), FVector2D(0.9f, 0.9f)
-        };
-        
-        Quality.PointScores = {85.0f, 90.0f, 88.0f, 92.0f, 95.0f, 87.0f, 89.0f, 91.0f, 93.0f};
-    }
-    
-    return Quality;
+void UBeamEyeTrackerSubsystem::SetCalibrationQuality(const FCalibrationQuality& Quality)
+{
+	LastCalibrationQuality = Quality;
 }
 
 bool UBeamEyeTrackerSubsystem::ExportTrackingData(const FString& FilePath, float DurationSeconds)
 {
-    if (!FrameBuffer)
+    FBeamFrame Latest;
+    if (!FrameBuffer || !FrameBuffer->ReadLatest(Latest))
     {
-        UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Cannot export - no frame buffer available"));
+        UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Cannot export - no buffered frames available"));
         return false;
     }
 
-    FString CSVData = TEXT("Timestamp,GazeX,GazeY,GazeConfidence,HeadPitch,HeadYaw,HeadRoll,HeadConfidence\n");
+    // The ring copy is the only game-thread cost; formatting and file IO happen on the pool
+    TArray<FBeamFrame> Frames;
+    const double EndMs = Latest.SDKTimestampMs;
+    FrameBuffer->CopyFramesInRange(EndMs - FMath::Max(DurationSeconds, 0.0f) * 1000.0, EndMs, Frames);
 
-    double CurrentTime = FPlatformTime::Seconds();
-    double StartTime = CurrentTime - DurationSeconds;
-    
-    // Export recent frames (simplified implementation)
-    // In a full implementation, this would iterate through the frame buffer
-    FBeamFrame CurrentFrame;
-    if (FetchCurrentFrame(CurrentFrame))
+    const EBeamExportFormat Format = BeamExport::FormatFromPath(FilePath);
+    BeamExport::Launch(FString::Printf(TEXT("%d tracking frames"), Frames.Num()), FilePath, [FilePath, Format, Frames = MoveTemp(Frames)]()
     {
-        FString FrameData = FString::Printf(TEXT("%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f\n"),
-            CurrentTime,
-            CurrentFrame.Gaze.Screen01.X, CurrentFrame.Gaze.Screen01.Y, CurrentFrame.Gaze.Confidence,
-            CurrentFrame.Head.Rotation.Pitch, CurrentFrame.Head.Rotation.Yaw, CurrentFrame.Head.Rotation.Roll, CurrentFrame.Head.Confidence);
-        
-        CSVData += FrameData;
-    }
+        int32 Index = 0;
+        return BeamExport::WriteFrames(FilePath, Format, [&Frames, &Index](FBeamFrame& OutFrame)
+        {
+            if (Index >= Frames.Num())
+            {
+                return false;
+            }
+            OutFrame = Frames[Index++];
+            return true;
+        });
+    });
+    return true;
+}
 
-    bool bSuccess = FFileHelper::SaveStringToFile(CSVData, *FilePath);
-    
-    if (bSuccess)
+bool UBeamEyeTrackerSubsystem::ExportRecording(const FString& RecordingPath, const FString& FilePath)
+{
+#if !BEAM_FEATURE_RECORDED_DATA
+    UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Recording export is not available in this build"));
+    return false;
+#else
+    if (!FPaths::FileExists(RecordingPath))
     {
-        UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Tracking data exported to %s"), *FilePath);
+        UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Cannot export - recording %s not found"), *RecordingPath);
+        return false;
     }
-    else
+
+    // The task owns its own reader, so live playback and recording are untouched; mapping keeps memory bounded
+    const EBeamExportFormat Format = BeamExport::FormatFromPath(FilePath);
+    BeamExport::Launch(FString::Printf(TEXT("recording %s"), *FPaths::GetCleanFilename(RecordingPath)), FilePath, [RecordingPath, FilePath, Format]()
     {
-        UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Failed to export tracking data to %s"), *FilePath);
-    }
-    
-    return bSuccess;
+        FBeamRecording Reader;
+        if (!Reader.StartPlayback(RecordingPath, true))
+        {
+            return false;
+        }
+        const bool bWritten = BeamExport::WriteFrames(FilePath, Format, [&Reader](FBeamFrame& OutFrame)
+        {
+            return Reader.GetNextFrame(OutFrame);
+        });
+        Reader.StopPlayback();
+        return bWritten;
+    });
+    return true;
+#endif
 }
 
 void UBeamEyeTrackerSubsystem::GetSystemResources(float& OutCPUUsage, float& OutMemoryUsage, float& OutGPUUsage) const
 {
-    
-    OutCPUUsage = FMath::RandRange(5.0f, 25.0f);
-
-    FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
-    OutMemoryUsage = MemoryStats.UsedPhysical / (1024.0f * 1024.0f); // Convert to MB
-
-    OutGPUUsage = FMath::RandRange(10.0f, 40.0f);
+    // Last background sample of the plugin's own threads, allocations and render passes; never blocks
+    const FBeamResourceUsage Usage = GBeamResources.GetLatest();
+    OutCPUUsage = Usage.CPUPercent;
+    OutMemoryUsage = static_cast<float>(Usage.MemoryBytes / (1024.0 * 1024.0));
+    OutGPUUsage = Usage.GPUPercent;
 }
 
 /*=============================================================================
@@ -4,11 +4,14 @@
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "BeamLogging.h"
+#include "BeamStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("EyeTracking Component Update"), STAT_BeamTrackingComponentUpdate, STATGROUP_Beam);
 
 UBeamEyeTrackingComponent::UBeamEyeTrackingComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.TickGroup = TG_PrePhysics;
+    // Updates arrive from the subsystem's shared rate view, so the component never ticks
+    PrimaryComponentTick.bCanEverTick = false;
     
     bTrackingActive = false;
     LastGazePoint2D = FVector2D::ZeroVector;
@@ -59,16 +62,6 @@ void UBeamEyeTrackingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason
     Super::EndPlay(EndPlayReason);
 }
 
-void UBeamEyeTrackingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    if (bAutoUpdate && bTrackingActive && ShouldUpdate())
-    {
-        UpdateGazeData();
-    }
-}
-
 bool UBeamEyeTrackingComponent::InitializeEyeTracking()
 {
     if (!BeamSubsystem)
@@ -89,6 +82,7 @@ bool UBeamEyeTrackingComponent::InitializeEyeTracking()
         bTrackingActive = true;
         LastUpdateTime = GetWorld()->GetTimeSeconds();
         FrameCount = 0;
+        SubscribeToRateView();
         
         UE_LOG(LogBeam, Log, TEXT("BeamEyeTrackingComponent: Eye tracking initialized successfully"));
         
@@ -111,6 +105,7 @@ void UBeamEyeTrackingComponent::StopEyeTracking()
         return;
     }
     
+    UnsubscribeFromRateView();
     if (BeamSubsystem)
     {
         BeamSubsystem->StopBeamTracking();
@@ -147,27 +142,15 @@ FVector UBeamEyeTrackingComponent::GetGazePoint3D() const
         return FVector::ZeroVector;
     }
 
-    // This could be enhanced with proper screen-to-world projection
-    FVector2D Gaze2D = GetGazePoint2D();
-    FVector CameraLocation = FVector::ZeroVector;
-    FVector CameraForward = FVector::ForwardVector;
-    
-    if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
+    // Served from the subsystem's per-frame gaze ray for the first local player
+    FBeamWorldRay Ray;
+    if (!BeamSubsystem->GetGazeWorldRay(nullptr, Ray))
     {
-        if (APawn* Pawn = PC->GetPawn())
-        {
-            CameraLocation = Pawn->GetActorLocation();
-            CameraForward = Pawn->GetActorForwardVector();
-        }
+        return FVector::ZeroVector;
     }
-    
-    // Project gaze point into world space (simplified)
-    float Distance = 1000.0f; // Default distance
-    FVector GazeDirection = FVector(
-        (Gaze2D.X - 0.5f) * 2.0f,          (Gaze2D.Y - 0.5f) * 2.0f,          1.0f                        // Forward direction
-    );
-    
-    return CameraLocation + (GazeDirection * Distance);
+
+    const float Distance = 1000.0f; // Default distance
+    return Ray.Origin + (Ray.Direction * Distance);
 }
 
 FTransform UBeamEyeTrackingComponent::GetHeadPose() const
@@ -216,6 +199,10 @@ void UBeamEyeTrackingComponent::SetUpdateFrequency(float NewFrequency)
         {
             ApplyPerformanceOptimizations();
         }
+        if (bTrackingActive)
+        {
+            SubscribeToRateView();
+        }
     }
 }
 
@@ -228,6 +215,10 @@ void UBeamEyeTrackingComponent::SetPerformanceMode(bool bEnable)
         if (bPerformanceMode)
         {
             ApplyPerformanceOptimizations();
+            if (bTrackingActive)
+            {
+                SubscribeToRateView();
+            }
             UE_LOG(LogBeam, Log, TEXT("BeamEyeTrackingComponent: Performance mode enabled"));
         }
         else
@@ -237,21 +228,39 @@ void UBeamEyeTrackingComponent::SetPerformanceMode(bool bEnable)
     }
 }
 
-void UBeamEyeTrackingComponent::UpdateGazeData()
+void UBeamEyeTrackingComponent::SubscribeToRateView()
+{
+    UnsubscribeFromRateView();
+    if (BeamSubsystem)
+    {
+        RateViewHandle = BeamSubsystem->SubscribeToFrameRate(FBeamFrameRateView::Decimated(UpdateFrequency),
+            FOnBeamRateViewFrameNative::FDelegate::CreateUObject(this, &UBeamEyeTrackingComponent::UpdateGazeData));
+    }
+}
+
+void UBeamEyeTrackingComponent::UnsubscribeFromRateView()
 {
-    if (!BeamSubsystem || !bTrackingActive)
+    if (BeamSubsystem && RateViewHandle.IsValid())
+    {
+        BeamSubsystem->UnsubscribeFromFrameRate(RateViewHandle);
+    }
+    RateViewHandle.Reset();
+}
+
+void UBeamEyeTrackingComponent::UpdateGazeData(const FBeamFrame& Frame)
+{
+    SCOPE_CYCLE_COUNTER(STAT_BeamTrackingComponentUpdate);
+
+    if (!BeamSubsystem || !bTrackingActive || !bAutoUpdate)
     {
         return;
     }
 
-    FGazePoint CurrentGaze = BeamSubsystem->CurrentGaze();
-    FHeadPose CurrentHeadPose = BeamSubsystem->HeadPosition();
-    
     // Store previous values for comparison
     FVector2D PreviousGaze2D = LastGazePoint2D;
     float PreviousConfidence = LastConfidence;
 
-    LastGazePoint2D = CurrentGaze.Screen01;
+    LastGazePoint2D = Frame.Gaze.Screen01;
     LastGazePoint3D = GetGazePoint3D(); // This will calculate 3D position
     LastHeadPose = GetHeadPose();        // This will calculate head transform
     LastConfidence = GetTrackingConfidence();
@@ -299,20 +308,6 @@ void UBeamEyeTrackingComponent::UpdateFPS()
     }
 }
 
-bool UBeamEyeTrackingComponent::ShouldUpdate() const
-{
-    if (UpdateFrequency <= 0.0f)
-    {
-        return false;
-    }
-    
-    float CurrentTime = GetWorld()->GetTimeSeconds();
-    float TimeSinceLastUpdate = CurrentTime - LastUpdateTime;
-    float UpdateInterval = 1.0f / UpdateFrequency;
-    
-    return TimeSinceLastUpdate >= UpdateInterval;
-}
-
 void UBeamEyeTrackingComponent::ApplyPerformanceOptimizations()
 {
     if (!bPerformanceMode)
@@ -2,8 +2,10 @@
     BeamFeatures.h: Feature gates and configuration for Beam SDK.
 
     Defines comprehensive feature gates for core functionality, P0 must-have
-    features, P1 optional features, and P2 tooling features. Configured
-    for full UE 5.6 testing with all features enabled.
+    features, P1 optional features, and P2 tooling features. Tooling gates
+    are set per target configuration by BeamEyeTracker.Build.cs, so shipping
+    builds compile them out; the defaults below apply only where a gate is
+    not already defined.
 
     Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
 
@@ -13,9 +15,12 @@
 #pragma once
 
 // BEAM EYE TRACKER FEATURE GATES
-// 
-// FULL BUILD FOR UE 5.6 TESTING
-// All features enabled for comprehensive testing
+//
+// Core gates are always on. Every other gate defaults to on and is
+// overridden by the module rules:
+//   Shipping   - core ring, filters and mapping only
+//   Test       - everything but the debug overlay
+//   Otherwise  - everything
 
 // Core functionality (always enabled)
 #define BEAM_FEATURE_CORE_SUBSYSTEM      1   /** Enables UBeamEyeTrackerSubsystem for global tracking access */
@@ -30,24 +35,36 @@
 #define BEAM_FEATURE_WATCHDOG_RECOVERY   1   /** Enables watchdog recovery with exponential backoff and health transitions */
 #define BEAM_FEATURE_DLL_SAFETY          1   /** Enables DLL path verification, lazy-load, and symbol checks */
 #define BEAM_FEATURE_WORLD_MAPPING       1   /** Enables ProjectGazeToWorld helpers for 3D interaction */
-#define BEAM_FEATURE_RECORDED_DATA       1   /** Enables tiny .beamrec recorder/playback (development only) */
 
-// P1 - Optional (Behind Flags; ON for testing)
+#ifndef BEAM_FEATURE_RECORDED_DATA
+#define BEAM_FEATURE_RECORDED_DATA       1   /** Enables .beamrec recording, playback and export from the subsystem */
+#endif
+
+// P1 - Optional (Behind Flags)
 #define BEAM_FEATURE_EYETRACKER_BRIDGE   1   /** Enables IEyeTracker adapter and conditional registration */
+
+#ifndef BEAM_FEATURE_DEBUG_OVERLAY
 #define BEAM_FEATURE_DEBUG_OVERLAY       1   /** Enables code-only debug overlay via UDebugDrawService/AHUD */
-#define BEAM_FEATURE_UNREAL_INSIGHTS     1   /** Enables trace poll duration, queue depth, and frame age metrics */
+#endif
+
+#ifndef BEAM_FEATURE_UNREAL_INSIGHTS
+#define BEAM_FEATURE_UNREAL_INSIGHTS     1   /** Enables FBeamTrace, trace poll duration, queue depth, and frame age metrics */
+#endif
+
+#ifndef BEAM_FEATURE_ANALYTICS
+#define BEAM_FEATURE_ANALYTICS           1   /** Enables the live gaze analytics worker of UBeamAnalyticsSubsystem */
+#endif
 
-// P2 - Tooling & Advanced (ON for testing)
+// P2 - Tooling & Advanced
 #define BEAM_FEATURE_BLUEPRINTS          1   /** Enables minimal Blueprint nodes (start/stop/getters/project) */
 #define BEAM_FEATURE_K2NODES             1   /** Enables custom K2 nodes for enhanced UX (Editor only) */
 #define BEAM_FEATURE_CONSOLE_COMMANDS    1   /** Enables CVars: Beam.Start, Beam.Stop, Beam.Dump */
 #define BEAM_FEATURE_PROFILES            1   /** Enables UDeveloperSettings profiles for configuration presets */
-#define BEAM_FEATURE_SYNTHETIC_DATA      1   /** Enables synthetic data source for CI/testing without hardware */
 
-// FULL BUILD FOR UE 5.6 TESTING
-// For Testing: All features enabled for comprehensive functionality testing
+#ifndef BEAM_FEATURE_SYNTHETIC_DATA
+#define BEAM_FEATURE_SYNTHETIC_DATA      1   /** Enables synthetic data source for CI/testing without hardware */
+#endif
 
 /*=============================================================================
     End of BeamFeatures.h
 =============================================================================*/
-
@@ -0,0 +1,214 @@
+// Implements the wall-clock paced .beamrec data source
+
+#include "BeamFileDataSource.h"
+#include "BeamLogging.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+FBeamFileDataSource::FBeamFileDataSource(const FString& InFilePath, bool bInLoop)
+	: FilePath(InFilePath)
+	, bLoop(bInLoop)
+{
+}
+
+FBeamFileDataSource::~FBeamFileDataSource()
+{
+	Shutdown();
+}
+
+bool FBeamFileDataSource::Initialize()
+{
+	FScopeLock Lock(&PlaybackLock);
+
+	if (Recording.IsPlayingBack())
+	{
+		return true;
+	}
+
+	if (!Recording.StartPlayback(FilePath))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: File data source could not open '%s'"), *FilePath);
+		return false;
+	}
+
+	if (!Recording.PeekNextFrameTimestamp(FirstTimestampMs))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: File data source recording '%s' is empty"), *FilePath);
+		Recording.StopPlayback();
+		return false;
+	}
+
+	StartWallSeconds = FPlatformTime::Seconds();
+	LoopOffsetMs = 0.0;
+	LastRecordedTimestampMs = FirstTimestampMs;
+	bHasFrame = false;
+	bFinished = false;
+	NextFrameId = 0;
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: File data source playing '%s' (%d frames, %s)"),
+		*FilePath, Recording.GetPlaybackFrameCount(), Recording.IsMemoryMapped() ? TEXT("mapped") : TEXT("buffered"));
+	return true;
+}
+
+void FBeamFileDataSource::Shutdown()
+{
+	FScopeLock Lock(&PlaybackLock);
+
+	if (Recording.IsPlayingBack())
+	{
+		Recording.StopPlayback();
+	}
+	bHasFrame = false;
+}
+
+bool FBeamFileDataSource::IsValid() const
+{
+	FScopeLock Lock(&PlaybackLock);
+	return Recording.IsPlayingBack();
+}
+
+bool FBeamFileDataSource::InitSDK(const FString& AppName, int32 InViewportWidth, int32 InViewportHeight)
+{
+	UpdateViewportGeometry(InViewportWidth, InViewportHeight);
+	return Initialize();
+}
+
+void FBeamFileDataSource::UpdateViewportGeometry(int32 InViewportWidth, int32 InViewportHeight)
+{
+	FScopeLock Lock(&PlaybackLock);
+	ViewportWidth = InViewportWidth;
+	ViewportHeight = InViewportHeight;
+}
+
+EBeamHealth FBeamFileDataSource::GetHealth() const
+{
+	FScopeLock Lock(&PlaybackLock);
+
+	if (!Recording.IsPlayingBack())
+	{
+		return EBeamHealth::Error;
+	}
+	return bFinished ? EBeamHealth::NoData : EBeamHealth::Ok;
+}
+
+bool FBeamFileDataSource::FetchCurrentFrame(FBeamFrame& OutFrame)
+{
+	FScopeLock Lock(&PlaybackLock);
+
+	if (!Recording.IsPlayingBack())
+	{
+		return false;
+	}
+
+	// Skip to the newest frame that is already due; pull callers may poll slower than the recording rate
+	const double NowSeconds = FPlatformTime::Seconds();
+	double DueSeconds = 0.0;
+	while (GetNextDueSeconds(DueSeconds) && DueSeconds <= NowSeconds)
+	{
+		EmitNextFrame(DueSeconds, LastFrame);
+		bHasFrame = true;
+	}
+
+	if (!bHasFrame)
+	{
+		return false;
+	}
+
+	OutFrame = LastFrame;
+	return true;
+}
+
+bool FBeamFileDataSource::WaitForNextFrame(FBeamFrame& OutFrame, uint32 TimeoutMs)
+{
+	double DueSeconds = 0.0;
+	{
+		FScopeLock Lock(&PlaybackLock);
+		if (!Recording.IsPlayingBack() || !GetNextDueSeconds(DueSeconds))
+		{
+			DueSeconds = -1.0;
+		}
+	}
+
+	if (DueSeconds < 0.0)
+	{
+		FPlatformProcess::Sleep(TimeoutMs * 0.001f);
+		return false;
+	}
+
+	const double WaitSeconds = DueSeconds - FPlatformTime::Seconds();
+	if (WaitSeconds > TimeoutMs * 0.001)
+	{
+		FPlatformProcess::Sleep(TimeoutMs * 0.001f);
+		return false;
+	}
+	if (WaitSeconds > 0.0)
+	{
+		FPlatformProcess::Sleep(static_cast<float>(WaitSeconds));
+	}
+
+	FScopeLock Lock(&PlaybackLock);
+	if (!Recording.IsPlayingBack() || !EmitNextFrame(DueSeconds, LastFrame))
+	{
+		return false;
+	}
+
+	bHasFrame = true;
+	OutFrame = LastFrame;
+	return true;
+}
+
+bool FBeamFileDataSource::GetNextDueSeconds(double& OutDueSeconds)
+{
+	double TimestampMs = 0.0;
+	if (!Recording.PeekNextFrameTimestamp(TimestampMs))
+	{
+		if (!bLoop || Recording.GetPlaybackFrameCount() == 0)
+		{
+			bFinished = true;
+			return false;
+		}
+
+		// Rewind, leaving one average frame interval between the last frame and the wrapped first one
+		const int32 FrameCount = Recording.GetPlaybackFrameCount();
+		const double SpanMs = LastRecordedTimestampMs - FirstTimestampMs;
+		const double IntervalMs = FrameCount > 1 ? SpanMs / (FrameCount - 1) : 1.0;
+		LoopOffsetMs += SpanMs + FMath::Max(IntervalMs, 0.001);
+
+		if (!Recording.SeekToTime(FirstTimestampMs) || !Recording.PeekNextFrameTimestamp(TimestampMs))
+		{
+			bFinished = true;
+			return false;
+		}
+	}
+
+	OutDueSeconds = StartWallSeconds + (TimestampMs + LoopOffsetMs - FirstTimestampMs) * 0.001;
+	return true;
+}
+
+bool FBeamFileDataSource::EmitNextFrame(double DueSeconds, FBeamFrame& OutFrame)
+{
+	FBeamFrame Frame;
+	if (!Recording.GetNextFrame(Frame))
+	{
+		return false;
+	}
+
+	LastRecordedTimestampMs = Frame.SDKTimestampMs;
+
+	Frame.FrameId = NextFrameId++;
+	Frame.SDKTimestampMs += LoopOffsetMs;
+	Frame.Gaze.TimestampMs += LoopOffsetMs;
+	Frame.Head.TimestampMs += LoopOffsetMs;
+	Frame.DeltaTimeSeconds = bHasFrame ? DueSeconds - OutFrame.UETimestampSeconds : 0.0;
+	Frame.UETimestampSeconds = DueSeconds;
+
+	// Recorded pixels belong to the recording machine's viewport
+	if (ViewportWidth > 0 && ViewportHeight > 0)
+	{
+		Frame.Gaze.ScreenPx = FVector2D(Frame.Gaze.Screen01.X * ViewportWidth, Frame.Gaze.Screen01.Y * ViewportHeight);
+	}
+
+	OutFrame = Frame;
+	return true;
+}
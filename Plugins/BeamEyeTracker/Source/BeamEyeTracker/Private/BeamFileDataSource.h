@@ -0,0 +1,88 @@
+/*=============================================================================
+    BeamFileDataSource.h: Recorded-file data source for Beam Eye Tracker.
+
+    Replays a .beamrec recording through the IBeamDataSource interface,
+    paced by the recorded timestamps, so recorded sessions can stand in
+    for the live tracker without loading the SDK wrapper.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IBeamDataSource.h"
+#include "BeamRecording.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Data source that plays a .beamrec file at its recorded rate.
+ *
+ * The recording is memory-mapped where the platform allows it, so opening
+ * is instant regardless of file size. Frames become due at the wall-clock
+ * time matching their recorded offset; WaitForNextFrame sleeps until then,
+ * FetchCurrentFrame returns the newest frame that is already due. When
+ * looping, timestamps keep increasing across wraps so ring and predictor
+ * consumers see one continuous session.
+ */
+class BEAMEYETRACKER_API FBeamFileDataSource : public IBeamDataSource
+{
+public:
+	explicit FBeamFileDataSource(const FString& InFilePath, bool bInLoop = true);
+	virtual ~FBeamFileDataSource();
+
+	// IBeamDataSource interface
+	virtual bool Initialize() override;
+	virtual void Shutdown() override;
+	virtual bool IsValid() const override;
+	virtual bool FetchCurrentFrame(FBeamFrame& OutFrame) override;
+	virtual EBeamHealth GetHealth() const override;
+	virtual bool StartCameraRecentering() override { return false; }
+	virtual void EndCameraRecentering() override {}
+	virtual bool InitSDK(const FString& AppName, int32 ViewportWidth, int32 ViewportHeight) override;
+	virtual bool IsSDKInitialized() const override { return IsValid(); }
+	virtual void UpdateViewportGeometry(int32 ViewportWidth, int32 ViewportHeight) override;
+	virtual bool StartCalibration(const FString& ProfileId) override { return false; }
+	virtual void StopCalibration() override {}
+	virtual bool WaitForNextFrame(FBeamFrame& OutFrame, uint32 TimeoutMs) override;
+
+	/** Recording being played */
+	const FString& GetFilePath() const { return FilePath; }
+
+private:
+	FString FilePath;
+	bool bLoop;
+
+	/** Guards the playback cursor; the producer thread and game thread may both pull */
+	mutable FCriticalSection PlaybackLock;
+	FBeamRecording Recording;
+
+	/** Recorded timestamp of the first frame and wall-clock time it was (re)started at */
+	double FirstTimestampMs = 0.0;
+	double StartWallSeconds = 0.0;
+
+	/** Added to recorded timestamps so they stay monotonic across loops */
+	double LoopOffsetMs = 0.0;
+	double LastRecordedTimestampMs = 0.0;
+
+	/** Viewport that pixel coordinates are remapped to (0 keeps the recorded pixels) */
+	int32 ViewportWidth = 0;
+	int32 ViewportHeight = 0;
+
+	FBeamFrame LastFrame;
+	bool bHasFrame = false;
+	bool bFinished = false;
+	int64 NextFrameId = 0;
+
+	/** Wall-clock time the next frame is due; false at the end of a non-looping file. Caller holds PlaybackLock. */
+	bool GetNextDueSeconds(double& OutDueSeconds);
+
+	/** Pops the next frame and restamps it for the current loop. Caller holds PlaybackLock. */
+	bool EmitNextFrame(double DueSeconds, FBeamFrame& OutFrame);
+};
+
+/*=============================================================================
+    End of BeamFileDataSource.h
+=============================================================================*/
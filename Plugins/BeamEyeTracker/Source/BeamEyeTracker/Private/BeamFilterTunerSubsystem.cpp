@@ -0,0 +1,323 @@
+// Implements background per-user One-Euro tuning from the live raw gaze stream
+
+#include "BeamFilterTunerSubsystem.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamEyeTrackerSettings.h"
+#include "BeamLogging.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ConfigCacheIni.h"
+
+// User config section holding "MinCutoff,Beta" per calibration profile
+#define BEAM_TUNER_CONFIG_SECTION TEXT("BeamEyeTracker.FilterTuning")
+
+// Key used for the profile-less default user
+#define BEAM_TUNER_DEFAULT_PROFILE TEXT("Default")
+
+// Seconds of gaze collected before the first pass
+#define BEAM_TUNER_WARMUP_SECONDS 5.0
+
+void UBeamFilterTunerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	BeamSubsystem = Collection.InitializeDependency<UBeamEyeTrackerSubsystem>();
+	if (BeamSubsystem)
+	{
+		BeamSubsystem->OnFrameRingReleased.AddUObject(this, &UBeamFilterTunerSubsystem::HandleFrameRingReleased);
+	}
+	Scratch.Reserve(FBeamFrameRing::BufferSize);
+
+	const UBeamEyeTrackerSettings* Settings = GetDefault<UBeamEyeTrackerSettings>();
+	if (Settings)
+	{
+		Options.LagWeight = Settings->AutoTuneLagWeight;
+		if (Settings->bAutoTuneFilters && Settings->bEnableSmoothing)
+		{
+			StartAutoTuning();
+		}
+	}
+}
+
+void UBeamFilterTunerSubsystem::Deinitialize()
+{
+	StopAutoTuning();
+	if (BeamSubsystem)
+	{
+		BeamSubsystem->OnFrameRingReleased.RemoveAll(this);
+		BeamSubsystem = nullptr;
+	}
+
+	Super::Deinitialize();
+}
+
+bool UBeamFilterTunerSubsystem::StartAutoTuning()
+{
+	if (IsAutoTuning())
+	{
+		return true;
+	}
+	if (!BeamSubsystem || !BeamSubsystem->GetFrameRing())
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Filter auto-tuning needs a running tracking subsystem"));
+		return false;
+	}
+
+	BeamSubsystem->AddRawCaptureUser();
+	bRawCaptureRegistered = true;
+
+	Window.Reset();
+	FollowedRing = nullptr;
+	bHasActiveProfile = false;
+	NextTuneSeconds = FPlatformTime::Seconds() + BEAM_TUNER_WARMUP_SECONDS;
+
+	// Restores the saved parameters of the current profile before the first pass
+	UpdateProfile();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamFilterTunerSubsystem::Tick));
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Filter auto-tuning started"));
+	return true;
+}
+
+void UBeamFilterTunerSubsystem::StopAutoTuning()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+	if (bRawCaptureRegistered && BeamSubsystem)
+	{
+		BeamSubsystem->RemoveRawCaptureUser();
+	}
+	bRawCaptureRegistered = false;
+
+	// A pass in flight works on its own copy of the window; its result is simply dropped
+	PendingPass = TFuture<FTuningPass>();
+	Window.Reset();
+	FollowedRing = nullptr;
+}
+
+void UBeamFilterTunerSubsystem::SetTuningTradeoff(float LagWeight, float TargetJitter, float TargetLagMs)
+{
+	Options.LagWeight = FMath::Max(LagWeight, 0.0f);
+	Options.TargetJitter = FMath::Max(TargetJitter, UE_KINDA_SMALL_NUMBER);
+	Options.TargetLagMs = FMath::Max(TargetLagMs, UE_KINDA_SMALL_NUMBER);
+}
+
+bool UBeamFilterTunerSubsystem::GetLastTuning(float& OutMinCutoff, float& OutBeta, float& OutJitterRms, float& OutLagMs) const
+{
+	if (!LastPass.bValid || !BeamSubsystem)
+	{
+		return false;
+	}
+	BeamSubsystem->GetOneEuroParams(OutMinCutoff, OutBeta);
+	OutJitterRms = static_cast<float>(LastPass.Current.JitterRms);
+	OutLagMs = static_cast<float>(LastPass.Current.LagMs);
+	return true;
+}
+
+void UBeamFilterTunerSubsystem::ClearTunedProfile(const FString& ProfileId)
+{
+	if (GConfig)
+	{
+		GConfig->RemoveKey(BEAM_TUNER_CONFIG_SECTION, ProfileId.IsEmpty() ? BEAM_TUNER_DEFAULT_PROFILE : *ProfileId, GGameUserSettingsIni);
+		GConfig->Flush(false, GGameUserSettingsIni);
+	}
+}
+
+bool UBeamFilterTunerSubsystem::Tick(float DeltaTime)
+{
+	if (!BeamSubsystem)
+	{
+		return true;
+	}
+
+	UpdateProfile();
+	CollectFrames();
+
+	if (PendingPass.IsValid())
+	{
+		if (!PendingPass.IsReady())
+		{
+			return true;
+		}
+		ApplyPass(PendingPass.Get());
+		PendingPass = TFuture<FTuningPass>();
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (NowSeconds >= NextTuneSeconds && Window.Num() > 0)
+	{
+		LaunchPass();
+		NextTuneSeconds = NowSeconds + TuneIntervalSeconds;
+	}
+	return true;
+}
+
+void UBeamFilterTunerSubsystem::CollectFrames()
+{
+	// The raw ring appears and disappears with the producer mode; restart the window when it changes
+	const FBeamFrameRing* Ring = BeamSubsystem->GetRawFrameRing();
+	if (Ring != FollowedRing)
+	{
+		FollowedRing = Ring;
+		Window.Reset();
+		if (!Ring)
+		{
+			return;
+		}
+		FBeamFrame Latest;
+		LastTimestampMs = Ring->ReadLatest(Latest) ? Latest.SDKTimestampMs : 0.0;
+	}
+	if (!Ring)
+	{
+		return;
+	}
+
+	Scratch.Reset();
+	Ring->CopyFramesInRange(LastTimestampMs, TNumericLimits<double>::Max(), Scratch);
+	for (const FBeamFrame& Frame : Scratch)
+	{
+		if (Frame.SDKTimestampMs > LastTimestampMs)
+		{
+			Window.Add(Frame);
+			LastTimestampMs = Frame.SDKTimestampMs;
+		}
+	}
+
+	// Timestamps behind the last one read mean the ring was cleared and restarted with a new origin
+	FBeamFrame Latest;
+	if (Scratch.Num() == 0 && Ring->ReadLatest(Latest) && Latest.SDKTimestampMs < LastTimestampMs)
+	{
+		Window.Reset();
+		LastTimestampMs = 0.0;
+		return;
+	}
+
+	// Trim in chunks so the window is not shifted on every tick
+	if (Window.Num() > 0)
+	{
+		const double OldestKeptMs = Window.Last().SDKTimestampMs - WindowSeconds * 1000.0;
+		const double SlackMs = WindowSeconds * 250.0;
+		if (Window[0].SDKTimestampMs < OldestKeptMs - SlackMs)
+		{
+			const int32 NumDropped = Algo::LowerBoundBy(Window, OldestKeptMs, &FBeamFrame::SDKTimestampMs);
+			Window.RemoveAt(0, NumDropped, EAllowShrinking::No);
+		}
+	}
+}
+
+void UBeamFilterTunerSubsystem::LaunchPass()
+{
+	float CurrentMinCutoff = 1.0f;
+	float CurrentBeta = 0.0f;
+	BeamSubsystem->GetOneEuroParams(CurrentMinCutoff, CurrentBeta);
+
+	PendingPass = Async(EAsyncExecution::ThreadPool, [Frames = Window, PassOptions = Options, CurrentMinCutoff, CurrentBeta]()
+	{
+		FTuningPass Pass;
+
+		FBeamGazeTrace Trace;
+		Trace.Build(Frames);
+		if (BeamFilterTuning::FindBestParams(Trace, PassOptions, Pass.Best))
+		{
+			Pass.Current = BeamFilterTuning::Evaluate(Trace, CurrentMinCutoff, CurrentBeta, PassOptions);
+			Pass.bValid = true;
+		}
+		return Pass;
+	});
+}
+
+void UBeamFilterTunerSubsystem::ApplyPass(const FTuningPass& Pass)
+{
+	if (!Pass.bValid)
+	{
+		UE_LOG(LogBeam, Verbose, TEXT("BeamEyeTracker: Filter tuning window had too few fixations or saccades"));
+		return;
+	}
+	LastPass = Pass;
+
+	float MinCutoff = 1.0f;
+	float Beta = 0.0f;
+	BeamSubsystem->GetOneEuroParams(MinCutoff, Beta);
+
+	// Blend in log space: both parameters act multiplicatively on the cutoff
+	auto LogBlend = [this](float From, float To)
+	{
+		From = FMath::Max(From, UE_KINDA_SMALL_NUMBER);
+		To = FMath::Max(To, UE_KINDA_SMALL_NUMBER);
+		return FMath::Exp(FMath::Lerp(FMath::Loge(From), FMath::Loge(To), BlendFactor));
+	};
+	MinCutoff = LogBlend(MinCutoff, Pass.Best.MinCutoff);
+	Beta = LogBlend(Beta, Pass.Best.Beta);
+
+	BeamSubsystem->SetOneEuroParams(MinCutoff, Beta);
+	SaveProfileParams(ActiveProfile, MinCutoff, Beta);
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Tuned filters for '%s': MinCutoff %.3f, Beta %.4f (was jitter %.5f, lag %.1f ms; best jitter %.5f, lag %.1f ms)"),
+		ActiveProfile.IsEmpty() ? BEAM_TUNER_DEFAULT_PROFILE : *ActiveProfile, MinCutoff, Beta,
+		Pass.Current.JitterRms, Pass.Current.LagMs, Pass.Best.JitterRms, Pass.Best.LagMs);
+}
+
+void UBeamFilterTunerSubsystem::UpdateProfile()
+{
+	const FString Profile = BeamSubsystem ? BeamSubsystem->GetCalibrationProfile() : FString();
+	if (bHasActiveProfile && Profile == ActiveProfile)
+	{
+		return;
+	}
+	ActiveProfile = Profile;
+	bHasActiveProfile = true;
+
+	// A pass over the previous user's gaze must not be saved for the new one
+	PendingPass = TFuture<FTuningPass>();
+	Window.Reset();
+	LastPass = FTuningPass();
+	NextTuneSeconds = FPlatformTime::Seconds() + BEAM_TUNER_WARMUP_SECONDS;
+
+	float MinCutoff = 0.0f;
+	float Beta = 0.0f;
+	if (BeamSubsystem && LoadProfileParams(Profile, MinCutoff, Beta))
+	{
+		BeamSubsystem->SetOneEuroParams(MinCutoff, Beta);
+		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Restored tuned filters for '%s': MinCutoff %.3f, Beta %.4f"),
+			Profile.IsEmpty() ? BEAM_TUNER_DEFAULT_PROFILE : *Profile, MinCutoff, Beta);
+	}
+}
+
+bool UBeamFilterTunerSubsystem::LoadProfileParams(const FString& ProfileId, float& OutMinCutoff, float& OutBeta)
+{
+	FString Value;
+	if (!GConfig || !GConfig->GetString(BEAM_TUNER_CONFIG_SECTION, ProfileId.IsEmpty() ? BEAM_TUNER_DEFAULT_PROFILE : *ProfileId, Value, GGameUserSettingsIni))
+	{
+		return false;
+	}
+
+	FString MinCutoffText;
+	FString BetaText;
+	if (!Value.Split(TEXT(","), &MinCutoffText, &BetaText))
+	{
+		return false;
+	}
+	OutMinCutoff = FCString::Atof(*MinCutoffText);
+	OutBeta = FCString::Atof(*BetaText);
+	return OutMinCutoff > 0.0f && OutBeta >= 0.0f;
+}
+
+void UBeamFilterTunerSubsystem::SaveProfileParams(const FString& ProfileId, float MinCutoff, float Beta)
+{
+	if (!GConfig)
+	{
+		return;
+	}
+	GConfig->SetString(BEAM_TUNER_CONFIG_SECTION, ProfileId.IsEmpty() ? BEAM_TUNER_DEFAULT_PROFILE : *ProfileId,
+		*FString::Printf(TEXT("%f,%f"), MinCutoff, Beta), GGameUserSettingsIni);
+	GConfig->Flush(false, GGameUserSettingsIni);
+}
+
+void UBeamFilterTunerSubsystem::HandleFrameRingReleased()
+{
+	StopAutoTuning();
+}
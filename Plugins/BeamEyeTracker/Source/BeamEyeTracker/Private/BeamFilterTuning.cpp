@@ -0,0 +1,340 @@
+// Implements batch One-Euro filtering and parallel parameter sweeps over recorded gaze
+
+#include "BeamFilterTuning.h"
+#include "BeamRecording.h"
+#include "BeamLogging.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+// Frame intervals above this multiple of the median split the trace into segments
+#define BEAM_TUNING_GAP_FACTOR 2.5f
+
+// Fixation and saccade samples a trace needs before FindBestParams trusts a sweep
+#define BEAM_TUNING_MIN_LABELED_SAMPLES 32
+
+namespace
+{
+	/** One-Euro step with every per-trace constant precomputed; same arithmetic as FBeamFilterBank */
+	struct FOneEuroKernel
+	{
+		float InvDt;
+		float DerivativeAlpha;
+		float MinCutoffRc;
+		float BetaRc;
+
+		FVector2f Value = FVector2f::ZeroVector;
+		FVector2f Derivative = FVector2f::ZeroVector;
+
+		FOneEuroKernel(float MinCutoff, float Beta, float DeltaSeconds, float DerivativeCutoff)
+		{
+			const float TwoPiDt = UE_TWO_PI * DeltaSeconds;
+			const float DerivativeRc = TwoPiDt * DerivativeCutoff;
+			InvDt = 1.0f / DeltaSeconds;
+			DerivativeAlpha = DerivativeRc / (DerivativeRc + 1.0f);
+			MinCutoffRc = MinCutoff * TwoPiDt;
+			BetaRc = Beta * TwoPiDt;
+		}
+
+		void Restart(const FVector2f& Sample)
+		{
+			Value = Sample;
+			Derivative = FVector2f::ZeroVector;
+		}
+
+		FORCEINLINE const FVector2f& Step(const FVector2f& Sample)
+		{
+			const FVector2f Delta = Sample - Value;
+			Derivative += (Delta * InvDt - Derivative) * DerivativeAlpha;
+
+			const float RcX = MinCutoffRc + BetaRc * FMath::Abs(Derivative.X);
+			const float RcY = MinCutoffRc + BetaRc * FMath::Abs(Derivative.Y);
+			Value.X += Delta.X * (RcX / (RcX + 1.0f));
+			Value.Y += Delta.Y * (RcY / (RcY + 1.0f));
+			return Value;
+		}
+	};
+}
+
+// FBeamGazeTrace
+
+void FBeamGazeTrace::Build(TConstArrayView<FBeamFrame> Frames)
+{
+	Samples.Reset();
+	Speed.Reset();
+	SegmentStarts.Reset();
+
+	TArray<double> Timestamps;
+	Timestamps.Reserve(Frames.Num());
+	Samples.Reserve(Frames.Num());
+	for (const FBeamFrame& Frame : Frames)
+	{
+		if (Frame.Gaze.bValid && !Frame.bGazeSynthesized)
+		{
+			Samples.Add(FVector2f(Frame.Gaze.Screen01));
+			Timestamps.Add(Frame.SDKTimestampMs);
+		}
+	}
+
+	if (Samples.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<double> Intervals;
+	Intervals.Reserve(Samples.Num());
+	for (int32 i = 1; i < Timestamps.Num(); ++i)
+	{
+		const double IntervalMs = Timestamps[i] - Timestamps[i - 1];
+		if (IntervalMs > 0.0)
+		{
+			Intervals.Add(IntervalMs);
+		}
+	}
+	if (Intervals.Num() > 0)
+	{
+		Intervals.Sort();
+		DeltaSeconds = static_cast<float>(Intervals[Intervals.Num() / 2] * 0.001);
+	}
+
+	const double GapMs = DeltaSeconds * 1000.0 * BEAM_TUNING_GAP_FACTOR;
+	SegmentStarts.Add(0);
+	for (int32 i = 1; i < Timestamps.Num(); ++i)
+	{
+		const double IntervalMs = Timestamps[i] - Timestamps[i - 1];
+		if (IntervalMs <= 0.0 || IntervalMs > GapMs)
+		{
+			SegmentStarts.Add(i);
+		}
+	}
+
+	// Five-point difference keeps per-sample noise from reading as fixation motion
+	Speed.SetNumZeroed(Samples.Num());
+	for (int32 Segment = 0; Segment < SegmentStarts.Num(); ++Segment)
+	{
+		const int32 First = SegmentStarts[Segment];
+		const int32 Last = (Segment + 1 < SegmentStarts.Num() ? SegmentStarts[Segment + 1] : Samples.Num()) - 1;
+		for (int32 i = First; i <= Last; ++i)
+		{
+			const int32 Lo = FMath::Max(First, i - 2);
+			const int32 Hi = FMath::Min(Last, i + 2);
+			if (Hi > Lo)
+			{
+				Speed[i] = FVector2f::Distance(Samples[Hi], Samples[Lo]) / ((Hi - Lo) * DeltaSeconds);
+			}
+		}
+	}
+}
+
+bool FBeamGazeTrace::LoadFromRecording(const FString& FilePath)
+{
+	FBeamRecording Recording;
+	if (!Recording.StartPlayback(FilePath))
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Cannot open recording '%s' for filter tuning"), *FilePath);
+		return false;
+	}
+
+	TArray<FBeamFrame> Frames;
+	Frames.Reserve(Recording.GetPlaybackFrameCount());
+	FBeamFrame Frame;
+	while (Recording.GetNextFrame(Frame))
+	{
+		Frames.Add(Frame);
+	}
+	Recording.StopPlayback();
+
+	Build(Frames);
+	return Num() > 0;
+}
+
+// BeamFilterTuning
+
+void BeamFilterTuning::FilterOneEuro(const FOneEuroFilterParams& Params, float DeltaSeconds, TConstArrayView<FVector2f> Input, TArrayView<FVector2f> Output, float DerivativeCutoff)
+{
+#if !UE_BUILD_SHIPPING
+	check(Output.Num() >= Input.Num());
+	check(DeltaSeconds > 0.0f);
+#endif
+
+	if (Input.Num() == 0)
+	{
+		return;
+	}
+
+	FOneEuroKernel Kernel(Params.MinCutoff, Params.Beta, DeltaSeconds, DerivativeCutoff);
+	Kernel.Restart(Input[0]);
+	Output[0] = Input[0];
+	for (int32 i = 1; i < Input.Num(); ++i)
+	{
+		Output[i] = Kernel.Step(Input[i]);
+	}
+}
+
+FBeamFilterSweepResult BeamFilterTuning::Evaluate(const FBeamGazeTrace& Trace, float MinCutoff, float Beta, const FBeamFilterSweepOptions& Options)
+{
+	FBeamFilterSweepResult Result;
+	Result.MinCutoff = MinCutoff;
+	Result.Beta = Beta;
+
+	FOneEuroKernel Kernel(MinCutoff, Beta, Trace.DeltaSeconds, Options.DerivativeCutoff);
+
+	double JitterSquaredSum = 0.0;
+	double LagSecondsSum = 0.0;
+	int32 NumFixation = 0;
+	int32 NumSaccade = 0;
+
+	for (int32 Segment = 0; Segment < Trace.SegmentStarts.Num(); ++Segment)
+	{
+		const int32 First = Trace.SegmentStarts[Segment];
+		const int32 End = Segment + 1 < Trace.SegmentStarts.Num() ? Trace.SegmentStarts[Segment + 1] : Trace.Num();
+
+		Kernel.Restart(Trace.Samples[First]);
+		FVector2f Previous = Kernel.Value;
+		for (int32 i = First + 1; i < End; ++i)
+		{
+			const FVector2f& Filtered = Kernel.Step(Trace.Samples[i]);
+			const float RawSpeed = Trace.Speed[i];
+			if (RawSpeed < Options.FixationSpeed)
+			{
+				JitterSquaredSum += FVector2f::DistSquared(Filtered, Previous);
+				++NumFixation;
+			}
+			else if (RawSpeed > Options.SaccadeSpeed)
+			{
+				LagSecondsSum += FVector2f::Distance(Filtered, Trace.Samples[i]) / RawSpeed;
+				++NumSaccade;
+			}
+			Previous = Filtered;
+		}
+	}
+
+	Result.JitterRms = NumFixation > 0 ? FMath::Sqrt(JitterSquaredSum / NumFixation) : 0.0;
+	Result.LagMs = NumSaccade > 0 ? LagSecondsSum * 1000.0 / NumSaccade : 0.0;
+	Result.Score = FMath::Square(Result.JitterRms / Options.TargetJitter) + Options.LagWeight * FMath::Square(Result.LagMs / Options.TargetLagMs);
+	return Result;
+}
+
+void BeamFilterTuning::Sweep(const FBeamGazeTrace& Trace, TConstArrayView<FVector2f> Pairs, const FBeamFilterSweepOptions& Options, TArray<FBeamFilterSweepResult>& OutResults)
+{
+	OutResults.SetNum(Pairs.Num());
+	if (Trace.Num() == 0)
+	{
+		return;
+	}
+
+	// Each pair streams the whole trace with no shared state, so pairs scale across every worker
+	ParallelFor(Pairs.Num(), [&Trace, &Pairs, &Options, &OutResults](int32 Index)
+	{
+		OutResults[Index] = Evaluate(Trace, Pairs[Index].X, Pairs[Index].Y, Options);
+	});
+}
+
+void BeamFilterTuning::MakeLogGrid(FVector2f MinCutoffRange, FVector2f BetaRange, int32 Steps, TArray<FVector2f>& OutPairs)
+{
+	Steps = FMath::Max(Steps, 2);
+	OutPairs.Reset(Steps * Steps);
+
+	const float LogMinCutoff0 = FMath::Loge(FMath::Max(MinCutoffRange.X, UE_KINDA_SMALL_NUMBER));
+	const float LogMinCutoff1 = FMath::Loge(FMath::Max(MinCutoffRange.Y, UE_KINDA_SMALL_NUMBER));
+	const float LogBeta0 = FMath::Loge(FMath::Max(BetaRange.X, UE_KINDA_SMALL_NUMBER));
+	const float LogBeta1 = FMath::Loge(FMath::Max(BetaRange.Y, UE_KINDA_SMALL_NUMBER));
+
+	for (int32 CutoffStep = 0; CutoffStep < Steps; ++CutoffStep)
+	{
+		const float MinCutoff = FMath::Exp(FMath::Lerp(LogMinCutoff0, LogMinCutoff1, CutoffStep / float(Steps - 1)));
+		for (int32 BetaStep = 0; BetaStep < Steps; ++BetaStep)
+		{
+			OutPairs.Emplace(MinCutoff, FMath::Exp(FMath::Lerp(LogBeta0, LogBeta1, BetaStep / float(Steps - 1))));
+		}
+	}
+}
+
+bool BeamFilterTuning::FindBestParams(const FBeamGazeTrace& Trace, const FBeamFilterSweepOptions& Options, FBeamFilterSweepResult& OutBest)
+{
+	int32 NumFixation = 0;
+	int32 NumSaccade = 0;
+	for (const float RawSpeed : Trace.Speed)
+	{
+		NumFixation += RawSpeed < Options.FixationSpeed ? 1 : 0;
+		NumSaccade += RawSpeed > Options.SaccadeSpeed ? 1 : 0;
+	}
+	if (NumFixation < BEAM_TUNING_MIN_LABELED_SAMPLES || NumSaccade < BEAM_TUNING_MIN_LABELED_SAMPLES)
+	{
+		return false;
+	}
+
+	auto PickBest = [](const TArray<FBeamFilterSweepResult>& Results, FBeamFilterSweepResult& Best)
+	{
+		for (const FBeamFilterSweepResult& Result : Results)
+		{
+			if (Result.Score < Best.Score)
+			{
+				Best = Result;
+			}
+		}
+	};
+
+	// Coarse log grid over the useful range, then a finer grid one coarse step around the winner
+	static constexpr int32 CoarseSteps = 24;
+	static constexpr int32 FineSteps = 8;
+	const FVector2f MinCutoffRange(0.1f, 5.0f);
+	const FVector2f BetaRange(0.001f, 1.0f);
+
+	TArray<FVector2f> Pairs;
+	TArray<FBeamFilterSweepResult> Results;
+	MakeLogGrid(MinCutoffRange, BetaRange, CoarseSteps, Pairs);
+	Sweep(Trace, Pairs, Options, Results);
+
+	FBeamFilterSweepResult Best;
+	PickBest(Results, Best);
+
+	const float CutoffStepRatio = FMath::Pow(MinCutoffRange.Y / MinCutoffRange.X, 1.0f / (CoarseSteps - 1));
+	const float BetaStepRatio = FMath::Pow(BetaRange.Y / BetaRange.X, 1.0f / (CoarseSteps - 1));
+	MakeLogGrid(FVector2f(Best.MinCutoff / CutoffStepRatio, Best.MinCutoff * CutoffStepRatio),
+		FVector2f(Best.Beta / BetaStepRatio, Best.Beta * BetaStepRatio), FineSteps, Pairs);
+	Sweep(Trace, Pairs, Options, Results);
+	PickBest(Results, Best);
+
+	Best.MinCutoff = FMath::Clamp(Best.MinCutoff, MinCutoffRange.X, MinCutoffRange.Y);
+	Best.Beta = FMath::Clamp(Best.Beta, 0.0f, BetaRange.Y);
+	OutBest = Best;
+	return true;
+}
+
+// Usage: "Beam.Filters.Tune <Recording.beamrec> [LagWeight]"
+static FAutoConsoleCommand BeamFiltersTuneCommand(
+	TEXT("Beam.Filters.Tune"),
+	TEXT("Sweep One-Euro MinCutoff/Beta over a recording and log the best pair for the jitter/lag tradeoff"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Usage: Beam.Filters.Tune <Recording.beamrec> [LagWeight]"));
+			return;
+		}
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		FBeamGazeTrace Trace;
+		if (!Trace.LoadFromRecording(Args[0]))
+		{
+			return;
+		}
+
+		FBeamFilterSweepOptions Options;
+		if (Args.Num() > 1)
+		{
+			Options.LagWeight = FMath::Max(0.0f, FCString::Atof(*Args[1]));
+		}
+
+		FBeamFilterSweepResult Best;
+		if (!BeamFilterTuning::FindBestParams(Trace, Options, Best))
+		{
+			UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: '%s' has too few fixation or saccade samples to tune filters"), *Args[0]);
+			return;
+		}
+
+		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Tuned over %d samples in %.2f s: MinCutoff %.3f, Beta %.4f (jitter %.5f, lag %.1f ms)"),
+			Trace.Num(), FPlatformTime::Seconds() - StartSeconds, Best.MinCutoff, Best.Beta, Best.JitterRms, Best.LagMs);
+	})
+);
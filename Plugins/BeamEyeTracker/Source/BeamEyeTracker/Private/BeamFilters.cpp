@@ -2,6 +2,9 @@
 #include "HAL/PlatformTime.h"
 #include "HAL/PlatformMath.h"
 #include "Math/UnrealMathUtility.h"
+#include "BeamStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Apply Filters"), STAT_BeamApplyFilters, STATGROUP_Beam);
 
 // Performance optimization flags
 #define BEAM_FILTERS_USE_SIMD 1
@@ -165,7 +168,7 @@ FEmaFilter::FEmaFilter(const FEmaFilterParams& InParams)
 	: Params(InParams)
 	, LastGazeValue(FVector2D::ZeroVector)
 	, LastPositionValue(FVector::ZeroVector)
-	, LastRotationValue(FRotator::ZeroRotator)
+	, LastRotationValue(FQuat::Identity)
 	, bInitialized(false)
 {
 }
@@ -267,7 +270,7 @@ FVector FEmaFilter::Filter(const FVector& Input)
 	}
 }
 
-FRotator FEmaFilter::Filter(const FRotator& Input)
+FQuat FEmaFilter::Filter(const FQuat& Input)
 {
 	if (!bInitialized)
 	{
@@ -275,52 +278,25 @@ FRotator FEmaFilter::Filter(const FRotator& Input)
 		bInitialized = true;
 		return Input;
 	}
-	
+
 	const double Alpha = Params.bAdaptive ? CalculateAdaptiveAlpha(Input) : Params.Alpha;
-	
-#if BEAM_FILTERS_USE_SIMD && PLATFORM_ENABLE_VECTORINTRINSICS
-	if (PLATFORM_ENABLE_VECTORINTRINSICS)
-	{
-		// SIMD-optimized rotation filtering
-		__m128 InputVec = _mm_set_ps(0.0f, Input.Roll, Input.Yaw, Input.Pitch);
-		__m128 LastValueVec = _mm_set_ps(0.0f, LastRotationValue.Roll, LastRotationValue.Yaw, LastRotationValue.Pitch);
-		__m128 AlphaVec = _mm_set1_ps(static_cast<float>(Alpha));
-		__m128 OneMinusAlphaVec = _mm_set1_ps(static_cast<float>(1.0 - Alpha));
-		
-		// Apply EMA filter
-		__m128 FilteredValueVec = _mm_add_ps(
-			_mm_mul_ps(AlphaVec, InputVec),
-			_mm_mul_ps(OneMinusAlphaVec, LastValueVec)
-		);
-		
-		// Extract result
-		float FilteredArray[4];
-		_mm_store_ps(FilteredArray, FilteredValueVec);
-		FRotator FilteredValue(FilteredArray[0], FilteredArray[1], FilteredArray[2]);
-		
-		LastRotationValue = FilteredValue;
-		return FilteredValue;
-	}
-	else
-#endif
-	{
-		// Standard implementation
-		const FRotator FilteredValue(
-			FMath::Lerp(LastRotationValue.Pitch, Input.Pitch, Alpha),
-			FMath::Lerp(LastRotationValue.Yaw, Input.Yaw, Alpha),
-			FMath::Lerp(LastRotationValue.Roll, Input.Roll, Alpha)
-		);
-		
-		LastRotationValue = FilteredValue;
-		return FilteredValue;
-	}
+
+	// Blending Euler angles per axis swings the long way round at the +-180 wrap; the quaternion path cannot
+	const FQuat FilteredValue = BeamRotation::Nlerp(LastRotationValue, Input, Alpha);
+	LastRotationValue = FilteredValue;
+	return FilteredValue;
+}
+
+FRotator FEmaFilter::Filter(const FRotator& Input)
+{
+	return Filter(Input.Quaternion()).Rotator();
 }
 
 void FEmaFilter::Reset()
 {
 	LastGazeValue = FVector2D::ZeroVector;
 	LastPositionValue = FVector::ZeroVector;
-	LastRotationValue = FRotator::ZeroRotator;
+	LastRotationValue = FQuat::Identity;
 	bInitialized = false;
 }
 
@@ -366,22 +342,571 @@ double FEmaFilter::CalculateAdaptiveAlpha(const FVector& Input)
 	return FMath::Lerp(Params.Alpha, Params.Alpha * 0.5, NormalizedDistance);
 }
 
-double FEmaFilter::CalculateAdaptiveAlpha(const FRotator& Input)
+double FEmaFilter::CalculateAdaptiveAlpha(const FQuat& Input)
 {
 #if BEAM_FILTERS_USE_APPROXIMATIONS
-	// Fast rotation distance calculation using absolute differences
-	const double DeltaPitch = FMath::Abs(Input.Pitch - LastRotationValue.Pitch);
-	const double DeltaYaw = FMath::Abs(Input.Yaw - LastRotationValue.Yaw);
-	const double DeltaRoll = FMath::Abs(Input.Roll - LastRotationValue.Roll);
-	const double Distance = DeltaPitch + DeltaYaw + DeltaRoll; // Sum of absolute differences
+	// 1 - |dot| is 1 - cos of the half angle: no trig, and like the accurate path it reaches 1 at 180 degrees
+	const double NormalizedDistance = FMath::Clamp(1.0 - FMath::Abs(Input | LastRotationValue), 0.0, 1.0);
 #else
-	// Accurate rotation distance
-	const double Distance = FVector::Distance(Input.Vector(), LastRotationValue.Vector());
+	const double NormalizedDistance = FMath::Clamp(Input.AngularDistance(LastRotationValue) / UE_PI, 0.0, 1.0);
 #endif
 
-	const double NormalizedDistance = FMath::Clamp(Distance / 2.0, 0.0, 1.0);
-	
 	// Higher smoothing for larger changes
 	return FMath::Lerp(Params.Alpha, Params.Alpha * 0.5, NormalizedDistance);
 }
 
+// FBeamFilterBank Implementation
+
+FBeamFilterBank::FBeamFilterBank(const FBeamFilterBankParams& InParams)
+	: bHasGaze(false)
+	, bHasHead(false)
+{
+	UpdateParams(InParams);
+	Reset();
+}
+
+void FBeamFilterBank::Filter(FBeamFrame& Frame, double DeltaTimeSeconds)
+{
+	const bool bGazeValid = Frame.Gaze.bValid;
+	const bool bHeadValid = Frame.Head.Confidence > 0.0;
+	if ((!bGazeValid && !bHeadValid) || DeltaTimeSeconds <= 0.0)
+	{
+		return;
+	}
+
+	const FQuat4f Rotation(Frame.Head.RotationQuat);
+
+	VectorRegister4Float Input[NumLaneSets] =
+	{
+		MakeVectorRegisterFloat(static_cast<float>(Frame.Gaze.Screen01.X), static_cast<float>(Frame.Gaze.Screen01.Y), 0.0f, 0.0f),
+		MakeVectorRegisterFloat(static_cast<float>(Frame.Head.PositionCm.X), static_cast<float>(Frame.Head.PositionCm.Y), static_cast<float>(Frame.Head.PositionCm.Z), 0.0f),
+		MakeVectorRegisterFloat(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W)
+	};
+
+	// q and -q are the same rotation; filtering across the sign flip would sweep through the origin
+	const VectorRegister4Float SameHemisphere = VectorCompareGE(VectorDot4(Input[RotationLanes], Value[RotationLanes]), GlobalVectorConstants::FloatZero);
+	Input[RotationLanes] = VectorSelect(SameHemisphere, Input[RotationLanes], VectorNegate(Input[RotationLanes]));
+
+	const float Dt = static_cast<float>(DeltaTimeSeconds);
+	const VectorRegister4Float TwoPiDt = VectorSetFloat1(UE_TWO_PI * Dt);
+	const VectorRegister4Float InvDt = VectorSetFloat1(1.0f / Dt);
+	const float DerivativeRc = UE_TWO_PI * Dt * Params.DerivativeCutoff;
+	const VectorRegister4Float DerivativeAlpha = VectorSetFloat1(DerivativeRc / (DerivativeRc + 1.0f));
+
+	// Every lane set runs the same arithmetic; the per-lane cutoff adapts to that lane's own speed
+	VectorRegister4Float NewValue[NumLaneSets];
+	VectorRegister4Float NewDerivative[NumLaneSets];
+	for (int32 Set = 0; Set < NumLaneSets; ++Set)
+	{
+		const VectorRegister4Float Delta = VectorSubtract(Input[Set], Value[Set]);
+		NewDerivative[Set] = VectorMultiplyAdd(VectorSubtract(VectorMultiply(Delta, InvDt), Derivative[Set]), DerivativeAlpha, Derivative[Set]);
+
+		const VectorRegister4Float Cutoff = VectorMultiplyAdd(Beta[Set], VectorAbs(NewDerivative[Set]), MinCutoff[Set]);
+		const VectorRegister4Float Rc = VectorMultiply(Cutoff, TwoPiDt);
+		const VectorRegister4Float Alpha = VectorDivide(Rc, VectorAdd(Rc, GlobalVectorConstants::FloatOne));
+		NewValue[Set] = VectorMultiplyAdd(Delta, Alpha, Value[Set]);
+	}
+	NewValue[RotationLanes] = VectorNormalizeQuaternion(NewValue[RotationLanes]);
+
+	alignas(16) float Out[4];
+	if (bGazeValid)
+	{
+		// The first valid sample seeds the state and passes through
+		Value[GazeLanes] = bHasGaze ? NewValue[GazeLanes] : Input[GazeLanes];
+		Derivative[GazeLanes] = bHasGaze ? NewDerivative[GazeLanes] : GlobalVectorConstants::FloatZero;
+		bHasGaze = true;
+
+		VectorStoreAligned(Value[GazeLanes], Out);
+		Frame.Gaze.Screen01 = FVector2D(Out[0], Out[1]);
+	}
+	if (bHeadValid)
+	{
+		for (int32 Set = PositionLanes; Set <= RotationLanes; ++Set)
+		{
+			Value[Set] = bHasHead ? NewValue[Set] : Input[Set];
+			Derivative[Set] = bHasHead ? NewDerivative[Set] : GlobalVectorConstants::FloatZero;
+		}
+		bHasHead = true;
+
+		VectorStoreAligned(Value[PositionLanes], Out);
+		Frame.Head.PositionCm = FVector(Out[0], Out[1], Out[2]);
+		VectorStoreAligned(Value[RotationLanes], Out);
+		Frame.Head.SetRotation(FQuat(Out[0], Out[1], Out[2], Out[3]));
+	}
+}
+
+void FBeamFilterBank::Reset()
+{
+	for (int32 Set = 0; Set < NumLaneSets; ++Set)
+	{
+		Value[Set] = GlobalVectorConstants::FloatZero;
+		Derivative[Set] = GlobalVectorConstants::FloatZero;
+	}
+	bHasGaze = false;
+	bHasHead = false;
+}
+
+void FBeamFilterBank::UpdateParams(const FBeamFilterBankParams& NewParams)
+{
+	Params = NewParams;
+
+	const FOneEuroFilterParams* Groups[NumLaneSets] = { &Params.Gaze, &Params.HeadPosition, &Params.HeadRotation };
+	for (int32 Set = 0; Set < NumLaneSets; ++Set)
+	{
+		MinCutoff[Set] = VectorSetFloat1(Groups[Set]->MinCutoff);
+		Beta[Set] = VectorSetFloat1(Groups[Set]->Beta);
+	}
+}
+
+// FBeamKalmanFilter Implementation
+
+FBeamKalmanFilter::FBeamKalmanFilter(const FBeamKalmanParams& InParams)
+	: bHasGaze(false)
+	, bHasHead(false)
+{
+	UpdateParams(InParams);
+	Reset();
+}
+
+void FBeamKalmanFilter::Init(int32 First, int32 Last, const double* Measurement)
+{
+	for (int32 Channel = First; Channel < Last; ++Channel)
+	{
+		Position[Channel] = Measurement[Channel];
+		Velocity[Channel] = 0.0;
+		P00[Channel] = MeasurementNoise[Channel];
+		P01[Channel] = 0.0;
+		P11[Channel] = ProcessNoise[Channel];
+	}
+}
+
+void FBeamKalmanFilter::Update(int32 First, int32 Last, const double* Measurement, double DeltaSeconds)
+{
+	const double Dt = DeltaSeconds;
+	const double Dt2 = Dt * Dt;
+	const double Dt3Over3 = Dt2 * Dt / 3.0;
+	const double Dt2Over2 = Dt2 * 0.5;
+
+	for (int32 Channel = First; Channel < Last; ++Channel)
+	{
+		// Predict: x = F x, P = F P F' + Q with a continuous white-acceleration Q
+		const double Q = ProcessNoise[Channel];
+		const double PredictedPosition = Position[Channel] + Velocity[Channel] * Dt;
+		const double NewP00 = P00[Channel] + 2.0 * Dt * P01[Channel] + Dt2 * P11[Channel] + Q * Dt3Over3;
+		const double NewP01 = P01[Channel] + Dt * P11[Channel] + Q * Dt2Over2;
+		const double NewP11 = P11[Channel] + Q * Dt;
+
+		// Correct with the position measurement
+		const double S = NewP00 + MeasurementNoise[Channel];
+		const double K0 = NewP00 / S;
+		const double K1 = NewP01 / S;
+		const double Innovation = Measurement[Channel] - PredictedPosition;
+
+		Position[Channel] = PredictedPosition + K0 * Innovation;
+		Velocity[Channel] += K1 * Innovation;
+		P00[Channel] = (1.0 - K0) * NewP00;
+		P01[Channel] = (1.0 - K0) * NewP01;
+		P11[Channel] = NewP11 - K1 * NewP01;
+	}
+}
+
+void FBeamKalmanFilter::Filter(FBeamFrame& Frame, double DeltaTimeSeconds)
+{
+	const bool bGazeValid = Frame.Gaze.bValid;
+	const bool bHeadValid = Frame.Head.Confidence > 0.0;
+	if ((!bGazeValid && !bHeadValid) || DeltaTimeSeconds <= 0.0)
+	{
+		return;
+	}
+
+	constexpr int32 GazeFirst = static_cast<int32>(EBeamKalmanChannel::GazeX);
+	constexpr int32 HeadFirst = static_cast<int32>(EBeamKalmanChannel::HeadX);
+	constexpr int32 RotationFirst = static_cast<int32>(EBeamKalmanChannel::HeadPitch);
+
+	double Measurement[NumChannels] =
+	{
+		Frame.Gaze.Screen01.X, Frame.Gaze.Screen01.Y,
+		Frame.Head.PositionCm.X, Frame.Head.PositionCm.Y, Frame.Head.PositionCm.Z,
+		Frame.Head.Rotation.Pitch, Frame.Head.Rotation.Yaw, Frame.Head.Rotation.Roll
+	};
+
+	if (bGazeValid)
+	{
+		if (bHasGaze)
+		{
+			Update(GazeFirst, HeadFirst, Measurement, DeltaTimeSeconds);
+		}
+		else
+		{
+			Init(GazeFirst, HeadFirst, Measurement);
+			bHasGaze = true;
+		}
+
+		Frame.Gaze.Screen01 = FVector2D(Position[GazeFirst], Position[GazeFirst + 1]);
+	}
+
+	if (bHeadValid)
+	{
+		if (bHasHead)
+		{
+			// Measure each angle relative to the estimate so a wrap past 180 reads as a small step
+			for (int32 Channel = RotationFirst; Channel < NumChannels; ++Channel)
+			{
+				Measurement[Channel] = Position[Channel] + FRotator::NormalizeAxis(Measurement[Channel] - Position[Channel]);
+			}
+			Update(HeadFirst, NumChannels, Measurement, DeltaTimeSeconds);
+			for (int32 Channel = RotationFirst; Channel < NumChannels; ++Channel)
+			{
+				Position[Channel] = FRotator::NormalizeAxis(Position[Channel]);
+			}
+		}
+		else
+		{
+			Init(HeadFirst, NumChannels, Measurement);
+			bHasHead = true;
+		}
+
+		Frame.Head.PositionCm = FVector(Position[HeadFirst], Position[HeadFirst + 1], Position[HeadFirst + 2]);
+		Frame.Head.SetRotation(FRotator(Position[RotationFirst], Position[RotationFirst + 1], Position[RotationFirst + 2]));
+	}
+
+	Frame.bHasVelocity = bHasGaze || bHasHead;
+	Frame.GazeVelocity01 = bHasGaze ? FVector2D(Velocity[GazeFirst], Velocity[GazeFirst + 1]) : FVector2D::ZeroVector;
+	Frame.HeadVelocityCm = bHasHead ? FVector(Velocity[HeadFirst], Velocity[HeadFirst + 1], Velocity[HeadFirst + 2]) : FVector::ZeroVector;
+	Frame.HeadAngularVelocityDeg = bHasHead ? FRotator(Velocity[RotationFirst], Velocity[RotationFirst + 1], Velocity[RotationFirst + 2]) : FRotator::ZeroRotator;
+}
+
+bool FBeamKalmanFilter::Predict(double HorizonSeconds, FBeamFrame& OutFrame) const
+{
+	if (!bHasGaze && !bHasHead)
+	{
+		return false;
+	}
+
+	double Predicted[NumChannels];
+	for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+	{
+		Predicted[Channel] = Position[Channel] + Velocity[Channel] * HorizonSeconds;
+	}
+
+	if (bHasGaze)
+	{
+		OutFrame.Gaze.Screen01 = FVector2D(FMath::Clamp(Predicted[0], 0.0, 1.0), FMath::Clamp(Predicted[1], 0.0, 1.0));
+	}
+	if (bHasHead)
+	{
+		OutFrame.Head.PositionCm = FVector(Predicted[2], Predicted[3], Predicted[4]);
+		OutFrame.Head.SetRotation(FRotator(Predicted[5], Predicted[6], Predicted[7]).GetNormalized());
+	}
+	return true;
+}
+
+void FBeamKalmanFilter::Reset()
+{
+	for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+	{
+		Position[Channel] = 0.0;
+		Velocity[Channel] = 0.0;
+		P00[Channel] = 0.0;
+		P01[Channel] = 0.0;
+		P11[Channel] = 0.0;
+	}
+	bHasGaze = false;
+	bHasHead = false;
+}
+
+void FBeamKalmanFilter::UpdateParams(const FBeamKalmanParams& NewParams)
+{
+	Params = NewParams;
+
+	// Non-positive measurement noise would divide by zero when the prior collapses
+	const double GroupQ[3] = { Params.GazeProcessNoise, Params.HeadPositionProcessNoise, Params.HeadRotationProcessNoise };
+	const double GroupR[3] = { Params.GazeMeasurementNoise, Params.HeadPositionMeasurementNoise, Params.HeadRotationMeasurementNoise };
+	for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+	{
+		const int32 Group = Channel < static_cast<int32>(EBeamKalmanChannel::HeadX) ? 0 : (Channel < static_cast<int32>(EBeamKalmanChannel::HeadPitch) ? 1 : 2);
+		ProcessNoise[Channel] = FMath::Max(GroupQ[Group], 0.0);
+		MeasurementNoise[Channel] = FMath::Max(GroupR[Group], UE_DOUBLE_SMALL_NUMBER);
+	}
+}
+
+void FBeamKalmanFilter::GetCovariance(EBeamKalmanChannel Channel, double& OutPositionVariance, double& OutCovariance, double& OutVelocityVariance) const
+{
+	const int32 Index = FMath::Clamp(static_cast<int32>(Channel), 0, NumChannels - 1);
+	OutPositionVariance = P00[Index];
+	OutCovariance = P01[Index];
+	OutVelocityVariance = P11[Index];
+}
+
+// FBeamGapFiller Implementation
+
+FBeamGapFiller::FBeamGapFiller(const FBeamGapFillParams& InParams)
+	: Params(InParams)
+{
+	Reset();
+}
+
+void FBeamGapFiller::Process(FBeamFrame& Frame)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	const double NowMs = Frame.SDKTimestampMs;
+
+	if (Frame.Gaze.bValid)
+	{
+		const double ElapsedSeconds = (NowMs - LastGazeMs) * 0.001;
+		if (Frame.bHasVelocity)
+		{
+			GazeVelocity = Frame.GazeVelocity01;
+		}
+		else if (bGazeContinuous && ElapsedSeconds > 0.0)
+		{
+			GazeVelocity = (Frame.Gaze.Screen01 - LastGaze.Screen01) / ElapsedSeconds;
+		}
+		else
+		{
+			GazeVelocity = FVector2D::ZeroVector;
+		}
+
+		LastGaze = Frame.Gaze;
+		LastGazeMs = NowMs;
+		bHasGaze = true;
+		bGazeContinuous = true;
+	}
+	else if (bHasGaze && NowMs - LastGazeMs <= Params.MaxGapMs)
+	{
+		const double MotionSeconds = FMath::Min(NowMs - LastGazeMs, static_cast<double>(Params.MaxExtrapolationMs)) * 0.001;
+		const FVector2D Screen01 = LastGaze.Screen01 + GazeVelocity * MotionSeconds;
+
+		FGazePoint Filled = LastGaze;
+		Filled.Screen01 = FVector2D(FMath::Clamp(Screen01.X, 0.0, 1.0), FMath::Clamp(Screen01.Y, 0.0, 1.0));
+
+		// Pixels follow the normalized move using the last sample's own pixels-per-unit scale
+		const FVector2D Moved = Filled.Screen01 - LastGaze.Screen01;
+		if (!FMath::IsNearlyZero(LastGaze.Screen01.X))
+		{
+			Filled.ScreenPx.X += Moved.X * (LastGaze.ScreenPx.X / LastGaze.Screen01.X);
+		}
+		if (!FMath::IsNearlyZero(LastGaze.Screen01.Y))
+		{
+			Filled.ScreenPx.Y += Moved.Y * (LastGaze.ScreenPx.Y / LastGaze.Screen01.Y);
+		}
+		Filled.TimestampMs = Frame.Gaze.TimestampMs;
+
+		Frame.Gaze = Filled;
+		Frame.bGazeSynthesized = true;
+		bGazeContinuous = false;
+	}
+	else
+	{
+		bGazeContinuous = false;
+	}
+
+	if (Frame.Head.Confidence > 0.0)
+	{
+		const double ElapsedSeconds = (NowMs - LastHeadMs) * 0.001;
+		if (Frame.bHasVelocity)
+		{
+			HeadVelocity = Frame.HeadVelocityCm;
+			HeadAngularVelocity = Frame.HeadAngularVelocityDeg;
+		}
+		else if (bHeadContinuous && ElapsedSeconds > 0.0)
+		{
+			HeadVelocity = (Frame.Head.PositionCm - LastHead.PositionCm) / ElapsedSeconds;
+			HeadAngularVelocity = (Frame.Head.Rotation - LastHead.Rotation).GetNormalized() * (1.0 / ElapsedSeconds);
+		}
+		else
+		{
+			HeadVelocity = FVector::ZeroVector;
+			HeadAngularVelocity = FRotator::ZeroRotator;
+		}
+
+		LastHead = Frame.Head;
+		LastHeadMs = NowMs;
+		bHasHead = true;
+		bHeadContinuous = true;
+	}
+	else if (bHasHead && NowMs - LastHeadMs <= Params.MaxGapMs)
+	{
+		const double MotionSeconds = FMath::Min(NowMs - LastHeadMs, static_cast<double>(Params.MaxExtrapolationMs)) * 0.001;
+		const double TimestampMs = Frame.Head.TimestampMs;
+
+		Frame.Head = LastHead;
+		Frame.Head.PositionCm += HeadVelocity * MotionSeconds;
+		Frame.Head.SetRotation((LastHead.Rotation + HeadAngularVelocity * MotionSeconds).GetNormalized());
+		Frame.Head.TimestampMs = TimestampMs > 0.0 ? TimestampMs : LastHead.TimestampMs + (NowMs - LastHeadMs);
+		Frame.bHeadSynthesized = true;
+		bHeadContinuous = false;
+	}
+	else
+	{
+		bHeadContinuous = false;
+	}
+}
+
+void FBeamGapFiller::Reset()
+{
+	LastGaze = FGazePoint();
+	GazeVelocity = FVector2D::ZeroVector;
+	LastGazeMs = 0.0;
+	bHasGaze = false;
+	bGazeContinuous = false;
+
+	LastHead = FHeadPose();
+	HeadVelocity = FVector::ZeroVector;
+	HeadAngularVelocity = FRotator::ZeroRotator;
+	LastHeadMs = 0.0;
+	bHasHead = false;
+	bHeadContinuous = false;
+}
+
+// FBeamFilters Implementation
+
+FBeamFilters::FBeamFilters()
+{
+	InitializeFilters();
+}
+
+void FBeamFilters::SetFilterType(EBeamFilterType InFilterType)
+{
+	if (CurrentFilterType == InFilterType)
+	{
+		return;
+	}
+
+	CurrentFilterType = InFilterType;
+	Reset();
+}
+
+void FBeamFilters::ApplyFilters(FBeamFrame& Frame, double DeltaTimeSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamApplyFilters);
+	// Derived fields belong to this pass; producers reuse one frame, so stale values must not survive
+	Frame.bHasVelocity = false;
+	Frame.bGazeSynthesized = false;
+	Frame.bHeadSynthesized = false;
+
+	// Smoothing only sees measured channels, so the filters stay warm across gaps filled below
+	if (DeltaTimeSeconds > 0.0)
+	{
+		ApplySmoothing(Frame, DeltaTimeSeconds);
+	}
+
+	if (GapFiller)
+	{
+		GapFiller->Process(Frame);
+	}
+}
+
+void FBeamFilters::ApplySmoothing(FBeamFrame& Frame, double DeltaTimeSeconds)
+{
+	switch (CurrentFilterType)
+	{
+	case EBeamFilterType::OneEuro:
+		if (FilterBank)
+		{
+			FilterBank->Filter(Frame, DeltaTimeSeconds);
+		}
+		break;
+
+	case EBeamFilterType::Kalman:
+		if (KalmanFilter)
+		{
+			KalmanFilter->Filter(Frame, DeltaTimeSeconds);
+		}
+		break;
+
+	case EBeamFilterType::EMA:
+		if (EmaFilter)
+		{
+			if (Frame.Gaze.bValid)
+			{
+				Frame.Gaze.Screen01 = EmaFilter->Filter(Frame.Gaze.Screen01);
+			}
+			if (Frame.Head.Confidence > 0.0)
+			{
+				Frame.Head.PositionCm = EmaFilter->Filter(Frame.Head.PositionCm);
+				Frame.Head.SetRotation(EmaFilter->Filter(Frame.Head.RotationQuat));
+			}
+		}
+		break;
+
+	case EBeamFilterType::None:
+	default:
+		break;
+	}
+}
+
+void FBeamFilters::Reset()
+{
+	if (FilterBank)
+	{
+		FilterBank->Reset();
+	}
+	if (EmaFilter)
+	{
+		EmaFilter->Reset();
+	}
+	if (KalmanFilter)
+	{
+		KalmanFilter->Reset();
+	}
+	if (GapFiller)
+	{
+		GapFiller->Reset();
+	}
+}
+
+void FBeamFilters::UpdateOneEuroParams(const FOneEuroFilterParams& Params)
+{
+	if (FilterBank)
+	{
+		FBeamFilterBankParams BankParams = FilterBank->GetParams();
+		BankParams.Gaze = Params;
+		FilterBank->UpdateParams(BankParams);
+	}
+}
+
+void FBeamFilters::UpdateEmaParams(const FEmaFilterParams& Params)
+{
+	if (EmaFilter)
+	{
+		EmaFilter->UpdateParams(Params);
+	}
+}
+
+void FBeamFilters::UpdateFilterBankParams(const FBeamFilterBankParams& Params)
+{
+	if (FilterBank)
+	{
+		FilterBank->UpdateParams(Params);
+	}
+}
+
+void FBeamFilters::UpdateKalmanParams(const FBeamKalmanParams& Params)
+{
+	if (KalmanFilter)
+	{
+		KalmanFilter->UpdateParams(Params);
+	}
+}
+
+void FBeamFilters::UpdateGapFillParams(const FBeamGapFillParams& Params)
+{
+	if (GapFiller)
+	{
+		GapFiller->UpdateParams(Params);
+	}
+}
+
+void FBeamFilters::InitializeFilters()
+{
+	// Every instance is kept so switching type at runtime never allocates
+	FilterBank = MakeUnique<FBeamFilterBank>();
+	EmaFilter = MakeUnique<FEmaFilter>();
+	KalmanFilter = MakeUnique<FBeamKalmanFilter>();
+	GapFiller = MakeUnique<FBeamGapFiller>();
+}
@@ -0,0 +1,412 @@
+// Implements the always-on flight recorder and its hitch, stall and crash dumps
+
+#include "BeamFlightRecorder.h"
+#include "BeamRecording.h"
+#include "BeamLogging.h"
+#include "BeamResources.h"
+#include "BeamEyeTrackerSettings.h"
+#include "BeamStats.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+
+FBeamFlightRecorder GBeamFlightRecorder;
+
+DEFINE_STAT(STAT_BeamFlightRecorderMemory);
+
+static TAutoConsoleVariable<bool> CVarBeamFlightRecorderEnable(
+	TEXT("beam.FlightRecorder.Enable"),
+	true,
+	TEXT("Keep the last seconds of frames and latency samples for hitch, stall and crash dumps (read at startup)"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarBeamFlightRecorderSeconds(
+	TEXT("beam.FlightRecorder.Seconds"),
+	10.0f,
+	TEXT("Seconds of frames the flight recorder keeps at the highest polling rate (1-120, read at startup); only used by the Custom memory profile, the others size the window from their budget"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarBeamFlightRecorderHitchMs(
+	TEXT("beam.FlightRecorder.HitchMs"),
+	250.0f,
+	TEXT("Game frame time in ms that counts as a hitch and triggers a dump while tracking; 0 disables hitch dumps"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarBeamFlightRecorderCooldownSeconds(
+	TEXT("beam.FlightRecorder.CooldownSeconds"),
+	30.0f,
+	TEXT("Minimum seconds between two hitch or stall dumps"),
+	ECVF_Default
+);
+
+namespace BeamFlightRecorder
+{
+	// Matches the beam.PollHz ceiling, so the window holds at least the configured seconds at any rate
+	static constexpr int32 MaxFrameRateHz = 240;
+
+	// Every frame can carry one sample per stage
+	static constexpr int32 LatencySamplesPerFrame = static_cast<int32>(EBeamLatencyStage::Num);
+
+	// Slot storage per frame of window: the frame and its latency samples, each with its sequence
+	static constexpr int64 BytesPerFrame = (sizeof(FBeamFrameCompact) + sizeof(uint64))
+		+ LatencySamplesPerFrame * (sizeof(FBeamFlightLatencySample) + sizeof(uint64));
+
+	static FBeamRecording::FFrameRecord ToRecord(const FBeamFrameCompact& Compact)
+	{
+		FBeamRecording::FFrameRecord Record;
+		Record.Timestamp = static_cast<uint64>(Compact.SDKTimestampMs);
+		Record.GazeScreen01 = FVector2D(Compact.GetGazeX01(), Compact.GetGazeY01());
+		Record.GazeConfidence = Compact.GazeConfidence / 255.0f;
+		Record.HeadPosition = FVector(Compact.HeadPositionCm[0], Compact.HeadPositionCm[1], Compact.HeadPositionCm[2]) / FBeamFrameCompact::PositionScale;
+		Record.HeadRotation = FRotator(
+			Compact.HeadRotation[0] / FBeamFrameCompact::RotationScale,
+			Compact.HeadRotation[1] / FBeamFrameCompact::RotationScale,
+			Compact.HeadRotation[2] / FBeamFrameCompact::RotationScale);
+		Record.HeadConfidence = Compact.HeadConfidence / 255.0f;
+		return Record;
+	}
+}
+
+// TSlotRing Implementation
+
+template <typename ElementType>
+void FBeamFlightRecorder::TSlotRing<ElementType>::Allocate(uint32 InCapacity)
+{
+	Slots = MakeUnique<FSlot[]>(InCapacity);
+	Capacity = InCapacity;
+	Head.store(0, std::memory_order_relaxed);
+}
+
+template <typename ElementType>
+void FBeamFlightRecorder::TSlotRing<ElementType>::Free()
+{
+	Slots.Reset();
+	Capacity = 0;
+}
+
+template <typename ElementType>
+void FBeamFlightRecorder::TSlotRing<ElementType>::Write(const ElementType& Value)
+{
+	const uint64 Index = Head.fetch_add(1, std::memory_order_relaxed);
+	FSlot& Slot = Slots[Index % Capacity];
+
+	// Sequence 0 marks the slot as being written until the value is complete
+	Slot.Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	Slot.Value = Value;
+	Slot.Sequence.store(Index + 1, std::memory_order_release);
+}
+
+template <typename ElementType>
+void FBeamFlightRecorder::TSlotRing<ElementType>::Copy(TArray<ElementType>& Out) const
+{
+	const uint64 End = Head.load(std::memory_order_acquire);
+	const uint64 Begin = End > Capacity ? End - Capacity : 0;
+	Out.Reset(static_cast<int32>(End - Begin));
+
+	for (uint64 Index = Begin; Index < End; ++Index)
+	{
+		const FSlot& Slot = Slots[Index % Capacity];
+		if (Slot.Sequence.load(std::memory_order_acquire) != Index + 1)
+		{
+			continue;
+		}
+		const ElementType Value = Slot.Value;
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		// Overwritten or restarted while copying; the slot belongs to a newer write now
+		if (Slot.Sequence.load(std::memory_order_relaxed) == Index + 1)
+		{
+			Out.Add(Value);
+		}
+	}
+}
+
+// FBeamFlightRecorder Implementation
+
+FBeamFlightRecorder::FBeamFlightRecorder() = default;
+
+FBeamFlightRecorder::~FBeamFlightRecorder()
+{
+	Stop();
+}
+
+void FBeamFlightRecorder::Start()
+{
+	if (IsActive() || !CVarBeamFlightRecorderEnable.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(BeamEyeTracker);
+	const FBeamMemoryBudget Budget = GetDefault<UBeamEyeTrackerSettings>()->GetMemoryBudget();
+	const float WindowSeconds = FMath::Clamp(Budget.FlightRecorderSeconds > 0.0f ? Budget.FlightRecorderSeconds : CVarBeamFlightRecorderSeconds.GetValueOnGameThread(), 1.0f, 120.0f);
+	const uint32 FrameCapacity = static_cast<uint32>(FMath::CeilToInt(WindowSeconds * BeamFlightRecorder::MaxFrameRateHz));
+	Frames.Allocate(FrameCapacity);
+	LatencySamples.Allocate(FrameCapacity * BeamFlightRecorder::LatencySamplesPerFrame);
+
+	RingBytes = FrameCapacity * BeamFlightRecorder::BytesPerFrame;
+	GBeamResources.TrackBufferBytes(RingBytes);
+	INC_MEMORY_STAT_BY(STAT_BeamFlightRecorderMemory, RingBytes);
+
+	DumpDirectory = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BeamFlightRecorder")));
+	LastEndFrameSeconds = 0.0;
+	LastDumpSeconds = -DBL_MAX;
+	LastFrameSeconds.store(0.0, std::memory_order_relaxed);
+	bCrashDumped.store(false, std::memory_order_relaxed);
+
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FBeamFlightRecorder::OnEndFrame);
+	SystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddRaw(this, &FBeamFlightRecorder::OnSystemError);
+	bActive.store(true, std::memory_order_release);
+
+	UE_LOG(LogBeam, Log, TEXT("Flight recorder keeping %.0f s (%u frames, %.1f KB)"), WindowSeconds, FrameCapacity, RingBytes / 1024.0);
+}
+
+void FBeamFlightRecorder::Stop()
+{
+	if (!IsActive())
+	{
+		return;
+	}
+
+	bActive.store(false, std::memory_order_seq_cst);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	FCoreDelegates::OnHandleSystemError.Remove(SystemErrorHandle);
+	EndFrameHandle.Reset();
+	SystemErrorHandle.Reset();
+
+	// The pool task reads the rings, so they outlive it
+	if (DumpTask.IsValid())
+	{
+		DumpTask.Wait();
+		DumpTask.Reset();
+	}
+
+	// Producer threads that entered a record call before bActive dropped are still writing
+	while (ActiveWriters.load(std::memory_order_acquire) != 0)
+	{
+		FPlatformProcess::YieldThread();
+	}
+
+	Frames.Free();
+	LatencySamples.Free();
+	GBeamResources.TrackBufferBytes(-RingBytes);
+	DEC_MEMORY_STAT_BY(STAT_BeamFlightRecorderMemory, RingBytes);
+	RingBytes = 0;
+}
+
+bool FBeamFlightRecorder::BeginWrite()
+{
+	// Both sides are sequentially consistent: either Stop sees this writer or the writer sees bActive cleared
+	ActiveWriters.fetch_add(1, std::memory_order_seq_cst);
+	if (!bActive.load(std::memory_order_seq_cst))
+	{
+		EndWrite();
+		return false;
+	}
+	return true;
+}
+
+void FBeamFlightRecorder::RecordFrame(const FBeamFrame& Frame)
+{
+	if (!IsActive() || !BeginWrite())
+	{
+		return;
+	}
+
+	Frames.Write(FBeamFrameCompact::FromFrame(Frame));
+	LastFrameSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+	EndWrite();
+}
+
+void FBeamFlightRecorder::RecordLatency(EBeamLatencyStage Stage, double Seconds)
+{
+	if (!IsActive() || !BeginWrite())
+	{
+		return;
+	}
+
+	FBeamFlightLatencySample Sample;
+	Sample.RecordedSeconds = FPlatformTime::Seconds();
+	Sample.LatencyMs = static_cast<float>(Seconds * 1000.0);
+	Sample.Stage = static_cast<uint8>(Stage);
+	LatencySamples.Write(Sample);
+	EndWrite();
+}
+
+bool FBeamFlightRecorder::RequestDump(EBeamFlightDumpReason Reason)
+{
+	check(IsInGameThread());
+	if (!IsActive() || Frames.GetWriteCount() == 0)
+	{
+		return false;
+	}
+
+	if (DumpTask.IsValid())
+	{
+		if (!DumpTask.IsReady())
+		{
+			return false;
+		}
+		DumpTask.Reset();
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (Reason != EBeamFlightDumpReason::Manual && NowSeconds - LastDumpSeconds < CVarBeamFlightRecorderCooldownSeconds.GetValueOnGameThread())
+	{
+		return false;
+	}
+	LastDumpSeconds = NowSeconds;
+
+	// The snapshot is taken on the worker too; the rings tolerate it, and the trigger stays a task launch
+	const FString FilePath = MakeDumpPath(Reason);
+	const TCHAR* ReasonName = GetReasonName(Reason);
+	DumpTask = Async(EAsyncExecution::ThreadPool, [this, FilePath, ReasonName]()
+	{
+		if (WriteDump(FilePath))
+		{
+			UE_LOG(LogBeam, Log, TEXT("Flight recorder: %s dump written to %s"), ReasonName, *FilePath);
+		}
+	});
+	return true;
+}
+
+FString FBeamFlightRecorder::DumpNow(EBeamFlightDumpReason Reason)
+{
+	if (!IsActive() || Frames.GetWriteCount() == 0)
+	{
+		return FString();
+	}
+
+	const FString FilePath = MakeDumpPath(Reason);
+	return WriteDump(FilePath) ? FilePath : FString();
+}
+
+int64 FBeamFlightRecorder::GetBytesPerSecond()
+{
+	return BeamFlightRecorder::BytesPerFrame * BeamFlightRecorder::MaxFrameRateHz;
+}
+
+const TCHAR* FBeamFlightRecorder::GetReasonName(EBeamFlightDumpReason Reason)
+{
+	switch (Reason)
+	{
+	case EBeamFlightDumpReason::Manual: return TEXT("Manual");
+	case EBeamFlightDumpReason::Hitch:  return TEXT("Hitch");
+	case EBeamFlightDumpReason::Stall:  return TEXT("Stall");
+	case EBeamFlightDumpReason::Crash:  return TEXT("Crash");
+	default:                            return TEXT("Unknown");
+	}
+}
+
+void FBeamFlightRecorder::OnEndFrame()
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	const double FrameSeconds = LastEndFrameSeconds > 0.0 ? NowSeconds - LastEndFrameSeconds : 0.0;
+	LastEndFrameSeconds = NowSeconds;
+
+	// Editor and loading hitches without live tracking have nothing worth keeping
+	const float HitchMs = CVarBeamFlightRecorderHitchMs.GetValueOnGameThread();
+	if (HitchMs > 0.0f && FrameSeconds * 1000.0 > HitchMs && HasRecentFrames(NowSeconds - FrameSeconds))
+	{
+		RequestDump(EBeamFlightDumpReason::Hitch);
+	}
+}
+
+void FBeamFlightRecorder::OnSystemError()
+{
+	if (bCrashDumped.exchange(true, std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	const FString FilePath = DumpNow(EBeamFlightDumpReason::Crash);
+	if (!FilePath.IsEmpty())
+	{
+		UE_LOG(LogBeam, Error, TEXT("Flight recorder: crash dump written to %s"), *FilePath);
+	}
+}
+
+bool FBeamFlightRecorder::HasRecentFrames(double NowSeconds) const
+{
+	const double LastSeconds = LastFrameSeconds.load(std::memory_order_relaxed);
+	return LastSeconds > 0.0 && NowSeconds - LastSeconds < 1.0;
+}
+
+FString FBeamFlightRecorder::MakeDumpPath(EBeamFlightDumpReason Reason) const
+{
+	return FPaths::Combine(DumpDirectory, FString::Printf(TEXT("Beam_%s_%s.beamrec"), GetReasonName(Reason), *FDateTime::Now().ToString()));
+}
+
+bool FBeamFlightRecorder::WriteDump(const FString& FilePath) const
+{
+	TArray<FBeamFrameCompact> FrameSnapshot;
+	TArray<FBeamFlightLatencySample> LatencySnapshot;
+	Frames.Copy(FrameSnapshot);
+	LatencySamples.Copy(LatencySnapshot);
+	if (FrameSnapshot.Num() == 0)
+	{
+		return false;
+	}
+
+	TArray<FBeamRecording::FFrameRecord> Records;
+	Records.Reserve(FrameSnapshot.Num());
+	for (const FBeamFrameCompact& Compact : FrameSnapshot)
+	{
+		Records.Add(BeamFlightRecorder::ToRecord(Compact));
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*DumpDirectory);
+	TUniquePtr<IFileHandle> File(PlatformFile.OpenWrite(*FilePath));
+	if (!File)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("Flight recorder: cannot create %s"), *FilePath);
+		return false;
+	}
+
+	// A v2 recording of one chunk without an index, so every .beamrec reader plays it back
+	FBeamRecording::FRecordingHeader Header;
+	Header.Version = 2;
+	Header.FrameCount = Records.Num();
+	Header.StartTimestamp = static_cast<uint64>(FrameSnapshot[0].SDKTimestampMs);
+	Header.EndTimestamp = static_cast<uint64>(FrameSnapshot.Last().SDKTimestampMs);
+	Header.Reserved[0] = Records.Num();
+	Header.Reserved[1] = 1;
+
+	FBeamRecording::FChunkHeader Chunk;
+	Chunk.FrameCount = Records.Num();
+	Chunk.FirstTimestampMs = FrameSnapshot[0].SDKTimestampMs;
+	Chunk.LastTimestampMs = FrameSnapshot.Last().SDKTimestampMs;
+
+	FBeamFlightLatencyHeader Latency;
+	Latency.SampleCount = LatencySnapshot.Num();
+
+	return File->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header))
+		&& File->Write(reinterpret_cast<const uint8*>(&Chunk), sizeof(Chunk))
+		&& File->Write(reinterpret_cast<const uint8*>(Records.GetData()), Records.Num() * sizeof(FBeamRecording::FFrameRecord))
+		&& File->Write(reinterpret_cast<const uint8*>(&Latency), sizeof(Latency))
+		&& File->Write(reinterpret_cast<const uint8*>(LatencySnapshot.GetData()), LatencySnapshot.Num() * sizeof(FBeamFlightLatencySample));
+}
+
+// Console Commands
+
+static FAutoConsoleCommand BeamFlightRecorderDumpCommand(
+	TEXT("Beam.FlightRecorder.Dump"),
+	TEXT("Write the flight recorder's frames and latency samples to Saved/BeamFlightRecorder now"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (!GBeamFlightRecorder.RequestDump(EBeamFlightDumpReason::Manual))
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Flight recorder: nothing recorded yet, or a dump is still being written"));
+		}
+	})
+);
@@ -0,0 +1,351 @@
+// Implements the per-frame focus and dwell dispatcher
+
+#include "BeamFocusSubsystem.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamGazeTargetSubsystem.h"
+#include "BeamRing.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+
+void UBeamFocusSubsystem::Deinitialize()
+{
+	// Awaiting code must not hang on a world that is going away
+	while (Queries.Num() > 0)
+	{
+		ResolveQuery(Queries.Num() - 1, EBeamGazeQueryResult::Cancelled);
+	}
+
+	DwellTargets.Reset();
+	FocusedTarget.Reset();
+	OnNewFrame.Clear();
+
+	Super::Deinitialize();
+}
+
+TStatId UBeamFocusSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBeamFocusSubsystem, STATGROUP_Tickables);
+}
+
+void UBeamFocusSubsystem::RegisterDwellTarget(AActor* Target, float DwellSeconds)
+{
+	if (!Target)
+	{
+		return;
+	}
+
+	DwellTargets.FindOrAdd(Target).DwellSeconds = FMath::Max(DwellSeconds, 0.0f);
+	if (UBeamGazeTargetSubsystem* Targets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>())
+	{
+		Targets->RegisterGazeTarget(Target);
+	}
+}
+
+void UBeamFocusSubsystem::UnregisterDwellTarget(AActor* Target)
+{
+	if (!Target || !DwellTargets.Contains(Target))
+	{
+		return;
+	}
+
+	// Exit first, while the target's own delegate is still registered to hear it
+	if (FocusedTarget.Get() == Target)
+	{
+		Fire(EBeamFocusEvent::Exit, Target);
+		FocusedTarget.Reset();
+	}
+	DwellTargets.Remove(Target);
+	if (UBeamGazeTargetSubsystem* Targets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>())
+	{
+		Targets->UnregisterGazeTarget(Target);
+	}
+}
+
+float UBeamFocusSubsystem::GetFocusDuration() const
+{
+	return FocusedTarget.IsValid() ? static_cast<float>(LastFrameSeconds - FocusStartSeconds) : 0.0f;
+}
+
+FOnBeamFocusEventNative* UBeamFocusSubsystem::GetTargetEvents(const AActor* Target)
+{
+	FDwellTarget* Entry = DwellTargets.Find(Target);
+	return Entry ? &Entry->Events : nullptr;
+}
+
+void UBeamFocusSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	UBeamEyeTrackerSubsystem* Beam = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	if (Queries.Num() > 0)
+	{
+		UpdateQueries(Beam);
+	}
+
+	const FBeamFrameRing* Ring = Beam ? Beam->GetFrameRing() : nullptr;
+	if (!Ring || (DwellTargets.Num() == 0 && Queries.Num() == 0 && !OnNewFrame.IsBound()))
+	{
+		return;
+	}
+
+	FBeamFrame Latest;
+	if (!Ring->ReadLatest(Latest))
+	{
+		return;
+	}
+
+	// Nothing new in the ring means the gaze has not moved; skip all evaluation
+	if (bHasTimestamp && Latest.SDKTimestampMs == LastTimestampMs)
+	{
+		return;
+	}
+
+	// On the first tick, or after the ring restarted with a new origin, only the newest frame is evaluated
+	const bool bRestart = !bHasTimestamp || Latest.SDKTimestampMs < LastTimestampMs;
+	Scratch.Reset();
+	if (bRestart)
+	{
+		Scratch.Add(Latest);
+	}
+	else
+	{
+		Ring->CopyFramesInRange(LastTimestampMs, TNumericLimits<double>::Max(), Scratch);
+	}
+
+	UBeamGazeTargetSubsystem* Targets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>();
+	for (const FBeamFrame& Frame : Scratch)
+	{
+		if (!bRestart && Frame.SDKTimestampMs <= LastTimestampMs)
+		{
+			continue;
+		}
+
+		OnNewFrame.Broadcast(Frame);
+		if (DwellTargets.Num() > 0 && Targets)
+		{
+			EvaluateFrame(Frame, Targets);
+		}
+		if (Queries.Num() > 0)
+		{
+			EvaluateQueries(Frame, Targets);
+		}
+	}
+
+	LastTimestampMs = Latest.SDKTimestampMs;
+	bHasTimestamp = true;
+}
+
+void UBeamFocusSubsystem::EvaluateFrame(const FBeamFrame& Frame, UBeamGazeTargetSubsystem* Targets)
+{
+	const double NowSeconds = Frame.UETimestampSeconds;
+	LastFrameSeconds = NowSeconds;
+
+	AActor* Hit = nullptr;
+	const bool bGazeUsable = Frame.Gaze.bValid && Frame.Gaze.Confidence >= MinConfidence;
+	FVector2f GazePx;
+	if (bGazeUsable && Targets->Screen01ToViewportPx(Frame.Gaze.Screen01, GazePx))
+	{
+		Hit = Targets->GetClosestTargetToPoint(GazePx, FocusMarginPixels);
+		if (Hit && !DwellTargets.Contains(Hit))
+		{
+			Hit = nullptr;
+		}
+	}
+
+	if (!bGazeUsable && FocusedTarget.IsValid() && NowSeconds - LastFocusedSeconds < FocusLossGraceSeconds)
+	{
+		return;
+	}
+
+	if (Hit != FocusedTarget.Get())
+	{
+		SetFocus(Hit, NowSeconds);
+	}
+
+	AActor* Focused = FocusedTarget.Get();
+	if (!Focused)
+	{
+		return;
+	}
+
+	LastFocusedSeconds = NowSeconds;
+	if (!bDwellFired)
+	{
+		const FDwellTarget* Entry = DwellTargets.Find(Focused);
+		if (Entry && NowSeconds - FocusStartSeconds >= Entry->DwellSeconds)
+		{
+			bDwellFired = true;
+			Fire(EBeamFocusEvent::Dwell, Focused);
+		}
+	}
+}
+
+void UBeamFocusSubsystem::SetFocus(AActor* NewTarget, double NowSeconds)
+{
+	if (AActor* Previous = FocusedTarget.Get())
+	{
+		Fire(EBeamFocusEvent::Exit, Previous);
+	}
+
+	FocusedTarget = NewTarget;
+	FocusStartSeconds = NowSeconds;
+	LastFocusedSeconds = NowSeconds;
+	bDwellFired = false;
+
+	if (NewTarget)
+	{
+		Fire(EBeamFocusEvent::Enter, NewTarget);
+	}
+}
+
+void UBeamFocusSubsystem::Fire(EBeamFocusEvent Event, AActor* Target)
+{
+	// Broadcast from a copy: a listener registering or removing targets may reallocate the map mid-broadcast
+	if (const FDwellTarget* Entry = DwellTargets.Find(Target))
+	{
+		const FOnBeamFocusEventNative Events = Entry->Events;
+		Events.Broadcast(Event, Target);
+	}
+	OnFocusEvent.Broadcast(Event, Target);
+}
+
+FBeamGazeQuery UBeamFocusSubsystem::WaitForFixationOn(AActor* Target, float MinMs, float TimeoutSeconds)
+{
+	FPendingQuery Query;
+	Query.Kind = EQueryKind::Fixation;
+	Query.Target = Target;
+	Query.MinSeconds = FMath::Max(MinMs, 0.0f) * 0.001;
+
+	// Projection comes from the gaze target grid, so the target must be on it while the query waits
+	UBeamGazeTargetSubsystem* Targets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>();
+	if (Target && Targets && !Targets->IsGazeTargetRegistered(Target))
+	{
+		Targets->RegisterGazeTarget(Target);
+		Query.bRegisteredGazeTarget = true;
+	}
+	return AddQuery(MoveTemp(Query), TimeoutSeconds);
+}
+
+FBeamGazeQuery UBeamFocusSubsystem::WaitForGazeEnter(const FBox2D& Screen01Region, float TimeoutSeconds)
+{
+	FPendingQuery Query;
+	Query.Kind = EQueryKind::RegionEnter;
+	Query.Region = Screen01Region;
+	return AddQuery(MoveTemp(Query), TimeoutSeconds);
+}
+
+FBeamGazeQuery UBeamFocusSubsystem::WaitForTrackingHealthy(float TimeoutSeconds)
+{
+	FPendingQuery Query;
+	Query.Kind = EQueryKind::TrackingHealthy;
+	return AddQuery(MoveTemp(Query), TimeoutSeconds);
+}
+
+FBeamGazeQuery UBeamFocusSubsystem::AddQuery(FPendingQuery&& Query, float TimeoutSeconds)
+{
+	check(IsInGameThread());
+
+	FBeamGazeQuery Handle;
+	Handle.State = MakeShared<FBeamGazeQueryState, ESPMode::ThreadSafe>();
+
+	// Inline: the result task runs on the thread that resolves the query, so completion costs no scheduling
+	Handle.Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [State = Handle.State]() { return State->Result; },
+		UE::Tasks::Prerequisites(Handle.State->Resolved), UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::Inline);
+
+	Query.State = Handle.State;
+	Query.DeadlineSeconds = TimeoutSeconds > 0.0f ? FPlatformTime::Seconds() + TimeoutSeconds : 0.0;
+	Queries.Add(MoveTemp(Query));
+	return Handle;
+}
+
+void UBeamFocusSubsystem::ResolveQuery(int32 Index, EBeamGazeQueryResult Result)
+{
+	FPendingQuery Query = MoveTemp(Queries[Index]);
+	Queries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	// A grid registration is handed to another query on the same target rather than dropped under it
+	AActor* Target = Query.Target.Get();
+	if (Query.bRegisteredGazeTarget && Target)
+	{
+		FPendingQuery* Heir = Queries.FindByPredicate([Target](const FPendingQuery& Other) { return Other.Target.Get() == Target; });
+		if (Heir)
+		{
+			Heir->bRegisteredGazeTarget = true;
+		}
+		else if (UBeamGazeTargetSubsystem* Targets = GetWorld() ? GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>() : nullptr)
+		{
+			Targets->UnregisterGazeTarget(Target);
+		}
+	}
+
+	// Continuations may run inline from Trigger and queue new queries, so the array is not touched after this
+	Query.State->Result = Result;
+	Query.State->Resolved.Trigger();
+}
+
+void UBeamFocusSubsystem::UpdateQueries(const UBeamEyeTrackerSubsystem* Beam)
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	const bool bHealthy = Beam && Beam->GetHealth() == EBeamHealth::Ok;
+
+	for (int32 Index = Queries.Num() - 1; Index >= 0; --Index)
+	{
+		const FPendingQuery& Query = Queries[Index];
+		if (Query.State->bCancelRequested.load(std::memory_order_relaxed)
+			|| (Query.Kind == EQueryKind::Fixation && !Query.Target.IsValid()))
+		{
+			ResolveQuery(Index, EBeamGazeQueryResult::Cancelled);
+		}
+		else if (Query.Kind == EQueryKind::TrackingHealthy && bHealthy)
+		{
+			ResolveQuery(Index, EBeamGazeQueryResult::Satisfied);
+		}
+		else if (Query.DeadlineSeconds > 0.0 && NowSeconds >= Query.DeadlineSeconds)
+		{
+			ResolveQuery(Index, EBeamGazeQueryResult::TimedOut);
+		}
+	}
+}
+
+void UBeamFocusSubsystem::EvaluateQueries(const FBeamFrame& Frame, UBeamGazeTargetSubsystem* Targets)
+{
+	const double NowSeconds = Frame.UETimestampSeconds;
+	const bool bGazeUsable = Frame.Gaze.bValid && Frame.Gaze.Confidence >= MinConfidence;
+	FVector2f GazePx;
+	const bool bHasGazePx = bGazeUsable && Targets && Targets->Screen01ToViewportPx(Frame.Gaze.Screen01, GazePx);
+
+	for (int32 Index = Queries.Num() - 1; Index >= 0; --Index)
+	{
+		FPendingQuery& Query = Queries[Index];
+		if (Query.Kind == EQueryKind::RegionEnter)
+		{
+			if (bGazeUsable && Query.Region.IsInsideOrOn(Frame.Gaze.Screen01))
+			{
+				ResolveQuery(Index, EBeamGazeQueryResult::Satisfied);
+			}
+		}
+		else if (Query.Kind == EQueryKind::Fixation)
+		{
+			if (bHasGazePx && Targets->IsPointOnTarget(Query.Target.Get(), GazePx, FocusMarginPixels))
+			{
+				if (Query.OnSinceSeconds < 0.0)
+				{
+					Query.OnSinceSeconds = NowSeconds;
+				}
+				Query.LastOnSeconds = NowSeconds;
+				if (NowSeconds - Query.OnSinceSeconds >= Query.MinSeconds)
+				{
+					ResolveQuery(Index, EBeamGazeQueryResult::Satisfied);
+				}
+			}
+			else if (bGazeUsable || NowSeconds - Query.LastOnSeconds >= FocusLossGraceSeconds)
+			{
+				// Looking elsewhere restarts the fixation; a blink within the grace period does not
+				Query.OnSinceSeconds = -1.0;
+			}
+		}
+	}
+}
@@ -0,0 +1,108 @@
+// Implements quantization between FBeamFrame and FBeamFrameCompact
+
+#include "BeamFrameCompact.h"
+
+namespace BeamFrameCompact
+{
+	// Branch-free clamp-and-round so the batch loops stay straight-line code the compiler can vectorize
+	static FORCEINLINE uint16 QuantizeGaze(double Value01)
+	{
+		const double Steps = (Value01 - FBeamFrameCompact::GazeMin) * (65535.0 / FBeamFrameCompact::GazeRange);
+		return static_cast<uint16>(FMath::RoundToInt(FMath::Clamp(Steps, 0.0, 65535.0)));
+	}
+
+	static FORCEINLINE int16 QuantizeSigned(double Value, double Scale)
+	{
+		return static_cast<int16>(FMath::RoundToInt(FMath::Clamp(Value * Scale, -32767.0, 32767.0)));
+	}
+
+	static FORCEINLINE uint8 QuantizeUnit(double Value)
+	{
+		return static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Value * 255.0, 0.0, 255.0)));
+	}
+
+	void PackFrames(TArrayView<const FBeamFrame> In, TArrayView<FBeamFrameCompact> Out)
+	{
+		check(Out.Num() >= In.Num());
+		const int32 Num = In.Num();
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Out[Index] = FBeamFrameCompact::FromFrame(In[Index]);
+		}
+	}
+
+	void UnpackFrames(TArrayView<const FBeamFrameCompact> In, TArrayView<FBeamFrame> Out, FIntPoint ViewportSize)
+	{
+		check(Out.Num() >= In.Num());
+		const int32 Num = In.Num();
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			In[Index].ToFrame(Out[Index], ViewportSize);
+		}
+	}
+}
+
+FBeamFrameCompact FBeamFrameCompact::FromFrame(const FBeamFrame& Frame)
+{
+	using namespace BeamFrameCompact;
+
+	FBeamFrameCompact Compact;
+	Compact.SDKTimestampMs = Frame.SDKTimestampMs;
+	Compact.UETimestampSeconds = Frame.UETimestampSeconds;
+	Compact.FrameId = static_cast<uint32>(Frame.FrameId);
+
+	Compact.GazeX = QuantizeGaze(Frame.Gaze.Screen01.X);
+	Compact.GazeY = QuantizeGaze(Frame.Gaze.Screen01.Y);
+	Compact.GazeConfidence = QuantizeUnit(Frame.Gaze.Confidence);
+	Compact.HeadConfidence = QuantizeUnit(Frame.Head.Confidence);
+
+	// Normalized so every angle fits the signed range at hundredths of a degree
+	const FRotator Rotation = Frame.Head.Rotation.GetNormalized();
+	Compact.HeadPositionCm[0] = QuantizeSigned(Frame.Head.PositionCm.X, PositionScale);
+	Compact.HeadPositionCm[1] = QuantizeSigned(Frame.Head.PositionCm.Y, PositionScale);
+	Compact.HeadPositionCm[2] = QuantizeSigned(Frame.Head.PositionCm.Z, PositionScale);
+	Compact.HeadRotation[0] = QuantizeSigned(Rotation.Pitch, RotationScale);
+	Compact.HeadRotation[1] = QuantizeSigned(Rotation.Yaw, RotationScale);
+	Compact.HeadRotation[2] = QuantizeSigned(Rotation.Roll, RotationScale);
+
+	Compact.GazeVelocity01[0] = QuantizeSigned(Frame.GazeVelocity01.X, VelocityScale);
+	Compact.GazeVelocity01[1] = QuantizeSigned(Frame.GazeVelocity01.Y, VelocityScale);
+	Compact.DeltaTimeSeconds = static_cast<float>(Frame.DeltaTimeSeconds);
+
+	Compact.Flags = static_cast<uint8>(
+		(Frame.Gaze.bValid ? GazeValid : 0) |
+		(Frame.bHasVelocity ? HasVelocity : 0) |
+		(Frame.bGazeSynthesized ? GazeSynthesized : 0) |
+		(Frame.bHeadSynthesized ? HeadSynthesized : 0) |
+		(Frame.bStale ? Stale : 0));
+	return Compact;
+}
+
+void FBeamFrameCompact::ToFrame(FBeamFrame& OutFrame, FIntPoint ViewportSize) const
+{
+	OutFrame = FBeamFrame();
+	OutFrame.FrameId = FrameId;
+	OutFrame.SDKTimestampMs = SDKTimestampMs;
+	OutFrame.UETimestampSeconds = UETimestampSeconds;
+	OutFrame.DeltaTimeSeconds = DeltaTimeSeconds;
+
+	OutFrame.Gaze.bValid = IsGazeValid();
+	OutFrame.Gaze.Screen01 = FVector2D(GetGazeX01(), GetGazeY01());
+	if (ViewportSize.X > 0 && ViewportSize.Y > 0)
+	{
+		OutFrame.Gaze.ScreenPx = FVector2D(OutFrame.Gaze.Screen01.X * ViewportSize.X, OutFrame.Gaze.Screen01.Y * ViewportSize.Y);
+	}
+	OutFrame.Gaze.Confidence = GazeConfidence / 255.0;
+	OutFrame.Gaze.TimestampMs = SDKTimestampMs;
+
+	OutFrame.Head.PositionCm = FVector(HeadPositionCm[0], HeadPositionCm[1], HeadPositionCm[2]) * (1.0 / PositionScale);
+	OutFrame.Head.SetRotation(FRotator(HeadRotation[0], HeadRotation[1], HeadRotation[2]) * (1.0 / RotationScale));
+	OutFrame.Head.Confidence = HeadConfidence / 255.0;
+	OutFrame.Head.TimestampMs = SDKTimestampMs;
+
+	OutFrame.bHasVelocity = (Flags & HasVelocity) != 0;
+	OutFrame.GazeVelocity01 = FVector2D(GazeVelocity01[0], GazeVelocity01[1]) * (1.0 / VelocityScale);
+	OutFrame.bGazeSynthesized = (Flags & GazeSynthesized) != 0;
+	OutFrame.bHeadSynthesized = (Flags & HeadSynthesized) != 0;
+	OutFrame.bStale = (Flags & Stale) != 0;
+}
@@ -0,0 +1,146 @@
+// Implements shared multi-rate views over the frame ring
+
+#include "BeamFrameRateViews.h"
+
+FDelegateHandle FBeamFrameRateViews::Add(const FBeamFrameRateView& View, FOnBeamRateViewFrameNative::FDelegate&& Delegate)
+{
+	FBeamFrameRateView Key = View;
+	if (Key.Rate == EBeamFrameRate::Decimated)
+	{
+		Key.DecimatedHz = FMath::Max(Key.DecimatedHz, 0.1f);
+	}
+
+	FGroup* Group = Groups.FindByPredicate([&Key](const FGroup& Candidate) { return Candidate.View == Key; });
+	if (!Group)
+	{
+		Group = &Groups.AddDefaulted_GetRef();
+		Group->View = Key;
+	}
+	return Group->Event.Add(MoveTemp(Delegate));
+}
+
+void FBeamFrameRateViews::Remove(FDelegateHandle Handle)
+{
+	for (int32 Index = 0; Index < Groups.Num(); ++Index)
+	{
+		if (Groups[Index].Event.Remove(Handle))
+		{
+			if (!Groups[Index].Event.IsBound())
+			{
+				Groups.RemoveAtSwap(Index);
+			}
+			return;
+		}
+	}
+}
+
+void FBeamFrameRateViews::ProcessFrames(TArrayView<const FBeamFrame> Frames)
+{
+	if (Frames.Num() == 0)
+	{
+		return;
+	}
+
+	// Broadcasting may add or remove subscribers, so groups are addressed by index and outputs are
+	// gathered before the (copied) event fires
+	TArray<FBeamFrame, TInlineAllocator<8>> Outputs;
+	for (int32 Index = 0; Index < Groups.Num(); ++Index)
+	{
+		FGroup& Group = Groups[Index];
+		const FOnBeamRateViewFrameNative Event = Group.Event;
+
+		switch (Group.View.Rate)
+		{
+		case EBeamFrameRate::Native:
+			for (const FBeamFrame& Frame : Frames)
+			{
+				Event.Broadcast(Frame);
+			}
+			continue;
+
+		case EBeamFrameRate::EngineFrame:
+			Event.Broadcast(Frames.Last());
+			continue;
+
+		case EBeamFrameRate::Decimated:
+		{
+			const double IntervalMs = 1000.0 / Group.View.DecimatedHz;
+			Outputs.Reset();
+			for (const FBeamFrame& Frame : Frames)
+			{
+				const int64 Interval = FMath::FloorToInt64(Frame.SDKTimestampMs / IntervalMs);
+				if (Interval != Group.Interval && Group.Average.NumFrames > 0)
+				{
+					Outputs.Add(Group.Average.Resolve());
+					Group.Average = FAverage();
+				}
+				Group.Interval = Interval;
+				Group.Average.Add(Frame);
+			}
+			for (const FBeamFrame& Output : Outputs)
+			{
+				Event.Broadcast(Output);
+			}
+			continue;
+		}
+		}
+	}
+}
+
+void FBeamFrameRateViews::Rearm()
+{
+	for (FGroup& Group : Groups)
+	{
+		Group.Interval = INDEX_NONE;
+		Group.Average = FAverage();
+	}
+}
+
+void FBeamFrameRateViews::FAverage::Add(const FBeamFrame& Frame)
+{
+	if (Frame.Gaze.bValid)
+	{
+		Screen01Sum += Frame.Gaze.Screen01;
+		ScreenPxSum += Frame.Gaze.ScreenPx;
+		GazeConfidenceSum += Frame.Gaze.Confidence;
+		++NumValidGaze;
+	}
+
+	// q and -q are the same rotation; keep every sample on the first one's hemisphere so the sum does not cancel
+	const FQuat& Rotation = Frame.Head.RotationQuat;
+	HeadRotationSum += (NumFrames > 0 && (HeadRotationSum | Rotation) < 0.0) ? -Rotation : Rotation;
+	HeadPositionSum += Frame.Head.PositionCm;
+	HeadConfidenceSum += Frame.Head.Confidence;
+
+	SDKTimestampSum += Frame.SDKTimestampMs;
+	UETimestampSum += Frame.UETimestampSeconds;
+	++NumFrames;
+	Last = Frame;
+}
+
+FBeamFrame FBeamFrameRateViews::FAverage::Resolve() const
+{
+	FBeamFrame Result = Last;
+	const double InvFrames = 1.0 / NumFrames;
+
+	Result.Gaze.bValid = NumValidGaze > 0;
+	if (NumValidGaze > 0)
+	{
+		const double InvValid = 1.0 / NumValidGaze;
+		Result.Gaze.Screen01 = Screen01Sum * InvValid;
+		Result.Gaze.ScreenPx = ScreenPxSum * InvValid;
+		Result.Gaze.Confidence = GazeConfidenceSum * InvValid;
+	}
+
+	// Normalized quaternion sum: close to the true mean for the small spread inside one interval
+	FQuat Rotation = HeadRotationSum;
+	Rotation.Normalize();
+	Result.Head.RotationQuat = Rotation;
+	Result.Head.Rotation = Rotation.Rotator();
+	Result.Head.PositionCm = HeadPositionSum * InvFrames;
+	Result.Head.Confidence = HeadConfidenceSum * InvFrames;
+
+	Result.SDKTimestampMs = SDKTimestampSum * InvFrames;
+	Result.UETimestampSeconds = UETimestampSum * InvFrames;
+	return Result;
+}
@@ -0,0 +1,106 @@
+// Implements threshold-grouped frame-change notifications shared by all subscribers
+
+#include "BeamFrameSubscriptions.h"
+
+FDelegateHandle FBeamFrameSubscriptions::Add(const FBeamChangeThresholds& Thresholds, FOnBeamFrameChangedNative::FDelegate&& Delegate)
+{
+	FGroup* Group = Groups.FindByPredicate([&Thresholds](const FGroup& Candidate) { return Candidate.Thresholds == Thresholds; });
+	if (!Group)
+	{
+		Group = &Groups.AddDefaulted_GetRef();
+		Group->Thresholds = Thresholds;
+	}
+	return Group->Event.Add(MoveTemp(Delegate));
+}
+
+void FBeamFrameSubscriptions::Remove(FDelegateHandle Handle)
+{
+	for (int32 Index = 0; Index < Groups.Num(); ++Index)
+	{
+		if (Groups[Index].Event.Remove(Handle))
+		{
+			if (!Groups[Index].Event.IsBound())
+			{
+				Groups.RemoveAtSwap(Index);
+			}
+			return;
+		}
+	}
+}
+
+void FBeamFrameSubscriptions::ProcessFrame(const FBeamFrame& Frame, double NowSeconds)
+{
+	const FQuat& HeadRotation = Frame.Head.RotationQuat;
+
+	// Broadcasting may add or remove subscribers, so groups are addressed by index and re-checked
+	for (int32 Index = 0; Index < Groups.Num(); ++Index)
+	{
+		FGroup& Group = Groups[Index];
+		const FBeamChangeThresholds& Thresholds = Group.Thresholds;
+
+		bool bGazeChanged = Group.bPendingGaze;
+		bool bHeadChanged = Group.bPendingHead;
+
+		if (Thresholds.GazePixels > 0.0f)
+		{
+			if (!Group.bHasNotified || Frame.Gaze.bValid != Group.bLastGazeValid)
+			{
+				bGazeChanged = true;
+			}
+			else if (Frame.Gaze.bValid && FVector2D::DistSquared(Frame.Gaze.ScreenPx, Group.LastGazePx) > FMath::Square(Thresholds.GazePixels))
+			{
+				bGazeChanged = true;
+			}
+		}
+
+		if (Thresholds.HeadDegrees > 0.0f)
+		{
+			if (!Group.bHasNotified || FMath::RadiansToDegrees(HeadRotation.AngularDistance(Group.LastHeadRotation)) > Thresholds.HeadDegrees)
+			{
+				bHeadChanged = true;
+			}
+		}
+
+		if (!bGazeChanged && !bHeadChanged)
+		{
+			continue;
+		}
+
+		if (Thresholds.MaxRateHz > 0.0f && NowSeconds - Group.LastNotifySeconds < 1.0 / Thresholds.MaxRateHz)
+		{
+			Group.bPendingGaze = bGazeChanged;
+			Group.bPendingHead = bHeadChanged;
+			continue;
+		}
+
+		// References move only on notification; that is what keeps values parked near a threshold quiet
+		if (bGazeChanged)
+		{
+			Group.LastGazePx = Frame.Gaze.ScreenPx;
+			Group.bLastGazeValid = Frame.Gaze.bValid;
+		}
+		if (bHeadChanged)
+		{
+			Group.LastHeadRotation = HeadRotation;
+		}
+		Group.LastNotifySeconds = NowSeconds;
+		Group.bHasNotified = true;
+		Group.bPendingGaze = false;
+		Group.bPendingHead = false;
+
+		// Copy the event: a subscriber removing the last handle of its group would free the array slot mid-broadcast
+		const FOnBeamFrameChangedNative Event = Group.Event;
+		Event.Broadcast(Frame, bGazeChanged, bHeadChanged);
+	}
+}
+
+void FBeamFrameSubscriptions::Rearm()
+{
+	for (FGroup& Group : Groups)
+	{
+		Group.bHasNotified = false;
+		Group.bPendingGaze = false;
+		Group.bPendingHead = false;
+		Group.LastNotifySeconds = -UE_BIG_NUMBER;
+	}
+}
@@ -0,0 +1,256 @@
+// Implements the clock-independent fixation and saccade analysis shared by live analytics and offline replay
+
+#include "BeamGazeAnalyzer.h"
+
+// Gaze movement (Screen01 units) that ends a fixation
+static constexpr double BeamFixationDispersion = 0.05;
+
+// Sample-to-sample movement (Screen01 units) counted as saccadic
+static constexpr double BeamSaccadeMinMovement = 0.01;
+
+// Completed events held for DrainEvents; later events are dropped until the queue is drained
+static constexpr int32 BeamMaxPendingGazeEvents = 256;
+
+FBeamGazeAnalyzer::FBeamGazeAnalyzer(float InMinFixationDuration, double InMaxAgeSeconds)
+	: MinFixationDuration(InMinFixationDuration)
+	, MaxAgeSeconds(InMaxAgeSeconds)
+{
+}
+
+SIZE_T FBeamGazeAnalyzer::GetBytesPerSample()
+{
+	return sizeof(FSampleRecord);
+}
+
+void FBeamGazeAnalyzer::ReserveForRate(float SamplesPerSecond)
+{
+	if (MaxAgeSeconds > 0.0 && SamplesPerSecond > 0.0f)
+	{
+		Samples.Reserve(FMath::CeilToInt32(SamplesPerSecond * MaxAgeSeconds) + 1);
+	}
+}
+
+void FBeamGazeAnalyzer::AddSample(const FVector2D& Screen01, double TimestampSeconds)
+{
+	const bool bKeepHistory = MaxAgeSeconds > 0.0;
+
+	if (NumSamples == 0)
+	{
+		if (bKeepHistory)
+		{
+			Samples.Push({ TimestampSeconds, 0.0f, 0.0f });
+		}
+		NumSamples = 1;
+
+		FixationAnchor = Screen01;
+		FixationSum = Screen01;
+		FixationSamples = 1;
+		FixationStartSeconds = TimestampSeconds;
+		LastSample = Screen01;
+		LastTimestamp = TimestampSeconds;
+		return;
+	}
+
+	// Velocity-threshold step classification
+	const float Distance = static_cast<float>(FVector2D::Distance(LastSample, Screen01));
+	const double TimeDelta = TimestampSeconds - LastTimestamp;
+	const float Velocity = (TimeDelta > 0.0 && Distance > BeamSaccadeMinMovement) ? static_cast<float>(Distance / TimeDelta) : 0.0f;
+
+	if (bKeepHistory)
+	{
+		Samples.Push({ TimestampSeconds, Distance, Velocity });
+	}
+	++NumSamples;
+	ScanPathLength += Distance;
+
+	if (Velocity > 0.0f)
+	{
+		SaccadeVelocitySum += Velocity;
+		++SaccadeStepCount;
+		if (!bInSaccade)
+		{
+			bInSaccade = true;
+			SaccadeStart = LastSample;
+			SaccadeStartSeconds = LastTimestamp;
+			SaccadePeakVelocity = 0.0f;
+		}
+		SaccadePeakVelocity = FMath::Max(SaccadePeakVelocity, Velocity);
+	}
+	else if (bInSaccade)
+	{
+		CloseSaccade();
+	}
+
+	// Dispersion-threshold fixation grouping around the fixation's first sample
+	if (FVector2D::Distance(FixationAnchor, Screen01) > BeamFixationDispersion)
+	{
+		CloseFixation();
+		FixationAnchor = Screen01;
+		FixationSum = Screen01;
+		FixationSamples = 1;
+		FixationStartSeconds = TimestampSeconds;
+	}
+	else
+	{
+		FixationSum += Screen01;
+		++FixationSamples;
+	}
+
+	LastSample = Screen01;
+	LastTimestamp = TimestampSeconds;
+
+	EvictOlderThan(TimestampSeconds);
+}
+
+void FBeamGazeAnalyzer::CloseFixation()
+{
+	const double Duration = LastTimestamp - FixationStartSeconds;
+	if (Duration < MinFixationDuration)
+	{
+		return;
+	}
+
+	const FVector2D Center = FixationSum / FixationSamples;
+	Fixations.Push({ LastTimestamp, Duration, Center });
+	FixationDurationSum += Duration;
+	EmitEvent(EBeamGazeEventType::Fixation, FixationStartSeconds, LastTimestamp, Center, 0.0f, 0.0f);
+}
+
+void FBeamGazeAnalyzer::CloseSaccade()
+{
+	bInSaccade = false;
+	EmitEvent(EBeamGazeEventType::Saccade, SaccadeStartSeconds, LastTimestamp, LastSample,
+		static_cast<float>(FVector2D::Distance(SaccadeStart, LastSample)), SaccadePeakVelocity);
+}
+
+void FBeamGazeAnalyzer::EvictOlderThan(double NowSeconds)
+{
+	if (MaxAgeSeconds <= 0.0)
+	{
+		return;
+	}
+
+	// The newest sample never ages out, so a new oldest sample always exists here
+	while (NowSeconds - Samples.Front().TimestampSeconds > MaxAgeSeconds)
+	{
+		Samples.PopFront();
+		--NumSamples;
+
+		// The step into the new oldest sample leaves the window with the sample before it
+		const FSampleRecord& Oldest = Samples.Front();
+		ScanPathLength -= Oldest.Distance;
+		if (Oldest.Velocity > 0.0f)
+		{
+			SaccadeVelocitySum -= Oldest.Velocity;
+			--SaccadeStepCount;
+		}
+	}
+
+	while (Fixations.Num() > 0 && NowSeconds - Fixations.Front().EndSeconds > MaxAgeSeconds)
+	{
+		FixationDurationSum -= Fixations.Front().DurationSeconds;
+		Fixations.PopFront();
+	}
+
+	// Empty sums restart from exact zero so subtraction error cannot accumulate
+	if (NumSamples == 1)
+	{
+		ScanPathLength = 0.0;
+	}
+	if (SaccadeStepCount == 0)
+	{
+		SaccadeVelocitySum = 0.0;
+	}
+	if (Fixations.Num() == 0)
+	{
+		FixationDurationSum = 0.0;
+	}
+}
+
+double FBeamGazeAnalyzer::GetOpenFixationDuration() const
+{
+	if (FixationSamples < 2)
+	{
+		return 0.0;
+	}
+	const double Duration = LastTimestamp - FixationStartSeconds;
+	return Duration >= MinFixationDuration ? Duration : 0.0;
+}
+
+void FBeamGazeAnalyzer::Analyze(FGazeAnalytics& OutAnalytics) const
+{
+	if (GetNumSamples() < 2)
+	{
+		return;
+	}
+
+	const double OpenDuration = GetOpenFixationDuration();
+
+	OutAnalytics.FixationPoints.Reset(Fixations.Num() + 1);
+	for (int32 i = 0; i < Fixations.Num(); ++i)
+	{
+		OutAnalytics.FixationPoints.Add(Fixations[i].Center);
+	}
+	if (OpenDuration > 0.0)
+	{
+		OutAnalytics.FixationPoints.Add(FixationSum / FixationSamples);
+	}
+
+	OutAnalytics.FixationCount = OutAnalytics.FixationPoints.Num();
+	if (OutAnalytics.FixationCount > 0)
+	{
+		OutAnalytics.AverageFixationDuration = static_cast<float>((FixationDurationSum + OpenDuration) / OutAnalytics.FixationCount);
+	}
+	if (SaccadeStepCount > 0)
+	{
+		OutAnalytics.SaccadeVelocity = static_cast<float>(SaccadeVelocitySum / SaccadeStepCount);
+	}
+	OutAnalytics.ScanPathLength = static_cast<float>(FMath::Max(ScanPathLength, 0.0));
+	OutAnalytics.TimeStamp = static_cast<float>(LastTimestamp);
+}
+
+void FBeamGazeAnalyzer::Reset()
+{
+	Samples.Reset();
+	NumSamples = 0;
+	Fixations.Reset();
+
+	ScanPathLength = 0.0;
+	SaccadeVelocitySum = 0.0;
+	SaccadeStepCount = 0;
+	FixationDurationSum = 0.0;
+	FixationSamples = 0;
+	bInSaccade = false;
+	PendingEvents.Reset();
+}
+
+void FBeamGazeAnalyzer::SetEventCapture(bool bInCaptureEvents)
+{
+	bCaptureEvents = bInCaptureEvents;
+	if (!bCaptureEvents)
+	{
+		PendingEvents.Reset();
+	}
+}
+
+void FBeamGazeAnalyzer::DrainEvents(TArray<FBeamGazeEvent>& OutEvents)
+{
+	OutEvents.Append(PendingEvents);
+	PendingEvents.Reset();
+}
+
+void FBeamGazeAnalyzer::EmitEvent(EBeamGazeEventType Type, double StartSeconds, double EndSeconds, const FVector2D& Position, float Amplitude, float PeakVelocity)
+{
+	if (!bCaptureEvents || PendingEvents.Num() >= BeamMaxPendingGazeEvents)
+	{
+		return;
+	}
+
+	FBeamGazeEvent& Event = PendingEvents.AddDefaulted_GetRef();
+	Event.Type = Type;
+	Event.StartSeconds = StartSeconds;
+	Event.EndSeconds = EndSeconds;
+	Event.Position = Position;
+	Event.Amplitude = Amplitude;
+	Event.PeakVelocity = PeakVelocity;
+}
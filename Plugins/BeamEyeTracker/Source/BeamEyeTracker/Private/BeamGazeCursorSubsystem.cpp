@@ -0,0 +1,200 @@
+// Implements the Slate-level gaze cursor and its widget gaze routing
+
+#include "BeamGazeCursorSubsystem.h"
+#include "BeamGazeWidgetTarget.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamStats.h"
+#include "Blueprint/UserWidget.h"
+#include "Engine/GameInstance.h"
+#include "Engine/GameViewportClient.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/PlatformTime.h"
+#include "Input/HittestGrid.h"
+#include "Slate/SObjectWidget.h"
+#include "Widgets/SViewport.h"
+#include "Widgets/SWindow.h"
+
+DECLARE_CYCLE_STAT(TEXT("Gaze Cursor Hit Test"), STAT_BeamGazeCursor, STATGROUP_Beam);
+
+namespace BeamGazeCursor
+{
+	// SObjectWidget is the Slate wrapper every UUserWidget builds around its content
+	static const FName ObjectWidgetType(TEXT("SObjectWidget"));
+}
+
+void UBeamGazeCursorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	BeamSubsystem = Collection.InitializeDependency<UBeamEyeTrackerSubsystem>();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamGazeCursorSubsystem::Tick));
+}
+
+void UBeamGazeCursorSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	// Widgets are going away with the game instance; they get no leave
+	GazedWidgets.Reset();
+	InnermostWidget.Reset();
+	BeamSubsystem = nullptr;
+
+	Super::Deinitialize();
+}
+
+UUserWidget* UBeamGazeCursorSubsystem::GetGazedWidget(FVector2D& OutLocalPosition) const
+{
+	UUserWidget* Widget = InnermostWidget.Get();
+	OutLocalPosition = Widget ? InnermostLocalPosition : FVector2D::ZeroVector;
+	return Widget;
+}
+
+float UBeamGazeCursorSubsystem::GetGazeDuration() const
+{
+	return GazedWidgets.Num() > 0 ? static_cast<float>(FPlatformTime::Seconds() - GazedWidgets.Last().EnterSeconds) : 0.0f;
+}
+
+void UBeamGazeCursorSubsystem::SetGazeCursorEnabled(bool bEnabled)
+{
+	if (bGazeCursorEnabled == bEnabled)
+	{
+		return;
+	}
+
+	bGazeCursorEnabled = bEnabled;
+	if (!bEnabled)
+	{
+		UpdateGazedWidgets({}, FPlatformTime::Seconds());
+		InnermostWidget.Reset();
+	}
+}
+
+bool UBeamGazeCursorSubsystem::Tick(float DeltaTime)
+{
+	if (!bGazeCursorEnabled || !BeamSubsystem || !FSlateApplication::IsInitialized())
+	{
+		return true;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_BeamGazeCursor);
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	const FBeamFrame* Frame = BeamSubsystem->PeekCurrentFrame();
+	if (!Frame || !Frame->Gaze.bValid || Frame->Gaze.Confidence < MinConfidence)
+	{
+		if (NowSeconds - LastGazeSeconds > GazeLossGraceSeconds)
+		{
+			UpdateGazedWidgets({}, NowSeconds);
+			InnermostWidget.Reset();
+		}
+		return true;
+	}
+	LastGazeSeconds = NowSeconds;
+
+	TArray<TPair<UUserWidget*, FVector2D>, TInlineAllocator<8>> Targets;
+	HitTest(Frame->Gaze.Screen01, Targets);
+	UpdateGazedWidgets(Targets, NowSeconds);
+	return true;
+}
+
+void UBeamGazeCursorSubsystem::HitTest(const FVector2D& Screen01, TArray<TPair<UUserWidget*, FVector2D>, TInlineAllocator<8>>& OutTargets)
+{
+	InnermostWidget.Reset();
+
+	UGameViewportClient* ViewportClient = GetGameInstance()->GetGameViewportClient();
+	const TSharedPtr<SViewport> ViewportWidget = ViewportClient ? ViewportClient->GetGameViewportWidget() : nullptr;
+	const TSharedPtr<SWindow> Window = ViewportClient ? ViewportClient->GetWindow() : nullptr;
+	if (!ViewportWidget.IsValid() || !Window.IsValid())
+	{
+		return;
+	}
+
+	// The hit test grid works in desktop space; gaze is normalized against the game viewport
+	const FGeometry& ViewportGeometry = ViewportWidget->GetTickSpaceGeometry();
+	const FVector2D DesktopPosition = ViewportGeometry.LocalToAbsolute(Screen01 * ViewportGeometry.GetLocalSize());
+
+	// Root first, so user widgets are met outermost first
+	const TArray<FWidgetAndPointer> BubblePath = Window->GetHittestGrid().GetBubblePath(DesktopPosition, CursorRadius, false);
+	for (const FWidgetAndPointer& Entry : BubblePath)
+	{
+		if (Entry.Widget->GetType() != BeamGazeCursor::ObjectWidgetType)
+		{
+			continue;
+		}
+
+		UUserWidget* UserWidget = StaticCastSharedRef<SObjectWidget>(Entry.Widget)->GetWidgetObject();
+		if (!UserWidget)
+		{
+			continue;
+		}
+
+		const FVector2D LocalPosition = Entry.Geometry.AbsoluteToLocal(DesktopPosition);
+		InnermostWidget = UserWidget;
+		InnermostLocalPosition = LocalPosition;
+		if (UserWidget->Implements<UBeamGazeWidgetTarget>())
+		{
+			OutTargets.Emplace(UserWidget, LocalPosition);
+		}
+	}
+}
+
+void UBeamGazeCursorSubsystem::UpdateGazedWidgets(TArrayView<const TPair<UUserWidget*, FVector2D>> Targets, double NowSeconds)
+{
+	TArray<FGazedWidget> Previous = MoveTemp(GazedWidgets);
+	GazedWidgets.Reset();
+
+	// Widgets still hit keep their enter time and dwell state
+	TArray<int32, TInlineAllocator<8>> Entered;
+	for (const TPair<UUserWidget*, FVector2D>& Target : Targets)
+	{
+		const int32 PreviousIndex = Previous.IndexOfByPredicate([&Target](const FGazedWidget& Gazed) { return Gazed.Widget.Get() == Target.Key; });
+		if (PreviousIndex != INDEX_NONE)
+		{
+			GazedWidgets.Add(Previous[PreviousIndex]);
+			Previous[PreviousIndex].Widget.Reset();
+			continue;
+		}
+
+		FGazedWidget& Gazed = GazedWidgets.AddDefaulted_GetRef();
+		Gazed.Widget = Target.Key;
+		Gazed.EnterSeconds = NowSeconds;
+		const float WidgetDwellSeconds = IBeamGazeWidgetTarget::Execute_GetGazeDwellSeconds(Target.Key);
+		Gazed.DwellSeconds = WidgetDwellSeconds > 0.0f ? WidgetDwellSeconds : DefaultDwellSeconds;
+		Entered.Add(GazedWidgets.Num() - 1);
+	}
+
+	// Handlers may add or remove widgets, so every call re-resolves its weak pointer
+	for (int32 Index = Previous.Num() - 1; Index >= 0; --Index)
+	{
+		if (UUserWidget* Widget = Previous[Index].Widget.Get())
+		{
+			IBeamGazeWidgetTarget::Execute_OnGazeLeave(Widget);
+		}
+	}
+	for (const int32 Index : Entered)
+	{
+		if (UUserWidget* Widget = Targets[Index].Key)
+		{
+			if (IsValid(Widget))
+			{
+				IBeamGazeWidgetTarget::Execute_OnGazeEnter(Widget, Targets[Index].Value);
+			}
+		}
+	}
+
+	for (int32 Index = 0; Index < GazedWidgets.Num(); ++Index)
+	{
+		FGazedWidget& Gazed = GazedWidgets[Index];
+		if (Gazed.bDwellFired || NowSeconds - Gazed.EnterSeconds < Gazed.DwellSeconds)
+		{
+			continue;
+		}
+
+		Gazed.bDwellFired = true;
+		if (UUserWidget* Widget = Gazed.Widget.Get())
+		{
+			IBeamGazeWidgetTarget::Execute_OnGazeDwell(Widget, Gazed.DwellSeconds);
+		}
+	}
+}
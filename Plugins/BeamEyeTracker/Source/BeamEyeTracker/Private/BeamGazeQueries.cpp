@@ -0,0 +1,109 @@
+// Implements the latent Blueprint gaze query nodes
+
+#include "BeamGazeQueries.h"
+#include "BeamLogging.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "LatentActions.h"
+
+/** Finishes when the held query's task has completed; aborting the node cancels the query */
+class FBeamGazeQueryAction : public FPendingLatentAction
+{
+public:
+	FBeamGazeQueryAction(const FBeamGazeQuery& InQuery, EBeamGazeQueryResult& InResult, const FLatentActionInfo& LatentInfo)
+		: Query(InQuery)
+		, Result(InResult)
+		, ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+	{
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (!Query.IsCompleted())
+		{
+			return;
+		}
+
+		Result = Query.Task.IsValid() ? Query.Task.GetResult() : EBeamGazeQueryResult::Cancelled;
+		Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+
+	virtual void NotifyObjectDestroyed() override
+	{
+		Query.Cancel();
+	}
+
+	virtual void NotifyActionAborted() override
+	{
+		Query.Cancel();
+	}
+
+#if WITH_EDITOR
+	virtual FString GetDescription() const override
+	{
+		return Query.IsCompleted() ? TEXT("Gaze query resolved") : TEXT("Waiting for gaze query");
+	}
+#endif
+
+private:
+	FBeamGazeQuery Query;
+	EBeamGazeQueryResult& Result;
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+};
+
+void UBeamGazeQueryLibrary::WaitForFixationOn(const UObject* WorldContextObject, AActor* Target, float MinMs, float TimeoutSeconds, EBeamGazeQueryResult& Result, FLatentActionInfo LatentInfo)
+{
+	StartLatentQuery(WorldContextObject, Result, LatentInfo, [Target, MinMs, TimeoutSeconds](UBeamFocusSubsystem& Focus)
+	{
+		return Focus.WaitForFixationOn(Target, MinMs, TimeoutSeconds);
+	});
+}
+
+void UBeamGazeQueryLibrary::WaitForGazeEnter(const UObject* WorldContextObject, FVector2D Min, FVector2D Max, float TimeoutSeconds, EBeamGazeQueryResult& Result, FLatentActionInfo LatentInfo)
+{
+	StartLatentQuery(WorldContextObject, Result, LatentInfo, [Min, Max, TimeoutSeconds](UBeamFocusSubsystem& Focus)
+	{
+		return Focus.WaitForGazeEnter(FBox2D(Min, Max), TimeoutSeconds);
+	});
+}
+
+void UBeamGazeQueryLibrary::WaitForTrackingHealthy(const UObject* WorldContextObject, float TimeoutSeconds, EBeamGazeQueryResult& Result, FLatentActionInfo LatentInfo)
+{
+	StartLatentQuery(WorldContextObject, Result, LatentInfo, [TimeoutSeconds](UBeamFocusSubsystem& Focus)
+	{
+		return Focus.WaitForTrackingHealthy(TimeoutSeconds);
+	});
+}
+
+void UBeamGazeQueryLibrary::StartLatentQuery(const UObject* WorldContextObject, EBeamGazeQueryResult& Result, const FLatentActionInfo& LatentInfo,
+	TFunctionRef<FBeamGazeQuery(UBeamFocusSubsystem&)> MakeQuery)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	if (!World)
+	{
+		return;
+	}
+
+	FLatentActionManager& LatentManager = World->GetLatentActionManager();
+	if (LatentManager.FindExistingAction<FBeamGazeQueryAction>(LatentInfo.CallbackTarget, LatentInfo.UUID))
+	{
+		return;
+	}
+
+	// Without a dispatcher the default query counts as completed, and the node continues as Cancelled
+	FBeamGazeQuery Query;
+	if (UBeamFocusSubsystem* Focus = World->GetSubsystem<UBeamFocusSubsystem>())
+	{
+		Query = MakeQuery(*Focus);
+	}
+	else
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamGazeQueries: No focus dispatcher in this world, query cancelled"));
+	}
+
+	LatentManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FBeamGazeQueryAction(Query, Result, LatentInfo));
+}
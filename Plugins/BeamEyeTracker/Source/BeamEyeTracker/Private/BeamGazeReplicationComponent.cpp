@@ -0,0 +1,465 @@
+// Implements quantized, batched gaze replication with remote interpolation
+
+#include "BeamGazeReplicationComponent.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamRing.h"
+#include "BeamStats.h"
+#include "BeamLogging.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Net/UnrealNetwork.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BeamGazeReplicationComponent)
+
+DECLARE_CYCLE_STAT(TEXT("Beam Gaze Replication Tick"), STAT_BeamGazeReplicationTick, STATGROUP_Beam);
+
+namespace
+{
+	constexpr double GazeRangeMin = -0.25;
+	constexpr double GazeRange = 1.5;
+
+	/** Playback samples kept per remote player; far more than one interpolation delay needs */
+	constexpr int32 MaxPlaybackSamples = 64;
+
+	uint32 ZigZag(int32 Value)
+	{
+		return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+	}
+
+	int32 UnZigZag(uint32 Value)
+	{
+		return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+	}
+
+	/** Writes or reads Current as a zigzag varint of its difference to Previous; Previous is the decoded value when loading */
+	template <typename T>
+	void SerializeDelta(FArchive& Ar, T& Current, T Previous)
+	{
+		uint32 Packed = Ar.IsSaving() ? ZigZag(static_cast<int32>(Current) - static_cast<int32>(Previous)) : 0;
+		Ar.SerializeIntPacked(Packed);
+		if (Ar.IsLoading())
+		{
+			Current = static_cast<T>(static_cast<int32>(Previous) + UnZigZag(Packed));
+		}
+	}
+
+	/** Angles wrap, so the delta of two compressed shorts is taken modulo 2^16 */
+	void SerializeAngleDelta(FArchive& Ar, uint16& Current, uint16 Previous)
+	{
+		int16 Delta = Ar.IsSaving() ? static_cast<int16>(static_cast<uint16>(Current - Previous)) : 0;
+		uint32 Packed = Ar.IsSaving() ? ZigZag(Delta) : 0;
+		Ar.SerializeIntPacked(Packed);
+		if (Ar.IsLoading())
+		{
+			Current = static_cast<uint16>(Previous + static_cast<uint16>(UnZigZag(Packed)));
+		}
+	}
+
+	void SerializeSample(FArchive& Ar, FBeamNetGazeSample& Sample, const FBeamNetGazeSample* Previous, bool bHasHead)
+	{
+		uint8 bValid = Sample.bGazeValid ? 1 : 0;
+		Ar.SerializeBits(&bValid, 1);
+		Sample.bGazeValid = bValid != 0;
+
+		if (!Previous)
+		{
+			// First sample of a batch is absolute
+			Ar.SerializeIntPacked(Sample.TimeOffsetMs);
+			Ar << Sample.GazeX << Sample.GazeY << Sample.GazeConfidence;
+			if (bHasHead)
+			{
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					uint32 Packed = Ar.IsSaving() ? ZigZag(Sample.HeadPositionMm[Axis]) : 0;
+					Ar.SerializeIntPacked(Packed);
+					Sample.HeadPositionMm[Axis] = UnZigZag(Packed);
+					Ar << Sample.HeadRotation[Axis];
+				}
+				Ar << Sample.HeadConfidence;
+			}
+			return;
+		}
+
+		// Later samples are small differences to the one before, typically one or two bytes per field
+		SerializeDelta(Ar, Sample.TimeOffsetMs, Previous->TimeOffsetMs);
+		SerializeDelta(Ar, Sample.GazeX, Previous->GazeX);
+		SerializeDelta(Ar, Sample.GazeY, Previous->GazeY);
+		SerializeDelta(Ar, Sample.GazeConfidence, Previous->GazeConfidence);
+		if (bHasHead)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				SerializeDelta(Ar, Sample.HeadPositionMm[Axis], Previous->HeadPositionMm[Axis]);
+				SerializeAngleDelta(Ar, Sample.HeadRotation[Axis], Previous->HeadRotation[Axis]);
+			}
+			SerializeDelta(Ar, Sample.HeadConfidence, Previous->HeadConfidence);
+		}
+	}
+
+	uint8 QuantizeUnit(double Value)
+	{
+		return static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Value, 0.0, 1.0) * 255.0));
+	}
+}
+
+//-----------------------------------------------------------------------------
+// FBeamNetGazeSample / FBeamNetGazeBatch
+//-----------------------------------------------------------------------------
+
+FBeamNetGazeSample FBeamNetGazeSample::Quantize(const FBeamFrame& Frame, uint32 InTimeOffsetMs)
+{
+	FBeamNetGazeSample Sample;
+	Sample.TimeOffsetMs = InTimeOffsetMs;
+	Sample.bGazeValid = Frame.Gaze.bValid;
+	Sample.GazeX = static_cast<uint16>(FMath::RoundToInt(FMath::Clamp((Frame.Gaze.Screen01.X - GazeRangeMin) / GazeRange, 0.0, 1.0) * 65535.0));
+	Sample.GazeY = static_cast<uint16>(FMath::RoundToInt(FMath::Clamp((Frame.Gaze.Screen01.Y - GazeRangeMin) / GazeRange, 0.0, 1.0) * 65535.0));
+	Sample.GazeConfidence = QuantizeUnit(Frame.Gaze.Confidence);
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		Sample.HeadPositionMm[Axis] = FMath::RoundToInt(Frame.Head.PositionCm[Axis] * 10.0);
+	}
+	Sample.HeadRotation[0] = FRotator::CompressAxisToShort(Frame.Head.Rotation.Pitch);
+	Sample.HeadRotation[1] = FRotator::CompressAxisToShort(Frame.Head.Rotation.Yaw);
+	Sample.HeadRotation[2] = FRotator::CompressAxisToShort(Frame.Head.Rotation.Roll);
+	Sample.HeadConfidence = QuantizeUnit(Frame.Head.Confidence);
+	return Sample;
+}
+
+void FBeamNetGazeSample::Dequantize(FGazePoint& OutGaze, FHeadPose& OutHead) const
+{
+	OutGaze.bValid = bGazeValid;
+	OutGaze.Screen01 = FVector2D(GazeX / 65535.0 * GazeRange + GazeRangeMin, GazeY / 65535.0 * GazeRange + GazeRangeMin);
+	OutGaze.ScreenPx = FVector2D::ZeroVector; // Pixels only make sense on the sender's screen
+	OutGaze.Confidence = GazeConfidence / 255.0;
+
+	OutHead.PositionCm = FVector(HeadPositionMm[0], HeadPositionMm[1], HeadPositionMm[2]) * 0.1;
+	OutHead.SetRotation(FRotator(
+		FRotator::DecompressAxisFromShort(HeadRotation[0]),
+		FRotator::DecompressAxisFromShort(HeadRotation[1]),
+		FRotator::DecompressAxisFromShort(HeadRotation[2])));
+	OutHead.Confidence = HeadConfidence / 255.0;
+}
+
+bool FBeamNetGazeBatch::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Ar.SerializeIntPacked(BaseTimeMs);
+	Ar << Sequence;
+
+	uint8 bHead = bHasHead ? 1 : 0;
+	Ar.SerializeBits(&bHead, 1);
+	bHasHead = bHead != 0;
+
+	uint32 NumSamples = Samples.Num();
+	Ar.SerializeInt(NumSamples, MaxSamples + 1);
+	if (Ar.IsLoading())
+	{
+		Samples.SetNum(FMath::Min<int32>(NumSamples, MaxSamples));
+	}
+
+	for (int32 Index = 0; Index < Samples.Num(); ++Index)
+	{
+		SerializeSample(Ar, Samples[Index], Index > 0 ? &Samples[Index - 1] : nullptr, bHasHead);
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+bool FBeamNetGazeBatch::Identical(const FBeamNetGazeBatch* Other, uint32 PortFlags) const
+{
+	// Every batch gets a fresh sequence, so this is enough to detect a change without comparing samples
+	return Other && Other->Sequence == Sequence && Other->BaseTimeMs == BaseTimeMs && Other->Samples.Num() == Samples.Num();
+}
+
+//-----------------------------------------------------------------------------
+// UBeamGazeReplicationComponent
+//-----------------------------------------------------------------------------
+
+UBeamGazeReplicationComponent::UBeamGazeReplicationComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	SetIsReplicatedByDefault(true);
+}
+
+void UBeamGazeReplicationComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Only the owner samples; remote copies interpolate on demand and never tick
+	SetComponentTickEnabled(IsLocallyOwned());
+}
+
+void UBeamGazeReplicationComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// The owner has its own tracker; everyone else gets the batch while it is fresh (see PreReplication)
+	DOREPLIFETIME_CONDITION(UBeamGazeReplicationComponent, GazeBatch, COND_SkipOwner);
+}
+
+void UBeamGazeReplicationComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// Stop sending once the owner falls silent, so idle or non-sharing players cost nothing
+	const bool bFresh = FPlatformTime::Seconds() - LastBatchSeconds < StaleTimeoutSeconds;
+	DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UBeamGazeReplicationComponent, GazeBatch, bFresh);
+}
+
+bool UBeamGazeReplicationComponent::IsLocallyOwned() const
+{
+	const AActor* Owner = GetOwner();
+	return Owner && Owner->HasLocalNetOwner();
+}
+
+UBeamEyeTrackerSubsystem* UBeamGazeReplicationComponent::ResolveSubsystem() const
+{
+	if (UBeamEyeTrackerSubsystem* Subsystem = CachedSubsystem.Get())
+	{
+		return Subsystem;
+	}
+
+	const UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UBeamEyeTrackerSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	CachedSubsystem = Subsystem;
+	return Subsystem;
+}
+
+void UBeamGazeReplicationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	SCOPE_CYCLE_COUNTER(STAT_BeamGazeReplicationTick);
+
+	if (!bShareGaze)
+	{
+		PendingBatch.Samples.Reset();
+		return;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (NowSeconds >= NextSampleSeconds)
+	{
+		NextSampleSeconds = NowSeconds + 1.0 / FMath::Max(SampleRateHz, 1.0f);
+		SampleLocalTracker(NowSeconds);
+	}
+	if (NowSeconds >= NextSendSeconds || PendingBatch.Samples.Num() >= FBeamNetGazeBatch::MaxSamples)
+	{
+		SendPendingBatch(NowSeconds);
+	}
+}
+
+void UBeamGazeReplicationComponent::SampleLocalTracker(double NowSeconds)
+{
+	const UBeamEyeTrackerSubsystem* Subsystem = ResolveSubsystem();
+	const FBeamFrameRing* Ring = Subsystem ? Subsystem->GetFrameRing() : nullptr;
+	FBeamFrame Frame;
+	if (!Ring || !Ring->ReadLatest(Frame))
+	{
+		return;
+	}
+
+	const uint32 NowMs = static_cast<uint32>(static_cast<uint64>(NowSeconds * 1000.0));
+	if (PendingBatch.Samples.Num() == 0)
+	{
+		PendingBatch.BaseTimeMs = NowMs;
+	}
+	const FBeamNetGazeSample Sample = FBeamNetGazeSample::Quantize(Frame, NowMs - PendingBatch.BaseTimeMs);
+
+	// Dead band: while the player looks at the same spot nothing is queued, apart from a keep-alive before remotes go stale
+	if (bHasSentSample && PendingBatch.Samples.Num() == 0 && NowSeconds - LastSentSeconds < StaleTimeoutSeconds * 0.5)
+	{
+		const int32 Threshold = FMath::Max(1, FMath::RoundToInt(IdleThreshold01 / GazeRange * 65535.0));
+		const bool bGazeIdle = Sample.bGazeValid == LastSentSample.bGazeValid
+			&& FMath::Abs(Sample.GazeX - LastSentSample.GazeX) <= Threshold
+			&& FMath::Abs(Sample.GazeY - LastSentSample.GazeY) <= Threshold;
+		const bool bHeadIdle = !bShareHeadPose
+			|| (FMath::Abs(Sample.HeadPositionMm[0] - LastSentSample.HeadPositionMm[0]) <= 1
+				&& FMath::Abs(Sample.HeadPositionMm[1] - LastSentSample.HeadPositionMm[1]) <= 1
+				&& FMath::Abs(Sample.HeadPositionMm[2] - LastSentSample.HeadPositionMm[2]) <= 1
+				&& FMemory::Memcmp(Sample.HeadRotation, LastSentSample.HeadRotation, sizeof(Sample.HeadRotation)) == 0);
+		if (bGazeIdle && bHeadIdle)
+		{
+			return;
+		}
+	}
+
+	PendingBatch.Samples.Add(Sample);
+}
+
+void UBeamGazeReplicationComponent::SendPendingBatch(double NowSeconds)
+{
+	NextSendSeconds = NowSeconds + 1.0 / FMath::Max(SendRateHz, 1.0f);
+	if (PendingBatch.Samples.Num() == 0)
+	{
+		return;
+	}
+
+	PendingBatch.Sequence = NextSequence++;
+	PendingBatch.bHasHead = bShareHeadPose;
+	LastSentSample = PendingBatch.Samples.Last();
+	LastSentSeconds = NowSeconds;
+	bHasSentSample = true;
+
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		AcceptBatch(PendingBatch);
+	}
+	else
+	{
+		ServerSubmitGaze(PendingBatch);
+	}
+	PendingBatch.Samples.Reset();
+}
+
+void UBeamGazeReplicationComponent::ServerSubmitGaze_Implementation(const FBeamNetGazeBatch& Batch)
+{
+	AcceptBatch(Batch);
+}
+
+void UBeamGazeReplicationComponent::AcceptBatch(const FBeamNetGazeBatch& Batch)
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	const bool bNewer = !bHasReceived || static_cast<int16>(Batch.Sequence - LastReceivedSequence) > 0;
+
+	// Rate limit on the server as well: a client sending faster than twice the configured rate is throttled
+	if (!bNewer || Batch.Samples.Num() == 0 || NowSeconds - LastAcceptedSeconds < 0.5 / FMath::Max(SendRateHz, 1.0f))
+	{
+		return;
+	}
+
+	LastAcceptedSeconds = NowSeconds;
+	LastBatchSeconds = NowSeconds;
+	GazeBatch = Batch;
+
+	// A listen server host watching a client never gets OnRep, so it fills its playback buffer here
+	if (!IsLocallyOwned())
+	{
+		BufferBatch(Batch);
+	}
+	else
+	{
+		LastReceivedSequence = Batch.Sequence;
+		bHasReceived = true;
+	}
+}
+
+void UBeamGazeReplicationComponent::OnRep_GazeBatch()
+{
+	BufferBatch(GazeBatch);
+}
+
+void UBeamGazeReplicationComponent::BufferBatch(const FBeamNetGazeBatch& Batch)
+{
+	if (Batch.Samples.Num() == 0 || (bHasReceived && static_cast<int16>(Batch.Sequence - LastReceivedSequence) <= 0))
+	{
+		return;
+	}
+	LastReceivedSequence = Batch.Sequence;
+	bHasReceived = true;
+
+	// Map the sender clock onto ours with the lowest observed transit, which absorbs jitter; follow drift slowly
+	const double NowSeconds = FPlatformTime::Seconds();
+	const double NewestSenderSeconds = (static_cast<double>(Batch.BaseTimeMs) + Batch.Samples.Last().TimeOffsetMs) * 0.001;
+	const double Observed = NowSeconds - NewestSenderSeconds;
+	if (!bHasClockOffset || Observed < SenderToLocalSeconds || FMath::Abs(Observed - SenderToLocalSeconds) > 5.0)
+	{
+		SenderToLocalSeconds = Observed;
+		bHasClockOffset = true;
+	}
+	else
+	{
+		SenderToLocalSeconds += (Observed - SenderToLocalSeconds) * 0.02;
+	}
+
+	for (const FBeamNetGazeSample& Sample : Batch.Samples)
+	{
+		FPlaybackSample& Decoded = Playback.AddDefaulted_GetRef();
+		Decoded.LocalSeconds = (static_cast<double>(Batch.BaseTimeMs) + Sample.TimeOffsetMs) * 0.001 + SenderToLocalSeconds;
+		Sample.Dequantize(Decoded.Gaze, Decoded.Head);
+		if (!Batch.bHasHead)
+		{
+			Decoded.Head = FHeadPose();
+		}
+	}
+
+	// Clock corrections can reorder the tail slightly; keep the buffer sorted and bounded
+	Playback.Sort([](const FPlaybackSample& A, const FPlaybackSample& B) { return A.LocalSeconds < B.LocalSeconds; });
+	const double OldestNeeded = NowSeconds - InterpolationDelaySeconds - StaleTimeoutSeconds;
+	int32 NumExpired = 0;
+	while (NumExpired < Playback.Num() - 2 && Playback[NumExpired + 1].LocalSeconds < OldestNeeded)
+	{
+		++NumExpired;
+	}
+	NumExpired = FMath::Max(NumExpired, Playback.Num() - MaxPlaybackSamples);
+	if (NumExpired > 0)
+	{
+		Playback.RemoveAt(0, NumExpired, EAllowShrinking::No);
+	}
+}
+
+bool UBeamGazeReplicationComponent::GetSharedGaze(FGazePoint& OutGaze, FHeadPose& OutHead) const
+{
+	if (IsLocallyOwned())
+	{
+		const UBeamEyeTrackerSubsystem* Subsystem = ResolveSubsystem();
+		const FBeamFrameRing* Ring = Subsystem ? Subsystem->GetFrameRing() : nullptr;
+		FBeamFrame Frame;
+		if (!Ring || !Ring->ReadLatest(Frame))
+		{
+			return false;
+		}
+		OutGaze = Frame.Gaze;
+		OutHead = Frame.Head;
+		return Frame.Gaze.bValid;
+	}
+
+	if (Playback.Num() == 0)
+	{
+		return false;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (NowSeconds - Playback.Last().LocalSeconds > InterpolationDelaySeconds + StaleTimeoutSeconds)
+	{
+		return false;
+	}
+
+	// Play back InterpolationDelaySeconds in the past so two received samples bracket the render time
+	const double RenderSeconds = NowSeconds - InterpolationDelaySeconds;
+	int32 Next = 0;
+	while (Next < Playback.Num() && Playback[Next].LocalSeconds < RenderSeconds)
+	{
+		++Next;
+	}
+
+	if (Next == 0 || Next == Playback.Num())
+	{
+		const FPlaybackSample& Held = Playback[Next == 0 ? 0 : Playback.Num() - 1];
+		OutGaze = Held.Gaze;
+		OutHead = Held.Head;
+		return OutGaze.bValid;
+	}
+
+	const FPlaybackSample& A = Playback[Next - 1];
+	const FPlaybackSample& B = Playback[Next];
+	const double Span = B.LocalSeconds - A.LocalSeconds;
+	const double Alpha = Span > UE_SMALL_NUMBER ? (RenderSeconds - A.LocalSeconds) / Span : 1.0;
+
+	// No blending across a validity change; the gaze jumps where tracking was lost or regained
+	OutGaze = Alpha < 0.5 ? A.Gaze : B.Gaze;
+	if (A.Gaze.bValid && B.Gaze.bValid)
+	{
+		OutGaze.Screen01 = FMath::Lerp(A.Gaze.Screen01, B.Gaze.Screen01, Alpha);
+		OutGaze.Confidence = FMath::Lerp(A.Gaze.Confidence, B.Gaze.Confidence, Alpha);
+	}
+	OutHead = B.Head;
+	OutHead.PositionCm = FMath::Lerp(A.Head.PositionCm, B.Head.PositionCm, Alpha);
+	OutHead.SetRotation(BeamRotation::Nlerp(A.Head.RotationQuat, B.Head.RotationQuat, Alpha));
+	OutHead.Confidence = FMath::Lerp(A.Head.Confidence, B.Head.Confidence, Alpha);
+	return OutGaze.bValid;
+}
@@ -0,0 +1,155 @@
+// Implements the gaze-driven texture streaming boost
+
+#include "BeamGazeStreamingSubsystem.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamEyeTrackerSettings.h"
+#include "BeamGazeTraceSubsystem.h"
+#include "BeamGazeViewExtension.h"
+#include "BeamRing.h"
+#include "Camera/PlayerCameraManager.h"
+#include "ContentStreaming.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+static TAutoConsoleVariable<bool> CVarBeamStreamingGazeBoost(
+	TEXT("beam.Streaming.GazeBoost"),
+	false,
+	TEXT("Prioritize texture streaming for the actor under the gaze"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarBeamStreamingBoostFactor(
+	TEXT("beam.Streaming.GazeBoostFactor"),
+	2.0f,
+	TEXT("Streaming boost for the gazed actor's view; 1 streams it as if seen from the hit point, higher asks for sharper mips"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarBeamStreamingHoldSeconds(
+	TEXT("beam.Streaming.GazeHoldSeconds"),
+	0.3f,
+	TEXT("Seconds the boost outlives the last gaze hit, so blinks and saccades across gaps do not drop it"),
+	ECVF_Default
+);
+
+namespace
+{
+	/** Latched samples older than this mean the extension stopped rendering views */
+	constexpr double MaxLatchedAgeSeconds = 0.1;
+}
+
+bool UBeamGazeStreamingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UBeamGazeStreamingSubsystem::Deinitialize()
+{
+	ReleaseFoveationUser();
+	Super::Deinitialize();
+}
+
+TStatId UBeamGazeStreamingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBeamGazeStreamingSubsystem, STATGROUP_Tickables);
+}
+
+void UBeamGazeStreamingSubsystem::ReleaseFoveationUser()
+{
+	if (UBeamEyeTrackerSubsystem* Owner = FoveationOwner.Get())
+	{
+		Owner->RemoveFoveationUser();
+	}
+	FoveationOwner.Reset();
+}
+
+bool UBeamGazeStreamingSubsystem::GetGazeScreen01(UBeamEyeTrackerSubsystem* Beam, FVector2D& OutScreen01) const
+{
+	const TSharedPtr<FBeamGazeViewExtension, ESPMode::ThreadSafe> Extension = Beam->GetGazeViewExtension();
+	if (Extension.IsValid() && Extension->GetLatchedGaze(OutScreen01, MaxLatchedAgeSeconds))
+	{
+		return true;
+	}
+
+	const FBeamFrameRing* Ring = Beam->GetFrameRing();
+	FBeamFrame Frame;
+	if (Ring && Ring->ReadLatest(Frame) && Frame.Gaze.bValid)
+	{
+		OutScreen01 = Frame.Gaze.Screen01;
+		return true;
+	}
+	return false;
+}
+
+void UBeamGazeStreamingSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	UBeamEyeTrackerSubsystem* Beam = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	if (!CVarBeamStreamingGazeBoost.GetValueOnGameThread() || !Beam)
+	{
+		ReleaseFoveationUser();
+		BoostedActor.Reset();
+		return;
+	}
+
+	if (!FoveationOwner.IsValid())
+	{
+		Beam->AddFoveationUser();
+		FoveationOwner = Beam;
+	}
+
+	APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	int32 ViewportX = 0;
+	int32 ViewportY = 0;
+	if (!PC || !PC->IsLocalController())
+	{
+		return;
+	}
+	PC->GetViewportSize(ViewportX, ViewportY);
+
+	// Queue this frame's ray; the hit arrives with next frame's batch
+	FVector2D Screen01;
+	FVector Origin;
+	FVector Direction;
+	if (ViewportX > 0 && ViewportY > 0 && GetGazeScreen01(Beam, Screen01)
+		&& Beam->DeprojectScreenPosition(PC, Screen01 * FVector2D(ViewportX, ViewportY), Origin, Direction))
+	{
+		if (UBeamGazeTraceSubsystem* Traces = GetWorld()->GetSubsystem<UBeamGazeTraceSubsystem>())
+		{
+			const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> RuntimeSettings = Beam->GetRuntimeSettings();
+			const float TraceDistance = RuntimeSettings ? RuntimeSettings->TraceDistance : GetDefault<UBeamEyeTrackerSettings>()->TraceDistance;
+			const FVector End = Origin + Direction * TraceDistance;
+			TWeakObjectPtr<UBeamGazeStreamingSubsystem> WeakThis(this);
+			Traces->RequestTrace(Origin, End, ECC_Visibility, [WeakThis](bool bHit, const FHitResult& Hit)
+			{
+				UBeamGazeStreamingSubsystem* This = WeakThis.Get();
+				if (This && bHit && Hit.GetActor())
+				{
+					This->BoostedActor = Hit.GetActor();
+					This->BoostLocation = Hit.ImpactPoint;
+					This->BoostHitSeconds = FPlatformTime::Seconds();
+				}
+			});
+		}
+	}
+
+	AActor* Target = BoostedActor.Get();
+	if (!Target || FPlatformTime::Seconds() - BoostHitSeconds > CVarBeamStreamingHoldSeconds.GetValueOnGameThread())
+	{
+		BoostedActor.Reset();
+		return;
+	}
+
+	// A one-frame view at the hit point, limited to the gazed actor: its textures are wanted as if seen
+	// up close, everything else keeps competing for the same pool from the camera's view alone
+	const float FOVDegrees = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetFOVAngle() : 90.0f;
+	const float ScreenSize = static_cast<float>(ViewportX);
+	const float FOVScreenSize = ScreenSize / FMath::Tan(FMath::DegreesToRadians(FOVDegrees * 0.5f));
+	IStreamingManager::Get().AddViewInformation(BoostLocation, ScreenSize, FOVScreenSize,
+		FMath::Max(CVarBeamStreamingBoostFactor.GetValueOnGameThread(), 0.1f), false, 0.0f, Target);
+}
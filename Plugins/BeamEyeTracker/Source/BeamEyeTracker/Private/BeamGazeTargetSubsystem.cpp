@@ -0,0 +1,331 @@
+// Implements the per-frame screen-space grid behind gaze target queries
+
+#include "BeamGazeTargetSubsystem.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
+#include "UnrealClient.h"
+
+// Targets spanning more cells than this go to the side list checked by every query
+#define BEAM_GAZE_TARGET_LARGE_CELLS 64
+
+void UBeamGazeTargetSubsystem::RegisterGazeTarget(AActor* Target)
+{
+	if (Target && !IsGazeTargetRegistered(Target))
+	{
+		Targets.Add(Target);
+		BuiltFrame = MAX_uint64;
+	}
+}
+
+void UBeamGazeTargetSubsystem::UnregisterGazeTarget(AActor* Target)
+{
+	if (Targets.RemoveSingleSwap(Target) > 0)
+	{
+		BuiltFrame = MAX_uint64;
+	}
+}
+
+bool UBeamGazeTargetSubsystem::IsGazeTargetRegistered(const AActor* Target) const
+{
+	return Target && Targets.Contains(Target);
+}
+
+AActor* UBeamGazeTargetSubsystem::GetClosestTargetToGaze(float MaxDistancePixels)
+{
+	FVector2f GazePx;
+	return GetGazeScreenPosition(GazePx) ? GetClosestTargetToPoint(GazePx, MaxDistancePixels) : nullptr;
+}
+
+bool UBeamGazeTargetSubsystem::IsGazeOnTarget(const AActor* Target, float MarginPixels)
+{
+	FVector2f GazePx;
+	return GetGazeScreenPosition(GazePx) && IsPointOnTarget(Target, GazePx, MarginPixels);
+}
+
+bool UBeamGazeTargetSubsystem::IsPointOnTarget(const AActor* Target, const FVector2f& ScreenPx, float MarginPixels)
+{
+	if (!Target)
+	{
+		return false;
+	}
+
+	// The rebuild compacts Targets, so the index is only looked up once it has run
+	EnsureBuilt();
+	const int32 TargetIndex = Targets.IndexOfByKey(Target);
+	if (TargetIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const int32 ScreenIndex = TargetToScreen.IsValidIndex(TargetIndex) ? TargetToScreen[TargetIndex] : INDEX_NONE;
+	return ScreenIndex != INDEX_NONE && DistanceToRect(ScreenTargets[ScreenIndex].Rect, ScreenPx) <= MarginPixels;
+}
+
+AActor* UBeamGazeTargetSubsystem::GetClosestTargetToPoint(const FVector2f& ScreenPx, float MaxDistancePixels)
+{
+	EnsureBuilt();
+	const int32 ScreenIndex = FindNearest(ScreenPx, FMath::Max(MaxDistancePixels, 0.0f));
+	return ScreenIndex != INDEX_NONE ? Targets[ScreenTargets[ScreenIndex].TargetIndex].Get() : nullptr;
+}
+
+bool UBeamGazeTargetSubsystem::GetGazeScreenPosition(FVector2f& OutScreenPx)
+{
+	EnsureBuilt();
+
+	UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	UBeamEyeTrackerSubsystem* Beam = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+
+	FBeamFrame Frame;
+	if (!bHasView || !Beam || !Beam->FetchCurrentFrame(Frame) || !Frame.Gaze.bValid)
+	{
+		return false;
+	}
+
+	return Screen01ToViewportPx(Frame.Gaze.Screen01, OutScreenPx);
+}
+
+bool UBeamGazeTargetSubsystem::Screen01ToViewportPx(const FVector2D& Screen01, FVector2f& OutScreenPx)
+{
+	EnsureBuilt();
+	if (!bHasView)
+	{
+		return false;
+	}
+
+	OutScreenPx = FVector2f(ViewRect.Min) + FVector2f(Screen01) * FVector2f(ViewRect.Size());
+	return true;
+}
+
+bool UBeamGazeTargetSubsystem::ForEachScreenTarget(TFunctionRef<void(AActor* Target, const FBox2f& ScreenRect, float Depth)> Visitor)
+{
+	EnsureBuilt();
+	if (!bHasView)
+	{
+		return false;
+	}
+
+	for (const FScreenTarget& Entry : ScreenTargets)
+	{
+		if (AActor* Actor = Targets[Entry.TargetIndex].Get())
+		{
+			Visitor(Actor, Entry.Rect, Entry.Depth);
+		}
+	}
+	return true;
+}
+
+bool UBeamGazeTargetSubsystem::GetViewRect(FIntRect& OutViewRect)
+{
+	EnsureBuilt();
+	OutViewRect = ViewRect;
+	return bHasView;
+}
+
+void UBeamGazeTargetSubsystem::EnsureBuilt()
+{
+	if (BuiltFrame != GFrameCounter)
+	{
+		Build();
+		BuiltFrame = GFrameCounter;
+	}
+}
+
+void UBeamGazeTargetSubsystem::Build()
+{
+	ScreenTargets.Reset();
+	LargeItems.Reset();
+	bHasView = false;
+
+	// Destroyed targets are dropped here rather than requiring every actor to unregister
+	Targets.RemoveAllSwap([](const TWeakObjectPtr<AActor>& Target) { return !Target.IsValid(); });
+	TargetToScreen.Init(INDEX_NONE, Targets.Num());
+
+	APlayerController* PC = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+	ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	FViewport* Viewport = LocalPlayer && LocalPlayer->ViewportClient ? LocalPlayer->ViewportClient->Viewport : nullptr;
+
+	FSceneViewProjectionData ProjectionData;
+	if (!Viewport || !LocalPlayer->GetProjectionData(Viewport, ProjectionData))
+	{
+		return;
+	}
+
+	bHasView = true;
+	ViewRect = ProjectionData.GetConstrainedViewRect();
+	const FMatrix ViewProjection = ProjectionData.ComputeViewProjectionMatrix();
+	const FVector ViewOrigin = ProjectionData.ViewOrigin;
+	const FBox2f Screen(FVector2f(ViewRect.Min), FVector2f(ViewRect.Max));
+	CellSize = FVector2f(ViewRect.Size()) / FVector2f(GridX, GridY);
+
+	// Project every target's bounds once
+	for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+	{
+		const AActor* Actor = Targets[TargetIndex].Get();
+		FVector Origin, Extent;
+		Actor->GetActorBounds(false, Origin, Extent);
+
+		FBox2f Rect(ForceInit);
+		bool bBehind = false;
+		for (int32 Corner = 0; Corner < 8 && !bBehind; ++Corner)
+		{
+			const FVector Point = Origin + Extent * FVector((Corner & 1) ? 1.0 : -1.0, (Corner & 2) ? 1.0 : -1.0, (Corner & 4) ? 1.0 : -1.0);
+			FVector2D Px;
+			if (FSceneView::ProjectWorldToScreen(Point, ViewRect, ViewProjection, Px))
+			{
+				Rect += FVector2f(Px);
+			}
+			else
+			{
+				bBehind = true;
+			}
+		}
+
+		// A box straddling the camera plane cannot be bounded by its corners; treat it as covering the view
+		if (bBehind)
+		{
+			const double ViewDepth = ViewProjection.TransformFVector4(FVector4(Origin, 1.0)).W;
+			if (ViewDepth < -Extent.Size())
+			{
+				continue;
+			}
+			Rect = Screen;
+		}
+
+		Rect = Rect.Overlap(Screen);
+		if (!Rect.IsValid || Rect.GetArea() <= 0.0f)
+		{
+			continue;
+		}
+
+		FScreenTarget& Entry = ScreenTargets.AddDefaulted_GetRef();
+		Entry.Rect = Rect;
+		Entry.Depth = static_cast<float>(FVector::Dist(Origin, ViewOrigin));
+		Entry.TargetIndex = TargetIndex;
+	}
+
+	for (int32 ScreenIndex = 0; ScreenIndex < ScreenTargets.Num(); ++ScreenIndex)
+	{
+		TargetToScreen[ScreenTargets[ScreenIndex].TargetIndex] = ScreenIndex;
+	}
+
+	// Counting sort of targets into the cells their rectangles overlap
+	auto CellRange = [this](const FBox2f& Rect, FIntPoint& OutMin, FIntPoint& OutMax)
+	{
+		const FVector2f Min = (Rect.Min - FVector2f(ViewRect.Min)) / CellSize;
+		const FVector2f Max = (Rect.Max - FVector2f(ViewRect.Min)) / CellSize;
+		OutMin = FIntPoint(FMath::Clamp(FMath::FloorToInt32(Min.X), 0, GridX - 1), FMath::Clamp(FMath::FloorToInt32(Min.Y), 0, GridY - 1));
+		OutMax = FIntPoint(FMath::Clamp(FMath::FloorToInt32(Max.X), 0, GridX - 1), FMath::Clamp(FMath::FloorToInt32(Max.Y), 0, GridY - 1));
+	};
+
+	CellStart.Init(0, GridX * GridY + 1);
+	for (int32 ScreenIndex = 0; ScreenIndex < ScreenTargets.Num(); ++ScreenIndex)
+	{
+		FIntPoint Min, Max;
+		CellRange(ScreenTargets[ScreenIndex].Rect, Min, Max);
+		if ((Max.X - Min.X + 1) * (Max.Y - Min.Y + 1) > BEAM_GAZE_TARGET_LARGE_CELLS)
+		{
+			LargeItems.Add(ScreenIndex);
+			continue;
+		}
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 X = Min.X; X <= Max.X; ++X)
+			{
+				++CellStart[Y * GridX + X + 1];
+			}
+		}
+	}
+	for (int32 Cell = 0; Cell < GridX * GridY; ++Cell)
+	{
+		CellStart[Cell + 1] += CellStart[Cell];
+	}
+
+	CellItems.SetNumUninitialized(CellStart.Last(), EAllowShrinking::No);
+	TArray<int32, TInlineAllocator<GridX * GridY>> Cursor;
+	Cursor.Append(CellStart.GetData(), GridX * GridY);
+	for (int32 ScreenIndex = 0; ScreenIndex < ScreenTargets.Num(); ++ScreenIndex)
+	{
+		FIntPoint Min, Max;
+		CellRange(ScreenTargets[ScreenIndex].Rect, Min, Max);
+		if ((Max.X - Min.X + 1) * (Max.Y - Min.Y + 1) > BEAM_GAZE_TARGET_LARGE_CELLS)
+		{
+			continue;
+		}
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 X = Min.X; X <= Max.X; ++X)
+			{
+				CellItems[Cursor[Y * GridX + X]++] = ScreenIndex;
+			}
+		}
+	}
+
+	VisitStamp.Init(0, ScreenTargets.Num());
+	CurrentStamp = 0;
+}
+
+int32 UBeamGazeTargetSubsystem::FindNearest(const FVector2f& ScreenPx, float MaxDistancePixels)
+{
+	if (!bHasView || ScreenTargets.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	++CurrentStamp;
+	int32 Best = INDEX_NONE;
+	float BestDistance = MaxDistancePixels;
+	float BestDepth = TNumericLimits<float>::Max();
+
+	auto Consider = [&](int32 ScreenIndex)
+	{
+		if (VisitStamp[ScreenIndex] == CurrentStamp)
+		{
+			return;
+		}
+		VisitStamp[ScreenIndex] = CurrentStamp;
+
+		const FScreenTarget& Entry = ScreenTargets[ScreenIndex];
+		const float Distance = DistanceToRect(Entry.Rect, ScreenPx);
+		if (Distance < BestDistance || (Distance <= BestDistance && Entry.Depth < BestDepth))
+		{
+			Best = ScreenIndex;
+			BestDistance = Distance;
+			BestDepth = Entry.Depth;
+		}
+	};
+
+	for (int32 ScreenIndex : LargeItems)
+	{
+		Consider(ScreenIndex);
+	}
+
+	const FVector2f Local = ScreenPx - FVector2f(ViewRect.Min);
+	const int32 MinX = FMath::Clamp(FMath::FloorToInt32((Local.X - MaxDistancePixels) / CellSize.X), 0, GridX - 1);
+	const int32 MaxX = FMath::Clamp(FMath::FloorToInt32((Local.X + MaxDistancePixels) / CellSize.X), 0, GridX - 1);
+	const int32 MinY = FMath::Clamp(FMath::FloorToInt32((Local.Y - MaxDistancePixels) / CellSize.Y), 0, GridY - 1);
+	const int32 MaxY = FMath::Clamp(FMath::FloorToInt32((Local.Y + MaxDistancePixels) / CellSize.Y), 0, GridY - 1);
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			const int32 Cell = Y * GridX + X;
+			for (int32 Item = CellStart[Cell]; Item < CellStart[Cell + 1]; ++Item)
+			{
+				Consider(CellItems[Item]);
+			}
+		}
+	}
+	return Best;
+}
+
+float UBeamGazeTargetSubsystem::DistanceToRect(const FBox2f& Rect, const FVector2f& Point)
+{
+	const float DX = FMath::Max3(Rect.Min.X - Point.X, 0.0f, Point.X - Rect.Max.X);
+	const float DY = FMath::Max3(Rect.Min.Y - Point.Y, 0.0f, Point.Y - Rect.Max.Y);
+	return FMath::Sqrt(DX * DX + DY * DY);
+}
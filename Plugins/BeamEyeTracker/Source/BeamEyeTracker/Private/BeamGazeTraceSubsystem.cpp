@@ -0,0 +1,183 @@
+// Implements the per-world batched asynchronous gaze trace service
+
+#include "BeamGazeTraceSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "BeamStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Gaze Trace Batch"), STAT_BeamGazeTraceBatch, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("Gaze Trace"), STAT_BeamGazeTrace, STATGROUP_Beam);
+
+// Origin and direction tolerance for reusing a recent result with a slightly different ray
+#define BEAM_GAZE_TRACE_ORIGIN_TOLERANCE_CM 5.0
+#define BEAM_GAZE_TRACE_MIN_DIRECTION_DOT 0.99985
+
+void UBeamGazeTraceSubsystem::Deinitialize()
+{
+	// Pending callbacks may capture objects from the world being torn down, so they are dropped, not fired
+	Pending.Reset();
+	PendingIndex.Reset();
+	InFlight.Reset();
+	Completed.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UBeamGazeTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBeamGazeTraceSubsystem, STATGROUP_Tickables);
+}
+
+UBeamGazeTraceSubsystem::FRayKey UBeamGazeTraceSubsystem::MakeKey(const FVector& Start, const FVector& End, ECollisionChannel Channel)
+{
+	auto Quantize = [](const FVector& V)
+	{
+		return FIntVector(FMath::RoundToInt32(V.X * 10.0), FMath::RoundToInt32(V.Y * 10.0), FMath::RoundToInt32(V.Z * 10.0));
+	};
+	return FRayKey{ Quantize(Start), Quantize(End), static_cast<uint8>(Channel) };
+}
+
+void UBeamGazeTraceSubsystem::RequestTrace(const FVector& Start, const FVector& End, ECollisionChannel Channel, FBeamGazeTraceCallback&& Callback)
+{
+	const FRayKey Key = MakeKey(Start, End, Channel);
+	int32 Index;
+	if (const int32* Existing = PendingIndex.Find(Key))
+	{
+		Index = *Existing;
+	}
+	else
+	{
+		Index = Pending.AddDefaulted();
+		Pending[Index].Start = Start;
+		Pending[Index].End = End;
+		Pending[Index].Channel = Channel;
+		PendingIndex.Add(Key, Index);
+	}
+
+	if (Callback)
+	{
+		Pending[Index].Callbacks.Add(MoveTemp(Callback));
+	}
+	++RequestsServed;
+}
+
+void UBeamGazeTraceSubsystem::RequestGazeTrace(const FVector& Start, const FVector& End, ECollisionChannel Channel, FOnBeamGazeTraceResult OnResult)
+{
+	RequestTrace(Start, End, Channel, [OnResult](bool bHit, const FHitResult& HitResult)
+	{
+		OnResult.ExecuteIfBound(bHit, HitResult);
+	});
+}
+
+void UBeamGazeTraceSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamGazeTraceBatch);
+	Super::Tick(DeltaTime);
+
+	// Last tick's batch has resolved by now; keep the finished traces as the cache
+	if (InFlight.Num() > 0)
+	{
+		Completed.Reset();
+		for (FTrace& Trace : InFlight)
+		{
+			if (Trace.bDone)
+			{
+				Trace.Callbacks.Reset();
+				Completed.Add(MoveTemp(Trace));
+			}
+		}
+		InFlight.Reset();
+	}
+
+	if (Pending.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!TraceDelegate.IsBound())
+	{
+		TraceDelegate.BindUObject(this, &UBeamGazeTraceSubsystem::HandleTraceDone);
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BeamGazeTrace), false);
+	QueryParams.bReturnPhysicalMaterial = false;
+
+	Swap(InFlight, Pending);
+	PendingIndex.Reset();
+	for (int32 Index = 0; Index < InFlight.Num(); ++Index)
+	{
+		const FTrace& Trace = InFlight[Index];
+		const FTraceHandle Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Trace.Start, Trace.End, Trace.Channel, QueryParams,
+			FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, static_cast<uint32>(Index));
+		InFlightTraceFrame = Handle._Data.FrameNumber;
+	}
+	TracesIssued += InFlight.Num();
+}
+
+void UBeamGazeTraceSubsystem::HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	// UserData indexes the batch of the trace frame it was submitted in
+	if (Handle._Data.FrameNumber != InFlightTraceFrame || !InFlight.IsValidIndex(static_cast<int32>(Datum.UserData)))
+	{
+		return;
+	}
+
+	FTrace& Trace = InFlight[Datum.UserData];
+	Trace.bHit = Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit;
+	Trace.Hit = Trace.bHit ? Datum.OutHits[0] : FHitResult(Trace.Start, Trace.End);
+	Trace.bDone = true;
+
+	// Callbacks may queue new traces, which only touches Pending
+	for (FBeamGazeTraceCallback& Callback : Trace.Callbacks)
+	{
+		Callback(Trace.bHit, Trace.Hit);
+	}
+}
+
+bool UBeamGazeTraceSubsystem::FindRecentResult(const FVector& Start, const FVector& End, ECollisionChannel Channel, bool& bOutHit, FHitResult& OutHit) const
+{
+	const FVector Direction = (End - Start).GetSafeNormal();
+	const double Length = FVector::Dist(Start, End);
+
+	for (const FTrace& Trace : Completed)
+	{
+		if (Trace.Channel != Channel
+			|| FVector::DistSquared(Trace.Start, Start) > FMath::Square(BEAM_GAZE_TRACE_ORIGIN_TOLERANCE_CM)
+			|| FVector::DotProduct((Trace.End - Trace.Start).GetSafeNormal(), Direction) < BEAM_GAZE_TRACE_MIN_DIRECTION_DOT)
+		{
+			continue;
+		}
+
+		// A hit beyond the caller's trace length is a miss for that caller
+		bOutHit = Trace.bHit && Trace.Hit.Distance <= Length;
+		OutHit = bOutHit ? Trace.Hit : FHitResult(Start, End);
+		return true;
+	}
+	return false;
+}
+
+bool UBeamGazeTraceSubsystem::GazeTrace(const UObject* WorldContextObject, const FVector& Start, const FVector& End, ECollisionChannel Channel, FHitResult& OutHit)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamGazeTrace);
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	if (!World)
+	{
+		return false;
+	}
+
+	UBeamGazeTraceSubsystem* Traces = World->GetSubsystem<UBeamGazeTraceSubsystem>();
+	if (Traces)
+	{
+		Traces->RequestTrace(Start, End, Channel, nullptr);
+
+		bool bHit = false;
+		if (Traces->FindRecentResult(Start, End, Channel, bHit, OutHit))
+		{
+			return bHit;
+		}
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BeamGazeTrace), false);
+	return World->LineTraceSingleByChannel(OutHit, Start, End, Channel, QueryParams);
+}
@@ -0,0 +1,122 @@
+// Implements the ring-backed gaze trail and its single-batch triangle strip
+
+#include "BeamGazeTrail.h"
+#include "CanvasItem.h"
+#include "CanvasTypes.h"
+#include "Engine/Canvas.h"
+#include "TextureResource.h"
+
+FBeamGazeTrail::FBeamGazeTrail(int32 InCapacity)
+{
+	SetCapacity(InCapacity);
+}
+
+FBeamGazeTrail::~FBeamGazeTrail() = default;
+
+void FBeamGazeTrail::SetCapacity(int32 InCapacity)
+{
+	const int32 NewCapacity = FMath::Max(InCapacity, 2);
+	if (NewCapacity != Points.Num())
+	{
+		Points.SetNumZeroed(NewCapacity);
+		Triangles.Reserve((NewCapacity - 1) * 2);
+		Reset();
+	}
+}
+
+void FBeamGazeTrail::AddPoint(const FVector2D& Point)
+{
+	Points[Head] = Point;
+	Head = (Head + 1) % Points.Num();
+	Count = FMath::Min(Count + 1, Points.Num());
+}
+
+void FBeamGazeTrail::Reset()
+{
+	Head = 0;
+	Count = 0;
+}
+
+const FVector2D& FBeamGazeTrail::GetPoint(int32 Index) const
+{
+	check(Index >= 0 && Index < Count);
+	const int32 Capacity = Points.Num();
+	return Points[(Head - Count + Index + Capacity) % Capacity];
+}
+
+void FBeamGazeTrail::Draw(FCanvas* Canvas, const FLinearColor& Color, float Thickness) const
+{
+	DrawPolyline(Canvas, [this](int32 Index) { return GetPoint(Index); }, Count, Color, Thickness, Triangles);
+}
+
+void FBeamGazeTrail::DrawPolyline(FCanvas* Canvas, TFunctionRef<FVector2D(int32)> GetPointAt, int32 NumPoints,
+	const FLinearColor& Color, float Thickness, TArray<FCanvasUVTri>& Scratch)
+{
+	if (!Canvas)
+	{
+		return;
+	}
+
+	Scratch.Reset();
+	AppendPolyline(GetPointAt, NumPoints, Color, Thickness, Scratch);
+	if (Scratch.Num() == 0)
+	{
+		return;
+	}
+
+	FCanvasTriangleItem TriangleItem(Scratch, GWhiteTexture);
+	TriangleItem.BlendMode = SE_BLEND_Translucent;
+	Canvas->DrawItem(TriangleItem);
+}
+
+void FBeamGazeTrail::AppendPolyline(TFunctionRef<FVector2D(int32)> GetPointAt, int32 NumPoints,
+	const FLinearColor& Color, float Thickness, TArray<FCanvasUVTri>& OutTriangles)
+{
+	if (NumPoints < 2)
+	{
+		return;
+	}
+
+	const float InvLast = 1.0f / static_cast<float>(NumPoints - 1);
+
+	FVector2D Prev = GetPointAt(0);
+	float PrevWeight = 0.0f;
+	for (int32 Index = 1; Index < NumPoints; ++Index)
+	{
+		const FVector2D Cur = GetPointAt(Index);
+		const float CurWeight = static_cast<float>(Index) * InvLast;
+
+		// Repeated samples during a fixation add no segment; the next one still starts from here
+		const FVector2D Delta = Cur - Prev;
+		const double Length = Delta.Size();
+		if (Length < UE_KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		const FVector2D Normal = FVector2D(-Delta.Y, Delta.X) / Length;
+		const FVector2D PrevOffset = Normal * (0.5f * Thickness * PrevWeight);
+		const FVector2D CurOffset = Normal * (0.5f * Thickness * CurWeight);
+		const FLinearColor PrevColor(Color.R, Color.G, Color.B, Color.A * PrevWeight);
+		const FLinearColor CurColor(Color.R, Color.G, Color.B, Color.A * CurWeight);
+
+		FCanvasUVTri& First = OutTriangles.AddDefaulted_GetRef();
+		First.V0_Pos = Prev + PrevOffset;
+		First.V1_Pos = Prev - PrevOffset;
+		First.V2_Pos = Cur + CurOffset;
+		First.V0_Color = PrevColor;
+		First.V1_Color = PrevColor;
+		First.V2_Color = CurColor;
+
+		FCanvasUVTri& Second = OutTriangles.AddDefaulted_GetRef();
+		Second.V0_Pos = Prev - PrevOffset;
+		Second.V1_Pos = Cur - CurOffset;
+		Second.V2_Pos = Cur + CurOffset;
+		Second.V0_Color = PrevColor;
+		Second.V1_Color = CurColor;
+		Second.V2_Color = CurColor;
+
+		Prev = Cur;
+		PrevWeight = CurWeight;
+	}
+}
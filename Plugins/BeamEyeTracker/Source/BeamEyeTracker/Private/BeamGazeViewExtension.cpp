@@ -0,0 +1,328 @@
+// Implements the render-thread gaze sampler that feeds foveation parameters
+
+#include "BeamGazeViewExtension.h"
+#include "BeamLatency.h"
+#include "BeamFoveationShaders.h"
+#include "HAL/PlatformTime.h"
+#include "SceneView.h"
+#include "RenderingThread.h"
+#include "RenderGraphBuilder.h"
+#include "RHIGlobals.h"
+#include "VariableRateShadingImageManager.h"
+
+namespace
+{
+	// Render frames a view may go without rendering before its shading rate image is released
+	constexpr uint64 ShadingRateImageKeepFrames = 60;
+
+	/**
+	 * Hands the attached extension's per-view images to the renderer's VRS image manager. Registered
+	 * once and never unregistered, so it outlives every extension; it only holds a weak reference to
+	 * the one that last rendered, and all of its state is render thread only.
+	 */
+	class FBeamShadingRateImageGenerator : public IVariableRateShadingImageGenerator
+	{
+	public:
+		TWeakPtr<FBeamGazeViewExtension, ESPMode::ThreadSafe> Extension;
+
+		virtual FRDGTextureRef GetImage(FRDGBuilder& GraphBuilder, const FViewInfo& ViewInfo, FVariableRateShadingImageManager::EVRSImageType ImageType) override
+		{
+			const TSharedPtr<FBeamGazeViewExtension, ESPMode::ThreadSafe> Pinned = Extension.Pin();
+			if (!Pinned.IsValid() || ImageType == FVariableRateShadingImageManager::EVRSImageType::Disabled)
+			{
+				return nullptr;
+			}
+			return Pinned->GetShadingRateImage_RenderThread(GraphBuilder, AsSceneView(ViewInfo));
+		}
+
+		virtual void PrepareImages(FRDGBuilder& GraphBuilder, const FSceneViewFamily& ViewFamily, const FMinimalSceneTextures& SceneTextures) override
+		{
+			// Built per view in PreRenderView_RenderThread, where the latched gaze is
+		}
+
+		virtual bool IsEnabled() const override
+		{
+			return Extension.IsValid();
+		}
+
+		virtual bool IsSupportedByView(const FSceneView& View) const override
+		{
+			const TSharedPtr<FBeamGazeViewExtension, ESPMode::ThreadSafe> Pinned = Extension.Pin();
+			return Pinned.IsValid() && Pinned->GetShadingRateImage_RenderThread(View).IsValid();
+		}
+
+		virtual FVariableRateShadingImageManager::EVRSSourceType GetType() const override
+		{
+			return FVariableRateShadingImageManager::EVRSSourceType::EyeTrackedFoveation;
+		}
+
+		virtual FRDGTextureRef GetDebugImage(FRDGBuilder& GraphBuilder, const FViewInfo& ViewInfo, FVariableRateShadingImageManager::EVRSImageType ImageType) override
+		{
+			return GetImage(GraphBuilder, ViewInfo, ImageType);
+		}
+
+	private:
+		// FViewInfo is private to the renderer; its only base is FSceneView, so the addresses match
+		static const FSceneView& AsSceneView(const FViewInfo& ViewInfo)
+		{
+			return reinterpret_cast<const FSceneView&>(ViewInfo);
+		}
+	};
+
+	FBeamShadingRateImageGenerator GBeamShadingRateImageGenerator;
+
+	/** Makes Extension the one whose images the renderer binds; registers the generator on first use (render thread) */
+	void SetShadingRateImageSource(const TSharedPtr<FBeamGazeViewExtension, ESPMode::ThreadSafe>& Extension)
+	{
+		static bool bRegistered = false;
+		if (!bRegistered && Extension.IsValid())
+		{
+			GVRSImageManager.RegisterExternalImageGenerator(&GBeamShadingRateImageGenerator);
+			bRegistered = true;
+		}
+		GBeamShadingRateImageGenerator.Extension = Extension;
+	}
+
+	uint32 FloatBits(float Value)
+	{
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	float BitsFloat(uint32 Bits)
+	{
+		float Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+}
+
+FBeamGazeViewExtension::FBeamGazeViewExtension(const FAutoRegister& AutoRegister, const FBeamFrameRing* InRing, const FBeamFoveationConfig& InConfig)
+	: FSceneViewExtensionBase(AutoRegister)
+	, Ring(InRing)
+	, Config(InConfig)
+	, RenderPredictor(InConfig.PredictorParams)
+{
+	RenderScratch.Reserve(16);
+}
+
+bool FBeamGazeViewExtension::IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const
+{
+	return Ring.load(std::memory_order_acquire) != nullptr;
+}
+
+void FBeamGazeViewExtension::SetGazeWorldRay(const FBeamWorldRay& Ray)
+{
+	check(IsInGameThread());
+
+	// The command holds a reference so a release racing the queue cannot free the extension under it
+	TSharedRef<FBeamGazeViewExtension, ESPMode::ThreadSafe> Self = StaticCastSharedRef<FBeamGazeViewExtension>(AsShared());
+	ENQUEUE_RENDER_COMMAND(BeamSetGazeWorldRay)([Self, Ray](FRHICommandListImmediate&)
+	{
+		Self->GazeWorldRay = Ray;
+	});
+}
+
+bool FBeamGazeViewExtension::GetLatestFrame_RenderThread(FBeamFrame& OutFrame) const
+{
+	const FBeamFrameRing* CurrentRing = Ring.load(std::memory_order_acquire);
+	return CurrentRing && CurrentRing->ReadLatest(OutFrame);
+}
+
+void FBeamGazeViewExtension::PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView)
+{
+	check(IsInRenderingThread());
+
+	LatestFoveation.bValid = false;
+
+	const FBeamFrameRing* CurrentRing = Ring.load(std::memory_order_acquire);
+	if (!CurrentRing)
+	{
+		return;
+	}
+
+	// Catch the render-thread predictor up on everything published since the previous view, scoring the
+	// previous prediction against the first real sample that reached its target time
+	CurrentRing->CopyLatestFrames(16, RenderScratch);
+	const int64 LastFrameId = RenderPredictor.GetLastFrameId();
+	for (const FBeamFrame& Frame : RenderScratch)
+	{
+		if (Frame.FrameId <= LastFrameId)
+		{
+			continue;
+		}
+		if (PendingPredictionMs >= 0.0 && Frame.SDKTimestampMs >= PendingPredictionMs && Frame.Gaze.bValid)
+		{
+			const double Error = FVector2D::Distance(Frame.Gaze.Screen01, PendingPrediction01);
+			PredictionError01 += (Error - PredictionError01) * 0.1;
+			PendingPredictionMs = -1.0;
+		}
+		RenderPredictor.AddSample(Frame);
+	}
+
+	const FIntRect ViewRect = InView.UnscaledViewRect;
+	const FVector2f ViewSize(ViewRect.Width(), ViewRect.Height());
+
+	// Only the GPU and present remain between here and scan-out
+	FBeamFrame Predicted;
+	bool bPredicted = false;
+	if (RenderScratch.Num() > 0)
+	{
+		const FBeamFrame& Newest = RenderScratch.Last();
+		GBeamLatency.NoteRendered(Newest, FPlatformTime::Seconds());
+		const double HorizonMs = FBeamGazePredictor::GetDisplayHorizonMs(Newest.UETimestampSeconds, Config.RenderLatencyFrames);
+		bPredicted = RenderPredictor.Predict(HorizonMs, Predicted) && Predicted.Gaze.bValid;
+	}
+
+	const EBeamHealth CurrentHealth = Health.load(std::memory_order_relaxed);
+	const bool bTracking = bPredicted && (CurrentHealth == EBeamHealth::Ok || CurrentHealth == EBeamHealth::Warning || CurrentHealth == EBeamHealth::Recovering);
+
+	if (bTracking)
+	{
+		// Uncertain gaze widens the fovea: low confidence scales it, measured prediction error pads it
+		const float Confidence = FMath::Clamp(static_cast<float>(Predicted.Gaze.Confidence), 0.0f, 1.0f);
+		float Scale = 1.0f + Config.ConfidenceExpansion * (1.0f - Confidence);
+		if (CurrentHealth != EBeamHealth::Ok)
+		{
+			Scale *= Config.FallbackRadiusScale;
+		}
+		const float ErrorPx = Config.PredictionErrorScale * static_cast<float>(PredictionError01) * ViewSize.X;
+
+		LatestFoveation.CenterUV = FVector2f(Predicted.Gaze.Screen01);
+		LatestFoveation.CenterPx = FVector2f(ViewRect.Min) + LatestFoveation.CenterUV * ViewSize;
+		for (int32 i = 0; i < BEAM_FOVEATION_NUM_RADII; ++i)
+		{
+			LatestFoveation.RadiiPx[i] = Config.NormalizedRadii[i] * ViewSize.X * Scale + ErrorPx;
+		}
+		LatestFoveation.SampleTimestampMs = Predicted.SDKTimestampMs;
+		LatestFoveation.bValid = true;
+
+		if (PendingPredictionMs < 0.0)
+		{
+			PendingPredictionMs = Predicted.SDKTimestampMs;
+			PendingPrediction01 = Predicted.Gaze.Screen01;
+		}
+
+		const uint64 Bits = (static_cast<uint64>(FloatBits(LatestFoveation.CenterUV.Y)) << 32) | FloatBits(LatestFoveation.CenterUV.X);
+		LatchedGazeBits.store(Bits, std::memory_order_relaxed);
+		LatchedAtSeconds.store(FPlatformTime::Seconds(), std::memory_order_release);
+	}
+
+	if (Config.bBuildShadingRateImage && BeamFoveationShaders::IsShadingRateImageSupported())
+	{
+		AddShadingRateImage(GraphBuilder, InView, ViewRect, bTracking, CurrentHealth == EBeamHealth::Ok);
+
+		// View families render one after another, so the extension that prepared this family's views is the one bound
+		SetShadingRateImageSource(StaticCastSharedRef<FBeamGazeViewExtension>(AsShared()));
+	}
+	else
+	{
+		ShadingRateImages.Reset();
+	}
+}
+
+TRefCountPtr<IPooledRenderTarget> FBeamGazeViewExtension::GetShadingRateImage_RenderThread(const FSceneView& View) const
+{
+	const TUniquePtr<FViewShadingRateImage>* Found = ShadingRateImages.Find(View.GetViewKey());
+	return Found ? (*Found)->Image : TRefCountPtr<IPooledRenderTarget>();
+}
+
+FRDGTextureRef FBeamGazeViewExtension::GetShadingRateImage_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View) const
+{
+	const TUniquePtr<FViewShadingRateImage>* Found = ShadingRateImages.Find(View.GetViewKey());
+	if (!Found)
+	{
+		return nullptr;
+	}
+
+	const FViewShadingRateImage& Entry = **Found;
+	if (Entry.Graph == &GraphBuilder && Entry.LastFrame == GFrameCounterRenderThread)
+	{
+		return Entry.GraphImage;
+	}
+	return Entry.Image.IsValid() ? GraphBuilder.RegisterExternalTexture(Entry.Image) : nullptr;
+}
+
+void FBeamGazeViewExtension::AddShadingRateImage(FRDGBuilder& GraphBuilder, const FSceneView& View, const FIntRect& ViewRect, bool bTracking, bool bHealthy)
+{
+	const FVector2f ViewSize(ViewRect.Width(), ViewRect.Height());
+	const EVRSShadingRate Coarsest = GRHISupportsLargerVariableRateShadingSizes ? VRSSR_4x4 : VRSSR_2x2;
+
+	FBeamShadingRatePassParams Params;
+	if (bTracking)
+	{
+		Params.CenterPx = LatestFoveation.CenterPx;
+		for (int32 i = 0; i < BEAM_FOVEATION_NUM_RADII; ++i)
+		{
+			Params.RadiiPx[i] = LatestFoveation.RadiiPx[i];
+		}
+	}
+	else
+	{
+		// Tracking lost: fixed foveation around the view center, wide enough that wherever the player looks is acceptable
+		Params.CenterPx = FVector2f(ViewRect.Min) + ViewSize * 0.5f;
+		for (int32 i = 0; i < BEAM_FOVEATION_NUM_RADII; ++i)
+		{
+			Params.RadiiPx[i] = Config.NormalizedRadii[i] * ViewSize.X * Config.FallbackRadiusScale;
+		}
+	}
+
+	// Full, half, quarter, lowest; anything short of healthy tracking stops at quarter rate
+	Params.Rates[0] = VRSSR_1x1;
+	Params.Rates[1] = VRSSR_2x1;
+	Params.Rates[2] = VRSSR_2x2;
+	Params.Rates[3] = bTracking && bHealthy ? Coarsest : VRSSR_2x2;
+
+	FRDGTextureRef Image = BeamFoveationShaders::AddShadingRateImagePass(GraphBuilder, ViewRect.Max, Params);
+
+	// Views that stopped rendering (closed split screen, destroyed captures) let go of their images
+	const uint64 Frame = GFrameCounterRenderThread;
+	for (auto It = ShadingRateImages.CreateIterator(); It; ++It)
+	{
+		if (Frame - It.Value()->LastFrame > ShadingRateImageKeepFrames)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TUniquePtr<FViewShadingRateImage>& Entry = ShadingRateImages.FindOrAdd(View.GetViewKey());
+	if (!Entry)
+	{
+		Entry = MakeUnique<FViewShadingRateImage>();
+	}
+	Entry->LastFrame = Frame;
+	Entry->GraphImage = Image;
+	Entry->Graph = &GraphBuilder;
+	GraphBuilder.QueueTextureExtraction(Image, &Entry->Image);
+}
+
+bool FBeamGazeViewExtension::GetLatchedGaze(FVector2D& OutScreen01, double MaxAgeSeconds) const
+{
+	const double LatchedAt = LatchedAtSeconds.load(std::memory_order_acquire);
+	if (LatchedAt <= 0.0 || FPlatformTime::Seconds() - LatchedAt > MaxAgeSeconds)
+	{
+		return false;
+	}
+
+	const uint64 Bits = LatchedGazeBits.load(std::memory_order_relaxed);
+	OutScreen01 = FVector2D(BitsFloat(static_cast<uint32>(Bits)), BitsFloat(static_cast<uint32>(Bits >> 32)));
+	return true;
+}
+
+void FBeamGazeViewExtension::SetHealth(EBeamHealth InHealth)
+{
+	Health.store(InHealth, std::memory_order_relaxed);
+}
+
+void FBeamGazeViewExtension::Detach()
+{
+	check(IsInGameThread());
+	Ring.store(nullptr, std::memory_order_release);
+
+	// The owner's flush retires this before the extension goes; the next extension to render takes over
+	ENQUEUE_RENDER_COMMAND(BeamDetachShadingRateImages)([](FRHICommandListImmediate&)
+	{
+		SetShadingRateImageSource(nullptr);
+	});
+}
@@ -7,6 +7,10 @@
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "BeamLogging.h"
+#include "BeamStats.h"
+#include "BeamWidgetUpdates.h"
+
+DECLARE_CYCLE_STAT(TEXT("Gaze Widget Tick"), STAT_BeamGazeWidgetTick, STATGROUP_Beam);
 
 UBeamGazeWidget::UBeamGazeWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -46,9 +50,17 @@ void UBeamGazeWidget::NativeConstruct()
     UpdateWidget();
 }
 
+TSharedRef<SWidget> UBeamGazeWidget::RebuildWidget()
+{
+    TSharedRef<SWidget> Content = Super::RebuildWidget();
+    return bLowOverheadUpdates ? BeamWidgetUpdates::WrapInInvalidationPanel(Content) : Content;
+}
+
 void UBeamGazeWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_BeamGazeWidgetTick);
     Super::NativeTick(MyGeometry, InDeltaTime);
+    CachedLocalSize = MyGeometry.GetLocalSize();
     
     if (ShouldUpdate())
     {
@@ -156,14 +168,13 @@ void UBeamGazeWidget::UpdateWidget()
     }
 
     UpdateGazeIndicator();
-    UpdateStatusText();
-    UpdateCalibrationQuality();
-    UpdateFPSDisplay();
-    UpdateConfidenceDisplay();
-    UpdateHeadPoseInfo();
-    UpdateGazeCoordinates();
-    UpdatePerformanceMetrics();
-    UpdateErrorDisplay();
+
+    // Text formatting dominates the update cost; in low-overhead mode it runs at its own, lower rate
+    if (!bLowOverheadUpdates || ShouldUpdateText())
+    {
+        UpdateTextFields();
+        LastTextUpdateTime = GetWorld()->GetTimeSeconds();
+    }
     
     // Call Blueprint events
     if (PreviousStatus != CurrentTrackingStatus)
@@ -179,6 +190,18 @@ void UBeamGazeWidget::UpdateWidget()
     }
 }
 
+void UBeamGazeWidget::UpdateTextFields()
+{
+    UpdateStatusText();
+    UpdateCalibrationQuality();
+    UpdateFPSDisplay();
+    UpdateConfidenceDisplay();
+    UpdateHeadPoseInfo();
+    UpdateGazeCoordinates();
+    UpdatePerformanceMetrics();
+    UpdateErrorDisplay();
+}
+
 void UBeamGazeWidget::UpdateGazeIndicator()
 {
     if (!GazeIndicator)
@@ -186,34 +209,31 @@ void UBeamGazeWidget::UpdateGazeIndicator()
         return;
     }
     
-    // Position gaze indicator based on current gaze point
-    if (CurrentTrackingStatus == EBeamWidgetStatus::Tracking)
-    {
-        // Convert normalized coordinates to screen position
-        FVector2D ScreenPosition = CurrentGazePoint;
+    const bool bShown = CurrentTrackingStatus == EBeamWidgetStatus::Tracking;
 
-        GazeIndicator->SetVisibility(ESlateVisibility::Visible);
-        
-        // You could also animate the indicator or change its appearance based on confidence
-        if (CurrentConfidence > 0.7f)
-        {
-            // High confidence - solid indicator
-            GazeIndicator->SetColorAndOpacity(FLinearColor::Green);
-        }
-        else if (CurrentConfidence > 0.4f)
-        {
-            // Medium confidence - yellow indicator
-            GazeIndicator->SetColorAndOpacity(FLinearColor::Yellow);
-        }
-        else
-        {
-            // Low confidence - red indicator
-            GazeIndicator->SetColorAndOpacity(FLinearColor::Red);
-        }
+    // Low-overhead mode never touches visibility, which would invalidate layout
+    if (bLowOverheadUpdates)
+    {
+        BeamWidgetUpdates::SetShownByOpacity(GazeIndicator, bShown);
     }
     else
     {
-        GazeIndicator->SetVisibility(ESlateVisibility::Hidden);
+        BeamWidgetUpdates::SetVisibilityIfChanged(GazeIndicator, bShown ? ESlateVisibility::Visible : ESlateVisibility::Hidden);
+    }
+
+    if (bShown)
+    {
+        // The indicator is laid out at the widget's top-left corner and centred on the gaze point by render transform
+        const FVector2D ScreenPosition = CurrentGazePoint * CachedLocalSize - GazeIndicator->GetDesiredSize() * 0.5f;
+        BeamWidgetUpdates::SetTranslationIfChanged(GazeIndicator, ScreenPosition);
+
+        // High confidence green, medium yellow, low red
+        const FLinearColor IndicatorColor = CurrentConfidence > 0.7f ? FLinearColor::Green
+            : (CurrentConfidence > 0.4f ? FLinearColor::Yellow : FLinearColor::Red);
+        if (GazeIndicator->GetColorAndOpacity() != IndicatorColor)
+        {
+            GazeIndicator->SetColorAndOpacity(IndicatorColor);
+        }
     }
 }
 
@@ -249,8 +269,10 @@ void UBeamGazeWidget::UpdateStatusText()
             break;
     }
     
-    StatusText->SetText(FText::FromString(StatusString));
-    StatusText->SetColorAndOpacity(StatusColor);
+    if (BeamWidgetUpdates::SetTextIfChanged(StatusText, MoveTemp(StatusString), ShownStatusString))
+    {
+        StatusText->SetColorAndOpacity(StatusColor);
+    }
 }
 
 void UBeamGazeWidget::UpdateCalibrationQuality()
@@ -260,6 +282,11 @@ void UBeamGazeWidget::UpdateCalibrationQuality()
         return;
     }
 
+    if (CalibrationQuality->GetPercent() == CurrentConfidence)
+    {
+        return;
+    }
+
     CalibrationQuality->SetPercent(CurrentConfidence);
 
     FLinearColor BarColor = GetConfidenceColor(CurrentConfidence);
@@ -273,8 +300,7 @@ void UBeamGazeWidget::UpdateFPSDisplay()
         return;
     }
     
-    FString FPSString = FString::Printf(TEXT("FPS: %.1f"), CurrentFPS);
-    FPSText->SetText(FText::FromString(FPSString));
+    BeamWidgetUpdates::SetTextIfChanged(FPSText, FString::Printf(TEXT("FPS: %.1f"), CurrentFPS), ShownFPSString);
 }
 
 void UBeamGazeWidget::UpdateConfidenceDisplay()
@@ -285,8 +311,10 @@ void UBeamGazeWidget::UpdateConfidenceDisplay()
     }
     
     FString ConfidenceString = FString::Printf(TEXT("Confidence: %.1f%%"), CurrentConfidence * 100.0f);
-    ConfidenceText->SetText(FText::FromString(ConfidenceString));
-    ConfidenceText->SetColorAndOpacity(GetConfidenceColor(CurrentConfidence));
+    if (BeamWidgetUpdates::SetTextIfChanged(ConfidenceText, MoveTemp(ConfidenceString), ShownConfidenceString))
+    {
+        ConfidenceText->SetColorAndOpacity(GetConfidenceColor(CurrentConfidence));
+    }
 }
 
 void UBeamGazeWidget::UpdateHeadPoseInfo()
@@ -298,7 +326,7 @@ void UBeamGazeWidget::UpdateHeadPoseInfo()
     
     // This would update detailed head pose information
     
-    HeadPoseInfo->SetVisibility(ESlateVisibility::Visible);
+    BeamWidgetUpdates::SetVisibilityIfChanged(HeadPoseInfo, ESlateVisibility::Visible);
 }
 
 void UBeamGazeWidget::UpdateGazeCoordinates()
@@ -308,8 +336,7 @@ void UBeamGazeWidget::UpdateGazeCoordinates()
         return;
     }
     
-    FString CoordinatesString = FString::Printf(TEXT("Gaze: (%.3f, %.3f)"), CurrentGazePoint.X, CurrentGazePoint.Y);
-    GazeCoordinatesText->SetText(FText::FromString(CoordinatesString));
+    BeamWidgetUpdates::SetTextIfChanged(GazeCoordinatesText, FString::Printf(TEXT("Gaze: (%.3f, %.3f)"), CurrentGazePoint.X, CurrentGazePoint.Y), ShownCoordinatesString);
 }
 
 void UBeamGazeWidget::UpdatePerformanceMetrics()
@@ -321,7 +348,7 @@ void UBeamGazeWidget::UpdatePerformanceMetrics()
     
     // This would update detailed performance metrics
     
-    PerformanceMetrics->SetVisibility(ESlateVisibility::Visible);
+    BeamWidgetUpdates::SetVisibilityIfChanged(PerformanceMetrics, ESlateVisibility::Visible);
 }
 
 void UBeamGazeWidget::UpdateErrorDisplay()
@@ -333,12 +360,12 @@ void UBeamGazeWidget::UpdateErrorDisplay()
     
     if (CurrentTrackingStatus == EBeamWidgetStatus::Error)
     {
-        ErrorText->SetText(FText::FromString(TEXT("Eye tracking error detected. Check hardware connection.")));
-        ErrorText->SetVisibility(ESlateVisibility::Visible);
+        BeamWidgetUpdates::SetTextIfChanged(ErrorText, TEXT("Eye tracking error detected. Check hardware connection."), ShownErrorString);
+        BeamWidgetUpdates::SetVisibilityIfChanged(ErrorText, ESlateVisibility::Visible);
     }
     else
     {
-        ErrorText->SetVisibility(ESlateVisibility::Hidden);
+        BeamWidgetUpdates::SetVisibilityIfChanged(ErrorText, ESlateVisibility::Hidden);
     }
 }
 
@@ -356,6 +383,16 @@ bool UBeamGazeWidget::ShouldUpdate() const
     return TimeSinceLastUpdate >= UpdateInterval;
 }
 
+bool UBeamGazeWidget::ShouldUpdateText() const
+{
+    if (TextUpdateFrequency <= 0.0f)
+    {
+        return false;
+    }
+
+    return GetWorld()->GetTimeSeconds() - LastTextUpdateTime >= 1.0f / TextUpdateFrequency;
+}
+
 void UBeamGazeWidget::CalculateFPS()
 {
     float CurrentTime = GetWorld()->GetTimeSeconds();
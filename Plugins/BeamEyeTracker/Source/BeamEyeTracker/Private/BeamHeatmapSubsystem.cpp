@@ -0,0 +1,279 @@
+// Implements the GPU gaze heatmap that follows the tracking ring
+
+#include "BeamHeatmapSubsystem.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamHeatmapShaders.h"
+#include "BeamRecording.h"
+#include "BeamRing.h"
+#include "BeamLogging.h"
+#include "BeamResources.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "TextureResource.h"
+#include "Misc/App.h"
+
+// Samples uploaded per render command when merging recordings, to bound the transient upload size
+#define BEAM_HEATMAP_RECORDING_BATCH 16384
+
+void UBeamHeatmapSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// The tracking subsystem owns the ring the ticker reads, so it must exist first
+	BeamSubsystem = Collection.InitializeDependency<UBeamEyeTrackerSubsystem>();
+	if (BeamSubsystem)
+	{
+		BeamSubsystem->OnFrameRingReleased.AddUObject(this, &UBeamHeatmapSubsystem::HandleFrameRingReleased);
+	}
+	Scratch.Reserve(FBeamFrameRing::BufferSize);
+}
+
+void UBeamHeatmapSubsystem::Deinitialize()
+{
+	StopHeatmap();
+	if (BeamSubsystem)
+	{
+		BeamSubsystem->OnFrameRingReleased.RemoveAll(this);
+		BeamSubsystem = nullptr;
+	}
+	ReleaseTargets();
+
+	Super::Deinitialize();
+}
+
+bool UBeamHeatmapSubsystem::StartHeatmap()
+{
+	if (bHeatmapActive)
+	{
+		return true;
+	}
+
+	const FBeamFrameRing* Ring = BeamSubsystem ? BeamSubsystem->GetFrameRing() : nullptr;
+	if (!Ring)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Gaze heatmap needs a running tracking subsystem"));
+		return false;
+	}
+	if (!EnsureTargets())
+	{
+		return false;
+	}
+
+	// Only samples published from now on are accumulated
+	FBeamFrame Latest;
+	LastSampleTimestampMs = Ring->ReadLatest(Latest) ? Latest.SDKTimestampMs : 0.0;
+
+	bHeatmapActive = true;
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamHeatmapSubsystem::Tick));
+	return true;
+}
+
+void UBeamHeatmapSubsystem::StopHeatmap()
+{
+	bHeatmapActive = false;
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+void UBeamHeatmapSubsystem::ClearHeatmap()
+{
+	if (AccumulationTarget)
+	{
+		EnqueueUpdate(TArray<FVector4f>(), 1.0f, true);
+	}
+}
+
+void UBeamHeatmapSubsystem::SetHeatmapParams(float Sigma, float HalfLifeSeconds, float SaturationWeight, float ConfidenceThreshold)
+{
+	KernelSigma = FMath::Clamp(Sigma, 0.001f, 0.5f);
+	DecayHalfLifeSeconds = FMath::Max(HalfLifeSeconds, 0.0f);
+	Saturation = FMath::Max(SaturationWeight, 0.01f);
+	MinConfidence = FMath::Clamp(ConfidenceThreshold, 0.0f, 1.0f);
+}
+
+void UBeamHeatmapSubsystem::SetHeatmapResolution(int32 Width, int32 Height)
+{
+	Width = FMath::Clamp(Width, 16, 4096);
+	Height = FMath::Clamp(Height, 16, 4096);
+	if (Width == HeatmapWidth && Height == HeatmapHeight)
+	{
+		return;
+	}
+
+	HeatmapWidth = Width;
+	HeatmapHeight = Height;
+	if (AccumulationTarget)
+	{
+		ReleaseTargets();
+		EnsureTargets();
+	}
+}
+
+bool UBeamHeatmapSubsystem::AddRecordedSession(const FString& FilePath)
+{
+	if (!EnsureTargets())
+	{
+		return false;
+	}
+
+	FBeamRecording Recording;
+	if (!Recording.StartPlayback(FilePath))
+	{
+		return false;
+	}
+
+	int32 NumSamples = 0;
+	TArray<FVector4f> Splats;
+	Splats.Reserve(BEAM_HEATMAP_RECORDING_BATCH);
+
+	FBeamFrame Frame;
+	while (Recording.GetNextFrame(Frame))
+	{
+		AddSplat(Frame, Splats);
+		if (Splats.Num() == BEAM_HEATMAP_RECORDING_BATCH)
+		{
+			NumSamples += Splats.Num();
+			EnqueueUpdate(MoveTemp(Splats), 1.0f, false);
+			Splats.Reserve(BEAM_HEATMAP_RECORDING_BATCH);
+		}
+	}
+	Recording.StopPlayback();
+
+	NumSamples += Splats.Num();
+	if (Splats.Num() > 0)
+	{
+		EnqueueUpdate(MoveTemp(Splats), 1.0f, false);
+	}
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Merged %d gaze samples from %s into the heatmap"), NumSamples, *FilePath);
+	return true;
+}
+
+bool UBeamHeatmapSubsystem::EnsureTargets()
+{
+	if (AccumulationTarget && DisplayTarget)
+	{
+		return true;
+	}
+	if (!FApp::CanEverRender())
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Gaze heatmap is unavailable without a renderer"));
+		return false;
+	}
+
+	auto CreateTarget = [this](EPixelFormat Format)
+	{
+		UTextureRenderTarget2D* Target = NewObject<UTextureRenderTarget2D>(this);
+		Target->bCanCreateUAV = true;
+		Target->ClearColor = FLinearColor::Transparent;
+		Target->InitCustomFormat(HeatmapWidth, HeatmapHeight, Format, true);
+		return Target;
+	};
+
+	AccumulationTarget = CreateTarget(PF_R32_FLOAT);
+	DisplayTarget = CreateTarget(PF_R8G8B8A8);
+	return true;
+}
+
+void UBeamHeatmapSubsystem::ReleaseTargets()
+{
+	// Resource release is queued behind any pending updates, so those still see valid targets
+	if (AccumulationTarget)
+	{
+		AccumulationTarget->ReleaseResource();
+		AccumulationTarget = nullptr;
+	}
+	if (DisplayTarget)
+	{
+		DisplayTarget->ReleaseResource();
+		DisplayTarget = nullptr;
+	}
+}
+
+void UBeamHeatmapSubsystem::HandleFrameRingReleased()
+{
+	StopHeatmap();
+}
+
+bool UBeamHeatmapSubsystem::Tick(float DeltaTime)
+{
+	const FBeamFrameRing* Ring = BeamSubsystem ? BeamSubsystem->GetFrameRing() : nullptr;
+	if (!bHeatmapActive || !Ring || !AccumulationTarget)
+	{
+		return true;
+	}
+
+	Scratch.Reset();
+	Ring->CopyFramesInRange(LastSampleTimestampMs, TNumericLimits<double>::Max(), Scratch);
+
+	TArray<FVector4f> Splats;
+	for (const FBeamFrame& Frame : Scratch)
+	{
+		if (Frame.SDKTimestampMs > LastSampleTimestampMs)
+		{
+			AddSplat(Frame, Splats);
+			LastSampleTimestampMs = Frame.SDKTimestampMs;
+		}
+	}
+
+	// Timestamps behind the last one splatted mean the ring was cleared and restarted with a new origin
+	FBeamFrame Latest;
+	if (Scratch.Num() == 0 && Ring->ReadLatest(Latest) && Latest.SDKTimestampMs < LastSampleTimestampMs)
+	{
+		LastSampleTimestampMs = Latest.SDKTimestampMs;
+	}
+
+	const float Decay = DecayHalfLifeSeconds > 0.0f ? FMath::Exp2(-DeltaTime / DecayHalfLifeSeconds) : 1.0f;
+	if (Splats.Num() > 0 || Decay < 1.0f)
+	{
+		EnqueueUpdate(MoveTemp(Splats), Decay, false);
+	}
+	return true;
+}
+
+void UBeamHeatmapSubsystem::AddSplat(const FBeamFrame& Frame, TArray<FVector4f>& OutSplats) const
+{
+	if (Frame.Gaze.bValid && Frame.Gaze.Confidence >= MinConfidence)
+	{
+		OutSplats.Emplace(static_cast<float>(Frame.Gaze.Screen01.X), static_cast<float>(Frame.Gaze.Screen01.Y), Frame.Gaze.Confidence, 0.0f);
+	}
+}
+
+void UBeamHeatmapSubsystem::EnqueueUpdate(TArray<FVector4f>&& Splats, float Decay, bool bClearFirst)
+{
+	FTextureRenderTargetResource* AccumulationResource = AccumulationTarget->GameThread_GetRenderTargetResource();
+	FTextureRenderTargetResource* DisplayResource = DisplayTarget->GameThread_GetRenderTargetResource();
+	if (!AccumulationResource || !DisplayResource)
+	{
+		return;
+	}
+
+	FBeamHeatmapPassParams PassParams;
+	PassParams.Decay = Decay;
+	PassParams.SigmaNormalized = KernelSigma;
+	PassParams.Saturation = Saturation;
+
+	ENQUEUE_RENDER_COMMAND(BeamHeatmapUpdate)(
+		[AccumulationResource, DisplayResource, Splats = MoveTemp(Splats), PassParams, bClearFirst](FRHICommandListImmediate& RHICmdList)
+		{
+			GBeamResources.BeginGPUPass(RHICmdList);
+			FRDGBuilder GraphBuilder(RHICmdList);
+			FRDGTextureRef Accumulation = GraphBuilder.RegisterExternalTexture(CreateRenderTarget(AccumulationResource->GetRenderTargetTexture(), TEXT("BeamHeatmap.Accumulation")));
+			FRDGTextureRef Display = GraphBuilder.RegisterExternalTexture(CreateRenderTarget(DisplayResource->GetRenderTargetTexture(), TEXT("BeamHeatmap.Display")));
+
+			if (bClearFirst)
+			{
+				AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(Accumulation), 0.0f);
+			}
+			BeamHeatmapShaders::AddAccumulatePasses(GraphBuilder, Accumulation, Splats, PassParams);
+			BeamHeatmapShaders::AddColorizePass(GraphBuilder, Accumulation, Display, PassParams);
+
+			GraphBuilder.Execute();
+			GBeamResources.EndGPUPass(RHICmdList);
+		});
+}
@@ -0,0 +1,64 @@
+// Implements the Enhanced Input gaze modifier and trigger on top of the frame ring
+
+#include "BeamInputModifiers.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamRing.h"
+#include "EnhancedPlayerInput.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BeamInputModifiers)
+
+namespace
+{
+	/** Latest ring frame for the player that owns PlayerInput, resolving the subsystem at most once */
+	bool ReadLatestGazeFrame(const UEnhancedPlayerInput* PlayerInput, TWeakObjectPtr<UBeamEyeTrackerSubsystem>& CachedSubsystem, FBeamFrame& OutFrame)
+	{
+		UBeamEyeTrackerSubsystem* Subsystem = CachedSubsystem.Get();
+		if (!Subsystem)
+		{
+			const APlayerController* PlayerController = PlayerInput ? PlayerInput->GetOuterAPlayerController() : nullptr;
+			UGameInstance* GameInstance = PlayerController ? PlayerController->GetGameInstance() : nullptr;
+			Subsystem = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+			CachedSubsystem = Subsystem;
+		}
+
+		const FBeamFrameRing* Ring = Subsystem ? Subsystem->GetFrameRing() : nullptr;
+		return Ring && Ring->ReadLatest(OutFrame);
+	}
+}
+
+FInputActionValue UInputModifierBeamGaze::ModifyRaw_Implementation(const UEnhancedPlayerInput* PlayerInput, FInputActionValue CurrentValue, float DeltaTime)
+{
+	FBeamFrame Frame;
+	if (ReadLatestGazeFrame(PlayerInput, CachedSubsystem, Frame) && Frame.Gaze.bValid)
+	{
+		switch (Space)
+		{
+		case EBeamGazeInputSpace::Screen01:
+			LastValue = Frame.Gaze.Screen01;
+			break;
+		case EBeamGazeInputSpace::Centered:
+			LastValue = FVector2D(Frame.Gaze.Screen01.X * 2.0 - 1.0, 1.0 - Frame.Gaze.Screen01.Y * 2.0);
+			break;
+		case EBeamGazeInputSpace::Velocity:
+			LastValue = Frame.bHasVelocity ? Frame.GazeVelocity01 : FVector2D::ZeroVector;
+			break;
+		}
+	}
+	else if (!bHoldLastValid)
+	{
+		LastValue = FVector2D::ZeroVector;
+	}
+
+	return FInputActionValue(EInputActionValueType::Axis2D, FVector(LastValue, 0.0));
+}
+
+ETriggerState UInputTriggerBeamGaze::UpdateState_Implementation(const UEnhancedPlayerInput* PlayerInput, FInputActionValue ModifiedValue, float DeltaTime)
+{
+	FBeamFrame Frame;
+	const bool bTracked = ReadLatestGazeFrame(PlayerInput, CachedSubsystem, Frame)
+		&& Frame.Gaze.bValid
+		&& Frame.Gaze.Confidence >= MinConfidence;
+	return bTracked ? ETriggerState::Triggered : ETriggerState::None;
+}
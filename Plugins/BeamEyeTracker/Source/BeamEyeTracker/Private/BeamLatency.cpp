@@ -0,0 +1,257 @@
+// Implements the stage latency histograms and their stat, Insights and console reporting
+
+#include "BeamLatency.h"
+#include "BeamFlightRecorder.h"
+#include "BeamLogging.h"
+#include "BeamStats.h"
+#include "BeamTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+FBeamLatencyMonitor GBeamLatency;
+
+static TAutoConsoleVariable<int32> CVarBeamLatencySampleEvery(
+	TEXT("beam.Latency.SampleEvery"),
+	1,
+	TEXT("Record stage latencies for one frame in N (by FrameId); 0 disables latency recording"),
+	ECVF_Default
+);
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Delivery Jitter above Min p50 (ms)"), STAT_BeamLatencyJitterP50, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Delivery Jitter above Min p95 (ms)"), STAT_BeamLatencyJitterP95, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Delivery Jitter above Min p99 (ms)"), STAT_BeamLatencyJitterP99, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Conversion to Publish p50 (ms)"), STAT_BeamLatencyPublishP50, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Conversion to Publish p95 (ms)"), STAT_BeamLatencyPublishP95, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Conversion to Publish p99 (ms)"), STAT_BeamLatencyPublishP99, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Publish to Consume p50 (ms)"), STAT_BeamLatencyConsumeP50, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Publish to Consume p95 (ms)"), STAT_BeamLatencyConsumeP95, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Publish to Consume p99 (ms)"), STAT_BeamLatencyConsumeP99, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Consume to Render p50 (ms)"), STAT_BeamLatencyRenderP50, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Consume to Render p95 (ms)"), STAT_BeamLatencyRenderP95, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Consume to Render p99 (ms)"), STAT_BeamLatencyRenderP99, STATGROUP_Beam);
+
+// FBeamLatencyHistogram Implementation
+
+FBeamLatencyHistogram::FBeamLatencyHistogram()
+{
+	Reset();
+}
+
+int32 FBeamLatencyHistogram::GetBucketIndex(uint64 Micros)
+{
+	// Below 8 us every microsecond has its own bucket; above, four per power of two from the top bits
+	if (Micros < 8)
+	{
+		return static_cast<int32>(Micros);
+	}
+	const uint32 Msb = FMath::FloorLog2_64(Micros);
+	const int32 Index = static_cast<int32>(Msb * 4 + ((Micros >> (Msb - 2)) & 3));
+	return FMath::Min(Index, NumBuckets - 1);
+}
+
+uint64 FBeamLatencyHistogram::GetBucketUpperMicros(int32 Index)
+{
+	if (Index < 8)
+	{
+		return static_cast<uint64>(Index) + 1;
+	}
+	const uint32 Msb = static_cast<uint32>(Index / 4);
+	const uint64 Sub = static_cast<uint64>(Index % 4);
+	return (5 + Sub) << (Msb - 2);
+}
+
+void FBeamLatencyHistogram::Record(double Seconds)
+{
+	const uint64 Micros = static_cast<uint64>(FMath::Max(0.0, Seconds) * 1000000.0);
+	Buckets[GetBucketIndex(Micros)].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64 FBeamLatencyHistogram::GetCount() const
+{
+	uint64 Count = 0;
+	for (const std::atomic<uint32>& Bucket : Buckets)
+	{
+		Count += Bucket.load(std::memory_order_relaxed);
+	}
+	return Count;
+}
+
+double FBeamLatencyHistogram::GetPercentileMs(double Percentile) const
+{
+	// One pass over a relaxed copy; concurrent records only shift the answer by the samples in flight
+	uint32 Counts[NumBuckets];
+	uint64 Total = 0;
+	for (int32 Index = 0; Index < NumBuckets; ++Index)
+	{
+		Counts[Index] = Buckets[Index].load(std::memory_order_relaxed);
+		Total += Counts[Index];
+	}
+	if (Total == 0)
+	{
+		return 0.0;
+	}
+
+	const uint64 Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 100.0) * 0.01 * Total)));
+	uint64 Seen = 0;
+	for (int32 Index = 0; Index < NumBuckets; ++Index)
+	{
+		Seen += Counts[Index];
+		if (Seen >= Rank)
+		{
+			return GetBucketUpperMicros(Index) * 0.001;
+		}
+	}
+	return GetBucketUpperMicros(NumBuckets - 1) * 0.001;
+}
+
+void FBeamLatencyHistogram::Reset()
+{
+	for (std::atomic<uint32>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+}
+
+// FBeamLatencyMonitor Implementation
+
+bool FBeamLatencyMonitor::ShouldSample(int64 FrameId) const
+{
+	const int32 SampleEvery = CVarBeamLatencySampleEvery.GetValueOnAnyThread();
+	return SampleEvery > 0 && (SampleEvery == 1 || FrameId % SampleEvery == 0);
+}
+
+void FBeamLatencyMonitor::Record(EBeamLatencyStage Stage, double Seconds)
+{
+	Histograms[static_cast<int32>(Stage)].Record(Seconds);
+	GBeamFlightRecorder.RecordLatency(Stage, Seconds);
+}
+
+void FBeamLatencyMonitor::StampPublish(FBeamFrame& Frame)
+{
+	Frame.PublishedSeconds = FPlatformTime::Seconds();
+	if (Frame.ConvertedSeconds > 0.0 && ShouldSample(Frame.FrameId))
+	{
+		Record(EBeamLatencyStage::ConversionToPublish, Frame.PublishedSeconds - Frame.ConvertedSeconds);
+	}
+}
+
+void FBeamLatencyMonitor::NoteConsumed(const FBeamFrame& Frame, double NowSeconds)
+{
+	if (Frame.FrameId == LastConsumedFrameId.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	if (Frame.PublishedSeconds > 0.0 && ShouldSample(Frame.FrameId))
+	{
+		Record(EBeamLatencyStage::PublishToConsume, NowSeconds - Frame.PublishedSeconds);
+	}
+
+	LastConsumedSeconds.store(NowSeconds, std::memory_order_relaxed);
+	LastConsumedFrameId.store(Frame.FrameId, std::memory_order_release);
+	BEAM_TRACE_FRAME_CONSUMED(Frame);
+}
+
+void FBeamLatencyMonitor::NoteRendered(const FBeamFrame& Frame, double NowSeconds)
+{
+	// Only the frame the game thread consumed has a consume time; newer frames the render thread sees first are skipped
+	if (Frame.FrameId != LastConsumedFrameId.load(std::memory_order_acquire) || Frame.FrameId == LastRenderedFrameId.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+	LastRenderedFrameId.store(Frame.FrameId, std::memory_order_relaxed);
+
+	if (ShouldSample(Frame.FrameId))
+	{
+		Record(EBeamLatencyStage::ConsumeToRender, NowSeconds - LastConsumedSeconds.load(std::memory_order_relaxed));
+	}
+}
+
+FBeamLatencySummary FBeamLatencyMonitor::GetSummary(EBeamLatencyStage Stage) const
+{
+	const FBeamLatencyHistogram& Histogram = Histograms[static_cast<int32>(Stage)];
+
+	FBeamLatencySummary Summary;
+	Summary.P50Ms = Histogram.GetPercentileMs(50.0);
+	Summary.P95Ms = Histogram.GetPercentileMs(95.0);
+	Summary.P99Ms = Histogram.GetPercentileMs(99.0);
+	Summary.Count = Histogram.GetCount();
+	return Summary;
+}
+
+void FBeamLatencyMonitor::Reset()
+{
+	for (FBeamLatencyHistogram& Histogram : Histograms)
+	{
+		Histogram.Reset();
+	}
+}
+
+void FBeamLatencyMonitor::PublishStats() const
+{
+	const FBeamLatencySummary Jitter = GetSummary(EBeamLatencyStage::DeliveryJitter);
+	const FBeamLatencySummary Publish = GetSummary(EBeamLatencyStage::ConversionToPublish);
+	const FBeamLatencySummary Consume = GetSummary(EBeamLatencyStage::PublishToConsume);
+	const FBeamLatencySummary Render = GetSummary(EBeamLatencyStage::ConsumeToRender);
+
+	SET_FLOAT_STAT(STAT_BeamLatencyJitterP50, Jitter.P50Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyJitterP95, Jitter.P95Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyJitterP99, Jitter.P99Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyPublishP50, Publish.P50Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyPublishP95, Publish.P95Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyPublishP99, Publish.P99Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyConsumeP50, Consume.P50Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyConsumeP95, Consume.P95Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyConsumeP99, Consume.P99Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyRenderP50, Render.P50Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyRenderP95, Render.P95Ms);
+	SET_FLOAT_STAT(STAT_BeamLatencyRenderP99, Render.P99Ms);
+
+	// Insights needs literal counter names, so the tail percentiles are listed out
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::FrameAge, TEXT("Beam.Latency.DeliveryJitter.P95"), Jitter.P95Ms);
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::FrameAge, TEXT("Beam.Latency.DeliveryJitter.P99"), Jitter.P99Ms);
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::FrameAge, TEXT("Beam.Latency.ConversionToPublish.P95"), Publish.P95Ms);
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::FrameAge, TEXT("Beam.Latency.ConversionToPublish.P99"), Publish.P99Ms);
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::FrameAge, TEXT("Beam.Latency.PublishToConsume.P95"), Consume.P95Ms);
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::FrameAge, TEXT("Beam.Latency.PublishToConsume.P99"), Consume.P99Ms);
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::FrameAge, TEXT("Beam.Latency.ConsumeToRender.P95"), Render.P95Ms);
+	BEAM_TRACE_COUNTER(FBeamTrace::ETraceCategory::FrameAge, TEXT("Beam.Latency.ConsumeToRender.P99"), Render.P99Ms);
+}
+
+const TCHAR* FBeamLatencyMonitor::GetStageName(EBeamLatencyStage Stage)
+{
+	switch (Stage)
+	{
+	case EBeamLatencyStage::DeliveryJitter:      return TEXT("DeliveryJitter");
+	case EBeamLatencyStage::ConversionToPublish: return TEXT("ConversionToPublish");
+	case EBeamLatencyStage::PublishToConsume:    return TEXT("PublishToConsume");
+	case EBeamLatencyStage::ConsumeToRender:     return TEXT("ConsumeToRender");
+	default:                                     return TEXT("Unknown");
+	}
+}
+
+// Console Commands
+
+static FAutoConsoleCommand BeamLatencyReportCommand(
+	TEXT("Beam.Latency.Report"),
+	TEXT("Log p50/p95/p99 of every frame latency stage"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		for (int32 Index = 0; Index < static_cast<int32>(EBeamLatencyStage::Num); ++Index)
+		{
+			const EBeamLatencyStage Stage = static_cast<EBeamLatencyStage>(Index);
+			const FBeamLatencySummary Summary = GBeamLatency.GetSummary(Stage);
+			UE_LOG(LogBeam, Log, TEXT("Latency %-20s p50 %7.3f ms  p95 %7.3f ms  p99 %7.3f ms  (%llu samples)"),
+				FBeamLatencyMonitor::GetStageName(Stage), Summary.P50Ms, Summary.P95Ms, Summary.P99Ms, Summary.Count);
+		}
+	})
+);
+
+static FAutoConsoleCommand BeamLatencyResetCommand(
+	TEXT("Beam.Latency.Reset"),
+	TEXT("Clear every frame latency histogram"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		GBeamLatency.Reset();
+	})
+);
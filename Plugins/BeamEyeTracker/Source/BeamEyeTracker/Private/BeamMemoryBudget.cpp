@@ -0,0 +1,150 @@
+// Implements the memory budget presets and the split of one budget between plugin buffers
+
+#include "BeamMemoryBudget.h"
+#include "BeamEyeTrackerSettings.h"
+#include "BeamFlightRecorder.h"
+#include "BeamGazeAnalyzer.h"
+#include "BeamRecording.h"
+#include "BeamResources.h"
+#include "BeamRing.h"
+#include "BeamLogging.h"
+#include "BeamStats.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_STAT(STAT_BeamMemoryBudget);
+
+namespace BeamMemoryBudget
+{
+	// Matches the beam.PollHz ceiling; the analytics window is sized for the fastest source
+	static constexpr int32 MaxSampleRateHz = 240;
+
+	// Component histories the budget plans for; scenes with more components scale past the budget
+	static constexpr int32 PlannedComponents = 8;
+
+	// Most of the budget the subsystem rings may take before the main ring drops its optional storage, in percent
+	static constexpr int64 MaxFixedRingShare = 50;
+
+	// Shares of what is left after the fixed rings, in percent
+	static constexpr int64 RecordingChunkShare = 40;
+	static constexpr int64 RecordingTailShare = 25;
+	static constexpr int64 FlightRecorderShare = 20;
+	static constexpr int64 ComponentShare = 10;
+	static constexpr int64 AnalyticsShare = 5;
+
+	// Main ring as built with the budget's options, plus the raw ring, which is always built bare
+	static int64 GetFixedRingBytes(bool bSnapshots, bool bGazeColumns)
+	{
+		return static_cast<int64>(FBeamFrameRing::GetAllocatedSizeFor(bGazeColumns, bSnapshots) + FBeamFrameRing::GetAllocatedSizeFor(false, false));
+	}
+
+	static int64 GetComponentRingBytes(int32 MaxHistoryFrames)
+	{
+		return static_cast<int64>(MaxHistoryFrames > FBeamComponentFrameRing::GetMaxSize()
+			? FBeamCompactFrameRing::GetAllocatedSizeFor(false, false)
+			: FBeamComponentFrameRing::GetAllocatedSizeFor(false, false));
+	}
+}
+
+int64 FBeamMemoryBudget::GetProfileBudgetBytes(EBeamMemoryProfile Profile)
+{
+	switch (Profile)
+	{
+	// The two subsystem rings need about 0.75 MB even bare, so this is the smallest preset that leaves room for the rest
+	case EBeamMemoryProfile::LowMemoryKiosk: return 2 * 1024 * 1024;
+	case EBeamMemoryProfile::Default: return 4 * 1024 * 1024;
+	case EBeamMemoryProfile::Research: return 32 * 1024 * 1024;
+	default: return 0;
+	}
+}
+
+const TCHAR* FBeamMemoryBudget::GetProfileName(EBeamMemoryProfile Profile)
+{
+	switch (Profile)
+	{
+	case EBeamMemoryProfile::LowMemoryKiosk: return TEXT("LowMemoryKiosk");
+	case EBeamMemoryProfile::Default: return TEXT("Default");
+	case EBeamMemoryProfile::Research: return TEXT("Research");
+	default: return TEXT("Custom");
+	}
+}
+
+FBeamMemoryBudget FBeamMemoryBudget::FromBudget(EBeamMemoryProfile Profile, int64 BudgetBytes)
+{
+	using namespace BeamMemoryBudget;
+
+	FBeamMemoryBudget Budget;
+	Budget.Profile = Profile;
+	Budget.BudgetBytes = BudgetBytes;
+
+	// Live and raw subsystem rings at their allocated size; snapshot blocks go first, then the gaze columns
+	const int64 MaxFixedRingBytes = BudgetBytes > 0 ? BudgetBytes * MaxFixedRingShare / 100 : TNumericLimits<int64>::Max();
+	Budget.FixedRingBytes = GetFixedRingBytes(true, true);
+	if (Budget.FixedRingBytes > MaxFixedRingBytes)
+	{
+		Budget.bFrameRingSnapshots = false;
+		Budget.FixedRingBytes = GetFixedRingBytes(false, true);
+	}
+	if (Budget.FixedRingBytes > MaxFixedRingBytes)
+	{
+		Budget.bFrameRingGazeColumns = false;
+		Budget.FixedRingBytes = GetFixedRingBytes(false, false);
+	}
+	const int64 Remaining = FMath::Max<int64>(BudgetBytes - Budget.FixedRingBytes, 0);
+
+	// Writer chunks: keep the default 16 blocks in flight and shrink the blocks first, then the queue
+	const int64 ChunkBytes = Remaining * RecordingChunkShare / 100;
+	const int64 BlockBytes = FMath::Clamp<int64>(FMath::RoundUpToPowerOfTwo64(FMath::Max<int64>(ChunkBytes / 17, 1)) / 2, 4 * 1024, 64 * 1024);
+	Budget.RecordingBlockSizeBytes = static_cast<int32>(BlockBytes);
+	Budget.RecordingMaxPendingBlocks = static_cast<int32>(FMath::Clamp<int64>(ChunkBytes / BlockBytes - 1, 1, 256));
+
+	Budget.RecordingMaxInMemoryFrames = static_cast<int32>(FMath::Min<int64>(Remaining * RecordingTailShare / 100 / sizeof(FBeamRecording::FFrameRecord), 1000000));
+
+	Budget.FlightRecorderSeconds = FMath::Clamp(static_cast<float>(Remaining * FlightRecorderShare / 100) / static_cast<float>(FBeamFlightRecorder::GetBytesPerSecond()), 1.0f, 120.0f);
+
+	// Only the large ring when every planned component can afford all of it
+	const int64 ComponentBytes = Remaining * ComponentShare / 100 / PlannedComponents;
+	Budget.MaxComponentHistoryFrames = ComponentBytes >= GetComponentRingBytes(FBeamCompactFrameRing::GetMaxSize()) ? FBeamCompactFrameRing::GetMaxSize() : FBeamComponentFrameRing::GetMaxSize();
+
+	Budget.AnalyticsWindowSeconds = FMath::Clamp(static_cast<float>(Remaining * AnalyticsShare / 100) / static_cast<float>(MaxSampleRateHz * FBeamGazeAnalyzer::GetBytesPerSample()), 2.0f, 60.0f);
+
+	return Budget;
+}
+
+int64 FBeamMemoryBudget::GetPlannedBytes() const
+{
+	using namespace BeamMemoryBudget;
+
+	const int64 FlightRecorderBytes = FlightRecorderSeconds > 0.0f ? static_cast<int64>(FlightRecorderSeconds * FBeamFlightRecorder::GetBytesPerSecond()) : 0;
+	const int64 AnalyticsBytes = static_cast<int64>(AnalyticsWindowSeconds * MaxSampleRateHz * FBeamGazeAnalyzer::GetBytesPerSample());
+	return FixedRingBytes
+		+ static_cast<int64>(RecordingMaxPendingBlocks + 1) * RecordingBlockSizeBytes
+		+ static_cast<int64>(RecordingMaxInMemoryFrames) * sizeof(FBeamRecording::FFrameRecord)
+		+ FlightRecorderBytes
+		+ PlannedComponents * GetComponentRingBytes(MaxComponentHistoryFrames)
+		+ AnalyticsBytes;
+}
+
+static FAutoConsoleCommand BeamMemoryCommand(
+	TEXT("Beam.Memory"),
+	TEXT("Print the active memory budget profile, the buffer sizes derived from it and the plugin's current buffer memory"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const FBeamMemoryBudget Budget = GetDefault<UBeamEyeTrackerSettings>()->GetMemoryBudget();
+		const FBeamResourceUsage Usage = GBeamResources.GetLatest();
+
+		UE_LOG(LogBeam, Display, TEXT("Memory profile %s: budget %.1f KB, planned %.1f KB, in use %s"),
+			FBeamMemoryBudget::GetProfileName(Budget.Profile), Budget.BudgetBytes / 1024.0, Budget.GetPlannedBytes() / 1024.0,
+			Usage.bValid ? *FString::Printf(TEXT("%.1f KB%s"), Usage.MemoryBytes / 1024.0, Usage.bMemoryFromLLM ? TEXT(" (LLM)") : TEXT("")) : TEXT("not sampled"));
+		UE_LOG(LogBeam, Display, TEXT("  Subsystem rings:    %.1f KB (fixed%s%s)"), Budget.FixedRingBytes / 1024.0,
+			Budget.bFrameRingSnapshots ? TEXT("") : TEXT(", no snapshots"), Budget.bFrameRingGazeColumns ? TEXT("") : TEXT(", no gaze columns"));
+		UE_LOG(LogBeam, Display, TEXT("  Recording chunks:   %d x %d KB"), Budget.RecordingMaxPendingBlocks + 1, Budget.RecordingBlockSizeBytes / 1024);
+		UE_LOG(LogBeam, Display, TEXT("  Recording tail:     %d frames"), Budget.RecordingMaxInMemoryFrames);
+		UE_LOG(LogBeam, Display, TEXT("  Component history:  %d frames max"), Budget.MaxComponentHistoryFrames);
+		UE_LOG(LogBeam, Display, TEXT("  Analytics window:   %.1f s"), Budget.AnalyticsWindowSeconds);
+		UE_LOG(LogBeam, Display, TEXT("  Flight recorder:    %.1f s"), Budget.FlightRecorderSeconds);
+		if (Budget.IsBudgeted() && Budget.GetPlannedBytes() > Budget.BudgetBytes)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("  Over budget by %.1f KB: the buffers' minimum sizes do not fit"), (Budget.GetPlannedBytes() - Budget.BudgetBytes) / 1024.0);
+		}
+	})
+);
@@ -0,0 +1,125 @@
+// Implements encoding and validation of Beam UDP frame packets
+
+#include "BeamNetProtocol.h"
+
+namespace BeamNetProtocol
+{
+	void EncodeFrame(const FBeamFrame& Frame, uint32 Sequence, FFramePacket& OutPacket)
+	{
+		OutPacket = FFramePacket();
+		OutPacket.Flags = Frame.Gaze.bValid ? GazeValid : 0;
+		OutPacket.Sequence = Sequence;
+		OutPacket.TimestampMs = Frame.SDKTimestampMs;
+
+		OutPacket.GazeX = static_cast<float>(Frame.Gaze.Screen01.X);
+		OutPacket.GazeY = static_cast<float>(Frame.Gaze.Screen01.Y);
+		OutPacket.GazeConfidence = static_cast<float>(Frame.Gaze.Confidence);
+
+		OutPacket.HeadPositionCm[0] = static_cast<float>(Frame.Head.PositionCm.X);
+		OutPacket.HeadPositionCm[1] = static_cast<float>(Frame.Head.PositionCm.Y);
+		OutPacket.HeadPositionCm[2] = static_cast<float>(Frame.Head.PositionCm.Z);
+		OutPacket.HeadRotation[0] = static_cast<float>(Frame.Head.Rotation.Pitch);
+		OutPacket.HeadRotation[1] = static_cast<float>(Frame.Head.Rotation.Yaw);
+		OutPacket.HeadRotation[2] = static_cast<float>(Frame.Head.Rotation.Roll);
+		OutPacket.HeadConfidence = static_cast<float>(Frame.Head.Confidence);
+	}
+
+	void EncodeCompactFrame(const FBeamFrame& Frame, uint32 Sequence, uint8 StreamEpoch, double SendTimeMs, FCompactFramePacket& OutPacket)
+	{
+		// The packet body uses the compact frame's quantization, so it is filled field for field
+		const FBeamFrameCompact Compact = FBeamFrameCompact::FromFrame(Frame);
+
+		OutPacket = FCompactFramePacket();
+		OutPacket.Flags = static_cast<uint8>(Compact.IsGazeValid() ? GazeValid : 0);
+		OutPacket.StreamEpoch = StreamEpoch;
+		OutPacket.Sequence = Sequence;
+		OutPacket.TimestampMs = Compact.SDKTimestampMs;
+		OutPacket.SendTimeMs = SendTimeMs;
+
+		const double CaptureAgeUs = (SendTimeMs - Frame.UETimestampSeconds * 1000.0) * 1000.0;
+		OutPacket.CaptureAgeUs = static_cast<uint32>(FMath::Clamp(CaptureAgeUs, 0.0, static_cast<double>(MAX_uint32)));
+
+		OutPacket.GazeX = Compact.GazeX;
+		OutPacket.GazeY = Compact.GazeY;
+		OutPacket.GazeConfidence = Compact.GazeConfidence;
+		OutPacket.HeadConfidence = Compact.HeadConfidence;
+		FMemory::Memcpy(OutPacket.HeadPositionCm, Compact.HeadPositionCm, sizeof(OutPacket.HeadPositionCm));
+		FMemory::Memcpy(OutPacket.HeadRotation, Compact.HeadRotation, sizeof(OutPacket.HeadRotation));
+	}
+
+	static bool DecodeFullFrame(const uint8* Data, FPacketInfo& OutInfo, FBeamFrame& OutFrame)
+	{
+		FFramePacket Packet;
+		FMemory::Memcpy(&Packet, Data, sizeof(Packet));
+
+		OutInfo = FPacketInfo();
+		OutInfo.Sequence = Packet.Sequence;
+
+		OutFrame = FBeamFrame();
+		OutFrame.SDKTimestampMs = Packet.TimestampMs;
+
+		OutFrame.Gaze.bValid = (Packet.Flags & GazeValid) != 0;
+		OutFrame.Gaze.Screen01 = FVector2D(Packet.GazeX, Packet.GazeY);
+		OutFrame.Gaze.Confidence = Packet.GazeConfidence;
+		OutFrame.Gaze.TimestampMs = Packet.TimestampMs;
+
+		OutFrame.Head.PositionCm = FVector(Packet.HeadPositionCm[0], Packet.HeadPositionCm[1], Packet.HeadPositionCm[2]);
+		OutFrame.Head.SetRotation(FRotator(Packet.HeadRotation[0], Packet.HeadRotation[1], Packet.HeadRotation[2]));
+		OutFrame.Head.Confidence = Packet.HeadConfidence;
+		OutFrame.Head.TimestampMs = Packet.TimestampMs;
+		return true;
+	}
+
+	static bool DecodeCompactFrame(const uint8* Data, FPacketInfo& OutInfo, FBeamFrame& OutFrame)
+	{
+		FCompactFramePacket Packet;
+		FMemory::Memcpy(&Packet, Data, sizeof(Packet));
+
+		OutInfo = FPacketInfo();
+		OutInfo.Sequence = Packet.Sequence;
+		OutInfo.StreamEpoch = Packet.StreamEpoch;
+		OutInfo.bHasSendTime = true;
+		OutInfo.SendTimeMs = Packet.SendTimeMs;
+		OutInfo.CaptureAgeMs = Packet.CaptureAgeUs * 0.001;
+
+		FBeamFrameCompact Compact;
+		Compact.SDKTimestampMs = Packet.TimestampMs;
+		Compact.Flags = (Packet.Flags & GazeValid) != 0 ? FBeamFrameCompact::GazeValid : 0;
+		Compact.GazeX = Packet.GazeX;
+		Compact.GazeY = Packet.GazeY;
+		Compact.GazeConfidence = Packet.GazeConfidence;
+		Compact.HeadConfidence = Packet.HeadConfidence;
+		FMemory::Memcpy(Compact.HeadPositionCm, Packet.HeadPositionCm, sizeof(Compact.HeadPositionCm));
+		FMemory::Memcpy(Compact.HeadRotation, Packet.HeadRotation, sizeof(Compact.HeadRotation));
+		Compact.ToFrame(OutFrame);
+		return true;
+	}
+
+	bool DecodeFrame(const uint8* Data, int32 Size, FPacketInfo& OutInfo, FBeamFrame& OutFrame)
+	{
+		// Magic and version sit at the same offsets in every packet version
+		if (!Data || Size < static_cast<int32>(sizeof(uint32) + sizeof(uint16)))
+		{
+			return false;
+		}
+
+		uint32 Magic = 0;
+		uint16 Version = 0;
+		FMemory::Memcpy(&Magic, Data, sizeof(Magic));
+		FMemory::Memcpy(&Version, Data + sizeof(Magic), sizeof(Version));
+		if (Magic != PacketMagic)
+		{
+			return false;
+		}
+
+		if (Version == CompactFramePacketVersion && Size == sizeof(FCompactFramePacket))
+		{
+			return DecodeCompactFrame(Data, OutInfo, OutFrame);
+		}
+		if (Version == FramePacketVersion && Size == sizeof(FFramePacket))
+		{
+			return DecodeFullFrame(Data, OutInfo, OutFrame);
+		}
+		return false;
+	}
+}
@@ -0,0 +1,138 @@
+/*=============================================================================
+    BeamNetProtocol.h: Wire format for streaming Beam frames over UDP.
+
+    One datagram carries one tracking frame. Packets are fixed-size,
+    little-endian and self-describing through a magic and version, so a
+    receiver can discard foreign or stale traffic on the port cheaply.
+    Streaming servers send the quantized compact packet; the full-precision
+    packet is still accepted for simple senders.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamFrameCompact.h"
+
+namespace BeamNetProtocol
+{
+	/** "BNET" */
+	static constexpr uint32 PacketMagic = 0x54454E42;
+	static constexpr uint16 FramePacketVersion = 1;
+	static constexpr uint16 CompactFramePacketVersion = 2;
+
+	/** Administratively scoped multicast group streaming servers send to by default */
+	static constexpr const TCHAR* DefaultMulticastGroup = TEXT("239.255.42.99");
+
+	/** Port used when neither the settings nor the endpoint string specify one */
+	static constexpr int32 DefaultPort = 47810;
+
+	/** Compact gaze quantization range in Screen01 units; the compact packet shares FBeamFrameCompact's quantization */
+	static constexpr double GazeMin = FBeamFrameCompact::GazeMin;
+	static constexpr double GazeRange = FBeamFrameCompact::GazeRange;
+
+	/** Receive buffer size; anything larger is not a Beam packet */
+	static constexpr int32 MaxPacketSize = 512;
+
+	enum EFramePacketFlags : uint16
+	{
+		GazeValid = 1 << 0
+	};
+
+#pragma pack(push, 1)
+	/** Full-precision frame packet */
+	struct FFramePacket
+	{
+		uint32 Magic = PacketMagic;
+		uint16 Version = FramePacketVersion;
+		uint16 Flags = 0;
+
+		/** Incremented by the sender for every packet; receivers drop anything at or behind the newest */
+		uint32 Sequence = 0;
+
+		/** Sender's SDK timestamp */
+		double TimestampMs = 0.0;
+
+		float GazeX = 0.0f;
+		float GazeY = 0.0f;
+		float GazeConfidence = 0.0f;
+
+		float HeadPositionCm[3] = { 0.0f, 0.0f, 0.0f };
+		float HeadRotation[3] = { 0.0f, 0.0f, 0.0f };
+		float HeadConfidence = 0.0f;
+	};
+
+	/** Quantized frame packet sent by FBeamNetStreamServer */
+	struct FCompactFramePacket
+	{
+		uint32 Magic = PacketMagic;
+		uint16 Version = CompactFramePacketVersion;
+		uint8 Flags = 0;
+
+		/** Bumped by the sender whenever its timestamps restart, e.g. after a data source change */
+		uint8 StreamEpoch = 0;
+
+		uint32 Sequence = 0;
+
+		/** Sender's SDK timestamp */
+		double TimestampMs = 0.0;
+
+		/** Sender's platform clock when the packet left, for receiver clock-offset estimation */
+		double SendTimeMs = 0.0;
+
+		/** Sender-side time from frame ingestion to send (microseconds) */
+		uint32 CaptureAgeUs = 0;
+
+		/** Screen01 quantized over [GazeMin, GazeMin + GazeRange] so slightly off-screen gaze survives */
+		uint16 GazeX = 0;
+		uint16 GazeY = 0;
+		uint8 GazeConfidence = 0;
+		uint8 HeadConfidence = 0;
+
+		/** Hundredths of a centimeter and hundredths of a degree, as in FBeamFrameCompact */
+		int16 HeadPositionCm[3] = { 0, 0, 0 };
+		int16 HeadRotation[3] = { 0, 0, 0 };
+	};
+#pragma pack(pop)
+
+	static_assert(sizeof(FFramePacket) == 60, "FFramePacket layout is part of the wire format");
+	static_assert(sizeof(FCompactFramePacket) == 50, "FCompactFramePacket layout is part of the wire format");
+
+	/** Sender metadata decoded alongside the frame */
+	struct FPacketInfo
+	{
+		uint32 Sequence = 0;
+		uint8 StreamEpoch = 0;
+
+		/** False for packets without a send time; receivers then cannot estimate clock offset */
+		bool bHasSendTime = false;
+		double SendTimeMs = 0.0;
+		double CaptureAgeMs = 0.0;
+	};
+
+	/** Fills a full-precision packet from a frame */
+	void EncodeFrame(const FBeamFrame& Frame, uint32 Sequence, FFramePacket& OutPacket);
+
+	/** Fills a compact packet from a frame; UETimestampSeconds is taken as the sender's capture time */
+	void EncodeCompactFrame(const FBeamFrame& Frame, uint32 Sequence, uint8 StreamEpoch, double SendTimeMs, FCompactFramePacket& OutPacket);
+
+	/**
+	 * Validates and decodes one datagram of either packet version. Gaze
+	 * pixels are left at zero; the receiver maps Screen01 onto its own viewport.
+	 */
+	bool DecodeFrame(const uint8* Data, int32 Size, FPacketInfo& OutInfo, FBeamFrame& OutFrame);
+
+	/** True if Sequence is strictly newer than Previous, allowing for wrap-around */
+	inline bool IsNewerSequence(uint32 Sequence, uint32 Previous)
+	{
+		return static_cast<int32>(Sequence - Previous) > 0;
+	}
+}
+
+/*=============================================================================
+    End of BeamNetProtocol.h
+=============================================================================*/
@@ -0,0 +1,189 @@
+// Implements the ring-following UDP sender for network gaze streaming
+
+#include "BeamNetStreamServer.h"
+#include "BeamNetProtocol.h"
+#include "BeamLogging.h"
+#include "Common/UdpSocketBuilder.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+// Longest idle wait between ring checks; only frames published without the observer wait this long
+#define BEAM_NET_STREAM_IDLE_WAIT_MS 10
+
+namespace
+{
+	/** Triggers the sender's wake event from the publishing thread */
+	class FBeamNetStreamWakeObserver : public IBeamFrameObserver
+	{
+	public:
+		FBeamNetStreamWakeObserver()
+			: Event(FPlatformProcess::GetSynchEventFromPool(false))
+		{
+		}
+
+		virtual ~FBeamNetStreamWakeObserver() override
+		{
+			FPlatformProcess::ReturnSynchEventToPool(Event);
+		}
+
+		virtual void OnFramePublished(const FBeamFrame& Frame) override
+		{
+			Event->Trigger();
+		}
+
+		FEvent* const Event;
+	};
+}
+
+FBeamNetStreamServer::FBeamNetStreamServer(const FBeamFrameRing& InRing)
+	: Ring(InRing)
+	, WakeObserver(MakeShared<FBeamNetStreamWakeObserver, ESPMode::ThreadSafe>())
+	, bStopRequested(false)
+	, PacketsSent(0)
+{
+	WakeEvent = StaticCastSharedRef<FBeamNetStreamWakeObserver>(WakeObserver)->Event;
+	Scratch.Reserve(FBeamFrameRing::BufferSize);
+}
+
+FBeamNetStreamServer::~FBeamNetStreamServer()
+{
+	Shutdown();
+}
+
+bool FBeamNetStreamServer::Start(const FString& Destinations, int32 MulticastTtl)
+{
+	if (Thread)
+	{
+		return true;
+	}
+
+	TArray<FString> Entries;
+	Destinations.ParseIntoArray(Entries, TEXT(","), true);
+
+	DestinationAddrs.Reset();
+	for (FString& Entry : Entries)
+	{
+		Entry.TrimStartAndEndInline();
+
+		FIPv4Endpoint Endpoint;
+		if (!FIPv4Endpoint::Parse(Entry, Endpoint))
+		{
+			UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Ignoring stream destination '%s' (expected 'address:port')"), *Entry);
+			continue;
+		}
+		DestinationAddrs.Add(Endpoint.ToInternetAddr());
+	}
+
+	if (DestinationAddrs.Num() == 0)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Network streaming needs at least one destination"));
+		return false;
+	}
+
+	Socket = FUdpSocketBuilder(TEXT("BeamNetStreamServer"))
+		.AsNonBlocking()
+		.AsReusable()
+		.WithMulticastTtl(static_cast<uint8>(FMath::Clamp(MulticastTtl, 1, 255)))
+		.WithMulticastLoopback()
+		.WithSendBufferSize(64 * 1024)
+		.Build();
+
+	if (!Socket)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Network streaming could not create its socket"));
+		DestinationAddrs.Reset();
+		return false;
+	}
+
+	bStopRequested.store(false, std::memory_order_release);
+	Thread = FRunnableThread::Create(this, TEXT("BeamNetStreamServer"), 0, TPri_AboveNormal);
+	if (!Thread)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Network streaming could not start its sender thread"));
+		Shutdown();
+		return false;
+	}
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Streaming frames to %s"), *Destinations);
+	return true;
+}
+
+void FBeamNetStreamServer::Shutdown()
+{
+	if (Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	if (Socket)
+	{
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+	DestinationAddrs.Reset();
+}
+
+void FBeamNetStreamServer::Stop()
+{
+	bStopRequested.store(true, std::memory_order_release);
+	WakeEvent->Trigger();
+}
+
+uint32 FBeamNetStreamServer::Run()
+{
+	// Subscribers only get frames published after the stream starts
+	const int32 ConsumerId = Ring.RegisterConsumer(TEXT("NetStream"));
+	if (ConsumerId == INDEX_NONE)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: No free frame ring cursor for the network stream"));
+		return 1;
+	}
+	uint32 ClearCount = Ring.GetClearCount();
+
+	while (!bStopRequested.load(std::memory_order_acquire))
+	{
+		// A cleared ring restarts with a new timestamp origin, which receivers learn from the epoch
+		const uint32 CurrentClearCount = Ring.GetClearCount();
+		if (CurrentClearCount != ClearCount)
+		{
+			ClearCount = CurrentClearCount;
+			++StreamEpoch;
+		}
+
+		if (Ring.ConsumeFrames(ConsumerId, Scratch) > 0)
+		{
+			for (const FBeamFrame& Frame : Scratch)
+			{
+				SendFrame(Frame);
+			}
+			continue;
+		}
+
+		WakeEvent->Wait(BEAM_NET_STREAM_IDLE_WAIT_MS);
+	}
+
+	Ring.UnregisterConsumer(ConsumerId);
+	return 0;
+}
+
+void FBeamNetStreamServer::SendFrame(const FBeamFrame& Frame)
+{
+	BeamNetProtocol::FCompactFramePacket Packet;
+	BeamNetProtocol::EncodeCompactFrame(Frame, NextSequence++, StreamEpoch, FPlatformTime::Seconds() * 1000.0, Packet);
+
+	for (const TSharedRef<FInternetAddr>& Addr : DestinationAddrs)
+	{
+		int32 BytesSent = 0;
+		if (Socket->SendTo(reinterpret_cast<const uint8*>(&Packet), sizeof(Packet), BytesSent, *Addr))
+		{
+			PacketsSent.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
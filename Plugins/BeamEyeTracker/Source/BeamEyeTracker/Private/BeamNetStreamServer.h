@@ -0,0 +1,89 @@
+/*=============================================================================
+    BeamNetStreamServer.h: UDP streaming of published Beam frames.
+
+    Follows the subsystem frame ring and sends every newly published frame
+    as a compact BeamNetProtocol packet, so render nodes and analytics
+    machines can consume gaze through FBeamNetworkDataSource.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamRing.h"
+#include "IBeamFrameObserver.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+class FSocket;
+class FInternetAddr;
+class FRunnableThread;
+class FEvent;
+
+/**
+ * Streams ring frames to a multicast group and/or unicast destinations.
+ *
+ * The sender thread drains the ring through its own consumer cursor, so
+ * it never contends with the producer or other readers. When idle it
+ * waits on an event that GetFrameObserver() triggers as each frame is
+ * published, so a registered server sends without a polling delay.
+ * Frames a data source pushes into the ring itself are not observed and
+ * are picked up by the wait's timeout. One multicast send reaches any
+ * number of subscribers, so the sender cost does not grow with the
+ * audience. The owner must Stop() the server before the ring is freed.
+ */
+class FBeamNetStreamServer : public FRunnable
+{
+public:
+	explicit FBeamNetStreamServer(const FBeamFrameRing& InRing);
+	virtual ~FBeamNetStreamServer() override;
+
+	/**
+	 * Opens the socket and starts sending. Destinations is a comma-separated list of
+	 * "address:port" entries; multicast groups are sent with the given TTL.
+	 */
+	bool Start(const FString& Destinations, int32 MulticastTtl);
+
+	/** Stops the sender thread and closes the socket (game thread) */
+	void Shutdown();
+
+	/** Wakes the sender on every published frame; the owner registers it with the subsystem while streaming */
+	FBeamFrameObserverRef GetFrameObserver() const { return WakeObserver; }
+
+	bool IsRunning() const { return Thread != nullptr; }
+	uint64 GetPacketsSent() const { return PacketsSent.load(std::memory_order_relaxed); }
+
+	//~ Begin FRunnable Interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	//~ End FRunnable Interface
+
+private:
+	const FBeamFrameRing& Ring;
+
+	FSocket* Socket = nullptr;
+	TArray<TSharedRef<FInternetAddr>> DestinationAddrs;
+	FRunnableThread* Thread = nullptr;
+
+	/** Owns WakeEvent, so a producer still holding the observer never triggers a freed event */
+	FBeamFrameObserverRef WakeObserver;
+	FEvent* WakeEvent = nullptr;
+
+	std::atomic<bool> bStopRequested;
+	std::atomic<uint64> PacketsSent;
+
+	/** Sender thread state */
+	uint32 NextSequence = 0;
+	uint8 StreamEpoch = 0;
+	TArray<FBeamFrame> Scratch;
+
+	/** Sends one frame to every destination (sender thread) */
+	void SendFrame(const FBeamFrame& Frame);
+};
+
+/*=============================================================================
+    End of BeamNetStreamServer.h
+=============================================================================*/
@@ -0,0 +1,469 @@
+// Implements the UDP receive thread, playout buffer and clock-offset estimation of the network data source
+
+#include "BeamNetworkDataSource.h"
+#include "BeamNetProtocol.h"
+#include "BeamLogging.h"
+#include "Common/UdpSocketBuilder.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+// A sequence this far behind the newest one means the sender restarted rather than reordered
+#define BEAM_NET_SEQUENCE_RESET_WINDOW 4096
+
+// Time without packets after which the stream is reported as having no data
+#define BEAM_NET_STALE_SECONDS 1.0
+
+// Frames held by the playout buffer before the oldest is released regardless of its due time
+#define BEAM_NET_MAX_PENDING_FRAMES 32
+
+// Longest the receive thread blocks on the socket before re-checking Stop()
+#define BEAM_NET_MAX_WAIT_SECONDS 0.05
+
+// FBeamClockOffsetEstimator Implementation
+
+FBeamClockOffsetEstimator::FBeamClockOffsetEstimator(double InWindowMs)
+	: WindowMs(InWindowMs)
+{
+}
+
+void FBeamClockOffsetEstimator::AddSample(double LocalReceiveMs, double RemoteSendMs)
+{
+	const double TransitMs = LocalReceiveMs - RemoteSendMs;
+	if (!bHasEstimate)
+	{
+		WindowStartMs = LocalReceiveMs;
+		CurrentWindowMin = TransitMs;
+		PreviousWindowMin = TransitMs;
+		LastTransitMs = TransitMs;
+		JitterMs = 0.0;
+		bHasEstimate = true;
+		return;
+	}
+
+	if (LocalReceiveMs - WindowStartMs >= WindowMs)
+	{
+		PreviousWindowMin = CurrentWindowMin;
+		CurrentWindowMin = TransitMs;
+		WindowStartMs = LocalReceiveMs;
+	}
+	else
+	{
+		CurrentWindowMin = FMath::Min(CurrentWindowMin, TransitMs);
+	}
+
+	JitterMs += (FMath::Abs(TransitMs - LastTransitMs) - JitterMs) / 16.0;
+	LastTransitMs = TransitMs;
+}
+
+void FBeamClockOffsetEstimator::Reset()
+{
+	bHasEstimate = false;
+	JitterMs = 0.0;
+}
+
+// FBeamNetworkReceiver Implementation
+
+/** Owns the blocking receive loop for one socket */
+class FBeamNetworkReceiver : public FRunnable
+{
+public:
+	FBeamNetworkReceiver(FBeamNetworkDataSource& InOwner, FSocket& InSocket)
+		: Owner(InOwner)
+		, Socket(InSocket)
+		, bStopRequested(false)
+	{
+	}
+
+	virtual uint32 Run() override
+	{
+		uint8 Buffer[BeamNetProtocol::MaxPacketSize];
+		while (!bStopRequested.load(std::memory_order_acquire))
+		{
+			// Wake for new packets or for the next buffered frame, whichever comes first
+			const double WaitSeconds = Owner.GetReceiveWaitSeconds(FPlatformTime::Seconds());
+			if (Socket.Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(WaitSeconds)))
+			{
+				int32 BytesRead = 0;
+				while (Socket.Recv(Buffer, sizeof(Buffer), BytesRead) && BytesRead > 0)
+				{
+					Owner.HandlePacket(Buffer, BytesRead);
+				}
+			}
+
+			Owner.ReleaseDueFrames(FPlatformTime::Seconds());
+		}
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopRequested.store(true, std::memory_order_release);
+	}
+
+private:
+	FBeamNetworkDataSource& Owner;
+	FSocket& Socket;
+	std::atomic<bool> bStopRequested;
+};
+
+// FBeamNetworkDataSource Implementation
+
+FBeamNetworkDataSource::FBeamNetworkDataSource(const FString& InEndpoint, float InMaxJitterBufferMs)
+	: Endpoint(InEndpoint)
+	, MaxJitterBufferMs(FMath::Max(0.0f, InMaxJitterBufferMs))
+	, FrameEvent(FPlatformProcess::GetSynchEventFromPool(false))
+	, PacketsReceived(0)
+	, PacketsDropped(0)
+	, LastPacketSeconds(0.0)
+{
+}
+
+FBeamNetworkDataSource::~FBeamNetworkDataSource()
+{
+	Shutdown();
+	FPlatformProcess::ReturnSynchEventToPool(FrameEvent);
+	FrameEvent = nullptr;
+}
+
+bool FBeamNetworkDataSource::Initialize()
+{
+	if (Socket)
+	{
+		return true;
+	}
+
+	FIPv4Endpoint BindEndpoint(FIPv4Address::Any, BeamNetProtocol::DefaultPort);
+	if (Endpoint.IsNumeric())
+	{
+		BindEndpoint.Port = static_cast<uint16>(FCString::Atoi(*Endpoint));
+	}
+	else if (!Endpoint.IsEmpty() && !FIPv4Endpoint::Parse(Endpoint, BindEndpoint))
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Network data source endpoint '%s' is not 'port' or 'address:port'"), *Endpoint);
+		return false;
+	}
+
+	// Subscribers to a multicast stream bind the group's port on every interface and join the group
+	FUdpSocketBuilder Builder(TEXT("BeamNetworkDataSource"));
+	Builder.AsNonBlocking()
+		.AsReusable()
+		.WithReceiveBufferSize(64 * 1024);
+	if (BindEndpoint.Address.IsMulticastAddress())
+	{
+		Builder.BoundToEndpoint(FIPv4Endpoint(FIPv4Address::Any, BindEndpoint.Port))
+			.JoinedToGroup(BindEndpoint.Address)
+			.WithMulticastLoopback();
+	}
+	else
+	{
+		Builder.BoundToEndpoint(BindEndpoint);
+	}
+	Socket = Builder.Build();
+
+	if (!Socket)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Network data source could not bind %s"), *BindEndpoint.ToString());
+		return false;
+	}
+
+	{
+		FScopeLock Lock(&FrameLock);
+		ResetStreamLocked();
+		bHasStreamEpoch = false;
+		LatestSerial = 0;
+		NextFrameId = 0;
+	}
+	WaitSerial = 0;
+	PacketsReceived.store(0, std::memory_order_relaxed);
+	PacketsDropped.store(0, std::memory_order_relaxed);
+	LastPacketSeconds.store(0.0, std::memory_order_relaxed);
+
+	Receiver = new FBeamNetworkReceiver(*this, *Socket);
+	ReceiverThread = FRunnableThread::Create(Receiver, TEXT("BeamNetworkReceiver"), 0, TPri_AboveNormal);
+	if (!ReceiverThread)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Network data source could not start its receive thread"));
+		Shutdown();
+		return false;
+	}
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Network data source listening on %s"), *BindEndpoint.ToString());
+	return true;
+}
+
+void FBeamNetworkDataSource::Shutdown()
+{
+	// The receive thread must be gone before the socket it waits on
+	if (ReceiverThread)
+	{
+		ReceiverThread->Kill(true);
+		delete ReceiverThread;
+		ReceiverThread = nullptr;
+	}
+	if (Receiver)
+	{
+		delete Receiver;
+		Receiver = nullptr;
+	}
+	if (Socket)
+	{
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+}
+
+bool FBeamNetworkDataSource::IsValid() const
+{
+	return Socket != nullptr && ReceiverThread != nullptr;
+}
+
+bool FBeamNetworkDataSource::InitSDK(const FString& AppName, int32 InViewportWidth, int32 InViewportHeight)
+{
+	UpdateViewportGeometry(InViewportWidth, InViewportHeight);
+	return Initialize();
+}
+
+void FBeamNetworkDataSource::UpdateViewportGeometry(int32 InViewportWidth, int32 InViewportHeight)
+{
+	FScopeLock Lock(&FrameLock);
+	ViewportWidth = InViewportWidth;
+	ViewportHeight = InViewportHeight;
+}
+
+EBeamHealth FBeamNetworkDataSource::GetHealth() const
+{
+	if (!IsValid())
+	{
+		return EBeamHealth::Error;
+	}
+
+	const double LastSeconds = LastPacketSeconds.load(std::memory_order_relaxed);
+	if (LastSeconds <= 0.0 || FPlatformTime::Seconds() - LastSeconds > BEAM_NET_STALE_SECONDS)
+	{
+		return EBeamHealth::NoData;
+	}
+	return EBeamHealth::Ok;
+}
+
+bool FBeamNetworkDataSource::FetchCurrentFrame(FBeamFrame& OutFrame)
+{
+	FScopeLock Lock(&FrameLock);
+	if (LatestSerial == 0)
+	{
+		return false;
+	}
+
+	OutFrame = LatestFrame;
+	return true;
+}
+
+void FBeamNetworkDataSource::SetFrameSink(FBeamFrameRing* InFrameSink)
+{
+	FScopeLock Lock(&FrameLock);
+	FrameSink = InFrameSink;
+}
+
+bool FBeamNetworkDataSource::IsPushingFrames() const
+{
+	FScopeLock Lock(&FrameLock);
+	return FrameSink != nullptr && IsValid();
+}
+
+bool FBeamNetworkDataSource::WaitForNextFrame(FBeamFrame& OutFrame, uint32 TimeoutMs)
+{
+	if (!IsValid())
+	{
+		FPlatformProcess::Sleep(TimeoutMs * 0.001f);
+		return false;
+	}
+
+	for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+	{
+		{
+			FScopeLock Lock(&FrameLock);
+			if (LatestSerial != WaitSerial)
+			{
+				WaitSerial = LatestSerial;
+				OutFrame = LatestFrame;
+				return true;
+			}
+		}
+
+		if (Attempt == 0)
+		{
+			FrameEvent->Wait(TimeoutMs);
+		}
+	}
+	return false;
+}
+
+double FBeamNetworkDataSource::GetClockOffsetMs() const
+{
+	FScopeLock Lock(&FrameLock);
+	return ClockOffset.HasEstimate() ? ClockOffset.GetOffsetMs() : 0.0;
+}
+
+double FBeamNetworkDataSource::GetJitterMs() const
+{
+	FScopeLock Lock(&FrameLock);
+	return ClockOffset.GetJitterMs();
+}
+
+double FBeamNetworkDataSource::GetPlayoutDelayMs() const
+{
+	FScopeLock Lock(&FrameLock);
+	return GetPlayoutDelayMsLocked();
+}
+
+double FBeamNetworkDataSource::GetPlayoutDelayMsLocked() const
+{
+	return FMath::Min(2.0 * ClockOffset.GetJitterMs(), static_cast<double>(MaxJitterBufferMs));
+}
+
+void FBeamNetworkDataSource::ResetStreamLocked()
+{
+	PendingFrames.Reset();
+	ClockOffset.Reset();
+	bHasSequence = false;
+}
+
+void FBeamNetworkDataSource::HandlePacket(const uint8* Data, int32 Size)
+{
+	BeamNetProtocol::FPacketInfo Info;
+	FBeamFrame Frame;
+	if (!BeamNetProtocol::DecodeFrame(Data, Size, Info, Frame))
+	{
+		PacketsDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	PacketsReceived.fetch_add(1, std::memory_order_relaxed);
+	LastPacketSeconds.store(NowSeconds, std::memory_order_relaxed);
+
+	FScopeLock Lock(&FrameLock);
+
+	// A new epoch, or a sequence far behind the newest, means the sender restarted with a new timestamp origin
+	bool bStreamRestarted = bHasStreamEpoch && Info.StreamEpoch != StreamEpoch;
+	if (!bStreamRestarted && bHasSequence && !BeamNetProtocol::IsNewerSequence(Info.Sequence, LastSequence))
+	{
+		if (LastSequence - Info.Sequence < BEAM_NET_SEQUENCE_RESET_WINDOW)
+		{
+			PacketsDropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		bStreamRestarted = true;
+	}
+
+	if (bStreamRestarted)
+	{
+		UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Network stream restarted (sequence %u after %u)"), Info.Sequence, LastSequence);
+		ResetStreamLocked();
+
+		// This thread is the ring's producer, so it may clear it
+		if (FrameSink)
+		{
+			FrameSink->Clear();
+		}
+	}
+	StreamEpoch = Info.StreamEpoch;
+	bHasStreamEpoch = true;
+
+	FPendingFrame Pending;
+	Pending.Sequence = Info.Sequence;
+	Pending.ReleaseSeconds = NowSeconds;
+	if (Info.bHasSendTime)
+	{
+		// Schedule against the zero-queueing arrival time so only the playout delay is added to the fastest packets
+		const double NowMs = NowSeconds * 1000.0;
+		ClockOffset.AddSample(NowMs, Info.SendTimeMs);
+		const double LocalSendMs = Info.SendTimeMs + ClockOffset.GetOffsetMs();
+		Frame.UETimestampSeconds = (LocalSendMs - Info.CaptureAgeMs) * 0.001;
+		Pending.ReleaseSeconds = FMath::Max(NowSeconds, (LocalSendMs + GetPlayoutDelayMsLocked()) * 0.001);
+	}
+	else
+	{
+		Frame.UETimestampSeconds = NowSeconds;
+	}
+	Pending.Frame = Frame;
+
+	// Insert in sequence order; duplicates of a buffered frame are dropped
+	int32 InsertIndex = PendingFrames.Num();
+	while (InsertIndex > 0 && !BeamNetProtocol::IsNewerSequence(Pending.Sequence, PendingFrames[InsertIndex - 1].Sequence))
+	{
+		if (PendingFrames[InsertIndex - 1].Sequence == Pending.Sequence)
+		{
+			PacketsDropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		--InsertIndex;
+	}
+	PendingFrames.Insert(MoveTemp(Pending), InsertIndex);
+
+	while (PendingFrames.Num() > BEAM_NET_MAX_PENDING_FRAMES)
+	{
+		ReleaseFrameLocked(PendingFrames[0]);
+		PendingFrames.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+}
+
+void FBeamNetworkDataSource::ReleaseDueFrames(double NowSeconds)
+{
+	FScopeLock Lock(&FrameLock);
+
+	int32 NumReleased = 0;
+	while (NumReleased < PendingFrames.Num() && PendingFrames[NumReleased].ReleaseSeconds <= NowSeconds)
+	{
+		ReleaseFrameLocked(PendingFrames[NumReleased]);
+		++NumReleased;
+	}
+	if (NumReleased > 0)
+	{
+		PendingFrames.RemoveAt(0, NumReleased, EAllowShrinking::No);
+	}
+}
+
+double FBeamNetworkDataSource::GetReceiveWaitSeconds(double NowSeconds) const
+{
+	FScopeLock Lock(&FrameLock);
+	if (PendingFrames.Num() == 0)
+	{
+		return BEAM_NET_MAX_WAIT_SECONDS;
+	}
+	return FMath::Clamp(PendingFrames[0].ReleaseSeconds - NowSeconds, 0.0, BEAM_NET_MAX_WAIT_SECONDS);
+}
+
+void FBeamNetworkDataSource::ReleaseFrameLocked(FPendingFrame& Pending)
+{
+	FBeamFrame& Frame = Pending.Frame;
+
+	// Lost datagrams leave the same gap in FrameId, so the producer counts them with every other source drop
+	if (bHasSequence)
+	{
+		NextFrameId += static_cast<int64>(Pending.Sequence - LastSequence) - 1;
+	}
+	Frame.FrameId = NextFrameId++;
+	Frame.DeltaTimeSeconds = LatestSerial > 0 ? Frame.UETimestampSeconds - LatestFrame.UETimestampSeconds : 0.0;
+	if (ViewportWidth > 0 && ViewportHeight > 0)
+	{
+		Frame.Gaze.ScreenPx = FVector2D(Frame.Gaze.Screen01.X * ViewportWidth, Frame.Gaze.Screen01.Y * ViewportHeight);
+	}
+
+	LastSequence = Pending.Sequence;
+	bHasSequence = true;
+	LatestFrame = Frame;
+	++LatestSerial;
+
+	if (FrameSink)
+	{
+		FrameSink->Publish(Frame);
+	}
+	FrameEvent->Trigger();
+}
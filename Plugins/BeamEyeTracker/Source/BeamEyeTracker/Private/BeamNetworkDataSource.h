@@ -0,0 +1,181 @@
+/*=============================================================================
+    BeamNetworkDataSource.h: Remote data source for Beam Eye Tracker.
+
+    Receives tracking frames streamed over UDP from another machine, so a
+    render node or analytics box can consume gaze without a local tracker
+    or the SDK wrapper. Estimates the sender's clock offset and smooths
+    arrival jitter with a small adaptive playout buffer.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IBeamDataSource.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+class FSocket;
+class FEvent;
+class FRunnableThread;
+class FBeamNetworkReceiver;
+
+/**
+ * Sender-to-receiver clock offset from one-way packet send times.
+ *
+ * Each packet gives Local - Remote = offset + path delay; the minimum over
+ * a sliding window approximates the offset plus the fastest path delay,
+ * which is the reference a packet with no queueing would arrive at. Two
+ * alternating windows let the estimate follow clock drift and route changes.
+ * Jitter is the RFC 3550 smoothed variation of that transit time.
+ */
+class BEAMEYETRACKER_API FBeamClockOffsetEstimator
+{
+public:
+	explicit FBeamClockOffsetEstimator(double InWindowMs = 2000.0);
+
+	void AddSample(double LocalReceiveMs, double RemoteSendMs);
+	void Reset();
+
+	bool HasEstimate() const { return bHasEstimate; }
+
+	/** Add to a sender clock time to get the local time a zero-queueing packet would arrive */
+	double GetOffsetMs() const { return FMath::Min(CurrentWindowMin, PreviousWindowMin); }
+
+	/** Smoothed transit-time variation */
+	double GetJitterMs() const { return JitterMs; }
+
+private:
+	double WindowMs;
+	double WindowStartMs = 0.0;
+	double CurrentWindowMin = 0.0;
+	double PreviousWindowMin = 0.0;
+	double LastTransitMs = 0.0;
+	double JitterMs = 0.0;
+	bool bHasEstimate = false;
+};
+
+/**
+ * Data source fed by BeamNetProtocol frame packets.
+ *
+ * A receive thread owns the socket and decodes datagrams as they arrive.
+ * Packets carrying a send time are held until the sender's send time plus
+ * the estimated clock offset plus a playout delay of twice the measured
+ * jitter (capped by MaxJitterBufferMs), which reorders late packets and
+ * evens out arrival bursts; frames are then released in sequence order.
+ * With a frame sink set, released frames are published straight into the
+ * ring from that thread; otherwise WaitForNextFrame wakes on each release,
+ * so the producer thread forwards frames with no polling delay. Packets at
+ * or behind the newest released sequence are dropped.
+ *
+ * Released frames carry the sender's capture time translated to the local
+ * clock in UETimestampSeconds, so prediction horizons include network delay.
+ */
+class BEAMEYETRACKER_API FBeamNetworkDataSource : public IBeamDataSource
+{
+public:
+	/**
+	 * Endpoint is "port" or "address:port" to bind; a multicast address joins that group on its port.
+	 * Empty uses the default port on any address. A zero buffer releases every packet on arrival.
+	 */
+	explicit FBeamNetworkDataSource(const FString& InEndpoint = FString(), float InMaxJitterBufferMs = 2.0f);
+	virtual ~FBeamNetworkDataSource();
+
+	// IBeamDataSource interface
+	virtual bool Initialize() override;
+	virtual void Shutdown() override;
+	virtual bool IsValid() const override;
+	virtual bool FetchCurrentFrame(FBeamFrame& OutFrame) override;
+	virtual EBeamHealth GetHealth() const override;
+	virtual bool StartCameraRecentering() override { return false; }
+	virtual void EndCameraRecentering() override {}
+	virtual bool InitSDK(const FString& AppName, int32 ViewportWidth, int32 ViewportHeight) override;
+	virtual bool IsSDKInitialized() const override { return IsValid(); }
+	virtual void UpdateViewportGeometry(int32 ViewportWidth, int32 ViewportHeight) override;
+	virtual bool StartCalibration(const FString& ProfileId) override { return false; }
+	virtual void StopCalibration() override {}
+	virtual void SetFrameSink(FBeamFrameRing* InFrameSink) override;
+	virtual bool IsPushingFrames() const override;
+	virtual bool WaitForNextFrame(FBeamFrame& OutFrame, uint32 TimeoutMs) override;
+
+	/** Received packet counters (any thread) */
+	uint64 GetPacketsReceived() const { return PacketsReceived.load(std::memory_order_relaxed); }
+	uint64 GetPacketsDropped() const { return PacketsDropped.load(std::memory_order_relaxed); }
+
+	/** Current clock offset, jitter and playout delay estimates in milliseconds (any thread) */
+	double GetClockOffsetMs() const;
+	double GetJitterMs() const;
+	double GetPlayoutDelayMs() const;
+
+private:
+	friend class FBeamNetworkReceiver;
+
+	/** Frame waiting in the playout buffer */
+	struct FPendingFrame
+	{
+		FBeamFrame Frame;
+		uint32 Sequence = 0;
+		double ReleaseSeconds = 0.0;
+	};
+
+	FString Endpoint;
+	float MaxJitterBufferMs;
+
+	FSocket* Socket = nullptr;
+	FBeamNetworkReceiver* Receiver = nullptr;
+	FRunnableThread* ReceiverThread = nullptr;
+
+	/** Guards everything the receive thread shares with consumers */
+	mutable FCriticalSection FrameLock;
+	FBeamFrameRing* FrameSink = nullptr;
+	FBeamFrame LatestFrame;
+	uint64 LatestSerial = 0;
+
+	/** Newest sequence released from the playout buffer */
+	uint32 LastSequence = 0;
+	bool bHasSequence = false;
+	uint8 StreamEpoch = 0;
+	bool bHasStreamEpoch = false;
+
+	/** Playout buffer, oldest sequence first */
+	TArray<FPendingFrame> PendingFrames;
+	FBeamClockOffsetEstimator ClockOffset;
+	int64 NextFrameId = 0;
+	int32 ViewportWidth = 0;
+	int32 ViewportHeight = 0;
+
+	/** Serial of the last frame handed out by WaitForNextFrame (producer thread only) */
+	uint64 WaitSerial = 0;
+
+	/** Auto-reset event signalled for every accepted frame */
+	FEvent* FrameEvent = nullptr;
+
+	std::atomic<uint64> PacketsReceived;
+	std::atomic<uint64> PacketsDropped;
+	std::atomic<double> LastPacketSeconds;
+
+	/** Receive thread: decodes one datagram and queues it in the playout buffer */
+	void HandlePacket(const uint8* Data, int32 Size);
+
+	/** Receive thread: publishes every buffered frame whose release time has passed */
+	void ReleaseDueFrames(double NowSeconds);
+
+	/** Receive thread: how long the socket wait may block before the next buffered frame is due */
+	double GetReceiveWaitSeconds(double NowSeconds) const;
+
+	/** Drops buffered and ordering state when the sender restarts. Caller holds FrameLock. */
+	void ResetStreamLocked();
+
+	/** Publishes one frame from the buffer head. Caller holds FrameLock. */
+	void ReleaseFrameLocked(FPendingFrame& Pending);
+
+	/** Delay added on top of the zero-queueing arrival time. Caller holds FrameLock. */
+	double GetPlayoutDelayMsLocked() const;
+};
+
+/*=============================================================================
+    End of BeamNetworkDataSource.h
+=============================================================================*/
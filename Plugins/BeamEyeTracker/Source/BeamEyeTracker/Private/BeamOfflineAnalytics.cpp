@@ -0,0 +1,246 @@
+// Implements whole-session gaze analytics and their aggregation for offline tools
+
+#include "BeamOfflineAnalytics.h"
+#include "BeamExport.h"
+#include "BeamLogging.h"
+#include "HAL/FileManager.h"
+#include "Misc/Parse.h"
+
+//-----------------------------------------------------------------------------
+// FBeamSessionAnalysis
+//-----------------------------------------------------------------------------
+
+FBeamSessionAnalysis::FBeamSessionAnalysis(const FBeamAnalyticsWorkerConfig& InConfig)
+	: Config(InConfig)
+	, Analyzer(InConfig.MinFixationDuration, 0.0)
+	, SampleInterval(InConfig.SamplingRate > 0.0f ? 1.0 / InConfig.SamplingRate : 0.0)
+	, LastSampleSeconds(TNumericLimits<double>::Lowest())
+{
+	Analyzer.ReserveForRate(Config.SamplingRate);
+}
+
+void FBeamSessionAnalysis::AddFrame(double TimestampMs, const FVector2D& Screen01, double Confidence)
+{
+	++NumFrames;
+	ConfidenceSum += Confidence;
+	if (Screen01.X >= 0.0 && Screen01.X <= 1.0 && Screen01.Y >= 0.0 && Screen01.Y <= 1.0)
+	{
+		const int32 RegionX = FMath::Min(static_cast<int32>(Screen01.X * RegionsPerAxis), RegionsPerAxis - 1);
+		const int32 RegionY = FMath::Min(static_cast<int32>(Screen01.Y * RegionsPerAxis), RegionsPerAxis - 1);
+		RegionConfidenceSum[RegionY * RegionsPerAxis + RegionX] += Confidence;
+		++RegionFrames[RegionY * RegionsPerAxis + RegionX];
+	}
+
+	// Same gate and pacing as FBeamAnalyticsWorker::AddFrame
+	if (Confidence <= Config.MinConfidence)
+	{
+		return;
+	}
+	const double Seconds = TimestampMs * 0.001;
+	if (Seconds - LastSampleSeconds < SampleInterval)
+	{
+		return;
+	}
+	Analyzer.AddSample(Screen01, Seconds);
+	LastSampleSeconds = Seconds;
+}
+
+void FBeamSessionAnalysis::GetAnalytics(FGazeAnalytics& OutAnalytics) const
+{
+	Analyzer.Analyze(OutAnalytics);
+}
+
+void FBeamSessionAnalysis::GetResult(FBeamSessionResult& OutResult) const
+{
+	GetAnalytics(OutResult.Analytics);
+	GetCalibrationQuality(OutResult.Quality);
+	OutResult.NumFrames = NumFrames;
+	OutResult.bValid = true;
+}
+
+void FBeamSessionAnalysis::GetCalibrationQuality(FCalibrationQuality& OutQuality) const
+{
+	const float Overall = NumFrames > 0 ? static_cast<float>(100.0 * ConfidenceSum / NumFrames) : 0.0f;
+	OutQuality.OverallScore = Overall;
+	OutQuality.LeftEyeScore = 0.0f;
+	OutQuality.RightEyeScore = 0.0f;
+	OutQuality.bPerEyeScores = false;
+
+	OutQuality.CalibrationPoints.Reset(RegionsPerAxis * RegionsPerAxis);
+	OutQuality.PointScores.Reset(RegionsPerAxis * RegionsPerAxis);
+	for (int32 Region = 0; Region < RegionsPerAxis * RegionsPerAxis; ++Region)
+	{
+		OutQuality.CalibrationPoints.Add(FVector2D((Region % RegionsPerAxis + 0.5) / RegionsPerAxis, (Region / RegionsPerAxis + 0.5) / RegionsPerAxis));
+		OutQuality.PointScores.Add(RegionFrames[Region] > 0 ? static_cast<float>(100.0 * RegionConfidenceSum[Region] / RegionFrames[Region]) : 0.0f);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// FBeamAnalyticsAccumulator
+//-----------------------------------------------------------------------------
+
+void FBeamAnalyticsAccumulator::Add(const FGazeAnalytics& Analytics)
+{
+	FixationDurationSum += static_cast<double>(Analytics.AverageFixationDuration) * Analytics.FixationCount;
+	SaccadeVelocitySum += Analytics.SaccadeVelocity;
+	++NumSessions;
+
+	Totals.FixationCount += Analytics.FixationCount;
+	Totals.ScanPathLength += Analytics.ScanPathLength;
+	Totals.TimeStamp = FMath::Max(Totals.TimeStamp, Analytics.TimeStamp);
+}
+
+void FBeamAnalyticsAccumulator::Add(const FCalibrationQuality& Quality, int64 NumFrames)
+{
+	if (NumFrames <= 0)
+	{
+		return;
+	}
+
+	OverallScoreSum += static_cast<double>(Quality.OverallScore) * NumFrames;
+	if (Quality.bPerEyeScores)
+	{
+		LeftScoreSum += static_cast<double>(Quality.LeftEyeScore) * NumFrames;
+		RightScoreSum += static_cast<double>(Quality.RightEyeScore) * NumFrames;
+		PerEyeFrames += NumFrames;
+	}
+	if (Points.Num() == 0)
+	{
+		Points = Quality.CalibrationPoints;
+		PointScoreSums.SetNumZeroed(Points.Num());
+	}
+	for (int32 Point = 0; Point < PointScoreSums.Num() && Point < Quality.PointScores.Num(); ++Point)
+	{
+		PointScoreSums[Point] += static_cast<double>(Quality.PointScores[Point]) * NumFrames;
+	}
+	QualityFrames += NumFrames;
+}
+
+void FBeamAnalyticsAccumulator::Add(const FBeamSessionResult& Result)
+{
+	if (Result.bValid)
+	{
+		Add(Result.Analytics);
+		Add(Result.Quality, Result.NumFrames);
+	}
+}
+
+FGazeAnalytics FBeamAnalyticsAccumulator::GetAnalytics() const
+{
+	FGazeAnalytics Result = Totals;
+	if (Result.FixationCount > 0)
+	{
+		Result.AverageFixationDuration = static_cast<float>(FixationDurationSum / Result.FixationCount);
+	}
+	if (NumSessions > 0)
+	{
+		Result.SaccadeVelocity = static_cast<float>(SaccadeVelocitySum / NumSessions);
+	}
+	return Result;
+}
+
+FCalibrationQuality FBeamAnalyticsAccumulator::GetCalibrationQuality() const
+{
+	FCalibrationQuality Result;
+	if (QualityFrames <= 0)
+	{
+		return Result;
+	}
+
+	const double InvFrames = 1.0 / QualityFrames;
+	Result.OverallScore = static_cast<float>(OverallScoreSum * InvFrames);
+	if (PerEyeFrames > 0)
+	{
+		Result.LeftEyeScore = static_cast<float>(LeftScoreSum / PerEyeFrames);
+		Result.RightEyeScore = static_cast<float>(RightScoreSum / PerEyeFrames);
+		Result.bPerEyeScores = true;
+	}
+	Result.CalibrationPoints = Points;
+	for (const double Sum : PointScoreSums)
+	{
+		Result.PointScores.Add(static_cast<float>(Sum * InvFrames));
+	}
+	return Result;
+}
+
+//-----------------------------------------------------------------------------
+// BeamOfflineAnalytics
+//-----------------------------------------------------------------------------
+
+void BeamOfflineAnalytics::ParseConfig(const FString& Params, FBeamAnalyticsWorkerConfig& OutConfig)
+{
+	FParse::Value(*Params, TEXT("SamplingRate="), OutConfig.SamplingRate);
+	FParse::Value(*Params, TEXT("MinFixation="), OutConfig.MinFixationDuration);
+	FParse::Value(*Params, TEXT("MinConfidence="), OutConfig.MinConfidence);
+}
+
+void BeamOfflineAnalytics::AggregateByTag(TConstArrayView<FBeamSessionResult> Results, TMap<FString, FBeamAnalyticsAccumulator>& OutByTag)
+{
+	OutByTag.Reset();
+	for (const FBeamSessionResult& Result : Results)
+	{
+		if (Result.bValid)
+		{
+			OutByTag.FindOrAdd(Result.Tag).Add(Result);
+		}
+	}
+	OutByTag.KeySort([](const FString& A, const FString& B) { return A < B; });
+}
+
+void BeamOfflineAnalytics::LogByTag(const TMap<FString, FBeamAnalyticsAccumulator>& ByTag)
+{
+	for (const TPair<FString, FBeamAnalyticsAccumulator>& Pair : ByTag)
+	{
+		const FGazeAnalytics Analytics = Pair.Value.GetAnalytics();
+		const FCalibrationQuality Quality = Pair.Value.GetCalibrationQuality();
+		UE_LOG(LogBeam, Display, TEXT("  %-24s sessions %4d  fixations %8d  mean fixation %.3f s  saccade velocity %.3f  scan path %.2f  quality %.1f"),
+			*Pair.Key, Pair.Value.GetNumSessions(), Analytics.FixationCount, Analytics.AverageFixationDuration,
+			Analytics.SaccadeVelocity, Analytics.ScanPathLength, Quality.OverallScore);
+	}
+}
+
+bool BeamOfflineAnalytics::WriteReport(const FString& FilePath, TConstArrayView<FBeamSessionResult> Results, const TMap<FString, FBeamAnalyticsAccumulator>& ByTag)
+{
+	TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Archive)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Cannot write analytics report %s"), *FilePath);
+		return false;
+	}
+
+	FBeamCsvWriter Writer(*Archive);
+	Writer.WriteHeader("Scope,Name,Tag,Sessions,Frames,FixationCount,AverageFixationDuration,SaccadeVelocity,ScanPathLength,QualityScore");
+
+	auto WriteRow = [&Writer](const TCHAR* Scope, const TCHAR* Name, const TCHAR* Tag, int32 Sessions, int64 Frames, const FGazeAnalytics& Analytics, const FCalibrationQuality& Quality)
+	{
+		Writer.Add(Scope).Add(Name).Add(Tag).Add(Sessions).Add(Frames)
+			.Add(Analytics.FixationCount).Add(Analytics.AverageFixationDuration, 4).Add(Analytics.SaccadeVelocity, 4)
+			.Add(Analytics.ScanPathLength, 4).Add(Quality.OverallScore, 2);
+		Writer.EndRow();
+	};
+
+	FBeamAnalyticsAccumulator All;
+	int64 AllFrames = 0;
+	for (const FBeamSessionResult& Result : Results)
+	{
+		if (Result.bValid)
+		{
+			WriteRow(TEXT("Session"), *Result.Name, *Result.Tag, 1, Result.NumFrames, Result.Analytics, Result.Quality);
+			All.Add(Result);
+			AllFrames += Result.NumFrames;
+		}
+	}
+
+	for (const TPair<FString, FBeamAnalyticsAccumulator>& Pair : ByTag)
+	{
+		int64 TagFrames = 0;
+		for (const FBeamSessionResult& Result : Results)
+		{
+			TagFrames += Result.bValid && Result.Tag == Pair.Key ? Result.NumFrames : 0;
+		}
+		WriteRow(TEXT("Tag"), TEXT(""), *Pair.Key, Pair.Value.GetNumSessions(), TagFrames, Pair.Value.GetAnalytics(), Pair.Value.GetCalibrationQuality());
+	}
+	WriteRow(TEXT("All"), TEXT(""), TEXT(""), All.GetNumSessions(), AllFrames, All.GetAnalytics(), All.GetCalibrationQuality());
+
+	return Writer.Flush() && Archive->Close();
+}
@@ -0,0 +1,128 @@
+/*=============================================================================
+    BeamOfflineAnalytics.h: Whole-session gaze analytics for offline tools.
+
+    Runs the streaming fixation/saccade classifier over every sample of a
+    recorded session with the same confidence gate and tracker-clock
+    pacing as the live analytics worker, so bulk results match what a
+    session reported while it was played. Each instance is independent and
+    touches no shared state, which lets tools analyze any number of
+    sessions concurrently.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamAnalyticsWorker.h"
+#include "BeamGazeAnalyzer.h"
+
+/** Results of one analyzed session */
+struct FBeamSessionResult
+{
+	FString Name;
+
+	/** Grouping key, e.g. the level the session was played on */
+	FString Tag;
+
+	FGazeAnalytics Analytics;
+	FCalibrationQuality Quality;
+	int64 NumFrames = 0;
+
+	/** False when the session could not be read */
+	bool bValid = false;
+};
+
+/** Analytics of one session, fed in timestamp order */
+class FBeamSessionAnalysis
+{
+public:
+	/** Screen regions per axis used for the per-region tracking quality */
+	static constexpr int32 RegionsPerAxis = 3;
+
+	explicit FBeamSessionAnalysis(const FBeamAnalyticsWorkerConfig& InConfig);
+
+	/** Adds one recorded frame; frames at or below the confidence threshold only count towards tracking quality */
+	void AddFrame(double TimestampMs, const FVector2D& Screen01, double Confidence);
+
+	/** Fixation and saccade statistics over the whole session */
+	void GetAnalytics(FGazeAnalytics& OutAnalytics) const;
+
+	/** Fills analytics, quality and frame count of OutResult and marks it valid */
+	void GetResult(FBeamSessionResult& OutResult) const;
+
+	/**
+	 * Confidence-derived tracking quality: the mean recorded gaze confidence overall and per screen
+	 * region, 0-100. Recordings carry no per-eye data, so the eye scores are left unset.
+	 * This is not a measured accuracy; only a validation session produces that.
+	 */
+	void GetCalibrationQuality(FCalibrationQuality& OutQuality) const;
+
+	int64 GetNumFrames() const { return NumFrames; }
+
+private:
+	FBeamAnalyticsWorkerConfig Config;
+	FBeamGazeAnalyzer Analyzer;
+	double SampleInterval;
+	double LastSampleSeconds;
+
+	int64 NumFrames = 0;
+	double ConfidenceSum = 0.0;
+	double RegionConfidenceSum[RegionsPerAxis * RegionsPerAxis] = {};
+	int64 RegionFrames[RegionsPerAxis * RegionsPerAxis] = {};
+};
+
+/** Combines per-session results into one aggregate */
+class FBeamAnalyticsAccumulator
+{
+public:
+	/** Fixation duration is weighted by fixation count, saccade velocity by session; counts and scan paths are summed */
+	void Add(const FGazeAnalytics& Analytics);
+
+	/** Scores are weighted by the number of frames the session contributed */
+	void Add(const FCalibrationQuality& Quality, int64 NumFrames);
+
+	/** Adds both parts of a valid result; invalid ones are ignored */
+	void Add(const FBeamSessionResult& Result);
+
+	int32 GetNumSessions() const { return NumSessions; }
+
+	/** Fixation points are not carried over; an aggregate over many sessions would be unbounded */
+	FGazeAnalytics GetAnalytics() const;
+	FCalibrationQuality GetCalibrationQuality() const;
+
+private:
+	FGazeAnalytics Totals;
+	double FixationDurationSum = 0.0;
+	double SaccadeVelocitySum = 0.0;
+	int32 NumSessions = 0;
+
+	double OverallScoreSum = 0.0;
+	double LeftScoreSum = 0.0;
+	double RightScoreSum = 0.0;
+	int64 PerEyeFrames = 0;
+	TArray<FVector2D> Points;
+	TArray<double> PointScoreSums;
+	int64 QualityFrames = 0;
+};
+
+namespace BeamOfflineAnalytics
+{
+	/** Reads -SamplingRate=, -MinFixation= and -MinConfidence= from commandlet parameters over the defaults */
+	void ParseConfig(const FString& Params, FBeamAnalyticsWorkerConfig& OutConfig);
+
+	/** Accumulates valid results per tag */
+	void AggregateByTag(TConstArrayView<FBeamSessionResult> Results, TMap<FString, FBeamAnalyticsAccumulator>& OutByTag);
+
+	/** Logs one line per tag */
+	void LogByTag(const TMap<FString, FBeamAnalyticsAccumulator>& ByTag);
+
+	/** Writes a CSV with one row per session, one per tag and one for all sessions together */
+	bool WriteReport(const FString& FilePath, TConstArrayView<FBeamSessionResult> Results, const TMap<FString, FBeamAnalyticsAccumulator>& ByTag);
+}
+
+/*=============================================================================
+    End of BeamOfflineAnalytics.h
+=============================================================================*/
@@ -0,0 +1,307 @@
+// Implements saccade and blink window detection and the hidden-work queue
+
+#include "BeamPerceptualWindowSubsystem.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamRing.h"
+#include "BeamStats.h"
+#include "HAL/PlatformTime.h"
+#include "ShaderPipelineCache.h"
+#include "UObject/GarbageCollection.h"
+
+DECLARE_CYCLE_STAT(TEXT("Perceptual Window Detect"), STAT_BeamPerceptualDetect, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("Perceptual Window Work"), STAT_BeamPerceptualWork, STATGROUP_Beam);
+
+void UBeamPerceptualWindowSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// The tracking subsystem owns the ring the detector reads, so it must exist first
+	BeamSubsystem = Collection.InitializeDependency<UBeamEyeTrackerSubsystem>();
+	Scratch.Reserve(32);
+
+	// Every frame: a window lasts only a few engine frames
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UBeamPerceptualWindowSubsystem::Tick), 0.0f);
+}
+
+void UBeamPerceptualWindowSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	if (bWindowOpen)
+	{
+		CloseWindow();
+	}
+
+	// Queued work may hold references the caller expects to be released; it runs rather than being dropped
+	TArray<FHiddenWork> Remaining = MoveTemp(PendingWork);
+	for (FHiddenWork& Item : Remaining)
+	{
+		Item.Work();
+	}
+	PendingWork.Empty();
+	OnPerceptualWindow.Clear();
+	OnPerceptualWindowNative.Clear();
+	BeamSubsystem = nullptr;
+
+	Super::Deinitialize();
+}
+
+void UBeamPerceptualWindowSubsystem::RequestPerceptuallyHiddenWork(TFunction<void()> Work, float MaxDelaySeconds)
+{
+	check(IsInGameThread());
+
+	if (!Work)
+	{
+		return;
+	}
+
+	FHiddenWork& Item = PendingWork.AddDefaulted_GetRef();
+	Item.Work = MoveTemp(Work);
+	Item.DeadlineSeconds = FPlatformTime::Seconds() + FMath::Max(MaxDelaySeconds, 0.0f);
+}
+
+float UBeamPerceptualWindowSubsystem::GetWindowSecondsRemaining() const
+{
+	return bWindowOpen ? FMath::Max(static_cast<float>(WindowEndSeconds - FPlatformTime::Seconds()), 0.0f) : 0.0f;
+}
+
+void UBeamPerceptualWindowSubsystem::GetHiddenWorkStats(int32& OutWindowsOpened, int32& OutRunInWindow, int32& OutRunAtDeadline) const
+{
+	OutWindowsOpened = WindowsOpened;
+	OutRunInWindow = RunInWindow;
+	OutRunAtDeadline = RunAtDeadline;
+}
+
+bool UBeamPerceptualWindowSubsystem::Tick(float DeltaTime)
+{
+	DetectWindows();
+
+	if (bWindowOpen && FPlatformTime::Seconds() >= WindowEndSeconds)
+	{
+		CloseWindow();
+	}
+
+	if (bWindowOpen)
+	{
+		RunWindowWork();
+	}
+	RunOverdueWork();
+	return true;
+}
+
+void UBeamPerceptualWindowSubsystem::DetectWindows()
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamPerceptualDetect);
+
+	const FBeamFrameRing* Ring = BeamSubsystem ? BeamSubsystem->GetFrameRing() : nullptr;
+	FBeamFrame Latest;
+	if (!Ring || !Ring->ReadLatest(Latest))
+	{
+		bHasTimestamp = false;
+		return;
+	}
+
+	// Nothing new in the ring means nothing to classify
+	if (bHasTimestamp && Latest.SDKTimestampMs == LastTimestampMs)
+	{
+		return;
+	}
+
+	// On the first tick, or after the ring restarted with a new origin, only the newest frame is classified
+	const bool bRestart = !bHasTimestamp || Latest.SDKTimestampMs < LastTimestampMs;
+	Scratch.Reset();
+	if (bRestart)
+	{
+		Scratch.Add(Latest);
+		bPrevUsable = false;
+		bInSaccade = false;
+	}
+	else
+	{
+		Ring->CopyFramesInRange(LastTimestampMs, TNumericLimits<double>::Max(), Scratch);
+	}
+
+	for (const FBeamFrame& Frame : Scratch)
+	{
+		if (!bRestart && Frame.SDKTimestampMs <= LastTimestampMs)
+		{
+			continue;
+		}
+
+		// Gap filling keeps gaze valid through blinks, so synthesized gaze counts as closed eyes
+		const bool bUsable = Frame.Gaze.bValid && !Frame.bGazeSynthesized;
+		const double FrameSeconds = Frame.PublishedSeconds > 0.0 ? Frame.PublishedSeconds : FPlatformTime::Seconds();
+
+		if (!bUsable)
+		{
+			if (bPrevUsable)
+			{
+				OpenWindow(EBeamPerceptualWindowKind::Blink, FrameSeconds + BlinkWindowSeconds);
+			}
+			bInSaccade = false;
+		}
+		else
+		{
+			if (bWindowOpen && WindowKind == EBeamPerceptualWindowKind::Blink)
+			{
+				CloseWindow();
+			}
+
+			const double StepSeconds = (Frame.SDKTimestampMs - PrevSDKTimestampMs) * 0.001;
+			if (bPrevUsable && StepSeconds > 0.0)
+			{
+				const double Velocity = FVector2D::Distance(Frame.Gaze.Screen01, PrevGaze) / StepSeconds;
+				if (Velocity >= SaccadeOnsetVelocity)
+				{
+					if (!bInSaccade)
+					{
+						bInSaccade = true;
+						OpenWindow(EBeamPerceptualWindowKind::Saccade, FrameSeconds + SaccadeWindowSeconds);
+					}
+				}
+				else if (bInSaccade)
+				{
+					// Landed: vision is back
+					bInSaccade = false;
+					if (bWindowOpen && WindowKind == EBeamPerceptualWindowKind::Saccade)
+					{
+						CloseWindow();
+					}
+				}
+			}
+			PrevGaze = Frame.Gaze.Screen01;
+			PrevSDKTimestampMs = Frame.SDKTimestampMs;
+		}
+		bPrevUsable = bUsable;
+	}
+
+	LastTimestampMs = Latest.SDKTimestampMs;
+	bHasTimestamp = true;
+}
+
+void UBeamPerceptualWindowSubsystem::OpenWindow(EBeamPerceptualWindowKind Kind, double EndSeconds)
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	const double Remaining = EndSeconds - NowSeconds;
+	if (Remaining < MinWindowSeconds)
+	{
+		return;
+	}
+
+	// A blink during a saccade window extends it rather than opening a second one
+	const bool bWasOpen = bWindowOpen;
+	bWindowOpen = true;
+	WindowKind = Kind;
+	WindowEndSeconds = bWasOpen ? FMath::Max(WindowEndSeconds, EndSeconds) : EndSeconds;
+
+	// Taken from the window's start, so later ticks do not re-split an ever shorter remainder
+	const double BudgetEndSeconds = NowSeconds + Remaining * WorkBudgetFraction;
+	WorkBudgetEndSeconds = bWasOpen ? FMath::Max(WorkBudgetEndSeconds, BudgetEndSeconds) : BudgetEndSeconds;
+	if (bWasOpen)
+	{
+		return;
+	}
+
+	++WindowsOpened;
+
+	// Fast or Precompile was chosen by someone else (a loading screen) and is at least as fast already
+	ShaderBatchModeAtOpen = ShaderBatchMode;
+	if (bFastShaderPrecompileInWindows && ShaderBatchModeAtOpen == EBeamShaderBatchMode::Background)
+	{
+		ApplyShaderBatchMode(EBeamShaderBatchMode::Fast);
+		bWindowChangedBatchMode = true;
+	}
+
+	OnPerceptualWindowNative.Broadcast(Kind, static_cast<float>(Remaining));
+	OnPerceptualWindow.Broadcast(Kind, static_cast<float>(Remaining));
+}
+
+void UBeamPerceptualWindowSubsystem::CloseWindow()
+{
+	bWindowOpen = false;
+	if (bWindowChangedBatchMode)
+	{
+		ApplyShaderBatchMode(ShaderBatchModeAtOpen);
+		bWindowChangedBatchMode = false;
+	}
+}
+
+void UBeamPerceptualWindowSubsystem::SetShaderBatchMode(EBeamShaderBatchMode Mode)
+{
+	check(IsInGameThread());
+
+	ShaderBatchMode = Mode;
+	if (bWindowChangedBatchMode)
+	{
+		// The open window restores this mode on close instead of the one it found
+		ShaderBatchModeAtOpen = Mode;
+		if (Mode == EBeamShaderBatchMode::Background)
+		{
+			return;
+		}
+		bWindowChangedBatchMode = false;
+	}
+	ApplyShaderBatchMode(Mode);
+}
+
+void UBeamPerceptualWindowSubsystem::ApplyShaderBatchMode(EBeamShaderBatchMode Mode)
+{
+	switch (Mode)
+	{
+	case EBeamShaderBatchMode::Fast: FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Fast); break;
+	case EBeamShaderBatchMode::Precompile: FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Precompile); break;
+	default: FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Background); break;
+	}
+}
+
+void UBeamPerceptualWindowSubsystem::RunWindowWork()
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamPerceptualWork);
+
+	const double BudgetEndSeconds = WorkBudgetEndSeconds;
+
+	// Oldest request first; each item is started only while budget remains
+	while (PendingWork.Num() > 0 && FPlatformTime::Seconds() < BudgetEndSeconds)
+	{
+		// Moved out first: the work may queue more work
+		TFunction<void()> Work = MoveTemp(PendingWork[0].Work);
+		PendingWork.RemoveAt(0, EAllowShrinking::No);
+		Work();
+		++RunInWindow;
+	}
+
+	if (bPurgeGarbageInWindows && IsIncrementalPurgePending())
+	{
+		const double PurgeSeconds = BudgetEndSeconds - FPlatformTime::Seconds();
+		if (PurgeSeconds > 0.0)
+		{
+			IncrementalPurgeGarbage(true, PurgeSeconds);
+		}
+	}
+}
+
+void UBeamPerceptualWindowSubsystem::RunOverdueWork()
+{
+	if (PendingWork.Num() == 0)
+	{
+		return;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < PendingWork.Num();)
+	{
+		if (PendingWork[Index].DeadlineSeconds <= NowSeconds)
+		{
+			// Moved out first: the work may queue more work
+			TFunction<void()> Work = MoveTemp(PendingWork[Index].Work);
+			PendingWork.RemoveAt(Index, EAllowShrinking::No);
+			Work();
+			++RunAtDeadline;
+		}
+		else
+		{
+			++Index;
+		}
+	}
+}
@@ -0,0 +1,198 @@
+/*=============================================================================
+    BeamPipeline.h: Compile-time composed per-frame processing chains.
+
+    Quality gating, outlier rejection and confidence-adaptive smoothing are
+    stateless stage types over a shared context. TBeamPipeline folds a
+    fixed list of them into one loop over a batch of frames, so a chain
+    carries no per-frame checks for stages it does not contain. Every
+    combination is instantiated up front and the enabled stages pick one
+    of them, once per batch.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamFilters.h"
+
+/** Settings the stages read and the sample they compare against, filled by the owner for one run */
+struct FBeamPipelineContext
+{
+	// Quality gating
+	float MinGazeConfidence = 0.0f;
+	float MinHeadPoseConfidence = 0.0f;
+	double MaxAgeSeconds = 0.0;
+	double NowSeconds = 0.0;
+
+	// Outlier rejection, squared so the stage needs no square root
+	double GazeOutlierPxSq = 0.0;
+	double HeadOutlierCmSq = 0.0;
+
+	// Smoothing; only chains with the smoothing stage read the filter, and it is set whenever they are selected
+	FOneEuroFilter* GazeFilter = nullptr;
+	float LowConfidenceSmoothingMultiplier = 1.0f;
+
+	/** Raw predecessor of the frame being processed; the pipeline advances it after every frame */
+	FGazePoint PreviousGaze;
+	FHeadPose PreviousHead;
+
+	/** Newest samples the outlier stage let through; it measures jumps from these */
+	FGazePoint AcceptedGaze;
+	FHeadPose AcceptedHead;
+};
+
+/** Drops low-confidence and stale channels */
+struct FBeamQualityGateStage
+{
+	static FORCEINLINE bool IsStale(const FBeamFrame& Frame, const FBeamPipelineContext& Context)
+	{
+		// Capture time on the local clock; SDKTimestampMs is on the tracker's clock and not comparable
+		return Frame.UETimestampSeconds > 0.0 && Context.NowSeconds - Frame.UETimestampSeconds > Context.MaxAgeSeconds;
+	}
+
+	/** True when no channel of Frame would be dropped */
+	static FORCEINLINE bool Passes(const FBeamFrame& Frame, const FBeamPipelineContext& Context)
+	{
+		return !(Frame.Gaze.bValid && Frame.Gaze.Confidence < Context.MinGazeConfidence)
+			&& Frame.Head.Confidence >= Context.MinHeadPoseConfidence
+			&& !IsStale(Frame, Context);
+	}
+
+	static FORCEINLINE void Process(FBeamFrame& Frame, FBeamPipelineContext& Context)
+	{
+		const bool bStale = IsStale(Frame, Context);
+		Frame.Gaze.bValid = Frame.Gaze.bValid && !bStale && Frame.Gaze.Confidence >= Context.MinGazeConfidence;
+		if (bStale || Frame.Head.Confidence < Context.MinHeadPoseConfidence)
+		{
+			Frame.Head.PositionCm = FVector::ZeroVector;
+			Frame.Head.SetRotation(FQuat::Identity);
+		}
+	}
+};
+
+/**
+ * Rejects jumps from the last accepted sample larger than the thresholds.
+ * A sample that also jumped from its raw predecessor is an outlier; one that
+ * stays close to it means the signal settled somewhere new, and it is
+ * accepted so the gate cannot lock onto a stale position.
+ */
+struct FBeamOutlierStage
+{
+	static FORCEINLINE void Process(FBeamFrame& Frame, FBeamPipelineContext& Context)
+	{
+		if (Frame.Gaze.bValid && Context.AcceptedGaze.bValid && Context.PreviousGaze.bValid
+			&& FVector2D::DistSquared(Frame.Gaze.ScreenPx, Context.AcceptedGaze.ScreenPx) > Context.GazeOutlierPxSq
+			&& FVector2D::DistSquared(Frame.Gaze.ScreenPx, Context.PreviousGaze.ScreenPx) > Context.GazeOutlierPxSq)
+		{
+			Frame.Gaze.bValid = false;
+		}
+		if (Frame.Gaze.bValid)
+		{
+			Context.AcceptedGaze = Frame.Gaze;
+		}
+
+		// A jumped head pose falls back to the accepted one rather than being dropped; a reset pose is no reference
+		const FHeadPose& Accepted = Context.AcceptedHead;
+		if (!Frame.Head.PositionCm.IsZero() && !Accepted.PositionCm.IsZero() && !Context.PreviousHead.PositionCm.IsZero()
+			&& FVector::DistSquared(Frame.Head.PositionCm, Accepted.PositionCm) > Context.HeadOutlierCmSq
+			&& FVector::DistSquared(Frame.Head.PositionCm, Context.PreviousHead.PositionCm) > Context.HeadOutlierCmSq)
+		{
+			Frame.Head.PositionCm = Accepted.PositionCm;
+			Frame.Head.SetRotation(Accepted.RotationQuat);
+		}
+		else if (!Frame.Head.PositionCm.IsZero())
+		{
+			Context.AcceptedHead = Frame.Head;
+		}
+	}
+};
+
+/** Smooths more strongly while confidence is low */
+struct FBeamSmoothingStage
+{
+	static FORCEINLINE void Process(FBeamFrame& Frame, FBeamPipelineContext& Context)
+	{
+		checkSlow(Context.GazeFilter);
+
+		if (Frame.Gaze.bValid)
+		{
+			const float Multiplier = Frame.Gaze.Confidence < 0.7f ? Context.LowConfidenceSmoothingMultiplier : 1.0f;
+			Frame.Gaze.ScreenPx = Context.GazeFilter->Filter(Frame.Gaze.ScreenPx, Frame.DeltaTimeSeconds * Multiplier);
+		}
+
+		// Blends from the previous head position; a reset predecessor has none to blend from
+		if (Frame.Head.Confidence > 0.5f && !Context.PreviousHead.PositionCm.IsZero())
+		{
+			const float Multiplier = Frame.Head.Confidence < 0.7f ? Context.LowConfidenceSmoothingMultiplier : 1.0f;
+			Frame.Head.PositionCm = FMath::Lerp(Context.PreviousHead.PositionCm, Frame.Head.PositionCm, 1.0f / Multiplier);
+		}
+	}
+};
+
+/**
+ * A fixed chain of stages run in order over every frame of a batch.
+ *
+ * Each stage is a type with a static Process(FBeamFrame&, FBeamPipelineContext&);
+ * the fold expands to direct calls, so the whole chain inlines into the
+ * loop body. The raw sample is captured before the first stage and becomes
+ * the next frame's predecessor, whatever the stages changed.
+ */
+template <typename... Stages>
+struct TBeamPipeline
+{
+	static void Run(TArrayView<FBeamFrame> Frames, FBeamPipelineContext& Context)
+	{
+		for (FBeamFrame& Frame : Frames)
+		{
+			const FGazePoint RawGaze = Frame.Gaze;
+			const FHeadPose RawHead = Frame.Head;
+
+			(Stages::Process(Frame, Context), ...);
+
+			Context.PreviousGaze = RawGaze;
+			Context.PreviousHead = RawHead;
+		}
+	}
+};
+
+/** Stages a chain contains; every combination has an instantiation */
+enum class EBeamPipelineStages : uint8
+{
+	None				= 0,
+	QualityGate			= 1 << 0,
+	OutlierRejection	= 1 << 1,
+	Smoothing			= 1 << 2,
+	All					= QualityGate | OutlierRejection | Smoothing
+};
+ENUM_CLASS_FLAGS(EBeamPipelineStages);
+
+using FBeamPipelineRunFn = void (*)(TArrayView<FBeamFrame>, FBeamPipelineContext&);
+
+/** The chain running exactly Stages, always in gate, outlier, smoothing order */
+inline FBeamPipelineRunFn SelectBeamPipeline(EBeamPipelineStages Stages)
+{
+	// Indexed by the stage bits
+	static constexpr FBeamPipelineRunFn Chains[] =
+	{
+		&TBeamPipeline<>::Run,
+		&TBeamPipeline<FBeamQualityGateStage>::Run,
+		&TBeamPipeline<FBeamOutlierStage>::Run,
+		&TBeamPipeline<FBeamQualityGateStage, FBeamOutlierStage>::Run,
+		&TBeamPipeline<FBeamSmoothingStage>::Run,
+		&TBeamPipeline<FBeamQualityGateStage, FBeamSmoothingStage>::Run,
+		&TBeamPipeline<FBeamOutlierStage, FBeamSmoothingStage>::Run,
+		&TBeamPipeline<FBeamQualityGateStage, FBeamOutlierStage, FBeamSmoothingStage>::Run
+	};
+	static_assert(UE_ARRAY_COUNT(Chains) == static_cast<uint8>(EBeamPipelineStages::All) + 1, "One chain per stage combination");
+
+	return Chains[static_cast<uint8>(Stages & EBeamPipelineStages::All)];
+}
+
+/*=============================================================================
+    End of BeamPipeline.h
+=============================================================================*/
@@ -0,0 +1,62 @@
+// Implements the producer wake strategy selection
+
+#include "BeamPollingScheduler.h"
+
+namespace BeamPollingScheduler
+{
+	static FBeamProducerSchedule MakeTimedPoll(float RateHz)
+	{
+		FBeamProducerSchedule Schedule;
+		Schedule.Mode = EBeamProducerWakeMode::TimedPoll;
+		Schedule.IntervalMs = static_cast<uint32>(FMath::Clamp(FMath::RoundToInt(1000.0f / FMath::Max(RateHz, 0.001f)), 1, 1000));
+		return Schedule;
+	}
+
+	FBeamProducerSchedule Choose(const FBeamPollingInputs& Inputs, const FBeamPollingPolicy& Policy)
+	{
+		FBeamProducerSchedule Schedule;
+		Schedule.IntervalMs = static_cast<uint32>(FMath::Clamp(Policy.WaitTimeoutMs, 1, 1000));
+		if (!Policy.bAdaptive)
+		{
+			Schedule.Mode = EBeamProducerWakeMode::BlockingWait;
+			return Schedule;
+		}
+
+		// Nobody is looking at a hidden window; a slow poll still keeps health and stall detection alive
+		if (Inputs.bMinimized)
+		{
+			return MakeTimedPoll(static_cast<float>(Policy.MinimizedPollingHz));
+		}
+		if (!Inputs.bHasFocus)
+		{
+			return MakeTimedPoll(static_cast<float>(Policy.BackgroundPollingHz));
+		}
+
+		// On battery, frames the engine will never consume are not worth a wake-up
+		float TargetHz = static_cast<float>(FMath::Max(Inputs.PollingHz, 1));
+		if (Inputs.bOnBattery && Policy.bThrottleOnBattery && Inputs.EngineHz > 0.0f)
+		{
+			TargetHz = FMath::Min(TargetHz, Inputs.EngineHz);
+		}
+
+		// Waiting costs one wake per tracker frame, so only poll when the tracker clearly outruns the target
+		if (Inputs.TrackerHz > TargetHz * 1.1f)
+		{
+			return MakeTimedPoll(TargetHz);
+		}
+
+		Schedule.Mode = EBeamProducerWakeMode::EventDriven;
+		return Schedule;
+	}
+
+	float UpdateRateEstimate(float CurrentHz, double IntervalSeconds)
+	{
+		if (IntervalSeconds <= 0.0 || IntervalSeconds >= 1.0)
+		{
+			return CurrentHz;
+		}
+
+		const float SampleHz = static_cast<float>(1.0 / IntervalSeconds);
+		return CurrentHz > 0.0f ? CurrentHz + 0.1f * (SampleHz - CurrentHz) : SampleHz;
+	}
+}
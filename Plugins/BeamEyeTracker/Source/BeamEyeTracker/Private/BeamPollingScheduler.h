@@ -0,0 +1,73 @@
+/*=============================================================================
+    BeamPollingScheduler.h: Wake strategy selection for the producer thread.
+
+    The game thread samples the observed tracker rate, the engine frame
+    rate, window focus and power state a few times a second and turns them
+    into a schedule. The producer reads the schedule with one atomic load
+    per wake: in focus it waits on the source for the lowest latency, out
+    of focus or minimized it sleeps between polls so the thread costs
+    next to nothing.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+
+/** Conditions the schedule is derived from; rates are 0 while unknown */
+struct FBeamPollingInputs
+{
+	float TrackerHz = 0.0f;
+	float EngineHz = 0.0f;
+	int32 PollingHz = 120;
+	bool bHasFocus = true;
+	bool bMinimized = false;
+	bool bOnBattery = false;
+};
+
+/** Limits taken from the project settings */
+struct FBeamPollingPolicy
+{
+	bool bAdaptive = true;
+	int32 WaitTimeoutMs = 100;
+	int32 BackgroundPollingHz = 10;
+	int32 MinimizedPollingHz = 1;
+	bool bThrottleOnBattery = true;
+};
+
+/** Producer wake strategy; IntervalMs is the wait timeout for the waiting modes and the sleep for TimedPoll */
+struct FBeamProducerSchedule
+{
+	EBeamProducerWakeMode Mode = EBeamProducerWakeMode::BlockingWait;
+	uint32 IntervalMs = 100;
+
+	/** Single word so the producer reads mode and interval consistently with one load */
+	uint32 Pack() const { return (static_cast<uint32>(Mode) << 24) | (IntervalMs & 0x00FFFFFFu); }
+	static FBeamProducerSchedule Unpack(uint32 Packed)
+	{
+		FBeamProducerSchedule Schedule;
+		Schedule.Mode = static_cast<EBeamProducerWakeMode>(Packed >> 24);
+		Schedule.IntervalMs = Packed & 0x00FFFFFFu;
+		return Schedule;
+	}
+
+	bool operator==(const FBeamProducerSchedule& Other) const { return Mode == Other.Mode && IntervalMs == Other.IntervalMs; }
+	bool operator!=(const FBeamProducerSchedule& Other) const { return !(*this == Other); }
+};
+
+namespace BeamPollingScheduler
+{
+	/** Picks the wake strategy; EventDriven is requested whenever waiting is preferred, the producer falls back to BlockingWait for sources that cannot signal */
+	FBeamProducerSchedule Choose(const FBeamPollingInputs& Inputs, const FBeamPollingPolicy& Policy);
+
+	/** Folds one tracker frame interval into a running rate estimate; intervals outside (0, 1 s) are ignored */
+	float UpdateRateEstimate(float CurrentHz, double IntervalSeconds);
+}
+
+/*=============================================================================
+    End of BeamPollingScheduler.h
+=============================================================================*/
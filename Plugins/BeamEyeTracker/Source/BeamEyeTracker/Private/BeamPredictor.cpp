@@ -0,0 +1,221 @@
+// Implements constant-velocity and Kalman gaze prediction with saccade-aware horizon clamping
+
+#include "BeamPredictor.h"
+#include "HAL/PlatformTime.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/App.h"
+
+// FKalmanAxis Implementation
+
+void FBeamGazePredictor::FKalmanAxis::Init(double Measurement)
+{
+	Position = Measurement;
+	Velocity = 0.0;
+	P00 = 1.0;
+	P01 = 0.0;
+	P11 = 1.0;
+}
+
+void FBeamGazePredictor::FKalmanAxis::Update(double Measurement, double DeltaSeconds, double ProcessNoise, double MeasurementNoise)
+{
+	// Predict: x = F x, P = F P F' + Q with a continuous white-acceleration Q
+	const double Dt = DeltaSeconds;
+	const double Dt2 = Dt * Dt;
+	Position += Velocity * Dt;
+
+	const double NewP00 = P00 + 2.0 * Dt * P01 + Dt2 * P11 + ProcessNoise * Dt2 * Dt / 3.0;
+	const double NewP01 = P01 + Dt * P11 + ProcessNoise * Dt2 * 0.5;
+	const double NewP11 = P11 + ProcessNoise * Dt;
+
+	// Correct with the position measurement
+	const double Innovation = Measurement - Position;
+	const double S = NewP00 + MeasurementNoise;
+	if (S <= 0.0)
+	{
+		return;
+	}
+
+	const double K0 = NewP00 / S;
+	const double K1 = NewP01 / S;
+	Position += K0 * Innovation;
+	Velocity += K1 * Innovation;
+
+	P00 = (1.0 - K0) * NewP00;
+	P01 = (1.0 - K0) * NewP01;
+	P11 = NewP11 - K1 * NewP01;
+}
+
+// FBeamGazePredictor Implementation
+
+FBeamGazePredictor::FBeamGazePredictor(const FBeamPredictorParams& InParams)
+	: Params(InParams)
+	, bHasLast(false)
+	, bHasPrevious(false)
+	, ConstantGazeVelocity(FVector2D::ZeroVector)
+{
+}
+
+void FBeamGazePredictor::AddSample(const FBeamFrame& Frame)
+{
+	if (bHasLast && Frame.FrameId <= LastFrame.FrameId)
+	{
+		return; // Already seen
+	}
+
+	if (!bHasLast)
+	{
+		LastFrame = Frame;
+		bHasLast = true;
+		GazeAxes[0].Init(Frame.Gaze.Screen01.X);
+		GazeAxes[1].Init(Frame.Gaze.Screen01.Y);
+		return;
+	}
+
+	PreviousFrame = LastFrame;
+	LastFrame = Frame;
+	bHasPrevious = true;
+
+	// A tracking loss breaks the motion history; restart from the new sample
+	if (!PreviousFrame.Gaze.bValid || !LastFrame.Gaze.bValid)
+	{
+		ConstantGazeVelocity = FVector2D::ZeroVector;
+		GazeAxes[0].Init(Frame.Gaze.Screen01.X);
+		GazeAxes[1].Init(Frame.Gaze.Screen01.Y);
+		return;
+	}
+
+	const double DeltaSeconds = (LastFrame.SDKTimestampMs - PreviousFrame.SDKTimestampMs) * 0.001;
+	if (DeltaSeconds <= 0.0)
+	{
+		return;
+	}
+
+	ConstantGazeVelocity = (LastFrame.Gaze.Screen01 - PreviousFrame.Gaze.Screen01) / DeltaSeconds;
+	GazeAxes[0].Update(LastFrame.Gaze.Screen01.X, DeltaSeconds, Params.ProcessNoise, Params.MeasurementNoise);
+	GazeAxes[1].Update(LastFrame.Gaze.Screen01.Y, DeltaSeconds, Params.ProcessNoise, Params.MeasurementNoise);
+}
+
+FVector2D FBeamGazePredictor::GetGazeVelocity() const
+{
+	// A Kalman-filtered stream already carries its velocity; differencing filtered positions would only add lag
+	if (Params.Model != EBeamPredictionModel::None && bHasLast && LastFrame.bHasVelocity && LastFrame.Gaze.bValid)
+	{
+		return LastFrame.GazeVelocity01;
+	}
+
+	switch (Params.Model)
+	{
+	case EBeamPredictionModel::ConstantVelocity:
+		return ConstantGazeVelocity;
+	case EBeamPredictionModel::Kalman:
+		return FVector2D(GazeAxes[0].Velocity, GazeAxes[1].Velocity);
+	default:
+		return FVector2D::ZeroVector;
+	}
+}
+
+bool FBeamGazePredictor::IsInSaccade() const
+{
+	return GetGazeVelocity().Size() > Params.SaccadeVelocityThreshold;
+}
+
+double FBeamGazePredictor::GetEffectiveHorizonMs(double HorizonMs) const
+{
+	const double Speed = GetGazeVelocity().Size();
+	if (Speed < Params.FixationVelocityThreshold)
+	{
+		return 0.0; // Extrapolating fixation jitter only amplifies noise
+	}
+
+	double Limit = Params.MaxHorizonMs;
+	if (Speed > Params.SaccadeVelocityThreshold)
+	{
+		Limit = FMath::Min(Limit, static_cast<double>(Params.SaccadeMaxHorizonMs));
+	}
+	return FMath::Clamp(HorizonMs, 0.0, Limit);
+}
+
+FGazePoint FBeamGazePredictor::PredictGaze(const FGazePoint& Sample, double HorizonMs) const
+{
+	FGazePoint Predicted = Sample;
+	if (Params.Model == EBeamPredictionModel::None || !Sample.bValid || !(bHasPrevious || (bHasLast && LastFrame.bHasVelocity)))
+	{
+		return Predicted;
+	}
+
+	const double HorizonSeconds = GetEffectiveHorizonMs(HorizonMs) * 0.001;
+	const FVector2D Offset = GetGazeVelocity() * HorizonSeconds;
+	Predicted.Screen01 = FVector2D(
+		FMath::Clamp(Sample.Screen01.X + Offset.X, 0.0, 1.0),
+		FMath::Clamp(Sample.Screen01.Y + Offset.Y, 0.0, 1.0));
+
+	// Pixels follow the normalized move using the sample's own pixels-per-unit scale
+	const FVector2D Moved = Predicted.Screen01 - Sample.Screen01;
+	if (!FMath::IsNearlyZero(Sample.Screen01.X))
+	{
+		Predicted.ScreenPx.X += Moved.X * (Sample.ScreenPx.X / Sample.Screen01.X);
+	}
+	if (!FMath::IsNearlyZero(Sample.Screen01.Y))
+	{
+		Predicted.ScreenPx.Y += Moved.Y * (Sample.ScreenPx.Y / Sample.Screen01.Y);
+	}
+
+	Predicted.TimestampMs = Sample.TimestampMs + HorizonMs;
+	return Predicted;
+}
+
+bool FBeamGazePredictor::Predict(double HorizonMs, FBeamFrame& OutFrame) const
+{
+	if (!bHasLast)
+	{
+		return false;
+	}
+
+	OutFrame = LastFrame;
+	OutFrame.Gaze = PredictGaze(LastFrame.Gaze, HorizonMs);
+
+	// Head motion is smooth enough for constant velocity under either model
+	const double HeadHorizonSeconds = FMath::Clamp(HorizonMs, 0.0, static_cast<double>(Params.MaxHorizonMs)) * 0.001;
+	if (Params.Model != EBeamPredictionModel::None && LastFrame.bHasVelocity && LastFrame.Head.Confidence > 0.0)
+	{
+		OutFrame.Head.PositionCm += LastFrame.HeadVelocityCm * HeadHorizonSeconds;
+		OutFrame.Head.SetRotation((LastFrame.Head.Rotation + LastFrame.HeadAngularVelocityDeg * HeadHorizonSeconds).GetNormalized());
+	}
+	else if (Params.Model != EBeamPredictionModel::None && bHasPrevious
+		&& LastFrame.Head.Confidence > 0.0 && PreviousFrame.Head.Confidence > 0.0)
+	{
+		const double DeltaSeconds = (LastFrame.SDKTimestampMs - PreviousFrame.SDKTimestampMs) * 0.001;
+		if (DeltaSeconds > 0.0)
+		{
+			const double Scale = HeadHorizonSeconds / DeltaSeconds;
+			OutFrame.Head.PositionCm += (LastFrame.Head.PositionCm - PreviousFrame.Head.PositionCm) * Scale;
+			OutFrame.Head.SetRotation(BeamRotation::Extrapolate(PreviousFrame.Head.RotationQuat, LastFrame.Head.RotationQuat, Scale));
+		}
+	}
+
+	OutFrame.SDKTimestampMs = LastFrame.SDKTimestampMs + HorizonMs;
+	OutFrame.UETimestampSeconds = LastFrame.UETimestampSeconds + HorizonMs * 0.001;
+	OutFrame.Head.TimestampMs = LastFrame.Head.TimestampMs + HorizonMs;
+	return true;
+}
+
+void FBeamGazePredictor::Reset()
+{
+	bHasLast = false;
+	bHasPrevious = false;
+	ConstantGazeVelocity = FVector2D::ZeroVector;
+	GazeAxes[0] = FKalmanAxis();
+	GazeAxes[1] = FKalmanAxis();
+}
+
+void FBeamGazePredictor::UpdateParams(const FBeamPredictorParams& NewParams)
+{
+	Params = NewParams;
+}
+
+double FBeamGazePredictor::GetDisplayHorizonMs(double SampleUETimestampSeconds, float RenderLatencyFrames)
+{
+	const double SampleAgeMs = FMath::Max(0.0, (FPlatformTime::Seconds() - SampleUETimestampSeconds) * 1000.0);
+	const double FramePeriodMs = FMath::Max(0.0, FApp::GetDeltaTime() * 1000.0);
+	return SampleAgeMs + FramePeriodMs * FMath::Max(0.0f, RenderLatencyFrames);
+}
@@ -4,7 +4,322 @@
 #include "HAL/FileManager.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Async/MappedFileHandle.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/Compression.h"
 #include "BeamLogging.h"
+#include "BeamStats.h"
+#include "BeamResources.h"
+#include <atomic>
+
+DEFINE_STAT(STAT_BeamRecordingMemory);
+
+namespace BeamRecordingCodec
+{
+	using FFrameRecord = FBeamRecording::FFrameRecord;
+
+	// Int32 columns first, then uint16 columns, so every column stays naturally aligned
+	static constexpr int32 EncodedBytesPerFrame = 11 * sizeof(int32) + 4 * sizeof(uint16);
+
+	// Quantization steps, all well below tracker noise
+	static constexpr double GazeMin = -0.5;
+	static constexpr double GazeRange = 2.0; // Off-screen gaze up to half a screen out survives
+	static constexpr double HeadPositionStepCm = 0.001;
+	static constexpr double HeadRotationStepDeg = 0.001;
+
+	struct FColumns
+	{
+		int32* TimestampDelta;
+		float* GazePxX;
+		float* GazePxY;
+		int32* HeadPositionDelta[3];
+		int32* HeadRotationDelta[3];
+		uint16* GazeX;
+		uint16* GazeY;
+		uint16* GazeConfidence;
+		uint16* HeadConfidence;
+
+		FColumns(uint8* Base, int32 Num)
+		{
+			int32* IntColumns = reinterpret_cast<int32*>(Base);
+			TimestampDelta = IntColumns;
+			GazePxX = reinterpret_cast<float*>(IntColumns + Num);
+			GazePxY = reinterpret_cast<float*>(IntColumns + 2 * Num);
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				HeadPositionDelta[Axis] = IntColumns + (3 + Axis) * Num;
+				HeadRotationDelta[Axis] = IntColumns + (6 + Axis) * Num;
+			}
+			uint16* ShortColumns = reinterpret_cast<uint16*>(IntColumns + 9 * Num);
+			GazeX = ShortColumns;
+			GazeY = ShortColumns + Num;
+			GazeConfidence = ShortColumns + 2 * Num;
+			HeadConfidence = ShortColumns + 3 * Num;
+		}
+	};
+
+	static uint16 Quantize16(double Value, double Min, double Range)
+	{
+		return static_cast<uint16>(FMath::Clamp(FMath::RoundToInt((Value - Min) * (65535.0 / Range)), 0, 65535));
+	}
+
+	static double Dequantize16(uint16 Value, double Min, double Range)
+	{
+		return Min + Value * (Range / 65535.0);
+	}
+
+	/** Delta of a quantized value against the previously reconstructed one, so error never accumulates */
+	static int32 EncodeDelta(double Value, double Step, int64& InOutPrevious)
+	{
+		const int64 Quantized = FMath::RoundToInt64(Value / Step);
+		const int32 Delta = static_cast<int32>(FMath::Clamp<int64>(Quantized - InOutPrevious, MIN_int32, MAX_int32));
+		InOutPrevious += Delta;
+		return Delta;
+	}
+
+	static double DecodeDelta(int32 Delta, double Step, int64& InOutPrevious)
+	{
+		InOutPrevious += Delta;
+		return InOutPrevious * Step;
+	}
+
+	/** Codec actually used for a requested compression mode on this platform */
+	static EBeamRecordingCompression Resolve(EBeamRecordingCompression Requested)
+	{
+		if (Requested == EBeamRecordingCompression::Oodle && !FCompression::IsFormatValid(NAME_Oodle))
+		{
+			return EBeamRecordingCompression::Zlib;
+		}
+		return Requested;
+	}
+
+	static FName GetFormatName(EBeamRecordingCompression Codec)
+	{
+		return Codec == EBeamRecordingCompression::Oodle ? NAME_Oodle : NAME_Zlib;
+	}
+
+	static void Encode(const TArray<FFrameRecord>& Records, TArray<uint8>& OutEncoded)
+	{
+		const int32 Num = Records.Num();
+		OutEncoded.SetNumUninitialized(Num * EncodedBytesPerFrame);
+		FColumns Columns(OutEncoded.GetData(), Num);
+
+		uint64 PreviousTimestamp = Records[0].Timestamp;
+		int64 PreviousPosition[3] = { 0, 0, 0 };
+		int64 PreviousRotation[3] = { 0, 0, 0 };
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const FFrameRecord& Record = Records[i];
+			Columns.TimestampDelta[i] = static_cast<int32>(Record.Timestamp - PreviousTimestamp);
+			PreviousTimestamp = Record.Timestamp;
+
+			Columns.GazeX[i] = Quantize16(Record.GazeScreen01.X, GazeMin, GazeRange);
+			Columns.GazeY[i] = Quantize16(Record.GazeScreen01.Y, GazeMin, GazeRange);
+			Columns.GazePxX[i] = static_cast<float>(Record.GazeScreenPx.X);
+			Columns.GazePxY[i] = static_cast<float>(Record.GazeScreenPx.Y);
+			Columns.GazeConfidence[i] = Quantize16(Record.GazeConfidence, 0.0, 1.0);
+			Columns.HeadConfidence[i] = Quantize16(Record.HeadConfidence, 0.0, 1.0);
+
+			const double Rotation[3] = { Record.HeadRotation.Pitch, Record.HeadRotation.Yaw, Record.HeadRotation.Roll };
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Columns.HeadPositionDelta[Axis][i] = EncodeDelta(Record.HeadPosition[Axis], HeadPositionStepCm, PreviousPosition[Axis]);
+				Columns.HeadRotationDelta[Axis][i] = EncodeDelta(Rotation[Axis], HeadRotationStepDeg, PreviousRotation[Axis]);
+			}
+		}
+	}
+
+	/** Inflates and unpacks one v3 chunk payload into Header.FrameCount records */
+	static bool Decode(const FBeamRecording::FCompressedChunkHeader& Header, const uint8* Payload, TArray<uint8>& Scratch, FFrameRecord* OutRecords)
+	{
+		const int32 Num = static_cast<int32>(Header.FrameCount);
+		if (Num <= 0 || Header.EncodedSize != static_cast<uint32>(Num * EncodedBytesPerFrame))
+		{
+			return false;
+		}
+
+		Scratch.SetNumUninitialized(Header.EncodedSize);
+		const FName FormatName = GetFormatName(static_cast<EBeamRecordingCompression>(Header.Codec));
+		if (!FCompression::UncompressMemory(FormatName, Scratch.GetData(), Header.EncodedSize, Payload, Header.CompressedSize))
+		{
+			return false;
+		}
+
+		const FColumns Columns(Scratch.GetData(), Num);
+		uint64 Timestamp = static_cast<uint64>(Header.FirstTimestampMs);
+		int64 PreviousPosition[3] = { 0, 0, 0 };
+		int64 PreviousRotation[3] = { 0, 0, 0 };
+		for (int32 i = 0; i < Num; ++i)
+		{
+			FFrameRecord& Record = OutRecords[i];
+			Timestamp += Columns.TimestampDelta[i];
+			Record.Timestamp = Timestamp;
+
+			Record.GazeScreen01 = FVector2D(Dequantize16(Columns.GazeX[i], GazeMin, GazeRange), Dequantize16(Columns.GazeY[i], GazeMin, GazeRange));
+			Record.GazeScreenPx = FVector2D(Columns.GazePxX[i], Columns.GazePxY[i]);
+			Record.GazeConfidence = static_cast<float>(Dequantize16(Columns.GazeConfidence[i], 0.0, 1.0));
+			Record.HeadConfidence = static_cast<float>(Dequantize16(Columns.HeadConfidence[i], 0.0, 1.0));
+
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Record.HeadPosition[Axis] = DecodeDelta(Columns.HeadPositionDelta[Axis][i], HeadPositionStepCm, PreviousPosition[Axis]);
+			}
+			Record.HeadRotation = FRotator(
+				DecodeDelta(Columns.HeadRotationDelta[0][i], HeadRotationStepDeg, PreviousRotation[0]),
+				DecodeDelta(Columns.HeadRotationDelta[1][i], HeadRotationStepDeg, PreviousRotation[1]),
+				DecodeDelta(Columns.HeadRotationDelta[2][i], HeadRotationStepDeg, PreviousRotation[2]));
+			Record.Reserved[0] = 0;
+			Record.Reserved[1] = 0;
+		}
+		return true;
+	}
+}
+
+/** Background writer: drains submitted chunks to disk and returns them to the recording thread's free list */
+class FBeamRecordingWriter : public FRunnable
+{
+public:
+	FBeamRecordingWriter(IFileHandle* InFile, TQueue<FBeamRecording::FRecordingChunk*, EQueueMode::Spsc>& InFreeChunks, EBeamRecordingCompression InCompression)
+		: File(InFile)
+		, FreeChunks(InFreeChunks)
+		, WorkEvent(FPlatformProcess::GetSynchEventFromPool(false))
+		, bStopRequested(false)
+		, bWriteFailed(false)
+		, ChunksWritten(0)
+		, Compression(InCompression)
+	{
+	}
+
+	virtual ~FBeamRecordingWriter() override
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	}
+
+	/** Recording thread only */
+	void Enqueue(FBeamRecording::FRecordingChunk* Chunk)
+	{
+		PendingChunks.Enqueue(Chunk);
+		WorkEvent->Trigger();
+	}
+
+	virtual uint32 Run() override
+	{
+		while (!bStopRequested.load(std::memory_order_acquire))
+		{
+			WorkEvent->Wait(100);
+			Drain();
+		}
+
+		// Anything submitted before Stop() still reaches the file
+		Drain();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopRequested.store(true, std::memory_order_release);
+		WorkEvent->Trigger();
+	}
+
+	uint32 GetChunksWritten() const { return ChunksWritten.load(std::memory_order_acquire); }
+	bool HasFailed() const { return bWriteFailed.load(std::memory_order_acquire); }
+
+	/** Index of every chunk written so far; only valid once the writer thread has exited */
+	const TArray<FBeamRecording::FChunkIndexEntry>& GetChunkIndex() const { return ChunkIndex; }
+
+private:
+	void Drain()
+	{
+		FBeamRecording::FRecordingChunk* Chunk = nullptr;
+		while (PendingChunks.Dequeue(Chunk))
+		{
+			WriteChunk(*Chunk);
+			Chunk->Records.Reset();
+			FreeChunks.Enqueue(Chunk);
+		}
+	}
+
+	void WriteChunk(const FBeamRecording::FRecordingChunk& Chunk)
+	{
+		if (bWriteFailed.load(std::memory_order_relaxed) || Chunk.Records.Num() == 0)
+		{
+			return;
+		}
+
+		FBeamRecording::FChunkIndexEntry Entry;
+		Entry.FirstTimestampMs = static_cast<double>(Chunk.Records[0].Timestamp);
+		Entry.LastTimestampMs = static_cast<double>(Chunk.Records.Last().Timestamp);
+		Entry.Offset = static_cast<uint64>(File->Tell());
+		Entry.FirstFrame = FramesWritten;
+		Entry.FrameCount = Chunk.Records.Num();
+
+		const bool bWritten = Compression == EBeamRecordingCompression::None ? WriteRawChunk(Chunk, Entry) : WriteCompressedChunk(Chunk, Entry);
+		if (!bWritten)
+		{
+			UE_LOG(LogBeam, Error, TEXT("Recording writer failed to write chunk %u; remaining frames will be discarded"), GetChunksWritten());
+			bWriteFailed.store(true, std::memory_order_release);
+			return;
+		}
+
+		ChunkIndex.Add(Entry);
+		FramesWritten += Entry.FrameCount;
+		ChunksWritten.fetch_add(1, std::memory_order_release);
+	}
+
+	bool WriteRawChunk(const FBeamRecording::FRecordingChunk& Chunk, const FBeamRecording::FChunkIndexEntry& Entry)
+	{
+		FBeamRecording::FChunkHeader Header;
+		Header.FrameCount = Entry.FrameCount;
+		Header.FirstTimestampMs = Entry.FirstTimestampMs;
+		Header.LastTimestampMs = Entry.LastTimestampMs;
+
+		return File->Write(reinterpret_cast<const uint8*>(&Header), sizeof(FBeamRecording::FChunkHeader))
+			&& File->Write(reinterpret_cast<const uint8*>(Chunk.Records.GetData()), Chunk.Records.Num() * sizeof(FBeamRecording::FFrameRecord));
+	}
+
+	bool WriteCompressedChunk(const FBeamRecording::FRecordingChunk& Chunk, const FBeamRecording::FChunkIndexEntry& Entry)
+	{
+		BeamRecordingCodec::Encode(Chunk.Records, EncodeScratch);
+
+		const FName FormatName = BeamRecordingCodec::GetFormatName(Compression);
+		int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, EncodeScratch.Num());
+		CompressScratch.SetNumUninitialized(CompressedSize, EAllowShrinking::No);
+		if (!FCompression::CompressMemory(FormatName, CompressScratch.GetData(), CompressedSize, EncodeScratch.GetData(), EncodeScratch.Num()))
+		{
+			return false;
+		}
+
+		FBeamRecording::FCompressedChunkHeader Header;
+		Header.FrameCount = Entry.FrameCount;
+		Header.FirstTimestampMs = Entry.FirstTimestampMs;
+		Header.LastTimestampMs = Entry.LastTimestampMs;
+		Header.EncodedSize = EncodeScratch.Num();
+		Header.CompressedSize = CompressedSize;
+		Header.Codec = static_cast<uint8>(Compression);
+
+		return File->Write(reinterpret_cast<const uint8*>(&Header), sizeof(FBeamRecording::FCompressedChunkHeader))
+			&& File->Write(CompressScratch.GetData(), CompressedSize);
+	}
+
+	IFileHandle* File;
+	TQueue<FBeamRecording::FRecordingChunk*, EQueueMode::Spsc> PendingChunks;
+	TQueue<FBeamRecording::FRecordingChunk*, EQueueMode::Spsc>& FreeChunks;
+	FEvent* WorkEvent;
+	std::atomic<bool> bStopRequested;
+	std::atomic<bool> bWriteFailed;
+	std::atomic<uint32> ChunksWritten;
+	const EBeamRecordingCompression Compression;
+
+	// Writer thread only until it exits
+	TArray<FBeamRecording::FChunkIndexEntry> ChunkIndex;
+	uint32 FramesWritten = 0;
+	TArray<uint8> EncodeScratch;
+	TArray<uint8> CompressScratch;
+};
 
 FBeamRecording::FBeamRecording()
 	: bIsRecording(false)
@@ -25,9 +340,13 @@ FBeamRecording::~FBeamRecording()
 	{
 		StopPlayback();
 	}
+
+	// The in-memory tail outlives a stopped recording, so whatever is still reported goes here
+	DEC_MEMORY_STAT_BY(STAT_BeamRecordingMemory, ReportedMemoryBytes);
+	GBeamResources.TrackBufferBytes(-static_cast<int64>(ReportedMemoryBytes));
 }
 
-bool FBeamRecording::StartRecording(const FString& FilePath)
+bool FBeamRecording::StartRecording(const FString& FilePath, const FBeamRecordingOptions& InOptions)
 {
 	if (bIsRecording)
 	{
@@ -35,6 +354,7 @@ bool FBeamRecording::StartRecording(const FString& FilePath)
 		return false;
 	}
 
+	LLM_SCOPE_BYTAG(BeamEyeTracker);
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 	RecordingFile = PlatformFile.OpenWrite(*FilePath);
 	
@@ -44,18 +364,50 @@ bool FBeamRecording::StartRecording(const FString& FilePath)
 		return false;
 	}
 
+	Options = InOptions;
+	Options.MaxPendingBlocks = FMath::Max(1, Options.MaxPendingBlocks);
+	Options.MaxInMemoryFrames = FMath::Max(0, Options.MaxInMemoryFrames);
+	Options.Compression = BeamRecordingCodec::Resolve(Options.Compression);
+	FramesPerChunk = FMath::Max(1, static_cast<int32>((Options.BlockSizeBytes - static_cast<int32>(sizeof(FChunkHeader))) / static_cast<int32>(sizeof(FFrameRecord))));
+
+	RecordingHeader = FRecordingHeader();
 	RecordingHeader.Magic = 0x4245414D;
-	RecordingHeader.Version = 1;
+	RecordingHeader.Version = Options.Compression == EBeamRecordingCompression::None ? 2 : 3;
 	RecordingHeader.FrameCount = 0;
 	RecordingHeader.StartTimestamp = FPlatformTime::Seconds() * 1000.0;
 	RecordingHeader.EndTimestamp = 0;
+	RecordingHeader.Reserved[0] = FramesPerChunk;
 	
 	RecordingFile->Write(reinterpret_cast<const uint8*>(&RecordingHeader), sizeof(FRecordingHeader));
+
+	// Every chunk is allocated up front; the hot path only moves pointers between the two queues
+	ChunkPool.Reset(Options.MaxPendingBlocks + 1);
+	for (int32 i = 0; i < Options.MaxPendingBlocks + 1; ++i)
+	{
+		TUniquePtr<FRecordingChunk>& Chunk = ChunkPool.Add_GetRef(MakeUnique<FRecordingChunk>());
+		Chunk->Records.Reserve(FramesPerChunk);
+		FreeChunks.Enqueue(Chunk.Get());
+	}
+	FreeChunks.Dequeue(ActiveChunk);
+
+	FrameBuffer.Reset(Options.MaxInMemoryFrames);
+	FrameBufferHead = 0;
+	RecordedFrameCount = 0;
+	DroppedFrameCount = 0;
+
+	Writer = new FBeamRecordingWriter(RecordingFile, FreeChunks, Options.Compression);
+	WriterThread = FRunnableThread::Create(Writer, TEXT("BeamEyeTracker_RecordingWriter"), 0, TPri_BelowNormal);
+	if (!WriterThread)
+	{
+		UE_LOG(LogBeam, Error, TEXT("Failed to start recording writer thread for %s"), *FilePath);
+		CloseFiles();
+		return false;
+	}
 	
 	bIsRecording = true;
-	FrameBuffer.Empty();
+	UpdateMemoryStat();
 	
-	UE_LOG(LogBeam, Log, TEXT("Started recording to %s"), *FilePath);
+	UE_LOG(LogBeam, Log, TEXT("Started recording to %s (v%u, %d frames per %d-byte chunk)"), *FilePath, RecordingHeader.Version, FramesPerChunk, Options.BlockSizeBytes);
 	return true;
 }
 
@@ -66,8 +418,27 @@ void FBeamRecording::StopRecording()
 		return;
 	}
 
-	RecordingHeader.FrameCount = FrameBuffer.Num();
+	// Flush the partial chunk, then let the writer drain everything before touching the file here
+	SubmitActiveChunk();
+
+	uint32 ChunksWritten = 0;
+	bool bWriteFailed = false;
+	if (WriterThread)
+	{
+		WriterThread->Kill(true);
+		ChunksWritten = Writer->GetChunksWritten();
+		bWriteFailed = Writer->HasFailed();
+
+		// The writer has exited, so the file position is the end of the last chunk
+		if (!bWriteFailed)
+		{
+			WriteChunkIndex(Writer->GetChunkIndex());
+		}
+	}
+
+	RecordingHeader.FrameCount = RecordedFrameCount;
 	RecordingHeader.EndTimestamp = FPlatformTime::Seconds() * 1000.0; // Convert to milliseconds
+	RecordingHeader.Reserved[1] = ChunksWritten;
 	
 	// Seek to beginning and rewrite header
 	if (RecordingFile)
@@ -76,17 +447,35 @@ void FBeamRecording::StopRecording()
 		RecordingFile->Write(reinterpret_cast<const uint8*>(&RecordingHeader), sizeof(FRecordingHeader));
 	}
 
-	// Close file
-	if (RecordingFile)
-	{
-		delete RecordingFile;
-		RecordingFile = nullptr;
-	}
+	CloseFiles();
 
 	bIsRecording = false;
-	FrameBuffer.Empty();
 	
-	UE_LOG(LogBeam, Log, TEXT("Stopped recording, saved %d frames"), RecordingHeader.FrameCount);
+	UE_LOG(LogBeam, Log, TEXT("Stopped recording, saved %u frames in %u chunks (%u dropped%s)"),
+		RecordingHeader.FrameCount, ChunksWritten, DroppedFrameCount, bWriteFailed ? TEXT(", write failed") : TEXT(""));
+}
+
+bool FBeamRecording::WriteChunkIndex(const TArray<FChunkIndexEntry>& ChunkIndex)
+{
+	if (!RecordingFile || ChunkIndex.Num() == 0)
+	{
+		return false;
+	}
+
+	const uint64 FooterOffset = static_cast<uint64>(RecordingFile->Tell());
+
+	FChunkIndexFooter Footer;
+	Footer.EntryCount = ChunkIndex.Num();
+	if (!RecordingFile->Write(reinterpret_cast<const uint8*>(&Footer), sizeof(FChunkIndexFooter))
+		|| !RecordingFile->Write(reinterpret_cast<const uint8*>(ChunkIndex.GetData()), ChunkIndex.Num() * sizeof(FChunkIndexEntry)))
+	{
+		UE_LOG(LogBeam, Warning, TEXT("Failed to write chunk index; recording will play back without seeking support"));
+		return false;
+	}
+
+	RecordingHeader.Reserved[2] = static_cast<uint32>(FooterOffset & 0xFFFFFFFFull);
+	RecordingHeader.Reserved[3] = static_cast<uint32>(FooterOffset >> 32);
+	return true;
 }
 
 void FBeamRecording::RecordFrame(const FBeamFrame& Frame)
@@ -96,7 +485,67 @@ void FBeamRecording::RecordFrame(const FBeamFrame& Frame)
 		return;
 	}
 
-	// Convert frame to record format
+	const FFrameRecord Record = ConvertFrameToRecord(Frame);
+	
+	// Bounded in-memory tail for inspection
+	if (FrameBuffer.Num() < Options.MaxInMemoryFrames)
+	{
+		FrameBuffer.Add(Record);
+	}
+	else if (Options.MaxInMemoryFrames > 0)
+	{
+		FrameBuffer[FrameBufferHead] = Record;
+		FrameBufferHead = (FrameBufferHead + 1) % Options.MaxInMemoryFrames;
+	}
+
+	// Reclaim a chunk the writer has finished with; drop rather than block or allocate when it is behind
+	if (!ActiveChunk && !FreeChunks.Dequeue(ActiveChunk))
+	{
+		if (DroppedFrameCount++ == 0)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Recording writer is %d chunks behind; dropping frames"), Options.MaxPendingBlocks);
+		}
+		return;
+	}
+
+	ActiveChunk->Records.Add(Record);
+	++RecordedFrameCount;
+
+	if (ActiveChunk->Records.Num() >= FramesPerChunk)
+	{
+		SubmitActiveChunk();
+	}
+}
+
+void FBeamRecording::SubmitActiveChunk()
+{
+	if (!ActiveChunk || !Writer)
+	{
+		return;
+	}
+
+	if (ActiveChunk->Records.Num() == 0)
+	{
+		return;
+	}
+
+	Writer->Enqueue(ActiveChunk);
+	ActiveChunk = nullptr;
+	FreeChunks.Dequeue(ActiveChunk);
+}
+
+int32 FBeamRecording::CopyRecentRecords(TArray<FFrameRecord>& OutRecords) const
+{
+	OutRecords.Reset(FrameBuffer.Num());
+
+	// Oldest record sits at FrameBufferHead once the tail has wrapped
+	OutRecords.Append(FrameBuffer.GetData() + FrameBufferHead, FrameBuffer.Num() - FrameBufferHead);
+	OutRecords.Append(FrameBuffer.GetData(), FrameBufferHead);
+	return OutRecords.Num();
+}
+
+FBeamRecording::FFrameRecord FBeamRecording::ConvertFrameToRecord(const FBeamFrame& Frame) const
+{
 	FFrameRecord Record;
 	Record.Timestamp = Frame.SDKTimestampMs;
 	Record.GazeScreen01 = Frame.Gaze.Screen01;
@@ -105,14 +554,77 @@ void FBeamRecording::RecordFrame(const FBeamFrame& Frame)
 	Record.HeadPosition = Frame.Head.PositionCm;
 	Record.HeadRotation = Frame.Head.Rotation;
 	Record.HeadConfidence = Frame.Head.Confidence;
+	return Record;
+}
 
-	RecordingFile->Write(reinterpret_cast<const uint8*>(&Record), sizeof(FFrameRecord));
-	
-	// Store in buffer for potential in-memory access
-	FrameBuffer.Add(Record);
+FBeamFrame FBeamRecording::ConvertRecordToFrame(const FFrameRecord& Record) const
+{
+	FBeamFrame Frame;
+	Frame.SDKTimestampMs = Record.Timestamp;
+
+	Frame.Gaze.bValid = true;
+	Frame.Gaze.Screen01 = Record.GazeScreen01;
+	Frame.Gaze.ScreenPx = Record.GazeScreenPx;
+	Frame.Gaze.Confidence = Record.GazeConfidence;
+	Frame.Gaze.TimestampMs = Record.Timestamp;
+
+	Frame.Head.PositionCm = Record.HeadPosition;
+	Frame.Head.SetRotation(Record.HeadRotation);
+	Frame.Head.Confidence = Record.HeadConfidence;
+	Frame.Head.TimestampMs = Record.Timestamp;
+	Frame.Head.TrackSessionUID = 0;
+	return Frame;
+}
+
+void FBeamRecording::CloseFiles()
+{
+	if (WriterThread)
+	{
+		WriterThread->Kill(true);
+		delete WriterThread;
+		WriterThread = nullptr;
+	}
+	if (Writer)
+	{
+		delete Writer;
+		Writer = nullptr;
+	}
+
+	ActiveChunk = nullptr;
+	FreeChunks.Empty();
+	ChunkPool.Empty();
+	UpdateMemoryStat();
+
+	if (RecordingFile)
+	{
+		delete RecordingFile;
+		RecordingFile = nullptr;
+	}
 }
 
-bool FBeamRecording::StartPlayback(const FString& FilePath)
+void FBeamRecording::UpdateMemoryStat() const
+{
+	SIZE_T Bytes = FrameBuffer.GetAllocatedSize() + ChunkPool.GetAllocatedSize()
+		+ PlaybackFrames.GetAllocatedSize() + PlaybackIndex.GetAllocatedSize()
+		+ DecodedChunk.GetAllocatedSize() + DecodeScratch.GetAllocatedSize();
+	for (const TUniquePtr<FRecordingChunk>& Chunk : ChunkPool)
+	{
+		Bytes += sizeof(FRecordingChunk) + Chunk->Records.GetAllocatedSize();
+	}
+
+	if (Bytes > ReportedMemoryBytes)
+	{
+		INC_MEMORY_STAT_BY(STAT_BeamRecordingMemory, Bytes - ReportedMemoryBytes);
+	}
+	else
+	{
+		DEC_MEMORY_STAT_BY(STAT_BeamRecordingMemory, ReportedMemoryBytes - Bytes);
+	}
+	GBeamResources.TrackBufferBytes(static_cast<int64>(Bytes) - static_cast<int64>(ReportedMemoryBytes));
+	ReportedMemoryBytes = Bytes;
+}
+
+bool FBeamRecording::StartPlayback(const FString& FilePath, bool bMemoryMap)
 {
 	if (bIsPlayingBack)
 	{
@@ -120,6 +632,20 @@ bool FBeamRecording::StartPlayback(const FString& FilePath)
 		return false;
 	}
 
+	LLM_SCOPE_BYTAG(BeamEyeTracker);
+
+	// Indexed recordings are opened in place; anything else falls back to reading the file
+	if (bMemoryMap && StartMappedPlayback(FilePath))
+	{
+		CurrentPlaybackIndex = 0;
+		PlaybackChunkCursor = 0;
+		bIsPlayingBack = true;
+		UpdateMemoryStat();
+
+		UE_LOG(LogBeam, Log, TEXT("Started mapped playback from %s with %d frames in %d chunks"), *FilePath, PlaybackFrameCount, PlaybackIndex.Num());
+		return true;
+	}
+
 	// Open the playback file
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 	PlaybackFile = PlatformFile.OpenRead(*FilePath);
@@ -147,25 +673,42 @@ bool FBeamRecording::StartPlayback(const FString& FilePath)
 		return false;
 	}
 
-	// Read all frames into memory
 	PlaybackFrames.Empty();
+
+	// v2 stores frames in chunks, each pulled in with a single read
+	if (PlaybackHeader.Version >= 2)
+	{
+		ReadChunkedFrames(PlaybackFile);
+		PlaybackFrameCount = PlaybackFrames.Num();
+		CurrentPlaybackIndex = 0;
+		bIsPlayingBack = true;
+		UpdateMemoryStat();
+
+		UE_LOG(LogBeam, Log, TEXT("Started playback from %s with %d frames"), *FilePath, PlaybackFrameCount);
+		return true;
+	}
+
+	// Read all frames into memory
 	PlaybackFrames.SetNum(PlaybackHeader.FrameCount);
 	
-			for (uint32 i = 0; i < PlaybackHeader.FrameCount; ++i)
-		{
-			FFrameRecord Record;
-			if (!PlaybackFile->Read(reinterpret_cast<uint8*>(&Record), sizeof(FFrameRecord)))
+	for (uint32 i = 0; i < PlaybackHeader.FrameCount; ++i)
+	{
+		FFrameRecord Record;
+		if (!PlaybackFile->Read(reinterpret_cast<uint8*>(&Record), sizeof(FFrameRecord)))
 		{
 			UE_LOG(LogBeam, Error, TEXT("Failed to read frame %d from playback file"), i);
+			PlaybackFrames.SetNum(i);
 			break;
 		}
 		PlaybackFrames[i] = Record;
 	}
 
+	PlaybackFrameCount = PlaybackFrames.Num();
 	CurrentPlaybackIndex = 0;
 	bIsPlayingBack = true;
+	UpdateMemoryStat();
 	
-	UE_LOG(LogBeam, Log, TEXT("Started playback from %s with %d frames"), *FilePath, PlaybackHeader.FrameCount);
+	UE_LOG(LogBeam, Log, TEXT("Started playback from %s with %d frames"), *FilePath, PlaybackFrameCount);
 	return true;
 }
 
@@ -182,78 +725,315 @@ void FBeamRecording::StopPlayback()
 		delete PlaybackFile;
 		PlaybackFile = nullptr;
 	}
+	UnmapPlaybackFile();
 
 	bIsPlayingBack = false;
 	PlaybackFrames.Empty();
+	PlaybackFrameCount = 0;
 	CurrentPlaybackIndex = 0;
+	UpdateMemoryStat();
 	
 	UE_LOG(LogBeam, Log, TEXT("Stopped playback"));
 }
 
 bool FBeamRecording::GetNextFrame(FBeamFrame& OutFrame)
 {
-	if (!bIsPlayingBack || CurrentPlaybackIndex >= PlaybackFrames.Num())
+	if (!bIsPlayingBack || CurrentPlaybackIndex >= PlaybackFrameCount)
 	{
 		return false;
 	}
 
-	const FFrameRecord& Record = PlaybackFrames[CurrentPlaybackIndex];
-	
 	// Convert to Beam frame format
-	OutFrame.SDKTimestampMs = Record.Timestamp;
+	OutFrame = ConvertRecordToFrame(GetPlaybackRecord(CurrentPlaybackIndex));
 	OutFrame.FrameId = CurrentPlaybackIndex;
 	
-	OutFrame.Gaze.bValid = true;
-	OutFrame.Gaze.Screen01 = Record.GazeScreen01;
-	OutFrame.Gaze.ScreenPx = Record.GazeScreenPx;
-	OutFrame.Gaze.Confidence = Record.GazeConfidence;
-	OutFrame.Gaze.TimestampMs = Record.Timestamp;
-	
-	OutFrame.Head.PositionCm = Record.HeadPosition;
-	OutFrame.Head.Rotation = Record.HeadRotation;
-	OutFrame.Head.Confidence = Record.HeadConfidence;
-	OutFrame.Head.TimestampMs = Record.Timestamp;
-	OutFrame.Head.TrackSessionUID = 0;
-	
 	CurrentPlaybackIndex++;
 	return true;
 }
 
+bool FBeamRecording::PeekNextFrameTimestamp(double& OutTimestampMs) const
+{
+	if (!bIsPlayingBack || CurrentPlaybackIndex >= PlaybackFrameCount)
+	{
+		return false;
+	}
+
+	OutTimestampMs = static_cast<double>(GetPlaybackRecord(CurrentPlaybackIndex).Timestamp);
+	return true;
+}
+
 float FBeamRecording::GetPlaybackProgress() const
 {
-	if (!bIsPlayingBack || PlaybackFrames.Num() == 0)
+	if (!bIsPlayingBack || PlaybackFrameCount == 0)
 	{
 		return 0.0f;
 	}
 	
-	return static_cast<float>(CurrentPlaybackIndex) / static_cast<float>(PlaybackFrames.Num());
+	return static_cast<float>(CurrentPlaybackIndex) / static_cast<float>(PlaybackFrameCount);
 }
 
 bool FBeamRecording::SeekToTime(double TimestampMs)
 {
-	if (!bIsPlayingBack)
+	const int32 ClosestIndex = FindPlaybackFrame(TimestampMs);
+	if (ClosestIndex == INDEX_NONE)
 	{
 		return false;
 	}
 
-	// Find frame closest to the target timestamp
-	int32 ClosestIndex = 0;
-	double ClosestTimeDiff = FMath::Abs(PlaybackFrames[0].Timestamp - TimestampMs);
-	
-	for (int32 i = 1; i < PlaybackFrames.Num(); ++i)
+	CurrentPlaybackIndex = ClosestIndex;
+	return true;
+}
+
+int32 FBeamRecording::FindPlaybackFrame(double TimestampMs) const
+{
+	if (!bIsPlayingBack || PlaybackFrameCount == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Timestamps are monotonic, so the closest frame is the lower bound or the one before it
+	int32 ClosestIndex = FMath::Min(LowerBoundPlaybackFrame(TimestampMs), PlaybackFrameCount - 1);
+	if (ClosestIndex > 0)
 	{
-		double TimeDiff = FMath::Abs(PlaybackFrames[i].Timestamp - TimestampMs);
-		if (TimeDiff < ClosestTimeDiff)
+		const double TimeDiff = FMath::Abs(static_cast<double>(GetPlaybackRecord(ClosestIndex).Timestamp) - TimestampMs);
+		const double PreviousTimeDiff = FMath::Abs(static_cast<double>(GetPlaybackRecord(ClosestIndex - 1).Timestamp) - TimestampMs);
+		if (PreviousTimeDiff <= TimeDiff)
 		{
-			ClosestTimeDiff = TimeDiff;
-			ClosestIndex = i;
+			--ClosestIndex;
 		}
 	}
+	return ClosestIndex;
+}
 
-	CurrentPlaybackIndex = ClosestIndex;
+bool FBeamRecording::GetPlaybackFrame(int32 Index, FBeamFrame& OutFrame) const
+{
+	if (!bIsPlayingBack || Index < 0 || Index >= PlaybackFrameCount)
+	{
+		return false;
+	}
+
+	OutFrame = ConvertRecordToFrame(GetPlaybackRecord(Index));
+	OutFrame.FrameId = Index;
+	return true;
+}
+
+bool FBeamRecording::StartMappedPlayback(const FString& FilePath)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*FilePath);
+	if (MappedResult.HasError())
+	{
+		return false;
+	}
+
+	PlaybackMappedFile = MappedResult.StealValue().Release();
+	PlaybackRegion = PlaybackMappedFile->MapRegion();
+	if (!PlaybackRegion)
+	{
+		UnmapPlaybackFile();
+		return false;
+	}
+
+	const uint8* Data = PlaybackRegion->GetMappedPtr();
+	const uint64 Size = static_cast<uint64>(PlaybackRegion->GetMappedSize());
+	if (Size < sizeof(FRecordingHeader))
+	{
+		UnmapPlaybackFile();
+		return false;
+	}
+
+	FMemory::Memcpy(&PlaybackHeader, Data, sizeof(FRecordingHeader));
+	const uint64 FooterOffset = static_cast<uint64>(PlaybackHeader.Reserved[2]) | (static_cast<uint64>(PlaybackHeader.Reserved[3]) << 32);
+	if (PlaybackHeader.Magic != 0x4245414D || PlaybackHeader.Version < 2 || FooterOffset < sizeof(FRecordingHeader)
+		|| FooterOffset + sizeof(FChunkIndexFooter) > Size)
+	{
+		UnmapPlaybackFile();
+		return false;
+	}
+
+	FChunkIndexFooter Footer;
+	FMemory::Memcpy(&Footer, Data + FooterOffset, sizeof(FChunkIndexFooter));
+	if (Footer.Magic != FChunkIndexFooter().Magic || Footer.EntryCount == 0
+		|| FooterOffset + sizeof(FChunkIndexFooter) + static_cast<uint64>(Footer.EntryCount) * sizeof(FChunkIndexEntry) > Size)
+	{
+		UnmapPlaybackFile();
+		return false;
+	}
+
+	// The index is tiny (one entry per chunk), so it is copied out; records stay in the mapping
+	PlaybackIndex.SetNumUninitialized(Footer.EntryCount);
+	FMemory::Memcpy(PlaybackIndex.GetData(), Data + FooterOffset + sizeof(FChunkIndexFooter), Footer.EntryCount * sizeof(FChunkIndexEntry));
+
+	const bool bCompressed = PlaybackHeader.Version >= 3;
+	uint32 ExpectedFirstFrame = 0;
+	for (const FChunkIndexEntry& Entry : PlaybackIndex)
+	{
+		uint64 ChunkEnd = Entry.Offset + sizeof(FChunkHeader) + static_cast<uint64>(Entry.FrameCount) * sizeof(FFrameRecord);
+		if (bCompressed)
+		{
+			FCompressedChunkHeader ChunkHeader;
+			ChunkHeader.Magic = 0;
+			if (Entry.Offset + sizeof(FCompressedChunkHeader) <= FooterOffset)
+			{
+				FMemory::Memcpy(&ChunkHeader, Data + Entry.Offset, sizeof(FCompressedChunkHeader));
+			}
+			ChunkEnd = ChunkHeader.Magic == FCompressedChunkHeader().Magic && ChunkHeader.FrameCount == Entry.FrameCount
+				? Entry.Offset + sizeof(FCompressedChunkHeader) + ChunkHeader.CompressedSize
+				: MAX_uint64;
+		}
+
+		if (Entry.FirstFrame != ExpectedFirstFrame || ChunkEnd > FooterOffset)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Corrupt chunk index in %s; falling back to buffered playback"), *FilePath);
+			UnmapPlaybackFile();
+			return false;
+		}
+		ExpectedFirstFrame += Entry.FrameCount;
+	}
+
+	PlaybackData = Data;
+	PlaybackFrameCount = static_cast<int32>(ExpectedFirstFrame);
 	return true;
 }
 
+void FBeamRecording::UnmapPlaybackFile()
+{
+	PlaybackData = nullptr;
+	PlaybackIndex.Empty();
+	DecodedChunk.Empty();
+	DecodeScratch.Empty();
+	DecodedChunkIndex = INDEX_NONE;
+
+	// Regions must go before the handle they were mapped from
+	if (PlaybackRegion)
+	{
+		delete PlaybackRegion;
+		PlaybackRegion = nullptr;
+	}
+	if (PlaybackMappedFile)
+	{
+		delete PlaybackMappedFile;
+		PlaybackMappedFile = nullptr;
+	}
+}
+
+const FBeamRecording::FFrameRecord& FBeamRecording::GetPlaybackRecord(int32 Index) const
+{
+	if (!PlaybackData)
+	{
+		return PlaybackFrames[Index];
+	}
+
+	// Sequential playback stays in the cached chunk; anything else is a binary search over the index
+	const FChunkIndexEntry* Entry = &PlaybackIndex[PlaybackChunkCursor];
+	if (static_cast<uint32>(Index) < Entry->FirstFrame || static_cast<uint32>(Index) >= Entry->FirstFrame + Entry->FrameCount)
+	{
+		PlaybackChunkCursor = FMath::Max(0, Algo::UpperBoundBy(PlaybackIndex, static_cast<uint32>(Index), &FChunkIndexEntry::FirstFrame) - 1);
+		Entry = &PlaybackIndex[PlaybackChunkCursor];
+	}
+
+	return GetMappedChunkRecords(PlaybackChunkCursor)[Index - Entry->FirstFrame];
+}
+
+const FBeamRecording::FFrameRecord* FBeamRecording::GetMappedChunkRecords(int32 ChunkIndex) const
+{
+	const FChunkIndexEntry& Entry = PlaybackIndex[ChunkIndex];
+	if (PlaybackHeader.Version < 3)
+	{
+		return reinterpret_cast<const FFrameRecord*>(PlaybackData + Entry.Offset + sizeof(FChunkHeader));
+	}
+
+	// One chunk is inflated at a time; sequential playback decodes each chunk exactly once
+	if (DecodedChunkIndex != ChunkIndex)
+	{
+		FCompressedChunkHeader ChunkHeader;
+		FMemory::Memcpy(&ChunkHeader, PlaybackData + Entry.Offset, sizeof(FCompressedChunkHeader));
+
+		LLM_SCOPE_BYTAG(BeamEyeTracker);
+		DecodedChunk.SetNumUninitialized(Entry.FrameCount, EAllowShrinking::No);
+		if (!BeamRecordingCodec::Decode(ChunkHeader, PlaybackData + Entry.Offset + sizeof(FCompressedChunkHeader), DecodeScratch, DecodedChunk.GetData()))
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Failed to decode playback chunk %d; its frames play back empty"), ChunkIndex);
+			FMemory::Memzero(DecodedChunk.GetData(), DecodedChunk.Num() * sizeof(FFrameRecord));
+		}
+		DecodedChunkIndex = ChunkIndex;
+		UpdateMemoryStat();
+	}
+	return DecodedChunk.GetData();
+}
+
+int32 FBeamRecording::LowerBoundPlaybackFrame(double TimestampMs) const
+{
+	auto RecordTimestamp = [](const FFrameRecord& Record) { return static_cast<double>(Record.Timestamp); };
+
+	if (!PlaybackData)
+	{
+		return Algo::LowerBoundBy(PlaybackFrames, TimestampMs, RecordTimestamp);
+	}
+
+	// First chunk that ends at or after the target, then the first record within it
+	const int32 ChunkIndex = Algo::LowerBoundBy(PlaybackIndex, TimestampMs, &FChunkIndexEntry::LastTimestampMs);
+	if (ChunkIndex >= PlaybackIndex.Num())
+	{
+		return PlaybackFrameCount;
+	}
+
+	const FChunkIndexEntry& Entry = PlaybackIndex[ChunkIndex];
+	const TArrayView<const FFrameRecord> Records(GetMappedChunkRecords(ChunkIndex), Entry.FrameCount);
+	return Entry.FirstFrame + Algo::LowerBoundBy(Records, TimestampMs, RecordTimestamp);
+}
+
+bool FBeamRecording::ReadChunkedFrames(IFileHandle* File)
+{
+	// Walks chunks until the end of the file, so a recording cut short by a crash still plays back
+	const int64 FileSize = File->Size();
+	if (PlaybackHeader.Version >= 3)
+	{
+		TArray<uint8> Payload;
+		while (File->Tell() + static_cast<int64>(sizeof(FCompressedChunkHeader)) <= FileSize)
+		{
+			FCompressedChunkHeader ChunkHeader;
+			if (!File->Read(reinterpret_cast<uint8*>(&ChunkHeader), sizeof(FCompressedChunkHeader)) || ChunkHeader.Magic != FCompressedChunkHeader().Magic)
+			{
+				break;
+			}
+
+			const int32 FirstNewFrame = PlaybackFrames.Num();
+			Payload.SetNumUninitialized(ChunkHeader.CompressedSize, EAllowShrinking::No);
+			PlaybackFrames.AddUninitialized(ChunkHeader.FrameCount);
+			if (!File->Read(Payload.GetData(), ChunkHeader.CompressedSize)
+				|| !BeamRecordingCodec::Decode(ChunkHeader, Payload.GetData(), DecodeScratch, PlaybackFrames.GetData() + FirstNewFrame))
+			{
+				UE_LOG(LogBeam, Warning, TEXT("Truncated or corrupt chunk after %d frames in playback file"), FirstNewFrame);
+				PlaybackFrames.SetNum(FirstNewFrame);
+				break;
+			}
+		}
+		DecodeScratch.Empty();
+		return PlaybackFrames.Num() > 0;
+	}
+
+	while (File->Tell() + static_cast<int64>(sizeof(FChunkHeader)) <= FileSize)
+	{
+		FChunkHeader ChunkHeader;
+		if (!File->Read(reinterpret_cast<uint8*>(&ChunkHeader), sizeof(FChunkHeader)) || ChunkHeader.Magic != FChunkHeader().Magic)
+		{
+			break;
+		}
+
+		const int32 FirstNewFrame = PlaybackFrames.Num();
+		PlaybackFrames.AddUninitialized(ChunkHeader.FrameCount);
+		if (!File->Read(reinterpret_cast<uint8*>(PlaybackFrames.GetData() + FirstNewFrame), ChunkHeader.FrameCount * sizeof(FFrameRecord)))
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Truncated chunk after %d frames in playback file"), FirstNewFrame);
+			PlaybackFrames.SetNum(FirstNewFrame);
+			break;
+		}
+	}
+
+	return PlaybackFrames.Num() > 0;
+}
+
 bool FBeamRecording::GetRecordingInfo(const FString& FilePath, FRecordingHeader& OutHeader, int32& OutFrameCount) const
 {
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
@@ -14,6 +14,41 @@
 
 #include "CoreMinimal.h"
 #include "BeamEyeTrackerTypes.h"
+#include "Containers/Queue.h"
+
+class FRunnableThread;
+class FBeamRecordingWriter;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/** Chunk compression for .beamrec recordings; any codec other than None writes a v3 file */
+enum class EBeamRecordingCompression : uint8
+{
+	/** Raw FFrameRecord chunks (v2) */
+	None = 0,
+
+	/** Quantized, delta-encoded columns compressed with zlib */
+	Zlib = 1,
+
+	/** Quantized, delta-encoded columns compressed with Oodle (falls back to zlib where unavailable) */
+	Oodle = 2
+};
+
+/** Layout and memory limits for .beamrec v2/v3 recordings */
+struct FBeamRecordingOptions
+{
+	/** Size of one on-disk chunk, header included; the hot path only ever fills the current chunk */
+	int32 BlockSizeBytes = 64 * 1024;
+
+	/** Chunks that may be queued behind the writer before frames start being dropped */
+	int32 MaxPendingBlocks = 16;
+
+	/** Most recent records kept in memory for inspection; older ones live only on disk */
+	int32 MaxInMemoryFrames = 4096;
+
+	/** Compression applied by the writer thread; the recording thread cost is unchanged */
+	EBeamRecordingCompression Compression = EBeamRecordingCompression::None;
+};
 
 /** Handles recording and playback of gaze/head pose sessions */
 class BEAMEYETRACKER_API FBeamRecording
@@ -27,7 +62,16 @@ public:
 		uint32 FrameCount = 0;
 		uint64 StartTimestamp = 0;
 		uint64 EndTimestamp = 0;
-		uint32 Reserved[4] = {0};
+		uint32 Reserved[4] = {0}; // v2/v3: [0] frames per chunk, [1] chunk count, [2..3] chunk index offset (low, high)
+	};
+
+	/** Precedes every chunk of frame records in a v2 file */
+	struct FChunkHeader
+	{
+		uint32 Magic = 0x4B484342; // "BCHK"
+		uint32 FrameCount = 0;
+		double FirstTimestampMs = 0.0;
+		double LastTimestampMs = 0.0;
 	};
 
 	/** Frame record structure for storing tracking data */
@@ -43,12 +87,52 @@ public:
 		uint32 Reserved[2] = {0};
 	};
 
+	/**
+	 * Precedes every chunk in a v3 file. The payload is CompressedSize bytes that inflate to EncodedSize bytes
+	 * of per-field columns: timestamp deltas (ms), 16-bit gaze, pixel gaze, 16-bit confidences and head pose
+	 * deltas quantized to 10 um / 0.001 deg.
+	 */
+	struct FCompressedChunkHeader
+	{
+		uint32 Magic = 0x5A484342; // "BCHZ"
+		uint32 FrameCount = 0;
+		double FirstTimestampMs = 0.0;
+		double LastTimestampMs = 0.0;
+		uint32 EncodedSize = 0;
+		uint32 CompressedSize = 0;
+		uint8 Codec = 0; // EBeamRecordingCompression
+		uint8 Padding[7] = {0};
+	};
+
+	/** Chunk index entry written to the v2 footer; entries are in file (and timestamp) order */
+	struct FChunkIndexEntry
+	{
+		double FirstTimestampMs = 0.0;
+		double LastTimestampMs = 0.0;
+		uint64 Offset = 0; // Of the chunk header
+		uint32 FirstFrame = 0;
+		uint32 FrameCount = 0;
+	};
+
+	/** Footer at the chunk index offset, followed by EntryCount index entries */
+	struct FChunkIndexFooter
+	{
+		uint32 Magic = 0x58444942; // "BIDX"
+		uint32 EntryCount = 0;
+	};
+
+	/** One fixed-capacity block of records, filled on the recording thread and flushed by the writer */
+	struct FRecordingChunk
+	{
+		TArray<FFrameRecord> Records;
+	};
+
 public:
 	FBeamRecording();
 	~FBeamRecording();
 
-	/** Starts recording gaze data to file */
-	bool StartRecording(const FString& FilePath);
+	/** Starts recording gaze data to a chunked v2 file; chunks are flushed on a background writer */
+	bool StartRecording(const FString& FilePath, const FBeamRecordingOptions& InOptions = FBeamRecordingOptions());
 	
 	/** Stops recording and saves the file */
 	void StopRecording();
@@ -56,26 +140,53 @@ public:
 	/** Checks if currently recording to a file */
 	bool IsRecording() const { return bIsRecording; }
 	
-	/** Records a single frame of tracking data */
+	/** Records a single frame of tracking data (single recording thread; never blocks on disk) */
 	void RecordFrame(const FBeamFrame& Frame);
+
+	/** Copies the bounded in-memory tail of the current recording, oldest first */
+	int32 CopyRecentRecords(TArray<FFrameRecord>& OutRecords) const;
+
+	/** Frames lost because the writer fell more than MaxPendingBlocks chunks behind */
+	uint32 GetDroppedFrameCount() const { return DroppedFrameCount; }
 	
-	/** Starts playback from a recorded file */
-	bool StartPlayback(const FString& FilePath);
+	/**
+	 * Starts playback from a recorded file. Indexed v2 files are memory-mapped when bMemoryMap is set,
+	 * so opening is O(1) in file size; other files are read into memory.
+	 */
+	bool StartPlayback(const FString& FilePath, bool bMemoryMap = true);
 	
 	/** Stops playback and closes the file */
 	void StopPlayback();
 	
 	/** Checks if currently playing back a recording */
 	bool IsPlayingBack() const { return bIsPlayingBack; }
+
+	/** True if the current playback reads records straight from a mapped file */
+	bool IsMemoryMapped() const { return PlaybackData != nullptr; }
+
+	/** Number of frames in the current playback */
+	int32 GetPlaybackFrameCount() const { return PlaybackFrameCount; }
 	
 	/** Gets the next frame for playback */
 	bool GetNextFrame(FBeamFrame& OutFrame);
+
+	/** Timestamp of the frame GetNextFrame would return, without advancing */
+	bool PeekNextFrameTimestamp(double& OutTimestampMs) const;
 	
 	/** Gets playback progress as a value from 0.0 to 1.0 */
 	float GetPlaybackProgress() const;
 	
-	/** Seeks to a specific time in the recording for playback control */
+	/** Seeks to the frame closest to a timestamp; O(log n) over the chunk index and the records within a chunk */
 	bool SeekToTime(double TimestampMs);
+
+	/** Index of the playback frame closest to a timestamp without moving playback; INDEX_NONE when not playing back */
+	int32 FindPlaybackFrame(double TimestampMs) const;
+
+	/** First playback index whose timestamp is >= TimestampMs (GetPlaybackFrameCount() if none) */
+	int32 LowerBoundPlaybackFrame(double TimestampMs) const;
+
+	/** Random access to a playback frame without moving playback; mapped files only touch the chunk holding it */
+	bool GetPlaybackFrame(int32 Index, FBeamFrame& OutFrame) const;
 	
 	/** Gets recording information from a .beamrec file */
 	bool GetRecordingInfo(const FString& FilePath, FRecordingHeader& OutHeader, int32& OutFrameCount) const;
@@ -94,12 +205,44 @@ private:
 	
 	/** Recording data structures */
 	FRecordingHeader RecordingHeader;
+	FBeamRecordingOptions Options;
+	int32 FramesPerChunk = 0;
+	uint32 RecordedFrameCount = 0;
+	uint32 DroppedFrameCount = 0;
+
+	/** Bounded tail of recent records; FrameBufferHead is the next slot to overwrite once full */
 	TArray<FFrameRecord> FrameBuffer;
+	int32 FrameBufferHead = 0;
+
+	/** Chunk pool cycling between the recording thread and the writer */
+	TArray<TUniquePtr<FRecordingChunk>> ChunkPool;
+	FRecordingChunk* ActiveChunk = nullptr;
+	TQueue<FRecordingChunk*, EQueueMode::Spsc> FreeChunks;
+
+	/** Background writer that owns RecordingFile while recording */
+	FBeamRecordingWriter* Writer = nullptr;
+	FRunnableThread* WriterThread = nullptr;
+
+	/** Hands the active chunk to the writer and picks up a free one (null if the pool is exhausted) */
+	void SubmitActiveChunk();
 	
 	/** Playback data structures */
 	FRecordingHeader PlaybackHeader;
 	TArray<FFrameRecord> PlaybackFrames;
+	int32 PlaybackFrameCount = 0;
 	int32 CurrentPlaybackIndex = 0;
+
+	/** Memory-mapped playback: records are read in place through the chunk index */
+	IMappedFileHandle* PlaybackMappedFile = nullptr;
+	IMappedFileRegion* PlaybackRegion = nullptr;
+	const uint8* PlaybackData = nullptr;
+	TArray<FChunkIndexEntry> PlaybackIndex;
+	mutable int32 PlaybackChunkCursor = 0;
+
+	/** Last chunk inflated from a mapped v3 file */
+	mutable TArray<FFrameRecord> DecodedChunk;
+	mutable TArray<uint8> DecodeScratch;
+	mutable int32 DecodedChunkIndex = INDEX_NONE;
 	
 	/** File path for current recording/playback session */
 	FString CurrentFilePath;
@@ -124,6 +267,30 @@ private:
 	
 	/** Closes all file handles and cleans up resources */
 	void CloseFiles();
+
+	/** Bytes last reported to the recording memory stat */
+	mutable SIZE_T ReportedMemoryBytes = 0;
+
+	/** Moves the recording memory stat to the current size of the buffers owned here */
+	void UpdateMemoryStat() const;
+
+	/** Reads the chunk stream of a v2 file into PlaybackFrames */
+	bool ReadChunkedFrames(IFileHandle* File);
+
+	/** Writes the chunk index footer at the current end of RecordingFile and records its offset in the header */
+	bool WriteChunkIndex(const TArray<FChunkIndexEntry>& ChunkIndex);
+
+	/** Maps an indexed v2 file and loads its chunk index; false if the file has no usable index */
+	bool StartMappedPlayback(const FString& FilePath);
+
+	/** Releases the mapped playback file, if any */
+	void UnmapPlaybackFile();
+
+	/** Records of one indexed chunk of the mapped file, inflating v3 chunks into DecodedChunk on demand */
+	const FFrameRecord* GetMappedChunkRecords(int32 ChunkIndex) const;
+
+	/** Record at a playback index, from memory or the mapped file */
+	const FFrameRecord& GetPlaybackRecord(int32 Index) const;
 };
 
 /*=============================================================================
@@ -0,0 +1,220 @@
+// Implements random access and summary pyramids over .beamrec recordings
+
+#include "BeamRecordingTimeline.h"
+#include "BeamRecording.h"
+#include "BeamLogging.h"
+#include "Async/Async.h"
+
+namespace
+{
+	/** Columns with fewer frames than this are read exactly instead of from the summary */
+	constexpr int32 MaxExactFramesPerColumn = 2 * FBeamRecordingTimeline::FramesPerBaseBucket;
+
+	/** How often the worker publishes progress and checks for cancellation */
+	constexpr int32 SummaryProgressInterval = 4096;
+}
+
+FBeamRecordingTimeline::FBeamRecordingTimeline() = default;
+
+FBeamRecordingTimeline::~FBeamRecordingTimeline()
+{
+	Close();
+}
+
+bool FBeamRecordingTimeline::Open(const FString& InFilePath)
+{
+	Close();
+
+	TUniquePtr<FBeamRecording> NewReader = MakeUnique<FBeamRecording>();
+	if (!NewReader->StartPlayback(InFilePath, true) || NewReader->GetPlaybackFrameCount() == 0)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("Timeline: %s holds no readable frames"), *InFilePath);
+		return false;
+	}
+
+	Reader = MoveTemp(NewReader);
+	FilePath = InFilePath;
+	FrameCount = Reader->GetPlaybackFrameCount();
+
+	FBeamFrame First;
+	FBeamFrame Last;
+	Reader->GetPlaybackFrame(0, First);
+	Reader->GetPlaybackFrame(FrameCount - 1, Last);
+	StartTimeMs = First.SDKTimestampMs;
+	EndTimeMs = FMath::Max(Last.SDKTimestampMs, StartTimeMs);
+
+	if (!Reader->IsMemoryMapped())
+	{
+		UE_LOG(LogBeam, Log, TEXT("Timeline: %s has no chunk index and was read into memory"), *InFilePath);
+	}
+
+	SummaryTask = Async(EAsyncExecution::ThreadPool, [this]()
+	{
+		BuildSummary();
+	});
+	return true;
+}
+
+void FBeamRecordingTimeline::Close()
+{
+	if (SummaryTask.IsValid())
+	{
+		bCancelSummary.store(true, std::memory_order_relaxed);
+		SummaryTask.Wait();
+		SummaryTask = TFuture<void>();
+	}
+
+	Reader.Reset();
+	SummaryLevels.Empty();
+	bSummaryReady.store(false, std::memory_order_relaxed);
+	bCancelSummary.store(false, std::memory_order_relaxed);
+	SummaryFramesRead.store(0, std::memory_order_relaxed);
+	FilePath.Reset();
+	FrameCount = 0;
+	StartTimeMs = 0.0;
+	EndTimeMs = 0.0;
+}
+
+bool FBeamRecordingTimeline::IsOpen() const
+{
+	return Reader.IsValid();
+}
+
+bool FBeamRecordingTimeline::IsMemoryMapped() const
+{
+	return Reader.IsValid() && Reader->IsMemoryMapped();
+}
+
+float FBeamRecordingTimeline::GetSummaryProgress() const
+{
+	if (IsSummaryReady())
+	{
+		return 1.0f;
+	}
+	return FrameCount > 0 ? static_cast<float>(SummaryFramesRead.load(std::memory_order_relaxed)) / FrameCount : 0.0f;
+}
+
+bool FBeamRecordingTimeline::GetFrameAtTime(double TimestampMs, FBeamFrame& OutFrame) const
+{
+	return Reader.IsValid() && Reader->GetPlaybackFrame(Reader->FindPlaybackFrame(TimestampMs), OutFrame);
+}
+
+int32 FBeamRecordingTimeline::GetFramesInRange(double StartMs, double EndMs, int32 MaxFrames, TArray<FBeamFrame>& OutFrames) const
+{
+	OutFrames.Reset();
+	if (!Reader.IsValid() || MaxFrames <= 0 || EndMs < StartMs)
+	{
+		return 0;
+	}
+
+	const int32 First = Reader->LowerBoundPlaybackFrame(StartMs);
+	const int32 End = Reader->LowerBoundPlaybackFrame(EndMs + UE_KINDA_SMALL_NUMBER);
+	const int32 Stride = FMath::Max(1, FMath::DivideAndRoundUp(End - First, MaxFrames));
+	for (int32 Index = First; Index < End; Index += Stride)
+	{
+		Reader->GetPlaybackFrame(Index, OutFrames.AddDefaulted_GetRef());
+	}
+	return OutFrames.Num();
+}
+
+void FBeamRecordingTimeline::AccumulateFrames(int32 FirstFrame, int32 EndFrame, FBeamTimelineBucket& Bucket) const
+{
+	FBeamFrame Frame;
+	for (int32 Index = FirstFrame; Index < EndFrame; ++Index)
+	{
+		if (Reader->GetPlaybackFrame(Index, Frame))
+		{
+			Bucket.Add(Frame);
+		}
+	}
+}
+
+bool FBeamRecordingTimeline::GetSummary(double StartMs, double EndMs, int32 NumColumns, TArray<FBeamTimelineBucket>& OutColumns) const
+{
+	OutColumns.Reset();
+	if (!Reader.IsValid() || NumColumns <= 0 || EndMs <= StartMs)
+	{
+		return false;
+	}
+
+	const bool bReady = IsSummaryReady();
+	const double ColumnMs = (EndMs - StartMs) / NumColumns;
+	OutColumns.SetNum(NumColumns);
+
+	int32 ColumnStart = Reader->LowerBoundPlaybackFrame(StartMs);
+	for (int32 Column = 0; Column < NumColumns; ++Column)
+	{
+		const int32 ColumnEnd = Reader->LowerBoundPlaybackFrame(StartMs + ColumnMs * (Column + 1));
+		const int32 ColumnFrames = ColumnEnd - ColumnStart;
+		FBeamTimelineBucket& Bucket = OutColumns[Column];
+
+		if (ColumnFrames <= MaxExactFramesPerColumn)
+		{
+			AccumulateFrames(ColumnStart, ColumnEnd, Bucket);
+		}
+		else if (bReady)
+		{
+			// Coarsest level whose buckets still fit the column; edges round out to whole buckets
+			const int32 Level = FMath::Min(static_cast<int32>(FMath::FloorLog2(static_cast<uint32>(ColumnFrames / FramesPerBaseBucket))), SummaryLevels.Num() - 1);
+			const int32 BucketFrames = FramesPerBaseBucket << Level;
+			const TArray<FBeamTimelineBucket>& Buckets = SummaryLevels[Level];
+			const int32 LastBucket = FMath::Min((ColumnEnd - 1) / BucketFrames, Buckets.Num() - 1);
+			for (int32 BucketIndex = ColumnStart / BucketFrames; BucketIndex <= LastBucket; ++BucketIndex)
+			{
+				Bucket.Merge(Buckets[BucketIndex]);
+			}
+		}
+		ColumnStart = ColumnEnd;
+	}
+	return true;
+}
+
+void FBeamRecordingTimeline::BuildSummary()
+{
+	// A second mapping keeps the worker's chunk cursor and decode cache apart from the scrubbing reader
+	FBeamRecording WorkerReader;
+	if (!WorkerReader.StartPlayback(FilePath, true))
+	{
+		return;
+	}
+
+	TArray<TArray<FBeamTimelineBucket>> Levels;
+	TArray<FBeamTimelineBucket>& Base = Levels.AddDefaulted_GetRef();
+	Base.SetNum(FMath::DivideAndRoundUp(FrameCount, FramesPerBaseBucket));
+
+	FBeamFrame Frame;
+	for (int32 Index = 0; Index < FrameCount; ++Index)
+	{
+		if (Index % SummaryProgressInterval == 0)
+		{
+			if (bCancelSummary.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+			SummaryFramesRead.store(Index, std::memory_order_relaxed);
+		}
+
+		if (WorkerReader.GetPlaybackFrame(Index, Frame))
+		{
+			Base[Index / FramesPerBaseBucket].Add(Frame);
+		}
+	}
+
+	while (Levels.Last().Num() > 1)
+	{
+		const TArray<FBeamTimelineBucket>& Fine = Levels.Last();
+		TArray<FBeamTimelineBucket> Coarse;
+		Coarse.SetNum(FMath::DivideAndRoundUp(Fine.Num(), 2));
+		for (int32 Index = 0; Index < Fine.Num(); ++Index)
+		{
+			Coarse[Index / 2].Merge(Fine[Index]);
+		}
+		Levels.Add(MoveTemp(Coarse));
+	}
+
+	WorkerReader.StopPlayback();
+
+	SummaryLevels = MoveTemp(Levels);
+	SummaryFramesRead.store(FrameCount, std::memory_order_relaxed);
+	bSummaryReady.store(true, std::memory_order_release);
+}
@@ -0,0 +1,213 @@
+// Implements deterministic, unpaced replay of recordings through the runtime pipeline
+
+#include "BeamReplayDriver.h"
+#include "BeamRecording.h"
+#include "BeamGazeAnalyzer.h"
+#include "BeamEyeTrackerSettings.h"
+#include "BeamLogging.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+// FBeamReplayConfig Implementation
+
+FBeamReplayConfig FBeamReplayConfig::FromSettings(const UBeamEyeTrackerSettings& Settings)
+{
+	FBeamReplayConfig Config;
+	Config.FilterType = Settings.bEnableSmoothing ? EBeamFilterType::OneEuro : EBeamFilterType::None;
+	Config.OneEuroParams = FOneEuroFilterParams(Settings.MinCutoff, Settings.Beta, static_cast<float>(Settings.PollingHz));
+	Config.PredictorParams = Settings.GetPredictorParams();
+	return Config;
+}
+
+// FBeamReplayDigest Implementation
+
+FString FBeamReplayDigest::ToString() const
+{
+	return FString::Printf(TEXT("%s: %d frames (%d valid), %.1f s in %.3f s (%.0fx), %d fixations, avg %.3f s, saccade %.3f, scan %.3f, crc %08x"),
+		*FPaths::GetCleanFilename(RecordingPath), FrameCount, ValidGazeFrames, DurationSeconds, WallTimeSeconds,
+		WallTimeSeconds > 0.0 ? DurationSeconds / WallTimeSeconds : 0.0,
+		Analytics.FixationCount, Analytics.AverageFixationDuration, Analytics.SaccadeVelocity, Analytics.ScanPathLength, OutputChecksum);
+}
+
+FString FBeamReplayDigest::ToJson() const
+{
+	FString EscapedPath = RecordingPath.ReplaceCharWithEscapedChar();
+	return FString::Printf(TEXT("{\"recording\":\"%s\",\"frames\":%d,\"validGazeFrames\":%d,\"analyticsSamples\":%d,\"durationSeconds\":%.6f,\"wallTimeSeconds\":%.6f,")
+		TEXT("\"fixationCount\":%d,\"averageFixationDuration\":%.6f,\"saccadeVelocity\":%.6f,\"scanPathLength\":%.6f,\"outputChecksum\":\"%08x\"}"),
+		*EscapedPath, FrameCount, ValidGazeFrames, AnalyticsSamples, DurationSeconds, WallTimeSeconds,
+		Analytics.FixationCount, Analytics.AverageFixationDuration, Analytics.SaccadeVelocity, Analytics.ScanPathLength, OutputChecksum);
+}
+
+// FBeamReplayDriver Implementation
+
+FBeamReplayDriver::FBeamReplayDriver(const FBeamReplayConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+void FBeamReplayDriver::AddStage(FFrameStage Stage)
+{
+	Stages.Add(MoveTemp(Stage));
+}
+
+bool FBeamReplayDriver::Run(const FString& RecordingPath, FBeamReplayDigest& OutDigest)
+{
+	OutDigest = FBeamReplayDigest();
+	OutDigest.RecordingPath = RecordingPath;
+
+	FBeamRecording Recording;
+	if (!Recording.StartPlayback(RecordingPath))
+	{
+		UE_LOG(LogBeam, Error, TEXT("Replay: failed to open %s"), *RecordingPath);
+		return false;
+	}
+
+	double FirstTimestampMs = 0.0;
+	if (!Recording.PeekNextFrameTimestamp(FirstTimestampMs))
+	{
+		UE_LOG(LogBeam, Warning, TEXT("Replay: %s holds no frames"), *RecordingPath);
+		return false;
+	}
+
+	// Fresh pipeline state per run keeps every replay independent of the previous one
+	FBeamFilters Filters;
+	Filters.SetFilterType(Config.FilterType);
+	Filters.UpdateOneEuroParams(Config.OneEuroParams);
+	Filters.UpdateEmaParams(Config.EmaParams);
+	Filters.UpdateGapFillParams(Config.GapFillParams);
+
+	FBeamGazePredictor Predictor(Config.PredictorParams);
+	FBeamGazeAnalyzer Analyzer(Config.MinFixationDuration, Config.AnalyticsWindowSeconds);
+
+	const double AnalyticsInterval = Config.AnalyticsSamplingRate > 0.0f ? 1.0 / Config.AnalyticsSamplingRate : 0.0;
+	double LastAnalyticsTime = -TNumericLimits<double>::Max();
+	double LastTimestampMs = 0.0;
+	uint32 Checksum = 0;
+
+	const double WallStart = FPlatformTime::Seconds();
+
+	FBeamFrame Frame;
+	while (Recording.GetNextFrame(Frame))
+	{
+		// Virtual clock: recorded time since the first frame, never the wall clock
+		const double VirtualTime = (Frame.SDKTimestampMs - FirstTimestampMs) * 0.001;
+		Frame.UETimestampSeconds = VirtualTime;
+
+		// Filter step uses the tracker clock, exactly as the producer thread does
+		const double DeltaSeconds = LastTimestampMs > 0.0 ? (Frame.SDKTimestampMs - LastTimestampMs) * 0.001 : 0.0;
+		LastTimestampMs = Frame.SDKTimestampMs;
+		Frame.DeltaTimeSeconds = DeltaSeconds;
+		Filters.ApplyFilters(Frame, DeltaSeconds);
+
+		if (Config.PredictionHorizonMs > 0.0f)
+		{
+			Predictor.AddSample(Frame);
+			Predictor.Predict(Config.PredictionHorizonMs, Frame);
+		}
+
+		if (Frame.Gaze.bValid)
+		{
+			++OutDigest.ValidGazeFrames;
+		}
+
+		if (Frame.Gaze.Confidence > Config.AnalyticsMinConfidence && VirtualTime - LastAnalyticsTime >= AnalyticsInterval)
+		{
+			Analyzer.AddSample(Frame.Gaze.Screen01, VirtualTime);
+			LastAnalyticsTime = VirtualTime;
+			++OutDigest.AnalyticsSamples;
+		}
+
+		for (const FFrameStage& Stage : Stages)
+		{
+			Stage(Frame, VirtualTime);
+		}
+
+		// Quantized so the checksum is stable against last-bit float noise in unrelated code
+		const int32 Quantized[8] = {
+			FMath::RoundToInt(Frame.Gaze.Screen01.X * 1.0e6), FMath::RoundToInt(Frame.Gaze.Screen01.Y * 1.0e6),
+			FMath::RoundToInt(Frame.Head.PositionCm.X * 1.0e3), FMath::RoundToInt(Frame.Head.PositionCm.Y * 1.0e3), FMath::RoundToInt(Frame.Head.PositionCm.Z * 1.0e3),
+			FMath::RoundToInt(Frame.Head.Rotation.Pitch * 1.0e3), FMath::RoundToInt(Frame.Head.Rotation.Yaw * 1.0e3), FMath::RoundToInt(Frame.Head.Rotation.Roll * 1.0e3) };
+		Checksum = FCrc::MemCrc32(Quantized, sizeof(Quantized), Checksum);
+
+		++OutDigest.FrameCount;
+		OutDigest.DurationSeconds = VirtualTime;
+	}
+
+	Analyzer.Analyze(OutDigest.Analytics);
+	OutDigest.OutputChecksum = Checksum;
+	OutDigest.WallTimeSeconds = FPlatformTime::Seconds() - WallStart;
+
+	Recording.StopPlayback();
+	return OutDigest.FrameCount > 0;
+}
+
+#if !UE_BUILD_SHIPPING
+
+// Console Command
+
+/** Replays a recording, or every .beamrec in a directory, and optionally writes the digests as a JSON array */
+static void BeamReplayCommand(const TArray<FString>& Args)
+{
+	if (Args.Num() < 1)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("Usage: Beam.Replay <file.beamrec | directory> [digest.json]"));
+		return;
+	}
+
+	TArray<FString> Recordings;
+	if (IFileManager::Get().DirectoryExists(*Args[0]))
+	{
+		IFileManager::Get().FindFiles(Recordings, *FPaths::Combine(Args[0], TEXT("*.beamrec")), true, false);
+		Recordings.Sort();
+		for (FString& Recording : Recordings)
+		{
+			Recording = FPaths::Combine(Args[0], Recording);
+		}
+	}
+	else
+	{
+		Recordings.Add(Args[0]);
+	}
+
+	FBeamReplayDriver Driver(FBeamReplayConfig::FromSettings(*GetDefault<UBeamEyeTrackerSettings>()));
+
+	TArray<FString> JsonDigests;
+	int32 Failures = 0;
+	for (const FString& Recording : Recordings)
+	{
+		FBeamReplayDigest Digest;
+		if (Driver.Run(Recording, Digest))
+		{
+			UE_LOG(LogBeam, Display, TEXT("Replay %s"), *Digest.ToString());
+			JsonDigests.Add(Digest.ToJson());
+		}
+		else
+		{
+			++Failures;
+		}
+	}
+
+	if (Args.Num() > 1)
+	{
+		const FString Json = TEXT("[\n") + FString::Join(JsonDigests, TEXT(",\n")) + TEXT("\n]\n");
+		if (!FFileHelper::SaveStringToFile(Json, *Args[1]))
+		{
+			UE_LOG(LogBeam, Error, TEXT("Replay: failed to write digest to %s"), *Args[1]);
+		}
+	}
+
+	UE_LOG(LogBeam, Display, TEXT("Replay finished: %d recordings, %d failed"), Recordings.Num(), Failures);
+}
+
+// Usage: Type "Beam.Replay Saved/BeamRecordings Saved/ReplayDigest.json" in console
+static FAutoConsoleCommand BeamReplayConsoleCommand(
+	TEXT("Beam.Replay"),
+	TEXT("Replays .beamrec recordings through the filter/prediction/analytics pipeline as fast as possible and reports a digest"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BeamReplayCommand)
+);
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,369 @@
+// Implements the background CPU, memory and GPU sampler for the plugin's own resources
+
+#include "BeamResources.h"
+#include "BeamLogging.h"
+#include "BeamStats.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+#include "RenderResource.h"
+#include "DynamicRHI.h"
+#include "RHICommandList.h"
+#include "RHIResources.h"
+
+#if PLATFORM_WINDOWS
+	#include "Windows/AllowWindowsPlatformTypes.h"
+	#include "Windows/WindowsHWrapper.h"
+	#include "Windows/HideWindowsPlatformTypes.h"
+#elif PLATFORM_LINUX || PLATFORM_ANDROID
+	#include <pthread.h>
+	#include <time.h>
+#endif
+
+LLM_DEFINE_TAG(BeamEyeTracker);
+
+FBeamResourceSampler GBeamResources;
+
+static TAutoConsoleVariable<float> CVarBeamResourcesSampleInterval(
+	TEXT("beam.Resources.SampleInterval"),
+	1.0f,
+	TEXT("Seconds between resource samples of the plugin's threads, memory and GPU passes"),
+	ECVF_Default
+);
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Thread CPU (% of core)"), STAT_BeamResourcesCPU, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Plugin Memory (MB)"), STAT_BeamResourcesMemory, STATGROUP_Beam);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GPU Passes (ms/s)"), STAT_BeamResourcesGPU, STATGROUP_Beam);
+
+namespace BeamResourcesPrivate
+{
+	/**
+	 * Timestamp query pairs around Beam render passes, resolved without
+	 * waiting a few frames later. Owned by the RHI so the queries are
+	 * released before it shuts down.
+	 */
+	class FGPUPassTimer : public FRenderResource
+	{
+	public:
+		static constexpr int32 NumPairs = 8;
+
+		virtual void ReleaseRHI() override
+		{
+			for (FPair& Pair : Pairs)
+			{
+				Pair.Begin.SafeRelease();
+				Pair.End.SafeRelease();
+				Pair.bInFlight = false;
+			}
+			OpenPair = INDEX_NONE;
+		}
+
+		void Begin(FRHICommandListImmediate& RHICmdList)
+		{
+			if (!GSupportsTimestampRenderQueries || OpenPair != INDEX_NONE)
+			{
+				return;
+			}
+
+			// Every pair still waiting on the GPU means this pass goes untimed rather than stalling
+			FPair& Pair = Pairs[NextPair];
+			if (Pair.bInFlight)
+			{
+				return;
+			}
+			if (!Pair.Begin.IsValid())
+			{
+				Pair.Begin = RHICreateRenderQuery(RQT_AbsoluteTime);
+				Pair.End = RHICreateRenderQuery(RQT_AbsoluteTime);
+			}
+
+			RHICmdList.EndRenderQuery(Pair.Begin);
+			OpenPair = NextPair;
+			NextPair = (NextPair + 1) % NumPairs;
+		}
+
+		void End(FRHICommandListImmediate& RHICmdList)
+		{
+			if (OpenPair == INDEX_NONE)
+			{
+				return;
+			}
+			FPair& Pair = Pairs[OpenPair];
+			RHICmdList.EndRenderQuery(Pair.End);
+			Pair.bInFlight = true;
+			OpenPair = INDEX_NONE;
+		}
+
+		/** Microseconds of every pair the GPU has finished, each counted once */
+		uint64 Resolve()
+		{
+			uint64 Micros = 0;
+			for (FPair& Pair : Pairs)
+			{
+				uint64 BeginMicros = 0;
+				uint64 EndMicros = 0;
+				if (Pair.bInFlight
+					&& RHIGetRenderQueryResult(Pair.Begin, BeginMicros, false)
+					&& RHIGetRenderQueryResult(Pair.End, EndMicros, false))
+				{
+					Micros += EndMicros > BeginMicros ? EndMicros - BeginMicros : 0;
+					Pair.bInFlight = false;
+				}
+			}
+			return Micros;
+		}
+
+	private:
+		struct FPair
+		{
+			FRenderQueryRHIRef Begin;
+			FRenderQueryRHIRef End;
+			bool bInFlight = false;
+		};
+
+		FPair Pairs[NumPairs];
+		int32 NextPair = 0;
+		int32 OpenPair = INDEX_NONE;
+	};
+
+	static TGlobalResource<FGPUPassTimer> GGPUPassTimer;
+}
+
+// Thread Registration
+
+void FBeamResourceSampler::RegisterCurrentThread(const TCHAR* Name)
+{
+	FThreadEntry Entry;
+	Entry.Name = Name;
+	Entry.ThreadId = FPlatformTLS::GetCurrentThreadId();
+	if (!OpenCurrentThread(Entry.PlatformHandle))
+	{
+		UE_LOG(LogBeam, Verbose, TEXT("BeamEyeTracker: Thread CPU time is not available for %s on this platform"), Name);
+	}
+	else
+	{
+		ReadThreadCPUSeconds(Entry.PlatformHandle, Entry.RegisteredCPUSeconds);
+		Entry.LastCPUSeconds = Entry.RegisteredCPUSeconds;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	Threads.Add(MoveTemp(Entry));
+}
+
+void FBeamResourceSampler::UnregisterCurrentThread()
+{
+	const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+	FScopeLock ScopeLock(&Lock);
+	const int32 Index = Threads.IndexOfByPredicate([ThreadId](const FThreadEntry& Entry) { return Entry.ThreadId == ThreadId; });
+	if (Index != INDEX_NONE)
+	{
+		CloseThread(Threads[Index].PlatformHandle);
+		Threads.RemoveAtSwap(Index);
+	}
+}
+
+// Sampling
+
+void FBeamResourceSampler::Start()
+{
+	check(IsInGameThread());
+	if (StartCount++ > 0)
+	{
+		return;
+	}
+
+	LastSampleSeconds = FPlatformTime::Seconds();
+	LastGPUMicros = GPUMicros.load(std::memory_order_relaxed);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FBeamResourceSampler::Tick),
+		FMath::Max(0.1f, CVarBeamResourcesSampleInterval.GetValueOnGameThread()));
+}
+
+void FBeamResourceSampler::Stop()
+{
+	check(IsInGameThread());
+	if (StartCount == 0 || --StartCount > 0)
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	if (PendingSample.IsValid())
+	{
+		PendingSample.Wait();
+		PendingSample.Reset();
+	}
+}
+
+bool FBeamResourceSampler::Tick(float DeltaTime)
+{
+	// A slow sample is skipped over rather than queued behind
+	if (PendingSample.IsValid() && !PendingSample.IsReady())
+	{
+		return true;
+	}
+	PendingSample = Async(EAsyncExecution::ThreadPool, [this]() { Sample(); });
+	return true;
+}
+
+void FBeamResourceSampler::Sample()
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+
+	FBeamResourceUsage Usage;
+	Usage.bValid = true;
+	Usage.SampleSeconds = NowSeconds;
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	if (FLowLevelMemTracker::IsEnabled())
+	{
+		Usage.MemoryBytes = FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, FName(TEXT("BeamEyeTracker")), ELLMTagSet::None);
+		Usage.bMemoryFromLLM = true;
+	}
+#endif
+	if (!Usage.bMemoryFromLLM)
+	{
+		Usage.MemoryBytes = BufferBytes.load(std::memory_order_relaxed);
+	}
+
+	const uint64 TotalGPUMicros = GPUMicros.load(std::memory_order_relaxed);
+
+	FScopeLock ScopeLock(&Lock);
+	const double Interval = NowSeconds - LastSampleSeconds;
+	LastSampleSeconds = NowSeconds;
+
+	for (FThreadEntry& Entry : Threads)
+	{
+		FBeamThreadUsage& ThreadUsage = Usage.Threads.AddDefaulted_GetRef();
+		ThreadUsage.Name = Entry.Name;
+
+		double CPUSeconds = 0.0;
+		if (ReadThreadCPUSeconds(Entry.PlatformHandle, CPUSeconds))
+		{
+			ThreadUsage.CPUSeconds = CPUSeconds - Entry.RegisteredCPUSeconds;
+			ThreadUsage.CPUPercent = Interval > 0.0 ? static_cast<float>(100.0 * (CPUSeconds - Entry.LastCPUSeconds) / Interval) : 0.0f;
+			Entry.LastCPUSeconds = CPUSeconds;
+			Usage.CPUPercent += ThreadUsage.CPUPercent;
+			Usage.bCPUMeasured = true;
+		}
+	}
+
+	if (Interval > 0.0)
+	{
+		const double GPUSeconds = static_cast<double>(TotalGPUMicros - LastGPUMicros) * 1.0e-6;
+		Usage.GPUMsPerSecond = GPUSeconds * 1000.0 / Interval;
+		Usage.GPUPercent = static_cast<float>(100.0 * GPUSeconds / Interval);
+	}
+	LastGPUMicros = TotalGPUMicros;
+
+	SET_FLOAT_STAT(STAT_BeamResourcesCPU, Usage.CPUPercent);
+	SET_FLOAT_STAT(STAT_BeamResourcesMemory, Usage.MemoryBytes / (1024.0 * 1024.0));
+	SET_FLOAT_STAT(STAT_BeamResourcesGPU, Usage.GPUMsPerSecond);
+
+	Latest = MoveTemp(Usage);
+}
+
+FBeamResourceUsage FBeamResourceSampler::GetLatest() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Latest;
+}
+
+// GPU Passes
+
+void FBeamResourceSampler::BeginGPUPass(FRHICommandListImmediate& RHICmdList)
+{
+	check(IsInRenderingThread());
+	AddGPUMicros(BeamResourcesPrivate::GGPUPassTimer.Resolve());
+	BeamResourcesPrivate::GGPUPassTimer.Begin(RHICmdList);
+}
+
+void FBeamResourceSampler::EndGPUPass(FRHICommandListImmediate& RHICmdList)
+{
+	check(IsInRenderingThread());
+	BeamResourcesPrivate::GGPUPassTimer.End(RHICmdList);
+}
+
+// Platform Thread Times
+
+bool FBeamResourceSampler::OpenCurrentThread(uint64& OutHandle)
+{
+	OutHandle = 0;
+#if PLATFORM_WINDOWS
+	HANDLE Handle = ::OpenThread(THREAD_QUERY_LIMITED_INFORMATION, 0, ::GetCurrentThreadId());
+	if (Handle)
+	{
+		OutHandle = reinterpret_cast<uint64>(Handle);
+		return true;
+	}
+#elif PLATFORM_LINUX || PLATFORM_ANDROID
+	clockid_t ClockId;
+	if (pthread_getcpuclockid(pthread_self(), &ClockId) == 0)
+	{
+		OutHandle = static_cast<uint64>(ClockId);
+		return true;
+	}
+#endif
+	return false;
+}
+
+void FBeamResourceSampler::CloseThread(uint64 Handle)
+{
+#if PLATFORM_WINDOWS
+	if (Handle)
+	{
+		::CloseHandle(reinterpret_cast<HANDLE>(Handle));
+	}
+#endif
+}
+
+bool FBeamResourceSampler::ReadThreadCPUSeconds(uint64 Handle, double& OutSeconds)
+{
+#if PLATFORM_WINDOWS
+	FILETIME Creation, Exit, Kernel, User;
+	if (Handle && ::GetThreadTimes(reinterpret_cast<HANDLE>(Handle), &Creation, &Exit, &Kernel, &User))
+	{
+		// FILETIME counts 100 ns intervals
+		const uint64 KernelTicks = (static_cast<uint64>(Kernel.dwHighDateTime) << 32) | Kernel.dwLowDateTime;
+		const uint64 UserTicks = (static_cast<uint64>(User.dwHighDateTime) << 32) | User.dwLowDateTime;
+		OutSeconds = static_cast<double>(KernelTicks + UserTicks) * 1.0e-7;
+		return true;
+	}
+#elif PLATFORM_LINUX || PLATFORM_ANDROID
+	timespec Time;
+	if (Handle && clock_gettime(static_cast<clockid_t>(Handle), &Time) == 0)
+	{
+		OutSeconds = static_cast<double>(Time.tv_sec) + static_cast<double>(Time.tv_nsec) * 1.0e-9;
+		return true;
+	}
+#endif
+	return false;
+}
+
+// Console Commands
+
+static FAutoConsoleCommand BeamResourcesReportCommand(
+	TEXT("Beam.Resources.Report"),
+	TEXT("Log the last measured CPU, memory and GPU cost of the plugin"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const FBeamResourceUsage Usage = GBeamResources.GetLatest();
+		if (!Usage.bValid)
+		{
+			UE_LOG(LogBeam, Log, TEXT("Resources: no sample yet"));
+			return;
+		}
+
+		UE_LOG(LogBeam, Log, TEXT("Resources: CPU %.2f%% of a core%s, memory %.2f MB (%s), GPU %.3f ms/s (%.2f%%)"),
+			Usage.CPUPercent, Usage.bCPUMeasured ? TEXT("") : TEXT(" (unmeasured)"),
+			Usage.MemoryBytes / (1024.0 * 1024.0), Usage.bMemoryFromLLM ? TEXT("LLM") : TEXT("buffers only"),
+			Usage.GPUMsPerSecond, Usage.GPUPercent);
+		for (const FBeamThreadUsage& Thread : Usage.Threads)
+		{
+			UE_LOG(LogBeam, Log, TEXT("  %-32s %6.2f%%  %.3f s total"), *Thread.Name, Thread.CPUPercent, Thread.CPUSeconds);
+		}
+	})
+);
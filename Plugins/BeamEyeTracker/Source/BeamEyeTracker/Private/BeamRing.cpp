@@ -2,96 +2,314 @@
 #include "HAL/PlatformAtomics.h"
 #include "HAL/PlatformTime.h"
 #include "HAL/PlatformMath.h"
-#include <cfloat>
+#include "HAL/PlatformProcess.h"
+#include "BeamStats.h"
+#include "BeamResources.h"
+#include <cmath>
+#include <limits>
+#include <type_traits>
 
-#if BEAM_RING_USE_SIMD && PLATFORM_ENABLE_VECTORINTRINSICS
-#include <immintrin.h>
+DECLARE_CYCLE_STAT(TEXT("Ring Publish"), STAT_BeamRingPublish, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("Ring Read"), STAT_BeamRingRead, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("Ring Range Read"), STAT_BeamRingRangeRead, STATGROUP_Beam);
+
+namespace BeamRing
+{
+	// Bytes an exact-reserve TArray of Num elements really holds once the allocator rounds the block up
+	template<typename ElementType>
+	static SIZE_T GetReservedBytes(int32 Num)
+	{
+		return FMemory::QuantizeSize(static_cast<SIZE_T>(Num) * sizeof(ElementType), alignof(ElementType));
+	}
+
+	// Reserves exactly Num first, so the array does not take the 3/8 growth slack of a first SetNum
+	template<typename ElementType>
+	static void SetNumExact(TArray<ElementType>& Array, int32 Num)
+	{
+		Array.Empty(Num);
+		Array.SetNumZeroed(Num);
+	}
+}
+
+#if BEAM_RING_USE_GAZE_COLUMNS
+void FBeamRingColumnStore::Allocate(int32 NumSlots)
+{
+	using namespace BeamRing;
+	SetNumExact(GazeX, NumSlots);
+	SetNumExact(GazeY, NumSlots);
+	SetNumExact(GazeConfidence, NumSlots);
+	SetNumExact(TimestampMs, NumSlots);
+	SetNumExact(HeadPositionX, NumSlots);
+	SetNumExact(HeadPositionY, NumSlots);
+	SetNumExact(HeadPositionZ, NumSlots);
+	SetNumExact(HeadPitch, NumSlots);
+	SetNumExact(HeadYaw, NumSlots);
+	SetNumExact(HeadRoll, NumSlots);
+	SetNumExact(HeadConfidence, NumSlots);
+}
+
+void FBeamRingColumnStore::Write(int32 SlotIndex, const FBeamFrame& Frame)
+{
+	// Invalid gaze keeps its screen position but reports zero confidence, so consumers can weight instead of branch
+	GazeX[SlotIndex] = static_cast<float>(Frame.Gaze.Screen01.X);
+	GazeY[SlotIndex] = static_cast<float>(Frame.Gaze.Screen01.Y);
+	GazeConfidence[SlotIndex] = Frame.Gaze.bValid ? static_cast<float>(Frame.Gaze.Confidence) : 0.0f;
+	TimestampMs[SlotIndex] = Frame.SDKTimestampMs;
+
+	HeadPositionX[SlotIndex] = static_cast<float>(Frame.Head.PositionCm.X);
+	HeadPositionY[SlotIndex] = static_cast<float>(Frame.Head.PositionCm.Y);
+	HeadPositionZ[SlotIndex] = static_cast<float>(Frame.Head.PositionCm.Z);
+	HeadPitch[SlotIndex] = static_cast<float>(Frame.Head.Rotation.Pitch);
+	HeadYaw[SlotIndex] = static_cast<float>(Frame.Head.Rotation.Yaw);
+	HeadRoll[SlotIndex] = static_cast<float>(Frame.Head.Rotation.Roll);
+	HeadConfidence[SlotIndex] = static_cast<float>(Frame.Head.Confidence);
+}
+
+FBeamGazeColumns FBeamRingColumnStore::MakeView(int32 Start, int32 Num) const
+{
+	FBeamGazeColumns View;
+	View.GazeX = GazeX.GetData() + Start;
+	View.GazeY = GazeY.GetData() + Start;
+	View.GazeConfidence = GazeConfidence.GetData() + Start;
+	View.TimestampMs = TimestampMs.GetData() + Start;
+	View.HeadPositionX = HeadPositionX.GetData() + Start;
+	View.HeadPositionY = HeadPositionY.GetData() + Start;
+	View.HeadPositionZ = HeadPositionZ.GetData() + Start;
+	View.HeadPitch = HeadPitch.GetData() + Start;
+	View.HeadYaw = HeadYaw.GetData() + Start;
+	View.HeadRoll = HeadRoll.GetData() + Start;
+	View.HeadConfidence = HeadConfidence.GetData() + Start;
+	View.Num = Num;
+	return View;
+}
+
+SIZE_T FBeamRingColumnStore::GetAllocatedSize() const
+{
+	return GazeX.GetAllocatedSize() + GazeY.GetAllocatedSize() + GazeConfidence.GetAllocatedSize() + TimestampMs.GetAllocatedSize()
+		+ HeadPositionX.GetAllocatedSize() + HeadPositionY.GetAllocatedSize() + HeadPositionZ.GetAllocatedSize()
+		+ HeadPitch.GetAllocatedSize() + HeadYaw.GetAllocatedSize() + HeadRoll.GetAllocatedSize() + HeadConfidence.GetAllocatedSize();
+}
+
+SIZE_T FBeamRingColumnStore::GetAllocatedSizeFor(int32 NumSlots)
+{
+	using namespace BeamRing;
+	return 10 * GetReservedBytes<float>(NumSlots) + GetReservedBytes<double>(NumSlots);
+}
 #endif
 
-FBeamRing::FBeamRing(int32 InBufferSize)
+DEFINE_STAT(STAT_BeamRingMemory);
+
+void FBeamRingFrameInterpolation::Interpolate(const FBeamFrame& Frame1, const FBeamFrame& Frame2, double Alpha, FBeamFrame& OutInterpolatedFrame)
+{
+	// Interpolate gaze data with confidence weighting
+	if (Frame1.Gaze.bValid && Frame2.Gaze.bValid)
+	{
+		OutInterpolatedFrame.Gaze.Screen01 = FMath::Lerp(Frame1.Gaze.Screen01, Frame2.Gaze.Screen01, Alpha);
+		OutInterpolatedFrame.Gaze.ScreenPx = FMath::Lerp(Frame1.Gaze.ScreenPx, Frame2.Gaze.ScreenPx, Alpha);
+		OutInterpolatedFrame.Gaze.Confidence = FMath::Lerp(Frame1.Gaze.Confidence, Frame2.Gaze.Confidence, Alpha);
+		OutInterpolatedFrame.Gaze.bValid = true;
+	}
+	else
+	{
+		// Use the more valid frame
+		OutInterpolatedFrame.Gaze = Frame1.Gaze.bValid ? Frame1.Gaze : Frame2.Gaze;
+	}
+	
+	// Interpolate head pose data with confidence weighting
+	if (Frame1.Head.Confidence > 0.0f && Frame2.Head.Confidence > 0.0f)
+	{
+		OutInterpolatedFrame.Head.PositionCm = FMath::Lerp(Frame1.Head.PositionCm, Frame2.Head.PositionCm, Alpha);
+		OutInterpolatedFrame.Head.SetRotation(BeamRotation::Nlerp(Frame1.Head.RotationQuat, Frame2.Head.RotationQuat, Alpha));
+		OutInterpolatedFrame.Head.Confidence = FMath::Lerp(Frame1.Head.Confidence, Frame2.Head.Confidence, Alpha);
+	}
+	else
+	{
+		// Use the more confident frame
+		OutInterpolatedFrame.Head = Frame1.Head.Confidence > Frame2.Head.Confidence ? Frame1.Head : Frame2.Head;
+	}
+	
+	if (Frame1.SimCamera.bValid && Frame2.SimCamera.bValid)
+	{
+		// Through quaternions, so a yaw or roll crossing +-180 degrees takes the short way round
+		OutInterpolatedFrame.SimCamera.Rotation = FQuat::Slerp(Frame1.SimCamera.Rotation.Quaternion(), Frame2.SimCamera.Rotation.Quaternion(), Alpha).Rotator();
+		OutInterpolatedFrame.SimCamera.TranslationCm = FMath::Lerp(Frame1.SimCamera.TranslationCm, Frame2.SimCamera.TranslationCm, Alpha);
+		OutInterpolatedFrame.SimCamera.bValid = true;
+	}
+	else
+	{
+		OutInterpolatedFrame.SimCamera = Frame1.SimCamera.bValid ? Frame1.SimCamera : Frame2.SimCamera;
+	}
+
+	// Interpolate timestamps
+	OutInterpolatedFrame.SDKTimestampMs = FMath::Lerp(Frame1.SDKTimestampMs, Frame2.SDKTimestampMs, Alpha);
+	OutInterpolatedFrame.DeltaTimeSeconds = FMath::Lerp(Frame1.DeltaTimeSeconds, Frame2.DeltaTimeSeconds, Alpha);
+	OutInterpolatedFrame.UETimestampSeconds = FMath::Lerp(Frame1.UETimestampSeconds, Frame2.UETimestampSeconds, Alpha);
+	OutInterpolatedFrame.FrameId = Alpha < 0.5 ? Frame1.FrameId : Frame2.FrameId;
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::TBeamRing(bool bInWithGazeColumns, bool bInWithSnapshots)
 	: WriteIndex(0)
-	, ReadIndex(0)
 	, PublishCount(0)
 	, TotalLatency(0.0)
 	, PeakLatency(0.0)
 	, LatencySampleCount(0)
-	, BufferSize(GetNextPowerOfTwo(InBufferSize))
-	, BufferMask(BufferSize - 1)
 	, bUseAdvancedInterpolation(true)
-	, bUseSecondaryBuffer(false)
 {
-	Buffer.SetNum(BufferSize);
-	SecondaryBuffer.SetNum(BufferSize);
-	
-	PreAllocate();
-	
-	bUseSecondaryBuffer.store(false, std::memory_order_relaxed);
+	LLM_SCOPE_BYTAG(BeamEyeTracker);
+	SlotSequences = MakeUnique<std::atomic<uint64>[]>(BufferSize);
+	BeamRing::SetNumExact(SlotFrames, BufferSize);
+	for (int32 i = 0; i < BufferSize; ++i)
+	{
+		SlotSequences[i].store(0, std::memory_order_relaxed);
+	}
+
+#if BEAM_RING_USE_GAZE_COLUMNS
+	if (std::is_same_v<T, FBeamFrame> && bInWithGazeColumns)
+	{
+		Columns = MakeUnique<FBeamRingColumnStore>();
+		Columns->Allocate(BufferSize);
+	}
+#endif
+
+	if (bDoubleBuffered && bInWithSnapshots)
+	{
+		// Both blocks are sized up front so neither side allocates after construction
+		Capture = MakeUnique<TBeamRingCapture<T>>();
+		BeamRing::SetNumExact(Capture->Blocks[0].Frames, BufferSize);
+		BeamRing::SetNumExact(Capture->Blocks[1].Frames, BufferSize);
+		Capture->Active.store(&Capture->Blocks[0], std::memory_order_relaxed);
+	}
+
+	INC_MEMORY_STAT_BY(STAT_BeamRingMemory, GetAllocatedSize());
+	GBeamResources.TrackBufferBytes(static_cast<int64>(GetAllocatedSize()));
 }
 
-FBeamRing::~FBeamRing()
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::~TBeamRing()
 {
-	for (FBeamFrame* PooledFrame : MemoryPool)
+	DEC_MEMORY_STAT_BY(STAT_BeamRingMemory, GetAllocatedSize());
+	GBeamResources.TrackBufferBytes(-static_cast<int64>(GetAllocatedSize()));
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+SIZE_T TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetAllocatedSize() const
+{
+	SIZE_T Bytes = SlotFrames.GetAllocatedSize() + BufferSize * sizeof(std::atomic<uint64>);
+#if BEAM_RING_USE_GAZE_COLUMNS
+	if (Columns)
+	{
+		Bytes += sizeof(FBeamRingColumnStore) + Columns->GetAllocatedSize();
+	}
+#endif
+	if (Capture)
 	{
-		delete PooledFrame;
+		Bytes += sizeof(TBeamRingCapture<T>) + Capture->Blocks[0].Frames.GetAllocatedSize() + Capture->Blocks[1].Frames.GetAllocatedSize();
 	}
-	MemoryPool.Empty();
+	return Bytes;
 }
 
-void FBeamRing::PreAllocate()
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+SIZE_T TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetAllocatedSizeFor(bool bWithGazeColumns, bool bWithSnapshots)
 {
-#if BEAM_RING_USE_MEMORY_POOL
-	MemoryPool.Reserve(BufferSize);
-	for (int32 i = 0; i < BufferSize; ++i)
+	using namespace BeamRing;
+
+	// Same terms as GetAllocatedSize, each taken at the allocator's rounded-up block size
+	SIZE_T Bytes = GetReservedBytes<T>(BufferSize) + GetReservedBytes<std::atomic<uint64>>(BufferSize);
+#if BEAM_RING_USE_GAZE_COLUMNS
+	if (std::is_same_v<T, FBeamFrame> && bWithGazeColumns)
 	{
-		void* AlignedMemory = FMemory::Malloc(sizeof(FBeamFrame), BEAM_CACHE_LINE_SIZE);
-		MemoryPool.Add(new(AlignedMemory) FBeamFrame());
+		Bytes += sizeof(FBeamRingColumnStore) + FBeamRingColumnStore::GetAllocatedSizeFor(BufferSize);
 	}
-	PoolIndex.store(0, std::memory_order_relaxed);
 #endif
+	if (bDoubleBuffered && bWithSnapshots)
+	{
+		Bytes += sizeof(TBeamRingCapture<T>) + 2 * GetReservedBytes<T>(BufferSize);
+	}
+	return Bytes;
 }
 
-bool FBeamRing::IsPowerOfTwo(int32 Value) const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+uint64 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetOldestIndex(uint64 Count)
 {
-	return (Value > 0) && ((Value & (Value - 1)) == 0);
+	return Count > static_cast<uint64>(Capacity) ? Count - BufferSize : 0;
 }
 
-int32 FBeamRing::GetNextPowerOfTwo(int32 Value) const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::ReadSlot(uint64 Index, T& OutFrame) const
 {
-	if (IsPowerOfTwo(Value))
+	const uint32 SlotIndex = static_cast<uint32>(Index & BufferMask);
+	const uint64 ExpectedSequence = (Index + 1) * 2;
+
+	if (SlotSequences[SlotIndex].load(std::memory_order_acquire) != ExpectedSequence)
 	{
-		return Value;
+		return false; // Being written or already overwritten by a newer lap
 	}
-	
-	int32 Power = 1;
-	while (Power < Value)
+
+	OutFrame = SlotFrames[SlotIndex];
+
+	// Re-validate after the copy; a change means the producer touched the slot mid-copy
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return SlotSequences[SlotIndex].load(std::memory_order_relaxed) == ExpectedSequence;
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::PeekSlotTimestamp(uint64 Index, double& OutTimestampMs) const
+{
+	const uint32 SlotIndex = static_cast<uint32>(Index & BufferMask);
+	const uint64 ExpectedSequence = (Index + 1) * 2;
+
+	if (SlotSequences[SlotIndex].load(std::memory_order_acquire) != ExpectedSequence)
 	{
-		Power <<= 1;
+		return false;
 	}
-	return Power;
+
+#if BEAM_RING_USE_GAZE_COLUMNS
+	// The timestamp column keeps binary searches on densely packed doubles instead of striding whole frames
+	OutTimestampMs = Columns ? Columns->TimestampMs[SlotIndex] : TimestampPolicy::GetTimestampMs(SlotFrames[SlotIndex]);
+#else
+	OutTimestampMs = TimestampPolicy::GetTimestampMs(SlotFrames[SlotIndex]);
+#endif
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return SlotSequences[SlotIndex].load(std::memory_order_relaxed) == ExpectedSequence;
 }
 
-bool FBeamRing::Publish(const FBeamFrame& Frame)
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::Publish(const T& Frame)
 {
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingPublish);
 	const double StartTime = FPlatformTime::Seconds();
 	
-	// Use double buffering for enhanced throughput
-	const bool bCurrentBuffer = bUseSecondaryBuffer.load(std::memory_order_relaxed);
-	TArray<FBeamFrame>& CurrentBuffer = bCurrentBuffer ? SecondaryBuffer : Buffer;
-	
-	uint32 CurrentWriteIndex = WriteIndex.load(std::memory_order_relaxed);
-	uint32 NextWriteIndex = (CurrentWriteIndex + 1) & BufferMask;
+	// Single producer: WriteIndex is only advanced here, so a relaxed load is sufficient
+	const uint64 Index = WriteIndex.load(std::memory_order_relaxed);
+	const uint32 SlotIndex = static_cast<uint32>(Index & BufferMask);
 
-	uint32 CurrentReadIndex = ReadIndex.load(std::memory_order_acquire);
-	if (NextWriteIndex == CurrentReadIndex)
+	// Odd sequence marks the slot as being written; readers retry instead of copying a torn frame
+	SlotSequences[SlotIndex].store(Index * 2 + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	SlotFrames[SlotIndex] = Frame;
+#if BEAM_RING_USE_GAZE_COLUMNS
+	if constexpr (std::is_same_v<T, FBeamFrame>)
 	{
-		// Buffer would overflow, advance read index to make room
-		ReadIndex.store(NextWriteIndex, std::memory_order_release);
+		if (Columns)
+		{
+			Columns->Write(SlotIndex, Frame);
+		}
 	}
-	
-	// Use optimized frame copy operation
-	CopyFrameOptimized(Frame, CurrentBuffer[CurrentWriteIndex]);
+#endif
+
+	SlotSequences[SlotIndex].store((Index + 1) * 2, std::memory_order_release);
+	WriteIndex.store(Index + 1, std::memory_order_release);
 
-	WriteIndex.store(NextWriteIndex, std::memory_order_release);
+	if constexpr (bDoubleBuffered)
+	{
+		if (Capture)
+		{
+			AppendToCapture(Frame);
+		}
+	}
 	
 	// Increment publish count
 	PublishCount.fetch_add(1, std::memory_order_relaxed);
@@ -102,307 +320,597 @@ bool FBeamRing::Publish(const FBeamFrame& Frame)
 	return true;
 }
 
-bool FBeamRing::ReadLatest(FBeamFrame& OutFrame) const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::ReadLatest(T& OutFrame) const
 {
-	uint32 CurrentReadIndex = ReadIndex.load(std::memory_order_relaxed);
-	uint32 CurrentWriteIndex = WriteIndex.load(std::memory_order_acquire);
-	
-	if (CurrentReadIndex == CurrentWriteIndex)
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRead);
+	for (int32 Attempt = 0; Attempt < BEAM_RING_MAX_READ_RETRIES; ++Attempt)
 	{
-		return false; // Buffer is empty
+		const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+		if (Count == 0)
+		{
+			return false; // Buffer is empty
+		}
+
+		// Newest published frame; on a tear, reload WriteIndex and try the frame that replaced it
+		if (ReadSlot(Count - 1, OutFrame))
+		{
+			return true;
+		}
 	}
-	
-	// Determine which buffer to read from
-	const bool bCurrentBuffer = bUseSecondaryBuffer.load(std::memory_order_relaxed);
-	const TArray<FBeamFrame>& CurrentBuffer = bCurrentBuffer ? SecondaryBuffer : Buffer;
-	
-	// Use optimized frame copy operation
-	CopyFrameOptimized(CurrentBuffer[CurrentReadIndex], OutFrame);
-	return true;
+
+	return false;
 }
 
-bool FBeamRing::GetFrameAt(double TimestampMs, FBeamFrame& OutFrame) const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+uint64 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::LowerBoundIndex(double TimestampMs, uint64 Count) const
 {
-	uint32 CurrentReadIndex = ReadIndex.load(std::memory_order_acquire);
-	uint32 CurrentWriteIndex = WriteIndex.load(std::memory_order_acquire);
-	
-	if (CurrentReadIndex == CurrentWriteIndex)
+	// Frames are published in increasing timestamp order, so the held window is sorted
+	uint64 Low = GetOldestIndex(Count);
+	uint64 High = Count;
+	while (Low < High)
+	{
+		const uint64 Mid = Low + (High - Low) / 2;
+		double MidTimestampMs = 0.0;
+
+		// A slot that fails validation was lapped by the producer and is older than anything we can return
+		if (!PeekSlotTimestamp(Mid, MidTimestampMs) || MidTimestampMs < TimestampMs)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	return Low;
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetFrameAt(double TimestampMs, T& OutFrame) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRead);
+	if constexpr (!TimestampPolicy::bEnabled)
+	{
+		return false; // No time index to search
+	}
+
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	if (Count == 0)
 	{
 		return false; // Buffer is empty
 	}
-	
-	// Determine which buffer to read from
-	const bool bCurrentBuffer = bUseSecondaryBuffer.load(std::memory_order_relaxed);
-	const TArray<FBeamFrame>& CurrentBuffer = bCurrentBuffer ? SecondaryBuffer : Buffer;
-	
-	// Find frame closest to the requested timestamp with optimized search
-	double ClosestTimeDiff = DBL_MAX;
-	bool bFound = false;
-	
-	uint32 Index = CurrentReadIndex;
-	while (Index != CurrentWriteIndex)
+
+	const uint64 Oldest = GetOldestIndex(Count);
+	const uint64 Upper = LowerBoundIndex(TimestampMs, Count);
+
+	// Nearest of the two bracketing samples, then copy exactly once
+	uint64 ClosestIndex = FMath::Min(Upper, Count - 1);
+	if (Upper > Oldest)
 	{
-		const FBeamFrame& Frame = CurrentBuffer[Index];
-		double TimeDiff = FMath::Abs(Frame.SDKTimestampMs - TimestampMs);
-		
-		if (TimeDiff < ClosestTimeDiff)
+		double UpperTimestampMs = 0.0;
+		double LowerTimestampMs = 0.0;
+		const bool bHasUpper = Upper < Count && PeekSlotTimestamp(Upper, UpperTimestampMs);
+		if (PeekSlotTimestamp(Upper - 1, LowerTimestampMs)
+			&& (!bHasUpper || (TimestampMs - LowerTimestampMs) <= (UpperTimestampMs - TimestampMs)))
 		{
-			ClosestTimeDiff = TimeDiff;
-			CopyFrameOptimized(Frame, OutFrame);
-			bFound = true;
+			ClosestIndex = Upper - 1;
 		}
-		
-		Index = (Index + 1) & BufferMask;
 	}
-	
-	return bFound;
+
+	return ReadSlot(ClosestIndex, OutFrame);
 }
 
-bool FBeamRing::GetLatestInterpolatedFrame(double DeltaSeconds, FBeamFrame& OutFrame) const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetInterpolatedFrameAt(double TimestampMs, T& OutFrame) const
 {
-	uint32 CurrentReadIndex = ReadIndex.load(std::memory_order_acquire);
-	uint32 CurrentWriteIndex = WriteIndex.load(std::memory_order_acquire);
-	
-	if (CurrentReadIndex == CurrentWriteIndex)
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRead);
+	if constexpr (!InterpolationPolicy::bEnabled)
+	{
+		return GetFrameAt(TimestampMs, OutFrame);
+	}
+
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	if (Count == 0)
+	{
+		return false; // Buffer is empty
+	}
+
+	const uint64 Upper = LowerBoundIndex(TimestampMs, Count);
+
+	// Outside the held window: clamp to the nearest end
+	if (Upper >= Count || Upper <= GetOldestIndex(Count))
+	{
+		return GetFrameAt(TimestampMs, OutFrame);
+	}
+
+	T Before;
+	T After;
+	if (!ReadSlot(Upper - 1, Before) || !ReadSlot(Upper, After))
+	{
+		return GetFrameAt(TimestampMs, OutFrame);
+	}
+
+	const double BeforeMs = TimestampPolicy::GetTimestampMs(Before);
+	const double Span = TimestampPolicy::GetTimestampMs(After) - BeforeMs;
+	const double Alpha = Span > 0.0 ? FMath::Clamp((TimestampMs - BeforeMs) / Span, 0.0, 1.0) : 0.0;
+
+	InterpolationPolicy::Interpolate(Before, After, Alpha, OutFrame);
+	return true;
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetLatestInterpolatedFrame(double DeltaSeconds, T& OutFrame) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRead);
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	if (Count == 0)
 	{
 		return false; // Buffer is empty
 	}
 	
-	// Determine which buffer to read from
-	const bool bCurrentBuffer = bUseSecondaryBuffer.load(std::memory_order_relaxed);
-	const TArray<FBeamFrame>& CurrentBuffer = bCurrentBuffer ? SecondaryBuffer : Buffer;
-	
-	if (bUseAdvancedInterpolation && CurrentWriteIndex != CurrentReadIndex)
+	if (InterpolationPolicy::bEnabled && bUseAdvancedInterpolation && Count >= 2)
 	{
-		
-		uint32 Frame1Index = (CurrentWriteIndex - 1) & BufferMask;
-		uint32 Frame2Index = (CurrentWriteIndex - 2) & BufferMask;
-		
-		if (Frame1Index != Frame2Index)
+		T Frame1;
+		T Frame2;
+		if (ReadSlot(Count - 1, Frame1) && ReadSlot(Count - 2, Frame2))
 		{
-			const FBeamFrame& Frame1 = CurrentBuffer[Frame1Index];
-			const FBeamFrame& Frame2 = CurrentBuffer[Frame2Index];
-			
 			// Calculate interpolation weight based on delta time
-			double Alpha = CalculateInterpolationWeight(DeltaSeconds, Frame2.SDKTimestampMs, Frame1.SDKTimestampMs);
+			double Alpha = CalculateInterpolationWeight(DeltaSeconds, TimestampPolicy::GetTimestampMs(Frame2), TimestampPolicy::GetTimestampMs(Frame1));
 			
 			// Perform advanced interpolation
-			InterpolateFrames(Frame2, Frame1, Alpha, OutFrame);
+			InterpolationPolicy::Interpolate(Frame2, Frame1, Alpha, OutFrame);
 			return true;
 		}
 	}
 	
 	// Fallback to latest frame
-	uint32 LatestIndex = (CurrentWriteIndex - 1) & BufferMask;
-	CopyFrameOptimized(CurrentBuffer[LatestIndex], OutFrame);
-	return true;
+	return ReadLatest(OutFrame);
 }
 
-int32 FBeamRing::GetBufferUtilization() const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+uint64 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetFirstStableIndex(uint64 Count)
 {
-	uint32 CurrentReadIndex = ReadIndex.load(std::memory_order_acquire);
-	uint32 CurrentWriteIndex = WriteIndex.load(std::memory_order_acquire);
-	
-	if (CurrentWriteIndex >= CurrentReadIndex)
+	// While WriteIndex == Count the producer may be rewriting index Count - BufferSize
+	return Count >= static_cast<uint64>(Capacity) ? Count - BufferSize + 1 : 0;
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+int32 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::CopyIndexRange(uint64 First, uint64 End, TArray<T>& OutFrames) const
+{
+	OutFrames.Reset();
+	if (End <= First)
 	{
-		return (CurrentWriteIndex - CurrentReadIndex) * 100 / BufferSize;
+		return 0;
 	}
-	else
+
+	const int32 Num = static_cast<int32>(End - First);
+	const int32 Start = static_cast<int32>(First & BufferMask);
+	const int32 FirstLength = FMath::Min(Num, BufferSize - Start);
+
+	// T is plain data, so each contiguous run is a single memcpy
+	OutFrames.AddUninitialized(Num);
+	FMemory::Memcpy(OutFrames.GetData(), SlotFrames.GetData() + Start, FirstLength * sizeof(T));
+	if (Num > FirstLength)
+	{
+		FMemory::Memcpy(OutFrames.GetData() + FirstLength, SlotFrames.GetData(), (Num - FirstLength) * sizeof(T));
+	}
+
+	// Anything the producer reached during the copy is suspect; trim it from the front
+	std::atomic_thread_fence(std::memory_order_acquire);
+	const uint64 StableFrom = GetFirstStableIndex(WriteIndex.load(std::memory_order_relaxed));
+	if (StableFrom > First)
 	{
-		return (BufferSize - CurrentReadIndex + CurrentWriteIndex) * 100 / BufferSize;
+		const int32 Torn = static_cast<int32>(FMath::Min<uint64>(StableFrom - First, Num));
+		OutFrames.RemoveAt(0, Torn, EAllowShrinking::No);
 	}
+
+	return OutFrames.Num();
 }
 
-int32 FBeamRing::GetMaxSize() const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetRangeIndices(double T0Ms, double T1Ms, uint64 Count, uint64& OutFirst, uint64& OutEnd) const
 {
-	return BufferSize;
+	if (!TimestampPolicy::bEnabled || Count == 0 || T1Ms < T0Ms)
+	{
+		return false;
+	}
+
+	// Upper bound is the first frame strictly after T1Ms
+	OutFirst = FMath::Max(LowerBoundIndex(T0Ms, Count), GetFirstStableIndex(Count));
+	OutEnd = LowerBoundIndex(std::nextafter(T1Ms, std::numeric_limits<double>::infinity()), Count);
+	return OutEnd > OutFirst;
 }
 
-void FBeamRing::Clear()
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+int32 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::CopyFramesInRange(double T0Ms, double T1Ms, TArray<T>& OutFrames) const
 {
-	ReadIndex.store(0, std::memory_order_relaxed);
-	WriteIndex.store(0, std::memory_order_relaxed);
-	PublishCount.store(0, std::memory_order_relaxed);
-	
-	// Reset performance statistics
-	TotalLatency.store(0.0, std::memory_order_relaxed);
-	PeakLatency.store(0.0, std::memory_order_relaxed);
-	LatencySampleCount.store(0, std::memory_order_relaxed);
-	
-	// Toggle buffer for double buffering
-	bUseSecondaryBuffer.store(!bUseSecondaryBuffer.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRangeRead);
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	uint64 First = 0;
+	uint64 End = 0;
+	if (!GetRangeIndices(T0Ms, T1Ms, Count, First, End))
+	{
+		OutFrames.Reset();
+		return 0;
+	}
+
+	return CopyIndexRange(First, End, OutFrames);
 }
 
-void FBeamRing::SetAdvancedInterpolation(bool bEnable)
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+int32 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::CopyLatestFrames(int32 NumFrames, TArray<T>& OutFrames) const
 {
-	bUseAdvancedInterpolation = bEnable;
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRangeRead);
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	const uint64 Wanted = static_cast<uint64>(FMath::Clamp(NumFrames, 0, BufferSize));
+	const uint64 First = FMath::Max(Count > Wanted ? Count - Wanted : 0, GetFirstStableIndex(Count));
+	return CopyIndexRange(First, Count, OutFrames);
 }
 
-void FBeamRing::GetPerformanceStats(int32& OutFrameCount, double& OutAverageLatency, double& OutPeakLatency) const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::VisitFramesInRange(double T0Ms, double T1Ms, TFunctionRef<void(TArrayView<const T>)> Visitor) const
 {
-	OutFrameCount = static_cast<int32>(PublishCount.load(std::memory_order_relaxed));
-	OutPeakLatency = PeakLatency.load(std::memory_order_relaxed);
-	
-	int32 SampleCount = LatencySampleCount.load(std::memory_order_relaxed);
-	if (SampleCount > 0)
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRangeRead);
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	uint64 First = 0;
+	uint64 End = 0;
+	if (!GetRangeIndices(T0Ms, T1Ms, Count, First, End))
 	{
-		OutAverageLatency = TotalLatency.load(std::memory_order_relaxed) / SampleCount;
+		return true;
 	}
-	else
+
+	const int32 Num = static_cast<int32>(End - First);
+	const int32 Start = static_cast<int32>(First & BufferMask);
+	const int32 FirstLength = FMath::Min(Num, BufferSize - Start);
+
+	Visitor(TArrayView<const T>(SlotFrames.GetData() + Start, FirstLength));
+	if (Num > FirstLength)
 	{
-		OutAverageLatency = 0.0;
+		Visitor(TArrayView<const T>(SlotFrames.GetData(), Num - FirstLength));
 	}
+
+	// Valid only if the producer never reached the oldest visited slot
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return GetFirstStableIndex(WriteIndex.load(std::memory_order_relaxed)) <= First;
 }
 
-void FBeamRing::CopyFrameOptimized(const FBeamFrame& Source, FBeamFrame& Destination) const
-{
-#if BEAM_RING_USE_SIMD && PLATFORM_ENABLE_VECTORINTRINSICS
-	// SIMD-optimized frame copy for high-performance systems
-	if (PLATFORM_ENABLE_VECTORINTRINSICS)
-	{
-		// Copy gaze data (8 floats = 32 bytes) using SIMD
-		// Convert double to float for SIMD operations
-		float GazeScreen01[4] = { static_cast<float>(Source.Gaze.Screen01.X), static_cast<float>(Source.Gaze.Screen01.Y), 
-		                          static_cast<float>(Source.Gaze.ScreenPx.X), static_cast<float>(Source.Gaze.ScreenPx.Y) };
-		__m128 GazeData = _mm_loadu_ps(GazeScreen01);
-		_mm_storeu_ps(GazeScreen01, GazeData);
-		Destination.Gaze.Screen01.X = GazeScreen01[0];
-		Destination.Gaze.Screen01.Y = GazeScreen01[1];
-		Destination.Gaze.ScreenPx.X = GazeScreen01[2];
-		Destination.Gaze.ScreenPx.Y = GazeScreen01[3];
-		
-		// Copy head pose data (PositionCm.X, PositionCm.Y, PositionCm.Z, Confidence)
-		float HeadPos[4] = { static_cast<float>(Source.Head.PositionCm.X), static_cast<float>(Source.Head.PositionCm.Y), 
-		                     static_cast<float>(Source.Head.PositionCm.Z), static_cast<float>(Source.Head.Confidence) };
-		__m128 HeadPosData = _mm_loadu_ps(HeadPos);
-		_mm_storeu_ps(HeadPos, HeadPosData);
-		Destination.Head.PositionCm.X = HeadPos[0];
-		Destination.Head.PositionCm.Y = HeadPos[1];
-		Destination.Head.PositionCm.Z = HeadPos[2];
-		Destination.Head.Confidence = HeadPos[3];
-		
-		// Copy head rotation data (Pitch, Yaw, Roll, padding)
-		float HeadRot[4] = { static_cast<float>(Source.Head.Rotation.Pitch), static_cast<float>(Source.Head.Rotation.Yaw), 
-		                     static_cast<float>(Source.Head.Rotation.Roll), 0.0f };
-		__m128 HeadRotData = _mm_loadu_ps(HeadRot);
-		_mm_storeu_ps(HeadRot, HeadRotData);
-		Destination.Head.Rotation.Pitch = HeadRot[0];
-		Destination.Head.Rotation.Yaw = HeadRot[1];
-		Destination.Head.Rotation.Roll = HeadRot[2];
-		
-		// Copy remaining scalar data
-		Destination.Gaze.bValid = Source.Gaze.bValid;
-		Destination.SDKTimestampMs = Source.SDKTimestampMs;
-		Destination.DeltaTimeSeconds = Source.DeltaTimeSeconds;
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::VisitGazeColumnsInRange(double T0Ms, double T1Ms, TFunctionRef<void(const FBeamGazeColumns&)> Visitor) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRangeRead);
+#if BEAM_RING_USE_GAZE_COLUMNS
+	if (!Columns)
+	{
+		return false; // Not requested, or not an FBeamFrame ring
 	}
-	else
+
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	uint64 First = 0;
+	uint64 End = 0;
+	if (!GetRangeIndices(T0Ms, T1Ms, Count, First, End))
+	{
+		return true;
+	}
+
+	const int32 Num = static_cast<int32>(End - First);
+	const int32 Start = static_cast<int32>(First & BufferMask);
+	const int32 FirstLength = FMath::Min(Num, BufferSize - Start);
+
+	Visitor(Columns->MakeView(Start, FirstLength));
+	if (Num > FirstLength)
+	{
+		Visitor(Columns->MakeView(0, Num - FirstLength));
+	}
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return GetFirstStableIndex(WriteIndex.load(std::memory_order_relaxed)) <= First;
+#else
+	return false;
 #endif
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::HasGazeColumns() const
+{
+#if BEAM_RING_USE_GAZE_COLUMNS
+	return Columns.IsValid();
+#else
+	return false;
+#endif
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+int32 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetBufferUtilization() const
+{
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	const uint64 Held = FMath::Min(Count, static_cast<uint64>(Capacity));
+	return static_cast<int32>(Held * 100 / BufferSize);
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+int32 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetNum() const
+{
+	return static_cast<int32>(FMath::Min(WriteIndex.load(std::memory_order_acquire), static_cast<uint64>(Capacity)));
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+void TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::AppendToCapture(const T& Frame)
+{
+	// Publish the hazard before touching the block, then confirm no snapshot flipped it away in between
+	TBeamRingCaptureBlock<T>* Block = Capture->Active.load(std::memory_order_seq_cst);
+	for (;;)
 	{
-		// Standard copy for non-SIMD platforms
-		Destination = Source;
+		Capture->Producer.store(Block, std::memory_order_seq_cst);
+		TBeamRingCaptureBlock<T>* Current = Capture->Active.load(std::memory_order_seq_cst);
+		if (Current == Block)
+		{
+			break;
+		}
+		Block = Current;
 	}
+
+	Block->Frames[Block->Count & BufferMask] = Frame;
+	++Block->Count;
+
+	Capture->Producer.store(nullptr, std::memory_order_release);
 }
 
-void FBeamRing::InterpolateFrames(const FBeamFrame& Frame1, const FBeamFrame& Frame2, 
-								   double Alpha, FBeamFrame& OutInterpolatedFrame) const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+int32 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::TakeSnapshot(TArray<T>& OutFrames)
 {
-	// Interpolate gaze data with confidence weighting
-	if (Frame1.Gaze.bValid && Frame2.Gaze.bValid)
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRangeRead);
+	OutFrames.Reset();
+
+	if (!bDoubleBuffered || !Capture)
 	{
-		OutInterpolatedFrame.Gaze.Screen01 = FMath::Lerp(Frame1.Gaze.Screen01, Frame2.Gaze.Screen01, Alpha);
-		OutInterpolatedFrame.Gaze.ScreenPx = FMath::Lerp(Frame1.Gaze.ScreenPx, Frame2.Gaze.ScreenPx, Alpha);
-		OutInterpolatedFrame.Gaze.Confidence = FMath::Lerp(Frame1.Gaze.Confidence, Frame2.Gaze.Confidence, Alpha);
-		OutInterpolatedFrame.Gaze.bValid = true;
+		return 0;
 	}
-	else
+
+	// The block not currently active has been ours since the previous snapshot
+	TBeamRingCaptureBlock<T>* Spare = Capture->Active.load(std::memory_order_acquire) == &Capture->Blocks[0] ? &Capture->Blocks[1] : &Capture->Blocks[0];
+	Spare->Count = 0;
+
+	TBeamRingCaptureBlock<T>* Retired = Capture->Active.exchange(Spare, std::memory_order_seq_cst);
+
+	// At most one in-flight append can still target the retired block
+	while (Capture->Producer.load(std::memory_order_seq_cst) == Retired)
 	{
-		// Use the more valid frame
-		OutInterpolatedFrame.Gaze = Frame1.Gaze.bValid ? Frame1.Gaze : Frame2.Gaze;
+		FPlatformProcess::YieldThread();
 	}
-	
-	// Interpolate head pose data with confidence weighting
-	if (Frame1.Head.Confidence > 0.0f && Frame2.Head.Confidence > 0.0f)
+
+	const uint64 Count = Retired->Count;
+	const int32 Held = static_cast<int32>(FMath::Min(Count, static_cast<uint64>(Capacity)));
+	if (Held == 0)
 	{
-		OutInterpolatedFrame.Head.PositionCm = FMath::Lerp(Frame1.Head.PositionCm, Frame2.Head.PositionCm, Alpha);
-		OutInterpolatedFrame.Head.Rotation = FMath::Lerp(Frame1.Head.Rotation, Frame2.Head.Rotation, Alpha);
-		OutInterpolatedFrame.Head.Confidence = FMath::Lerp(Frame1.Head.Confidence, Frame2.Head.Confidence, Alpha);
+		return 0;
 	}
-	else
+
+	// Oldest-first copy in at most two contiguous segments
+	const int32 First = static_cast<int32>((Count - Held) & BufferMask);
+	const int32 FirstLength = FMath::Min(Held, BufferSize - First);
+	OutFrames.Reserve(Held);
+	OutFrames.Append(Retired->Frames.GetData() + First, FirstLength);
+	OutFrames.Append(Retired->Frames.GetData(), Held - FirstLength);
+	return Held;
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+int32 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::RegisterConsumer(FName Name, int32 BacklogFrames) const
+{
+	for (int32 ConsumerId = 0; ConsumerId < BEAM_RING_MAX_CONSUMERS; ++ConsumerId)
 	{
-		// Use the more confident frame
-		OutInterpolatedFrame.Head = Frame1.Head.Confidence > Frame2.Head.Confidence ? Frame1.Head : Frame2.Head;
+		FBeamRingConsumerCursor& Cursor = Consumers[ConsumerId];
+		uint8 Expected = FBeamRingConsumerCursor::Free;
+		if (!Cursor.State.compare_exchange_strong(Expected, FBeamRingConsumerCursor::Claiming, std::memory_order_acquire))
+		{
+			continue;
+		}
+
+		// Clear bumps the count before it rewinds the write index, so a clear between the loads is still seen
+		const uint32 Clears = ClearCount.load(std::memory_order_acquire);
+		const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+		const uint64 Backlog = static_cast<uint64>(FMath::Clamp(BacklogFrames, 0, BufferSize));
+		Cursor.Generation.fetch_add(1, std::memory_order_relaxed);
+		Cursor.ClearCount.store(Clears, std::memory_order_relaxed);
+		Cursor.Name = Name;
+		Cursor.NextIndex.store(FMath::Max(Count > Backlog ? Count - Backlog : 0, GetFirstStableIndex(Count)), std::memory_order_relaxed);
+		Cursor.DroppedFrames.store(0, std::memory_order_relaxed);
+		Cursor.LapCount.store(0, std::memory_order_relaxed);
+		Cursor.State.store(FBeamRingConsumerCursor::Active, std::memory_order_release);
+		return ConsumerId;
 	}
-	
-	// Interpolate timestamps
-	OutInterpolatedFrame.SDKTimestampMs = FMath::Lerp(Frame1.SDKTimestampMs, Frame2.SDKTimestampMs, Alpha);
-	OutInterpolatedFrame.DeltaTimeSeconds = FMath::Lerp(Frame1.DeltaTimeSeconds, Frame2.DeltaTimeSeconds, Alpha);
+	return INDEX_NONE;
 }
 
-double FBeamRing::CalculateInterpolationWeight(double TargetTime, double Frame1Time, double Frame2Time) const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+void TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::UnregisterConsumer(int32 ConsumerId) const
 {
-	if (FMath::IsNearlyEqual(Frame1Time, Frame2Time))
+	if (ConsumerId >= 0 && ConsumerId < BEAM_RING_MAX_CONSUMERS)
 	{
-		return 0.5f; // Equal weights if timestamps are the same
+		Consumers[ConsumerId].State.store(FBeamRingConsumerCursor::Free, std::memory_order_release);
 	}
-	
-	// Calculate weight based on temporal distance
-	double TotalTimeDiff = Frame2Time - Frame1Time;
-	if (TotalTimeDiff > 0.0)
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+int32 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::ConsumeFrames(int32 ConsumerId, TArray<T>& OutFrames, int32 MaxFrames) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamRingRangeRead);
+	OutFrames.Reset();
+	if (ConsumerId < 0 || ConsumerId >= BEAM_RING_MAX_CONSUMERS)
 	{
-		double Weight = (TargetTime - Frame1Time) / TotalTimeDiff;
-		return FMath::Clamp(Weight, 0.0, 1.0);
+		return 0;
 	}
-	
-	return 0.5f; // Default to equal weights
+
+	FBeamRingConsumerCursor& Cursor = Consumers[ConsumerId];
+	const uint32 Clears = ClearCount.load(std::memory_order_acquire);
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	const uint64 Stable = GetFirstStableIndex(Count);
+	uint64 Next = Cursor.NextIndex.load(std::memory_order_relaxed);
+
+	// Cleared under the cursor: the new stream is read from its start, even once the refill has passed the old index.
+	// A cursor past the write index is a clear whose rewind landed after the count was read
+	if (Clears != Cursor.ClearCount.load(std::memory_order_relaxed) || Next > Count)
+	{
+		Cursor.ClearCount.store(Clears, std::memory_order_relaxed);
+		Next = Stable;
+	}
+
+	// Lapped: the producer never waits, so the consumer jumps to the oldest frame still held and owns the gap
+	uint64 Dropped = 0;
+	if (Next < Stable)
+	{
+		Dropped = Stable - Next;
+		Next = Stable;
+	}
+
+	const uint64 End = FMath::Min(Count, Next + static_cast<uint64>(FMath::Clamp(MaxFrames, 0, BufferSize)));
+	CopyIndexRange(Next, End, OutFrames);
+	Dropped += (End - Next) - static_cast<uint64>(OutFrames.Num());
+
+	if (Dropped > 0)
+	{
+		Cursor.DroppedFrames.fetch_add(Dropped, std::memory_order_relaxed);
+		Cursor.LapCount.fetch_add(1, std::memory_order_relaxed);
+		ConsumerDroppedFrames.fetch_add(Dropped, std::memory_order_relaxed);
+	}
+	Cursor.NextIndex.store(End, std::memory_order_release);
+	return OutFrames.Num();
 }
 
-void FBeamRing::UpdatePerformanceStats(double Latency)
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+bool TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetConsumerStats(int32 ConsumerId, FBeamRingConsumerStats& OutStats) const
 {
-	
-	TotalLatency.fetch_add(Latency, std::memory_order_relaxed);
+	if (ConsumerId < 0 || ConsumerId >= BEAM_RING_MAX_CONSUMERS)
+	{
+		return false;
+	}
+
+	const FBeamRingConsumerCursor& Cursor = Consumers[ConsumerId];
+	const uint32 Generation = Cursor.Generation.load(std::memory_order_acquire);
+	if (Cursor.State.load(std::memory_order_acquire) != FBeamRingConsumerCursor::Active)
+	{
+		return false;
+	}
+
+	OutStats.ConsumerId = ConsumerId;
+	OutStats.Name = Cursor.Name;
+	OutStats.DroppedFrames = Cursor.DroppedFrames.load(std::memory_order_relaxed);
+	OutStats.LapCount = Cursor.LapCount.load(std::memory_order_relaxed);
+	const uint64 Next = Cursor.NextIndex.load(std::memory_order_relaxed);
+	const uint64 Count = WriteIndex.load(std::memory_order_acquire);
+	OutStats.LagFrames = Count > Next ? Count - Next : 0;
+	OutStats.bSlow = OutStats.LagFrames > static_cast<uint64>(BufferSize / 4 * 3);
+
+	// Released and re-registered while we read: the name may be torn, so report nothing
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return Cursor.Generation.load(std::memory_order_relaxed) == Generation
+		&& Cursor.State.load(std::memory_order_relaxed) == FBeamRingConsumerCursor::Active;
+}
 
-	double CurrentPeak = PeakLatency.load(std::memory_order_relaxed);
-	while (Latency > CurrentPeak)
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+int32 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetAllConsumerStats(TArray<FBeamRingConsumerStats>& OutStats) const
+{
+	OutStats.Reset();
+	for (int32 ConsumerId = 0; ConsumerId < BEAM_RING_MAX_CONSUMERS; ++ConsumerId)
 	{
-		if (PeakLatency.compare_exchange_weak(CurrentPeak, Latency, std::memory_order_relaxed))
+		FBeamRingConsumerStats Stats;
+		if (GetConsumerStats(ConsumerId, Stats))
 		{
-			break;
+			OutStats.Add(Stats);
 		}
 	}
-	
-	// Increment sample count
-	LatencySampleCount.fetch_add(1, std::memory_order_relaxed);
+	return OutStats.Num();
 }
 
-void FBeamRing::ProcessFrameBatchSIMD(const TArray<FBeamFrame>& InputFrames, TArray<FBeamFrame>& OutputFrames) const
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+uint64 TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetOverwrittenFrames() const
 {
-#if BEAM_RING_USE_SIMD && PLATFORM_ENABLE_VECTORINTRINSICS
-	if (!PLATFORM_ENABLE_VECTORINTRINSICS)
+	// Every publish past the first lap replaced exactly one older frame
+	return OverwrittenBeforeClear.load(std::memory_order_relaxed) + GetOldestIndex(WriteIndex.load(std::memory_order_acquire));
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+void TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::Clear()
+{
+	OverwrittenBeforeClear.fetch_add(GetOldestIndex(WriteIndex.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+	ClearCount.fetch_add(1, std::memory_order_release);
+	WriteIndex.store(0, std::memory_order_release);
+	PublishCount.store(0, std::memory_order_relaxed);
+
+	// Invalidate every slot so in-flight readers cannot match a stale sequence
+	for (int32 i = 0; i < BufferSize; ++i)
 	{
-		return;
+		SlotSequences[i].store(0, std::memory_order_release);
+	}
+
+	if (Capture)
+	{
+		Capture->Blocks[0].Count = 0;
+		Capture->Blocks[1].Count = 0;
 	}
 	
-	const int32 NumFrames = InputFrames.Num();
-	OutputFrames.SetNum(NumFrames);
+	// Reset performance statistics
+	TotalLatency.store(0.0, std::memory_order_relaxed);
+	PeakLatency.store(0.0, std::memory_order_relaxed);
+	LatencySampleCount.store(0, std::memory_order_relaxed);
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+void TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::SetAdvancedInterpolation(bool bEnable)
+{
+	bUseAdvancedInterpolation = bEnable;
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+void TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::GetPerformanceStats(int32& OutFrameCount, double& OutAverageLatency, double& OutPeakLatency) const
+{
+	OutFrameCount = static_cast<int32>(PublishCount.load(std::memory_order_relaxed));
+	OutPeakLatency = PeakLatency.load(std::memory_order_relaxed);
 	
-	// Process frames in batches of 4 for SIMD optimization
-	const int32 SIMDSize = 4;
-	const int32 SIMDEnd = (NumFrames / SIMDSize) * SIMDSize;
+	int32 SampleCount = LatencySampleCount.load(std::memory_order_relaxed);
+	if (SampleCount > 0)
+	{
+		OutAverageLatency = TotalLatency.load(std::memory_order_relaxed) / SampleCount;
+	}
+	else
+	{
+		OutAverageLatency = 0.0;
+	}
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+double TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::CalculateInterpolationWeight(double TargetTime, double Frame1Time, double Frame2Time) const
+{
+	if (FMath::IsNearlyEqual(Frame1Time, Frame2Time))
+	{
+		return 0.5f; // Equal weights if timestamps are the same
+	}
 	
-	for (int32 i = 0; i < SIMDEnd; i += SIMDSize)
+	// Calculate weight based on temporal distance
+	double TotalTimeDiff = Frame2Time - Frame1Time;
+	if (TotalTimeDiff > 0.0)
 	{
-		// Process 4 frames simultaneously using SIMD
-		for (int32 j = 0; j < SIMDSize; ++j)
-		{
-			CopyFrameOptimized(InputFrames[i + j], OutputFrames[i + j]);
-		}
+		double Weight = (TargetTime - Frame1Time) / TotalTimeDiff;
+		return FMath::Clamp(Weight, 0.0, 1.0);
 	}
 	
-	// Process remaining frames
-	for (int32 i = SIMDEnd; i < NumFrames; ++i)
+	return 0.5f; // Default to equal weights
+}
+
+template<typename T, int32 Capacity, typename TimestampPolicy, typename InterpolationPolicy, bool bDoubleBuffered>
+void TBeamRing<T, Capacity, TimestampPolicy, InterpolationPolicy, bDoubleBuffered>::UpdatePerformanceStats(double Latency)
+{
+	// Single producer: plain relaxed stores, no read-modify-write or CAS loop on the publish path
+	TotalLatency.store(TotalLatency.load(std::memory_order_relaxed) + Latency, std::memory_order_relaxed);
+	if (Latency > PeakLatency.load(std::memory_order_relaxed))
 	{
-		CopyFrameOptimized(InputFrames[i], OutputFrames[i]);
+		PeakLatency.store(Latency, std::memory_order_relaxed);
 	}
-#endif
+	LatencySampleCount.store(LatencySampleCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 }
 
+// Supported instantiations; anything else needs its own line here
+template class BEAMEYETRACKER_API TBeamRing<FBeamFrame, 1024, FBeamRingFrameTimestamps, FBeamRingFrameInterpolation, true>;
+template class BEAMEYETRACKER_API TBeamRing<FBeamFrameCompact, 64, FBeamRingCompactTimestamps, FBeamRingNoInterpolation>;
+template class BEAMEYETRACKER_API TBeamRing<FBeamFrameCompact, 1024, FBeamRingCompactTimestamps, FBeamRingNoInterpolation>;
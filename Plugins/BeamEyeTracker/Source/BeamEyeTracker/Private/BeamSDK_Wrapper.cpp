@@ -3,6 +3,10 @@
 #include "BeamSDK_Wrapper.h"
 #include "BeamEyeTrackerTypes.h"
 #include "BeamLogging.h"
+#include "BeamRing.h"
+#include "BeamLatency.h"
+#include "BeamFlightRecorder.h"
+#include "BeamStats.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
@@ -10,10 +14,13 @@
 // LogBeam is defined in BeamEyeTrackerComponent.cpp
 #include "HAL/PlatformProcess.h"
 #include "HAL/PlatformTime.h"
+#include "HAL/Event.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "Async/Async.h"
 
+DECLARE_CYCLE_STAT(TEXT("Convert SDK Frame"), STAT_BeamConvertSDKFrame, STATGROUP_Beam);
+
 // Platform safety check
 #if PLATFORM_WINDOWS
 	#include "Windows/AllowWindowsPlatformTypes.h"
@@ -33,20 +40,80 @@
 	}
 #endif
 
+#if PLATFORM_WINDOWS
+/** Receives SDK pushes on the SDK callback thread and publishes converted frames into the wrapper's ring */
+class FBeamTrackingListener : public eyeware::beam_eye_tracker::TrackingListener
+{
+public:
+	explicit FBeamTrackingListener(FBeamSDK_Wrapper* InOwner)
+		: Owner(InOwner)
+	{
+	}
+
+	virtual void on_tracking_data_reception_status_changed(eyeware::beam_eye_tracker::TrackingDataReceptionStatus Status) override
+	{
+		UE_LOG(LogBeam, Verbose, TEXT("BeamSDK: Tracking data reception status changed to %d"), static_cast<int32>(Status));
+		Owner->bReceivingTrackingData.store(Status == eyeware::beam_eye_tracker::TrackingDataReceptionStatus::RECEIVING_TRACKING_DATA, std::memory_order_relaxed);
+	}
+
+	virtual void on_tracking_state_set_update(const eyeware::beam_eye_tracker::TrackingStateSet& TrackingStateSet, const eyeware::beam_eye_tracker::Timestamp Timestamp) override
+	{
+		// Counted before the wake so the producer never sees a frame the count does not cover yet
+		Owner->StateSetCount.fetch_add(1, std::memory_order_release);
+		Owner->LastStateSetSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+
+		// An event-driven producer converts the frame itself; waking it is all that happens here
+		if (FEvent* Event = Owner->FrameEvent)
+		{
+			Event->Trigger();
+		}
+
+		FBeamFrameRing* Sink = Owner->FrameSink;
+		if (!Sink)
+		{
+			return;
+		}
+
+		// Convert once here so game-thread readers only pay for a ring read
+		FBeamFrame Frame;
+		if (Owner->ConvertSDKDataToFrame(TrackingStateSet, Frame))
+		{
+			Frame.FrameId = Owner->NextFrameId.fetch_add(1, std::memory_order_relaxed);
+			if (GBeamLatency.ShouldSample(Frame.FrameId))
+			{
+				GBeamLatency.Record(EBeamLatencyStage::DeliveryJitter, Frame.ConvertedSeconds - Frame.UETimestampSeconds);
+			}
+			GBeamLatency.StampPublish(Frame);
+			Sink->Publish(Frame);
+			GBeamFlightRecorder.RecordFrame(Frame);
+		}
+	}
+
+private:
+	FBeamSDK_Wrapper* Owner;
+};
+#endif
+
 // FBeamSDK_Wrapper Implementation
 
 FBeamSDK_Wrapper::FBeamSDK_Wrapper()
-	: APIInstance(nullptr)
+	: FrameSink(nullptr)
+	, FrameEvent(nullptr)
+	, NextFrameId(0)
+	, StateSetCount(0)
+	, LastStateSetSeconds(0.0)
+	, bReceivingTrackingData(false)
+	, LastWaitFrameId(INDEX_NONE)
+	, WaitFrameIdBase(INDEX_NONE)
+	, LastUpdateTimestamp(EW_BET_NULL_DATA_TIMESTAMP)
+	, APIInstance(nullptr)
 	, ListenerHandle(eyeware::beam_eye_tracker::INVALID_TRACKING_LISTENER_HANDLE)
 	, bInitialized(false)
+	, ViewportOrigin(FIntPoint::ZeroValue)
 	, ViewportWidth(1920)
 	, ViewportHeight(1080)
 {
-	
-	ViewportGeometry.point_00.x = 0.0f;
-	ViewportGeometry.point_00.y = 0.0f;
-	ViewportGeometry.point_11.x = static_cast<float>(ViewportWidth - 1);
-	ViewportGeometry.point_11.y = static_cast<float>(ViewportHeight - 1);
+	SetViewportRect(ViewportOrigin, FIntPoint(1920, 1080));
 }
 
 FBeamSDK_Wrapper::~FBeamSDK_Wrapper()
@@ -73,13 +140,8 @@ bool FBeamSDK_Wrapper::InitSDK(const FString& ApplicationName, int32 InViewportW
 		return false;
 	}
 
-	ViewportWidth = InViewportWidth;
-	ViewportHeight = InViewportHeight;
-
-	ViewportGeometry.point_00.x = 0.0f;
-	ViewportGeometry.point_00.y = 0.0f;
-	ViewportGeometry.point_11.x = static_cast<float>(ViewportWidth - 1);
-	ViewportGeometry.point_11.y = static_cast<float>(ViewportHeight - 1);
+	// Keeps the desktop origin from the last UpdateViewportRect, so a windowed primary viewport stays where it is
+	SetViewportRect(ViewportOrigin, FIntPoint(InViewportWidth, InViewportHeight));
 	
 	UE_LOG(LogBeam, Log, TEXT("BeamSDK: Creating API instance..."));
 
@@ -97,8 +159,8 @@ bool FBeamSDK_Wrapper::InitSDK(const FString& ApplicationName, int32 InViewportW
 	
 	UE_LOG(LogBeam, Log, TEXT("BeamSDK: Beam Eye Tracker start attempt completed"));
 
-	bool bBeamAppRunning = IsBeamAppRunning();
-	if (bBeamAppRunning)
+	QueryReceptionStatus();
+	if (bReceivingTrackingData.load(std::memory_order_relaxed))
 	{
 		UE_LOG(LogBeam, Log, TEXT("BeamSDK: Beam Eye Tracker application is running and ready"));
 	}
@@ -110,7 +172,7 @@ bool FBeamSDK_Wrapper::InitSDK(const FString& ApplicationName, int32 InViewportW
 	
 	bInitialized = true;
 	UE_LOG(LogBeam, Log, TEXT("BeamSDK: Initialized successfully for application '%s' with viewport %dx%d"), 
-		*ApplicationName, ViewportWidth, ViewportHeight);
+		*ApplicationName, ViewportWidth.load(), ViewportHeight.load());
 	
 	return true;
 #else
@@ -121,6 +183,9 @@ bool FBeamSDK_Wrapper::InitSDK(const FString& ApplicationName, int32 InViewportW
 
 void FBeamSDK_Wrapper::Shutdown()
 {
+	// Listener must be unregistered before the API instance goes away
+	StopListening();
+
 #if PLATFORM_WINDOWS
 	if (APIInstance)
 	{
@@ -130,7 +195,11 @@ void FBeamSDK_Wrapper::Shutdown()
 #endif
 	
 	bInitialized = false;
+	bReceivingTrackingData.store(false, std::memory_order_relaxed);
 	ListenerHandle = eyeware::beam_eye_tracker::INVALID_TRACKING_LISTENER_HANDLE;
+	LastUpdateTimestamp = EW_BET_NULL_DATA_TIMESTAMP;
+	LastStateSetSeconds.store(0.0, std::memory_order_relaxed);
+	ClockSync.Reset();
 }
 
 bool FBeamSDK_Wrapper::IsSDKInitialized() const
@@ -146,8 +215,26 @@ bool FBeamSDK_Wrapper::Start()
 		return false;
 	}
 
-	// In a full implementation, you'd implement the TrackingListener interface
-	// and use start_receiving_tracking_data_on_listener
+	// Without a sink or event, callers keep using TryGetLatest (synchronous mode)
+	if ((!FrameSink && !FrameEvent) || TrackingListener)
+	{
+		return true;
+	}
+
+	TrackingListener = new FBeamTrackingListener(this);
+	ListenerHandle = APIInstance->start_receiving_tracking_data_on_listener(TrackingListener);
+	if (ListenerHandle == eyeware::beam_eye_tracker::INVALID_TRACKING_LISTENER_HANDLE)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamSDK: Failed to register tracking listener, falling back to synchronous reads"));
+		delete TrackingListener;
+		TrackingListener = nullptr;
+		return true;
+	}
+
+	// The listener only reports changes, so take the status it starts from
+	QueryReceptionStatus();
+
+	UE_LOG(LogBeam, Log, TEXT("BeamSDK: Tracking listener started (%s)"), FrameSink ? TEXT("push ingestion") : TEXT("frame signalling"));
 	return true;
 #else
 	return false;
@@ -159,6 +246,74 @@ bool FBeamSDK_Wrapper::IsRunning() const
 	return bInitialized && APIInstance != nullptr;
 }
 
+void FBeamSDK_Wrapper::SetFrameSink(FBeamFrameRing* InFrameSink)
+{
+	if (FrameSink == InFrameSink)
+	{
+		return;
+	}
+
+	// The callback thread reads FrameSink, so never swap it under a live listener
+	const bool bWasListening = IsListening();
+	StopListening();
+
+	FrameSink = InFrameSink;
+
+	if (bWasListening && (FrameSink || FrameEvent))
+	{
+		Start();
+	}
+}
+
+bool FBeamSDK_Wrapper::SetFrameEvent(FEvent* InFrameEvent)
+{
+	if (FrameEvent != InFrameEvent)
+	{
+		// Same rule as the sink: the callback thread reads FrameEvent
+		StopListening();
+		FrameEvent = InFrameEvent;
+
+		if (FrameSink || FrameEvent)
+		{
+			Start();
+		}
+	}
+	return FrameEvent && IsListening();
+}
+
+bool FBeamSDK_Wrapper::IsListening() const
+{
+#if PLATFORM_WINDOWS
+	return TrackingListener != nullptr && ListenerHandle != eyeware::beam_eye_tracker::INVALID_TRACKING_LISTENER_HANDLE;
+#else
+	return false;
+#endif
+}
+
+bool FBeamSDK_Wrapper::IsPushIngestionActive() const
+{
+	return FrameSink != nullptr && IsListening();
+}
+
+void FBeamSDK_Wrapper::StopListening()
+{
+#if PLATFORM_WINDOWS
+	if (APIInstance && ListenerHandle != eyeware::beam_eye_tracker::INVALID_TRACKING_LISTENER_HANDLE)
+	{
+		// Deregister before freeing the listener the SDK holds a pointer to
+		APIInstance->stop_receiving_tracking_data_on_listener(ListenerHandle);
+	}
+
+	if (TrackingListener)
+	{
+		delete TrackingListener;
+		TrackingListener = nullptr;
+	}
+#endif
+
+	ListenerHandle = eyeware::beam_eye_tracker::INVALID_TRACKING_LISTENER_HANDLE;
+}
+
 bool FBeamSDK_Wrapper::TryGetLatest(FBeamFrame& OutFrame)
 {
 #if PLATFORM_WINDOWS
@@ -176,6 +331,58 @@ bool FBeamSDK_Wrapper::TryGetLatest(FBeamFrame& OutFrame)
 #endif
 }
 
+bool FBeamSDK_Wrapper::WaitForNewFrame(FBeamFrame& OutFrame, uint32 TimeoutMs)
+{
+#if PLATFORM_WINDOWS
+	if (!bInitialized || !APIInstance)
+	{
+		return false;
+	}
+
+	// Returns as soon as the tracker publishes, so frames arrive at its native rate
+	if (!APIInstance->wait_for_new_tracking_state_set(LastUpdateTimestamp, TimeoutMs))
+	{
+		return false;
+	}
+
+	// A state set without a user converts to nothing but still shows the SDK is alive
+	LastStateSetSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+
+	auto TrackingStateSet = APIInstance->get_latest_tracking_state_set();
+	if (!ConvertSDKDataToFrame(TrackingStateSet, OutFrame))
+	{
+		return false;
+	}
+
+	// Ids skip the state sets the SDK published between two waits, so the producer can count them as dropped
+	int64 FrameId = LastWaitFrameId + 1;
+	if (IsListening())
+	{
+		const int64 Seen = StateSetCount.load(std::memory_order_acquire);
+		if (WaitFrameIdBase == INDEX_NONE)
+		{
+			WaitFrameIdBase = FrameId - Seen;
+		}
+		FrameId = FMath::Max(FrameId, WaitFrameIdBase + Seen);
+	}
+	else
+	{
+		// Without the listener coalesced state sets are invisible; ids stay dense
+		WaitFrameIdBase = INDEX_NONE;
+	}
+	OutFrame.FrameId = FrameId;
+	LastWaitFrameId = FrameId;
+
+	if (GBeamLatency.ShouldSample(OutFrame.FrameId))
+	{
+		GBeamLatency.Record(EBeamLatencyStage::DeliveryJitter, OutFrame.ConvertedSeconds - OutFrame.UETimestampSeconds);
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
 FString FBeamSDK_Wrapper::GetSDKVersion() const
 {
 #if PLATFORM_WINDOWS
@@ -193,16 +400,23 @@ FString FBeamSDK_Wrapper::GetSDKVersion() const
 
 bool FBeamSDK_Wrapper::IsBeamAppRunning() const
 {
-#if PLATFORM_WINDOWS
-	if (!bInitialized || !APIInstance)
+	return bInitialized && bReceivingTrackingData.load(std::memory_order_relaxed);
+}
+
+void FBeamSDK_Wrapper::RefreshReceptionStatus()
+{
+	if (bInitialized && !IsListening())
 	{
-		return false;
+		QueryReceptionStatus();
 	}
-	
-	auto Status = APIInstance->get_tracking_data_reception_status();
-	return Status == eyeware::beam_eye_tracker::TrackingDataReceptionStatus::RECEIVING_TRACKING_DATA;
-#else
-	return false;
+}
+
+void FBeamSDK_Wrapper::QueryReceptionStatus()
+{
+#if PLATFORM_WINDOWS
+	const bool bReceiving = APIInstance
+		&& APIInstance->get_tracking_data_reception_status() == eyeware::beam_eye_tracker::TrackingDataReceptionStatus::RECEIVING_TRACKING_DATA;
+	bReceivingTrackingData.store(bReceiving, std::memory_order_relaxed);
 #endif
 }
 
@@ -211,16 +425,11 @@ void FBeamSDK_Wrapper::UpdateViewportGeometry(int32 InViewportWidth, int32 InVie
 #if PLATFORM_WINDOWS
 	if (InViewportWidth > 0 && InViewportHeight > 0 && APIInstance)
 	{
-		ViewportWidth = InViewportWidth;
-		ViewportHeight = InViewportHeight;
-
-		ViewportGeometry.point_00.x = 0.0f;
-		ViewportGeometry.point_00.y = 0.0f;
-		ViewportGeometry.point_11.x = static_cast<float>(ViewportWidth - 1);
-		ViewportGeometry.point_11.y = static_cast<float>(ViewportHeight - 1);
+		// Size-only update; the desktop origin stays whatever UpdateViewportRect last set
+		SetViewportRect(ViewportOrigin, FIntPoint(InViewportWidth, InViewportHeight));
 		
 		APIInstance->update_viewport_geometry(ViewportGeometry);
-		UE_LOG(LogBeam, Log, TEXT("BeamSDK: Viewport updated to %dx%d"), ViewportWidth, ViewportHeight);
+		UE_LOG(LogBeam, Log, TEXT("BeamSDK: Viewport updated to %dx%d"), InViewportWidth, InViewportHeight);
 	}
 	else
 	{
@@ -229,6 +438,36 @@ void FBeamSDK_Wrapper::UpdateViewportGeometry(int32 InViewportWidth, int32 InVie
 #endif
 }
 
+void FBeamSDK_Wrapper::UpdateViewportRect(const FIntPoint& OriginPx, const FIntPoint& SizePx)
+{
+	if (SizePx.X <= 0 || SizePx.Y <= 0)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamSDK: Invalid viewport dimensions: %dx%d"), SizePx.X, SizePx.Y);
+		return;
+	}
+
+	SetViewportRect(OriginPx, SizePx);
+#if PLATFORM_WINDOWS
+	if (APIInstance)
+	{
+		APIInstance->update_viewport_geometry(ViewportGeometry);
+		UE_LOG(LogBeam, Log, TEXT("BeamSDK: Viewport updated to %dx%d at (%d, %d)"), SizePx.X, SizePx.Y, OriginPx.X, OriginPx.Y);
+	}
+#endif
+}
+
+void FBeamSDK_Wrapper::SetViewportRect(const FIntPoint& OriginPx, const FIntPoint& SizePx)
+{
+	ViewportOrigin = OriginPx;
+	ViewportWidth.store(SizePx.X, std::memory_order_relaxed);
+	ViewportHeight.store(SizePx.Y, std::memory_order_relaxed);
+
+	ViewportGeometry.point_00.x = OriginPx.X;
+	ViewportGeometry.point_00.y = OriginPx.Y;
+	ViewportGeometry.point_11.x = OriginPx.X + SizePx.X - 1;
+	ViewportGeometry.point_11.y = OriginPx.Y + SizePx.Y - 1;
+}
+
 bool FBeamSDK_Wrapper::StartCameraRecentering()
 {
 #if PLATFORM_WINDOWS
@@ -259,85 +498,130 @@ void FBeamSDK_Wrapper::EndCameraRecentering()
 bool FBeamSDK_Wrapper::ConvertSDKDataToFrame(const eyeware::beam_eye_tracker::TrackingStateSet& TrackingStateSet, FBeamFrame& OutFrame)
 {
 #if PLATFORM_WINDOWS
-	
-	const auto& UserState = TrackingStateSet.user_state();
+	if (!ConvertUserStateToFrame(TrackingStateSet.user_state(), OutFrame, &ClockSync))
+	{
+		return false;
+	}
+	OutFrame.Gaze.ScreenPx = OutFrame.Gaze.Screen01 * FVector2D(ViewportWidth.load(std::memory_order_relaxed), ViewportHeight.load(std::memory_order_relaxed));
+
+	// Computed here, once per tracker frame, so camera consumers only interpolate cached values
+	ConvertSimCameraState(TrackingStateSet.sim_game_camera_state(), OutFrame.SimCamera);
+	return true;
+#else
+	return false;
+#endif
+}
 
+FQuat FBeamSDK_Wrapper::RotationMatrixToQuat(const EW_BET_Matrix3x3& M)
+{
+	// Every component from its own diagonal combination, the sign from the matching off-diagonal
+	// difference: no trace-case branches, and the same convention as FQuat(const FMatrix&).
+	// The signs are only ambiguous for 180 degree turns, which a head facing the screen never makes.
+	const float M00 = M[0][0], M11 = M[1][1], M22 = M[2][2];
+	const float W = 0.5f * FMath::Sqrt(FMath::Max(0.0f, 1.0f + M00 + M11 + M22));
+	const float X = 0.5f * FMath::Sqrt(FMath::Max(0.0f, 1.0f + M00 - M11 - M22));
+	const float Y = 0.5f * FMath::Sqrt(FMath::Max(0.0f, 1.0f - M00 + M11 - M22));
+	const float Z = 0.5f * FMath::Sqrt(FMath::Max(0.0f, 1.0f - M00 - M11 + M22));
+
+	FQuat Quat(
+		M[1][2] - M[2][1] >= 0.0f ? X : -X,
+		M[2][0] - M[0][2] >= 0.0f ? Y : -Y,
+		M[0][1] - M[1][0] >= 0.0f ? Z : -Z,
+		W);
+	Quat.Normalize();
+	return Quat;
+}
+
+void FBeamSDK_Wrapper::ConvertSimCameraState(const eyeware::beam_eye_tracker::SimGameCameraState& State, FBeamSimCameraTransform& OutTransform)
+{
+	OutTransform = FBeamSimCameraTransform();
+#if PLATFORM_WINDOWS
+	if (State.timestamp_in_seconds == EW_BET_NULL_DATA_TIMESTAMP)
+	{
+		return;
+	}
+
+	// Default weights apply the blend the user configured in the Beam app; per-game scaling happens in the camera modifier
+	const eyeware::beam_eye_tracker::SimCameraTransform3D Transform =
+		eyeware::beam_eye_tracker::API::compute_sim_game_camera_transform_parameters(State);
+
+	// SDK camera space is X right, Y up, Z toward the user, in meters and radians
+	OutTransform.Rotation = FRotator(
+		FMath::RadiansToDegrees(Transform.pitch_in_radians),
+		FMath::RadiansToDegrees(Transform.yaw_in_radians),
+		FMath::RadiansToDegrees(Transform.roll_in_radians));
+	OutTransform.TranslationCm = FVector(-Transform.z_in_meters, Transform.x_in_meters, Transform.y_in_meters) * 100.0;
+	OutTransform.bValid = true;
+#endif
+}
+
+bool FBeamSDK_Wrapper::ConvertUserStateToFrame(const eyeware::beam_eye_tracker::UserState& UserState, FBeamFrame& OutFrame, FBeamClockSync* ClockSync)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamConvertSDKFrame);
 	if (UserState.timestamp_in_seconds == 0.0)
 	{
 		return false;
 	}
 
 	const auto& UnifiedScreenGaze = UserState.unified_screen_gaze;
-	if (UnifiedScreenGaze.confidence == static_cast<EW_BET_TrackingConfidence>(eyeware::beam_eye_tracker::TrackingConfidence::LOST_TRACKING))
+	const auto& HeadPose = UserState.head_pose;
+	const EW_BET_TrackingConfidence LostTracking = static_cast<EW_BET_TrackingConfidence>(eyeware::beam_eye_tracker::TrackingConfidence::LOST_TRACKING);
+	const bool bGazeLost = UnifiedScreenGaze.confidence == LostTracking;
+	const bool bHeadLost = HeadPose.confidence <= LostTracking;
+	if (bGazeLost && bHeadLost)
 	{
 		return false;
 	}
-	
-	// Convert gaze data
-	OutFrame.Gaze.bValid = true;
-	OutFrame.Gaze.Screen01.X = UnifiedScreenGaze.point_of_regard.x;
-	OutFrame.Gaze.Screen01.Y = UnifiedScreenGaze.point_of_regard.y;
-	OutFrame.Gaze.Confidence = static_cast<float>(UnifiedScreenGaze.confidence) / 3.0f; // Convert 0-3 scale to 0-1
-	OutFrame.Gaze.TimestampMs = FPlatformTime::Seconds() * 1000.0; // Convert to milliseconds
 
-	const auto& HeadPose = UserState.head_pose;
-	if (HeadPose.confidence > static_cast<EW_BET_TrackingConfidence>(eyeware::beam_eye_tracker::TrackingConfidence::LOST_TRACKING))
+	// Every timestamp is the SDK capture time; only UETimestampSeconds moves it onto the local clock
+	const double CaptureSeconds = UserState.timestamp_in_seconds;
+	const double CaptureMs = CaptureSeconds * 1000.0;
+	const double NowSeconds = FPlatformTime::Seconds();
+
+	// A blink loses gaze but not the head; the frame still goes out so the gap filler sees the gap
+	OutFrame.Gaze.bValid = !bGazeLost;
+	OutFrame.Gaze.TimestampMs = CaptureMs;
+	if (bGazeLost)
+	{
+		OutFrame.Gaze.Confidence = 0.0;
+	}
+	else
+	{
+		// Normalized against the registered viewport rectangle; other viewports are mapped from it by FBeamViewportRegistry
+		OutFrame.Gaze.Screen01.X = UserState.viewport_gaze.normalized_point_of_regard.x;
+		OutFrame.Gaze.Screen01.Y = UserState.viewport_gaze.normalized_point_of_regard.y;
+		OutFrame.Gaze.Confidence = static_cast<float>(UnifiedScreenGaze.confidence) / 3.0f; // Convert 0-3 scale to 0-1
+	}
+
+	if (!bHeadLost)
 	{
 		OutFrame.Head.PositionCm = FVector(
 			HeadPose.translation_from_hcs_to_wcs.x * 100.0f, // Convert meters to cm
 			HeadPose.translation_from_hcs_to_wcs.y * 100.0f,
 			HeadPose.translation_from_hcs_to_wcs.z * 100.0f
 		);
-		
-		// Convert rotation matrix to Unreal rotator
-		// Extract Yaw and Pitch from the rotation matrix properly
-		FMatrix RotationMatrix;
-		RotationMatrix.M[0][0] = HeadPose.rotation_from_hcs_to_wcs[0][0];
-		RotationMatrix.M[0][1] = HeadPose.rotation_from_hcs_to_wcs[0][1];
-		RotationMatrix.M[0][2] = HeadPose.rotation_from_hcs_to_wcs[0][2];
-		RotationMatrix.M[0][3] = 0.0f;
-		RotationMatrix.M[1][0] = HeadPose.rotation_from_hcs_to_wcs[1][0];
-		RotationMatrix.M[1][1] = HeadPose.rotation_from_hcs_to_wcs[1][1];
-		RotationMatrix.M[1][2] = HeadPose.rotation_from_hcs_to_wcs[1][2];
-		RotationMatrix.M[1][3] = 0.0f;
-		RotationMatrix.M[2][0] = HeadPose.rotation_from_hcs_to_wcs[2][0];
-		RotationMatrix.M[2][1] = HeadPose.rotation_from_hcs_to_wcs[2][1];
-		RotationMatrix.M[2][2] = HeadPose.rotation_from_hcs_to_wcs[2][2];
-		RotationMatrix.M[2][3] = 0.0f;
-		RotationMatrix.M[3][0] = 0.0f;
-		RotationMatrix.M[3][1] = 0.0f;
-		RotationMatrix.M[3][2] = 0.0f;
-		RotationMatrix.M[3][3] = 1.0f;
-		
-		// Convert to rotator and extract Yaw and Pitch for head tracking
-		FRotator MatrixRotator = RotationMatrix.Rotator();
-		
-		// For head tracking, we want Yaw (left/right) and Pitch (up/down)
-		// The Beam SDK provides head rotation relative to the camera
-		OutFrame.Head.Rotation = FRotator(
-			MatrixRotator.Pitch,  // Up/down head movement
-			MatrixRotator.Yaw,    // Left/right head movement  
-			MatrixRotator.Roll    // Head tilt (usually minimal)
-		);
+
+		// Straight from the SDK matrix to a quaternion; the rotator (pitch up/down, yaw left/right,
+		// roll tilt, relative to the camera) is derived from it once
+		OutFrame.Head.SetRotation(RotationMatrixToQuat(HeadPose.rotation_from_hcs_to_wcs));
 		OutFrame.Head.Confidence = static_cast<double>(HeadPose.confidence) / 3.0; // Convert 0-3 scale to 0-1
-		OutFrame.Head.TimestampMs = FPlatformTime::Seconds() * 1000.0;
+		OutFrame.Head.TimestampMs = CaptureMs;
 		OutFrame.Head.TrackSessionUID = HeadPose.track_session_uid;
 	}
 	else
 	{
 		OutFrame.Head.PositionCm = FVector::ZeroVector;
 		OutFrame.Head.Rotation = FRotator::ZeroRotator;
+		OutFrame.Head.RotationQuat = FQuat::Identity;
 		OutFrame.Head.Confidence = 0.0;
 		OutFrame.Head.TimestampMs = 0.0;
 		OutFrame.Head.TrackSessionUID = 0;
 	}
 
-	OutFrame.SDKTimestampMs = UserState.timestamp_in_seconds * 1000.0; // Convert seconds to milliseconds
-	OutFrame.UETimestampSeconds = FPlatformTime::Seconds();
+	OutFrame.SDKTimestampMs = CaptureMs;
+	OutFrame.UETimestampSeconds = ClockSync ? ClockSync->AddSample(CaptureSeconds, NowSeconds) : NowSeconds;
+	OutFrame.ConvertedSeconds = NowSeconds;
 	
 	return true;
-#else
-	return false;
-#endif
 }
 
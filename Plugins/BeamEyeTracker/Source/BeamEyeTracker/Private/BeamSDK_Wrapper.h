@@ -2,8 +2,8 @@
     BeamSDK_Wrapper.h: C++ wrapper for native Beam SDK integration.
 
     Provides C++ interface to the Beam SDK with full API integration
-    for Windows platforms. Implements synchronous data access for
-    real-time tracking with comprehensive coordinate mapping support.
+    for Windows platforms. Implements synchronous data access and
+    push-based listener ingestion with coordinate mapping support.
 
     Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
 
@@ -20,13 +20,16 @@
 #include "Math/Rotator.h"
 #include "Math/Vector.h"
 #include "Math/Vector2D.h"
+#include <atomic>
+#include "BeamRing.h"
+#include "BeamClockSync.h"
 
 // Beam SDK includes - using relative path to thirdparty directory
 #include "../../../ThirdParty/BeamSDK/include/eyeware/beam_eye_tracker.h"
 
 // Forward declarations
-class FBeamFrameBuffer;
 class FRunnableThread;
+class FEvent;
 
 #if PLATFORM_WINDOWS
 class FBeamTrackingListener;
@@ -48,24 +51,45 @@ public:
 	/** Checks if SDK is properly initialized and ready */
 	bool IsSDKInitialized() const;
 
-	/** Starts tracking (synchronous mode) */
+	/** Starts tracking; registers the push listener when a frame sink is set */
 	bool Start();
 
 	/** Checks if tracking is currently active and running */
 	bool IsRunning() const;
 
+	/** Sets the ring that listener callbacks publish into (nullptr disables push ingestion) */
+	void SetFrameSink(FBeamFrameRing* InFrameSink);
+
+	/** Returns true while the SDK listener is registered and publishing into the frame sink */
+	bool IsPushIngestionActive() const;
+
+	/** Sets the event listener callbacks trigger on every new state set (nullptr stops signalling); true when the event will fire */
+	bool SetFrameEvent(FEvent* InFrameEvent);
+
 	/** Gets the latest frame data from the SDK */
 	bool TryGetLatest(FBeamFrame& OutFrame);
 
+	/** Blocks until the SDK has a newer tracking state set (or the timeout elapses) and converts it */
+	bool WaitForNewFrame(FBeamFrame& OutFrame, uint32 TimeoutMs);
+
 	/** Gets the SDK version string for compatibility checking */
 	FString GetSDKVersion() const;
 
-	/** Checks if the Beam application is currently running */
+	/** Checks if the Beam application is currently running; reads the cached reception status, never the SDK */
 	bool IsBeamAppRunning() const;
 
+	/** FPlatformTime seconds of the last state set the SDK delivered, with or without a user in it; 0 before the first */
+	double GetLastStateSetSeconds() const { return LastStateSetSeconds.load(std::memory_order_relaxed); }
+
+	/** Re-queries the SDK's reception status; a no-op while the listener reports status changes itself */
+	void RefreshReceptionStatus();
+
 	/** Updates viewport geometry for accurate coordinate mapping */
 	void UpdateViewportGeometry(int32 ViewportWidth, int32 ViewportHeight);
 
+	/** Sets the desktop rectangle the SDK normalizes gaze against; applied immediately when the API exists, else at InitSDK */
+	void UpdateViewportRect(const FIntPoint& OriginPx, const FIntPoint& SizePx);
+
 	/** Starts camera recentering process using the SDK */
 	bool StartCameraRecentering();
 
@@ -75,7 +99,70 @@ public:
 	/** Converts raw SDK data to the internal frame format */
 	bool ConvertSDKDataToFrame(const eyeware::beam_eye_tracker::TrackingStateSet& TrackingStateSet, FBeamFrame& OutFrame);
 
+	/**
+	 * Conversion core; works on plain SDK structs, so it is available (and benchmarkable) on every platform.
+	 * Gaze and head timestamps keep the SDK capture time; UETimestampSeconds is that capture time on
+	 * FPlatformTime when a ClockSync is given, and the conversion time otherwise.
+	 */
+	static bool ConvertUserStateToFrame(const eyeware::beam_eye_tracker::UserState& UserState, FBeamFrame& OutFrame, FBeamClockSync* ClockSync = nullptr);
+
+	/** Runs the SDK's sim game camera computation at default weights and converts the result to camera-local Unreal space */
+	static void ConvertSimCameraState(const eyeware::beam_eye_tracker::SimGameCameraState& State, FBeamSimCameraTransform& OutTransform);
+
+	/** SDK capture clock to FPlatformTime mapping, fed by every converted frame */
+	const FBeamClockSync& GetClockSync() const { return ClockSync; }
+
+	/** Converts an SDK rotation matrix straight to a unit quaternion without building an FMatrix */
+	static FQuat RotationMatrixToQuat(const EW_BET_Matrix3x3& Matrix);
+
 private:
+#if PLATFORM_WINDOWS
+	friend class FBeamTrackingListener;
+
+	/** Listener receiving tracking updates on the SDK callback thread */
+	FBeamTrackingListener* TrackingListener = nullptr;
+#endif
+
+	/** Unregisters and destroys the SDK listener */
+	void StopListening();
+
+	/** Ring receiving frames converted on the SDK callback thread */
+	FBeamFrameRing* FrameSink;
+
+	/** Event triggered on the SDK callback thread for every new state set */
+	FEvent* FrameEvent;
+
+	/** True while the SDK listener is registered, for a sink, an event or both */
+	bool IsListening() const;
+
+	/** Offset between the SDK capture clock and FPlatformTime */
+	FBeamClockSync ClockSync;
+
+	/** Monotonic id assigned to frames the listener publishes into FrameSink */
+	std::atomic<int64> NextFrameId;
+
+	/** Every state set the listener has been told about, whether or not anything consumed it */
+	std::atomic<int64> StateSetCount;
+
+	/** Arrival time of the last state set on the listener or the producer wait; liveness for the watchdog */
+	std::atomic<double> LastStateSetSeconds;
+
+	/** Reception status last reported by the listener or queried by RefreshReceptionStatus */
+	std::atomic<bool> bReceivingTrackingData;
+
+	/** Asks the SDK for its reception status and caches it */
+	void QueryReceptionStatus();
+
+	/**
+	 * Producer-thread ids for WaitForNewFrame. While the listener runs, ids advance with StateSetCount
+	 * so state sets the wait coalesced leave a gap; WaitFrameIdBase maps the count onto the id sequence.
+	 */
+	int64 LastWaitFrameId;
+	int64 WaitFrameIdBase;
+
+	/** Timestamp of the last state set returned by WaitForNewFrame */
+	eyeware::beam_eye_tracker::Timestamp LastUpdateTimestamp;
+
 	/** SDK API instance */
 	eyeware::beam_eye_tracker::API* APIInstance;
 
@@ -85,9 +172,13 @@ private:
 	/** Initialization state */
 	bool bInitialized;
 
-	/** Current viewport dimensions */
-	int32 ViewportWidth;
-	int32 ViewportHeight;
+	/** Stores the rectangle in ViewportGeometry; the point_11 corner is inclusive */
+	void SetViewportRect(const FIntPoint& OriginPx, const FIntPoint& SizePx);
+
+	/** Current viewport rectangle; the size is read on the SDK callback thread to derive ScreenPx */
+	FIntPoint ViewportOrigin;
+	std::atomic<int32> ViewportWidth;
+	std::atomic<int32> ViewportHeight;
 
 	/** Current viewport geometry for the SDK */
 	eyeware::beam_eye_tracker::EW_BET_ViewportGeometry ViewportGeometry;
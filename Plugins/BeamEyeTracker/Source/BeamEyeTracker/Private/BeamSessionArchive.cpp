@@ -0,0 +1,267 @@
+// Implements packing recordings into a columnar session archive and querying it in parallel
+
+#include "BeamSessionArchive.h"
+#include "BeamAnalyticsWorker.h"
+#include "BeamOfflineAnalytics.h"
+#include "BeamLogging.h"
+#include "BeamStats.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_CYCLE_STAT(TEXT("Beam Archive Pack"), STAT_BeamArchivePack, STATGROUP_Beam);
+DECLARE_CYCLE_STAT(TEXT("Beam Archive Analyze Session"), STAT_BeamArchiveAnalyzeSession, STATGROUP_Beam);
+
+namespace
+{
+	TArray<FBeamColumnDesc> MakeArchiveSchema()
+	{
+		// Order matches BeamArchiveColumn; timestamps stay double, everything else fits float
+		return {
+			{ TEXT("TimestampMs"), EBeamColumnType::Float64 },
+			{ TEXT("GazeX"), EBeamColumnType::Float32 },
+			{ TEXT("GazeY"), EBeamColumnType::Float32 },
+			{ TEXT("GazeConfidence"), EBeamColumnType::Float32 },
+			{ TEXT("HeadX"), EBeamColumnType::Float32 },
+			{ TEXT("HeadY"), EBeamColumnType::Float32 },
+			{ TEXT("HeadZ"), EBeamColumnType::Float32 },
+			{ TEXT("HeadPitch"), EBeamColumnType::Float32 },
+			{ TEXT("HeadYaw"), EBeamColumnType::Float32 },
+			{ TEXT("HeadRoll"), EBeamColumnType::Float32 },
+			{ TEXT("HeadConfidence"), EBeamColumnType::Float32 }
+		};
+	}
+}
+
+//-----------------------------------------------------------------------------
+// FBeamSessionArchiveWriter
+//-----------------------------------------------------------------------------
+
+bool FBeamSessionArchiveWriter::Pack(const TArray<FBeamArchiveSource>& Sources, const FString& OutPath, EBeamRecordingCompression Compression, int32 RowsPerGroup)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BeamArchivePack);
+
+	TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*OutPath));
+	if (!Archive)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Cannot create session archive %s"), *OutPath);
+		return false;
+	}
+
+	FBeamColumnarWriter Writer(*Archive, MakeArchiveSchema(), RowsPerGroup);
+	Writer.SetCompression(Compression);
+
+	TArray<FBeamArchiveSession> Sessions;
+	for (const FBeamArchiveSource& Source : Sources)
+	{
+		FBeamRecording Reader;
+		if (!Reader.StartPlayback(Source.RecordingPath, true))
+		{
+			UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Skipping unreadable recording %s"), *Source.RecordingPath);
+			continue;
+		}
+
+		FBeamArchiveSession Session;
+		Session.Name = FPaths::GetBaseFilename(Source.RecordingPath);
+		Session.Tag = Source.Tag;
+		Session.FirstRowGroup = Writer.GetNumRowGroups();
+
+		FBeamFrame Frame;
+		while (Reader.GetNextFrame(Frame))
+		{
+			if (Session.NumRows == 0)
+			{
+				Session.StartMs = Frame.SDKTimestampMs;
+			}
+			Session.EndMs = Frame.SDKTimestampMs;
+			++Session.NumRows;
+
+			Writer.Add(BeamArchiveColumn::TimestampMs, Frame.SDKTimestampMs);
+			Writer.Add(BeamArchiveColumn::GazeX, Frame.Gaze.Screen01.X);
+			Writer.Add(BeamArchiveColumn::GazeY, Frame.Gaze.Screen01.Y);
+			Writer.Add(BeamArchiveColumn::GazeConfidence, Frame.Gaze.Confidence);
+			Writer.Add(BeamArchiveColumn::HeadX, Frame.Head.PositionCm.X);
+			Writer.Add(BeamArchiveColumn::HeadY, Frame.Head.PositionCm.Y);
+			Writer.Add(BeamArchiveColumn::HeadZ, Frame.Head.PositionCm.Z);
+			Writer.Add(BeamArchiveColumn::HeadPitch, Frame.Head.Rotation.Pitch);
+			Writer.Add(BeamArchiveColumn::HeadYaw, Frame.Head.Rotation.Yaw);
+			Writer.Add(BeamArchiveColumn::HeadRoll, Frame.Head.Rotation.Roll);
+			Writer.Add(BeamArchiveColumn::HeadConfidence, Frame.Head.Confidence);
+			Writer.EndRow();
+		}
+		Reader.StopPlayback();
+
+		// Sessions never share a row group, so the index maps a session to whole chunks
+		Writer.EndRowGroup();
+		Session.NumRowGroups = Writer.GetNumRowGroups() - Session.FirstRowGroup;
+		if (Session.NumRows > 0)
+		{
+			Sessions.Add(MoveTemp(Session));
+		}
+	}
+
+	TArray<uint8> Index;
+	FMemoryWriter IndexWriter(Index);
+	uint32 Magic = IndexMagic;
+	uint32 Version = IndexVersion;
+	int32 NumSessions = Sessions.Num();
+	IndexWriter << Magic << Version << NumSessions;
+	for (FBeamArchiveSession& Session : Sessions)
+	{
+		IndexWriter << Session;
+	}
+	Writer.SetFooterExtension(MoveTemp(Index));
+
+	const bool bWritten = Writer.Finish() && Archive->Close();
+	if (!bWritten)
+	{
+		UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Failed writing session archive %s"), *OutPath);
+		return false;
+	}
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Packed %d of %d recordings (%lld frames) into %s"), Sessions.Num(), Sources.Num(), Writer.GetNumRows(), *OutPath);
+	return Sessions.Num() > 0;
+}
+
+//-----------------------------------------------------------------------------
+// FBeamSessionArchiveReader
+//-----------------------------------------------------------------------------
+
+bool FBeamSessionArchiveReader::Open(const FString& FilePath)
+{
+	Sessions.Reset();
+	if (!Columns.Open(FilePath) || Columns.GetColumns().Num() != BeamArchiveColumn::Num)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: %s is not a session archive"), *FilePath);
+		return false;
+	}
+
+	FMemoryReader IndexReader(Columns.GetFooterExtension());
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumSessions = 0;
+	IndexReader << Magic << Version << NumSessions;
+	if (IndexReader.IsError() || Magic != FBeamSessionArchiveWriter::IndexMagic || Version > FBeamSessionArchiveWriter::IndexVersion || NumSessions < 0)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: %s has no session index"), *FilePath);
+		return false;
+	}
+
+	Sessions.SetNum(NumSessions);
+	for (FBeamArchiveSession& Session : Sessions)
+	{
+		IndexReader << Session;
+		if (Session.FirstRowGroup < 0 || Session.FirstRowGroup + Session.NumRowGroups > Columns.GetRowGroups().Num())
+		{
+			IndexReader.SetError();
+		}
+	}
+	return !IndexReader.IsError();
+}
+
+void FBeamSessionArchiveReader::FindSessions(const FString& Tag, double StartMs, double EndMs, TArray<int32>& OutSessions) const
+{
+	OutSessions.Reset();
+	for (int32 SessionIndex = 0; SessionIndex < Sessions.Num(); ++SessionIndex)
+	{
+		const FBeamArchiveSession& Session = Sessions[SessionIndex];
+		if ((Tag.IsEmpty() || Session.Tag.Equals(Tag, ESearchCase::IgnoreCase)) && Session.EndMs >= StartMs && Session.StartMs <= EndMs)
+		{
+			OutSessions.Add(SessionIndex);
+		}
+	}
+}
+
+bool FBeamSessionArchiveReader::GetColumnRange(int32 SessionIndex, int32 Column, double& OutMin, double& OutMax) const
+{
+	if (!Sessions.IsValidIndex(SessionIndex) || !Columns.GetColumns().IsValidIndex(Column) || Sessions[SessionIndex].NumRowGroups == 0)
+	{
+		return false;
+	}
+
+	const FBeamArchiveSession& Session = Sessions[SessionIndex];
+	const TArray<FBeamColumnRowGroup>& Groups = Columns.GetRowGroups();
+	OutMin = Groups[Session.FirstRowGroup].Chunks[Column].Min;
+	OutMax = Groups[Session.FirstRowGroup].Chunks[Column].Max;
+	for (int32 Group = Session.FirstRowGroup + 1; Group < Session.FirstRowGroup + Session.NumRowGroups; ++Group)
+	{
+		OutMin = FMath::Min(OutMin, Groups[Group].Chunks[Column].Min);
+		OutMax = FMath::Max(OutMax, Groups[Group].Chunks[Column].Max);
+	}
+	return true;
+}
+
+bool FBeamSessionArchiveReader::ReadSessionColumns(FArchive& Archive, int32 SessionIndex, TConstArrayView<int32> ColumnIndices, double StartMs, double EndMs, TArray<TArray<double>>& OutColumns) const
+{
+	if (!Sessions.IsValidIndex(SessionIndex))
+	{
+		return false;
+	}
+
+	OutColumns.SetNum(ColumnIndices.Num());
+	for (TArray<double>& Values : OutColumns)
+	{
+		Values.Reset();
+	}
+
+	const FBeamArchiveSession& Session = Sessions[SessionIndex];
+	const TArray<FBeamColumnRowGroup>& Groups = Columns.GetRowGroups();
+	TArray<uint8> Scratch;
+	for (int32 Group = Session.FirstRowGroup; Group < Session.FirstRowGroup + Session.NumRowGroups; ++Group)
+	{
+		// Time index: the timestamp chunk statistics decide whether any chunk of this group is read at all
+		const FBeamColumnChunk& Timestamps = Groups[Group].Chunks[BeamArchiveColumn::TimestampMs];
+		if (Timestamps.Max < StartMs || Timestamps.Min > EndMs)
+		{
+			continue;
+		}
+
+		for (int32 Slot = 0; Slot < ColumnIndices.Num(); ++Slot)
+		{
+			if (!Columns.ReadChunkAsDouble(Archive, Group, ColumnIndices[Slot], OutColumns[Slot], Scratch))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void FBeamSessionArchiveReader::AnalyzeSessions(TConstArrayView<int32> SessionIndices, const FBeamAnalyticsWorkerConfig& Config, double StartMs, double EndMs, TArray<FBeamSessionResult>& OutResults) const
+{
+	OutResults.Reset();
+	OutResults.SetNum(SessionIndices.Num());
+
+	// One session per task; each reads only the four gaze columns through its own handle
+	ParallelFor(SessionIndices.Num(), [this, SessionIndices, &Config, StartMs, EndMs, &OutResults](int32 Slot)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_BeamArchiveAnalyzeSession);
+
+		const FBeamArchiveSession& Session = Sessions[SessionIndices[Slot]];
+		FBeamSessionResult& Result = OutResults[Slot];
+		Result.Name = Session.Name;
+		Result.Tag = Session.Tag;
+
+		TUniquePtr<FArchive> Archive = Columns.OpenArchive();
+		static const int32 GazeColumns[] = { BeamArchiveColumn::TimestampMs, BeamArchiveColumn::GazeX, BeamArchiveColumn::GazeY, BeamArchiveColumn::GazeConfidence };
+		TArray<TArray<double>> Values;
+		if (!Archive || !ReadSessionColumns(*Archive, SessionIndices[Slot], MakeArrayView(GazeColumns), StartMs, EndMs, Values))
+		{
+			UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Could not read session %s of %s"), *Session.Name, *Columns.GetFilePath());
+			return;
+		}
+
+		FBeamSessionAnalysis Analysis(Config);
+		const TArray<double>& Timestamps = Values[0];
+		for (int32 Row = 0; Row < Timestamps.Num(); ++Row)
+		{
+			if (Timestamps[Row] >= StartMs && Timestamps[Row] <= EndMs)
+			{
+				Analysis.AddFrame(Timestamps[Row], FVector2D(Values[1][Row], Values[2][Row]), Values[3][Row]);
+			}
+		}
+		Analysis.GetResult(Result);
+	}, EParallelForFlags::Unbalanced);
+}
@@ -0,0 +1,124 @@
+/*=============================================================================
+    BeamSessionArchive.h: Columnar archive of many recorded sessions.
+
+    Packs any number of .beamrec recordings into one chunk-compressed
+    .beamcol file for bulk analytics. Every session occupies whole row
+    groups, and the footer carries a session index (tag, row groups, time
+    span), so a query resolves to a list of chunks up front: only the
+    columns it names and the row groups whose timestamp statistics overlap
+    its window are read and inflated. Sessions are independent, so queries
+    analyze them in parallel, each worker through its own file handle.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamExport.h"
+
+struct FBeamAnalyticsWorkerConfig;
+struct FBeamSessionResult;
+
+/** Column indices of a session archive, in schema order */
+namespace BeamArchiveColumn
+{
+	static constexpr int32 TimestampMs = 0;
+	static constexpr int32 GazeX = 1;
+	static constexpr int32 GazeY = 2;
+	static constexpr int32 GazeConfidence = 3;
+	static constexpr int32 HeadX = 4;
+	static constexpr int32 HeadY = 5;
+	static constexpr int32 HeadZ = 6;
+	static constexpr int32 HeadPitch = 7;
+	static constexpr int32 HeadYaw = 8;
+	static constexpr int32 HeadRoll = 9;
+	static constexpr int32 HeadConfidence = 10;
+	static constexpr int32 Num = 11;
+}
+
+/** One recording to pack */
+struct FBeamArchiveSource
+{
+	FString RecordingPath;
+
+	/** Grouping key for queries, e.g. the level the session was played on */
+	FString Tag;
+};
+
+/** Session index entry stored in the archive footer */
+struct FBeamArchiveSession
+{
+	/** Recording file name without extension */
+	FString Name;
+	FString Tag;
+	int64 NumRows = 0;
+	int32 FirstRowGroup = 0;
+	int32 NumRowGroups = 0;
+
+	/** Tracker timestamps of the first and last frame */
+	double StartMs = 0.0;
+	double EndMs = 0.0;
+
+	friend FArchive& operator<<(FArchive& Ar, FBeamArchiveSession& Session)
+	{
+		Ar << Session.Name << Session.Tag << Session.NumRows << Session.FirstRowGroup << Session.NumRowGroups << Session.StartMs << Session.EndMs;
+		return Ar;
+	}
+};
+
+/** Packs recordings into a session archive */
+class FBeamSessionArchiveWriter
+{
+public:
+	/** Footer extension magic identifying the session index */
+	static constexpr uint32 IndexMagic = 0x58495342; // "BSIX"
+	static constexpr uint32 IndexVersion = 1;
+
+	/** Rows per row group; small enough that time-window queries skip most of a long session */
+	static constexpr int32 DefaultRowsPerGroup = 16 * 1024;
+
+	/**
+	 * Streams every source into OutPath, one session at a time through a memory-mapped reader.
+	 * Unreadable recordings are skipped with a warning. False if nothing could be written.
+	 */
+	static bool Pack(const TArray<FBeamArchiveSource>& Sources, const FString& OutPath, EBeamRecordingCompression Compression, int32 RowsPerGroup = DefaultRowsPerGroup);
+};
+
+/** Reads a session archive; const methods are safe to call from several threads */
+class FBeamSessionArchiveReader
+{
+public:
+	bool Open(const FString& FilePath);
+
+	const TArray<FBeamArchiveSession>& GetSessions() const { return Sessions; }
+	const FBeamColumnarReader& GetColumnarReader() const { return Columns; }
+
+	/** Sessions with the given tag (any tag when empty) that overlap [StartMs, EndMs] */
+	void FindSessions(const FString& Tag, double StartMs, double EndMs, TArray<int32>& OutSessions) const;
+
+	/** Value range of one column over a session, from the row-group statistics alone */
+	bool GetColumnRange(int32 SessionIndex, int32 Column, double& OutMin, double& OutMax) const;
+
+	/**
+	 * Reads the requested columns of one session, limited to row groups whose timestamps overlap [StartMs, EndMs].
+	 * OutColumns[i] holds ColumnIndices[i]; rows of a partially overlapping group are all returned, callers filter by timestamp.
+	 */
+	bool ReadSessionColumns(FArchive& Archive, int32 SessionIndex, TConstArrayView<int32> ColumnIndices, double StartMs, double EndMs, TArray<TArray<double>>& OutColumns) const;
+
+	/**
+	 * Runs FBeamSessionAnalysis over each session's gaze in [StartMs, EndMs], sessions in parallel.
+	 * OutResults[i] belongs to SessionIndices[i]; combine them with BeamOfflineAnalytics::AggregateByTag.
+	 */
+	void AnalyzeSessions(TConstArrayView<int32> SessionIndices, const FBeamAnalyticsWorkerConfig& Config, double StartMs, double EndMs, TArray<FBeamSessionResult>& OutResults) const;
+
+private:
+	FBeamColumnarReader Columns;
+	TArray<FBeamArchiveSession> Sessions;
+};
+
+/*=============================================================================
+    End of BeamSessionArchive.h
+=============================================================================*/
@@ -0,0 +1,109 @@
+// Implements the per-session linear allocator
+
+#include "BeamSessionArena.h"
+#include "BeamResources.h"
+#include "BeamStats.h"
+
+FBeamSessionArena::FBeamSessionArena(int32 InBlockBytes)
+	: BlockBytes(FMath::Max(InBlockBytes, 1024))
+{
+}
+
+FBeamSessionArena::~FBeamSessionArena()
+{
+	if (First)
+	{
+		FreeBlocksAfter(First);
+		GBeamResources.TrackBufferBytes(-static_cast<int64>(First->Bytes));
+		FMemory::Free(First);
+	}
+}
+
+void* FBeamSessionArena::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	uint8* Aligned = Align(Cursor, Alignment);
+	if (!Cursor || Aligned + Size > Limit)
+	{
+		AdvanceBlock(Size, Alignment);
+		Aligned = Align(Cursor, Alignment);
+	}
+
+	UsedBytes += (Aligned + Size) - Cursor;
+	Cursor = Aligned + Size;
+	return Aligned;
+}
+
+void FBeamSessionArena::Reset()
+{
+	Current = First;
+	Cursor = First ? First->Begin() : nullptr;
+	Limit = First ? First->End() : nullptr;
+	UsedBytes = 0;
+}
+
+void FBeamSessionArena::Trim()
+{
+	if (First)
+	{
+		FreeBlocksAfter(First);
+		First->Next = nullptr;
+	}
+	Reset();
+}
+
+void FBeamSessionArena::AdvanceBlock(SIZE_T Size, SIZE_T Alignment)
+{
+	const SIZE_T Needed = Size + Alignment;
+	if (!First)
+	{
+		First = AllocateBlock(FMath::Max<SIZE_T>(BlockBytes, Needed));
+		Current = First;
+	}
+	else
+	{
+		// Padding left at the end of the abandoned block still counts as used until the next reset
+		UsedBytes += Limit - Cursor;
+
+		// Blocks kept from earlier sessions are reused in order; one too small for this request is skipped
+		FBlock* Next = Current->Next;
+		while (Next && Next->Bytes < Needed)
+		{
+			Next = Next->Next;
+		}
+
+		if (!Next)
+		{
+			Next = AllocateBlock(FMath::Max<SIZE_T>(BlockBytes, Needed));
+			Next->Next = Current->Next;
+			Current->Next = Next;
+		}
+		Current = Next;
+	}
+
+	Cursor = Current->Begin();
+	Limit = Current->End();
+}
+
+FBeamSessionArena::FBlock* FBeamSessionArena::AllocateBlock(SIZE_T Bytes)
+{
+	LLM_SCOPE_BYTAG(BeamEyeTracker);
+	FBlock* Block = static_cast<FBlock*>(FMemory::Malloc(sizeof(FBlock) + Bytes, alignof(FBlock)));
+	Block->Next = nullptr;
+	Block->Bytes = Bytes;
+	ReservedBytes += Bytes;
+	GBeamResources.TrackBufferBytes(static_cast<int64>(Bytes));
+	return Block;
+}
+
+void FBeamSessionArena::FreeBlocksAfter(FBlock* Block)
+{
+	FBlock* Next = Block->Next;
+	while (Next)
+	{
+		FBlock* Following = Next->Next;
+		ReservedBytes -= Next->Bytes;
+		GBeamResources.TrackBufferBytes(-static_cast<int64>(Next->Bytes));
+		FMemory::Free(Next);
+		Next = Following;
+	}
+}
@@ -0,0 +1,68 @@
+// Implements the sim game camera modifier that interpolates cached SDK camera transforms to render time
+
+#include "BeamSimCameraModifier.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamRing.h"
+#include "BeamStats.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/GameInstance.h"
+#include "HAL/PlatformTime.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BeamSimCameraModifier)
+
+DECLARE_CYCLE_STAT(TEXT("Beam Sim Camera Modifier"), STAT_BeamSimCameraModifier, STATGROUP_Beam);
+
+UBeamSimCameraModifier::UBeamSimCameraModifier()
+{
+	// After gameplay camera shakes and offsets, so head-look rides on the final view
+	Priority = 200;
+}
+
+UBeamEyeTrackerSubsystem* UBeamSimCameraModifier::ResolveSubsystem()
+{
+	if (UBeamEyeTrackerSubsystem* Subsystem = CachedSubsystem.Get())
+	{
+		return Subsystem;
+	}
+
+	const APlayerCameraManager* CameraManager = CameraOwner.Get();
+	UGameInstance* GameInstance = CameraManager ? CameraManager->GetGameInstance() : nullptr;
+	UBeamEyeTrackerSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	CachedSubsystem = Subsystem;
+	return Subsystem;
+}
+
+bool UBeamSimCameraModifier::ModifyCamera(float DeltaTime, FVector ViewLocation, FRotator ViewRotation, float FOV, FVector& NewViewLocation, FRotator& NewViewRotation, float& NewFOV)
+{
+	Super::ModifyCamera(DeltaTime, ViewLocation, ViewRotation, FOV, NewViewLocation, NewViewRotation, NewFOV);
+	SCOPE_CYCLE_COUNTER(STAT_BeamSimCameraModifier);
+
+	UBeamEyeTrackerSubsystem* Subsystem = ResolveSubsystem();
+	const FBeamFrameRing* Ring = Subsystem ? Subsystem->GetFrameRing() : nullptr;
+	FBeamFrame Latest;
+	if (!Ring || !Ring->ReadLatest(Latest) || !Latest.SimCamera.bValid)
+	{
+		return false;
+	}
+
+	// Map now onto the tracker clock, then step back far enough that the sample is interpolated, never extrapolated
+	const double TrackerOffsetSeconds = Latest.UETimestampSeconds - Latest.SDKTimestampMs * 0.001;
+	const double DelayMs = InterpolationDelayMs > 0.0f ? InterpolationDelayMs : FMath::Max(Latest.DeltaTimeSeconds * 1000.0, 1.0);
+	const double SampleMs = FMath::Min((FPlatformTime::Seconds() - TrackerOffsetSeconds) * 1000.0 - DelayMs, Latest.SDKTimestampMs);
+
+	FBeamFrame Sample;
+	const FBeamSimCameraTransform& Transform = Ring->GetInterpolatedFrameAt(SampleMs, Sample) && Sample.SimCamera.bValid
+		? Sample.SimCamera
+		: Latest.SimCamera;
+
+	// Translation follows the game camera's axes, not the head-look rotation added on top
+	const float Weight = Sensitivity * Alpha;
+	const FQuat BaseRotation = NewViewRotation.Quaternion();
+	if (bApplyTranslation)
+	{
+		NewViewLocation += BaseRotation.RotateVector(Transform.TranslationCm * Weight);
+	}
+	const FQuat HeadLook = FQuat::Slerp(FQuat::Identity, Transform.Rotation.Quaternion(), Weight);
+	NewViewRotation = (BaseRotation * HeadLook).Rotator();
+	return false;
+}
@@ -0,0 +1,39 @@
+/*=============================================================================
+    BeamStats.h: "stat Beam" stat group.
+
+    Declares the Beam stat group shared by every plugin translation unit
+    that reports to "stat Beam", and the memory stats for buffers owned by
+    the plugin, plus the LLM tag plugin allocations are made under. Cycle
+    stats are declared next to the code they time.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
+
+DECLARE_STATS_GROUP(TEXT("Beam"), STATGROUP_Beam, STATCAT_Advanced);
+
+/** Slot storage, gaze columns and capture blocks of every live frame ring */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Frame Rings"), STAT_BeamRingMemory, STATGROUP_Beam, );
+
+/** Chunk pools, in-memory tails and playback buffers of every FBeamRecording */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Recording Buffers"), STAT_BeamRecordingMemory, STATGROUP_Beam, );
+
+/** Frame and latency rings of the flight recorder */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Flight Recorder"), STAT_BeamFlightRecorderMemory, STATGROUP_Beam, );
+
+/** Budget of the active memory profile, shown next to the buffers it sizes; zero for the Custom profile */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Memory Budget"), STAT_BeamMemoryBudget, STATGROUP_Beam, );
+
+/** Long-lived plugin allocations are made under this tag; FBeamResourceSampler reads it back */
+LLM_DECLARE_TAG(BeamEyeTracker);
+
+/*=============================================================================
+    End of BeamStats.h
+=============================================================================*/
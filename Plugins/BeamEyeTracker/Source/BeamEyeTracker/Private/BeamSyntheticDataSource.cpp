@@ -0,0 +1,317 @@
+// Implements the seeded fixation/saccade/blink gaze generator used as a synthetic data source
+
+#include "BeamSyntheticDataSource.h"
+
+#if BEAM_FEATURE_SYNTHETIC_DATA
+
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+// Pull callers further behind than this many frames resynchronize instead of generating the backlog
+#define BEAM_SYNTHETIC_MAX_CATCH_UP_FRAMES 1000
+
+// Saccade main sequence: duration grows linearly with amplitude
+#define BEAM_SYNTHETIC_SACCADE_BASE_MS 21.0
+#define BEAM_SYNTHETIC_SACCADE_MS_PER_DEGREE 2.2
+
+FBeamSyntheticDataSource::FBeamSyntheticDataSource(const FBeamSyntheticParams& InParams)
+	: Params(InParams)
+	, FrameIntervalSeconds(1.0 / FMath::Clamp(static_cast<double>(InParams.RateHz), 1.0, 1000.0))
+{
+	Reset();
+}
+
+bool FBeamSyntheticDataSource::Initialize()
+{
+	FScopeLock Lock(&GeneratorLock);
+	if (bRunning)
+	{
+		return true;
+	}
+
+	Reset();
+	StartWallSeconds = FPlatformTime::Seconds();
+	bRunning = true;
+	return true;
+}
+
+void FBeamSyntheticDataSource::Shutdown()
+{
+	FScopeLock Lock(&GeneratorLock);
+	bRunning = false;
+}
+
+bool FBeamSyntheticDataSource::IsValid() const
+{
+	FScopeLock Lock(&GeneratorLock);
+	return bRunning;
+}
+
+EBeamHealth FBeamSyntheticDataSource::GetHealth() const
+{
+	return IsValid() ? EBeamHealth::Ok : EBeamHealth::NoData;
+}
+
+bool FBeamSyntheticDataSource::InitSDK(const FString& AppName, int32 InViewportWidth, int32 InViewportHeight)
+{
+	UpdateViewportGeometry(InViewportWidth, InViewportHeight);
+	return Initialize();
+}
+
+void FBeamSyntheticDataSource::UpdateViewportGeometry(int32 InViewportWidth, int32 InViewportHeight)
+{
+	FScopeLock Lock(&GeneratorLock);
+	if (InViewportWidth > 0 && InViewportHeight > 0)
+	{
+		ViewportWidth = InViewportWidth;
+		ViewportHeight = InViewportHeight;
+	}
+}
+
+bool FBeamSyntheticDataSource::FetchCurrentFrame(FBeamFrame& OutFrame)
+{
+	FScopeLock Lock(&GeneratorLock);
+	if (!bRunning)
+	{
+		return false;
+	}
+
+	if (!Params.bRealtime)
+	{
+		GenerateFrameLocked(LastFrame);
+		bHasFrame = true;
+		OutFrame = LastFrame;
+		return true;
+	}
+
+	// Generate everything that has come due since the last pull, so content matches the producer-thread path
+	const double NowSeconds = FPlatformTime::Seconds();
+	const int64 DueIndex = static_cast<int64>((NowSeconds - StartWallSeconds) / FrameIntervalSeconds);
+	if (DueIndex - FrameIndex > BEAM_SYNTHETIC_MAX_CATCH_UP_FRAMES)
+	{
+		StartWallSeconds = NowSeconds - GetFrameSeconds(FrameIndex);
+	}
+	while (StartWallSeconds + GetFrameSeconds(FrameIndex) <= NowSeconds)
+	{
+		GenerateFrameLocked(LastFrame);
+		bHasFrame = true;
+	}
+
+	if (!bHasFrame)
+	{
+		return false;
+	}
+
+	OutFrame = LastFrame;
+	return true;
+}
+
+bool FBeamSyntheticDataSource::WaitForNextFrame(FBeamFrame& OutFrame, uint32 TimeoutMs)
+{
+	double DueSeconds = 0.0;
+	{
+		FScopeLock Lock(&GeneratorLock);
+		if (!bRunning)
+		{
+			DueSeconds = -1.0;
+		}
+		else if (!Params.bRealtime)
+		{
+			GenerateFrameLocked(LastFrame);
+			bHasFrame = true;
+			OutFrame = LastFrame;
+			return true;
+		}
+		else
+		{
+			DueSeconds = StartWallSeconds + GetFrameSeconds(FrameIndex);
+		}
+	}
+
+	if (DueSeconds < 0.0)
+	{
+		FPlatformProcess::Sleep(TimeoutMs * 0.001f);
+		return false;
+	}
+
+	const double WaitSeconds = DueSeconds - FPlatformTime::Seconds();
+	if (WaitSeconds > TimeoutMs * 0.001)
+	{
+		FPlatformProcess::Sleep(TimeoutMs * 0.001f);
+		return false;
+	}
+	if (WaitSeconds > 0.0)
+	{
+		FPlatformProcess::Sleep(static_cast<float>(WaitSeconds));
+	}
+
+	FScopeLock Lock(&GeneratorLock);
+	if (!bRunning)
+	{
+		return false;
+	}
+
+	GenerateFrameLocked(LastFrame);
+	bHasFrame = true;
+	OutFrame = LastFrame;
+	return true;
+}
+
+void FBeamSyntheticDataSource::GenerateFrame(FBeamFrame& OutFrame)
+{
+	FScopeLock Lock(&GeneratorLock);
+	GenerateFrameLocked(OutFrame);
+}
+
+void FBeamSyntheticDataSource::Reset()
+{
+	FScopeLock Lock(&GeneratorLock);
+
+	Random.Initialize(Params.Seed);
+	FrameIndex = 0;
+	bHasFrame = false;
+
+	FixationCenter = FVector2D(Random.FRandRange(0.2f, 0.8f), Random.FRandRange(0.2f, 0.8f));
+	BeginFixation(0.0);
+	BlinkEndSeconds = -1.0;
+	ScheduleNextBlink(0.0);
+
+	HeadWalkCm = FVector::ZeroVector;
+	for (float& Phase : HeadPhase)
+	{
+		Phase = Random.FRandRange(0.0f, 2.0f * PI);
+	}
+}
+
+double FBeamSyntheticDataSource::Gaussian()
+{
+	// Box-Muller; the first uniform is kept away from zero so the log stays finite
+	const double U1 = FMath::Max(static_cast<double>(Random.GetFraction()), 1e-12);
+	const double U2 = Random.GetFraction();
+	return FMath::Sqrt(-2.0 * FMath::Loge(U1)) * FMath::Cos(2.0 * PI * U2);
+}
+
+void FBeamSyntheticDataSource::BeginFixation(double NowSeconds)
+{
+	// Mean-preserving log-normal duration
+	const double Spread = Params.FixationSpread;
+	const double Duration = Params.MeanFixationSeconds * FMath::Exp(Spread * Gaussian() - 0.5 * Spread * Spread);
+
+	Phase = EPhase::Fixation;
+	PhaseEndSeconds = NowSeconds + FMath::Clamp(Duration, 0.06, 2.0);
+	DriftOffset = FVector2D::ZeroVector;
+}
+
+void FBeamSyntheticDataSource::BeginSaccade(double NowSeconds)
+{
+	SaccadeStart = FixationCenter + DriftOffset;
+
+	// Mostly short hops near the current fixation, occasionally a jump anywhere on screen
+	if (Random.GetFraction() < 0.7f)
+	{
+		SaccadeEnd = SaccadeStart + FVector2D(Gaussian(), Gaussian()) * 0.15;
+	}
+	else
+	{
+		SaccadeEnd = FVector2D(Random.GetFraction(), Random.GetFraction());
+	}
+	SaccadeEnd = FVector2D(FMath::Clamp(SaccadeEnd.X, 0.05, 0.95), FMath::Clamp(SaccadeEnd.Y, 0.05, 0.95));
+
+	// Vertical distance is measured in screen widths so amplitude maps onto visual angle
+	const double Aspect = static_cast<double>(ViewportHeight) / FMath::Max(ViewportWidth, 1);
+	const FVector2D Delta = SaccadeEnd - SaccadeStart;
+	const double AmplitudeDegrees = FMath::Sqrt(Delta.X * Delta.X + FMath::Square(Delta.Y * Aspect)) * Params.ScreenWidthDegrees;
+	const double DurationSeconds = (BEAM_SYNTHETIC_SACCADE_BASE_MS + BEAM_SYNTHETIC_SACCADE_MS_PER_DEGREE * AmplitudeDegrees) * 0.001;
+
+	Phase = EPhase::Saccade;
+	SaccadeStartSeconds = NowSeconds;
+	PhaseEndSeconds = NowSeconds + DurationSeconds;
+}
+
+void FBeamSyntheticDataSource::ScheduleNextBlink(double NowSeconds)
+{
+	if (Params.BlinkRateHz <= 0.0f)
+	{
+		NextBlinkSeconds = TNumericLimits<double>::Max();
+		return;
+	}
+
+	// Poisson process
+	const double U = FMath::Max(static_cast<double>(Random.GetFraction()), 1e-12);
+	NextBlinkSeconds = NowSeconds - FMath::Loge(U) / Params.BlinkRateHz;
+}
+
+void FBeamSyntheticDataSource::GenerateFrameLocked(FBeamFrame& OutFrame)
+{
+	const double T = GetFrameSeconds(FrameIndex);
+	const double Dt = FrameIntervalSeconds;
+
+	if (Phase == EPhase::Fixation && T >= PhaseEndSeconds)
+	{
+		BeginSaccade(T);
+	}
+	else if (Phase == EPhase::Saccade && T >= PhaseEndSeconds)
+	{
+		FixationCenter = SaccadeEnd;
+		BeginFixation(T);
+	}
+
+	FVector2D Gaze;
+	if (Phase == EPhase::Fixation)
+	{
+		// Slow mean-reverting drift around the fixation center
+		DriftOffset = DriftOffset * 0.995 + FVector2D(Gaussian(), Gaussian()) * (Params.DriftSpeed * FMath::Sqrt(Dt));
+		Gaze = FixationCenter + DriftOffset;
+	}
+	else
+	{
+		// Minimum-jerk profile approximates the bell-shaped saccade velocity curve
+		const double Tau = FMath::Clamp((T - SaccadeStartSeconds) / FMath::Max(PhaseEndSeconds - SaccadeStartSeconds, Dt), 0.0, 1.0);
+		const double S = Tau * Tau * Tau * (10.0 + Tau * (-15.0 + 6.0 * Tau));
+		Gaze = SaccadeStart + (SaccadeEnd - SaccadeStart) * S;
+	}
+	Gaze += FVector2D(Gaussian(), Gaussian()) * Params.GazeNoise;
+	Gaze = FVector2D(FMath::Clamp(Gaze.X, 0.0, 1.0), FMath::Clamp(Gaze.Y, 0.0, 1.0));
+
+	if (T >= NextBlinkSeconds && T >= BlinkEndSeconds)
+	{
+		BlinkEndSeconds = T + Params.BlinkSeconds;
+		ScheduleNextBlink(BlinkEndSeconds);
+	}
+	const bool bBlinking = T < BlinkEndSeconds;
+
+	// Head: incommensurate sways plus a decaying random walk
+	HeadWalkCm = HeadWalkCm * 0.999 + FVector(Gaussian(), Gaussian(), Gaussian()) * (0.5 * FMath::Sqrt(Dt));
+	const double TwoPiT = 2.0 * PI * T;
+	const double SwayCm = Params.HeadSwayCm;
+	const double SwayDeg = Params.HeadSwayDegrees;
+
+	FBeamFrame Frame;
+	Frame.FrameId = FrameIndex;
+	Frame.SDKTimestampMs = T * 1000.0;
+	Frame.UETimestampSeconds = Params.bRealtime ? StartWallSeconds + T : FPlatformTime::Seconds();
+	Frame.DeltaTimeSeconds = FrameIndex > 0 ? Dt : 0.0;
+
+	Frame.Gaze.bValid = !bBlinking;
+	Frame.Gaze.Screen01 = Gaze;
+	Frame.Gaze.ScreenPx = FVector2D(Gaze.X * ViewportWidth, Gaze.Y * ViewportHeight);
+	Frame.Gaze.Confidence = bBlinking ? 0.0 : FMath::Clamp(0.95 + 0.02 * Gaussian(), 0.0, 1.0);
+	Frame.Gaze.TimestampMs = Frame.SDKTimestampMs;
+
+	Frame.Head.PositionCm = FVector(
+		FMath::Sin(0.13 * TwoPiT + HeadPhase[0]) * SwayCm + HeadWalkCm.X,
+		FMath::Sin(0.07 * TwoPiT + HeadPhase[1]) * SwayCm * 0.6 + HeadWalkCm.Y,
+		60.0 + FMath::Sin(0.05 * TwoPiT + HeadPhase[2]) * SwayCm * 0.5 + HeadWalkCm.Z);
+	Frame.Head.SetRotation(FRotator(
+		FMath::Sin(0.11 * TwoPiT + HeadPhase[1]) * SwayDeg * 0.5,
+		FMath::Sin(0.09 * TwoPiT + HeadPhase[0]) * SwayDeg,
+		FMath::Sin(0.05 * TwoPiT + HeadPhase[2]) * SwayDeg * 0.3));
+	Frame.Head.Confidence = 0.98;
+	Frame.Head.TimestampMs = Frame.SDKTimestampMs;
+
+	OutFrame = Frame;
+	++FrameIndex;
+}
+
+#endif // BEAM_FEATURE_SYNTHETIC_DATA
@@ -0,0 +1,149 @@
+/*=============================================================================
+    BeamSyntheticDataSource.h: Synthetic data source for Beam Eye Tracker.
+
+    Generates plausible gaze and head motion without any tracker, SDK or
+    platform dependency, so the ring, filters and analytics can be driven
+    at up to 1 kHz on build agents and in automated tests.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamFeatures.h"
+#include "IBeamDataSource.h"
+#include "HAL/CriticalSection.h"
+#include "Math/RandomStream.h"
+
+#if BEAM_FEATURE_SYNTHETIC_DATA
+
+/** Generator parameters; equal parameters and seed produce identical frame sequences */
+struct FBeamSyntheticParams
+{
+	/** Output rate, clamped to [1, 1000] Hz */
+	float RateHz = 120.0f;
+
+	int32 Seed = 1;
+
+	/** When false frames are produced as fast as they are requested, for throughput tests */
+	bool bRealtime = true;
+
+	/** Mean fixation duration and its log-normal spread */
+	float MeanFixationSeconds = 0.25f;
+	float FixationSpread = 0.4f;
+
+	/** Screen width expressed as visual angle, used for the saccade main sequence */
+	float ScreenWidthDegrees = 35.0f;
+
+	/** Blinks per second and blink duration */
+	float BlinkRateHz = 0.25f;
+	float BlinkSeconds = 0.12f;
+
+	/** Per-sample measurement noise and fixational drift speed (Screen01 units, units per second) */
+	float GazeNoise = 0.003f;
+	float DriftSpeed = 0.01f;
+
+	/** Head sway amplitude (cm, degrees) around a seat 60 cm from the screen */
+	float HeadSwayCm = 1.5f;
+	float HeadSwayDegrees = 3.0f;
+};
+
+/**
+ * Deterministic gaze generator exposed as a data source.
+ *
+ * Gaze alternates fixations (log-normal durations, slow drift and sensor
+ * noise) with saccades that follow the main-sequence duration and a
+ * minimum-jerk position profile; blinks drop the gaze to invalid with zero
+ * confidence. Head pose sways on incommensurate sinusoids plus a small
+ * random walk. Frame content depends only on the parameters and the frame
+ * index; in realtime mode WaitForNextFrame additionally sleeps until each
+ * frame is due.
+ */
+class BEAMEYETRACKER_API FBeamSyntheticDataSource : public IBeamDataSource
+{
+public:
+	explicit FBeamSyntheticDataSource(const FBeamSyntheticParams& InParams = FBeamSyntheticParams());
+
+	// IBeamDataSource interface
+	virtual bool Initialize() override;
+	virtual void Shutdown() override;
+	virtual bool IsValid() const override;
+	virtual bool FetchCurrentFrame(FBeamFrame& OutFrame) override;
+	virtual EBeamHealth GetHealth() const override;
+	virtual bool StartCameraRecentering() override { return IsValid(); }
+	virtual void EndCameraRecentering() override {}
+	virtual bool InitSDK(const FString& AppName, int32 ViewportWidth, int32 ViewportHeight) override;
+	virtual bool IsSDKInitialized() const override { return IsValid(); }
+	virtual void UpdateViewportGeometry(int32 ViewportWidth, int32 ViewportHeight) override;
+	virtual bool StartCalibration(const FString& ProfileId) override { return IsValid(); }
+	virtual void StopCalibration() override {}
+	virtual bool WaitForNextFrame(FBeamFrame& OutFrame, uint32 TimeoutMs) override;
+
+	/** Generates the next frame immediately, ignoring pacing; usable without Initialize for offline tests */
+	void GenerateFrame(FBeamFrame& OutFrame);
+
+	/** Restarts the sequence from frame 0 with the configured seed */
+	void Reset();
+
+	const FBeamSyntheticParams& GetParams() const { return Params; }
+
+private:
+	enum class EPhase : uint8
+	{
+		Fixation,
+		Saccade
+	};
+
+	const FBeamSyntheticParams Params;
+	const double FrameIntervalSeconds;
+
+	/** Guards generator state; the producer thread and game thread may both pull */
+	mutable FCriticalSection GeneratorLock;
+	bool bRunning = false;
+	double StartWallSeconds = 0.0;
+
+	FRandomStream Random;
+	int64 FrameIndex = 0;
+	int32 ViewportWidth = 1920;
+	int32 ViewportHeight = 1080;
+
+	// Gaze state machine, all times on the synthetic clock (seconds since frame 0)
+	EPhase Phase = EPhase::Fixation;
+	double PhaseEndSeconds = 0.0;
+	double NextBlinkSeconds = 0.0;
+	double BlinkEndSeconds = -1.0;
+	FVector2D FixationCenter = FVector2D(0.5, 0.5);
+	FVector2D DriftOffset = FVector2D::ZeroVector;
+	FVector2D SaccadeStart = FVector2D(0.5, 0.5);
+	FVector2D SaccadeEnd = FVector2D(0.5, 0.5);
+	double SaccadeStartSeconds = 0.0;
+
+	// Head random walk and sway phases
+	FVector HeadWalkCm = FVector::ZeroVector;
+	float HeadPhase[3] = { 0.0f, 0.0f, 0.0f };
+
+	FBeamFrame LastFrame;
+	bool bHasFrame = false;
+
+	/** Synthetic-clock time of frame FrameIndex */
+	double GetFrameSeconds(int64 Index) const { return Index * FrameIntervalSeconds; }
+
+	/** Zero-mean, unit-variance sample from the seeded stream */
+	double Gaussian();
+
+	void BeginFixation(double NowSeconds);
+	void BeginSaccade(double NowSeconds);
+	void ScheduleNextBlink(double NowSeconds);
+
+	/** Generates one frame. Caller holds GeneratorLock. */
+	void GenerateFrameLocked(FBeamFrame& OutFrame);
+};
+
+#endif // BEAM_FEATURE_SYNTHETIC_DATA
+
+/*=============================================================================
+    End of BeamSyntheticDataSource.h
+=============================================================================*/
@@ -1,48 +1,98 @@
 ﻿// Implements performance tracing for Beam eye tracking
 
 #include "BeamTrace.h"
-#include "HAL/PlatformFilemanager.h"
+
+#if BEAM_FEATURE_UNREAL_INSIGHTS
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "BeamLogging.h"
+#include "BeamExport.h"
+#include "HAL/FileManager.h"
+
+FBeamTrace* GBeamTracer = nullptr;
+
+UE_TRACE_CHANNEL_DEFINE(BeamChannel);
+
+// Field layout is read by FBeamTraceAnalyzer in BeamEyeTrackerInsights; add fields at the end only
+UE_TRACE_EVENT_BEGIN(Beam, FramePublished)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int64, FrameId)
+	UE_TRACE_EVENT_FIELD(double, SDKTimestampMs)
+	UE_TRACE_EVENT_FIELD(double, CaptureSeconds)
+	UE_TRACE_EVENT_FIELD(float, GazeX)
+	UE_TRACE_EVENT_FIELD(float, GazeY)
+	UE_TRACE_EVENT_FIELD(float, Confidence)
+	UE_TRACE_EVENT_FIELD(uint8, bValid)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Beam, FrameConsumed)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int64, FrameId)
+UE_TRACE_EVENT_END()
 
 FBeamTrace::FBeamTrace()
 	: bEnabled(false)
 	, TraceLevel(ETraceCategory::Polling)
+	, NumClaimedRings(0)
+	, DroppedEvents(0)
 {
 }
 
 FBeamTrace::~FBeamTrace()
 {
-	if (bEnabled)
-	{
-		Shutdown();
-	}
+	Shutdown();
 }
 
 bool FBeamTrace::Initialize()
 {
-	bEnabled = true;
-	ActiveEvents.Empty();
-	CSVData.Empty();
-	
-	UE_LOG(LogBeam, Log, TEXT("Beam trace system initialized"));
+	if (!Rings)
+	{
+		// All recording memory is allocated here so the record path never allocates
+		Rings = MakeUnique<FThreadRing[]>(MaxThreads);
+	}
+	NumClaimedRings.store(0, std::memory_order_relaxed);
+	DroppedEvents.store(0, std::memory_order_relaxed);
+	for (int32 i = 0; i < MaxThreads; ++i)
+	{
+		Rings[i].ThreadId.store(0, std::memory_order_relaxed);
+		Rings[i].Head.store(0, std::memory_order_relaxed);
+		Rings[i].ScopeDepth = 0;
+	}
+
+	bEnabled.store(true, std::memory_order_release);
+
+	UE_LOG(LogBeam, Log, TEXT("Beam trace system initialized (%d threads x %d events)"), MaxThreads, EventsPerThread);
 	return true;
 }
 
 void FBeamTrace::Shutdown()
 {
-	bEnabled = false;
-	ActiveEvents.Empty();
-	CSVData.Empty();
-	
-	UE_LOG(LogBeam, Log, TEXT("Beam trace system shut down"));
+	const bool bWasActive = Rings.IsValid();
+	bEnabled.store(false, std::memory_order_release);
+	Rings.Reset();
+	NumClaimedRings.store(0, std::memory_order_relaxed);
+
+	if (bWasActive)
+	{
+		UE_LOG(LogBeam, Log, TEXT("Beam trace system shut down"));
+	}
 }
 
 void FBeamTrace::SetEnabled(bool bInEnabled)
 {
-	bEnabled = bInEnabled;
-	
-	if (bEnabled)
+	if (bInEnabled && !Rings)
+	{
+		Initialize();
+		return;
+	}
+
+	bEnabled.store(bInEnabled, std::memory_order_release);
+
+	if (bInEnabled)
 	{
 		UE_LOG(LogBeam, Log, TEXT("Beam trace system enabled"));
 	}
@@ -54,118 +104,321 @@ void FBeamTrace::SetEnabled(bool bInEnabled)
 
 void FBeamTrace::SetTraceLevel(ETraceCategory InTraceLevel)
 {
-	TraceLevel = InTraceLevel;
+	TraceLevel.store(InTraceLevel, std::memory_order_relaxed);
 	UE_LOG(LogBeam, Log, TEXT("Beam trace level set to %d"), (int32)InTraceLevel);
 }
 
-void FBeamTrace::BeginEvent(ETraceCategory Category, const FString& EventName)
+FBeamTrace::FThreadRing* FBeamTrace::GetThreadRing()
 {
-	if (!bEnabled || Category < TraceLevel)
+	if (!Rings)
+	{
+		return nullptr;
+	}
+
+	// A linear scan over at most MaxThreads ids is cheaper than a TLS slot lookup for this pool size
+	const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+	const int32 NumClaimed = FMath::Min(NumClaimedRings.load(std::memory_order_acquire), MaxThreads);
+	for (int32 i = 0; i < NumClaimed; ++i)
 	{
+		if (Rings[i].ThreadId.load(std::memory_order_relaxed) == ThreadId)
+		{
+			return &Rings[i];
+		}
+	}
+
+	const int32 Claimed = NumClaimedRings.fetch_add(1, std::memory_order_acq_rel);
+	if (Claimed >= MaxThreads)
+	{
+		return nullptr;
+	}
+	Rings[Claimed].ThreadId.store(ThreadId, std::memory_order_release);
+	return &Rings[Claimed];
+}
+
+void FBeamTrace::Record(ETraceCategory Category, ETraceEvent Type, const TCHAR* Name, double Value, uint64 Cycles)
+{
+	FThreadRing* Ring = GetThreadRing();
+	if (!Ring)
+	{
+		DroppedEvents.fetch_add(1, std::memory_order_relaxed);
 		return;
 	}
 
-	FString EventKey = FString::Printf(TEXT("%d_%s"), (int32)Category, *EventName);
-	ActiveEvents.Add(EventKey, FPlatformTime::Seconds());
-	
-	UE_LOG(LogBeam, VeryVerbose, TEXT("Trace: Begin event %s in category %d"), *EventName, (int32)Category);
+	const uint64 Head = Ring->Head.load(std::memory_order_relaxed);
+	FRecord& Slot = Ring->Records[Head % EventsPerThread];
+	Slot.Cycles = Cycles;
+	Slot.Name = Name;
+	Slot.Value = Value;
+	Slot.Category = Category;
+	Slot.Type = Type;
+
+	// Publishes the slot to ExportToCSV
+	Ring->Head.store(Head + 1, std::memory_order_release);
 }
 
-void FBeamTrace::EndEvent(ETraceCategory Category)
+void FBeamTrace::BeginEvent(ETraceCategory Category, const TCHAR* EventName)
 {
-	if (!bEnabled || Category < TraceLevel)
+	if (!ShouldRecord(Category))
 	{
 		return;
 	}
 
-	UE_LOG(LogBeam, VeryVerbose, TEXT("Trace: End event in category %d"), (int32)Category);
+	const uint64 Cycles = FPlatformTime::Cycles64();
+	if (FThreadRing* Ring = GetThreadRing())
+	{
+		if (Ring->ScopeDepth < MaxScopeDepth)
+		{
+			Ring->ScopeStartCycles[Ring->ScopeDepth] = Cycles;
+			Ring->ScopeNames[Ring->ScopeDepth] = EventName;
+		}
+		++Ring->ScopeDepth;
+	}
+	Record(Category, ETraceEvent::Begin, EventName, 0.0, Cycles);
 }
 
-void FBeamTrace::InstantEvent(ETraceCategory Category, const FString& EventName)
+void FBeamTrace::EndEvent(ETraceCategory Category)
 {
-	if (!bEnabled || Category < TraceLevel)
+	if (!ShouldRecord(Category))
+	{
+		return;
+	}
+
+	const uint64 Cycles = FPlatformTime::Cycles64();
+	FThreadRing* Ring = GetThreadRing();
+	if (!Ring || Ring->ScopeDepth == 0)
 	{
 		return;
 	}
 
-	UE_LOG(LogBeam, VeryVerbose, TEXT("Trace: Instant event %s in category %d"), *EventName, (int32)Category);
+	// Scopes nested deeper than the stack still balance, they just lose their name and duration
+	--Ring->ScopeDepth;
+	const bool bTracked = Ring->ScopeDepth < MaxScopeDepth;
+	const TCHAR* Name = bTracked ? Ring->ScopeNames[Ring->ScopeDepth] : TEXT("");
+	const double DurationMs = bTracked ? FPlatformTime::ToMilliseconds64(Cycles - Ring->ScopeStartCycles[Ring->ScopeDepth]) : 0.0;
+	Record(Category, ETraceEvent::End, Name, DurationMs, Cycles);
+}
+
+void FBeamTrace::RecordScope(ETraceCategory Category, const TCHAR* EventName, uint64 StartCycles, uint64 EndCycles)
+{
+	if (!ShouldRecord(Category))
+	{
+		return;
+	}
+	Record(Category, ETraceEvent::End, EventName, FPlatformTime::ToMilliseconds64(EndCycles - StartCycles), EndCycles);
 }
 
-void FBeamTrace::TraceCounter(ETraceCategory Category, const FString& CounterName, double Value)
+void FBeamTrace::InstantEvent(ETraceCategory Category, const TCHAR* EventName)
 {
-	if (!bEnabled || Category < TraceLevel)
+	if (!ShouldRecord(Category))
 	{
 		return;
 	}
+	Record(Category, ETraceEvent::Instant, EventName, 0.0, FPlatformTime::Cycles64());
+}
 
-	UE_LOG(LogBeam, VeryVerbose, TEXT("Trace: Counter %s = %.3f in category %d"), *CounterName, Value, (int32)Category);
+void FBeamTrace::TraceCounter(ETraceCategory Category, const TCHAR* CounterName, double Value)
+{
+	if (!ShouldRecord(Category))
+	{
+		return;
+	}
+	Record(Category, ETraceEvent::Counter, CounterName, Value, FPlatformTime::Cycles64());
 }
 
 void FBeamTrace::TraceFrame(const FBeamFrame& Frame)
 {
-	if (!bEnabled)
+	if (!ShouldRecord(ETraceCategory::FrameAge))
 	{
 		return;
 	}
 
-	UE_LOG(LogBeam, VeryVerbose, TEXT("Trace: Frame %lld at time %.3f"), Frame.FrameId, Frame.SDKTimestampMs);
+	// Age of the frame when it reached the tracer, on the UE clock
+	const double AgeMs = (FPlatformTime::Seconds() - Frame.UETimestampSeconds) * 1000.0;
+	TRACE_FLOAT_VALUE(TEXT("Beam/FrameAgeMs"), AgeMs);
+	Record(ETraceCategory::FrameAge, ETraceEvent::Counter, TEXT("FrameAgeMs"), AgeMs, FPlatformTime::Cycles64());
 }
 
-void FBeamTrace::TraceHealth(EBeamHealth Health, const FString& Details)
+void FBeamTrace::OutputFramePublished(const FBeamFrame& Frame)
 {
-	if (!bEnabled)
+	UE_TRACE_LOG(Beam, FramePublished, BeamChannel)
+		<< FramePublished.Cycle(FPlatformTime::Cycles64())
+		<< FramePublished.FrameId(Frame.FrameId)
+		<< FramePublished.SDKTimestampMs(Frame.SDKTimestampMs)
+		<< FramePublished.CaptureSeconds(Frame.UETimestampSeconds)
+		<< FramePublished.GazeX(static_cast<float>(Frame.Gaze.Screen01.X))
+		<< FramePublished.GazeY(static_cast<float>(Frame.Gaze.Screen01.Y))
+		<< FramePublished.Confidence(static_cast<float>(Frame.Gaze.Confidence))
+		<< FramePublished.bValid(Frame.Gaze.bValid ? 1 : 0);
+}
+
+void FBeamTrace::OutputFrameConsumed(const FBeamFrame& Frame)
+{
+	UE_TRACE_LOG(Beam, FrameConsumed, BeamChannel)
+		<< FrameConsumed.Cycle(FPlatformTime::Cycles64())
+		<< FrameConsumed.FrameId(Frame.FrameId);
+}
+
+void FBeamTrace::TraceHealth(EBeamHealth Health)
+{
+	if (!ShouldRecord(ETraceCategory::Health))
 	{
 		return;
 	}
-
-	UE_LOG(LogBeam, VeryVerbose, TEXT("Trace: Health changed to %d - %s"), (int32)Health, *Details);
+	TRACE_INT_VALUE(TEXT("Beam/Health"), static_cast<int64>(Health));
+	Record(ETraceCategory::Health, ETraceEvent::Instant, TEXT("Health"), static_cast<double>(Health), FPlatformTime::Cycles64());
 }
 
 void FBeamTrace::TraceFilterPerformance(int32 FilterType, double ProcessingTimeMs)
 {
-	if (!bEnabled)
+	if (!ShouldRecord(ETraceCategory::Filters))
 	{
 		return;
 	}
 
-	UE_LOG(LogBeam, VeryVerbose, TEXT("Trace: Filter %d took %.3f ms"), FilterType, ProcessingTimeMs);
+	// Indexed by EBeamFilterType; static names keep the record pointer-sized
+	static const TCHAR* const FilterNames[] = { TEXT("Filter.None"), TEXT("Filter.EMA"), TEXT("Filter.OneEuro") };
+	const TCHAR* Name = FilterType >= 0 && FilterType < UE_ARRAY_COUNT(FilterNames) ? FilterNames[FilterType] : TEXT("Filter.Other");
+	TRACE_FLOAT_VALUE(TEXT("Beam/FilterMs"), ProcessingTimeMs);
+	Record(ETraceCategory::Filters, ETraceEvent::Counter, Name, ProcessingTimeMs, FPlatformTime::Cycles64());
 }
 
-bool FBeamTrace::ExportToCSV(const FString& FilePath, double StartTime, double EndTime)
+const TCHAR* FBeamTrace::GetCategoryName(ETraceCategory Category)
 {
-	if (!bEnabled)
+	switch (Category)
 	{
+	case ETraceCategory::Polling:    return TEXT("Polling");
+	case ETraceCategory::QueueDepth: return TEXT("QueueDepth");
+	case ETraceCategory::FrameAge:   return TEXT("FrameAge");
+	case ETraceCategory::Health:     return TEXT("Health");
+	case ETraceCategory::Filters:    return TEXT("Filters");
+	default:                         return TEXT("Unknown");
+	}
+}
+
+const TCHAR* FBeamTrace::GetEventTypeName(ETraceEvent Type)
+{
+	switch (Type)
+	{
+	case ETraceEvent::Begin:   return TEXT("Begin");
+	case ETraceEvent::End:     return TEXT("End");
+	case ETraceEvent::Instant: return TEXT("Instant");
+	case ETraceEvent::Counter: return TEXT("Counter");
+	default:                   return TEXT("Unknown");
+	}
+}
+
+bool FBeamTrace::ExportToCSV(const FString& FilePath, double StartTime, double EndTime) const
+{
+	if (!Rings)
+	{
+		UE_LOG(LogBeam, Warning, TEXT("No trace data to export; tracing was never initialized"));
 		return false;
 	}
 
-	FString CSVContent = TEXT("Timestamp,Category,EventName,EventType,Value,Details\n");
-	
-	// Add data rows (simplified implementation)
-	for (const FCSVRow& Row : CSVData)
+	struct FExportRow
 	{
-		if (Row.Timestamp >= StartTime && Row.Timestamp <= EndTime)
+		FRecord Record;
+		uint32 ThreadId;
+	};
+
+	TArray<FExportRow> Rows;
+	const int32 NumClaimed = FMath::Min(NumClaimedRings.load(std::memory_order_acquire), MaxThreads);
+	for (int32 RingIndex = 0; RingIndex < NumClaimed; ++RingIndex)
+	{
+		const FThreadRing& Ring = Rings[RingIndex];
+		const uint64 Head = Ring.Head.load(std::memory_order_acquire);
+		const uint64 First = Head > EventsPerThread ? Head - EventsPerThread : 0;
+		const int32 RowsBefore = Rows.Num();
+		for (uint64 Index = First; Index < Head; ++Index)
 		{
-			CSVContent += FString::Printf(TEXT("%.6f,%s,%s,%s,%.6f,%s\n"),
-				Row.Timestamp,
-				*Row.Category,
-				*Row.EventName,
-				*Row.EventType,
-				Row.Value,
-				*Row.Details);
+			Rows.Add({ Ring.Records[Index % EventsPerThread], Ring.ThreadId.load(std::memory_order_relaxed) });
+		}
+
+		// The writer may have lapped the oldest slots while they were copied; drop those
+		const uint64 HeadAfter = Ring.Head.load(std::memory_order_acquire);
+		const uint64 Overwritten = HeadAfter > EventsPerThread + First ? FMath::Min<uint64>(HeadAfter - EventsPerThread - First, Head - First) : 0;
+		if (Overwritten > 0)
+		{
+			Rows.RemoveAt(RowsBefore, static_cast<int32>(Overwritten), EAllowShrinking::No);
 		}
 	}
 
-	bool bSuccess = FFileHelper::SaveStringToFile(CSVContent, *FilePath);
-	
-	if (bSuccess)
+	// FPlatformTime::Seconds() adds a base to the cycle count on some platforms; measure it so records
+	// compare against the caller's range, and export, on the same clock
+	const double SecondsBase = FPlatformTime::Seconds() - FPlatformTime::ToSeconds64(FPlatformTime::Cycles64());
+	Rows.RemoveAll([StartTime, EndTime, SecondsBase](const FExportRow& Row)
 	{
-		UE_LOG(LogBeam, Log, TEXT("Trace data exported to CSV: %s"), *FilePath);
-	}
-	else
+		const double Timestamp = FPlatformTime::ToSeconds64(Row.Record.Cycles) + SecondsBase;
+		return Timestamp < StartTime || Timestamp > EndTime;
+	});
+	Rows.Sort([](const FExportRow& A, const FExportRow& B) { return A.Record.Cycles < B.Record.Cycles; });
+
+	// Event names are string literals and category names static, so the rows stay valid on the export task
+	const FString Description = FString::Printf(TEXT("%d trace events (%llu dropped)"), Rows.Num(), GetDroppedEvents());
+	BeamExport::Launch(Description, FilePath, [FilePath, SecondsBase, Rows = MoveTemp(Rows)]()
 	{
-		UE_LOG(LogBeam, Error, TEXT("Failed to export trace data to CSV: %s"), *FilePath);
-	}
-	
-	return bSuccess;
+		TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*FilePath));
+		if (!Archive)
+		{
+			return false;
+		}
+
+		FBeamCsvWriter Writer(*Archive);
+		Writer.WriteHeader("Timestamp,ThreadId,Category,EventName,EventType,Value");
+		for (const FExportRow& Row : Rows)
+		{
+			Writer.Add(FPlatformTime::ToSeconds64(Row.Record.Cycles) + SecondsBase)
+				.Add(Row.ThreadId)
+				.Add(GetCategoryName(Row.Record.Category))
+				.Add(Row.Record.Name ? Row.Record.Name : TEXT(""))
+				.Add(GetEventTypeName(Row.Record.Type))
+				.Add(Row.Record.Value);
+			Writer.EndRow();
+		}
+		return Writer.Flush() && Archive->Close();
+	});
+	return true;
 }
 
+// Console Commands
+
+#if !UE_BUILD_SHIPPING
+
+// Usage: "Beam.Trace 1" / "Beam.Trace 0"
+static FAutoConsoleCommand BeamTraceEnableCommand(
+	TEXT("Beam.Trace"),
+	TEXT("Enable (1) or disable (0) Beam hot-path event recording"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (!GBeamTracer)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Beam tracer is not available"));
+			return;
+		}
+		GBeamTracer->SetEnabled(Args.Num() == 0 || FCString::Atoi(*Args[0]) != 0);
+	})
+);
+
+// Usage: "Beam.Trace.Export [File.csv]"; relative paths land in Saved/Profiling
+static FAutoConsoleCommand BeamTraceExportCommand(
+	TEXT("Beam.Trace.Export"),
+	TEXT("Export the recorded Beam trace events to CSV"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (!GBeamTracer)
+		{
+			UE_LOG(LogBeam, Warning, TEXT("Beam tracer is not available"));
+			return;
+		}
+		FString Path = Args.Num() > 0 ? Args[0] : TEXT("BeamTrace.csv");
+		if (FPaths::IsRelative(Path))
+		{
+			Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), Path);
+		}
+		GBeamTracer->ExportToCSV(Path, 0.0, TNumericLimits<double>::Max());
+	})
+);
+
+#endif // !UE_BUILD_SHIPPING
+
+#endif // BEAM_FEATURE_UNREAL_INSIGHTS
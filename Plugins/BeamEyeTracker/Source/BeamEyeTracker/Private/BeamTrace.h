@@ -1,9 +1,13 @@
 /*=============================================================================
-    BeamTrace.h: Gaze ray tracing and performance analysis for Beam SDK.
+    BeamTrace.h: Hot-path performance instrumentation for Beam SDK.
 
-    Performs gaze ray tracing into the 3D world with Unreal Insights/CSV
-    helpers for comprehensive performance analysis including poll duration,
-    queue depth, frame age, and system health monitoring.
+    Scopes and counters go to Unreal Insights through the CPU profiler and
+    counter trace channels, and are mirrored into fixed-size per-thread
+    binary event rings that can be exported to CSV for offline analysis of
+    poll duration, queue depth, frame age and health transitions. Every
+    published and consumed frame is also logged as a binary event on the
+    Beam trace channel, which the BeamEyeTrackerInsights module turns into
+    a gaze timing track in Unreal Insights.
 
     Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
 
@@ -14,8 +18,27 @@
 
 #include "CoreMinimal.h"
 #include "BeamEyeTrackerTypes.h"
+#include "BeamFeatures.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Trace/Trace.h"
+#include "Templates/UniquePtr.h"
+#include <atomic>
 
-/** Performs gaze ray tracing into the 3D world */
+#if BEAM_FEATURE_UNREAL_INSIGHTS
+
+/** Frame lifetime events (Beam.FramePublished, Beam.FrameConsumed); enable with -trace=default,Beam */
+UE_TRACE_CHANNEL_EXTERN(BeamChannel, BEAMEYETRACKER_API);
+
+/**
+ * Per-thread binary event recorder.
+ *
+ * Event and counter names must be string literals (or otherwise outlive the
+ * tracer): records store the pointer, never a copy. Each recording thread
+ * claims one fixed-size ring from a pool allocated by Initialize, so
+ * recording never allocates or locks; when a ring is full the oldest events
+ * are overwritten. While disabled every entry point is one relaxed load.
+ */
 class BEAMEYETRACKER_API FBeamTrace
 {
 public:
@@ -33,122 +56,200 @@ public:
 	enum class ETraceEvent : uint8
 	{
 		Begin,          // Start of operation
-		End,            // End of operation
+		End,            // End of operation; Value is the duration in milliseconds
 		Instant,        // Instantaneous event
 		Counter         // Counter value
 	};
 
+	/** Events kept per recording thread */
+	static constexpr int32 EventsPerThread = 4096;
+
+	/** Recording threads supported; events from further threads are counted as dropped */
+	static constexpr int32 MaxThreads = 16;
+
+	/** Nesting depth tracked for BeginEvent/EndEvent pairs per thread */
+	static constexpr int32 MaxScopeDepth = 16;
+
 public:
 	FBeamTrace();
 	~FBeamTrace();
 
-	/** Initializes the tracing system and prepares for data collection */
+	/** Allocates the per-thread rings and enables recording */
 	bool Initialize();
-	
-	/** Shuts down the tracing system and cleans up resources */
+
+	/** Disables recording and frees the rings; no thread may be recording concurrently */
 	void Shutdown();
-	
+
 	/** Checks if tracing is currently enabled and active */
-	bool IsEnabled() const { return bEnabled; }
-	
+	bool IsEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+
+	/** True when events in Category are currently recorded */
+	bool ShouldRecord(ETraceCategory Category) const
+	{
+		return IsEnabled() && Category >= TraceLevel.load(std::memory_order_relaxed);
+	}
+
 	/** Enables or disables tracing system at runtime */
 	void SetEnabled(bool bInEnabled);
-	
+
 	/** Sets the trace level to control which categories are recorded */
 	void SetTraceLevel(ETraceCategory InTraceLevel);
-	
+
 	/** Begins a trace event for timing measurements */
-	void BeginEvent(ETraceCategory Category, const FString& EventName);
-	
-	/** Ends a trace event and records the duration */
+	void BeginEvent(ETraceCategory Category, const TCHAR* EventName);
+
+	/** Ends the innermost event begun on this thread and records its duration */
 	void EndEvent(ETraceCategory Category);
-	
+
 	/** Records an instantaneous trace event without duration */
-	void InstantEvent(ETraceCategory Category, const FString& EventName);
-	
+	void InstantEvent(ETraceCategory Category, const TCHAR* EventName);
+
 	/** Traces a counter value for performance metrics */
-	void TraceCounter(ETraceCategory Category, const FString& CounterName, double Value);
-	
+	void TraceCounter(ETraceCategory Category, const TCHAR* CounterName, double Value);
+
 	/** Traces frame data for analysis and debugging */
 	void TraceFrame(const FBeamFrame& Frame);
-	
+
 	/** Traces health status changes for system monitoring */
-	void TraceHealth(EBeamHealth Health, const FString& Details = TEXT(""));
-	
+	void TraceHealth(EBeamHealth Health);
+
 	/** Traces filter performance for optimization analysis */
 	void TraceFilterPerformance(int32 FilterType, double ProcessingTimeMs);
-	
-	/** Exports trace data to CSV format for external analysis */
-	bool ExportToCSV(const FString& FilePath, double StartTime, double EndTime);
+
+	/** Logs Beam.FramePublished on BeamChannel; independent of Initialize so captures work without the rings */
+	static void OutputFramePublished(const FBeamFrame& Frame);
+
+	/** Logs Beam.FrameConsumed on BeamChannel for the first game-thread read of Frame */
+	static void OutputFrameConsumed(const FBeamFrame& Frame);
+
+	/** Records a completed scope; used by FBeamTraceEvent, which measured StartCycles itself */
+	void RecordScope(ETraceCategory Category, const TCHAR* EventName, uint64 StartCycles, uint64 EndCycles);
+
+	/** Snapshots events between StartTime and EndTime (FPlatformTime::Seconds) and writes them to CSV on a background task; may run while recording */
+	bool ExportToCSV(const FString& FilePath, double StartTime, double EndTime) const;
+
+	/** Events lost because every ring was claimed by other threads */
+	uint64 GetDroppedEvents() const { return DroppedEvents.load(std::memory_order_relaxed); }
 
 private:
-	/** Tracing system state and configuration */
-	bool bEnabled = false;
-	ETraceCategory TraceLevel = ETraceCategory::Polling;
-	
-	/** Active events for timing measurements */
-	TMap<FString, double> ActiveEvents;
-	
-	/** CSV export data structure for data analysis */
-	struct FCSVRow
+	/** One binary event; 32 bytes */
+	struct FRecord
 	{
-		double Timestamp;
-		FString Category;
-		FString EventName;
-		FString EventType;
+		uint64 Cycles;
+		const TCHAR* Name;
 		double Value;
-		FString Details;
+		ETraceCategory Category;
+		ETraceEvent Type;
+	};
+
+	/** Single-writer ring owned by one thread */
+	struct FThreadRing
+	{
+		std::atomic<uint32> ThreadId{ 0 };
+
+		/** Total records written; the writer is the only thread that advances it */
+		std::atomic<uint64> Head{ 0 };
+
+		FRecord Records[EventsPerThread];
+
+		/** BeginEvent stack for the owning thread */
+		uint64 ScopeStartCycles[MaxScopeDepth];
+		const TCHAR* ScopeNames[MaxScopeDepth];
+		int32 ScopeDepth = 0;
 	};
-	
-	TArray<FCSVRow> CSVData;
-	
-	/** Gets current timestamp in seconds for event timing */
-	double GetCurrentTimestamp() const;
-	
-	/** Formats trace data row for CSV export */
-	FString FormatCSVRow(const FCSVRow& Row) const;
-	
-	/** Writes CSV header with column names */
-	void WriteCSVHeader(IFileHandle* File) const;
+
+	/** Tracing system state and configuration */
+	std::atomic<bool> bEnabled;
+	std::atomic<ETraceCategory> TraceLevel;
+
+	TUniquePtr<FThreadRing[]> Rings;
+	std::atomic<int32> NumClaimedRings;
+	std::atomic<uint64> DroppedEvents;
+
+	/** Finds or claims the calling thread's ring; nullptr when the pool is exhausted or not allocated */
+	FThreadRing* GetThreadRing();
+
+	void Record(ETraceCategory Category, ETraceEvent Type, const TCHAR* Name, double Value, uint64 Cycles);
+
+	static const TCHAR* GetCategoryName(ETraceCategory Category);
+	static const TCHAR* GetEventTypeName(ETraceEvent Type);
 };
 
 /**
  * RAII wrapper for trace events to ensure proper cleanup.
- * 
- * Automatically begins and ends trace events when created and destroyed,
- * ensuring that all trace events are properly closed even if exceptions occur.
+ *
+ * Records one End event carrying the scope duration when destroyed. The
+ * constructor only reads the clock when the category is being recorded.
  */
 class BEAMEYETRACKER_API FBeamTraceEvent
 {
 public:
-	FBeamTraceEvent(FBeamTrace* InTracer, FBeamTrace::ETraceCategory InCategory, const FString& InEventName);
-	~FBeamTraceEvent();
+	FBeamTraceEvent(FBeamTrace* InTracer, FBeamTrace::ETraceCategory InCategory, const TCHAR* InEventName)
+		: Tracer(InTracer && InTracer->ShouldRecord(InCategory) ? InTracer : nullptr)
+		, Category(InCategory)
+		, EventName(InEventName)
+		, StartCycles(Tracer ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FBeamTraceEvent()
+	{
+		if (Tracer)
+		{
+			Tracer->RecordScope(Category, EventName, StartCycles, FPlatformTime::Cycles64());
+		}
+	}
 
 private:
 	FBeamTrace* Tracer;
 	FBeamTrace::ETraceCategory Category;
-	FString EventName;
+	const TCHAR* EventName;
+	uint64 StartCycles;
 };
 
+/** Global tracer instance for easy access throughout the system */
+extern BEAMEYETRACKER_API FBeamTrace* GBeamTracer;
+
+#endif // BEAM_FEATURE_UNREAL_INSIGHTS
+
 /**
  * Trace macros for easy usage throughout the codebase.
- * 
- * These macros provide convenient access to tracing functionality
- * and automatically handle feature flag checking for Unreal Insights.
+ *
+ * EventName and CounterName must be TEXT() literals. BEAM_TRACE_BEGIN opens
+ * an Insights CPU scope and a ring scope that both close at the end of the
+ * enclosing C++ scope; BEAM_TRACE_COUNTER sets an Insights counter and
+ * records the value into the ring. BEAM_TRACE_FRAME_PUBLISHED and
+ * BEAM_TRACE_FRAME_CONSUMED cost one channel check unless BeamChannel is
+ * enabled. All of them compile to nothing when BEAM_FEATURE_UNREAL_INSIGHTS
+ * is off.
  */
 #if BEAM_FEATURE_UNREAL_INSIGHTS
 
 #define BEAM_TRACE_BEGIN(Category, EventName) \
-	FBeamTraceEvent BEAM_TRACE_EVENT_##__LINE__(GBeamTracer, Category, EventName)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(EventName); \
+	FBeamTraceEvent PREPROCESSOR_JOIN(BeamTraceEvent, __LINE__)(GBeamTracer, Category, EventName)
 
 #define BEAM_TRACE_END(Category) \
 	/* End event handled by RAII */
 
 #define BEAM_TRACE_INSTANT(Category, EventName) \
-	GBeamTracer->InstantEvent(Category, EventName)
+	do { if (GBeamTracer && GBeamTracer->ShouldRecord(Category)) { GBeamTracer->InstantEvent(Category, EventName); } } while (0)
 
 #define BEAM_TRACE_COUNTER(Category, CounterName, Value) \
-	GBeamTracer->TraceCounter(Category, CounterName, Value)
+	do \
+	{ \
+		TRACE_FLOAT_VALUE(CounterName, Value); \
+		if (GBeamTracer && GBeamTracer->ShouldRecord(Category)) { GBeamTracer->TraceCounter(Category, CounterName, Value); } \
+	} while (0)
+
+#define BEAM_TRACE_FRAME(Frame) \
+	do { if (GBeamTracer) { GBeamTracer->TraceFrame(Frame); } } while (0)
+
+#define BEAM_TRACE_FRAME_PUBLISHED(Frame) \
+	do { if (UE_TRACE_CHANNELEXPR_IS_ENABLED(BeamChannel)) { FBeamTrace::OutputFramePublished(Frame); } } while (0)
+
+#define BEAM_TRACE_FRAME_CONSUMED(Frame) \
+	do { if (UE_TRACE_CHANNELEXPR_IS_ENABLED(BeamChannel)) { FBeamTrace::OutputFrameConsumed(Frame); } } while (0)
 
 #else
 
@@ -156,12 +257,12 @@ private:
 #define BEAM_TRACE_END(Category)
 #define BEAM_TRACE_INSTANT(Category, EventName)
 #define BEAM_TRACE_COUNTER(Category, CounterName, Value)
+#define BEAM_TRACE_FRAME(Frame)
+#define BEAM_TRACE_FRAME_PUBLISHED(Frame)
+#define BEAM_TRACE_FRAME_CONSUMED(Frame)
 
 #endif
 
-/** Global tracer instance for easy access throughout the system */
-extern BEAMEYETRACKER_API FBeamTrace* GBeamTracer;
-
 /*=============================================================================
     End of BeamTrace.h
 =============================================================================*/
@@ -0,0 +1,319 @@
+// Implements the extra-tracker registry and its task-pool pump
+
+#include "BeamTrackerRegistry.h"
+#include "IBeamDataSource.h"
+#include "BeamLogging.h"
+#include "BeamPollingScheduler.h"
+#include "BeamResources.h"
+#include "BeamStats.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "Tasks/Task.h"
+
+DECLARE_CYCLE_STAT(TEXT("Service Extra Tracker"), STAT_BeamServiceTracker, STATGROUP_Beam);
+
+// Weight of the newest frame in the running gaze confidence mean
+#define BEAM_TRACKER_CONFIDENCE_ALPHA 0.05f
+
+FBeamTrackerPipeline::FBeamTrackerPipeline(int32 InId, FName InName, EBeamDataSourceType InSourceType, IBeamDataSource* InSource)
+	: Id(InId)
+	, Name(InName)
+	, SourceType(InSourceType)
+	, Source(InSource)
+{
+}
+
+FBeamTrackerPipeline::~FBeamTrackerPipeline()
+{
+	if (Source && bSourceReady.load(std::memory_order_acquire))
+	{
+		Source->Shutdown();
+	}
+}
+
+FBeamTrackerStats FBeamTrackerPipeline::GetStats() const
+{
+	FBeamTrackerStats Stats;
+	Stats.TrackerId = Id;
+	Stats.Name = Name;
+	Stats.SourceType = SourceType;
+	Stats.bSourceReady = bSourceReady.load(std::memory_order_acquire);
+	Stats.bSourceFailed = bSourceFailed.load(std::memory_order_acquire);
+	Stats.FramesPublished = static_cast<int64>(FramesPublished.load(std::memory_order_relaxed));
+	Stats.SourceDropped = static_cast<int64>(SourceDropped.load(std::memory_order_relaxed));
+	Stats.RingOverwritten = static_cast<int64>(Ring.GetOverwrittenFrames());
+	Stats.TrackerHz = TrackerHz.load(std::memory_order_relaxed);
+	Stats.MeanGazeConfidence = MeanGazeConfidence.load(std::memory_order_relaxed);
+
+	const double LastPublish = LastPublishSeconds.load(std::memory_order_relaxed);
+	Stats.SecondsSinceLastFrame = LastPublish > 0.0 ? static_cast<float>(FPlatformTime::Seconds() - LastPublish) : -1.0f;
+	return Stats;
+}
+
+FBeamTrackerRegistry::FBeamTrackerRegistry()
+{
+}
+
+FBeamTrackerRegistry::~FBeamTrackerRegistry()
+{
+	Shutdown();
+}
+
+int32 FBeamTrackerRegistry::Add(FName Name, EBeamDataSourceType SourceType, IBeamDataSource* Source)
+{
+	check(IsInGameThread());
+
+	if (!Source)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 TrackerId = INDEX_NONE;
+	{
+		FScopeLock ScopeLock(&Lock);
+		TrackerId = NextId++;
+		Pipelines.Add(MakeShared<FBeamTrackerPipeline, ESPMode::ThreadSafe>(TrackerId, Name, SourceType, Source));
+	}
+
+	// Not running yet, or stopped when the last tracker was removed
+	if (!PumpThread)
+	{
+		bStopPump.store(false, std::memory_order_release);
+		PumpWakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		PumpThread = FRunnableThread::Create(this, TEXT("BeamTrackerPump"), 0, TPri_AboveNormal);
+		if (!PumpThread)
+		{
+			UE_LOG(LogBeam, Error, TEXT("BeamEyeTracker: Could not start the tracker pump thread"));
+			FPlatformProcess::ReturnSynchEventToPool(PumpWakeEvent);
+			PumpWakeEvent = nullptr;
+		}
+	}
+	else
+	{
+		// The new tracker's source starts connecting right away instead of at the next wake
+		PumpWakeEvent->Trigger();
+	}
+
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Added tracker %d '%s' (source type %d)"), TrackerId, *Name.ToString(), static_cast<int32>(SourceType));
+	return TrackerId;
+}
+
+bool FBeamTrackerRegistry::Remove(int32 TrackerId)
+{
+	check(IsInGameThread());
+
+	FBeamTrackerPipelinePtr Removed;
+	bool bEmpty = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const int32 Index = Pipelines.IndexOfByPredicate([TrackerId](const FBeamTrackerPipelinePtr& Pipeline) { return Pipeline->Id == TrackerId; });
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+		Removed = Pipelines[Index];
+		Pipelines.RemoveAt(Index);
+		bEmpty = Pipelines.Num() == 0;
+	}
+
+	// Nothing left to pump; Add starts the thread again for the next tracker
+	if (bEmpty)
+	{
+		StopPump();
+	}
+
+	// The pump can no longer launch for it, so the last task is the one stored here
+	Removed->Task.Wait();
+	UE_LOG(LogBeam, Log, TEXT("BeamEyeTracker: Removed tracker %d '%s'"), TrackerId, *Removed->Name.ToString());
+
+	// Readers holding the pipeline keep its ring; the source shuts down when the last of them lets go
+	return true;
+}
+
+FBeamTrackerPipelinePtr FBeamTrackerRegistry::Find(int32 TrackerId) const
+{
+	FScopeLock ScopeLock(&Lock);
+	const FBeamTrackerPipelinePtr* Found = Pipelines.FindByPredicate([TrackerId](const FBeamTrackerPipelinePtr& Pipeline) { return Pipeline->Id == TrackerId; });
+	return Found ? *Found : FBeamTrackerPipelinePtr();
+}
+
+void FBeamTrackerRegistry::GetIds(TArray<int32>& OutIds) const
+{
+	FScopeLock ScopeLock(&Lock);
+	OutIds.Reset(Pipelines.Num());
+	for (const FBeamTrackerPipelinePtr& Pipeline : Pipelines)
+	{
+		OutIds.Add(Pipeline->Id);
+	}
+}
+
+int32 FBeamTrackerRegistry::Num() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Pipelines.Num();
+}
+
+void FBeamTrackerRegistry::SetRuntimeSettings(const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe>& Snapshot)
+{
+	if (!Snapshot.IsValid())
+	{
+		return;
+	}
+
+	{
+		FScopeLock ScopeLock(&SettingsLock);
+		RuntimeSettings = Snapshot;
+	}
+	SettingsVersion.store(Snapshot->Version, std::memory_order_release);
+}
+
+void FBeamTrackerRegistry::Shutdown()
+{
+	StopPump();
+
+	TArray<FBeamTrackerPipelinePtr> Remaining;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Remaining = MoveTemp(Pipelines);
+	}
+	for (const FBeamTrackerPipelinePtr& Pipeline : Remaining)
+	{
+		Pipeline->Task.Wait();
+	}
+}
+
+void FBeamTrackerRegistry::StopPump()
+{
+	if (PumpThread)
+	{
+		PumpThread->Kill(true);
+		delete PumpThread;
+		PumpThread = nullptr;
+	}
+	if (PumpWakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(PumpWakeEvent);
+		PumpWakeEvent = nullptr;
+	}
+}
+
+uint32 FBeamTrackerRegistry::Run()
+{
+	LLM_SCOPE_BYTAG(BeamEyeTracker);
+	GBeamResources.RegisterCurrentThread(TEXT("BeamTrackerPump"));
+
+	while (!bStopPump.load(std::memory_order_acquire))
+	{
+		LaunchTasks();
+		PumpWakeEvent->Wait(PumpIntervalMs);
+	}
+
+	GBeamResources.UnregisterCurrentThread();
+	return 0;
+}
+
+void FBeamTrackerRegistry::Stop()
+{
+	bStopPump.store(true, std::memory_order_release);
+	if (PumpWakeEvent)
+	{
+		PumpWakeEvent->Trigger();
+	}
+}
+
+void FBeamTrackerRegistry::LaunchTasks()
+{
+	// Launching under the lock keeps Remove from missing a task stored after it took the pipeline out
+	FScopeLock ScopeLock(&Lock);
+	for (const FBeamTrackerPipelinePtr& Pipeline : Pipelines)
+	{
+		// A tracker whose source never came up is left alone until it is removed
+		if (Pipeline->bSourceFailed.load(std::memory_order_acquire) || Pipeline->bTaskInFlight.exchange(true, std::memory_order_acq_rel))
+		{
+			continue;
+		}
+
+		FBeamTrackerPipeline* RawPipeline = Pipeline.Get();
+		Pipeline->Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, RawPipeline]()
+		{
+			ServiceTracker(*RawPipeline);
+			RawPipeline->bTaskInFlight.store(false, std::memory_order_release);
+		});
+	}
+}
+
+void FBeamTrackerRegistry::ServiceTracker(FBeamTrackerPipeline& Pipeline)
+{
+	LLM_SCOPE_BYTAG(BeamEyeTracker);
+	SCOPE_CYCLE_COUNTER(STAT_BeamServiceTracker);
+
+	IBeamDataSource& Source = *Pipeline.Source;
+	if (!Pipeline.bSourceReady.load(std::memory_order_relaxed))
+	{
+		if (!Source.Initialize() || !Source.IsValid())
+		{
+			UE_LOG(LogBeam, Warning, TEXT("BeamEyeTracker: Tracker %d '%s' failed to initialize its data source"), Pipeline.Id, *Pipeline.Name.ToString());
+			Pipeline.bSourceFailed.store(true, std::memory_order_release);
+			return;
+		}
+		Pipeline.bSourceReady.store(true, std::memory_order_release);
+	}
+
+	if (SettingsVersion.load(std::memory_order_acquire) != Pipeline.AppliedSettingsVersion)
+	{
+		TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> Snapshot;
+		{
+			FScopeLock ScopeLock(&SettingsLock);
+			Snapshot = RuntimeSettings;
+		}
+		if (Snapshot.IsValid())
+		{
+			Pipeline.Filters.UpdateOneEuroParams(Snapshot->OneEuro);
+			Pipeline.Filters.SetFilterType(Snapshot->GetEffectiveFilterType());
+			Pipeline.AppliedSettingsVersion = Snapshot->Version;
+		}
+	}
+
+	FBeamFrame Frame;
+	for (int32 Count = 0; Count < MaxFramesPerTask && Source.WaitForNextFrame(Frame, 0); ++Count)
+	{
+		// Sources without a native wait hand back the latest frame again until a new one arrives
+		if (Frame.FrameId == Pipeline.LastFrameId)
+		{
+			break;
+		}
+
+		// Same accounting as the primary producer: a gap is frames that never reached the ring, a lower id a restart
+		if (Pipeline.LastFrameId != INDEX_NONE && Frame.FrameId > Pipeline.LastFrameId + 1)
+		{
+			Pipeline.SourceDropped.fetch_add(static_cast<uint64>(Frame.FrameId - Pipeline.LastFrameId - 1), std::memory_order_relaxed);
+		}
+		else if (Frame.FrameId < Pipeline.LastFrameId)
+		{
+			Pipeline.LastSDKTimestampMs = 0.0;
+		}
+		Pipeline.LastFrameId = Frame.FrameId;
+
+		const double DeltaSeconds = Pipeline.LastSDKTimestampMs > 0.0 ? (Frame.SDKTimestampMs - Pipeline.LastSDKTimestampMs) * 0.001 : 0.0;
+		Pipeline.LastSDKTimestampMs = Frame.SDKTimestampMs;
+		Frame.DeltaTimeSeconds = DeltaSeconds;
+		Pipeline.TrackerHz.store(BeamPollingScheduler::UpdateRateEstimate(Pipeline.TrackerHz.load(std::memory_order_relaxed), DeltaSeconds), std::memory_order_relaxed);
+
+		Pipeline.Filters.ApplyFilters(Frame, DeltaSeconds);
+
+		// Latency percentiles describe the primary pipeline only, so extra trackers stamp without recording
+		Frame.PublishedSeconds = FPlatformTime::Seconds();
+		Pipeline.Ring.Publish(Frame);
+
+		if (Frame.Gaze.bValid)
+		{
+			const float Mean = Pipeline.MeanGazeConfidence.load(std::memory_order_relaxed);
+			Pipeline.MeanGazeConfidence.store(Mean + (static_cast<float>(Frame.Gaze.Confidence) - Mean) * BEAM_TRACKER_CONFIDENCE_ALPHA, std::memory_order_relaxed);
+		}
+		Pipeline.FramesPublished.fetch_add(1, std::memory_order_relaxed);
+		Pipeline.LastPublishSeconds.store(Frame.PublishedSeconds, std::memory_order_relaxed);
+	}
+}
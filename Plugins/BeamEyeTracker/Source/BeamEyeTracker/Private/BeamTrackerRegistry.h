@@ -0,0 +1,148 @@
+/*=============================================================================
+    BeamTrackerRegistry.h: Additional trackers beside the primary pipeline.
+
+    Each extra tracker owns a data source, a frame ring, a filter chain and
+    its running statistics. No tracker has a thread of its own: one pump
+    thread wakes every few milliseconds and launches a task per tracker on
+    the shared task graph worker pool, so an idle tracker costs one flag
+    check per wake and a busy one only its own drain, filter and publish.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamFilters.h"
+#include "BeamRing.h"
+#include "BeamRuntimeSettings.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+class IBeamDataSource;
+class FRunnableThread;
+class FEvent;
+
+/** One extra tracker: source, ring, filters and running statistics */
+struct FBeamTrackerPipeline
+{
+	FBeamTrackerPipeline(int32 InId, FName InName, EBeamDataSourceType InSourceType, IBeamDataSource* InSource);
+	~FBeamTrackerPipeline();
+
+	const int32 Id;
+	const FName Name;
+	const EBeamDataSourceType SourceType;
+
+	/** Owned; only touched by this tracker's task once the tracker is registered */
+	TUniquePtr<IBeamDataSource> Source;
+
+	/** Filtered frames; any thread may read it while the pipeline is alive */
+	FBeamFrameRing Ring;
+
+	/** Owned by the running task, like the primary producer owns its filters */
+	FBeamFilters Filters;
+
+	/** Task servicing this tracker; at most one is in flight, written by the pump under the registry lock */
+	UE::Tasks::FTask Task;
+	std::atomic<bool> bTaskInFlight{ false };
+
+	/** Source initialization runs in the first task so a slow connect never stalls the caller */
+	std::atomic<bool> bSourceReady{ false };
+	std::atomic<bool> bSourceFailed{ false };
+
+	/** Task-local state, carried between tasks of the same tracker */
+	int64 LastFrameId = INDEX_NONE;
+	double LastSDKTimestampMs = 0.0;
+	uint32 AppliedSettingsVersion = 0;
+
+	/** Statistics written by the task, read from any thread */
+	std::atomic<uint64> FramesPublished{ 0 };
+	std::atomic<uint64> SourceDropped{ 0 };
+	std::atomic<float> TrackerHz{ 0.0f };
+	std::atomic<float> MeanGazeConfidence{ 0.0f };
+	std::atomic<double> LastPublishSeconds{ 0.0 };
+
+	/** Snapshot of the statistics above */
+	FBeamTrackerStats GetStats() const;
+};
+
+using FBeamTrackerPipelinePtr = TSharedPtr<FBeamTrackerPipeline, ESPMode::ThreadSafe>;
+
+/**
+ * Registry of the extra trackers and the pump that services them.
+ *
+ * Ids start at 1; 0 is reserved for the subsystem's primary pipeline.
+ * Add and Remove are game-thread calls; Find and the returned pipeline
+ * may be used from any thread. Removing a tracker waits for its task to
+ * finish, then shuts its source down, so nothing reads a freed source.
+ */
+class FBeamTrackerRegistry : public FRunnable
+{
+public:
+	/** Id of the subsystem's own pipeline, which the registry never hands out */
+	static constexpr int32 PrimaryTrackerId = 0;
+
+	/** Wake interval of the pump; a tracker's task drains every frame that arrived since, so this only bounds latency */
+	static constexpr uint32 PumpIntervalMs = 2;
+
+	/** Frames one task drains before yielding its worker, so a flooding source cannot hold the pool */
+	static constexpr int32 MaxFramesPerTask = 64;
+
+	FBeamTrackerRegistry();
+	virtual ~FBeamTrackerRegistry() override;
+
+	/** Takes ownership of Source and starts servicing it; the pump thread starts with the first tracker (game thread) */
+	int32 Add(FName Name, EBeamDataSourceType SourceType, IBeamDataSource* Source);
+
+	/** Stops servicing the tracker and shuts its source down; false for unknown ids (game thread) */
+	bool Remove(int32 TrackerId);
+
+	/** Pipeline for TrackerId, or null; keeps the pipeline alive while held */
+	FBeamTrackerPipelinePtr Find(int32 TrackerId) const;
+
+	/** Ids of every registered tracker, in the order they were added */
+	void GetIds(TArray<int32>& OutIds) const;
+
+	int32 Num() const;
+
+	/** Picked up by each tracker's task before its next batch of frames */
+	void SetRuntimeSettings(const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe>& Snapshot);
+
+	/** Stops the pump, waits for in-flight tasks and shuts every source down (game thread) */
+	void Shutdown();
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	/** Drains, filters and publishes the frames available on one tracker; runs on a pool worker */
+	void ServiceTracker(FBeamTrackerPipeline& Pipeline);
+
+	/** Launches a task for every tracker whose previous task has finished (pump thread) */
+	void LaunchTasks();
+
+	void StopPump();
+
+	mutable FCriticalSection Lock;
+	TArray<FBeamTrackerPipelinePtr> Pipelines;
+	int32 NextId = PrimaryTrackerId + 1;
+
+	/** Current settings snapshot; tasks compare the version before fetching the pointer */
+	TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> RuntimeSettings;
+	mutable FCriticalSection SettingsLock;
+	std::atomic<uint32> SettingsVersion{ 0 };
+
+	FRunnableThread* PumpThread = nullptr;
+	FEvent* PumpWakeEvent = nullptr;
+	std::atomic<bool> bStopPump{ false };
+};
+
+/*=============================================================================
+    End of BeamTrackerRegistry.h
+=============================================================================*/
@@ -0,0 +1,220 @@
+// Implements the viewport registry mapping primary-viewport gaze into every registered viewport
+
+#include "BeamViewportMapping.h"
+#include "Slate/SceneViewport.h"
+#include "Widgets/SViewport.h"
+
+int32 FBeamViewportRegistry::Register(FSceneViewport* Viewport)
+{
+	if (!Viewport)
+	{
+		return InvalidId;
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	for (const FEntry& Entry : Entries)
+	{
+		if (Entry.Viewport == Viewport)
+		{
+			return Entry.Id;
+		}
+	}
+
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Id = NextId++;
+	Entry.Viewport = Viewport;
+	ReadRect(Viewport, Entry.OriginPx, Entry.SizePx);
+
+	if (PrimaryId == InvalidId)
+	{
+		PrimaryId = Entry.Id;
+		UpdateAllTransforms();
+	}
+	else
+	{
+		UpdateTransform(Entry);
+	}
+	return Entry.Id;
+}
+
+void FBeamViewportRegistry::Unregister(int32 ViewportId)
+{
+	FWriteScopeLock WriteLock(Lock);
+	Entries.RemoveAll([ViewportId](const FEntry& Entry) { return Entry.Id == ViewportId; });
+	if (PrimaryId == ViewportId)
+	{
+		PrimaryId = Entries.Num() > 0 ? Entries[0].Id : InvalidId;
+		UpdateAllTransforms();
+	}
+}
+
+void FBeamViewportRegistry::Unregister(const FSceneViewport* Viewport)
+{
+	const int32 ViewportId = FindId(Viewport);
+	if (ViewportId != InvalidId)
+	{
+		Unregister(ViewportId);
+	}
+}
+
+bool FBeamViewportRegistry::SetPrimary(int32 ViewportId)
+{
+	FWriteScopeLock WriteLock(Lock);
+	if (!FindEntry(ViewportId))
+	{
+		return false;
+	}
+	if (PrimaryId != ViewportId)
+	{
+		PrimaryId = ViewportId;
+		UpdateAllTransforms();
+	}
+	return true;
+}
+
+int32 FBeamViewportRegistry::GetPrimaryId() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return PrimaryId;
+}
+
+bool FBeamViewportRegistry::Refresh()
+{
+	FWriteScopeLock WriteLock(Lock);
+	bool bPrimaryChanged = false;
+	bool bAnyChanged = false;
+	for (FEntry& Entry : Entries)
+	{
+		FIntPoint OriginPx;
+		FIntPoint SizePx;
+		if (ReadRect(Entry.Viewport, OriginPx, SizePx) && (OriginPx != Entry.OriginPx || SizePx != Entry.SizePx))
+		{
+			Entry.OriginPx = OriginPx;
+			Entry.SizePx = SizePx;
+			bAnyChanged = true;
+			bPrimaryChanged |= Entry.Id == PrimaryId;
+		}
+	}
+
+	// Nothing moved: the common case costs a rectangle read per viewport and no transform math
+	if (bAnyChanged)
+	{
+		UpdateAllTransforms();
+	}
+	return bPrimaryChanged;
+}
+
+bool FBeamViewportRegistry::Refresh(const FSceneViewport* Viewport)
+{
+	FWriteScopeLock WriteLock(Lock);
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.Viewport != Viewport)
+		{
+			continue;
+		}
+
+		FIntPoint OriginPx;
+		FIntPoint SizePx;
+		if (!ReadRect(Viewport, OriginPx, SizePx) || (OriginPx == Entry.OriginPx && SizePx == Entry.SizePx))
+		{
+			return false;
+		}
+
+		Entry.OriginPx = OriginPx;
+		Entry.SizePx = SizePx;
+		if (Entry.Id == PrimaryId)
+		{
+			UpdateAllTransforms();
+			return true;
+		}
+		UpdateTransform(Entry);
+		return false;
+	}
+	return false;
+}
+
+bool FBeamViewportRegistry::MapToViewport(int32 ViewportId, const FVector2D& PrimaryScreen01, FVector2D& OutScreen01) const
+{
+	FReadScopeLock ReadLock(Lock);
+	const FEntry* Entry = FindEntry(ViewportId);
+	if (!Entry || Entry->SizePx.X <= 0 || Entry->SizePx.Y <= 0)
+	{
+		return false;
+	}
+
+	OutScreen01 = PrimaryScreen01 * Entry->Scale + Entry->Offset;
+	return true;
+}
+
+bool FBeamViewportRegistry::GetRect(int32 ViewportId, FIntPoint& OutOriginPx, FIntPoint& OutSizePx) const
+{
+	FReadScopeLock ReadLock(Lock);
+	const FEntry* Entry = FindEntry(ViewportId);
+	if (!Entry || Entry->SizePx.X <= 0 || Entry->SizePx.Y <= 0)
+	{
+		return false;
+	}
+
+	OutOriginPx = Entry->OriginPx;
+	OutSizePx = Entry->SizePx;
+	return true;
+}
+
+int32 FBeamViewportRegistry::FindId(const FSceneViewport* Viewport) const
+{
+	FReadScopeLock ReadLock(Lock);
+	const FEntry* Entry = Entries.FindByPredicate([Viewport](const FEntry& Candidate) { return Candidate.Viewport == Viewport; });
+	return Entry ? Entry->Id : InvalidId;
+}
+
+int32 FBeamViewportRegistry::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Entries.Num();
+}
+
+bool FBeamViewportRegistry::ReadRect(const FSceneViewport* Viewport, FIntPoint& OutOriginPx, FIntPoint& OutSizePx)
+{
+	const FIntPoint SizePx = Viewport ? Viewport->GetSizeXY() : FIntPoint::ZeroValue;
+	if (SizePx.X <= 0 || SizePx.Y <= 0)
+	{
+		return false;
+	}
+
+	// Slate absolute space is desktop pixels, the same unified screen space the SDK reports gaze in
+	const TSharedPtr<SViewport> Widget = Viewport->GetViewportWidget().Pin();
+	const FVector2D Origin = Widget.IsValid() ? FVector2D(Widget->GetCachedGeometry().GetAbsolutePosition()) : FVector2D::ZeroVector;
+	OutOriginPx = FIntPoint(FMath::RoundToInt(Origin.X), FMath::RoundToInt(Origin.Y));
+	OutSizePx = SizePx;
+	return true;
+}
+
+void FBeamViewportRegistry::UpdateTransform(FEntry& Entry) const
+{
+	const FEntry* Primary = FindEntry(PrimaryId);
+	if (!Primary || Primary->SizePx.X <= 0 || Primary->SizePx.Y <= 0 || Entry.SizePx.X <= 0 || Entry.SizePx.Y <= 0)
+	{
+		Entry.Scale = FVector2D::UnitVector;
+		Entry.Offset = FVector2D::ZeroVector;
+		return;
+	}
+
+	// Desktop = PrimaryOrigin + PrimaryScreen01 * PrimarySize; Screen01 = (Desktop - Origin) / Size
+	const FVector2D InvSize(1.0 / Entry.SizePx.X, 1.0 / Entry.SizePx.Y);
+	Entry.Scale = FVector2D(Primary->SizePx) * InvSize;
+	Entry.Offset = FVector2D(Primary->OriginPx - Entry.OriginPx) * InvSize;
+}
+
+void FBeamViewportRegistry::UpdateAllTransforms()
+{
+	for (FEntry& Entry : Entries)
+	{
+		UpdateTransform(Entry);
+	}
+}
+
+const FBeamViewportRegistry::FEntry* FBeamViewportRegistry::FindEntry(int32 ViewportId) const
+{
+	return Entries.FindByPredicate([ViewportId](const FEntry& Entry) { return Entry.Id == ViewportId; });
+}
@@ -0,0 +1,87 @@
+/*=============================================================================
+    BeamViewportMapping.h: Gaze mapping for several registered viewports.
+
+    The SDK normalizes gaze against a single viewport rectangle on the
+    unified desktop, the primary. Every other registered viewport (extra
+    monitors, PIE windows) keeps a cached affine transform from primary
+    Screen01 to its own Screen01, rebuilt only when a viewport rectangle
+    actually changes, so consumers map a sample with one multiply-add.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+class FSceneViewport;
+
+/** Desktop rectangles of registered viewports and the cached primary-to-viewport gaze transforms */
+class FBeamViewportRegistry
+{
+public:
+	static constexpr int32 InvalidId = INDEX_NONE;
+
+	/** Adds Viewport; the first one becomes primary. Returns its id, or the existing id when already registered */
+	int32 Register(FSceneViewport* Viewport);
+
+	/** Removes the viewport; if it was primary, the oldest remaining one takes over */
+	void Unregister(int32 ViewportId);
+	void Unregister(const FSceneViewport* Viewport);
+
+	/** Makes ViewportId the rectangle the SDK normalizes gaze against */
+	bool SetPrimary(int32 ViewportId);
+	int32 GetPrimaryId() const;
+
+	/** Re-reads every viewport's desktop rectangle; true when the primary rectangle changed */
+	bool Refresh();
+
+	/** Re-reads one viewport after a resize event; true when it is the primary and its rectangle changed */
+	bool Refresh(const FSceneViewport* Viewport);
+
+	/** Maps a primary Screen01 sample into ViewportId's Screen01; values outside 0..1 are off that viewport */
+	bool MapToViewport(int32 ViewportId, const FVector2D& PrimaryScreen01, FVector2D& OutScreen01) const;
+
+	/** Desktop rectangle of a viewport in pixels */
+	bool GetRect(int32 ViewportId, FIntPoint& OutOriginPx, FIntPoint& OutSizePx) const;
+
+	/** Id of a registered viewport, InvalidId otherwise */
+	int32 FindId(const FSceneViewport* Viewport) const;
+
+	int32 Num() const;
+
+private:
+	struct FEntry
+	{
+		int32 Id = InvalidId;
+		FSceneViewport* Viewport = nullptr;
+		FIntPoint OriginPx = FIntPoint::ZeroValue;
+		FIntPoint SizePx = FIntPoint::ZeroValue;
+
+		/** Screen01 = PrimaryScreen01 * Scale + Offset */
+		FVector2D Scale = FVector2D::UnitVector;
+		FVector2D Offset = FVector2D::ZeroVector;
+	};
+
+	/** Reads Viewport's rectangle from its widget; false when the viewport has no usable size yet */
+	static bool ReadRect(const FSceneViewport* Viewport, FIntPoint& OutOriginPx, FIntPoint& OutSizePx);
+
+	/** Recomputes Entry's transform against the primary rectangle */
+	void UpdateTransform(FEntry& Entry) const;
+	void UpdateAllTransforms();
+
+	const FEntry* FindEntry(int32 ViewportId) const;
+
+	/** Game thread writes on register and geometry change; any thread maps */
+	mutable FRWLock Lock;
+	TArray<FEntry, TInlineAllocator<4>> Entries;
+	int32 PrimaryId = InvalidId;
+	int32 NextId = 0;
+};
+
+/*=============================================================================
+    End of BeamViewportMapping.h
+=============================================================================*/
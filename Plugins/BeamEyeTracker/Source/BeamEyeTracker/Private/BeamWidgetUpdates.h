@@ -0,0 +1,75 @@
+/*=============================================================================
+    BeamWidgetUpdates.h: Invalidation-friendly helpers for Beam UMG widgets.
+
+    Small helpers shared by the gaze widget and the debug HUD. Property
+    setters run only when the value actually changes, and the widget tree can
+    be cached in an SInvalidationPanel, so an overlay left on costs a render
+    transform update per frame instead of a layout pass.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/TextBlock.h"
+#include "Components/Widget.h"
+#include "Widgets/SInvalidationPanel.h"
+
+namespace BeamWidgetUpdates
+{
+	/** Sets Text only when NewString differs from the last string shown; returns true if it was set */
+	inline bool SetTextIfChanged(UTextBlock* Text, FString&& NewString, FString& LastString)
+	{
+		if (!Text || NewString.Equals(LastString, ESearchCase::CaseSensitive))
+		{
+			return false;
+		}
+		LastString = MoveTemp(NewString);
+		Text->SetText(FText::FromString(LastString));
+		return true;
+	}
+
+	/** Visibility changes invalidate layout, so skip the ones that change nothing */
+	inline void SetVisibilityIfChanged(UWidget* Widget, ESlateVisibility Visibility)
+	{
+		if (Widget && Widget->GetVisibility() != Visibility)
+		{
+			Widget->SetVisibility(Visibility);
+		}
+	}
+
+	/** Shows or hides a moving widget through render opacity, which only invalidates paint */
+	inline void SetShownByOpacity(UWidget* Widget, bool bShown)
+	{
+		const float Opacity = bShown ? 1.0f : 0.0f;
+		if (Widget && Widget->GetRenderOpacity() != Opacity)
+		{
+			Widget->SetRenderOpacity(Opacity);
+		}
+	}
+
+	/** Moves a widget by render transform only; its layout slot never changes */
+	inline void SetTranslationIfChanged(UWidget* Widget, const FVector2D& Translation)
+	{
+		if (Widget && !Widget->GetRenderTransform().Translation.Equals(Translation, 0.1))
+		{
+			Widget->SetRenderTranslation(Translation);
+		}
+	}
+
+	/** Caches Content so only widgets that invalidated themselves are repainted */
+	inline TSharedRef<SWidget> WrapInInvalidationPanel(const TSharedRef<SWidget>& Content)
+	{
+		return SNew(SInvalidationPanel)
+			[
+				Content
+			];
+	}
+}
+
+/*=============================================================================
+    End of BeamWidgetUpdates.h
+=============================================================================*/
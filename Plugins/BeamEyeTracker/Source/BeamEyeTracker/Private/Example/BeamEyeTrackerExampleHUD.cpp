@@ -18,6 +18,7 @@
 #include "Engine/GameViewportClient.h"
 #include "Engine/Canvas.h"
 #include "CanvasItem.h"
+#include "BeamDebugOverlay.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "Misc/App.h"
 
@@ -57,28 +58,38 @@ void ABeamEyeTrackerExampleHUD::DrawHUD()
 {
 	Super::DrawHUD();
 
+	// Queued into the overlay's batch when it is registered, else drawn here in the same single pass
+	static FBeamDebugBatch LocalBatch;
+	const bool bOverlayFlushes = GBeamDebugOverlay.IsActive();
+	FBeamDebugBatch& Batch = bOverlayFlushes ? GBeamDebugOverlay.GetFrameBatch() : LocalBatch;
+
 	// Draw status panel
 	if (bShowStatusPanel)
 	{
-		DrawStatusPanel();
+		DrawStatusPanel(Batch);
 	}
 
 	// Draw gaze crosshair
 	if (bShowGazeCrosshair)
 	{
-		DrawGazeCrosshair();
+		DrawGazeCrosshair(Batch);
 	}
 
 	// Draw gaze trail
 	if (bShowGazeTrail)
 	{
-		DrawGazeTrail();
+		DrawGazeTrail(Batch);
 	}
 
 	// Draw performance metrics
 	if (bShowPerformanceMetrics)
 	{
-		DrawPerformanceMetrics();
+		DrawPerformanceMetrics(Batch);
+	}
+
+	if (!bOverlayFlushes)
+	{
+		LocalBatch.Flush(Canvas ? Canvas->Canvas : nullptr);
 	}
 }
 
@@ -116,201 +127,111 @@ void ABeamEyeTrackerExampleHUD::UpdateHUDData()
 				CurrentGazePoint.Screen01.Y * ViewportSize.Y
 			);
 
-			// Add to trail
-			GazeTrailPoints.Add(ScreenPos);
-
-			// Limit trail length
-			if (GazeTrailPoints.Num() > MaxTrailPoints)
-			{
-				GazeTrailPoints.RemoveAt(0);
-			}
+			// Add to trail; the ring overwrites the oldest point once full
+			GazeTrail.SetCapacity(MaxTrailPoints);
+			GazeTrail.AddPoint(ScreenPos);
 		}
 	}
 }
 
 // Drawing Functions
 
-void ABeamEyeTrackerExampleHUD::DrawStatusPanel()
+void ABeamEyeTrackerExampleHUD::DrawStatusPanel(FBeamDebugBatch& Batch)
 {
-	if (!Canvas)
-	{
-		return;
-	}
-
 	// Draw background panel
-	FCanvasBoxItem BackgroundBox(StatusPanelPosition, StatusPanelSize);
-	BackgroundBox.SetColor(FLinearColor(0.0f, 0.0f, 0.0f, 0.7f));
-	Canvas->DrawItem(BackgroundBox);
-
-	FCanvasTextItem TextItem(FVector2D::ZeroVector, FText::GetEmpty(), GEngine->GetLargeFont(), FLinearColor::White);
-	TextItem.Scale = FVector2D(0.8f, 0.8f);
+	Batch.AddBox(StatusPanelPosition, StatusPanelSize, FLinearColor(0.0f, 0.0f, 0.0f, 0.7f));
 
 	// Draw title
-	TextItem.Text = FText::FromString(TEXT("Beam Eye Tracker Status"));
-	TextItem.SetColor(FLinearColor::Yellow);
-	Canvas->DrawItem(TextItem, StatusPanelPosition + FVector2D(10.0f, 10.0f));
+	Batch.AddText(StatusPanelPosition + FVector2D(10.0f, 10.0f), FText::FromString(TEXT("Beam Eye Tracker Status")), FLinearColor::Yellow);
 
 	// Draw status information
 	float YOffset = StatusPanelPosition.Y + 40.0f;
 	const float LineHeight = 20.0f;
 
 	// Tracking status
-	FString StatusText = GetTrackingStatusString();
-	TextItem.Text = FText::FromString(StatusText);
-	TextItem.SetColor(GetTrackingStatusColor());
-	Canvas->DrawItem(TextItem, FVector2D(StatusPanelPosition.X + 10.0f, YOffset));
+	Batch.AddText(FVector2D(StatusPanelPosition.X + 10.0f, YOffset), FText::FromString(GetTrackingStatusString()), GetTrackingStatusColor());
 	YOffset += LineHeight;
 
 	// Health status
 	FString HealthText = FString::Printf(TEXT("Health: %s"), *GetHealthStatusString(CurrentHealth));
-	TextItem.Text = FText::FromString(HealthText);
-	TextItem.SetColor(GetHealthColor(CurrentHealth));
-	Canvas->DrawItem(TextItem, FVector2D(StatusPanelPosition.X + 10.0f, YOffset));
+	Batch.AddText(FVector2D(StatusPanelPosition.X + 10.0f, YOffset), FText::FromString(HealthText), GetHealthColor(CurrentHealth));
 	YOffset += LineHeight;
 
 	// FPS
 	FString FPSText = FString::Printf(TEXT("FPS: %.1f Hz"), CurrentFPS);
-	TextItem.Text = FText::FromString(FPSText);
-	TextItem.SetColor(FLinearColor::White);
-	Canvas->DrawItem(TextItem, FVector2D(StatusPanelPosition.X + 10.0f, YOffset));
+	Batch.AddText(FVector2D(StatusPanelPosition.X + 10.0f, YOffset), FText::FromString(FPSText), FLinearColor::White);
 	YOffset += LineHeight;
 
 	// Buffer utilization
 	FString BufferText = FString::Printf(TEXT("Buffer: %.1f%%"), CurrentBufferUtilization * 100.0f);
-	TextItem.Text = FText::FromString(BufferText);
-	TextItem.SetColor(FLinearColor::White);
-	Canvas->DrawItem(TextItem, FVector2D(StatusPanelPosition.X + 10.0f, YOffset));
+	Batch.AddText(FVector2D(StatusPanelPosition.X + 10.0f, YOffset), FText::FromString(BufferText), FLinearColor::White);
 	YOffset += LineHeight;
 
 	// Recording status
 	if (bIsRecording)
 	{
-		TextItem.Text = FText::FromString(TEXT("Recording: ACTIVE"));
-		TextItem.SetColor(FLinearColor::Red);
-		Canvas->DrawItem(TextItem, FVector2D(StatusPanelPosition.X + 10.0f, YOffset));
+		Batch.AddText(FVector2D(StatusPanelPosition.X + 10.0f, YOffset), FText::FromString(TEXT("Recording: ACTIVE")), FLinearColor::Red);
 		YOffset += LineHeight;
 	}
 
 	// Playback status
 	if (bIsPlayingBack)
 	{
-		TextItem.Text = FText::FromString(TEXT("Playback: ACTIVE"));
-		TextItem.SetColor(FLinearColor::Blue);
-		Canvas->DrawItem(TextItem, FVector2D(StatusPanelPosition.X + 10.0f, YOffset));
+		Batch.AddText(FVector2D(StatusPanelPosition.X + 10.0f, YOffset), FText::FromString(TEXT("Playback: ACTIVE")), FLinearColor::Blue);
 		YOffset += LineHeight;
 	}
 }
 
-void ABeamEyeTrackerExampleHUD::DrawGazeCrosshair()
+void ABeamEyeTrackerExampleHUD::DrawGazeCrosshair(FBeamDebugBatch& Batch)
 {
 	if (!Canvas || !CurrentGazePoint.bValid)
 	{
 		return;
 	}
 
-	FVector2D ViewportSize;
-	if (GEngine && GEngine->GameViewport)
-	{
-		GEngine->GameViewport->GetViewportSize(ViewportSize);
-	}
-	else
-	{
-		ViewportSize = FVector2D(1920.0f, 1080.0f);
-	}
-
 	// Convert normalized coordinates to screen coordinates
-	const float ScreenX = CurrentGazePoint.Screen01.X * ViewportSize.X;
-	const float ScreenY = CurrentGazePoint.Screen01.Y * ViewportSize.Y;
+	const FVector2D ScreenPos(CurrentGazePoint.Screen01.X * Canvas->ClipX, CurrentGazePoint.Screen01.Y * Canvas->ClipY);
 
 	// Draw crosshair
 	const float CrosshairSize = 20.0f;
 	const float LineThickness = 2.0f;
 	const FLinearColor CrosshairColor = FLinearColor::Red;
+	Batch.AddCrosshair(ScreenPos, CrosshairSize, CrosshairColor, LineThickness);
 
-	// Draw horizontal line
-	FCanvasLineItem LineItem1(FVector2D(ScreenX - CrosshairSize, ScreenY), FVector2D(ScreenX + CrosshairSize, ScreenY));
-	LineItem1.SetColor(CrosshairColor);
-	LineItem1.LineThickness = LineThickness;
-	Canvas->DrawItem(LineItem1);
-
-	// Draw vertical line
-	FCanvasLineItem LineItem2(FVector2D(ScreenX, ScreenY - CrosshairSize), FVector2D(ScreenX, ScreenY + CrosshairSize));
-	LineItem2.SetColor(CrosshairColor);
-	LineItem2.LineThickness = LineThickness;
-	Canvas->DrawItem(LineItem2);
-
-	// Draw confidence circle (simplified as a box for now)
-	FCanvasBoxItem CircleItem(FVector2D(ScreenX - CrosshairSize * 0.3f, ScreenY - CrosshairSize * 0.3f), 
-		FVector2D(CrosshairSize * 0.6f, CrosshairSize * 0.6f));
-	CircleItem.SetColor(CrosshairColor);
-	Canvas->DrawItem(CircleItem);
+	// Draw confidence marker
+	Batch.AddBox(ScreenPos - FVector2D(CrosshairSize * 0.3f), FVector2D(CrosshairSize * 0.6f), CrosshairColor.CopyWithNewOpacity(0.5f));
 }
 
-void ABeamEyeTrackerExampleHUD::DrawGazeTrail()
+void ABeamEyeTrackerExampleHUD::DrawGazeTrail(FBeamDebugBatch& Batch)
 {
-	if (!Canvas || GazeTrailPoints.Num() < 2)
-	{
-		return;
-	}
-
-	// Draw trail segments
-	for (int32 i = 1; i < GazeTrailPoints.Num(); ++i)
-	{
-		const float Alpha = 1.0f - (float)i / GazeTrailPoints.Num();
-		const FVector2D Start = GazeTrailPoints[i - 1];
-		const FVector2D End = GazeTrailPoints[i];
-		
-		FCanvasLineItem LineItem(Start, End);
-		LineItem.SetColor(FLinearColor(1.0f, 1.0f, 1.0f, Alpha));
-		LineItem.LineThickness = 2.0f * Alpha;
-		Canvas->DrawItem(LineItem);
-	}
+	// Fades and thins toward the oldest point
+	Batch.AddTrail(GazeTrail, FLinearColor::White, 2.0f);
 }
 
-void ABeamEyeTrackerExampleHUD::DrawPerformanceMetrics()
+void ABeamEyeTrackerExampleHUD::DrawPerformanceMetrics(FBeamDebugBatch& Batch)
 {
 	if (!Canvas)
 	{
 		return;
 	}
 
-	FVector2D ViewportSize;
-	if (GEngine && GEngine->GameViewport)
-	{
-		GEngine->GameViewport->GetViewportSize(ViewportSize);
-	}
-	else
-	{
-		ViewportSize = FVector2D(1920.0f, 1080.0f);
-	}
-
 	// Draw performance metrics in top-right corner
-	FCanvasTextItem TextItem(FVector2D::ZeroVector, FText::GetEmpty(), GEngine->GetMediumFont(), FLinearColor::White);
-	TextItem.Scale = FVector2D(0.6f, 0.6f);
-
-	FVector2D MetricsPosition = FVector2D(ViewportSize.X - 200.0f, 20.0f);
+	FVector2D MetricsPosition = FVector2D(Canvas->ClipX - 200.0f, 20.0f);
 	float YOffset = MetricsPosition.Y;
 	const float LineHeight = 16.0f;
 
 	// Frame time
 	float FrameTime = 1.0f / FMath::Max(CurrentFPS, 1.0f);
 	FString FrameTimeText = FString::Printf(TEXT("Frame: %.2f ms"), FrameTime * 1000.0f);
-	TextItem.Text = FText::FromString(FrameTimeText);
-	TextItem.SetColor(FLinearColor::White);
-	Canvas->DrawItem(TextItem, FVector2D(MetricsPosition.X, YOffset));
+	Batch.AddText(FVector2D(MetricsPosition.X, YOffset), FText::FromString(FrameTimeText), FLinearColor::White);
 	YOffset += LineHeight;
 
 	// Memory usage (placeholder)
-	FString MemoryText = TEXT("Memory: N/A");
-	TextItem.Text = FText::FromString(MemoryText);
-	TextItem.SetColor(FLinearColor::White);
-	Canvas->DrawItem(TextItem, FVector2D(MetricsPosition.X, YOffset));
+	Batch.AddText(FVector2D(MetricsPosition.X, YOffset), FText::FromString(TEXT("Memory: N/A")), FLinearColor::White);
 	YOffset += LineHeight;
 
 	FString UpdateRateText = FString::Printf(TEXT("Update: %.1f Hz"), 1.0f / HUDUpdateInterval);
-	TextItem.Text = FText::FromString(UpdateRateText);
-	TextItem.SetColor(FLinearColor::White);
-	Canvas->DrawItem(TextItem, FVector2D(MetricsPosition.X, YOffset));
+	Batch.AddText(FVector2D(MetricsPosition.X, YOffset), FText::FromString(UpdateRateText), FLinearColor::White);
 }
 
 // Utility Functions
@@ -15,11 +15,23 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "BeamEyeTrackerTypes.h"
+#include "BeamSessionArena.h"
+#include "Containers/Ticker.h"
 #include "BeamAnalyticsSubsystem.generated.h"
 
 class UBeamEyeTrackerSubsystem;
-
-/** Advanced Analytics Subsystem for Beam Eye Tracker */
+class FBeamAnalyticsWorker;
+struct FBeamAnalyticsWorkerConfig;
+
+/**
+ * Advanced Analytics Subsystem for Beam Eye Tracker.
+ *
+ * Gaze analytics are computed by a background worker that follows the
+ * tracking ring; a core ticker applies its newest snapshot on the game
+ * thread and fires the Blueprint events as notifications. Every event
+ * fired is also kept in a session log allocated from a per-session
+ * arena, which ResetGazeAnalytics rewinds in constant time.
+ */
 UCLASS(DisplayName = "Beam Analytics Subsystem")
 class BEAMEYETRACKER_API UBeamAnalyticsSubsystem : public UGameInstanceSubsystem
 {
@@ -45,6 +57,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Beam|Analytics", meta = (DisplayName = "Reset Gaze Analytics", ToolTip = "Clear all collected gaze analytics data"))
     void ResetGazeAnalytics();
 
+    /** Fixations and saccades fired through OnGazeEvent since analytics were started or reset */
+    UFUNCTION(BlueprintPure, Category = "Beam|Analytics", meta = (DisplayName = "Get Session Gaze Event Count"))
+    int32 GetSessionGazeEventCount() const { return SessionEvents.Num(); }
+
     // Calibration Quality
     UFUNCTION(BlueprintCallable, Category = "Beam|Calibration", meta = (DisplayName = "Get Calibration Quality", ToolTip = "Get current calibration quality assessment"))
     FCalibrationQuality GetCalibrationQuality() const;
@@ -52,6 +68,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Beam|Calibration", meta = (DisplayName = "Assess Calibration", ToolTip = "Perform a comprehensive calibration assessment"))
     void AssessCalibration();
 
+    /** Publishes a measured assessment (see FBeamCalibrationValidator); AssessCalibration reports it from then on */
+    UFUNCTION(BlueprintCallable, Category = "Beam|Calibration", meta = (DisplayName = "Set Calibration Quality", ToolTip = "Publish a measured calibration assessment"))
+    void SetCalibrationQuality(const FCalibrationQuality& Quality);
+
     UFUNCTION(BlueprintCallable, Category = "Beam|Calibration", meta = (DisplayName = "Get Calibration Score", ToolTip = "Get overall calibration quality score (0-100)"))
     float GetCalibrationScore() const;
 
@@ -68,13 +88,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Beam|Performance", meta = (DisplayName = "Get Performance Score", ToolTip = "Get overall performance score (0-100)"))
     float GetPerformanceScore() const;
 
-    // Data Export
-    UFUNCTION(BlueprintCallable, Category = "Beam|Export", meta = (DisplayName = "Export Analytics Data", ToolTip = "Export analytics data to CSV file"))
+    // Data Export: each call snapshots the data, writes the file on a background task and returns whether the
+    // export started; OnExportFinished reports whether the file was written
+    UFUNCTION(BlueprintCallable, Category = "Beam|Export", meta = (DisplayName = "Export Analytics Data", ToolTip = "Starts writing the current analytics to a CSV file on a background task; returns whether the export started, On Export Finished reports the result"))
     bool ExportAnalyticsData(const FString& FilePath);
 
-    UFUNCTION(BlueprintCallable, Category = "Beam|Export", meta = (DisplayName = "Export Performance Data", ToolTip = "Export performance data to CSV file"))
+    UFUNCTION(BlueprintCallable, Category = "Beam|Export", meta = (DisplayName = "Export Performance Data", ToolTip = "Starts writing the current performance metrics to a CSV file on a background task; returns whether the export started, On Export Finished reports the result"))
     bool ExportPerformanceData(const FString& FilePath);
 
+    /** Works after analytics stop, until the next start or reset */
+    UFUNCTION(BlueprintCallable, Category = "Beam|Export", meta = (DisplayName = "Export Gaze Events", ToolTip = "Starts writing the session's fixations and saccades to a CSV file on a background task; returns whether the export started, On Export Finished reports the result"))
+    bool ExportGazeEvents(const FString& FilePath);
+
     // Configuration
     UFUNCTION(BlueprintCallable, Category = "Beam|Config", meta = (DisplayName = "Set Analytics Settings", ToolTip = "Configure analytics collection settings"))
     void SetAnalyticsSettings(float SamplingRate, float MinFixationDuration, float MaxGapTime);
@@ -86,12 +111,18 @@ public:
     UFUNCTION(BlueprintImplementableEvent, Category = "Beam|Events", meta = (DisplayName = "On Analytics Updated", ToolTip = "Called when analytics data is updated"))
     void OnAnalyticsUpdated(const FGazeAnalytics& Analytics);
 
+    UFUNCTION(BlueprintImplementableEvent, Category = "Beam|Events", meta = (DisplayName = "On Gaze Event", ToolTip = "Called once for each fixation or saccade as it completes"))
+    void OnGazeEvent(const FBeamGazeEvent& Event);
+
     UFUNCTION(BlueprintImplementableEvent, Category = "Beam|Events", meta = (DisplayName = "On Calibration Assessed", ToolTip = "Called when calibration assessment is complete"))
     void OnCalibrationAssessed(const FCalibrationQuality& Quality);
 
     UFUNCTION(BlueprintImplementableEvent, Category = "Beam|Events", meta = (DisplayName = "On Performance Updated", ToolTip = "Called when performance metrics are updated"))
     void OnPerformanceUpdated(const FBeamPerformanceMetrics& Metrics);
 
+    UFUNCTION(BlueprintImplementableEvent, Category = "Beam|Events", meta = (DisplayName = "On Export Finished", ToolTip = "Called on the game thread when a background export started by this subsystem has finished writing FilePath"))
+    void OnExportFinished(const FString& FilePath, bool bSuccess);
+
 protected:
     // Blueprint events
     UFUNCTION(BlueprintImplementableEvent, Category = "Beam|Events", meta = (DisplayName = "On Analytics Started", ToolTip = "Called when analytics collection begins"))
@@ -110,6 +141,9 @@ private:
     UPROPERTY()
     UBeamEyeTrackerSubsystem* BeamSubsystem;
 
+    /** Completion handler for BeamExport::Launch that fires OnExportFinished while the subsystem is alive */
+    TUniqueFunction<void(bool)> MakeExportFinishedHandler(const FString& FilePath);
+
     // Analytics state
     bool bAnalyticsActive;
     bool bPerformanceMonitoringActive;
@@ -124,18 +158,31 @@ private:
     FCalibrationQuality CurrentCalibrationQuality;
     FBeamPerformanceMetrics CurrentPerformanceMetrics;
 
-    // Internal tracking
-    TArray<FVector2D> GazeHistory;
-    TArray<float> GazeTimestamps;
+    // Background analysis (10 second window), created while analytics are active
+    FBeamAnalyticsWorker* AnalyticsWorker = nullptr;
     float LastUpdateTime;
 
+    // Newest worker snapshot applied, and the id of the next gaze event to fire
+    uint64 LastSnapshotSequence = 0;
+    uint64 NextGazeEventId = 0;
+
+    // Worker reset generation of the last ResetGazeAnalytics; older snapshots are ignored
+    uint32 AnalyticsGeneration = 0;
+
+    // Session event log; its chunks live in SessionArena and both are rewound together
+    FBeamSessionArena SessionArena;
+    TBeamEventLog<FBeamGazeEvent> SessionEvents;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+
     // Helper functions
+    FBeamAnalyticsWorkerConfig MakeWorkerConfig() const;
+    void DestroyAnalyticsWorker();
+    void HandleFrameRingReleased();
+    void UpdateTicker();
+    bool Tick(float DeltaTime);
     void UpdateGazeAnalytics();
-    void UpdatePerformanceMetrics();
-    void CalculateFixations();
-    void CalculateSaccades();
-    float CalculateDistance(const FVector2D& Point1, const FVector2D& Point2);
-    void CleanupOldData();
+    void UpdatePerformanceMetrics(float DeltaTime);
 };
 
 /*=============================================================================
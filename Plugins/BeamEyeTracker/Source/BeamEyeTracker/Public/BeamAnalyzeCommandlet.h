@@ -0,0 +1,40 @@
+/*=============================================================================
+    BeamAnalyzeCommandlet.h: Bulk gaze analytics over a directory of recordings.
+
+    -run=BeamAnalyze -Input=<dir> [-Report=<file.csv>]
+                     [-SamplingRate=60] [-MinFixation=0.1] [-MinConfidence=0.5]
+
+    Every .beamrec under the input directory is one task: it memory-maps its
+    recording, streams the frames through its own incremental analyzer and
+    writes into its own result slot, so tasks share nothing and throughput
+    grows with the number of worker threads. Sessions are tagged with their
+    directory name and reported per session, per tag and overall.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BeamAnalyzeCommandlet.generated.h"
+
+/** Computes per-session and aggregate FGazeAnalytics and FCalibrationQuality for a directory of recordings in parallel */
+UCLASS()
+class UBeamAnalyzeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBeamAnalyzeCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
+
+/*=============================================================================
+    End of BeamAnalyzeCommandlet.h
+=============================================================================*/
@@ -0,0 +1,43 @@
+/*=============================================================================
+    BeamArchiveCommandlet.h: Packs recordings into a session archive and queries it.
+
+    Pack:   -run=BeamArchive -Input=<dir> -Output=<file.beamarc> [-Compression=Oodle|Zlib|None]
+    Query:  -run=BeamArchive -Archive=<file.beamarc> [-Tag=<tag>] [-StartMs=<ms>] [-EndMs=<ms>]
+            [-SamplingRate=60] [-MinFixation=0.1] [-MinConfidence=0.5] [-Report=<file.csv>]
+
+    Sessions are tagged with the name of the directory their recording sits
+    in, so a tree of per-level folders packs into per-level groups. A query
+    prints fixation and saccade statistics per tag.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BeamArchiveCommandlet.generated.h"
+
+/** Converts .beamrec recordings into a columnar session archive and runs per-tag gaze analytics over it */
+UCLASS()
+class UBeamArchiveCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBeamArchiveCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	int32 RunPack(const FString& Params);
+	int32 RunQuery(const FString& Params);
+};
+
+/*=============================================================================
+    End of BeamArchiveCommandlet.h
+=============================================================================*/
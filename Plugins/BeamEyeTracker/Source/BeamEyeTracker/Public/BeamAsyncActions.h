@@ -18,6 +18,7 @@
 #include "BeamAsyncActions.generated.h"
 
 class UBeamEyeTrackerSubsystem;
+class UBeamFocusSubsystem;
 
 /** Provides async Blueprint nodes for eye tracking operations */
 UCLASS()
@@ -54,14 +55,15 @@ private:
 	/** Last callback time to implement throttling */
 	double LastCallbackTime;
 	
-	/** Timer handle for polling */
-	FTimerHandle PollingTimerHandle;
+	/** Per-frame notification from the world's focus dispatcher */
+	TWeakObjectPtr<UBeamFocusSubsystem> FocusSubsystem;
+	FDelegateHandle NewFrameHandle;
 	
 	/** World context for getting subsystem */
 	UObject* WorldContext;
 	
-	/** Polling function called by timer */
-	void PollForValidGaze();
+	/** Called once per newly published tracker frame */
+	void HandleNewFrame(const FBeamFrame& Frame);
 	
 	/** Clean up timer and mark as completed */
 	void CompleteAction();
@@ -0,0 +1,98 @@
+/*=============================================================================
+    BeamAttentionMap.h: Sparse world-space gaze attention accumulator.
+
+    Bins gaze ray hits into a voxel hash and per-primitive totals so that
+    attention from any number of sessions can be aggregated in bounded
+    memory, saved as a compact binary file and drawn in the level.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+class UPrimitiveComponent;
+
+/** Accumulated attention for one voxel or primitive */
+struct FBeamAttentionCell
+{
+	/** Sum of sample weights (confidence, or seconds when samples carry dwell time) */
+	float Weight = 0.0f;
+
+	/** Samples binned into the cell */
+	uint32 Count = 0;
+};
+
+/**
+ * Voxel hash of gaze hits.
+ *
+ * Memory is bounded by MaxCells: when a sample would create one cell too
+ * many, the voxel size doubles and existing cells are merged eight to one,
+ * so a session can add millions of samples and only lose spatial detail.
+ * Per-primitive totals are keyed by component path name, which is stable
+ * across sessions for placed actors, and are capped by MaxPrimitives;
+ * hits on further primitives are kept under NAME_None.
+ */
+class BEAMEYETRACKER_API FBeamAttentionMap
+{
+public:
+	explicit FBeamAttentionMap(float InVoxelSize = 25.0f, int32 InMaxCells = 1 << 18, int32 InMaxPrimitives = 1 << 14);
+
+	/** Bins one hit; Primitive may be null */
+	void AddSample(const FVector& WorldLocation, float Weight, const UPrimitiveComponent* Primitive);
+
+	/** Bins one hit attributed to a primitive by name */
+	void AddSample(const FVector& WorldLocation, float Weight, FName PrimitiveName);
+
+	/** Adds Other's cells and primitive totals; the coarser of the two voxel sizes wins */
+	void Merge(const FBeamAttentionMap& Other);
+
+	void Reset();
+
+	/** Writes the map as a compact binary file (.beamattn) */
+	bool SaveToFile(const FString& FilePath) const;
+
+	/** Replaces the map with a file written by SaveToFile */
+	bool LoadFromFile(const FString& FilePath);
+
+	/** Draws the MaxCellsToDraw heaviest voxels as boxes colored by relative weight */
+	void DrawDebug(UWorld* World, float Duration, int32 MaxCellsToDraw = 2048) const;
+
+	/** Primitive totals sorted by descending weight, at most MaxEntries */
+	void GetTopPrimitives(int32 MaxEntries, TArray<TPair<FName, FBeamAttentionCell>>& OutEntries) const;
+
+	float GetVoxelSize() const { return VoxelSize; }
+	int32 GetNumCells() const { return Cells.Num(); }
+	uint64 GetTotalSamples() const { return TotalSamples; }
+	const TMap<FIntVector, FBeamAttentionCell>& GetCells() const { return Cells; }
+
+	FVector GetCellCenter(const FIntVector& Key) const { return (FVector(Key) + 0.5) * VoxelSize; }
+
+private:
+	static constexpr uint32 FileMagic = 0x4E544142; // 'BATN'
+	static constexpr uint32 FileVersion = 1;
+
+	float VoxelSize;
+	int32 MaxCells;
+	int32 MaxPrimitives;
+	uint64 TotalSamples = 0;
+
+	TMap<FIntVector, FBeamAttentionCell> Cells;
+	TMap<FName, FBeamAttentionCell> Primitives;
+
+	FIntVector GetCellKey(const FVector& WorldLocation) const;
+
+	void AddToCell(const FIntVector& Key, float Weight, uint32 Count);
+	void AddToPrimitive(FName PrimitiveName, float Weight, uint32 Count);
+
+	/** Doubles the voxel size and merges cells accordingly */
+	void Coarsen();
+};
+
+/*=============================================================================
+    End of BeamAttentionMap.h
+=============================================================================*/
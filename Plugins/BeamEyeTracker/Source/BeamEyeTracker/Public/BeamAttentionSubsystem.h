@@ -0,0 +1,85 @@
+/*=============================================================================
+    BeamAttentionSubsystem.h: World-space gaze attention collection.
+
+    Owns the session's FBeamAttentionMap, accepts gaze hits and interactions
+    from gameplay code, and saves, merges and draws attention maps so level
+    designers can see which props players actually look at.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamAttentionMap.h"
+#include "Engine/HitResult.h"
+#include "BeamAttentionSubsystem.generated.h"
+
+/** Attention received by one primitive */
+USTRUCT(BlueprintType)
+struct BEAMEYETRACKER_API FBeamAttentionEntry
+{
+	GENERATED_BODY()
+
+	/** Component path name, stable across sessions for placed actors */
+	UPROPERTY(BlueprintReadOnly, Category = "Beam|Attention")
+	FString PrimitiveName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Beam|Attention")
+	float Weight = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Beam|Attention")
+	int32 Samples = 0;
+};
+
+/**
+ * Session attention map.
+ *
+ * Samples are binned as they arrive, so recording costs one hash lookup
+ * per hit and memory stays bounded however long the session runs. Saved
+ * sessions can be merged into one map and drawn with Beam.Attention.Draw,
+ * which also works in the editor without starting play.
+ */
+UCLASS(DisplayName = "Beam Attention Subsystem")
+class BEAMEYETRACKER_API UBeamAttentionSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Beam|Attention", meta = (DisplayName = "Record Gaze Interaction", ToolTip = "Bins a gaze interaction's world location, weighted by interaction time when set, else by confidence"))
+	void RecordGazeInteraction(const FGazeInteraction& Interaction);
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Attention", meta = (DisplayName = "Record Gaze Hit", ToolTip = "Bins a gaze trace hit weighted by confidence"))
+	void RecordGazeHit(const FHitResult& Hit, float Confidence = 1.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Attention", meta = (DisplayName = "Clear Attention Map"))
+	void ClearAttention();
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Attention", meta = (DisplayName = "Save Attention Map", ToolTip = "Writes the session attention map as a compact binary file"))
+	bool SaveAttention(const FString& FilePath) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Attention", meta = (DisplayName = "Merge Attention Map", ToolTip = "Adds a saved attention map into the session map"))
+	bool MergeAttention(const FString& FilePath);
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Attention", meta = (DisplayName = "Draw Attention Map", WorldContext = "WorldContextObject"))
+	void DrawAttention(const UObject* WorldContextObject, float Duration = 10.0f, int32 MaxCells = 2048) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Attention", meta = (DisplayName = "Get Most Attended Primitives"))
+	TArray<FBeamAttentionEntry> GetTopAttendedPrimitives(int32 MaxEntries = 20) const;
+
+	UFUNCTION(BlueprintPure, Category = "Beam|Attention", meta = (DisplayName = "Get Attention Sample Count"))
+	int64 GetAttentionSampleCount() const { return static_cast<int64>(AttentionMap.GetTotalSamples()); }
+
+	const FBeamAttentionMap& GetAttentionMap() const { return AttentionMap; }
+
+private:
+	FBeamAttentionMap AttentionMap;
+};
+
+/*=============================================================================
+    End of BeamAttentionSubsystem.h
+=============================================================================*/
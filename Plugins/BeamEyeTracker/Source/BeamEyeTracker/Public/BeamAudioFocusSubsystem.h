@@ -0,0 +1,123 @@
+/*=============================================================================
+    BeamAudioFocusSubsystem.h: Gaze-driven emphasis of audio emitters.
+
+    Registered audio components are scored once per frame from the gaze
+    target grid's projected bounds of their owners, and the smoothed score
+    is pushed to the component as a volume and low-pass offset and as a
+    float parameter MetaSounds and Sound Cues can read. Emitters no longer
+    need a per-actor gaze dot product of their own.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "BeamAudioFocusSubsystem.generated.h"
+
+class UAudioComponent;
+
+/**
+ * Per-world audio focus driver.
+ *
+ * Each tick resets every emitter's target focus, then walks only the
+ * on-screen targets of UBeamGazeTargetSubsystem's per-frame projection,
+ * so the gaze query itself does not grow with off-screen emitters. Focus
+ * eases towards its target and reaches the audio thread only when it
+ * moved by more than ApplyThreshold, so a still gaze sends no parameter
+ * updates at all. Attenuation assets are shared between emitters and are
+ * left as authored; focus multiplies into the component volume and
+ * low-pass, which the attenuation result is combined with.
+ */
+UCLASS()
+class BEAMEYETRACKER_API UBeamAudioFocusSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UTickableWorldSubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
+	/** Drives Component by gaze on its owner; the owner also becomes a gaze target so it is projected with the grid */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Audio", meta = (DisplayName = "Register Audio Focus Emitter"))
+	void RegisterEmitter(UAudioComponent* Component);
+
+	/** Restores the component's original volume and low-pass settings */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Audio", meta = (DisplayName = "Unregister Audio Focus Emitter"))
+	void UnregisterEmitter(UAudioComponent* Component);
+
+	/** Smoothed gaze focus last applied to Component, 0..1; 1 when it is not registered */
+	UFUNCTION(BlueprintPure, Category = "Beam|Audio", meta = (DisplayName = "Get Audio Focus"))
+	float GetAudioFocus(const UAudioComponent* Component) const;
+
+	int32 GetNumEmitters() const { return NumEmitters; }
+
+	/** Gaze distance, as a fraction of the view diagonal, at which focus has dropped to one half */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Audio", meta = (ClampMin = "0.01", ClampMax = "1.0"))
+	float GazeFalloff = 0.1f;
+
+	/** Volume multiplier of emitters with no focus; focused emitters keep their own volume */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Audio", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float UnfocusedVolume = 0.6f;
+
+	/** Low-pass cutoff of emitters with no focus; 0 leaves the low-pass filter alone */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Audio", meta = (ClampMin = "0.0", ClampMax = "20000.0", Units = "Hz"))
+	float UnfocusedLowPassHz = 4000.0f;
+
+	/** Float parameter set on each emitter with its focus, for MetaSounds and Sound Cues; None disables it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Audio")
+	FName FocusParameterName = TEXT("GazeFocus");
+
+	/** Seconds for focus to rise most of the way to its target; gaze arrives quickly */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Audio", meta = (ClampMin = "0.0", Units = "s"))
+	float AttackSeconds = 0.08f;
+
+	/** Seconds for focus to fall most of the way; longer than attack so saccades across a scene do not pump the mix */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Audio", meta = (ClampMin = "0.0", Units = "s"))
+	float ReleaseSeconds = 0.4f;
+
+	/** Smallest focus change pushed to an emitter */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Audio", meta = (ClampMin = "0.0", ClampMax = "0.2"))
+	float ApplyThreshold = 0.01f;
+
+private:
+	struct FFocusEmitter
+	{
+		TWeakObjectPtr<UAudioComponent> Component;
+		float OriginalVolume = 1.0f;
+		float OriginalLowPassHz = 20000.0f;
+		bool bOriginalLowPassEnabled = false;
+
+		/** Last value sent to the component; negative until the first update */
+		float AppliedFocus = -1.0f;
+	};
+
+	/** Emitters share their owner's projection, so focus is kept per owner */
+	struct FFocusActor
+	{
+		TArray<FFocusEmitter, TInlineAllocator<1>> Emitters;
+		float TargetFocus = 0.0f;
+		float Focus = 1.0f;
+		bool bRegisteredGazeTarget = false;
+	};
+
+	TMap<TObjectKey<AActor>, FFocusActor> Managed;
+	int32 NumEmitters = 0;
+
+	void UpdateTargetFocus();
+	void ApplyFocus(FFocusEmitter& Emitter, float Focus) const;
+	void Restore(const FFocusEmitter& Emitter) const;
+	void Release(const TObjectKey<AActor>& Owner, FFocusActor& Entry);
+};
+
+/*=============================================================================
+    End of BeamAudioFocusSubsystem.h
+=============================================================================*/
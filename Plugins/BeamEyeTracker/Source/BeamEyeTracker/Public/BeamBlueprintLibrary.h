@@ -14,11 +14,14 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/EngineTypes.h"
+#include "BeamEyeTrackerTypes.h"
 #include "BeamBlueprintLibrary.generated.h"
 
 class UObject;
 class UBeamEyeTrackerSubsystem;
 class AActor;
+class APlayerController;
 class UWidget;
 
 /** Enhanced Blueprint library for easy eye tracking integration */
@@ -63,15 +66,50 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Beam|Data", meta = (WorldContext = "WorldContextObject"))
 	static float GetTrackingFPS(const UObject* WorldContextObject);
 
-	/** Check if user is currently looking at a specific actor */
+	/** Check if user is currently looking at a specific actor; registered gaze targets are tested against their screen bounds */
 	UFUNCTION(BlueprintPure, Category = "Beam|Interaction", meta = (WorldContext = "WorldContextObject"))
 	static bool IsLookingAtActor(const UObject* WorldContextObject, AActor* TargetActor, float MaxDistance = 1000.0f);
 
-	/** Get the actor closest to the current gaze point */
+	/** Get the actor closest to the current gaze point; prefer UBeamGazeTargetSubsystem for large target sets */
 	UFUNCTION(BlueprintPure, Category = "Beam|Interaction", meta = (WorldContext = "WorldContextObject"))
-	static AActor* GetClosestActorToGaze(const UObject* WorldContextObject, TArray<AActor*> ActorList, float MaxDistance = 1000.0f);
+	static AActor* GetClosestActorToGaze(const UObject* WorldContextObject, const TArray<AActor*>& ActorList, float MaxDistance = 1000.0f);
+
+	/** Register Target with the world's focus dispatcher; its dwell fires after DwellTime seconds of focus (used by the Dwell Detector node) */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Interaction", meta = (WorldContext = "WorldContextObject"))
+	static bool StartDwellDetection(const UObject* WorldContextObject, UObject* Target, float DwellTime = 1.0f);
+
+	/** User widget under gaze from the game instance's gaze cursor, with the gaze in its local space (used by the Focus Widget node) */
+	UFUNCTION(BlueprintCallable, Category = "Beam|UI", meta = (WorldContext = "WorldContextObject"))
+	static UWidget* GetWidgetUnderGaze(const UObject* WorldContextObject, FVector2D& OutLocalPos);
+
+	/** Copy the most recent Count buffered frames, oldest first (used by the Sample Buffer To Array node) */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Data", meta = (WorldContext = "WorldContextObject"))
+	static void GetRecentGazeSamples(const UObject* WorldContextObject, int32 Count, TArray<FBeamFrame>& OutSamples);
+
+	/** Extrapolate a gaze sample HorizonMs ahead with the live velocity estimate (used by the Predict Gaze node) */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Advanced", meta = (WorldContext = "WorldContextObject"))
+	static FGazePoint PredictGaze(const UObject* WorldContextObject, const FGazePoint& InSample, int32 HorizonMs = 50);
 	//~ End Advanced Data Access
 
+    //~ Begin Node Entry Points
+	/**
+	 * Fused calls the editor's custom Beam nodes compile to, one VM call per node instead of a chain of
+	 * lookup, projection and trace calls with temporaries in between. Hidden from the palette.
+	 */
+
+	/** True when tracking is up, not recovering, and the newest frame is at most FreshnessSec old (0 skips the age test) */
+	UFUNCTION(BlueprintPure, Category = "Beam|Internal", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static bool IsTrackingFresh(const UObject* WorldContextObject, float FreshnessSec = 0.1f);
+
+	/** Gaze ray for PlayerController, or the first local player when null; false without valid gaze */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Internal", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static bool ProjectGazeRay(const UObject* WorldContextObject, const APlayerController* PlayerController, FVector& OutOrigin, FVector& OutDirection);
+
+	/** ProjectGazeRay followed by the batched gaze trace out to MaxDistance; returns whether it hit */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Internal", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static bool TraceFromGaze(const UObject* WorldContextObject, const APlayerController* PlayerController, float MaxDistance, ECollisionChannel Channel, FHitResult& OutHit);
+    //~ End Node Entry Points
+
     //~ Begin Control Functions
     /** Start eye tracking */
     UFUNCTION(BlueprintCallable, Category = "Beam|Control", meta = (WorldContext = "WorldContextObject"))
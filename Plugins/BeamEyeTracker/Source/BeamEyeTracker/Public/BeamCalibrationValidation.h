@@ -0,0 +1,128 @@
+/*=============================================================================
+    BeamCalibrationValidation.h: Streaming calibration quality assessment.
+
+    Measures how well the gaze lands on a sequence of validation targets
+    from every tracker frame published while each target is shown, rather
+    than from the one sample a widget happens to read per tick. Accuracy,
+    precision and bias are accumulated incrementally, so a target can be
+    closed as soon as its estimate has converged.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamRing.h"
+
+/** Tuning for a validation session; distances are in 0..1 screen space */
+struct FBeamCalibrationValidationParams
+{
+	/** Frames from the first SettleMs after a target appears are the saccade towards it and are ignored */
+	double SettleMs = 400.0;
+
+	/** Frames below this gaze confidence are ignored */
+	float MinConfidence = 0.5f;
+
+	/** A target is converged once it has this many samples... */
+	int32 MinSamples = 30;
+
+	/** ...and the standard error of its mean gaze is below this */
+	float MaxStandardError = 0.002f;
+
+	/** RMS error at which a target scores zero; matches the widget's 10%-of-screen threshold */
+	float ZeroScoreError = 0.1f;
+};
+
+/** Results for one validation target */
+struct FBeamCalibrationTargetStats
+{
+	FVector2D Target = FVector2D::ZeroVector;
+	int32 NumSamples = 0;
+
+	/** RMS distance from the gaze samples to the target */
+	float AccuracyRms = 0.0f;
+
+	/** Radial standard deviation of the gaze samples around their mean */
+	float PrecisionStd = 0.0f;
+
+	/** RMS of the distance between successive gaze samples */
+	float PrecisionRms = 0.0f;
+
+	/** Mean gaze minus the target */
+	FVector2D Bias = FVector2D::ZeroVector;
+
+	/** 0-1 score derived from AccuracyRms */
+	float Score = 0.0f;
+};
+
+/**
+ * Incremental validation over the frame ring.
+ *
+ * Consume() walks the frames published since the previous call straight
+ * out of ring storage, so it allocates nothing and can run every tick.
+ * Statistics use Welford updates and never store samples. Game thread
+ * only.
+ */
+class BEAMEYETRACKER_API FBeamCalibrationValidator
+{
+public:
+	explicit FBeamCalibrationValidator(const FBeamCalibrationValidationParams& InParams = FBeamCalibrationValidationParams());
+
+	/** Forgets every target */
+	void Reset();
+
+	/** Starts sampling Target; frames published before this call are never attributed to it */
+	void BeginTarget(const FBeamFrameRing& Ring, const FVector2D& Target);
+
+	/** Accumulates every frame published since the previous call into the active target */
+	void Consume(const FBeamFrameRing& Ring);
+
+	/** Drains the ring one last time and closes the active target; returns its results */
+	FBeamCalibrationTargetStats EndTarget(const FBeamFrameRing& Ring);
+
+	bool IsTargetActive() const { return bTargetActive; }
+
+	/** True once the active target has enough samples for a stable estimate */
+	bool IsTargetConverged() const;
+
+	/** Results of the active target so far */
+	FBeamCalibrationTargetStats GetActiveStats() const { return Finish(Active); }
+
+	const TArray<FBeamCalibrationTargetStats>& GetCompletedTargets() const { return Completed; }
+
+	/** Session results over every completed target, scored 0-100 for FCalibrationQuality consumers */
+	FCalibrationQuality MakeQuality(float TimeSeconds) const;
+
+private:
+	struct FRunningStats
+	{
+		FVector2D Target = FVector2D::ZeroVector;
+		int32 NumSamples = 0;
+		FVector2D Mean = FVector2D::ZeroVector;
+		double M2 = 0.0;
+		double SumSquaredError = 0.0;
+		double SumSquaredStep = 0.0;
+		FVector2D PreviousGaze = FVector2D::ZeroVector;
+
+		void Add(const FVector2D& Gaze);
+	};
+
+	FBeamCalibrationValidationParams Params;
+	FRunningStats Active;
+	TArray<FBeamCalibrationTargetStats> Completed;
+	bool bTargetActive = false;
+
+	/** SDK timestamps: frames at or before ConsumedUntilMs were already seen, frames before WindowStartMs are settling */
+	double ConsumedUntilMs = 0.0;
+	double WindowStartMs = 0.0;
+
+	FBeamCalibrationTargetStats Finish(const FRunningStats& Stats) const;
+};
+
+/*=============================================================================
+    End of BeamCalibrationValidation.h
+=============================================================================*/
@@ -15,6 +15,7 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "BeamEyeTrackerTypes.h"
+#include "BeamCalibrationValidation.h"
 #include "BeamCalibrationWidget.generated.h"
 
 class UImage;
@@ -151,6 +152,9 @@ private:
     // Calibration quality data
     FCalibrationQuality CurrentCalibrationQuality;
 
+    /** Scores each point from every ring frame published while it is shown */
+    FBeamCalibrationValidator Validator;
+
     // Helper functions
     void UpdateCalibrationDisplay();
     void ActivateNextPoint();
@@ -0,0 +1,67 @@
+/*=============================================================================
+    BeamClockSync.h: Tracker clock to FPlatformTime mapping.
+
+    Continuously estimates the offset between the tracker's capture clock
+    and FPlatformTime::Seconds() from frame arrivals, so capture times can
+    be compared with local time for latency, prediction and lookups.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Offset estimator between a device clock and FPlatformTime.
+ *
+ * Every arrival gives LocalSeconds - DeviceSeconds, which is the true
+ * offset plus a non-negative delivery delay, so the estimate follows the
+ * lower envelope: a smaller sample is taken at once, a larger one only
+ * pulls the estimate up over DriftTimeConstantSeconds so clock drift is
+ * tracked while a single late delivery barely moves it. A jump beyond
+ * ResyncThresholdSeconds (the device clock restarted) resynchronizes.
+ * Safe to feed from one thread while others map timestamps; concurrent
+ * feeders at worst drop a sample.
+ */
+class BEAMEYETRACKER_API FBeamClockSync
+{
+public:
+	/** Feeds one capture/arrival pair and returns the capture time on the local clock */
+	double AddSample(double DeviceSeconds, double LocalSeconds);
+
+	/** Maps a device capture time to FPlatformTime seconds; identity until the first sample */
+	double ToLocalSeconds(double DeviceSeconds) const
+	{
+		return DeviceSeconds + OffsetSeconds.load(std::memory_order_relaxed);
+	}
+
+	bool HasEstimate() const { return bHasEstimate.load(std::memory_order_acquire); }
+
+	/** FPlatformTime seconds minus device seconds */
+	double GetOffsetSeconds() const { return OffsetSeconds.load(std::memory_order_relaxed); }
+
+	/** Delivery delay of the last sample: arrival minus mapped capture */
+	double GetLastDeliverySeconds() const { return LastDeliverySeconds.load(std::memory_order_relaxed); }
+
+	void Reset();
+
+	/** Time over which a consistently later arrival raises the estimate */
+	static constexpr double DriftTimeConstantSeconds = 10.0;
+
+	/** Offset change treated as a device clock restart */
+	static constexpr double ResyncThresholdSeconds = 1.0;
+
+private:
+	std::atomic<double> OffsetSeconds{0.0};
+	std::atomic<double> LastLocalSeconds{0.0};
+	std::atomic<double> LastDeliverySeconds{0.0};
+	std::atomic<bool> bHasEstimate{false};
+};
+
+/*=============================================================================
+    End of BeamClockSync.h
+=============================================================================*/
@@ -21,6 +21,9 @@ class FBeamDebugCVars
 public:
 	// Main debug HUD toggle
 	static TAutoConsoleVariable<bool> CVarDebugHUD;
+
+	// Batched debug overlay drawn in the Game debug draw pass
+	static TAutoConsoleVariable<bool> CVarDebugOverlay;
 	
 	// Individual drawing toggles
 	static TAutoConsoleVariable<bool> CVarDrawText;
@@ -47,6 +50,7 @@ public:
 	
 	// Utility functions
 	static bool IsDebugHUDEnabled();
+	static bool IsDebugOverlayEnabled();
 	static bool IsDrawGazeEnabled();
 	static bool IsDrawRayEnabled();
 	static bool IsDrawTextEnabled();
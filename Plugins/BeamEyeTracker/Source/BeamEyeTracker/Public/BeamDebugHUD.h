@@ -54,6 +54,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Beam Debug HUD")
 	FText GetBufferUtilizationText() const;
 
+	UFUNCTION(BlueprintPure, Category = "Beam Debug HUD")
+	FText GetDroppedFramesText() const;
+
 	UFUNCTION(BlueprintPure, Category = "Beam Debug HUD")
 	FText GetGazePositionText() const;
 
@@ -74,11 +74,16 @@ public:
 
 protected:
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual TSharedRef<SWidget> RebuildWidget() override;
 
 private:
 	/** Update the debug display */
 	void UpdateDebugDisplay();
+
+	/** Update the text fields; runs on its own timer in low-overhead mode */
+	void UpdateTextFields();
 	
 	/** Update gaze crosshair position */
 	void UpdateGazeCrosshair();
@@ -91,6 +96,9 @@ private:
 	
 	/** Update connection status */
 	void UpdateConnectionStatus();
+
+	/** Point HeatmapImage at the gaze heatmap texture once it exists */
+	void UpdateHeatmapImage();
 	
 	/** Initialize widget bindings */
 	void InitializeWidgetBindings();
@@ -119,6 +127,14 @@ private:
 	/** Update interval in seconds */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Debug", meta = (AllowPrivateAccess = "true"))
 	float UpdateInterval = 0.016f; // 60 FPS update rate
+
+	/** Cache the HUD in an invalidation panel, move the crosshair by render transform only and refresh text every TextUpdateInterval; read when the widget is built */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Beam Eye Tracker|Debug", meta = (AllowPrivateAccess = "true"))
+	bool bLowOverheadUpdates = false;
+
+	/** Text refresh interval in seconds in low-overhead mode */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Debug", meta = (AllowPrivateAccess = "true", ClampMin = "0.05", EditCondition = "bLowOverheadUpdates"))
+	float TextUpdateInterval = 0.25f;
 	
 	/** Gaze crosshair size */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Debug", meta = (AllowPrivateAccess = "true"))
@@ -130,6 +146,22 @@ private:
 	
 	/** Timer handle for updates */
 	FTimerHandle UpdateTimerHandle;
+	FTimerHandle TextUpdateTimerHandle;
+
+	/** Frame fetched once per update and shared by every element */
+	FBeamFrame LatestFrame;
+	bool bHasLatestFrame = false;
+
+	/** Designed canvas position of the crosshair; low-overhead mode offsets from it by render transform */
+	FVector2D CrosshairSlotOrigin = FVector2D::ZeroVector;
+
+	/** Values behind the text currently shown, so unchanged text is never formatted again */
+	float ShownFPS = -1.0f;
+	int32 ShownBufferUtilization = -1;
+	int64 ShownLostFrames = -1;
+	bool bShownConnected = false;
+	bool bShownTracking = false;
+	bool bHasShownConnection = false;
 	
 	/** Widget references for updating */
 	UPROPERTY(meta = (BindWidget))
@@ -159,6 +191,10 @@ private:
 	
 	UPROPERTY(meta = (BindWidget))
 	UOverlay* DebugOverlay;
+
+	/** Optional view of the gaze heatmap (see UBeamHeatmapSubsystem) */
+	UPROPERTY(meta = (BindWidgetOptional))
+	UImage* HeatmapImage;
 	
 	/** Current gaze data */
 	FVector2D CurrentGazeScreenPos;
@@ -176,6 +212,9 @@ private:
 	float CurrentFPS;
 	int32 CurrentBufferUtilization;
 	double CurrentLatency;
+
+	/** Source and consumer drops since the subsystem started */
+	int64 CurrentLostFrames = 0;
 	
 	/** Connection data */
 	bool bIsConnected;
@@ -157,6 +157,32 @@ public:
 	/** Get frame data at a specific time (for playback) */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Beam Eye Tracker|Advanced", meta = (WorldContext = "WorldContextObject"))
 	static FBeamFrame GetRawFrameAtTime(const UObject* WorldContextObject, float TimeSeconds);
+
+		// FAST PATH FUNCTIONS (for graphs that poll every tick)
+
+	/** Normalized gaze of the latest frame; reads one field instead of copying the whole frame */
+	UFUNCTION(BlueprintPure, Category = "Beam Eye Tracker|Fast Path", meta = (WorldContext = "WorldContextObject"))
+	static FVector2D GetLatestGazeScreen01(const UObject* WorldContextObject, bool& bValid);
+
+	/** Filtered gaze velocity of the latest frame in Screen01 units per second; zero until a velocity is available */
+	UFUNCTION(BlueprintPure, Category = "Beam Eye Tracker|Fast Path", meta = (WorldContext = "WorldContextObject"))
+	static FVector2D GetLatestGazeVelocity(const UObject* WorldContextObject);
+
+	/** Head position of the latest frame in centimeters */
+	UFUNCTION(BlueprintPure, Category = "Beam Eye Tracker|Fast Path", meta = (WorldContext = "WorldContextObject"))
+	static FVector GetLatestHeadPositionCm(const UObject* WorldContextObject);
+
+	/** Head rotation of the latest frame */
+	UFUNCTION(BlueprintPure, Category = "Beam Eye Tracker|Fast Path", meta = (WorldContext = "WorldContextObject"))
+	static FRotator GetLatestHeadRotation(const UObject* WorldContextObject);
+
+	/** Id of the latest frame; compare against the previous tick's value to act only on new data. -1 when none */
+	UFUNCTION(BlueprintPure, Category = "Beam Eye Tracker|Fast Path", meta = (WorldContext = "WorldContextObject"))
+	static int64 GetLatestFrameId(const UObject* WorldContextObject);
+
+	/** Normalized gaze at a specific time (for playback) without returning the whole frame */
+	UFUNCTION(BlueprintPure, Category = "Beam Eye Tracker|Fast Path", meta = (WorldContext = "WorldContextObject"))
+	static FVector2D GetGazeScreen01AtTime(const UObject* WorldContextObject, float TimeSeconds, bool& bValid);
 };
 
 /*=============================================================================
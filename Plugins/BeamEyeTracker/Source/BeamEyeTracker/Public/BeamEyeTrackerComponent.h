@@ -16,10 +16,14 @@
 #include "Components/ActorComponent.h"
 #include "BeamEyeTrackerTypes.h"
 #include "BeamFilters.h"
-#include "BeamFrameBuffer.h"
+#include "BeamRing.h"
+#include "BeamGazeTraceSubsystem.h"
 #include "BeamEyeTrackerComponent.generated.h"
 
 class UBeamEyeTrackerSubsystem;
+class UBeamSimCameraModifier;
+struct FBeamPipelineContext;
+enum class EBeamPipelineStages : uint8;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGazeUpdated, const FGazePoint&, GazePoint);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHeadPoseUpdated, const FHeadPose&, HeadPose);
@@ -133,8 +137,8 @@ public:
 	float LowConfidenceSmoothingMultiplier = 2.0f;
 
 	// **BEAM|Performance Group** (BEAM|Performance)
-	/** Frame buffer size for data storage (must be power of 2) */
-	UPROPERTY(EditAnywhere, Category = "BEAM|Performance", meta = (DisplayPriority = "7", ClampMin = "16", ClampMax = "1024", ToolTip = "Frame buffer size for data storage (must be power of 2)"))
+	/** Frame buffer size for data storage; up to 64 uses the compact ring, larger values use the 1024-frame ring unless the memory profile caps history at 64 */
+	UPROPERTY(EditAnywhere, Category = "BEAM|Performance", meta = (DisplayPriority = "7", ClampMin = "16", ClampMax = "1024", ToolTip = "Frame buffer size for data storage. Values up to 64 use a 64-frame ring; larger values use a 1024-frame ring when the memory profile allows it."))
 	int32 FrameBufferSize = 64;
 
 	/** If true, enables frame interpolation for smooth updates */
@@ -145,8 +149,12 @@ public:
 	UPROPERTY(EditAnywhere, Category = "BEAM|Performance", meta = (DisplayPriority = "7", ClampMin = "16", ClampMax = "500", EditCondition = "bEnableFrameInterpolation", Units = "ms", ToolTip = "Maximum interpolation time window (milliseconds)"))
 	float MaxInterpolationTimeMs = 100.0f;
 
-	/** If true, enables adaptive polling based on frame rate */
-	UPROPERTY(EditAnywhere, Category = "BEAM|Performance", meta = (DisplayPriority = "7", ToolTip = "If true, enables adaptive polling based on frame rate"))
+	/** If true, the component never ticks: it updates only when the subsystem publishes new frames, and follows viewport resizes instead of polling */
+	UPROPERTY(EditAnywhere, Category = "BEAM|Performance", meta = (DisplayPriority = "7", ToolTip = "If true, the component never ticks and updates only when the subsystem publishes new frames; viewport changes come from resize events"))
+	bool bEventDriven = false;
+
+	/** If true, keeps the producer's adaptive wake scheduling on while this component plays, even when the project setting disables it */
+	UPROPERTY(EditAnywhere, Category = "BEAM|Performance", meta = (DisplayPriority = "7", ToolTip = "If true, the producer thread picks its wake strategy from tracker rate, frame rate, focus and power state while this component plays, even when the project setting disables it"))
 	bool bEnableAdaptivePolling = false;
 
 	// **BEAM|Events Group** (BEAM|Events)
@@ -166,9 +174,13 @@ public:
 	UPROPERTY(EditAnywhere, Category = "BEAM|Events", meta = (DisplayPriority = "8", ClampMin = "1.0", ClampMax = "45.0", EditCondition = "bEnableHeadPoseChangeNotifications", Units = "deg", ToolTip = "Head pose change threshold (degrees)"))
 	float HeadPoseChangeThresholdDegrees = 5.0f;
 
+	/** Maximum rate of gaze and head pose notifications (Hz); 0 notifies on every qualifying frame */
+	UPROPERTY(EditAnywhere, Category = "BEAM|Events", meta = (DisplayPriority = "8", ClampMin = "0.0", ClampMax = "240.0", Units = "Hz", ToolTip = "Maximum rate of gaze and head pose notifications (Hz); 0 notifies on every qualifying frame"))
+	float MaxNotificationRateHz = 0.0f;
+
 	// **BEAM|Advanced SDK Group** (BEAM|Advanced SDK)
-	/** If true, enables foveated rendering support */
-	UPROPERTY(EditAnywhere, Category = "BEAM|Advanced SDK", meta = (DisplayPriority = "9", ToolTip = "If true, enables foveated rendering support"))
+	/** If true, late-latches gaze on the render thread and publishes foveation parameters for each view */
+	UPROPERTY(EditAnywhere, Category = "BEAM|Advanced SDK", meta = (DisplayPriority = "9", ToolTip = "If true, late-latches gaze on the render thread and publishes foveation parameters for each view"))
 	bool bEnableFoveatedRendering = false;
 
 	/** If true, enables immersive HUD features */
@@ -176,11 +188,11 @@ public:
 	bool bEnableImmersiveHUD = false;
 
 	/** If true, enables sim game camera controls */
-	UPROPERTY(EditAnywhere, Category = "BEAM|Advanced SDK", meta = (DisplayPriority = "9", ToolTip = "If true, enables sim game camera controls"))
+	UPROPERTY(EditAnywhere, Category = "BEAM|Advanced SDK", meta = (DisplayPriority = "9", ToolTip = "If true, adds a UBeamSimCameraModifier to the owning player's camera so head movement moves the view"))
 	bool bEnableSimGameCamera = false;
 
 	/** Camera sensitivity for head tracking */
-	UPROPERTY(EditAnywhere, Category = "BEAM|Advanced SDK", meta = (DisplayPriority = "9", ClampMin = "0.1", ClampMax = "5.0", EditCondition = "bEnableSimGameCamera", ToolTip = "Camera sensitivity for head tracking"))
+	UPROPERTY(EditAnywhere, Category = "BEAM|Advanced SDK", meta = (DisplayPriority = "9", ClampMin = "0.1", ClampMax = "5.0", EditCondition = "bEnableSimGameCamera", ToolTip = "Scale applied to the sim game camera rotation and translation"))
 	float CameraSensitivity = 1.0f;
 
 	// **BEAM|Integration Group** (BEAM|Integration)
@@ -308,6 +320,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "BEAM|Actions", meta = (ToolTip = "Test gaze ray tracing with current settings"))
 	void TestGazeRay();
 
+	/** Queue a trace along the current gaze ray; OnResult fires next frame and the trace is shared with identical requests */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Actions", meta = (DisplayName = "Request Gaze Trace", ToolTip = "Queue an asynchronous trace along the current gaze ray; returns false when there is no valid gaze ray"))
+	bool RequestGazeTrace(FOnBeamGazeTraceResult OnResult, ECollisionChannel Channel = ECC_Visibility);
+
 	/** Get current head pose if available */
 	UFUNCTION(BlueprintCallable, Category = "BEAM|Data", meta = (ToolTip = "Get current head pose if available"))
 	bool GetCurrentHeadPose(FHeadPose& OutHeadPose) const;
@@ -320,20 +336,72 @@ private:
 	/** Previous health status for change detection */
 	EBeamHealth PreviousHealth = EBeamHealth::Error;
 
-	/** Previous gaze point for change detection */
+	/** Last raw (unfiltered) gaze sample; a new sample close to it is not an outlier */
 	FGazePoint PreviousGazePoint;
 
-	/** Previous head pose for change detection */
+	/** Last raw (unfiltered) head pose */
 	FHeadPose PreviousHeadPose;
 
+	/** Newest gaze sample the outlier gate let through; new samples are measured against it */
+	FGazePoint AcceptedGazePoint;
+
+	/** Newest head pose the outlier gate let through, the fallback for rejected head samples */
+	FHeadPose AcceptedHeadPose;
+
 	/** One-Euro filter for gaze smoothing */
 	TUniquePtr<FOneEuroFilter> GazeFilter;
 
 	/** One-Euro filter for head pose smoothing */
 	TUniquePtr<FOneEuroFilter> HeadPoseFilter;
 
-	/** Frame buffer for storing recent data */
-	TUniquePtr<FBeamFrameBuffer> ComponentFrameBuffer;
+	/** Frame buffer for storing recent data when FrameBufferSize fits the small ring; both rings hold quantized frames */
+	TUniquePtr<FBeamComponentFrameRing> ComponentFrameBuffer;
+
+	/** Frame buffer for storing recent data when FrameBufferSize exceeds the small ring */
+	TUniquePtr<FBeamCompactFrameRing> LargeComponentFrameBuffer;
+
+	/** True while this component holds a foveation registration on the subsystem */
+	bool bRegisteredFoveationUser = false;
+
+	/** True while this component holds an adaptive polling registration on the subsystem */
+	bool bRegisteredAdaptivePollingUser = false;
+
+	/** Sim game camera modifier this component added to its player's camera manager, which owns it */
+	TWeakObjectPtr<UBeamSimCameraModifier> SimCameraModifier;
+
+	/** Adds, updates or removes the sim camera modifier to match bEnableSimGameCamera and CameraSensitivity */
+	void ApplySimCameraModifier(bool bEndingPlay = false);
+
+	/** Subsystem change subscription feeding OnGazeUpdated and OnHeadPoseUpdated */
+	FDelegateHandle FrameChangeHandle;
+
+	/** Re-subscribes with the current notification settings, or unsubscribes when both are disabled */
+	void UpdateChangeSubscription();
+
+	/** Subscription callback; broadcasts the Blueprint events for the parts that changed */
+	void HandleFrameChanged(const FBeamFrame& Frame, bool bGazeChanged, bool bHeadChanged);
+
+	/** Event-driven mode: new-frame listener, viewport resize binding and the slow health check that covers frames stopping */
+	FDelegateHandle NewFrameHandle;
+	FDelegateHandle ViewportResizedHandle;
+	FTimerHandle HealthCheckTimerHandle;
+	double LastUpdateSeconds = 0.0;
+
+	/** Newest frame already processed; the next update drains everything the subsystem ring published after it */
+	int64 LastProcessedFrameId = -1;
+	double LastProcessedTimestampMs = 0.0;
+
+	/** Switches between ticking and event-driven updates to match bEventDriven; bEndingPlay drops every binding */
+	void ApplyUpdateMode(bool bEndingPlay = false);
+
+	/** Fetches, filters and publishes the latest frame, then runs the per-update checks */
+	void UpdateFromLatestFrame(float DeltaTime);
+
+	/** New-frame listener for event-driven mode */
+	void HandleNewFrame();
+
+	/** Viewport resize listener for event-driven mode */
+	void HandleViewportResized(FViewport* Viewport, uint32 Unused);
 
 	/** Cached frame from current tick to avoid redundant subsystem calls */
 	FBeamFrame CachedFrame;
@@ -341,8 +409,31 @@ private:
 	/** Flag indicating if cached frame is valid */
 	bool bHasValidCachedFrame = false;
 	
-	/** Batch processing buffer for performance optimization */
+	/** Frames published since the last update, oldest first; the last one is the frame served to callers */
 	TArray<FBeamFrame> BatchFrameBuffer;
+
+	/** SoA copy of BatchFrameBuffer for the vector gating passes; slot 0 holds the previous raw sample */
+	struct FBatchColumns
+	{
+		TArray<float> GazeX;
+		TArray<float> GazeY;
+		TArray<float> GazeValid;
+		TArray<float> GazeConfidence;
+		TArray<float> HeadX;
+		TArray<float> HeadY;
+		TArray<float> HeadZ;
+		TArray<float> HeadConfidence;
+		TArray<float> AgeSeconds;
+
+		/** Per group of four lanes: gaze still valid, head reset for low confidence or age, and gaze or head jumped from the raw predecessor */
+		TArray<uint8> GazeValidBits;
+		TArray<uint8> GazeJumpBits;
+		TArray<uint8> HeadResetBits;
+		TArray<uint8> HeadJumpBits;
+
+		void SetNum(int32 NumSlots);
+		void Write(int32 Slot, const FGazePoint& Gaze, const FHeadPose& Head, float AgeSeconds);
+	} BatchColumns;
 	
 	/** Lock-free queues for high-performance data exchange */
 	TUniquePtr<TQueue<FBeamFrame, EQueueMode::Mpsc>> FrameInputQueue;
@@ -386,14 +477,11 @@ private:
 	/** Deproject gaze point to world coordinates */
 	bool DeprojectGazeToWorld(const FGazePoint& GazePoint, FVector& OutWorldLocation, FVector& OutWorldDirection) const;
 
-	/** Apply data quality filtering */
-	void ApplyDataQualityFiltering(FBeamFrame& Frame);
+	/** Stage settings and the previous raw sample for one run of a processing chain */
+	FBeamPipelineContext MakePipelineContext() const;
 
-	/** Apply outlier detection and removal */
-	void ApplyOutlierDetection(FBeamFrame& Frame);
-
-	/** Apply adaptive smoothing based on confidence */
-	void ApplyAdaptiveSmoothing(FBeamFrame& Frame);
+	/** Stages the current settings enable; selects the pre-instantiated chain each update runs */
+	EBeamPipelineStages GetEnabledPipelineStages() const;
 
 	/** Check if data meets quality thresholds */
 	bool MeetsQualityThresholds(const FBeamFrame& Frame) const;
@@ -401,24 +489,24 @@ private:
 	/** Update buffer size if needed */
 	void UpdateBufferSize();
 
+	/** Creates the ring instantiation matching FrameBufferSize and releases the other */
+	void CreateComponentFrameBuffer();
+
+	/** FrameBufferSize capped by the memory profile's component history */
+	int32 GetBudgetedFrameBufferSize() const;
+
 	/** Update performance metrics */
 	void UpdatePerformanceMetrics(float DeltaTime);
 	
 	/** Update processing performance metrics */
 	void UpdateProcessingMetrics(double ProcessingTimeMs);
 	
-	/** Process batch frames for performance optimization */
+	/** Fills BatchFrameBuffer with the ring frames published after the last processed one, ending with LatestFrame */
+	int32 DrainNewFrames(const FBeamFrame& LatestFrame);
+
+	/** Confidence, age, outlier and head-pose gating over BatchFrameBuffer as vector passes over its SoA columns */
 	void ProcessBatchFrames();
 	
-	/** Process batch frames using SIMD optimizations */
-	void ProcessBatchFramesSIMD();
-	
-	/** Process batch frames using standard optimizations */
-	void ProcessBatchFramesStandard();
-	
-	/** Process a single frame with optimizations */
-	void ProcessFrameOptimized(FBeamFrame& Frame);
-	
 	/** Initialize lock-free queues for high-performance data exchange */
 	void InitializeLockFreeQueues();
 	
@@ -17,7 +17,11 @@
 #include "BeamEyeTrackerTypes.h"
 #include "BeamEyeTrackerSubsystem.h"
 
-/** Custom Input Device for Beam Eye Tracker */
+/**
+ * Custom Input Device for Beam Eye Tracker.
+ * Legacy axis path: every value goes through the message handler by axis name. New code should
+ * read gaze through UInputModifierBeamGaze / UInputTriggerBeamGaze or the engine IEyeTracker bridge.
+ */
 class BEAMEYETRACKER_API FBeamEyeTrackerInputDevice
 {
 public:
@@ -16,6 +16,8 @@
 #include "Internationalization/Internationalization.h"
 #include "BeamEyeTrackerTypes.h"
 #include "BeamFilters.h"
+#include "BeamPredictor.h"
+#include "BeamMemoryBudget.h"
 #include "BeamEyeTrackerSettings.generated.h"
 
 /**
@@ -60,6 +62,16 @@ struct FBeamProfile
 	FBeamProfile() = default;
 };
 
+/** Scheduling priority for the tracking producer thread */
+UENUM(BlueprintType)
+enum class EBeamThreadPriority : uint8
+{
+	Normal UMETA(DisplayName = "Normal"),
+	AboveNormal UMETA(DisplayName = "Above Normal"),
+	Highest UMETA(DisplayName = "Highest"),
+	TimeCritical UMETA(DisplayName = "Time Critical")
+};
+
 /**
  * Project-wide config for Beam eye tracking functionality.
  * 
@@ -95,6 +107,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core", meta = (EditCondition = "bEnableSmoothing", ClampMin = "0.0", ClampMax = "2.0", UIMin = "0.0", UIMax = "1.0", ToolTip = "One-Euro filter beta parameter for adaptive smoothing"))
 	float Beta = 0.2f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core", meta = (EditCondition = "bEnableSmoothing", ToolTip = "Tune MinCutoff and Beta in the background from the live gaze stream and remember the result per calibration profile"))
+	bool bAutoTuneFilters = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core", meta = (EditCondition = "bAutoTuneFilters", ClampMin = "0.1", ClampMax = "10.0", ToolTip = "Weight of smoothing lag against fixation jitter when auto-tuning; higher values favor responsiveness over stability"))
+	float AutoTuneLagWeight = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core", meta = (ClampMin = "0", ClampMax = "1000", UIMin = "0", UIMax = "400", Units = "ms", ToolTip = "Longest blink or tracking dropout bridged with held or extrapolated samples; 0 lets gaps through as invalid frames"))
+	float MaxGapFillMs = 150.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core", meta = (EditCondition = "MaxGapFillMs > 0", ClampMin = "0", ClampMax = "200", Units = "ms", ToolTip = "How much of a bridged gap continues the last motion before the sample is held"))
+	float GapExtrapolationMs = 30.0f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core", meta = (ClampMin = "100", ClampMax = "100000", UIMin = "500", UIMax = "20000", Units = "cm", ToolTip = "Default max distance for gaze line traces in centimeters"))
 	float TraceDistance = 5000.0f;
 
@@ -110,6 +134,150 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core", meta = (ToolTip = "Active profile name"))
 	FName ActiveProfile = TEXT("Default");
 
+	// Threading Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threading", meta = (ToolTip = "Run a dedicated producer thread that blocks on the SDK for new frames instead of registering the push listener"))
+	bool bUseProducerThread = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threading", meta = (EditCondition = "bUseProducerThread", ToolTip = "Scheduling priority of the producer thread"))
+	EBeamThreadPriority ProducerThreadPriority = EBeamThreadPriority::AboveNormal;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threading", meta = (EditCondition = "bUseProducerThread", ToolTip = "Core affinity mask for the producer thread (0 = no affinity)"))
+	int64 ProducerThreadAffinityMask = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threading", meta = (EditCondition = "bUseProducerThread", ClampMin = "1", ClampMax = "1000", Units = "ms", ToolTip = "Maximum time the producer thread blocks waiting for a new frame before re-checking for shutdown"))
+	int32 ProducerWaitTimeoutMs = 100;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threading", meta = (EditCondition = "bUseProducerThread", ToolTip = "Pick the producer wake strategy from the observed tracker rate, engine frame rate, window focus and power state instead of always blocking on the source"))
+	bool bAdaptiveProducerWake = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threading", meta = (EditCondition = "bUseProducerThread && bAdaptiveProducerWake", ClampMin = "1", ClampMax = "120", Units = "Hz", ToolTip = "Producer poll rate while the application does not have focus"))
+	int32 BackgroundPollingHz = 10;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threading", meta = (EditCondition = "bUseProducerThread && bAdaptiveProducerWake", ClampMin = "1", ClampMax = "60", Units = "Hz", ToolTip = "Producer poll rate while the game window is minimized"))
+	int32 MinimizedPollingHz = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threading", meta = (EditCondition = "bUseProducerThread && bAdaptiveProducerWake", ToolTip = "On battery power, never produce frames faster than the engine consumes them"))
+	bool bThrottleOnBattery = true;
+
+	// Watchdog Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watchdog", meta = (ToolTip = "Rebuild the SDK connection in the background when a live session stops hearing from the SDK, e.g. after the Beam app restarts"))
+	bool bEnableWatchdog = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watchdog", meta = (EditCondition = "bEnableWatchdog", ClampMin = "100", ClampMax = "60000", Units = "ms", ToolTip = "Time without any data from the SDK, frames or empty state sets, after which the session is treated as stalled"))
+	int32 WatchdogStallTimeoutMs = 2000;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watchdog", meta = (EditCondition = "bEnableWatchdog", ClampMin = "10", ClampMax = "60000", Units = "ms", ToolTip = "Delay after the first failed reconnect; doubles with every further failure"))
+	int32 WatchdogInitialBackoffMs = 250;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Watchdog", meta = (EditCondition = "bEnableWatchdog", ClampMin = "10", ClampMax = "300000", Units = "ms", ToolTip = "Upper bound on the delay between reconnect attempts"))
+	int32 WatchdogMaxBackoffMs = 8000;
+
+	// Prediction Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ToolTip = "Motion model used to extrapolate gaze and head pose to display time"))
+	EBeamPredictionModel PredictionModel = EBeamPredictionModel::ConstantVelocity;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0", ClampMax = "4.0", ToolTip = "Game frames between the game thread reading gaze and that frame reaching the display (render thread, RHI and present queue)"))
+	float PredictionRenderLatencyFrames = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0", ClampMax = "200.0", Units = "ms", ToolTip = "Hard limit on how far ahead a sample is extrapolated"))
+	float PredictionMaxHorizonMs = 50.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.1", ClampMax = "50.0", ToolTip = "Gaze speed (screen widths per second) above which the eye is treated as mid-saccade"))
+	float PredictionSaccadeVelocityThreshold = 3.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0", ClampMax = "50.0", Units = "ms", ToolTip = "Horizon limit while mid-saccade, to avoid overshooting the landing point"))
+	float PredictionSaccadeMaxHorizonMs = 8.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0", ClampMax = "1.0", ToolTip = "Gaze speed (screen widths per second) below which no extrapolation is applied"))
+	float PredictionFixationVelocityThreshold = 0.05f;
+
+	// Foveation Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foveation", meta = (ClampMin = "0.01", ClampMax = "1.0", ToolTip = "Radius of the full-rate region around the gaze, normalized by view width"))
+	float FoveationInnerRadius = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foveation", meta = (ClampMin = "0.01", ClampMax = "1.0", ToolTip = "Radius of the half-rate region around the gaze, normalized by view width"))
+	float FoveationMiddleRadius = 0.25f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foveation", meta = (ClampMin = "0.01", ClampMax = "1.5", ToolTip = "Radius beyond which the lowest shading rate applies, normalized by view width"))
+	float FoveationOuterRadius = 0.45f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foveation", meta = (ClampMin = "0.0", ClampMax = "4.0", ToolTip = "Frames between render-thread gaze sampling and scan-out, used as the foveation prediction horizon"))
+	float FoveationRenderLatencyFrames = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foveation", meta = (ToolTip = "Build a variable rate shading image around the gaze every frame on hardware with image-based VRS (Tier 2)"))
+	bool bFoveationShadingRateImage = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foveation", meta = (ClampMin = "0.0", ClampMax = "4.0", EditCondition = "bFoveationShadingRateImage", ToolTip = "How much the foveal radii grow as gaze confidence drops; at zero confidence they are this many times larger"))
+	float FoveationConfidenceExpansion = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foveation", meta = (ClampMin = "0.0", ClampMax = "8.0", EditCondition = "bFoveationShadingRateImage", ToolTip = "Multiples of the measured prediction error added to every foveal radius"))
+	float FoveationPredictionErrorScale = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foveation", meta = (ClampMin = "1.0", ClampMax = "4.0", EditCondition = "bFoveationShadingRateImage", ToolTip = "Radius scale of the screen-centered fallback used while tracking is lost, and of the gaze rings while it is recovering"))
+	float FoveationFallbackRadiusScale = 1.5f;
+
+	// Memory Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory", meta = (ConfigRestartRequired = true, ToolTip = "Budget preset that sizes the recording, component history, analytics and flight recorder buffers; Custom uses the per-buffer settings instead"))
+	EBeamMemoryProfile MemoryProfile = EBeamMemoryProfile::Default;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory", meta = (ClampMin = "0", ClampMax = "1048576", Units = "KB", EditCondition = "MemoryProfile != EBeamMemoryProfile::Custom", ToolTip = "Overrides the preset's budget (KB); 0 keeps the preset's own"))
+	int32 MemoryBudgetOverrideKB = 0;
+
+	// Recording Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Recording", meta = (ClampMin = "4", ClampMax = "4096", EditCondition = "MemoryProfile == EBeamMemoryProfile::Custom", ToolTip = "Size of each .beamrec chunk flushed by the background writer (KB)"))
+	int32 RecordingBlockSizeKB = 64;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Recording", meta = (ClampMin = "1", ClampMax = "256", EditCondition = "MemoryProfile == EBeamMemoryProfile::Custom", ToolTip = "Chunks that may queue behind the writer before frames are dropped"))
+	int32 RecordingMaxPendingBlocks = 16;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Recording", meta = (ClampMin = "0", ClampMax = "1000000", EditCondition = "MemoryProfile == EBeamMemoryProfile::Custom", ToolTip = "Most recent recorded frames kept in memory; older frames live only on disk"))
+	int32 RecordingMaxInMemoryFrames = 4096;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Recording", meta = (ToolTip = "Quantize, delta-encode and Oodle-compress recorded chunks (v3 .beamrec); compression runs on the writer thread"))
+	bool bCompressRecordings = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Recording", meta = (ToolTip = "Restart from the beginning when a File or Recorded data source reaches the end of its recording"))
+	bool bLoopFileDataSource = true;
+
+	// Network Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "1", ClampMax = "65535", ToolTip = "UDP port the Network data source listens on and the stream server sends to when no endpoint is given"))
+	int32 NetworkListenPort = 47810;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ToolTip = "Multicast group used by default for streaming; subscribers join it, so one send reaches every machine. Empty means unicast only"))
+	FString NetworkMulticastGroup = TEXT("239.255.42.99");
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ToolTip = "Stream every published frame over UDP as soon as the subsystem initializes"))
+	bool bEnableNetworkStreaming = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ToolTip = "Additional comma-separated unicast 'address:port' destinations for the stream server"))
+	FString NetworkStreamDestinations;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "1", ClampMax = "255", ToolTip = "Multicast hop limit; 1 keeps the stream on the local subnet"))
+	int32 NetworkMulticastTtl = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0", ClampMax = "50.0", ToolTip = "Upper bound on the Network data source's adaptive playout delay (ms); 0 releases packets on arrival"))
+	float NetworkJitterBufferMaxMs = 2.0f;
+
+	// Synthetic Data Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Synthetic", meta = (ClampMin = "1.0", ClampMax = "1000.0", ToolTip = "Frame rate of the Synthetic data source (Hz)"))
+	float SyntheticRateHz = 120.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Synthetic", meta = (ToolTip = "Seed of the Synthetic data source; the same seed reproduces the same gaze sequence"))
+	int32 SyntheticSeed = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Synthetic", meta = (ToolTip = "Pace synthetic frames at SyntheticRateHz; when off, frames are produced as fast as they are consumed"))
+	bool bSyntheticRealtime = true;
+
+	// Input Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input", meta = (ConfigRestartRequired = true, ToolTip = "Register Beam as an engine eye tracker at startup so IEyeTracker consumers and the Eye Tracking Blueprint library read Beam gaze"))
+	bool bRegisterEyeTrackerBridge = true;
+
+	/** Builds predictor parameters from the prediction settings */
+	FBeamPredictorParams GetPredictorParams() const;
+
+	/** Buffer sizes of the memory profile; Custom reports the per-buffer settings */
+	FBeamMemoryBudget GetMemoryBudget() const;
+
 private:
 	UPROPERTY()
 	TArray<FBeamProfile> Profiles;
@@ -14,18 +14,44 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "BeamEyeTrackerTypes.h"
 #include "BeamFilters.h"
+#include "BeamGazeColumns.h"
+#include "BeamRing.h"
+#include "BeamFrameSubscriptions.h"
+#include "BeamFrameRateViews.h"
+#include "BeamMonitorSnapshot.h"
+#include "BeamRuntimeSettings.h"
+#include "IBeamFrameObserver.h"
+#include "Containers/ArrayView.h"
+#include "Templates/Function.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
+#include "Engine/EngineBaseTypes.h"
+#include <atomic>
 #include "BeamEyeTrackerSubsystem.generated.h"
 
 // Forward declarations for private implementation classes
 class IBeamDataSource;
-class FBeamRing;
 class FBeamRecording;
+class FBeamNetStreamServer;
 class FBeamTrace;
+class FBeamGazePredictor;
+class FBeamGazeViewExtension;
+class FBeamViewportRegistry;
+class FBeamTrackerRegistry;
+class FSceneViewport;
+class FViewport;
+class APlayerController;
+class FRunnable;
+class FRunnableThread;
+class FEvent;
 
 	// Forward declarations for UObject classes
 	class UBeamEyeTrackerSettings;
 	class UBeamEyeTrackerComponent;
 
+/** Game-thread notification of every change to GetBeamHealth() */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBeamHealthChangedNative, EBeamHealth /*NewHealth*/);
+
 /** Game-instance subsystem for global access to Beam eye tracking functionality */
 UCLASS()
 class BEAMEYETRACKER_API UBeamEyeTrackerSubsystem : public UGameInstanceSubsystem
@@ -43,6 +69,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Start Beam Tracking", ToolTip = "Starts beam tracking and initializes the data source"))
 	bool StartBeamTracking();
 
+	/**
+	 * Starts tracking without blocking the calling thread. DLL verification, SDK construction and the
+	 * tracker app launch attempt run on a worker; the outcome arrives as an OnHealthChanged broadcast.
+	 * Returns false if there is no data source or tracking is already running.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Start Beam Tracking Async", ToolTip = "Starts tracking in the background; the result is reported through the health status"))
+	bool StartBeamTrackingAsync();
+
+	/** True while an asynchronous start is still running */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Tracking", meta = (DisplayName = "Is Start Pending", ToolTip = "True while an asynchronous start is still running"))
+	bool IsStartPending() const { return bStartPending.load(std::memory_order_acquire); }
+
+	/** Broadcast on the game thread whenever GetBeamHealth() changes, including when an asynchronous start completes */
+	FOnBeamHealthChangedNative OnHealthChanged;
+
 	/** Stops beam tracking and cleans up resources */
 	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Stop Beam Tracking", ToolTip = "Stops beam tracking and cleans up resources"))
 	void StopBeamTracking();
@@ -52,17 +93,130 @@ public:
 	bool IsBeamTracking() const;
 
 	// Data access - vary naming patterns
+	/** Latest frame; on the game thread the first successful fetch of each engine frame is reused by every later caller */
 	UFUNCTION(BlueprintCallable, Category = "Beam")
 	bool FetchCurrentFrame(FBeamFrame& OutFrame) const;
 
+	/**
+	 * Game-thread view of the per-engine-frame cache FetchCurrentFrame fills; nullptr when no frame is available.
+	 * Lets narrow getters read a field or two without copying the whole frame. Valid until the next engine frame.
+	 */
+	const FBeamFrame* PeekCurrentFrame() const;
+
 	/** Gets frame data at a specific timestamp */
 	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Get Frame At", ToolTip = "Gets frame data at a specific timestamp"))
 	bool GetFrameAt(double TimestampMs, FBeamFrame& OutFrame) const;
 
+	/** Gets a frame blended between the two samples bracketing a timestamp */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Get Interpolated Frame At", ToolTip = "Blends the two buffered frames bracketing the timestamp; clamps to the nearest frame outside the buffered window"))
+	bool GetInterpolatedFrameAt(double TimestampMs, FBeamFrame& OutFrame) const;
+
+	/** Frame captured nearest to an FPlatformTime::Seconds() value, mapped onto the tracker clock */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Get Frame At Platform Time", ToolTip = "Gets the frame captured nearest to a local FPlatformTime seconds value, using the estimated tracker clock offset"))
+	bool GetFrameAtPlatformTime(double PlatformSeconds, FBeamFrame& OutFrame) const;
+
 	/** Gets latest interpolated frame for smooth rendering */
 	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Get Latest Interpolated Frame", ToolTip = "Gets latest interpolated frame for smooth rendering"))
 	bool GetLatestInterpolatedFrame(double DeltaSeconds, FBeamFrame& OutFrame) const;
 
+	/** Gets the newest frame extrapolated to when the frame being built now reaches the display (game thread only) */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Get Predicted Frame", ToolTip = "Extrapolates the newest frame to the expected display time of the current game frame using the configured prediction model"))
+	bool GetPredictedFrame(FBeamFrame& OutFrame);
+
+	/** Gets the newest frame extrapolated HorizonMs past its capture time (game thread only) */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Predict Frame", ToolTip = "Extrapolates the newest frame HorizonMs past its capture time using the configured prediction model"))
+	bool PredictFrame(float HorizonMs, FBeamFrame& OutFrame);
+
+	/** Registers a user of render-thread foveation; the gaze view extension exists while any user is registered */
+	void AddFoveationUser();
+
+	/** Releases a foveation user registered with AddFoveationUser */
+	void RemoveFoveationUser();
+
+	/** Active gaze view extension, or null when no foveation user is registered */
+	TSharedPtr<FBeamGazeViewExtension, ESPMode::ThreadSafe> GetGazeViewExtension() const { return GazeViewExtension; }
+
+	/** Applies the live gaze velocity estimate to an arbitrary sample (game thread only) */
+	FGazePoint PredictGazePoint(const FGazePoint& InSample, float HorizonMs);
+
+	/** Takes every frame published since the previous snapshot in one buffer flip (single batch consumer); nothing when the memory budget built the ring without snapshots */
+	int32 TakeFrameSnapshot(TArray<FBeamFrame>& OutFrames);
+
+	/** Copies buffered frames with SDK timestamps in [T0Ms, T1Ms], oldest first */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Copy Frames In Range", ToolTip = "Copies every buffered frame whose SDK timestamp lies in [T0Ms, T1Ms], oldest first. Returns the number of frames copied."))
+	int32 CopyFramesInRange(double T0Ms, double T1Ms, TArray<FBeamFrame>& OutFrames) const;
+
+	/** Copies the most recent Count buffered frames, oldest first */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Copy Latest Frames", ToolTip = "Copies the most recent Count buffered frames, oldest first. Returns the number of frames copied."))
+	int32 CopyLatestFrames(int32 Count, TArray<FBeamFrame>& OutFrames) const;
+
+	/** Zero-copy window access: Visitor receives up to two contiguous spans; returns false if the window was overwritten mid-visit */
+	bool VisitFramesInRange(double T0Ms, double T1Ms, TFunctionRef<void(TArrayView<const FBeamFrame>)> Visitor) const;
+
+	/** Same window as VisitFramesInRange as contiguous gaze/head columns, for consumers that never need whole frames */
+	bool VisitGazeColumnsInRange(double T0Ms, double T1Ms, TFunctionRef<void(const FBeamGazeColumns&)> Visitor) const;
+
+	/** Ring for background readers that follow it without consuming; valid until OnFrameRingReleased fires */
+	const FBeamFrameRing* GetFrameRing() const { return FrameBuffer; }
+
+	/** Lag and drop counters of every consumer draining the frame ring through its own cursor */
+	int32 GetFrameConsumerStats(TArray<FBeamRingConsumerStats>& OutStats) const;
+
+	/**
+	 * Ring of unfiltered frames for consumers that analyse the raw signal. When the producer filters,
+	 * raw frames are captured only while a raw capture user is registered and this is otherwise null;
+	 * when nothing filters it is the frame ring itself. Valid until OnFrameRingReleased fires.
+	 */
+	const FBeamFrameRing* GetRawFrameRing() const;
+
+	/** Registers a consumer of GetRawFrameRing; the producer copies pre-filter frames while any user is registered */
+	void AddRawCaptureUser();
+
+	/** Releases a user registered with AddRawCaptureUser */
+	void RemoveRawCaptureUser();
+
+	/**
+	 * Calls Observer with every frame the producer thread or playback publishes, on that thread. Frames a
+	 * data source pushes into the ring itself, with the producer thread disabled, are not observed
+	 */
+	void AddFrameObserver(const FBeamFrameObserverRef& Observer);
+
+	/** The producer may still deliver a frame it had already started on; the observer stays alive until it has */
+	void RemoveFrameObserver(const FBeamFrameObserverRef& Observer);
+
+	/** Broadcast on the game thread just before the frame ring is freed; background readers must stop by returning */
+	FSimpleMulticastDelegate OnFrameRingReleased;
+
+	/**
+	 * Notifies Delegate on the game thread whenever the latest frame moves past Thresholds.
+	 * The frame is fetched once per tick for all subscribers; subscribers with equal
+	 * thresholds share one evaluation. Remove with UnsubscribeFromFrameChanges.
+	 */
+	FDelegateHandle SubscribeToFrameChanges(const FBeamChangeThresholds& Thresholds, FOnBeamFrameChangedNative::FDelegate&& Delegate);
+
+	/** Removes a subscription made with SubscribeToFrameChanges */
+	void UnsubscribeFromFrameChanges(FDelegateHandle Handle);
+
+	/**
+	 * Calls Delegate on the game thread with frames at the rate View asks for. The ring is drained
+	 * through one cursor per tick for every view, and subscribers at the same rate share one
+	 * evaluation, so slow consumers need no throttling of their own. Remove with UnsubscribeFromFrameRate.
+	 */
+	FDelegateHandle SubscribeToFrameRate(const FBeamFrameRateView& View, FOnBeamRateViewFrameNative::FDelegate&& Delegate);
+
+	/** Removes a subscription made with SubscribeToFrameRate */
+	void UnsubscribeFromFrameRate(FDelegateHandle Handle);
+
+	/**
+	 * Calls Delegate on the game thread after new frames are published. Dispatch is coalesced:
+	 * however many frames arrive before the game thread runs it, listeners are called once.
+	 * Remove with RemoveNewFrameListener.
+	 */
+	FDelegateHandle AddNewFrameListener(FSimpleDelegate&& Delegate);
+
+	/** Removes a listener added with AddNewFrameListener */
+	void RemoveNewFrameListener(FDelegateHandle Handle);
+
 	// Vary function names - don't use "Get" for everything
 	UFUNCTION(BlueprintCallable, Category = "Beam")
 	FGazePoint CurrentGaze() const;
@@ -79,7 +233,7 @@ public:
 
 	/** Gets the current health status of the eye tracker */
 	UFUNCTION(BlueprintPure, Category = "BEAM|Status", meta = (DisplayName = "Get Health Status", ToolTip = "Returns the current health status of the eye tracker"))
-	EBeamHealth GetBeamHealth() const { return CurrentHealth; }
+	EBeamHealth GetBeamHealth() const { return CurrentHealth.load(std::memory_order_relaxed); }
 
 	/** Gets the current data source type */
 	UFUNCTION(BlueprintPure, Category = "BEAM|Status", meta = (DisplayName = "Get Data Source Type", ToolTip = "Returns the current data source type"))
@@ -99,24 +253,43 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "BEAM|Analytics", meta = (DisplayName = "Get Gaze Analytics", ToolTip = "Gets gaze analytics data including fixation duration, saccade velocity, and scan patterns"))
 	FGazeAnalytics GetGazeAnalytics() const;
 
-	/** Gets detailed calibration quality assessment */
-	UFUNCTION(BlueprintCallable, Category = "BEAM|Analytics", meta = (DisplayName = "Get Calibration Quality", ToolTip = "Gets detailed calibration quality assessment with per-eye scores and point analysis"))
+	/** Result of the last calibration validation; bValidated is false when none has run since the calibration was reset */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Analytics", meta = (DisplayName = "Get Calibration Quality", ToolTip = "Gets the last measured calibration quality assessment; not validated until a validation session has run"))
 	FCalibrationQuality GetCalibrationQuality() const;
 
-	/** Exports tracking data to CSV format for analysis */
-	UFUNCTION(BlueprintCallable, Category = "BEAM|Export", meta = (DisplayName = "Export Tracking Data", ToolTip = "Exports tracking data to CSV format for external analysis"))
+	/** Publishes a measured assessment (see FBeamCalibrationValidator) for GetCalibrationQuality */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Analytics", meta = (DisplayName = "Set Calibration Quality", ToolTip = "Publish a measured calibration assessment"))
+	void SetCalibrationQuality(const FCalibrationQuality& Quality);
+
+	/**
+	 * Exports the last DurationSeconds of buffered frames on a background task.
+	 * A .beamcol path writes the columnar format, anything else CSV. Returns true once the export has started.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Export", meta = (DisplayName = "Export Tracking Data", ToolTip = "Exports recent tracking data to CSV, or to the columnar format for a .beamcol path, on a background task"))
 	bool ExportTrackingData(const FString& FilePath, float DurationSeconds = 60.0f);
 
-	/** Gets system resource usage statistics */
-	UFUNCTION(BlueprintCallable, Category = "BEAM|System", meta = (DisplayName = "Get System Resources", ToolTip = "Gets current system resource usage including CPU, memory, and GPU"))
+	/** Streams every frame of a .beamrec recording to FilePath (CSV or .beamcol) on a background task; memory stays bounded for any recording length */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Export", meta = (DisplayName = "Export Recording", ToolTip = "Converts a .beamrec recording to CSV, or to the columnar format for a .beamcol path, on a background task"))
+	bool ExportRecording(const FString& RecordingPath, const FString& FilePath);
+
+	/** Plugin resource usage from the background sampler: CPU in percent of one core across Beam threads, memory in MB, GPU in percent of time spent in Beam render passes */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|System", meta = (DisplayName = "Get System Resources", ToolTip = "Gets the plugin's measured CPU (percent of one core across Beam threads), memory (MB) and GPU (percent of time in Beam render passes)"))
 	void GetSystemResources(float& OutCPUUsage, float& OutMemoryUsage, float& OutGPUUsage) const;
 
-	/** Gets current system health status */
+	/** Gets current system health status; the cached value the watchdog keeps, same as GetBeamHealth */
 	UFUNCTION(BlueprintPure, Category = "BEAM|Status", meta = (DisplayName = "Get Health", ToolTip = "Gets current system health status"))
-	EBeamHealth GetHealth() const;
+	EBeamHealth GetHealth() const { return GetBeamHealth(); }
 
-	/** Sets data source type and optionally file path */
-	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Set Data Source Type", ToolTip = "Sets data source type and optionally file path"))
+	/** Watchdog state (an EBeamWatchdogState value) and the delay before the next reconnect attempt in seconds */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Status", meta = (DisplayName = "Get Watchdog Status", ToolTip = "Gets the watchdog state (Disabled, Monitoring, Recovering) and the delay before the next reconnect attempt"))
+	void GetWatchdogStatus(int32& OutStatus, float& OutRetryDelay) const;
+
+	/** True while the watchdog rebuilds the SDK connection; frames read meanwhile are the last good one, flagged bStale */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Status", meta = (DisplayName = "Is Tracking Stale", ToolTip = "True while the tracker connection is being rebuilt and gaze is not advancing"))
+	bool IsTrackingStale() const { return bWatchdogRecovering.load(std::memory_order_acquire); }
+
+	/** Swaps the data source; FilePath is the .beamrec for File/Recorded and the listen endpoint ("port" or "address:port") for Network */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Tracking", meta = (DisplayName = "Set Data Source Type", ToolTip = "Swaps the data source, restarting tracking if it was running. File path is the recording for File/Recorded and the listen endpoint for Network"))
 	void SetDataSourceType(EBeamDataSourceType NewType, const FString& FilePath = TEXT(""));
 
 	/** Checks if an actor has a tagged beam component */
@@ -130,6 +303,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Beam")
 	bool ProjectGazeToWorld(const APlayerController* PlayerController, FVector& OutRayOrigin, FVector& OutRayDirection) const;
 
+	/**
+	 * Gaze ray through PlayerController's view, or the first local player's when null. The view is captured at most
+	 * once per engine frame and again right after the camera update, so every caller in a frame shares one ray (game thread)
+	 */
+	bool GetGazeWorldRay(const APlayerController* PlayerController, FBeamWorldRay& OutRay) const;
+
+	/** Deprojects a viewport pixel position through the same cached view as GetGazeWorldRay (game thread) */
+	bool DeprojectScreenPosition(const APlayerController* PlayerController, const FVector2D& ScreenPositionPx, FVector& OutOrigin, FVector& OutDirection) const;
+
 	// Buffer and performance functions
 	UFUNCTION(BlueprintPure, Category = "Beam")
 	float GetBufferUtilization() const;
@@ -137,6 +319,28 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Beam")
 	float GetTrackingFPS() const;
 
+	/**
+	 * Age of the latest frame relative to the fastest delivery seen, in milliseconds; negative when no
+	 * frame is available. Capture times are mapped with the clock sync's lower-envelope offset, which
+	 * absorbs the minimum transport delay, so this is not absolute capture latency: a steady 0 means
+	 * frames arrive as fast as they ever have, and growth shows added delay or a stalled stream.
+	 */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Status", meta = (DisplayName = "Get Capture Latency", ToolTip = "Milliseconds the latest frame is older than the fastest delivery seen; relative to the minimum transport delay, not absolute capture latency"))
+	float GetCaptureLatencyMs() const;
+
+	/** Game thread: the status snapshots published at MonitorSnapshotRateHz, newest last */
+	const FBeamMonitorHistory& GetMonitorHistory() const { return MonitorHistory; }
+
+	/** Game thread: the newest published snapshot; its Sequence is 0 before the first publish */
+	const FBeamMonitorSnapshot& GetMonitorSnapshot() const { return MonitorHistory.GetLatest(); }
+
+	/** Rate the monitor snapshots are published at */
+	static constexpr float MonitorSnapshotRateHz = 10.0f;
+
+	/** Estimated FPlatformTime minus tracker clock, in milliseconds; false when the data source stamps frames locally */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Status", meta = (DisplayName = "Get Tracker Clock Offset"))
+	bool GetTrackerClockOffsetMs(double& OutOffsetMs) const;
+
 	// Alias function - keep simple
 	UFUNCTION(BlueprintPure, Category = "Beam")
 	float GetCurrentFPS() const { return GetTrackingFPS(); }
@@ -148,6 +352,52 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Beam")
 	void SetPollingRate(int32 NewRateHz);
 
+	/** Wake strategy the producer thread is running right now */
+	UFUNCTION(BlueprintPure, Category = "Beam")
+	EBeamProducerWakeMode GetProducerWakeMode() const;
+
+	/** Tracker frame rate measured by the producer thread; 0 until frames arrive */
+	UFUNCTION(BlueprintPure, Category = "Beam")
+	float GetObservedTrackerRateHz() const;
+
+	/** Frames lost at each stage of the pipeline since the subsystem started */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Status", meta = (DisplayName = "Get Drop Counts", ToolTip = "Frames lost by the source, overwritten in the ring and missed by ring consumers"))
+	FBeamDropCounts GetDropCounts() const;
+
+	/** Registers a user of adaptive producer wake; it stays on while any user is registered, whatever the project setting */
+	void AddAdaptivePollingUser();
+
+	/** Releases a user registered with AddAdaptivePollingUser */
+	void RemoveAdaptivePollingUser();
+
+	// Additional trackers; id 0 always names the primary pipeline above
+
+	/**
+	 * Adds a tracker with its own source, ring and filters, serviced on the shared task pool. Endpoint is the
+	 * recording path or network address, as for SwitchDataSource. Returns the new id, or INDEX_NONE on failure
+	 */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Trackers", meta = (DisplayName = "Add Tracker"))
+	int32 AddTracker(EBeamDataSourceType SourceType, const FString& Endpoint, FName Name);
+
+	/** Stops and frees an added tracker; the primary pipeline cannot be removed */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Trackers", meta = (DisplayName = "Remove Tracker"))
+	bool RemoveTracker(int32 TrackerId);
+
+	/** Ids of the primary pipeline and every added tracker */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Trackers", meta = (DisplayName = "Get Tracker Ids"))
+	void GetTrackerIds(TArray<int32>& OutTrackerIds) const;
+
+	/** Latest filtered frame of one tracker; id 0 is the same as FetchCurrentFrame */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Trackers", meta = (DisplayName = "Fetch Tracker Frame"))
+	bool FetchTrackerFrame(int32 TrackerId, FBeamFrame& OutFrame) const;
+
+	/** Running statistics of an added tracker; TrackerId is INDEX_NONE in the result for unknown ids */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Trackers", meta = (DisplayName = "Get Tracker Stats"))
+	FBeamTrackerStats GetTrackerStats(int32 TrackerId) const;
+
+	/** Frame ring of one tracker, or null; valid until the tracker is removed or the subsystem deinitializes (game thread) */
+	const FBeamFrameRing* GetTrackerRing(int32 TrackerId) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Beam")
 	void SetSmoothingEnabled(bool bEnabled);
 
@@ -157,6 +407,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Beam")
 	void SetBeta(float NewBeta);
 
+	/** Sets both One-Euro parameters of the producer filters at once */
+	UFUNCTION(BlueprintCallable, Category = "Beam")
+	void SetOneEuroParams(float NewMinCutoff, float NewBeta);
+
+	/** One-Euro parameters currently applied to the producer filters */
+	UFUNCTION(BlueprintPure, Category = "Beam")
+	void GetOneEuroParams(float& OutMinCutoff, float& OutBeta) const;
+
 	UFUNCTION(BlueprintPure, Category = "Beam")
 	bool IsCalibrated() const;
 
@@ -169,9 +427,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Beam")
 	void SetFilterType(EBeamFilterType NewFilterType);
 
+	/** Hot-applies the runtime fields of NewSettings and schedules a debounced config save */
 	UFUNCTION(BlueprintCallable, Category = "Beam")
 	void ApplyRuntimeSettings(const UBeamEyeTrackerSettings* NewSettings);
 
+	/** Publishes NewSettings as the current snapshot and schedules a debounced config save */
+	void ApplyRuntimeSnapshot(const FBeamRuntimeSettings& NewSettings);
+
+	/** Current settings snapshot; never null after Initialize */
+	TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> GetRuntimeSettings() const;
+
+	/** Version of the current snapshot; readers compare it per frame and call GetRuntimeSettings only when it moved */
+	uint32 GetRuntimeSettingsVersion() const { return RuntimeSettingsVersion.load(std::memory_order_acquire); }
+
+	/** Seconds without further changes before a runtime settings change is written to config */
+	static constexpr double SettingsSaveDelaySeconds = 2.0;
+
 	UFUNCTION(BlueprintPure, Category = "Beam")
 	void GetEffectiveRuntimeSettings(int32& OutPollingHz, bool& OutEnableSmoothing, float& OutMinCutoff, float& OutBeta, float& OutTraceDistance) const;
 
@@ -201,6 +472,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Beam")
 	bool IsCalibrating() const;
 
+	/** Calibration profile of the current user; stays set after calibration stops until ResetCalibration */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Calibration", meta = (DisplayName = "Get Calibration Profile"))
+	FString GetCalibrationProfile() const { return CurrentCalibrationProfile; }
+
 	UFUNCTION(BlueprintCallable, Category = "Beam")
 	bool StartRecording(const FString& FilePath = TEXT(""));
 
@@ -219,6 +494,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Beam")
 	bool IsPlayingBack() const;
 
+	/** Streams every published frame over UDP; empty destinations use the multicast group plus the configured unicast list */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Network", meta = (DisplayName = "Start Network Streaming", ToolTip = "Streams every published frame over UDP to a comma-separated list of address:port destinations. Empty uses the configured multicast group and destinations"))
+	bool StartNetworkStreaming(const FString& Destinations = TEXT(""));
+
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Network", meta = (DisplayName = "Stop Network Streaming"))
+	void StopNetworkStreaming();
+
+	UFUNCTION(BlueprintPure, Category = "BEAM|Network", meta = (DisplayName = "Is Network Streaming"))
+	bool IsNetworkStreaming() const;
+
 	/** Gets the current viewport dimensions - essential for coordinate mapping */
 	UFUNCTION(BlueprintPure, Category = "BEAM|Viewport", meta = (DisplayName = "Get Viewport Dimensions", ToolTip = "Returns the current viewport dimensions. Essential for accurate coordinate mapping. All parameters are output parameters that get filled with current values. Use this to check viewport size before calling UpdateViewportGeometry()."))
 	void GetViewportDimensions(int32& OutWidth, int32& OutHeight) const;
@@ -227,10 +512,59 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "BEAM|Viewport", meta = (DisplayName = "Update Viewport Dimensions", ToolTip = "Updates viewport dimensions for proper coordinate mapping. Convenience function that automatically detects current viewport size. Call this in BeginPlay() or when viewport changes. Equivalent to calling AutoUpdateViewport()."))
 	void UpdateViewportDimensions();
 
+	/**
+	 * Adds a viewport (extra monitor window, additional PIE window) that gaze can be mapped into.
+	 * The game instance's own viewport is registered automatically and is primary by default.
+	 * Unregister before the viewport is destroyed.
+	 */
+	int32 RegisterGazeViewport(FSceneViewport* Viewport);
+	void UnregisterGazeViewport(int32 ViewportId);
+
+	/** Makes a registered viewport the one the tracker normalizes gaze against */
+	UFUNCTION(BlueprintCallable, Category = "BEAM|Viewport", meta = (DisplayName = "Set Primary Gaze Viewport", ToolTip = "Makes a registered viewport the one the tracker normalizes gaze against"))
+	bool SetPrimaryGazeViewport(int32 ViewportId);
+
+	UFUNCTION(BlueprintPure, Category = "BEAM|Viewport", meta = (DisplayName = "Get Primary Gaze Viewport", ToolTip = "Id of the viewport the tracker normalizes gaze against, -1 if none is registered"))
+	int32 GetPrimaryGazeViewport() const;
+
+	/** Latest gaze in a registered viewport's 0..1 space; values outside 0..1 mean the user looks outside that viewport */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Viewport", meta = (DisplayName = "Get Gaze In Viewport", ToolTip = "Latest gaze in a registered viewport's 0..1 space; values outside 0..1 mean the user looks outside it"))
+	bool GetGazeInViewport(int32 ViewportId, FVector2D& OutScreen01) const;
+
+	/** Latest gaze in a local player's split-screen view, 0..1 over that player's part of its viewport */
+	UFUNCTION(BlueprintPure, Category = "BEAM|Viewport", meta = (DisplayName = "Get Gaze For Player", ToolTip = "Latest gaze in a local player's split-screen view, 0..1 over that player's part of the viewport"))
+	bool GetGazeForPlayer(const APlayerController* PlayerController, FVector2D& OutScreen01) const;
+
 private:
 	bool bIsTracking = false;
 
-	EBeamHealth CurrentHealth = EBeamHealth::AppNotRunning;
+	/** Written on the game thread only; atomic so per-frame health checks from anywhere are a plain load */
+	std::atomic<EBeamHealth> CurrentHealth{ EBeamHealth::AppNotRunning };
+
+	/** Updates CurrentHealth and broadcasts OnHealthChanged when it changed */
+	void SetHealth(EBeamHealth NewHealth);
+
+	/** Derives health from the data source, ring and watchdog state; what the watchdog feeds to SetHealth */
+	EBeamHealth EvaluateHealth() const;
+
+	/** Background start in flight; the worker owns DataSource until it completes */
+	TFuture<void> PendingStart;
+	std::atomic<bool> bStartPending{ false };
+
+	/** Bumped per asynchronous start so a completion queued before a stop/restart is ignored */
+	uint32 StartSerial = 0;
+
+	/** Blocks until a pending asynchronous start has finished touching DataSource */
+	void WaitForPendingStart();
+
+	/** Game-thread completion of StartBeamTrackingAsync */
+	void FinishAsyncStart(uint32 Serial, bool bDllSafe, bool bInitialized);
+
+	/** Per-session setup once the data source is valid: predictor reset and producer thread start */
+	void BeginTrackingSession();
+
+	/** SDK client DLL loaded ahead of its first delay-loaded call */
+	void* SDKDllHandle = nullptr;
 
 	/** Current data source type */
 	EBeamDataSourceType DataSourceType = EBeamDataSourceType::Live;
@@ -243,55 +577,306 @@ private:
 	UBeamEyeTrackerSettings* Settings = nullptr;
 
 	/** Frame buffer for data storage */
-	FBeamRing* FrameBuffer;
+	FBeamFrameRing* FrameBuffer;
 
 	/** Data source interface */
 	IBeamDataSource* DataSource;
 
+	/** Game-thread frame cache keyed by GFrameCounter; FrameCacheCounter is MAX_uint64 while empty */
+	mutable FBeamFrame FrameCache;
+	mutable uint64 FrameCacheCounter = MAX_uint64;
+
+	/** Latest frame straight from the ring or data source, bypassing the cache */
+	bool FetchCurrentFrameUncached(FBeamFrame& OutFrame) const;
+
+	/** One-Euro parameters of the current snapshot, kept for game-thread getters */
+	FOneEuroFilterParams OneEuroParams;
+
+	/** Current settings snapshot; the lock only guards swapping the pointer, readers gate on the version first */
+	TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> RuntimeSettings;
+	mutable FCriticalSection RuntimeSettingsLock;
+	std::atomic<uint32> RuntimeSettingsVersion{ 0 };
+
+	/** Game thread: stamps the next version on NewSettings and makes it current */
+	void PublishRuntimeSettings(FBeamRuntimeSettings NewSettings);
+
+	/** Brings the filters in line with a snapshot; called by the producer, or directly while it is not running */
+	void ApplyRuntimeSettingsToFilters(const FBeamRuntimeSettings& Snapshot);
+
+	/** Snapshot waiting to be written to config once changes have settled */
+	TOptional<FBeamRuntimeSettings> PendingSettingsSave;
+	double SettingsSaveDueSeconds = 0.0;
+	FTSTicker::FDelegateHandle SettingsSaveTickerHandle;
+	void RequestSettingsSave(const FBeamRuntimeSettings& Snapshot);
+	bool TickSettingsSave(float DeltaTime);
+	void FlushSettingsSave();
+
+	/** Unfiltered frame copies, allocated for the first raw capture user and kept until Deinitialize */
+	FBeamFrameRing* RawFrameBuffer = nullptr;
+
+	/** RawFrameBuffer while raw capture users exist, read by the producer before it filters */
+	std::atomic<FBeamFrameRing*> RawFrameSink{ nullptr };
+	int32 RawCaptureUserCount = 0;
+
+	/** Copy-on-write observer list; publishers re-fetch it only when the version moved, like the runtime settings */
+	using FFrameObserverList = TArray<FBeamFrameObserverRef>;
+	TSharedPtr<const FFrameObserverList, ESPMode::ThreadSafe> FrameObservers;
+	mutable FCriticalSection FrameObserversLock;
+	std::atomic<uint32> FrameObserversVersion{ 0 };
+	TSharedPtr<const FFrameObserverList, ESPMode::ThreadSafe> GetFrameObservers() const;
+
 	/** Gaze smoothing filter */
 	FBeamFilters* Filters;
 
+	/** Game-thread gaze predictor, fed from FrameBuffer on demand */
+	FBeamGazePredictor* Predictor;
+
+	/** Reused window for feeding Predictor without per-call allocation */
+	TArray<FBeamFrame> PredictorScratch;
+
+	/** Feeds Predictor every frame published since it last ran */
+	void UpdatePredictor();
+
+	/** Late-latching render-thread gaze sampler for foveation */
+	TSharedPtr<FBeamGazeViewExtension, ESPMode::ThreadSafe> GazeViewExtension;
+
+	/** Number of components that requested foveation */
+	int32 FoveationUserCount = 0;
+
+	/** Detaches the view extension and waits for the render thread to stop reading the ring */
+	void ReleaseGazeViewExtension();
+
+#if BEAM_FEATURE_RECORDED_DATA
 	/** Recording system (dev only) */
-	FBeamRecording* Recording;
+	FBeamRecording* Recording = nullptr;
+#endif
 
+#if BEAM_FEATURE_UNREAL_INSIGHTS
 	/** Tracing system */
-	FBeamTrace* Tracing;
+	FBeamTrace* Tracing = nullptr;
+#endif
 
-	/** Background thread for polling */
+	/** UDP stream of FrameBuffer, created on demand */
+	FBeamNetStreamServer* NetStreamServer = nullptr;
+
+	/** Default stream endpoint: the multicast group on the listen port, or just the port without a group */
+	FString GetDefaultNetworkEndpoint() const;
+
+	/** Background producer thread feeding FrameBuffer */
 	FRunnableThread* PollingThread;
 
+	/** Runnable executed by PollingThread */
+	FRunnable* PollingRunnable;
+
 	/** Stop flag for the polling thread */
 	FThreadSafeBool bStopPolling;
 
+	/** Packed FBeamProducerSchedule; written by the game thread, read by the producer once per wake */
+	std::atomic<uint32> ProducerSchedule{ 0 };
+
+	/** Mode the producer actually runs, after falling back for sources that cannot signal frames */
+	std::atomic<uint8> ActiveWakeMode{ static_cast<uint8>(EBeamProducerWakeMode::BlockingWait) };
+
+	/** Written by the producer from tracker timestamps while it waits on the source */
+	std::atomic<float> ObservedTrackerHz{ 0.0f };
+
+	/** FrameId gaps seen by the producer; decimated gaps are the ones a timed poll skips on purpose */
+	std::atomic<uint64> SourceDroppedFrames{ 0 };
+	std::atomic<uint64> SourceDecimatedFrames{ 0 };
+
+	/** Wakes a sleeping producer: triggered by the source per frame when event-driven, and on schedule changes and shutdown */
+	FEvent* ProducerWakeEvent = nullptr;
+
+	/** Components that asked for adaptive wake */
+	int32 AdaptivePollingUserCount = 0;
+
+	/** Game-thread estimate of the engine frame rate */
+	float EngineFrameHz = 0.0f;
+
+	/** Re-evaluates focus, power and rates a few times a second */
+	FTSTicker::FDelegateHandle PollingScheduleTickerHandle;
+	bool TickPollingSchedule(float DeltaTime);
+
+	/** Recomputes the producer schedule and wakes the producer when it changed */
+	void UpdatePollingSchedule();
+
 	/** Performance tracking */
 	double LastFrameTime = 0.0;
 	double FrameTimeSum = 0.0;
 	int32 FrameCount = 0;
 
-	/** Watchdog recovery state */
-	double LastDataTime = 0.0;
-	int32 ConsecutiveFailures = 0;
-	double RecoveryBackoffTime = 0.0;
+	/** Registered viewports and their cached gaze transforms */
+	FBeamViewportRegistry* ViewportRegistry = nullptr;
+
+	/** Trackers added with AddTracker; the primary source above is not part of it */
+	FBeamTrackerRegistry* TrackerRegistry = nullptr;
+	FDelegateHandle ViewportCreatedHandle;
+	FDelegateHandle ViewportResizedHandle;
+
+	/** View of one local player captured for gaze deprojection, stamped with the GFrameCounter it was taken in */
+	struct FGazeRayView
+	{
+		TWeakObjectPtr<const APlayerController> PlayerController;
+		uint64 FrameCounter = MAX_uint64;
+		FMatrix InvViewProjection = FMatrix::Identity;
+		FIntRect ViewRect;
+		FVector2D ViewportSize = FVector2D::ZeroVector;
+		FBeamWorldRay GazeRay;
+		bool bViewValid = false;
+	};
+
+	/** One entry per local player that asked for a ray; refreshed after each camera update while it lives */
+	mutable TArray<FGazeRayView, TInlineAllocator<4>> GazeRayViews;
+	FDelegateHandle PostActorTickHandle;
+
+	/** Entry for PlayerController (or the first local player), captured this frame; nullptr without a local player */
+	const FGazeRayView* FindGazeRayView(const APlayerController* PlayerController) const;
+	void CaptureGazeRayView(FGazeRayView& View) const;
+
+	/** Recaptures every cached view once cameras have moved and hands the primary ray to the render thread */
+	void HandlePostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/** Window moves raise no engine event, so the cached rectangles are compared a few times a second */
+	FTSTicker::FDelegateHandle ViewportMoveTickerHandle;
+	bool TickViewportMapping(float DeltaTime);
+
+	/** Registers this game instance's viewport once it exists */
+	void RegisterGameViewport();
+	void HandleViewportResized(FViewport* Viewport, uint32 Unused);
+
+	/** Hands the primary viewport's desktop rectangle to the data source, unless another thread owns it right now */
+	void PushPrimaryViewportRect();
+
+	/** Watchdog recovery state; written by whichever thread runs the recovery, read by the game thread */
+	std::atomic<double> LastDataTime{ 0.0 };
+	bool bTrackingSessionActive = false;
+	std::atomic<int32> ConsecutiveFailures{ 0 };
+	std::atomic<double> RecoveryBackoffTime{ 0.0 };
+	std::atomic<bool> bWatchdogRecovering{ false };
+
+	/** Push mode has no producer thread to own the recovery, so it runs as a pool task */
+	TFuture<void> WatchdogRecoveryTask;
+	FThreadSafeBool bStopWatchdogRecovery;
+
+	/** Game-thread stall check; reconnecting itself never runs here */
+	FTSTicker::FDelegateHandle WatchdogTickerHandle;
+	bool TickWatchdog(float DeltaTime);
+
+	/** True when a live session is running that the watchdog should watch */
+	bool IsWatchdogActive() const;
+
+	/**
+	 * Seconds since the source last showed signs of life: a published frame, or a state set the SDK delivered
+	 * without one (no user in front of the tracker). Measured from the session start until the first of either.
+	 */
+	double GetSecondsSinceSourceActivity(double NowSeconds) const;
+
+	/** Tears down and rebuilds the SDK listener with exponential backoff until it comes back or bStop is raised */
+	void RunWatchdogRecovery(const FThreadSafeBool& bStop);
+
+	/** Stops and waits for a push-mode recovery task */
+	void StopWatchdogRecovery();
 
 	/** Calibration state */
 	bool bIsCalibrating = false;
 	FString CurrentCalibrationProfile;
+	FCalibrationQuality LastCalibrationQuality;
 
 	/** Filter configuration */
 	EBeamFilterType CurrentFilterType = EBeamFilterType::None;
 
-	/** Recording state */
-	bool bIsRecording = false;
+#if BEAM_FEATURE_RECORDED_DATA
+	/** Recording state; frames are copied out of FrameBuffer on the game thread into Recording */
 	FString RecordingFilePath;
-	FArchive* RecordingFile;
-	double RecordingStartTime = 0.0;
+	int32 RecordingConsumerId = INDEX_NONE;
+	TArray<FBeamFrame> RecordingScratch;
 
-	/** Playback state */
-	bool bIsPlayingBack = false;
+	/** Playback state; recorded frames are republished into FrameBuffer at their original pace */
 	FString PlaybackFilePath;
-	TArray<FString> PlaybackLines;
-	int32 CurrentPlaybackLine = 0;
 	double PlaybackStartTime = 0.0;
+	double PlaybackFirstTimestampMs = 0.0;
+
+	/** Game-thread ticker driving recording and playback while either is active */
+	FTSTicker::FDelegateHandle RecordingTickerHandle;
+#endif
+
+	/** Change subscribers, driven by SubscriptionTickerHandle while any exist */
+	FBeamFrameSubscriptions FrameSubscriptions;
+	FTSTicker::FDelegateHandle SubscriptionTickerHandle;
+	int64 LastSubscriptionFrameId = -1;
+	double LastSubscriptionTimestampMs = 0.0;
+
+	/** Ticker callback: evaluates the latest frame for every change subscriber */
+	bool TickFrameSubscriptions(float DeltaTime);
+
+	/** Rate views, fed through RateViewConsumerId by RateViewTickerHandle while any exist */
+	FBeamFrameRateViews FrameRateViews;
+	FTSTicker::FDelegateHandle RateViewTickerHandle;
+	int32 RateViewConsumerId = INDEX_NONE;
+	uint32 RateViewClearCount = 0;
+	TArray<FBeamFrame> RateViewScratch;
+
+	/** Ticker callback: drains frames published since the last tick into every rate view */
+	bool TickFrameRateViews(float DeltaTime);
+
+	/** Removes the rate view ticker and releases its ring cursor */
+	void StopFrameRateViews();
+
+	/** New-frame listeners; the producer queues at most one game-thread dispatch for them at a time */
+	FSimpleMulticastDelegate NewFrameListeners;
+	std::atomic<int32> NumNewFrameListeners{0};
+	std::atomic<bool> bNewFrameDispatchQueued{false};
+
+	/** Without a producer thread frames reach the ring from the SDK callback, so the game thread watches for them */
+	FTSTicker::FDelegateHandle NewFrameTickerHandle;
+	int64 LastNewFrameId = -1;
+
+	/** Any thread: queues a coalesced game-thread dispatch to the new-frame listeners */
+	void QueueNewFrameDispatch();
+
+	/** Game thread: clears the queued flag, then calls the listeners */
+	void DispatchNewFrame();
+
+	bool TickNewFrameListeners(float DeltaTime);
+
+	/** Pushes latency percentiles to "stat Beam" and Insights */
+	FTSTicker::FDelegateHandle LatencyStatsTickerHandle;
+	bool TickLatencyStats(float DeltaTime);
+
+	/** Drop counts already reported per ring consumer slot, so each loss is logged once */
+	uint64 ReportedConsumerDrops[BEAM_RING_MAX_CONSUMERS] = {};
+
+	/** Warns about consumers the producer lapped since the last report */
+	void ReportSlowConsumers();
+
+	/** Pushes the drop counters to "stat Beam" and Insights */
+	void PublishDropStats() const;
+
+	/** Samples the status into MonitorHistory at MonitorSnapshotRateHz */
+	FTSTicker::FDelegateHandle MonitorSnapshotTickerHandle;
+	FBeamMonitorHistory MonitorHistory;
+	uint32 MonitorSequence = 0;
+	bool TickMonitorSnapshot(float DeltaTime);
+
+#if BEAM_FEATURE_RECORDED_DATA
+	/** Registers or removes the recording ticker to match the recording/playback state */
+	void UpdateRecordingTicker();
+
+	/** Ticker callback: records new frames and publishes due playback frames */
+	bool TickRecordingAndPlayback(float DeltaTime);
+
+	/** Records every frame published since the previous call */
+	void RecordNewFrames();
+
+	/** Publishes every playback frame whose time has come */
+	void PumpPlayback();
+
+	/** Hands FrameBuffer back to the live producer after playback */
+	void RestoreLiveIngestion();
+
+	/** Record a frame to the recording file if recording is active */
+	void RecordFrame(const FBeamFrame& Frame);
+#endif
 
 	/** Start the background polling thread */
 	void StartPollingThread();
@@ -305,7 +890,7 @@ private:
 	/** Update health status based on data source */
 	void UpdateHealthStatus();
 
-	/** Create data source of specified type */
+	/** Creates a data source of the given type; nullptr if the type is unsupported or its path is missing */
 	IBeamDataSource* CreateDataSource(EBeamDataSourceType Type, const FString& FilePath = TEXT(""));
 
 	/** Apply smoothing to gaze data if enabled */
@@ -317,14 +902,13 @@ private:
 	/** DLL safety verification */
 	bool VerifyDLLSafety();
 
+#if BEAM_FEATURE_UNREAL_INSIGHTS
 	/** Initialize tracing system */
 	void InitializeTracing();
+#endif
 
 	/** Update performance metrics */
 	void UpdatePerformanceMetrics();
-	
-	/** Record a frame to the recording file if recording is active */
-	void RecordFrame(const FBeamFrame& Frame);
 
 };
 
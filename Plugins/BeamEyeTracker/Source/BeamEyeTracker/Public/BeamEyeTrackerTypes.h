@@ -27,6 +27,24 @@ enum class EBeamHealth : uint8
 	Error UMETA(DisplayName = "Error")
 };
 
+// Watchdog state, reported through GetWatchdogStatus
+UENUM(BlueprintType)
+enum class EBeamWatchdogState : uint8
+{
+	Disabled UMETA(DisplayName = "Disabled", ToolTip = "Watchdog off, or no live session to watch"),
+	Monitoring UMETA(DisplayName = "Monitoring", ToolTip = "Frames are arriving within the stall timeout"),
+	Recovering UMETA(DisplayName = "Recovering", ToolTip = "The session stalled and the SDK connection is being rebuilt")
+};
+
+/** How the producer thread wakes up for the next tracking frame */
+UENUM(BlueprintType)
+enum class EBeamProducerWakeMode : uint8
+{
+	EventDriven UMETA(DisplayName = "Event Driven", ToolTip = "Sleeps until the data source signals a new frame"),
+	BlockingWait UMETA(DisplayName = "Blocking Wait", ToolTip = "Blocks inside the data source until a new frame arrives"),
+	TimedPoll UMETA(DisplayName = "Timed Poll", ToolTip = "Sleeps a fixed interval, then takes the newest frame")
+};
+
 // Data source types
 UENUM()
 enum class EBeamDataSourceType : uint8
@@ -98,9 +116,13 @@ struct FHeadPose
 	UPROPERTY(BlueprintReadWrite, Category = "Head Pose", meta = (ToolTip = "Head position in centimeters in document coordinate space"))
 	FVector PositionCm = FVector::ZeroVector;
 	
-	/** Head rotation in degrees (pitch, yaw, roll) */
+	/** Head rotation in degrees (pitch, yaw, roll); Blueprint mirror of RotationQuat, never blended or extrapolated itself */
 	UPROPERTY(BlueprintReadWrite, Category = "Head Pose", meta = (ToolTip = "Head rotation in degrees (pitch, yaw, roll)"))
 	FRotator Rotation = FRotator::ZeroRotator;
+
+	/** Head rotation as a unit quaternion; the representation interpolation, filtering and prediction work on */
+	UPROPERTY(BlueprintReadWrite, Category = "Head Pose", meta = (ToolTip = "Head rotation as a unit quaternion, matching Rotation"))
+	FQuat RotationQuat = FQuat::Identity;
 	
 	/** Timestamp when this head pose was captured (milliseconds) */
 	UPROPERTY(BlueprintReadWrite, Category = "Head Pose", meta = (ToolTip = "Timestamp when this head pose was captured (milliseconds)"))
@@ -113,6 +135,66 @@ struct FHeadPose
 	/** Session UID for tracking consecutive frames (increments when tracking is lost and regained) */
 	UPROPERTY(BlueprintReadWrite, Category = "Head Pose", meta = (ToolTip = "Session UID for tracking consecutive frames (increments when tracking is lost and regained)"))
 	int64 TrackSessionUID = 0;
+
+	/** Sets both rotation representations from Euler angles */
+	void SetRotation(const FRotator& InRotation)
+	{
+		Rotation = InRotation;
+		RotationQuat = InRotation.Quaternion();
+	}
+
+	/** Sets both rotation representations from a unit quaternion */
+	void SetRotation(const FQuat& InRotation)
+	{
+		RotationQuat = InRotation;
+		Rotation = InRotation.Rotator();
+	}
+};
+
+namespace BeamRotation
+{
+	/**
+	 * Shortest-arc normalized lerp of two unit quaternions. Tracker frames are a few degrees apart, where this matches
+	 * slerp to well under a hundredth of a degree without the acos and sines; FQuat arithmetic is vectorized
+	 */
+	FORCEINLINE FQuat Nlerp(const FQuat& A, const FQuat& B, double Alpha)
+	{
+		return FQuat::FastLerp(A, B, Alpha).GetNormalized();
+	}
+
+	/** Continues the rotation from Previous to Latest by Scale times that step, about the same axis */
+	FORCEINLINE FQuat Extrapolate(const FQuat& Previous, const FQuat& Latest, double Scale)
+	{
+		FQuat Step = Latest * Previous.Inverse();
+		Step.EnforceShortestArcWith(FQuat::Identity);
+
+		FVector Axis;
+		double Angle;
+		Step.ToAxisAndAngle(Axis, Angle);
+		return (FQuat(Axis, Angle * Scale) * Latest).GetNormalized();
+	}
+}
+
+/**
+ * Sim game camera offset computed by the SDK for one tracking frame.
+ * Already converted to Unreal conventions and relative to the game camera: X forward, Y right, Z up.
+ */
+USTRUCT(BlueprintType)
+struct FBeamSimCameraTransform
+{
+	GENERATED_BODY()
+
+	/** True when the SDK supplied a camera state for this frame */
+	UPROPERTY(BlueprintReadWrite, Category = "Sim Camera", meta = (ToolTip = "True when the SDK supplied a camera state for this frame"))
+	bool bValid = false;
+
+	/** Rotation to add on top of the game camera */
+	UPROPERTY(BlueprintReadWrite, Category = "Sim Camera", meta = (ToolTip = "Rotation to add on top of the game camera, in degrees"))
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	/** Translation in camera space */
+	UPROPERTY(BlueprintReadWrite, Category = "Sim Camera", meta = (ToolTip = "Translation in camera space, in centimeters"))
+	FVector TranslationCm = FVector::ZeroVector;
 };
 
 /**
@@ -150,6 +232,44 @@ struct FBeamFrame
 	/** Frame delta time in seconds for frame rate calculations */
 	UPROPERTY(BlueprintReadWrite, Category = "Beam Frame", meta = (ToolTip = "Frame delta time in seconds for frame rate calculations"))
 	double DeltaTimeSeconds = 0.0;
+
+	/** True when a filter estimated the velocities below; prediction then extrapolates from them directly */
+	UPROPERTY(BlueprintReadWrite, Category = "Beam Frame", meta = (ToolTip = "True when the filter estimated gaze and head velocities for this frame"))
+	bool bHasVelocity = false;
+
+	/** Filtered gaze velocity in Screen01 units per second */
+	UPROPERTY(BlueprintReadWrite, Category = "Beam Frame", meta = (ToolTip = "Filtered gaze velocity in Screen01 units per second"))
+	FVector2D GazeVelocity01 = FVector2D::ZeroVector;
+
+	/** Filtered head velocity in centimeters per second */
+	UPROPERTY(BlueprintReadWrite, Category = "Beam Frame", meta = (ToolTip = "Filtered head velocity in centimeters per second"))
+	FVector HeadVelocityCm = FVector::ZeroVector;
+
+	/** Filtered head angular velocity in degrees per second */
+	UPROPERTY(BlueprintReadWrite, Category = "Beam Frame", meta = (ToolTip = "Filtered head angular velocity in degrees per second"))
+	FRotator HeadAngularVelocityDeg = FRotator::ZeroRotator;
+
+	/** True when the gaze of this frame was held or extrapolated through a tracking gap rather than measured */
+	UPROPERTY(BlueprintReadWrite, Category = "Beam Frame", meta = (ToolTip = "True when the gaze was synthesized through a short tracking gap such as a blink"))
+	bool bGazeSynthesized = false;
+
+	/** True when the head pose of this frame was held or extrapolated through a tracking gap rather than measured */
+	UPROPERTY(BlueprintReadWrite, Category = "Beam Frame", meta = (ToolTip = "True when the head pose was synthesized through a short tracking gap"))
+	bool bHeadSynthesized = false;
+
+	/** True when the tracker connection is being rebuilt and this is the last frame received before it dropped */
+	UPROPERTY(BlueprintReadWrite, Category = "Beam Frame", meta = (ToolTip = "True while the watchdog reconnects; the frame is the last good one and is not advancing"))
+	bool bStale = false;
+
+	/** Sim game camera parameters, computed once on the thread that converted the SDK frame */
+	UPROPERTY(BlueprintReadWrite, Category = "Beam Frame", meta = (ToolTip = "Sim game camera offset the SDK computed for this frame"))
+	FBeamSimCameraTransform SimCamera;
+
+	/** FPlatformTime seconds when the SDK data was converted into this frame; 0 for sources without a conversion step */
+	double ConvertedSeconds = 0.0;
+
+	/** FPlatformTime seconds when this frame was published to the frame ring */
+	double PublishedSeconds = 0.0;
 };
 
 /**
@@ -231,21 +351,70 @@ struct BEAMEYETRACKER_API FGazeAnalytics
     FGazeAnalytics() = default;
 };
 
+/** Kind of a completed gaze event */
+UENUM(BlueprintType)
+enum class EBeamGazeEventType : uint8
+{
+	Fixation UMETA(DisplayName = "Fixation"),
+	Saccade UMETA(DisplayName = "Saccade")
+};
+
+// Completed fixation or saccade, emitted once when it closes
+USTRUCT(BlueprintType)
+struct BEAMEYETRACKER_API FBeamGazeEvent
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Analytics")
+    EBeamGazeEventType Type = EBeamGazeEventType::Fixation;
+
+    /** Sample timestamps bounding the event, in the analyzer's clock */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Analytics")
+    double StartSeconds = 0.0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Analytics")
+    double EndSeconds = 0.0;
+
+    /** Fixation center, or saccade landing point (Screen01) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Analytics")
+    FVector2D Position = FVector2D::ZeroVector;
+
+    /** Saccade amplitude (Screen01 units); zero for fixations */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Analytics")
+    float Amplitude = 0.0f;
+
+    /** Saccade peak velocity (Screen01 units per second); zero for fixations */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Analytics")
+    float PeakVelocity = 0.0f;
+
+    FBeamGazeEvent() = default;
+};
+
 // Calibration Quality Data
 USTRUCT(BlueprintType)
 struct BEAMEYETRACKER_API FCalibrationQuality
 {
     GENERATED_BODY()
 
+    /**
+     * Combined tracking quality, 0-100. A validation session scores it from gaze-to-target error;
+     * offline session analysis derives it from the recorded gaze confidence, not from measured accuracy.
+     */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
     float OverallScore = 0.0f;
 
+    /** Left eye quality, 0-100; only meaningful when bPerEyeScores is set */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
     float LeftEyeScore = 0.0f;
 
+    /** Right eye quality, 0-100; only meaningful when bPerEyeScores is set */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
     float RightEyeScore = 0.0f;
 
+    /** True when the eye scores were measured separately; the tracker reports one combined gaze point, so validation and recordings leave them unset */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
+    bool bPerEyeScores = false;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
     TArray<FVector2D> CalibrationPoints;
 
@@ -255,6 +424,30 @@ struct BEAMEYETRACKER_API FCalibrationQuality
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
     float LastCalibrationTime = 0.0f;
 
+    /** RMS distance from gaze to target over every validation sample, in 0..1 screen space */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
+    float AccuracyRms = 0.0f;
+
+    /** Mean radial standard deviation of the gaze around each target's mean */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
+    float PrecisionStd = 0.0f;
+
+    /** Mean sample-to-sample RMS of the gaze at each target */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
+    float PrecisionRms = 0.0f;
+
+    /** Mean gaze offset from the targets */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
+    FVector2D Bias = FVector2D::ZeroVector;
+
+    /** Tracker frames the assessment is based on */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
+    int32 NumSamples = 0;
+
+    /** False until a validation session measured at least one target; the scores are meaningless until then */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Calibration")
+    bool bValidated = false;
+
     FCalibrationQuality() = default;
 };
 
@@ -273,12 +466,15 @@ struct BEAMEYETRACKER_API FBeamPerformanceMetrics
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Performance")
     float MaxFrameTime = 0.0f;
 
+    /** Percent of one core used by the plugin's own threads */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Performance")
     float CPUUsage = 0.0f;
 
+    /** Megabytes the plugin owns (LLM-tagged allocations when LLM runs, ring and recording buffers otherwise) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Performance")
     float MemoryUsage = 0.0f;
 
+    /** Frames lost anywhere in the pipeline: source drops plus consumer drops, see FBeamDropCounts */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Performance")
     int32 DroppedFrames = 0;
 
@@ -288,6 +484,83 @@ struct BEAMEYETRACKER_API FBeamPerformanceMetrics
     FBeamPerformanceMetrics() = default;
 };
 
+/** Exact frame loss per pipeline stage, counted since the subsystem started */
+USTRUCT(BlueprintType)
+struct BEAMEYETRACKER_API FBeamDropCounts
+{
+    GENERATED_BODY()
+
+    /** Frames the source produced that the producer never read, from FrameId gaps */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Performance")
+    int64 SourceDropped = 0;
+
+    /** FrameId gaps while the producer polled at a reduced rate on purpose; not counted as loss */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Performance")
+    int64 SourceDecimated = 0;
+
+    /** Frames the producer wrote over in the frame ring, whether anyone still needed them or not */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Performance")
+    int64 RingOverwritten = 0;
+
+    /** Frames lapped before a ring consumer (recording, network stream, analytics) read them */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Performance")
+    int64 ConsumerDropped = 0;
+
+    /** Frames that were produced and never reached every consumer that wanted them */
+    int64 GetTotalLost() const { return SourceDropped + ConsumerDropped; }
+
+    FBeamDropCounts() = default;
+};
+
+/** Running statistics of one additional tracker, see UBeamEyeTrackerSubsystem::AddTracker */
+USTRUCT(BlueprintType)
+struct BEAMEYETRACKER_API FBeamTrackerStats
+{
+    GENERATED_BODY()
+
+    /** INDEX_NONE when the id did not name a tracker */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    int32 TrackerId = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    FName Name;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    EBeamDataSourceType SourceType = EBeamDataSourceType::Live;
+
+    /** The data source initialized and frames are being drained */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    bool bSourceReady = false;
+
+    /** The data source failed to initialize; the tracker stays idle until it is removed */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    bool bSourceFailed = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    int64 FramesPublished = 0;
+
+    /** Frames the source produced that never reached the tracker's ring, from FrameId gaps */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    int64 SourceDropped = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    int64 RingOverwritten = 0;
+
+    /** Frame rate measured from tracker timestamps; 0 until frames arrive */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    float TrackerHz = 0.0f;
+
+    /** Running mean of the gaze confidence of valid frames */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    float MeanGazeConfidence = 0.0f;
+
+    /** Negative before the first frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Beam|Trackers")
+    float SecondsSinceLastFrame = -1.0f;
+
+    FBeamTrackerStats() = default;
+};
+
 // Gaze Interaction Data
 USTRUCT(BlueprintType)
 struct BEAMEYETRACKER_API FGazeInteraction
@@ -29,7 +29,6 @@ public:
     //~ Begin UActorComponent Interface
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     //~ End UActorComponent Interface
 
     /** Auto-initializes eye tracking on BeginPlay */
@@ -39,13 +38,13 @@ public:
 
     /** Automatically updates gaze data */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Setup",
-               meta = (DisplayName = "Auto Update", ToolTip = "Automatically update gaze data during tick"))
+               meta = (DisplayName = "Auto Update", ToolTip = "Automatically update gaze data at the update frequency"))
     bool bAutoUpdate = true;
 
-    /** Update frequency in Hz (1-1000) */
+    /** Update frequency in Hz (1-1000); each update averages the tracker frames since the previous one */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Setup", 
                meta = (ClampMin = "1", ClampMax = "1000", DisplayName = "Update Frequency (Hz)", 
-                       ToolTip = "How often to update gaze data. Higher values = more responsive but more CPU usage"))
+                       ToolTip = "How often to update gaze data. Each update averages the tracker frames since the previous one. Higher values = more responsive but more CPU usage"))
     float UpdateFrequency = 60.0f;
 
     /** Enable performance optimization mode */
@@ -141,8 +140,8 @@ private:
     UPROPERTY()
     UBeamEyeTrackerSubsystem* BeamSubsystem;
 
-    /** Timer handle for update frequency control */
-    FTimerHandle UpdateTimer;
+    /** Subscription to the subsystem's decimated view at UpdateFrequency while tracking is active */
+    FDelegateHandle RateViewHandle;
 
     /** Current tracking status */
     bool bTrackingActive;
@@ -158,15 +157,16 @@ private:
     int32 FrameCount;
     float CurrentFPS;
 
-    /** Update gaze data from subsystem */
-    void UpdateGazeData();
+    /** Update gaze data from one averaged frame of the rate view */
+    void UpdateGazeData(const FBeamFrame& Frame);
+
+    /** Subscribes at the current UpdateFrequency, replacing any earlier subscription */
+    void SubscribeToRateView();
+    void UnsubscribeFromRateView();
 
     /** Calculate current FPS */
     void UpdateFPS();
 
-    /** Check if it's time to update based on frequency */
-    bool ShouldUpdate() const;
-
     /** Apply performance optimizations */
     void ApplyPerformanceOptimizations();
 
@@ -0,0 +1,133 @@
+/*=============================================================================
+    BeamFilterTunerSubsystem.h: Per-user One-Euro auto-tuning.
+
+    Watches fixation jitter and saccade lag in the live, unfiltered gaze
+    stream, periodically re-tunes MinCutoff and Beta in the background for
+    a target jitter/lag tradeoff, and remembers the result per calibration
+    profile.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamFilterTuning.h"
+#include "BeamRing.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "BeamFilterTunerSubsystem.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+
+/**
+ * Background One-Euro tuner.
+ *
+ * The game thread only copies new raw frames into a rolling window. Every
+ * TuneIntervalSeconds the window is handed to a pool task that sweeps
+ * (MinCutoff, Beta) with BeamFilterTuning; the winner is blended in log
+ * space with the current parameters so one noisy window cannot swing the
+ * filter, then applied to the producer and saved for the active profile.
+ * Switching calibration profile restores that profile's saved parameters.
+ */
+UCLASS(DisplayName = "Beam Filter Tuner Subsystem")
+class BEAMEYETRACKER_API UBeamFilterTunerSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Lifecycle
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Filtering", meta = (DisplayName = "Start Filter Auto-Tuning", ToolTip = "Begin tuning One-Euro parameters from the live gaze stream"))
+	bool StartAutoTuning();
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Filtering", meta = (DisplayName = "Stop Filter Auto-Tuning", ToolTip = "Stop tuning; the last applied parameters stay in effect"))
+	void StopAutoTuning();
+
+	UFUNCTION(BlueprintPure, Category = "Beam|Filtering", meta = (DisplayName = "Is Filter Auto-Tuning"))
+	bool IsAutoTuning() const { return TickerHandle.IsValid(); }
+
+	/** Weight of lag against jitter in the tuning score, and the jitter (Screen01 RMS) and lag (ms) that each score 1 */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Filtering", meta = (DisplayName = "Set Filter Tuning Tradeoff"))
+	void SetTuningTradeoff(float LagWeight = 1.0f, float TargetJitter = 0.001f, float TargetLagMs = 12.0f);
+
+	/** Measurements of the parameters in effect over the last tuned window; false until a window has been tuned */
+	UFUNCTION(BlueprintPure, Category = "Beam|Filtering", meta = (DisplayName = "Get Last Filter Tuning"))
+	bool GetLastTuning(float& OutMinCutoff, float& OutBeta, float& OutJitterRms, float& OutLagMs) const;
+
+	/** Forgets the saved parameters of a calibration profile (empty for the default profile) */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Filtering", meta = (DisplayName = "Clear Tuned Filter Profile"))
+	void ClearTunedProfile(const FString& ProfileId);
+
+	/** Seconds of gaze each tuning pass looks at */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Filtering", meta = (ClampMin = "5.0", ClampMax = "300.0", Units = "s"))
+	float WindowSeconds = 30.0f;
+
+	/** Seconds between tuning passes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Filtering", meta = (ClampMin = "1.0", ClampMax = "600.0", Units = "s"))
+	float TuneIntervalSeconds = 15.0f;
+
+	/** Fraction of the way (in log space) each pass moves toward its best pair */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Filtering", meta = (ClampMin = "0.05", ClampMax = "1.0"))
+	float BlendFactor = 0.5f;
+
+private:
+	/** Outcome of one background pass */
+	struct FTuningPass
+	{
+		bool bValid = false;
+		FBeamFilterSweepResult Best;
+		FBeamFilterSweepResult Current;
+	};
+
+	UPROPERTY()
+	UBeamEyeTrackerSubsystem* BeamSubsystem = nullptr;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	bool bRawCaptureRegistered = false;
+
+	/** Rolling window of raw frames, oldest first */
+	TArray<FBeamFrame> Window;
+	TArray<FBeamFrame> Scratch;
+	const FBeamFrameRing* FollowedRing = nullptr;
+	double LastTimestampMs = 0.0;
+	double NextTuneSeconds = 0.0;
+
+	FBeamFilterSweepOptions Options;
+	TFuture<FTuningPass> PendingPass;
+
+	/** Profile whose parameters are in effect; empty for the default profile */
+	FString ActiveProfile;
+	bool bHasActiveProfile = false;
+
+	FTuningPass LastPass;
+
+	bool Tick(float DeltaTime);
+
+	/** Appends frames published since the last call and drops those older than the window */
+	void CollectFrames();
+
+	/** Starts a background pass over a copy of the window */
+	void LaunchPass();
+
+	/** Blends a finished pass into the filter and saves it for the active profile */
+	void ApplyPass(const FTuningPass& Pass);
+
+	/** Restores saved parameters when the calibration profile changes */
+	void UpdateProfile();
+
+	static bool LoadProfileParams(const FString& ProfileId, float& OutMinCutoff, float& OutBeta);
+	static void SaveProfileParams(const FString& ProfileId, float MinCutoff, float Beta);
+
+	void HandleFrameRingReleased();
+};
+
+/*=============================================================================
+    End of BeamFilterTunerSubsystem.h
+=============================================================================*/
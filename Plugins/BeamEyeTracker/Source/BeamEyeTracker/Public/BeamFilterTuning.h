@@ -0,0 +1,111 @@
+/*=============================================================================
+    BeamFilterTuning.h: Batch One-Euro filtering and parameter sweeps.
+
+    Filters whole gaze traces in one call with the loop-invariant math
+    hoisted out of the sample loop, and scores many (MinCutoff, Beta)
+    pairs against a recorded session in parallel so smoothing can be
+    tuned per user in seconds.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamFilters.h"
+#include "Containers/ArrayView.h"
+
+/**
+ * Valid gaze samples of a session on a uniform clock.
+ *
+ * Samples keep their recorded order; the trace is treated as uniformly
+ * sampled at the median frame interval, and any larger gap (a blink or a
+ * dropout) starts a new segment on which filters restart. Speed holds the
+ * raw gaze speed per sample, used to label fixations and saccades.
+ */
+struct BEAMEYETRACKER_API FBeamGazeTrace
+{
+	TArray<FVector2f> Samples;
+
+	/** Raw gaze speed per sample (Screen01 units per second) from a five-point difference */
+	TArray<float> Speed;
+
+	/** First sample index of each segment, ascending, starting with 0 */
+	TArray<int32> SegmentStarts;
+
+	float DeltaSeconds = 1.0f / 120.0f;
+
+	int32 Num() const { return Samples.Num(); }
+
+	/** Builds the trace from frames in timestamp order; invalid gaze is skipped */
+	void Build(TConstArrayView<FBeamFrame> Frames);
+
+	/** Reads every frame of a .beamrec file into the trace */
+	bool LoadFromRecording(const FString& FilePath);
+};
+
+/** How a parameter pair is scored; lower scores are better */
+struct FBeamFilterSweepOptions
+{
+	/** Raw speed below which a sample counts as fixation (Screen01 units per second) */
+	float FixationSpeed = 0.3f;
+
+	/** Raw speed above which a sample counts as saccade (Screen01 units per second) */
+	float SaccadeSpeed = 1.5f;
+
+	/** Fixation jitter that scores 1 (Screen01 units RMS per sample) */
+	float TargetJitter = 0.001f;
+
+	/** Saccade lag that scores 1 (milliseconds) */
+	float TargetLagMs = 12.0f;
+
+	/** Relative weight of lag against jitter in the score */
+	float LagWeight = 1.0f;
+
+	/** Derivative low-pass cutoff used by every evaluated filter (Hz) */
+	float DerivativeCutoff = 1.0f;
+};
+
+/** Score of one (MinCutoff, Beta) pair over a trace */
+struct FBeamFilterSweepResult
+{
+	float MinCutoff = 0.0f;
+	float Beta = 0.0f;
+
+	/** RMS of filtered sample-to-sample motion during fixations (Screen01 units) */
+	double JitterRms = 0.0;
+
+	/** Mean distance the filtered gaze trails raw gaze during saccades, expressed in milliseconds at the raw speed */
+	double LagMs = 0.0;
+
+	/** (Jitter / TargetJitter)^2 + LagWeight * (Lag / TargetLag)^2 */
+	double Score = TNumericLimits<double>::Max();
+};
+
+namespace BeamFilterTuning
+{
+	/**
+	 * One-Euro filters Input into Output (which may alias Input) at a fixed step.
+	 * Matches FBeamFilterBank's gaze channel; the first sample passes through.
+	 */
+	BEAMEYETRACKER_API void FilterOneEuro(const FOneEuroFilterParams& Params, float DeltaSeconds, TConstArrayView<FVector2f> Input, TArrayView<FVector2f> Output, float DerivativeCutoff = 1.0f);
+
+	/** Scores one parameter pair without materializing the filtered trace */
+	BEAMEYETRACKER_API FBeamFilterSweepResult Evaluate(const FBeamGazeTrace& Trace, float MinCutoff, float Beta, const FBeamFilterSweepOptions& Options);
+
+	/** Scores every (MinCutoff, Beta) pair in parallel; OutResults is parallel to Pairs */
+	BEAMEYETRACKER_API void Sweep(const FBeamGazeTrace& Trace, TConstArrayView<FVector2f> Pairs, const FBeamFilterSweepOptions& Options, TArray<FBeamFilterSweepResult>& OutResults);
+
+	/** Log-spaced grid over both parameters; X is MinCutoff and Y is Beta */
+	BEAMEYETRACKER_API void MakeLogGrid(FVector2f MinCutoffRange, FVector2f BetaRange, int32 Steps, TArray<FVector2f>& OutPairs);
+
+	/** Sweeps a default grid and returns the best pair; false when the trace has too few fixation or saccade samples */
+	BEAMEYETRACKER_API bool FindBestParams(const FBeamGazeTrace& Trace, const FBeamFilterSweepOptions& Options, FBeamFilterSweepResult& OutBest);
+}
+
+/*=============================================================================
+    End of BeamFilterTuning.h
+=============================================================================*/
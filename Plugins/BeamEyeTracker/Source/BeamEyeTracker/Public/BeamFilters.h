@@ -14,6 +14,7 @@
 
 #include "CoreMinimal.h"
 #include "BeamEyeTrackerTypes.h"
+#include "Math/VectorRegister.h"
 #include "BeamFilters.generated.h"
 
 /**
@@ -80,7 +81,8 @@ enum class EBeamFilterType : uint8
 {
 	None UMETA(DisplayName = "No Filtering"),
 	EMA UMETA(DisplayName = "Exponential Moving Average"),
-	OneEuro UMETA(DisplayName = "One-Euro Filter")
+	OneEuro UMETA(DisplayName = "One-Euro Filter"),
+	Kalman UMETA(DisplayName = "Kalman (Constant Velocity)")
 };
 
 /**
@@ -138,7 +140,10 @@ public:
 	/** Filters a 3D vector using EMA algorithm */
 	FVector Filter(const FVector& Input);
 	
-	/** Filters a rotator using EMA algorithm */
+	/** Filters a rotation along the shortest arc, so angles crossing +-180 degrees blend correctly */
+	FQuat Filter(const FQuat& Input);
+
+	/** Filters a rotator; converts through the quaternion overload */
 	FRotator Filter(const FRotator& Input);
 	
 	/** Resets the filter state to initial values */
@@ -151,7 +156,7 @@ private:
 	FEmaFilterParams Params;
 	FVector2D LastGazeValue;
 	FVector LastPositionValue;
-	FRotator LastRotationValue;
+	FQuat LastRotationValue;
 	bool bInitialized;
 	
 	/** Calculates adaptive alpha based on input stability for 2D vectors */
@@ -160,8 +165,220 @@ private:
 	/** Calculates adaptive alpha based on input stability for 3D vectors */
 	double CalculateAdaptiveAlpha(const FVector& Input);
 	
-	/** Calculates adaptive alpha based on input stability for rotators */
-	double CalculateAdaptiveAlpha(const FRotator& Input);
+	/** Calculates adaptive alpha based on input stability for rotations */
+	double CalculateAdaptiveAlpha(const FQuat& Input);
+};
+
+/** One-Euro parameters for each channel group of FBeamFilterBank; DataRate is unused there */
+struct FBeamFilterBankParams
+{
+	/** Gaze in Screen01 units */
+	FOneEuroFilterParams Gaze;
+
+	/** Head position in centimeters */
+	FOneEuroFilterParams HeadPosition = FOneEuroFilterParams(1.0f, 0.05f, 120.0f);
+
+	/** Head rotation as unit quaternion components */
+	FOneEuroFilterParams HeadRotation = FOneEuroFilterParams(1.0f, 0.3f, 120.0f);
+
+	/** Cutoff of the derivative low-pass shared by every channel (Hz) */
+	float DerivativeCutoff = 1.0f;
+};
+
+/**
+ * One-Euro filter over a whole frame in packed SIMD lanes.
+ *
+ * Gaze XY, head position XYZ and head rotation as a quaternion occupy one
+ * VectorRegister4Float each, with per-lane cutoff and beta, so every
+ * channel is filtered in the same few vector operations that filtering
+ * gaze alone needs. Each lane adapts its own cutoff to its own speed.
+ * Samples are flipped onto the hemisphere of the previous rotation before
+ * filtering and the result is renormalized. Invalid gaze, or head pose
+ * with zero confidence, leaves that channel group's state untouched.
+ */
+class BEAMEYETRACKER_API FBeamFilterBank
+{
+public:
+	FBeamFilterBank(const FBeamFilterBankParams& InParams = FBeamFilterBankParams{});
+
+	/** Filters gaze and head pose of Frame in place */
+	void Filter(FBeamFrame& Frame, double DeltaTimeSeconds);
+
+	/** Resets the filter state; the next sample passes through unfiltered */
+	void Reset();
+
+	/** Updates filter parameters at runtime without resetting state */
+	void UpdateParams(const FBeamFilterBankParams& NewParams);
+
+	const FBeamFilterBankParams& GetParams() const { return Params; }
+
+private:
+	/** Lane sets: gaze (X, Y, 0, 0), head position (X, Y, Z, 0), head rotation (X, Y, Z, W) */
+	enum ELaneSet
+	{
+		GazeLanes,
+		PositionLanes,
+		RotationLanes,
+		NumLaneSets
+	};
+
+	VectorRegister4Float Value[NumLaneSets];
+	VectorRegister4Float Derivative[NumLaneSets];
+	VectorRegister4Float MinCutoff[NumLaneSets];
+	VectorRegister4Float Beta[NumLaneSets];
+
+	FBeamFilterBankParams Params;
+	bool bHasGaze;
+	bool bHasHead;
+};
+
+/** Noise model of each channel group of FBeamKalmanFilter */
+struct FBeamKalmanParams
+{
+	/** White-acceleration spectral density of gaze (Screen01 units^2 / s^3) */
+	float GazeProcessNoise = 100.0f;
+
+	/** Gaze measurement variance (Screen01 units^2) */
+	float GazeMeasurementNoise = 0.00003f;
+
+	/** White-acceleration spectral density of head position (cm^2 / s^3) */
+	float HeadPositionProcessNoise = 2000.0f;
+
+	/** Head position measurement variance (cm^2) */
+	float HeadPositionMeasurementNoise = 0.05f;
+
+	/** White-acceleration spectral density of head rotation (deg^2 / s^3) */
+	float HeadRotationProcessNoise = 20000.0f;
+
+	/** Head rotation measurement variance (deg^2) */
+	float HeadRotationMeasurementNoise = 0.2f;
+};
+
+/** Independent axes tracked by FBeamKalmanFilter */
+enum class EBeamKalmanChannel : uint8
+{
+	GazeX,
+	GazeY,
+	HeadX,
+	HeadY,
+	HeadZ,
+	HeadPitch,
+	HeadYaw,
+	HeadRoll,
+	Num
+};
+
+/**
+ * Constant-velocity Kalman filter over gaze and head pose.
+ *
+ * Every channel is a two-state (position, velocity) filter with a white
+ * acceleration process model, so each sample costs one fixed 2x2 update
+ * per axis and yields the smoothed position and its velocity together.
+ * The velocities are written into the frame, which lets prediction
+ * downstream extrapolate from the filter state instead of re-deriving
+ * motion from frame differences. Rotation axes are unwound against the
+ * current estimate so the filter never sweeps across the +-180 seam.
+ * Invalid gaze, or head pose with zero confidence, leaves that channel
+ * group's state untouched.
+ */
+class BEAMEYETRACKER_API FBeamKalmanFilter
+{
+public:
+	FBeamKalmanFilter(const FBeamKalmanParams& InParams = FBeamKalmanParams{});
+
+	/** Replaces gaze and head pose of Frame with the filtered state and stores the estimated velocities in it */
+	void Filter(FBeamFrame& Frame, double DeltaTimeSeconds);
+
+	/** Extrapolates the last filtered state HorizonSeconds ahead into OutFrame's gaze and head pose; false before the first sample */
+	bool Predict(double HorizonSeconds, FBeamFrame& OutFrame) const;
+
+	/** Resets the filter state; the next sample passes through unfiltered */
+	void Reset();
+
+	/** Updates the noise model at runtime without resetting state */
+	void UpdateParams(const FBeamKalmanParams& NewParams);
+
+	const FBeamKalmanParams& GetParams() const { return Params; }
+
+	/** State covariance of one channel: position variance, position-velocity covariance and velocity variance */
+	void GetCovariance(EBeamKalmanChannel Channel, double& OutPositionVariance, double& OutCovariance, double& OutVelocityVariance) const;
+
+private:
+	static constexpr int32 NumChannels = static_cast<int32>(EBeamKalmanChannel::Num);
+
+	/** Per-channel state and covariance, laid out by channel so each group updates in one tight loop */
+	double Position[NumChannels];
+	double Velocity[NumChannels];
+	double P00[NumChannels];
+	double P01[NumChannels];
+	double P11[NumChannels];
+	double ProcessNoise[NumChannels];
+	double MeasurementNoise[NumChannels];
+
+	FBeamKalmanParams Params;
+	bool bHasGaze;
+	bool bHasHead;
+
+	/** Seeds channels [First, Last) from a measurement */
+	void Init(int32 First, int32 Last, const double* Measurement);
+
+	/** Runs the predict and correct step on channels [First, Last) */
+	void Update(int32 First, int32 Last, const double* Measurement, double DeltaSeconds);
+};
+
+/** How FBeamGapFiller bridges short tracking gaps */
+struct FBeamGapFillParams
+{
+	/** Longest gap bridged with synthesized samples (ms); 0 disables gap filling */
+	float MaxGapMs = 0.0f;
+
+	/** How much of a gap continues the last motion before the sample is held (ms); 0 always holds */
+	float MaxExtrapolationMs = 30.0f;
+};
+
+/**
+ * Bridges blinks and brief tracking loss.
+ *
+ * Runs after the smoothing filter. While a channel is missing for no
+ * longer than MaxGapMs, its last filtered value is extrapolated along the
+ * last velocity for up to MaxExtrapolationMs and then held, and the frame
+ * is tagged as synthesized. Synthesized samples never reach the filters,
+ * so their state stays warm across the gap instead of re-converging from
+ * a reset when tracking returns.
+ */
+class BEAMEYETRACKER_API FBeamGapFiller
+{
+public:
+	FBeamGapFiller(const FBeamGapFillParams& InParams = FBeamGapFillParams{});
+
+	/** Records measured channels of an already filtered Frame and fills in missing ones */
+	void Process(FBeamFrame& Frame);
+
+	/** Forgets the last samples; no gap is bridged until tracking is seen again */
+	void Reset();
+
+	void UpdateParams(const FBeamGapFillParams& NewParams) { Params = NewParams; }
+
+	const FBeamGapFillParams& GetParams() const { return Params; }
+
+	bool IsEnabled() const { return Params.MaxGapMs > 0.0f; }
+
+private:
+	FBeamGapFillParams Params;
+
+	/** Last measured sample of each channel and its velocity; velocity is only differenced across back-to-back measurements */
+	FGazePoint LastGaze;
+	FVector2D GazeVelocity;
+	double LastGazeMs;
+	bool bHasGaze;
+	bool bGazeContinuous;
+
+	FHeadPose LastHead;
+	FVector HeadVelocity;
+	FRotator HeadAngularVelocity;
+	double LastHeadMs;
+	bool bHasHead;
+	bool bHeadContinuous;
 };
 
 /**
@@ -188,24 +405,48 @@ public:
 	/** Resets all filter states to initial values */
 	void Reset();
 	
-	/** Updates One-Euro filter parameters at runtime */
+	/** Updates the gaze One-Euro parameters at runtime */
 	void UpdateOneEuroParams(const FOneEuroFilterParams& Params);
 	
 	/** Updates EMA filter parameters at runtime */
 	void UpdateEmaParams(const FEmaFilterParams& Params);
 
+	/** Updates the One-Euro parameters of every channel group at runtime */
+	void UpdateFilterBankParams(const FBeamFilterBankParams& Params);
+
+	/** Updates the Kalman noise model at runtime */
+	void UpdateKalmanParams(const FBeamKalmanParams& Params);
+
+	/** Updates how short tracking gaps are bridged at runtime */
+	void UpdateGapFillParams(const FBeamGapFillParams& Params);
+
+	/** True when ApplyFilters changes frames, either by smoothing or by filling gaps */
+	bool ModifiesFrames() const { return CurrentFilterType != EBeamFilterType::None || (GapFiller && GapFiller->IsEnabled()); }
+
+	/** Kalman filter instance, for covariance queries and prediction from the filter state */
+	const FBeamKalmanFilter* GetKalmanFilter() const { return KalmanFilter.Get(); }
+
 private:
 	/** Current filter type being used for data processing */
 	EBeamFilterType CurrentFilterType = EBeamFilterType::OneEuro;
 	
-	/** One-Euro filter instance for adaptive smoothing */
-	TUniquePtr<FOneEuroFilter> OneEuroFilter;
+	/** One-Euro filter bank smoothing gaze and head pose together */
+	TUniquePtr<FBeamFilterBank> FilterBank;
 	
 	/** EMA filter instance for simple smoothing */
 	TUniquePtr<FEmaFilter> EmaFilter;
+
+	/** Constant-velocity Kalman filter producing smoothed state and velocity */
+	TUniquePtr<FBeamKalmanFilter> KalmanFilter;
+
+	/** Holds or extrapolates channels through short gaps after smoothing */
+	TUniquePtr<FBeamGapFiller> GapFiller;
 	
 	/** Initializes filter instances based on current type */
 	void InitializeFilters();
+
+	/** Runs the active smoothing filter only */
+	void ApplySmoothing(FBeamFrame& Frame, double DeltaTimeSeconds);
 };
 
 /*=============================================================================
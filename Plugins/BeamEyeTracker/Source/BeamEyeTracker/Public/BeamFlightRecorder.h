@@ -0,0 +1,170 @@
+/*=============================================================================
+    BeamFlightRecorder.h: Always-on recorder of the last seconds of frames.
+
+    Keeps the most recent compact frames and stage latency samples in
+    rings allocated once at startup, and writes them to a .beamrec when a
+    hitch, a watchdog stall or a crash happens, so field reports come with
+    the data leading up to the problem.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamFrameCompact.h"
+#include "BeamLatency.h"
+#include "Async/Future.h"
+#include <atomic>
+
+/** What triggered a flight recorder dump */
+enum class EBeamFlightDumpReason : uint8
+{
+	Manual,
+	Hitch,
+	Stall,
+	Crash
+};
+
+/** One stage latency sample kept next to the frames */
+struct FBeamFlightLatencySample
+{
+	/** FPlatformTime::Seconds when the sample was recorded */
+	double RecordedSeconds = 0.0;
+
+	float LatencyMs = 0.0f;
+
+	/** EBeamLatencyStage */
+	uint8 Stage = 0;
+	uint8 Padding[3] = { 0, 0, 0 };
+};
+
+/** Precedes the latency samples after the frame chunk of a dump; playback stops at the unknown magic and ignores them */
+struct FBeamFlightLatencyHeader
+{
+	uint32 Magic = 0x54414C42; // "BLAT"
+	uint32 SampleCount = 0;
+};
+
+/**
+ * Process-wide flight recorder.
+ *
+ * Recording a frame or a latency sample claims a ring slot with one
+ * relaxed increment and copies a few dozen bytes into it; nothing is
+ * allocated or locked after Start. Each slot carries a sequence number,
+ * so a dump can read the rings from any thread while they are written
+ * and skips the slots caught mid-write. Dumps are v2 .beamrec files with
+ * a single chunk, followed by the latency samples; pixel gaze is not
+ * kept and plays back as zero. Hitch and stall dumps are written on a
+ * pool thread and rate limited by beam.FlightRecorder.CooldownSeconds;
+ * a crash dump is written on the crashing thread before the process goes.
+ */
+class BEAMEYETRACKER_API FBeamFlightRecorder
+{
+public:
+	FBeamFlightRecorder();
+	~FBeamFlightRecorder();
+
+	/** Allocates the rings from the beam.FlightRecorder cvars and hooks the hitch and crash triggers; game thread */
+	void Start();
+
+	/** Unhooks the triggers, waits for a dump in flight and frees the rings; game thread */
+	void Stop();
+
+	bool IsActive() const { return bActive.load(std::memory_order_acquire); }
+
+	/** Any publishing thread */
+	void RecordFrame(const FBeamFrame& Frame);
+
+	/** Any thread */
+	void RecordLatency(EBeamLatencyStage Stage, double Seconds);
+
+	/** Writes the rings on a pool thread; false while cooling down, when a dump is in flight or nothing was recorded. Game thread */
+	bool RequestDump(EBeamFlightDumpReason Reason);
+
+	/** Writes the rings on the calling thread and returns the file written, empty on failure */
+	FString DumpNow(EBeamFlightDumpReason Reason);
+
+	static const TCHAR* GetReasonName(EBeamFlightDumpReason Reason);
+
+	/** Ring bytes per second of window, frames and latency samples together */
+	static int64 GetBytesPerSecond();
+
+private:
+	/** Fixed-capacity multi-writer ring; a slot's sequence is its write index plus one once the value is complete */
+	template <typename ElementType>
+	class TSlotRing
+	{
+	public:
+		void Allocate(uint32 InCapacity);
+		void Free();
+		bool IsAllocated() const { return Capacity > 0; }
+		uint64 GetWriteCount() const { return Head.load(std::memory_order_acquire); }
+		void Write(const ElementType& Value);
+
+		/** Copies the complete slots, oldest first */
+		void Copy(TArray<ElementType>& Out) const;
+
+	private:
+		struct FSlot
+		{
+			std::atomic<uint64> Sequence{ 0 };
+			ElementType Value;
+		};
+
+		TUniquePtr<FSlot[]> Slots;
+		uint32 Capacity = 0;
+		std::atomic<uint64> Head{ 0 };
+	};
+
+	TSlotRing<FBeamFrameCompact> Frames;
+	TSlotRing<FBeamFlightLatencySample> LatencySamples;
+
+	std::atomic<bool> bActive{ false };
+
+	/** Record calls currently inside the rings; Stop frees them only once this drains to zero */
+	std::atomic<int32> ActiveWriters{ 0 };
+
+	/** Enters a record call; false, with nothing held, when the recorder is stopped */
+	bool BeginWrite();
+	void EndWrite() { ActiveWriters.fetch_sub(1, std::memory_order_release); }
+
+	/** FPlatformTime::Seconds of the last recorded frame */
+	std::atomic<double> LastFrameSeconds{ 0.0 };
+
+	/** Bytes reported to GBeamResources for the rings */
+	int64 RingBytes = 0;
+
+	/** Saved/BeamFlightRecorder, resolved at Start so the crash path does not touch the config system */
+	FString DumpDirectory;
+
+	FDelegateHandle EndFrameHandle;
+	FDelegateHandle SystemErrorHandle;
+	double LastEndFrameSeconds = 0.0;
+	double LastDumpSeconds = -DBL_MAX;
+	TFuture<void> DumpTask;
+
+	/** Set by the first crash dump so nested system errors do not write again */
+	std::atomic<bool> bCrashDumped{ false };
+
+	void OnEndFrame();
+	void OnSystemError();
+
+	/** True when a frame was recorded within the last second, i.e. tracking is live */
+	bool HasRecentFrames(double NowSeconds) const;
+
+	FString MakeDumpPath(EBeamFlightDumpReason Reason) const;
+
+	/** Writes a snapshot of both rings to FilePath */
+	bool WriteDump(const FString& FilePath) const;
+};
+
+/** Process-wide flight recorder, started with the module */
+extern BEAMEYETRACKER_API FBeamFlightRecorder GBeamFlightRecorder;
+
+/*=============================================================================
+    End of BeamFlightRecorder.h
+=============================================================================*/
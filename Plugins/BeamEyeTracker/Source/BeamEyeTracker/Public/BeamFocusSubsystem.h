@@ -0,0 +1,214 @@
+/*=============================================================================
+    BeamFocusSubsystem.h: Central gaze focus and dwell dispatcher.
+
+    Evaluates gaze focus once per new tracker frame against every
+    registered dwell target and fires enter, dwell and exit notifications,
+    replacing per-node and per-action gaze polling. Awaitable gaze queries
+    are resolved by the same pass.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BeamEyeTrackerTypes.h"
+#include "Tasks/Task.h"
+#include <atomic>
+#include "BeamFocusSubsystem.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+class UBeamGazeTargetSubsystem;
+
+UENUM(BlueprintType)
+enum class EBeamFocusEvent : uint8
+{
+	Enter		UMETA(DisplayName = "Enter"),
+	Dwell		UMETA(DisplayName = "Dwell"),
+	Exit		UMETA(DisplayName = "Exit")
+};
+
+UENUM(BlueprintType)
+enum class EBeamGazeQueryResult : uint8
+{
+	Satisfied	UMETA(DisplayName = "Satisfied"),
+	TimedOut	UMETA(DisplayName = "Timed Out"),
+	Cancelled	UMETA(DisplayName = "Cancelled")
+};
+
+/** State shared by a gaze query's handle and the dispatcher; the dispatcher resolves it exactly once */
+struct FBeamGazeQueryState
+{
+	UE::Tasks::FTaskEvent Resolved{ UE_SOURCE_LOCATION };
+	EBeamGazeQueryResult Result = EBeamGazeQueryResult::Cancelled;
+	std::atomic<bool> bCancelRequested{ false };
+};
+
+/**
+ * Handle to an awaitable gaze query.
+ *
+ * Task completes on the game thread, inside the dispatcher tick that
+ * resolved the query. Continuations that touch UObjects should be
+ * launched with a game-thread extended priority; waiting on Task from the
+ * game thread itself never returns, since that thread resolves it.
+ */
+struct FBeamGazeQuery
+{
+	UE::Tasks::TTask<EBeamGazeQueryResult> Task;
+	TSharedPtr<FBeamGazeQueryState, ESPMode::ThreadSafe> State;
+
+	bool IsCompleted() const { return !Task.IsValid() || Task.IsCompleted(); }
+
+	/** Resolves the query as Cancelled at the dispatcher's next tick; safe from any thread */
+	void Cancel() const
+	{
+		if (State)
+		{
+			State->bCancelRequested.store(true, std::memory_order_relaxed);
+		}
+	}
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBeamFocusEvent, EBeamFocusEvent, Event, AActor*, Target);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnBeamFocusEventNative, EBeamFocusEvent, AActor*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBeamNewFrameNative, const FBeamFrame&);
+
+/**
+ * Per-world focus dispatcher.
+ *
+ * Each tick walks the frames published since the previous tick. Per frame
+ * the focused target is found through UBeamGazeTargetSubsystem's screen
+ * grid, so the cost depends on the targets near the gaze, not on how many
+ * are registered; only one target can hold focus, so at most one target's
+ * listeners run per transition. Blinks and dropouts shorter than
+ * FocusLossGraceSeconds keep the current focus.
+ *
+ * Gaze queries are checked in the same pass, so any number of pending
+ * waits costs one check each per new frame instead of a timer each.
+ */
+UCLASS()
+class BEAMEYETRACKER_API UBeamFocusSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UTickableWorldSubsystem Interface
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
+	/** Makes Target focusable; Dwell fires after DwellSeconds of continuous focus */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Interaction", meta = (DisplayName = "Register Dwell Target"))
+	void RegisterDwellTarget(AActor* Target, float DwellSeconds = 1.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Interaction", meta = (DisplayName = "Unregister Dwell Target"))
+	void UnregisterDwellTarget(AActor* Target);
+
+	UFUNCTION(BlueprintPure, Category = "Beam|Interaction", meta = (DisplayName = "Get Focused Target"))
+	AActor* GetFocusedTarget() const { return FocusedTarget.Get(); }
+
+	/** Seconds the current target has held focus */
+	UFUNCTION(BlueprintPure, Category = "Beam|Interaction", meta = (DisplayName = "Get Focus Duration"))
+	float GetFocusDuration() const;
+
+	/** Fired for every focus transition of any target */
+	UPROPERTY(BlueprintAssignable, Category = "Beam|Interaction")
+	FOnBeamFocusEvent OnFocusEvent;
+
+	/** Listeners for one target only; valid while the target is registered */
+	FOnBeamFocusEventNative* GetTargetEvents(const AActor* Target);
+
+	/** Fired once per newly published frame, in order, before focus is evaluated */
+	FOnBeamNewFrameNative OnNewFrame;
+
+	/**
+	 * Resolves once gaze has stayed on Target's screen bounds, within FocusMarginPixels, for MinMs;
+	 * Target becomes a gaze target for the duration if it is not one. TimeoutSeconds <= 0 waits indefinitely
+	 */
+	FBeamGazeQuery WaitForFixationOn(AActor* Target, float MinMs, float TimeoutSeconds = 0.0f);
+
+	/** Resolves on the first usable frame whose gaze lies inside Screen01Region */
+	FBeamGazeQuery WaitForGazeEnter(const FBox2D& Screen01Region, float TimeoutSeconds = 0.0f);
+
+	/** Resolves once the tracker reports EBeamHealth::Ok */
+	FBeamGazeQuery WaitForTrackingHealthy(float TimeoutSeconds = 0.0f);
+
+	int32 GetNumPendingQueries() const { return Queries.Num(); }
+
+	/** Gaze within this many pixels of a target's screen bounds focuses it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Interaction")
+	float FocusMarginPixels = 24.0f;
+
+	/** Frames below this confidence count as gaze loss */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Interaction")
+	float MinConfidence = 0.3f;
+
+	/** Gaze loss shorter than this keeps focus, so blinks do not reset dwell */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Interaction")
+	float FocusLossGraceSeconds = 0.15f;
+
+private:
+	struct FDwellTarget
+	{
+		float DwellSeconds = 1.0f;
+		FOnBeamFocusEventNative Events;
+	};
+
+	TMap<TObjectKey<AActor>, FDwellTarget> DwellTargets;
+
+	TWeakObjectPtr<AActor> FocusedTarget;
+	double FocusStartSeconds = 0.0;
+	double LastFocusedSeconds = 0.0;
+	double LastFrameSeconds = 0.0;
+	bool bDwellFired = false;
+
+	/** Newest ring frame already evaluated */
+	double LastTimestampMs = 0.0;
+	bool bHasTimestamp = false;
+	TArray<FBeamFrame> Scratch;
+
+	enum class EQueryKind : uint8
+	{
+		Fixation,
+		RegionEnter,
+		TrackingHealthy
+	};
+
+	struct FPendingQuery
+	{
+		TSharedPtr<FBeamGazeQueryState, ESPMode::ThreadSafe> State;
+		EQueryKind Kind = EQueryKind::TrackingHealthy;
+		TWeakObjectPtr<AActor> Target;
+		FBox2D Region = FBox2D(ForceInit);
+		double MinSeconds = 0.0;
+
+		/** 0 when the query never times out */
+		double DeadlineSeconds = 0.0;
+
+		/** Fixation progress; negative while gaze is off the target */
+		double OnSinceSeconds = -1.0;
+		double LastOnSeconds = 0.0;
+
+		/** The query registered Target with the gaze target grid and unregisters it when done */
+		bool bRegisteredGazeTarget = false;
+	};
+
+	TArray<FPendingQuery> Queries;
+
+	FBeamGazeQuery AddQuery(FPendingQuery&& Query, float TimeoutSeconds);
+	void ResolveQuery(int32 Index, EBeamGazeQueryResult Result);
+	void UpdateQueries(const UBeamEyeTrackerSubsystem* Beam);
+	void EvaluateQueries(const FBeamFrame& Frame, UBeamGazeTargetSubsystem* Targets);
+
+	void EvaluateFrame(const FBeamFrame& Frame, UBeamGazeTargetSubsystem* Targets);
+	void SetFocus(AActor* NewTarget, double NowSeconds);
+	void Fire(EBeamFocusEvent Event, AActor* Target);
+};
+
+/*=============================================================================
+    End of BeamFocusSubsystem.h
+=============================================================================*/
@@ -0,0 +1,92 @@
+/*=============================================================================
+    BeamFrameCompact.h: Quantized 48-byte frame for internal storage.
+
+    FBeamFrame is the Blueprint-facing frame: doubles, UE5 double vectors,
+    both rotation representations and a sim camera transform, several
+    hundred bytes once padded. Paths that only move frames around (history
+    rings, the network stream) store FBeamFrameCompact instead and convert
+    at the edges. Quantization matches the compact network packet: gaze in
+    1/65535 of a two-screen range, head position in hundredths of a
+    centimeter, rotation in hundredths of a degree, confidence in 1/255.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "Containers/ArrayView.h"
+
+/** Quantized frame; plain old data, so rings and buffers copy it with memcpy */
+struct alignas(16) FBeamFrameCompact
+{
+	enum EFlags : uint8
+	{
+		GazeValid       = 1 << 0,
+		HasVelocity     = 1 << 1,
+		GazeSynthesized = 1 << 2,
+		HeadSynthesized = 1 << 3,
+		Stale           = 1 << 4
+	};
+
+	/** Gaze is quantized over [GazeMin, GazeMin + GazeRange] so slightly off-screen gaze survives */
+	static constexpr double GazeMin = -0.5;
+	static constexpr double GazeRange = 2.0;
+
+	/** Steps per centimeter, per degree and per Screen01 unit per second */
+	static constexpr double PositionScale = 100.0;
+	static constexpr double RotationScale = 100.0;
+	static constexpr double VelocityScale = 1000.0;
+
+	double SDKTimestampMs = 0.0;
+	double UETimestampSeconds = 0.0;
+
+	/** Low 32 bits of FBeamFrame::FrameId; ids only ever need comparing against nearby frames */
+	uint32 FrameId = 0;
+
+	uint16 GazeX = 0;
+	uint16 GazeY = 0;
+	int16 HeadPositionCm[3] = { 0, 0, 0 };
+	int16 HeadRotation[3] = { 0, 0, 0 };
+	uint8 GazeConfidence = 0;
+	uint8 HeadConfidence = 0;
+	uint8 Flags = 0;
+	uint8 Reserved = 0;
+
+	/** Filtered gaze velocity; head velocities are not kept */
+	int16 GazeVelocity01[2] = { 0, 0 };
+
+	float DeltaTimeSeconds = 0.0f;
+
+	/** Quantizes one frame */
+	BEAMEYETRACKER_API static FBeamFrameCompact FromFrame(const FBeamFrame& Frame);
+
+	/**
+	 * Expands into a Blueprint-facing frame. Fields the compact form drops (pixel gaze, head velocities,
+	 * session id, sim camera, local stage times) are reset; pixel gaze is rebuilt when a viewport size is given.
+	 */
+	BEAMEYETRACKER_API void ToFrame(FBeamFrame& OutFrame, FIntPoint ViewportSize = FIntPoint::ZeroValue) const;
+
+	double GetGazeX01() const { return GazeMin + GazeX * (GazeRange / 65535.0); }
+	double GetGazeY01() const { return GazeMin + GazeY * (GazeRange / 65535.0); }
+	bool IsGazeValid() const { return (Flags & GazeValid) != 0; }
+};
+
+static_assert(sizeof(FBeamFrameCompact) == 48, "FBeamFrameCompact must stay three 16-byte lines");
+static_assert(std::is_trivially_copyable_v<FBeamFrameCompact>, "FBeamFrameCompact must be trivially copyable");
+
+namespace BeamFrameCompact
+{
+	/** Quantizes In into Out element by element; Out must be at least as long as In */
+	BEAMEYETRACKER_API void PackFrames(TArrayView<const FBeamFrame> In, TArrayView<FBeamFrameCompact> Out);
+
+	/** Expands In into Out element by element; Out must be at least as long as In */
+	BEAMEYETRACKER_API void UnpackFrames(TArrayView<const FBeamFrameCompact> In, TArrayView<FBeamFrame> Out, FIntPoint ViewportSize = FIntPoint::ZeroValue);
+}
+
+/*=============================================================================
+    End of BeamFrameCompact.h
+=============================================================================*/
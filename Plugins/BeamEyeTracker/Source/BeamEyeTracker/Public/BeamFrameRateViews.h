@@ -0,0 +1,120 @@
+/*=============================================================================
+    BeamFrameRateViews.h: Shared multi-rate views over the frame ring.
+
+    Drains the subsystem's frame ring once per game tick and derives every
+    output rate a consumer asked for from that one read: every frame at
+    the native tracker rate, the newest frame once per engine frame, or an
+    N Hz stream whose samples average all frames in their interval.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "Delegates/Delegate.h"
+
+/** Native rate-view notification; called once per output sample */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBeamRateViewFrameNative, const FBeamFrame& /*Frame*/);
+
+/** Output rate of a view */
+enum class EBeamFrameRate : uint8
+{
+	/** Every published frame, oldest first, delivered in a batch each tick */
+	Native,
+
+	/** The newest frame, at most once per engine frame */
+	EngineFrame,
+
+	/** One averaged frame per 1 / DecimatedHz of tracker time */
+	Decimated
+};
+
+/** Rate of one view; subscribers asking for the same rate share it */
+struct FBeamFrameRateView
+{
+	EBeamFrameRate Rate = EBeamFrameRate::EngineFrame;
+
+	/** Output rate for Decimated views; at or above the tracker rate every interval holds one frame */
+	float DecimatedHz = 30.0f;
+
+	static FBeamFrameRateView Native() { return { EBeamFrameRate::Native, 0.0f }; }
+	static FBeamFrameRateView EngineFrame() { return { EBeamFrameRate::EngineFrame, 0.0f }; }
+	static FBeamFrameRateView Decimated(float Hz) { return { EBeamFrameRate::Decimated, Hz }; }
+
+	bool operator==(const FBeamFrameRateView& Other) const
+	{
+		return Rate == Other.Rate && (Rate != EBeamFrameRate::Decimated || DecimatedHz == Other.DecimatedHz);
+	}
+};
+
+/**
+ * Registry of rate views grouped by rate.
+ *
+ * Decimated views are box-filtered, not sampled: intervals are aligned to
+ * the tracker clock, and the frame sent for an interval averages gaze
+ * (valid samples only), head position and rotation and both confidences
+ * over every frame in it, carries the mean timestamp and takes identity
+ * and remaining fields from the interval's last frame. An interval is
+ * sent when the first frame of a later one arrives, so a view lags by at
+ * most one interval plus one tracker frame. Game thread only.
+ */
+class BEAMEYETRACKER_API FBeamFrameRateViews
+{
+public:
+	/** Adds a subscriber; the returned handle removes it */
+	FDelegateHandle Add(const FBeamFrameRateView& View, FOnBeamRateViewFrameNative::FDelegate&& Delegate);
+
+	/** Removes a subscriber; unknown handles are ignored */
+	void Remove(FDelegateHandle Handle);
+
+	bool IsEmpty() const { return Groups.Num() == 0; }
+
+	/** Feeds the frames published since the previous call, oldest first; may be empty */
+	void ProcessFrames(TArrayView<const FBeamFrame> Frames);
+
+	/** Discards partial intervals; call when the stream restarts so no average spans two streams */
+	void Rearm();
+
+private:
+	/** Running sums of one decimation interval */
+	struct FAverage
+	{
+		FVector2D Screen01Sum = FVector2D::ZeroVector;
+		FVector2D ScreenPxSum = FVector2D::ZeroVector;
+		double GazeConfidenceSum = 0.0;
+		int32 NumValidGaze = 0;
+
+		FVector HeadPositionSum = FVector::ZeroVector;
+		FQuat HeadRotationSum = FQuat(0.0, 0.0, 0.0, 0.0);
+		double HeadConfidenceSum = 0.0;
+
+		double SDKTimestampSum = 0.0;
+		double UETimestampSum = 0.0;
+		int32 NumFrames = 0;
+
+		FBeamFrame Last;
+
+		void Add(const FBeamFrame& Frame);
+		FBeamFrame Resolve() const;
+	};
+
+	struct FGroup
+	{
+		FBeamFrameRateView View;
+		FOnBeamRateViewFrameNative Event;
+
+		/** Decimated only: interval the running average belongs to */
+		int64 Interval = INDEX_NONE;
+		FAverage Average;
+	};
+
+	TArray<FGroup> Groups;
+};
+
+/*=============================================================================
+    End of BeamFrameRateViews.h
+=============================================================================*/
@@ -0,0 +1,90 @@
+/*=============================================================================
+    BeamFrameSubscriptions.h: Shared change-based frame notifications.
+
+    Evaluates the subsystem's latest frame once per game tick and notifies
+    each subscriber only when gaze or head pose moved past its own
+    threshold, optionally capped to a maximum notification rate.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "Delegates/Delegate.h"
+
+/** Native frame-change notification; the flags tell which part of the frame crossed its threshold */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnBeamFrameChangedNative, const FBeamFrame& /*Frame*/, bool /*bGazeChanged*/, bool /*bHeadChanged*/);
+
+/** Thresholds for one subscription; subscribers with equal thresholds share their evaluation */
+struct FBeamChangeThresholds
+{
+	/** Gaze movement from the last notified position that triggers a notification; <= 0 disables gaze */
+	float GazePixels = 10.0f;
+
+	/** Head rotation from the last notified pose that triggers a notification; <= 0 disables head pose */
+	float HeadDegrees = 0.0f;
+
+	/** Notification rate cap; 0 notifies on every qualifying frame */
+	float MaxRateHz = 0.0f;
+
+	bool operator==(const FBeamChangeThresholds& Other) const
+	{
+		return GazePixels == Other.GazePixels && HeadDegrees == Other.HeadDegrees && MaxRateHz == Other.MaxRateHz;
+	}
+};
+
+/**
+ * Registry of frame-change subscribers grouped by threshold.
+ *
+ * Each group remembers the gaze and head pose it last notified and stays
+ * silent until the live value leaves that dead band, so jitter around a
+ * threshold cannot make a notification flicker; the reference moves only
+ * when a notification is sent. Gaze becoming valid or invalid always
+ * qualifies. A change held back by the rate cap is delivered on the first
+ * frame after the interval ends, even if gaze has stopped moving by then.
+ * Game thread only.
+ */
+class BEAMEYETRACKER_API FBeamFrameSubscriptions
+{
+public:
+	/** Adds a subscriber; the returned handle removes it */
+	FDelegateHandle Add(const FBeamChangeThresholds& Thresholds, FOnBeamFrameChangedNative::FDelegate&& Delegate);
+
+	/** Removes a subscriber; unknown handles are ignored */
+	void Remove(FDelegateHandle Handle);
+
+	bool IsEmpty() const { return Groups.Num() == 0; }
+
+	/** Evaluates every group against Frame and notifies those whose thresholds were crossed */
+	void ProcessFrame(const FBeamFrame& Frame, double NowSeconds);
+
+	/** Forgets the last notified values so the next frame notifies every group */
+	void Rearm();
+
+private:
+	struct FGroup
+	{
+		FBeamChangeThresholds Thresholds;
+		FOnBeamFrameChangedNative Event;
+
+		FVector2D LastGazePx = FVector2D::ZeroVector;
+		FQuat LastHeadRotation = FQuat::Identity;
+		double LastNotifySeconds = -UE_BIG_NUMBER;
+		bool bLastGazeValid = false;
+		bool bHasNotified = false;
+
+		/** Crossings held back by the rate cap */
+		bool bPendingGaze = false;
+		bool bPendingHead = false;
+	};
+
+	TArray<FGroup> Groups;
+};
+
+/*=============================================================================
+    End of BeamFrameSubscriptions.h
+=============================================================================*/
@@ -0,0 +1,186 @@
+/*=============================================================================
+    BeamGazeAnalyzer.h: Clock-independent gaze analytics core.
+
+    Computes fixations, saccade velocity and scan path length from gaze
+    samples carrying their own timestamps, so the same analysis runs on
+    live data, recorded playback and offline replay.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+
+/**
+ * Streaming fixation/saccade classifier over a trailing window of samples.
+ *
+ * Each sample is classified once as it arrives: a fixation (I-DT) lasts
+ * while gaze stays within a dispersion radius of its first sample, and a
+ * step is saccadic (I-VT) when it moves further than a minimum distance.
+ * Window aggregates are kept as running sums that are adjusted when
+ * samples and fixations age out, so AddSample is O(1) amortized and
+ * Analyze only copies the fixation centers. A fixation stays in the window
+ * until its last sample ages out. History lives in circular queues that
+ * only grow until they hold one full window, after which eviction is a
+ * head increment; whole-session analysis keeps no per-sample history.
+ *
+ * Time only advances through the sample timestamps: nothing here reads a
+ * clock, which keeps offline runs deterministic. Not thread safe.
+ */
+class BEAMEYETRACKER_API FBeamGazeAnalyzer
+{
+public:
+	/** MaxAgeSeconds <= 0 keeps every sample (whole-session analysis) */
+	FBeamGazeAnalyzer(float InMinFixationDuration = 0.1f, double InMaxAgeSeconds = 10.0);
+
+	/** Classifies a sample and drops samples older than the window relative to it */
+	void AddSample(const FVector2D& Screen01, double TimestampSeconds);
+
+	/** Writes fixation and saccade statistics over the current window into OutAnalytics */
+	void Analyze(FGazeAnalytics& OutAnalytics) const;
+
+	/** Clears all samples, events and running state */
+	void Reset();
+
+	/** Applies to fixations that close after the call */
+	void SetMinFixationDuration(float InMinFixationDuration) { MinFixationDuration = InMinFixationDuration; }
+	int32 GetNumSamples() const { return NumSamples; }
+
+	/** Pre-sizes the sample history for the expected sampling rate so the window never grows it */
+	void ReserveForRate(float SamplesPerSecond);
+
+	/** When enabled, completed fixations and saccades are queued for DrainEvents (off by default) */
+	void SetEventCapture(bool bInCaptureEvents);
+
+	/** Appends the events completed since the last drain to OutEvents and clears the queue */
+	void DrainEvents(TArray<FBeamGazeEvent>& OutEvents);
+
+	/** History bytes one windowed sample costs, for sizing the window against a memory budget */
+	static SIZE_T GetBytesPerSample();
+
+private:
+	/** Power-of-two circular FIFO; push and pop are O(1), growth doubles and re-linearizes */
+	template <typename T>
+	struct THistoryQueue
+	{
+		TArray<T> Slots;
+		int32 Head = 0;
+		int32 Count = 0;
+
+		int32 Num() const { return Count; }
+		const T& operator[](int32 Index) const { return Slots[(Head + Index) & (Slots.Num() - 1)]; }
+		const T& Front() const { return (*this)[0]; }
+
+		void Push(const T& Item)
+		{
+			if (Count == Slots.Num())
+			{
+				Reserve(FMath::Max(16, Count * 2));
+			}
+			Slots[(Head + Count) & (Slots.Num() - 1)] = Item;
+			++Count;
+		}
+
+		void PopFront()
+		{
+			Head = (Head + 1) & (Slots.Num() - 1);
+			--Count;
+		}
+
+		/** Keeps the slots for reuse */
+		void Reset()
+		{
+			Head = 0;
+			Count = 0;
+		}
+
+		void Reserve(int32 MinSlots)
+		{
+			const int32 NewSize = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(MinSlots, 1))));
+			if (NewSize <= Slots.Num())
+			{
+				return;
+			}
+			TArray<T> NewSlots;
+			NewSlots.SetNumZeroed(NewSize);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				NewSlots[i] = (*this)[i];
+			}
+			Slots = MoveTemp(NewSlots);
+			Head = 0;
+		}
+	};
+
+	/** Window data for one sample; Distance and Velocity describe the step from the previous sample */
+	struct FSampleRecord
+	{
+		double TimestampSeconds;
+		float Distance;
+		float Velocity;
+	};
+
+	/** A closed fixation that still overlaps the window */
+	struct FFixationRecord
+	{
+		double EndSeconds;
+		double DurationSeconds;
+		FVector2D Center;
+	};
+
+	float MinFixationDuration;
+	double MaxAgeSeconds;
+
+	// Samples in the window, oldest first; empty for whole-session analysis, which never evicts
+	THistoryQueue<FSampleRecord> Samples;
+	int32 NumSamples = 0;
+
+	// Closed fixations in the window, in close order
+	THistoryQueue<FFixationRecord> Fixations;
+
+	// Window aggregates
+	double ScanPathLength = 0.0;
+	double SaccadeVelocitySum = 0.0;
+	int32 SaccadeStepCount = 0;
+	double FixationDurationSum = 0.0;
+
+	// Open fixation, anchored at its first sample
+	FVector2D FixationAnchor = FVector2D::ZeroVector;
+	FVector2D FixationSum = FVector2D::ZeroVector;
+	int32 FixationSamples = 0;
+	double FixationStartSeconds = 0.0;
+
+	// Open saccade
+	bool bInSaccade = false;
+	FVector2D SaccadeStart = FVector2D::ZeroVector;
+	double SaccadeStartSeconds = 0.0;
+	float SaccadePeakVelocity = 0.0f;
+
+	FVector2D LastSample = FVector2D::ZeroVector;
+	double LastTimestamp = 0.0;
+
+	bool bCaptureEvents = false;
+	TArray<FBeamGazeEvent> PendingEvents;
+
+	/** Closes the open fixation ending at the previous sample */
+	void CloseFixation();
+
+	/** Closes the open saccade landing at the previous sample */
+	void CloseSaccade();
+
+	/** Drops samples and fixations that fell out of the window ending at NowSeconds */
+	void EvictOlderThan(double NowSeconds);
+
+	void EmitEvent(EBeamGazeEventType Type, double StartSeconds, double EndSeconds, const FVector2D& Position, float Amplitude, float PeakVelocity);
+
+	/** Duration of the open fixation if it qualifies, otherwise zero */
+	double GetOpenFixationDuration() const;
+};
+
+/*=============================================================================
+    End of BeamGazeAnalyzer.h
+=============================================================================*/
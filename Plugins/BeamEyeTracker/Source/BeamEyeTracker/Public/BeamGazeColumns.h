@@ -0,0 +1,41 @@
+/*=============================================================================
+    BeamGazeColumns.h: Structure-of-arrays view of hot Beam tracking data.
+
+    Exposes the gaze, confidence, timestamp and head pose fields of a run
+    of frames as separate contiguous columns, so gaze-only consumers can
+    stream over them without pulling whole FBeamFrame structs through cache.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * One contiguous run of column data. Every pointer addresses Num elements of the same frames, oldest first.
+ * Timestamps stay double because SDK timestamps lose sub-millisecond precision as float.
+ */
+struct FBeamGazeColumns
+{
+	const float* GazeX = nullptr;
+	const float* GazeY = nullptr;
+	const float* GazeConfidence = nullptr;
+	const double* TimestampMs = nullptr;
+
+	const float* HeadPositionX = nullptr;
+	const float* HeadPositionY = nullptr;
+	const float* HeadPositionZ = nullptr;
+	const float* HeadPitch = nullptr;
+	const float* HeadYaw = nullptr;
+	const float* HeadRoll = nullptr;
+	const float* HeadConfidence = nullptr;
+
+	int32 Num = 0;
+};
+
+/*=============================================================================
+    End of BeamGazeColumns.h
+=============================================================================*/
@@ -0,0 +1,109 @@
+/*=============================================================================
+    BeamGazeCursorSubsystem.h: Slate-level gaze cursor for UMG.
+
+    Once per frame, maps the latest gaze into the game window and runs a
+    single query against that window's Slate hit test grid, then routes
+    gaze enter, leave and dwell to every widget on the hit path that
+    implements IBeamGazeWidgetTarget. Gaze-driven UIs cost one hit test
+    per frame however many widgets they contain.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "BeamGazeCursorSubsystem.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+class UUserWidget;
+
+/**
+ * Per game instance gaze cursor.
+ *
+ * Gaze is normalized against the game viewport, so the game viewport's
+ * window is the one hit tested. Only user widgets take part: the hit
+ * path is walked for the Slate wrappers of UUserWidgets, so a gazed
+ * button is reported as the user widget that contains it. Blinks and
+ * dropouts shorter than GazeLossGraceSeconds keep the current widgets.
+ */
+UCLASS(DisplayName = "Beam Gaze Cursor Subsystem")
+class BEAMEYETRACKER_API UBeamGazeCursorSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Innermost user widget under gaze at the last update, interface or not; nullptr when none */
+	UFUNCTION(BlueprintPure, Category = "Beam|UI", meta = (DisplayName = "Get Gazed Widget"))
+	UUserWidget* GetGazedWidget(FVector2D& OutLocalPosition) const;
+
+	/** Seconds gaze has stayed on the innermost gazed widget that implements IBeamGazeWidgetTarget */
+	UFUNCTION(BlueprintPure, Category = "Beam|UI", meta = (DisplayName = "Get Gaze Widget Duration"))
+	float GetGazeDuration() const;
+
+	/** While false no hit test runs and gazed widgets are left */
+	UFUNCTION(BlueprintCallable, Category = "Beam|UI", meta = (DisplayName = "Set Gaze Cursor Enabled"))
+	void SetGazeCursorEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category = "Beam|UI", meta = (DisplayName = "Is Gaze Cursor Enabled"))
+	bool IsGazeCursorEnabled() const { return bGazeCursorEnabled; }
+
+	/** Dwell time for widgets that do not set their own */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|UI")
+	float DefaultDwellSeconds = 0.8f;
+
+	/** Hit test radius in slate units; gaze lands on the nearest hit-testable widget within it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|UI")
+	float CursorRadius = 16.0f;
+
+	/** Frames below this confidence count as gaze loss */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|UI")
+	float MinConfidence = 0.3f;
+
+	/** Gaze loss shorter than this keeps the gazed widgets, so blinks do not reset dwell */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|UI")
+	float GazeLossGraceSeconds = 0.15f;
+
+private:
+	struct FGazedWidget
+	{
+		TWeakObjectPtr<UUserWidget> Widget;
+		double EnterSeconds = 0.0;
+		float DwellSeconds = 0.0f;
+		bool bDwellFired = false;
+	};
+
+	UPROPERTY()
+	TObjectPtr<UBeamEyeTrackerSubsystem> BeamSubsystem;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	bool bGazeCursorEnabled = true;
+
+	/** Interface implementers on the current hit path, outermost first */
+	TArray<FGazedWidget> GazedWidgets;
+
+	/** Result of the last hit test, for GetGazedWidget */
+	TWeakObjectPtr<UUserWidget> InnermostWidget;
+	FVector2D InnermostLocalPosition = FVector2D::ZeroVector;
+
+	double LastGazeSeconds = 0.0;
+
+	bool Tick(float DeltaTime);
+
+	/** Hit tests the game window at Screen01; fills OutTargets outermost first, with local positions */
+	void HitTest(const FVector2D& Screen01, TArray<TPair<UUserWidget*, FVector2D>, TInlineAllocator<8>>& OutTargets);
+
+	/** Leaves widgets no longer hit, enters new ones and fires due dwells */
+	void UpdateGazedWidgets(TArrayView<const TPair<UUserWidget*, FVector2D>> Targets, double NowSeconds);
+};
+
+/*=============================================================================
+    End of BeamGazeCursorSubsystem.h
+=============================================================================*/
@@ -0,0 +1,52 @@
+/*=============================================================================
+    BeamGazeQueries.h: Latent Blueprint actions over awaitable gaze queries.
+
+    Blueprint counterparts of UBeamFocusSubsystem's WaitForFixationOn,
+    WaitForGazeEnter and WaitForTrackingHealthy. Each node holds one query
+    that the focus dispatcher resolves as new frames arrive; the node
+    itself does no gaze work.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
+#include "Templates/Function.h"
+#include "BeamFocusSubsystem.h"
+#include "BeamGazeQueries.generated.h"
+
+class AActor;
+
+/** Latent gaze waits; a TimeoutSeconds of 0 or less waits indefinitely */
+UCLASS(meta = (DisplayName = "Beam Gaze Query Library"))
+class BEAMEYETRACKER_API UBeamGazeQueryLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Continues once gaze has stayed on Target for MinMs; blinks shorter than the focus grace period do not reset it */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Async", meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", ExpandEnumAsExecs = "Result", DisplayName = "Wait For Fixation On"))
+	static void WaitForFixationOn(const UObject* WorldContextObject, AActor* Target, float MinMs, float TimeoutSeconds, EBeamGazeQueryResult& Result, FLatentActionInfo LatentInfo);
+
+	/** Continues on the first frame whose gaze lies inside the Screen01 rectangle [Min, Max] */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Async", meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", ExpandEnumAsExecs = "Result", DisplayName = "Wait For Gaze Enter"))
+	static void WaitForGazeEnter(const UObject* WorldContextObject, FVector2D Min, FVector2D Max, float TimeoutSeconds, EBeamGazeQueryResult& Result, FLatentActionInfo LatentInfo);
+
+	/** Continues once the tracker reports a healthy state */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Async", meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", ExpandEnumAsExecs = "Result", DisplayName = "Wait For Tracking Healthy"))
+	static void WaitForTrackingHealthy(const UObject* WorldContextObject, float TimeoutSeconds, EBeamGazeQueryResult& Result, FLatentActionInfo LatentInfo);
+
+private:
+	/** Registers a latent action around the query MakeQuery issues; a node already waiting is left alone */
+	static void StartLatentQuery(const UObject* WorldContextObject, EBeamGazeQueryResult& Result, const FLatentActionInfo& LatentInfo,
+		TFunctionRef<FBeamGazeQuery(UBeamFocusSubsystem&)> MakeQuery);
+};
+
+/*=============================================================================
+    End of BeamGazeQueries.h
+=============================================================================*/
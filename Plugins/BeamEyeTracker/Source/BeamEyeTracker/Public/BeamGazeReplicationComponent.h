@@ -0,0 +1,201 @@
+/*=============================================================================
+    BeamGazeReplicationComponent.h: Bandwidth-efficient gaze sharing for multiplayer.
+
+    The owning client samples its tracker at a fixed rate and sends batches
+    of samples to the server over an unreliable RPC at a lower rate. The
+    server forwards the newest batch to every other connection through one
+    replicated property. A batch is quantized (16-bit gaze, 8-bit confidence,
+    millimetre head position, 16-bit head angles) and delta coded against
+    the previous sample in the same batch, so it decodes without any
+    acknowledged baseline and a lost packet only costs its own samples.
+    Remote clients play the samples back from a short jitter buffer,
+    interpolating between them at a fixed delay.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamGazeReplicationComponent.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+
+/** One quantized gaze and head pose sample */
+struct FBeamNetGazeSample
+{
+	/** Milliseconds after the batch base time */
+	uint32 TimeOffsetMs = 0;
+
+	/** Screen01 mapped from [-0.25, 1.25] onto 0..65535, so slightly off-screen gaze survives */
+	uint16 GazeX = 0;
+	uint16 GazeY = 0;
+	uint8 GazeConfidence = 0;
+
+	/** Head position in millimetres */
+	int32 HeadPositionMm[3] = { 0, 0, 0 };
+
+	/** Pitch, yaw, roll as FRotator::CompressAxisToShort */
+	uint16 HeadRotation[3] = { 0, 0, 0 };
+	uint8 HeadConfidence = 0;
+
+	bool bGazeValid = false;
+
+	static FBeamNetGazeSample Quantize(const FBeamFrame& Frame, uint32 TimeOffsetMs);
+	void Dequantize(FGazePoint& OutGaze, FHeadPose& OutHead) const;
+};
+
+/** Batch of samples sent by the owning client and replicated to everyone else */
+USTRUCT()
+struct BEAMEYETRACKER_API FBeamNetGazeBatch
+{
+	GENERATED_BODY()
+
+	/** Most samples one batch carries */
+	static constexpr int32 MaxSamples = 8;
+
+	/** Sender clock in milliseconds of the first sample; only differences between batches are used */
+	uint32 BaseTimeMs = 0;
+
+	/** Incremented by the sender per batch; receivers drop batches that arrive out of order */
+	uint16 Sequence = 0;
+
+	/** Head pose is optional per batch */
+	bool bHasHead = false;
+
+	TArray<FBeamNetGazeSample, TInlineAllocator<MaxSamples>> Samples;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+	bool Identical(const FBeamNetGazeBatch* Other, uint32 PortFlags) const;
+};
+
+template<>
+struct TStructOpsTypeTraits<FBeamNetGazeBatch> : public TStructOpsTypeTraitsBase2<FBeamNetGazeBatch>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = false,
+		WithIdentical = true
+	};
+};
+
+/**
+ * Shares the owning player's gaze and head pose with the other players.
+ * Add it to the pawn or player state; on the owning client it reads the local
+ * tracker, everywhere else it provides the interpolated remote gaze.
+ */
+UCLASS(ClassGroup = "Beam Eye Tracking", meta = (BlueprintSpawnableComponent), DisplayName = "Beam Gaze Replication Component")
+class BEAMEYETRACKER_API UBeamGazeReplicationComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UBeamGazeReplicationComponent();
+
+	//~ Begin UActorComponent Interface
+	virtual void BeginPlay() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+	//~ End UActorComponent Interface
+
+	/** Whether the owning player's gaze is shared at all; set on the owning client, remote copies go stale when off */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Replication")
+	bool bShareGaze = true;
+
+	/** Include the head pose; gaze alone costs about half the bandwidth */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Replication")
+	bool bShareHeadPose = true;
+
+	/** Tracker samples taken per second on the owning client */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Replication", meta = (ClampMin = "1", ClampMax = "120", Units = "Hz"))
+	float SampleRateHz = 30.0f;
+
+	/** Batches sent per second; each carries the samples taken since the previous one */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Replication", meta = (ClampMin = "1", ClampMax = "60", Units = "Hz"))
+	float SendRateHz = 10.0f;
+
+	/** While gaze and head stay within this much Screen01 distance, no new batch is sent */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Replication", meta = (ClampMin = "0.0", ClampMax = "0.1"))
+	float IdleThreshold01 = 0.002f;
+
+	/** How far behind the sender remote playback runs; must cover one send interval plus network jitter */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Replication", meta = (ClampMin = "0.0", ClampMax = "1.0", Units = "s"))
+	float InterpolationDelaySeconds = 0.15f;
+
+	/** Remote gaze older than this is reported invalid and stops being replicated */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Replication", meta = (ClampMin = "0.1", ClampMax = "10.0", Units = "s"))
+	float StaleTimeoutSeconds = 1.0f;
+
+	/**
+	 * Gaze and head pose of the player owning this component: the local tracker on the owning client,
+	 * the interpolated replicated samples everywhere else. False when there is no recent data.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Replication", meta = (DisplayName = "Get Shared Gaze"))
+	bool GetSharedGaze(FGazePoint& OutGaze, FHeadPose& OutHead) const;
+
+	/** True on the client that owns this component's actor */
+	UFUNCTION(BlueprintPure, Category = "Beam|Replication")
+	bool IsLocallyOwned() const;
+
+protected:
+	UFUNCTION(Server, Unreliable)
+	void ServerSubmitGaze(const FBeamNetGazeBatch& Batch);
+
+	UFUNCTION()
+	void OnRep_GazeBatch();
+
+private:
+	/** Newest batch from the owner; skipped for the owner itself */
+	UPROPERTY(ReplicatedUsing = OnRep_GazeBatch)
+	FBeamNetGazeBatch GazeBatch;
+
+	/** Decoded remote sample on the local playback clock */
+	struct FPlaybackSample
+	{
+		double LocalSeconds = 0.0;
+		FGazePoint Gaze;
+		FHeadPose Head;
+	};
+
+	/** Applies a batch on the server, keeping only batches that are newer and not above the send rate */
+	void AcceptBatch(const FBeamNetGazeBatch& Batch);
+
+	/** Decodes a received batch into the playback buffer */
+	void BufferBatch(const FBeamNetGazeBatch& Batch);
+
+	void SampleLocalTracker(double NowSeconds);
+	void SendPendingBatch(double NowSeconds);
+	UBeamEyeTrackerSubsystem* ResolveSubsystem() const;
+
+	mutable TWeakObjectPtr<UBeamEyeTrackerSubsystem> CachedSubsystem;
+
+	// Owning client
+	FBeamNetGazeBatch PendingBatch;
+	FBeamNetGazeSample LastSentSample;
+	double NextSampleSeconds = 0.0;
+	double NextSendSeconds = 0.0;
+	double LastSentSeconds = 0.0;
+	uint16 NextSequence = 0;
+	bool bHasSentSample = false;
+
+	// Server
+	double LastAcceptedSeconds = 0.0;
+	double LastBatchSeconds = -1.0e9;
+
+	// Remote playback
+	TArray<FPlaybackSample> Playback;
+	double SenderToLocalSeconds = 0.0;
+	bool bHasClockOffset = false;
+	uint16 LastReceivedSequence = 0;
+	bool bHasReceived = false;
+};
+
+/*=============================================================================
+    End of BeamGazeReplicationComponent.h
+=============================================================================*/
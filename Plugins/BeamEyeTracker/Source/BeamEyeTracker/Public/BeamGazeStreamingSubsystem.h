@@ -0,0 +1,64 @@
+/*=============================================================================
+    BeamGazeStreamingSubsystem.h: Gaze-contingent texture streaming priority.
+
+    While beam.Streaming.GazeBoost is on, the actor under the gaze is fed
+    to the texture streamer as an extra, boosted view located where the
+    gaze ray hits it, so its textures reach full resolution sooner. The
+    streaming pool budget is unchanged: the boost only reorders what the
+    streamer loads first, which leaves the periphery with what is left.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BeamGazeStreamingSubsystem.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+
+/**
+ * Per-world gaze streaming booster.
+ *
+ * The gaze position comes from the render thread's late-latched,
+ * prediction-corrected sample when foveation is running, which is where
+ * the player sees the gaze on screen, and from the frame ring otherwise.
+ * The ray goes through UBeamGazeTraceSubsystem, so it shares the frame's
+ * batched trace with every other gaze consumer and the hit is one frame
+ * old, which is well inside the streamer's own latency.
+ */
+UCLASS()
+class BEAMEYETRACKER_API UBeamGazeStreamingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UTickableWorldSubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
+	/** Actor whose textures are currently boosted, null when none */
+	UFUNCTION(BlueprintPure, Category = "Beam|Streaming", meta = (DisplayName = "Get Gaze Streaming Target"))
+	AActor* GetBoostedActor() const { return BoostedActor.Get(); }
+
+private:
+	TWeakObjectPtr<AActor> BoostedActor;
+	FVector BoostLocation = FVector::ZeroVector;
+	double BoostHitSeconds = 0.0;
+
+	/** Keeps the view extension alive so the late-latched gaze is available */
+	TWeakObjectPtr<UBeamEyeTrackerSubsystem> FoveationOwner;
+
+	bool GetGazeScreen01(UBeamEyeTrackerSubsystem* Beam, FVector2D& OutScreen01) const;
+	void ReleaseFoveationUser();
+};
+
+/*=============================================================================
+    End of BeamGazeStreamingSubsystem.h
+=============================================================================*/
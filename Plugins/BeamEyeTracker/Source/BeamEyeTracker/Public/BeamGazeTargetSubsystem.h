@@ -0,0 +1,114 @@
+/*=============================================================================
+    BeamGazeTargetSubsystem.h: Screen-space registry of gaze targets.
+
+    Registered actors are projected to screen rectangles and binned into a
+    uniform grid at most once per frame, so closest-to-gaze, hit and dwell
+    queries examine only the targets near the gaze point instead of every
+    interactable in the level.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BeamGazeTargetSubsystem.generated.h"
+
+/**
+ * Per-world gaze target registry.
+ *
+ * The grid is rebuilt lazily by the first query of a frame: one bounds
+ * projection per registered target, then a counting sort into cells. A
+ * query touches only the cells within its search radius; targets whose
+ * rectangle covers a large part of the screen are kept in a short side
+ * list instead of being copied into most cells.
+ */
+UCLASS()
+class BEAMEYETRACKER_API UBeamGazeTargetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Beam|Interaction", meta = (DisplayName = "Register Gaze Target"))
+	void RegisterGazeTarget(AActor* Target);
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Interaction", meta = (DisplayName = "Unregister Gaze Target"))
+	void UnregisterGazeTarget(AActor* Target);
+
+	UFUNCTION(BlueprintPure, Category = "Beam|Interaction", meta = (DisplayName = "Is Gaze Target Registered"))
+	bool IsGazeTargetRegistered(const AActor* Target) const;
+
+	/** Registered target whose screen bounds are nearest to the gaze (0 when inside); nearer to the camera wins ties */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Interaction", meta = (DisplayName = "Get Gazed Target"))
+	AActor* GetClosestTargetToGaze(float MaxDistancePixels = 50.0f);
+
+	/** True when the gaze lies within MarginPixels of Target's screen bounds; Target must be registered */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Interaction", meta = (DisplayName = "Is Gaze On Target"))
+	bool IsGazeOnTarget(const AActor* Target, float MarginPixels = 0.0f);
+
+	/** True when ScreenPx lies within MarginPixels of Target's screen bounds; Target must be registered */
+	bool IsPointOnTarget(const AActor* Target, const FVector2f& ScreenPx, float MarginPixels);
+
+	/** Closest target to an arbitrary viewport pixel position; for dwell and focus systems */
+	AActor* GetClosestTargetToPoint(const FVector2f& ScreenPx, float MaxDistancePixels);
+
+	/** Current gaze in viewport pixels; false when there is no valid gaze or view */
+	bool GetGazeScreenPosition(FVector2f& OutScreenPx);
+
+	/** Maps a Screen01 gaze position into this frame's view rectangle; false when there is no view */
+	bool Screen01ToViewportPx(const FVector2D& Screen01, FVector2f& OutScreenPx);
+
+	int32 GetNumTargets() const { return Targets.Num(); }
+
+	/**
+	 * Visits every registered target that is on screen this frame with its projected bounds and camera
+	 * distance, from the same per-frame projection the queries use; false when there is no view.
+	 */
+	bool ForEachScreenTarget(TFunctionRef<void(AActor* Target, const FBox2f& ScreenRect, float Depth)> Visitor);
+
+	/** This frame's view rectangle in viewport pixels; false when there is no view */
+	bool GetViewRect(FIntRect& OutViewRect);
+
+	/** Pixel distance from Point to Rect, 0 inside */
+	static float DistanceToRect(const FBox2f& Rect, const FVector2f& Point);
+
+private:
+	/** Grid resolution over the view rectangle */
+	static constexpr int32 GridX = 32;
+	static constexpr int32 GridY = 18;
+
+	struct FScreenTarget
+	{
+		FBox2f Rect;
+		float Depth;
+		int32 TargetIndex;
+	};
+
+	TArray<TWeakObjectPtr<AActor>> Targets;
+
+	// Per-frame acceleration structure
+	uint64 BuiltFrame = MAX_uint64;
+	bool bHasView = false;
+	FIntRect ViewRect;
+	FVector2f CellSize = FVector2f::UnitVector;
+	TArray<FScreenTarget> ScreenTargets;
+	TArray<int32> TargetToScreen;
+	TArray<int32> CellStart;
+	TArray<int32> CellItems;
+	TArray<int32> LargeItems;
+
+	/** Query stamp per screen target so each is tested once per query */
+	TArray<uint32> VisitStamp;
+	uint32 CurrentStamp = 0;
+
+	void EnsureBuilt();
+	void Build();
+	int32 FindNearest(const FVector2f& ScreenPx, float MaxDistancePixels);
+};
+
+/*=============================================================================
+    End of BeamGazeTargetSubsystem.h
+=============================================================================*/
@@ -0,0 +1,126 @@
+/*=============================================================================
+    BeamGazeTraceSubsystem.h: Batched asynchronous gaze traces.
+
+    Collects every gaze trace requested during a frame, issues each distinct
+    ray once through the world's async trace interface and hands results to
+    subscribers on the next frame, so the physics scene is queried once per
+    view rather than once per caller.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/HitResult.h"
+#include "WorldCollision.h"
+#include "BeamGazeTraceSubsystem.generated.h"
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnBeamGazeTraceResult, bool, bHit, const FHitResult&, HitResult);
+
+/** Native completion callback; runs on the game thread the frame after the request */
+using FBeamGazeTraceCallback = TFunction<void(bool bHit, const FHitResult& HitResult)>;
+
+/**
+ * Per-world gaze trace service.
+ *
+ * Requests are deduplicated by ray (0.1 cm quantization) and channel, so
+ * components and Blueprints casting the same gaze ray in one frame share
+ * one trace. Each tick submits the frame's unique rays with
+ * AsyncLineTraceByChannel; their results arrive during the next world
+ * tick, are delivered to every subscriber of the ray and become the
+ * cache read by FindRecentResult and GazeTrace.
+ */
+UCLASS()
+class BEAMEYETRACKER_API UBeamGazeTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UTickableWorldSubsystem Interface
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
+	/** Queues a trace whose result is delivered next frame */
+	void RequestTrace(const FVector& Start, const FVector& End, ECollisionChannel Channel, FBeamGazeTraceCallback&& Callback);
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Trace", meta = (DisplayName = "Request Gaze Trace", ToolTip = "Queue a line trace; OnResult fires next frame and is shared with identical requests"))
+	void RequestGazeTrace(const FVector& Start, const FVector& End, ECollisionChannel Channel, FOnBeamGazeTraceResult OnResult);
+
+	/**
+	 * Looks up the newest completed trace for a ray close to Start→End (within 5 cm at the
+	 * origin and about 1 degree in direction) on Channel. Returns false when none matches.
+	 */
+	bool FindRecentResult(const FVector& Start, const FVector& End, ECollisionChannel Channel, bool& bOutHit, FHitResult& OutHit) const;
+
+	/**
+	 * Per-tick friendly trace: returns the most recent batched result for this ray and queues
+	 * the ray for the next batch. Falls back to a synchronous trace only when no recent
+	 * result matches, e.g. on the first frame or after a camera cut.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Trace", meta = (DisplayName = "Gaze Trace (Batched)", WorldContext = "WorldContextObject"))
+	static bool GazeTrace(const UObject* WorldContextObject, const FVector& Start, const FVector& End, ECollisionChannel Channel, FHitResult& OutHit);
+
+	/** Traces issued to physics and requests served, for measuring the deduplication */
+	uint64 GetTracesIssued() const { return TracesIssued; }
+	uint64 GetRequestsServed() const { return RequestsServed; }
+
+private:
+	struct FRayKey
+	{
+		FIntVector Start;
+		FIntVector End;
+		uint8 Channel;
+
+		bool operator==(const FRayKey& Other) const
+		{
+			return Start == Other.Start && End == Other.End && Channel == Other.Channel;
+		}
+
+		friend uint32 GetTypeHash(const FRayKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Start), GetTypeHash(Key.End)), Key.Channel);
+		}
+	};
+
+	struct FTrace
+	{
+		FVector Start;
+		FVector End;
+		ECollisionChannel Channel;
+		TArray<FBeamGazeTraceCallback, TInlineAllocator<2>> Callbacks;
+		FHitResult Hit;
+		bool bHit = false;
+		bool bDone = false;
+	};
+
+	/** Requests of the current frame, not yet submitted */
+	TArray<FTrace> Pending;
+	TMap<FRayKey, int32> PendingIndex;
+
+	/** Submitted last tick; results land here before this tick runs */
+	TArray<FTrace> InFlight;
+	uint32 InFlightTraceFrame = 0;
+
+	/** Newest completed batch, the cache for FindRecentResult */
+	TArray<FTrace> Completed;
+
+	FTraceDelegate TraceDelegate;
+
+	uint64 TracesIssued = 0;
+	uint64 RequestsServed = 0;
+
+	static FRayKey MakeKey(const FVector& Start, const FVector& End, ECollisionChannel Channel);
+
+	void HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+};
+
+/*=============================================================================
+    End of BeamGazeTraceSubsystem.h
+=============================================================================*/
@@ -0,0 +1,67 @@
+/*=============================================================================
+    BeamGazeTrail.h: Fixed-capacity screen-space gaze trail.
+
+    Keeps recent gaze points in a ring and draws them as one batched
+    triangle strip, fading and tapering toward the oldest point, so the
+    number of canvas draw items stays at one whatever the trail length.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FCanvas;
+struct FCanvasUVTri;
+
+/** Screen-space gaze trail in a fixed ring, drawn as a single FCanvasTriangleItem */
+class BEAMEYETRACKER_API FBeamGazeTrail
+{
+public:
+	explicit FBeamGazeTrail(int32 InCapacity = 180);
+	~FBeamGazeTrail();
+
+	/** Resizes the ring; drops every point when the capacity changes */
+	void SetCapacity(int32 InCapacity);
+	int32 GetCapacity() const { return Points.Num(); }
+
+	/** Appends a point, overwriting the oldest one once the ring is full */
+	void AddPoint(const FVector2D& Point);
+	void Reset();
+
+	int32 Num() const { return Count; }
+
+	/** Point by age, 0 being the oldest */
+	const FVector2D& GetPoint(int32 Index) const;
+
+	/** Draws the trail with Color at the newest end; Thickness is the width in pixels of the newest segment */
+	void Draw(FCanvas* Canvas, const FLinearColor& Color, float Thickness = 2.0f) const;
+
+	/**
+	 * Draws NumPoints points, oldest first, as one triangle batch: two triangles per segment with
+	 * per-vertex alpha and width falling off toward the oldest point. Scratch is reused between calls.
+	 */
+	static void DrawPolyline(FCanvas* Canvas, TFunctionRef<FVector2D(int32)> GetPointAt, int32 NumPoints,
+		const FLinearColor& Color, float Thickness, TArray<FCanvasUVTri>& Scratch);
+
+	/** Appends the DrawPolyline triangles to OutTriangles without drawing, for callers batching several primitives */
+	static void AppendPolyline(TFunctionRef<FVector2D(int32)> GetPointAt, int32 NumPoints,
+		const FLinearColor& Color, float Thickness, TArray<FCanvasUVTri>& OutTriangles);
+
+private:
+	TArray<FVector2D> Points;
+
+	/** Slot the next point is written to */
+	int32 Head = 0;
+	int32 Count = 0;
+
+	/** Triangle list rebuilt in place every draw */
+	mutable TArray<FCanvasUVTri> Triangles;
+};
+
+/*=============================================================================
+    End of BeamGazeTrail.h
+=============================================================================*/
@@ -0,0 +1,167 @@
+/*=============================================================================
+    BeamGazeViewExtension.h: Render-thread gaze sampling for foveation.
+
+    Late-latches the newest tracking frame on the render thread, right
+    before each view renders, and turns it into foveation parameters
+    (center and region radii in view pixels) for shading-rate consumers,
+    plus a variable rate shading image on hardware that takes one, handed
+    to the renderer's VRS image manager as its eye-tracked foveation source.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SceneViewExtension.h"
+#include "RendererInterface.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamPredictor.h"
+#include "BeamRing.h"
+#include <atomic>
+
+/** Number of foveation rings around the gaze center, innermost first */
+#define BEAM_FOVEATION_NUM_RADII 3
+
+/** Per-view foveation state computed on the render thread */
+struct FBeamFoveationParams
+{
+	/** Foveation center in the view's render target, in pixels */
+	FVector2f CenterPx = FVector2f::ZeroVector;
+
+	/** Foveation center normalized to the view rect */
+	FVector2f CenterUV = FVector2f(0.5f, 0.5f);
+
+	/** Region radii in pixels, innermost (full rate) first */
+	float RadiiPx[BEAM_FOVEATION_NUM_RADII] = { 0.0f, 0.0f, 0.0f };
+
+	/** SDK timestamp of the frame the center was taken from (after prediction) */
+	double SampleTimestampMs = 0.0;
+
+	/** False when no valid gaze was available; consumers should fall back to fixed foveation */
+	bool bValid = false;
+};
+
+/** Foveation configuration captured on the game thread when the extension is created */
+struct FBeamFoveationConfig
+{
+	/** Region radii normalized by view width, innermost first */
+	float NormalizedRadii[BEAM_FOVEATION_NUM_RADII] = { 0.1f, 0.25f, 0.45f };
+
+	/** Frames between render-thread sampling and scan-out used as the prediction horizon */
+	float RenderLatencyFrames = 1.0f;
+
+	/** Build a shading rate image per view when the RHI supports image-based VRS */
+	bool bBuildShadingRateImage = true;
+
+	/** Radii grow by up to this factor as confidence falls to zero */
+	float ConfidenceExpansion = 1.0f;
+
+	/** Multiples of the running prediction error added to every radius */
+	float PredictionErrorScale = 2.0f;
+
+	/** Radius scale while tracking is degraded or lost */
+	float FallbackRadiusScale = 1.5f;
+
+	FBeamPredictorParams PredictorParams;
+};
+
+/**
+ * Scene view extension that samples gaze in PreRenderView_RenderThread.
+ *
+ * The ring is read through its non-consuming seqlock path, so sampling here
+ * never contends with the producer or game-thread readers. Owned by the
+ * subsystem, which detaches it and flushes rendering before the ring dies.
+ */
+class BEAMEYETRACKER_API FBeamGazeViewExtension : public FSceneViewExtensionBase
+{
+public:
+	FBeamGazeViewExtension(const FAutoRegister& AutoRegister, const FBeamFrameRing* InRing, const FBeamFoveationConfig& InConfig);
+
+	//~ Begin ISceneViewExtension Interface
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView) override;
+	//~ End ISceneViewExtension Interface
+
+	/** Render-thread-safe read of the newest published frame */
+	bool GetLatestFrame_RenderThread(FBeamFrame& OutFrame) const;
+
+	/** Foveation parameters of the view that most recently rendered (render thread only) */
+	const FBeamFoveationParams& GetFoveation_RenderThread() const { return LatestFoveation; }
+
+	/**
+	 * Palette shading rate image built for View, sized for VRS tiles over its render target; null
+	 * without image-based VRS or before the view rendered. Images are kept per view key, so split
+	 * screen and stereo views each bind their own; views without state share key 0. The renderer
+	 * picks these up through the VRS image manager; custom passes can also bind them as their
+	 * render pass ShadingRateTexture (render thread only).
+	 */
+	TRefCountPtr<IPooledRenderTarget> GetShadingRateImage_RenderThread(const FSceneView& View) const;
+
+	/** The same image as a texture of GraphBuilder: this frame's pass output when it was built in that graph (render thread only) */
+	FRDGTextureRef GetShadingRateImage_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View) const;
+
+	/** Tracking health; degraded tracking widens the rings, lost tracking falls back to fixed foveation (any thread) */
+	void SetHealth(EBeamHealth InHealth);
+
+	/**
+	 * Predicted Screen01 gaze the render thread last latched, for game-thread systems that want the
+	 * on-screen position rather than the newest sample. False when none was latched within MaxAgeSeconds.
+	 */
+	bool GetLatchedGaze(FVector2D& OutScreen01, double MaxAgeSeconds) const;
+
+	/** Hands the primary player's post-camera gaze ray to the render thread (game thread) */
+	void SetGazeWorldRay(const FBeamWorldRay& Ray);
+
+	/** Gaze ray the game thread captured after this frame's camera update (render thread only) */
+	const FBeamWorldRay& GetGazeWorldRay_RenderThread() const { return GazeWorldRay; }
+
+	/** Stops all ring access; the owner must flush rendering commands before freeing the ring (game thread) */
+	void Detach();
+
+protected:
+	virtual bool IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const override;
+
+private:
+	std::atomic<const FBeamFrameRing*> Ring;
+	const FBeamFoveationConfig Config;
+
+	// Render thread state
+	FBeamGazePredictor RenderPredictor;
+	TArray<FBeamFrame> RenderScratch;
+	FBeamFoveationParams LatestFoveation;
+	FBeamWorldRay GazeWorldRay;
+
+	/** One view's extracted shading rate image; boxed in the map so the extraction target never moves */
+	struct FViewShadingRateImage
+	{
+		TRefCountPtr<IPooledRenderTarget> Image;
+		uint64 LastFrame = 0;
+
+		/** This frame's pass output, valid only inside the graph that built it */
+		FRDGTextureRef GraphImage = nullptr;
+		const FRDGBuilder* Graph = nullptr;
+	};
+	TMap<uint32, TUniquePtr<FViewShadingRateImage>> ShadingRateImages;
+
+	// Running prediction error: the pending prediction is scored against the first sample at its target time
+	double PendingPredictionMs = -1.0;
+	FVector2D PendingPrediction01 = FVector2D::ZeroVector;
+	double PredictionError01 = 0.0;
+
+	std::atomic<EBeamHealth> Health{ EBeamHealth::Ok };
+
+	void AddShadingRateImage(FRDGBuilder& GraphBuilder, const FSceneView& View, const FIntRect& ViewRect, bool bTracking, bool bHealthy);
+
+	// Published by the render thread for GetLatchedGaze; two floats packed so they never tear
+	std::atomic<uint64> LatchedGazeBits{ 0 };
+	std::atomic<double> LatchedAtSeconds{ 0.0 };
+};
+
+/*=============================================================================
+    End of BeamGazeViewExtension.h
+=============================================================================*/
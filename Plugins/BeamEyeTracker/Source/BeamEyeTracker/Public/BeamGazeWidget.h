@@ -108,6 +108,20 @@ public:
     UPROPERTY(meta = (BindWidget))
     class UTextBlock* ErrorText;
 
+    /**
+     * Keeps the widget cheap enough to leave on in performance captures: the tree is cached in an
+     * SInvalidationPanel, the gaze indicator moves and hides through its render transform and opacity only,
+     * and text refreshes at TextUpdateFrequency. Read when the widget is built.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Beam|Performance",
+              meta = (DisplayName = "Low Overhead Updates", ToolTip = "Cache the widget in an invalidation panel, move the gaze indicator by render transform only and refresh text at a lower rate"))
+    bool bLowOverheadUpdates = false;
+
+    /** Text refresh rate in low-overhead mode (Hz); text is only set when its value changed */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Beam|Performance",
+              meta = (ClampMin = "0.5", ClampMax = "30.0", Units = "Hz", EditCondition = "bLowOverheadUpdates", ToolTip = "How often text fields refresh in low-overhead mode (Hz)"))
+    float TextUpdateFrequency = 4.0f;
+
 public:
     /** Enable/disable gaze visualization */
     UFUNCTION(BlueprintCallable, Category = "Beam|Display",
@@ -140,6 +154,10 @@ public:
     float GetCurrentConfidence() const;
 
 protected:
+    //~ Begin UWidget Interface
+    virtual TSharedRef<SWidget> RebuildWidget() override;
+    //~ End UWidget Interface
+
     /** Called when tracking status changes */
     UFUNCTION(BlueprintImplementableEvent, Category = "Beam|Events",
               meta = (DisplayName = "On Tracking Status Changed", ToolTip = "Called when eye tracking status changes"))
@@ -181,9 +199,26 @@ private:
     float LastFPSUpdateTime;
     int32 FrameCount;
 
+    /** Last text refresh time, and the strings currently shown so unchanged values are never set again */
+    float LastTextUpdateTime = 0.0f;
+    FString ShownStatusString;
+    FString ShownFPSString;
+    FString ShownConfidenceString;
+    FString ShownCoordinatesString;
+    FString ShownErrorString;
+
+    /** Widget size from the last tick, used to place the gaze indicator */
+    FVector2D CachedLocalSize = FVector2D::ZeroVector;
+
     /** Update all widget elements */
     void UpdateWidget();
 
+    /** Update every text field and the quality bar */
+    void UpdateTextFields();
+
+    /** Check if it's time to refresh text in low-overhead mode */
+    bool ShouldUpdateText() const;
+
     /** Update gaze indicator position */
     void UpdateGazeIndicator();
 
@@ -0,0 +1,61 @@
+/*=============================================================================
+    BeamGazeWidgetTarget.h: Gaze notifications for UMG widgets.
+
+    User widgets implementing this interface receive gaze enter, leave and
+    dwell from UBeamGazeCursorSubsystem, which finds them with one Slate
+    hit test per frame instead of each widget checking its own geometry.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "BeamGazeWidgetTarget.generated.h"
+
+UINTERFACE(BlueprintType, MinimalAPI, meta = (DisplayName = "Beam Gaze Widget Target"))
+class UBeamGazeWidgetTarget : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Gaze routing for a UUserWidget.
+ *
+ * Like mouse hover, gaze bubbles: nested widgets that all implement the
+ * interface are entered together, outermost first, and left innermost
+ * first. Dwell fires once per visit after the widget's dwell time.
+ */
+class BEAMEYETRACKER_API IBeamGazeWidgetTarget
+{
+	GENERATED_BODY()
+
+public:
+	/** Gaze arrived on the widget; LocalPosition is in the widget's local space */
+	UFUNCTION(BlueprintNativeEvent, Category = "Beam|UI", meta = (DisplayName = "On Gaze Enter"))
+	void OnGazeEnter(FVector2D LocalPosition);
+
+	UFUNCTION(BlueprintNativeEvent, Category = "Beam|UI", meta = (DisplayName = "On Gaze Leave"))
+	void OnGazeLeave();
+
+	/** Gaze stayed on the widget for DwellSeconds */
+	UFUNCTION(BlueprintNativeEvent, Category = "Beam|UI", meta = (DisplayName = "On Gaze Dwell"))
+	void OnGazeDwell(float DwellSeconds);
+
+	/** Dwell time for this widget; zero or less uses the cursor subsystem's DefaultDwellSeconds */
+	UFUNCTION(BlueprintNativeEvent, Category = "Beam|UI", meta = (DisplayName = "Get Gaze Dwell Seconds"))
+	float GetGazeDwellSeconds() const;
+
+protected:
+	virtual void OnGazeEnter_Implementation(FVector2D LocalPosition) {}
+	virtual void OnGazeLeave_Implementation() {}
+	virtual void OnGazeDwell_Implementation(float DwellSeconds) {}
+	virtual float GetGazeDwellSeconds_Implementation() const { return 0.0f; }
+};
+
+/*=============================================================================
+    End of BeamGazeWidgetTarget.h
+=============================================================================*/
@@ -0,0 +1,117 @@
+/*=============================================================================
+    BeamHeatmapSubsystem.h: GPU-accumulated gaze heatmap.
+
+    Follows the tracking ring and splats every new gaze sample into a
+    decaying render target once per frame, so attention maps stay live for
+    any session length at a fixed GPU cost and almost no CPU cost.
+    Recorded sessions can be merged into the same map.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "BeamEyeTrackerTypes.h"
+#include "Containers/Ticker.h"
+#include "BeamHeatmapSubsystem.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+class UTextureRenderTarget2D;
+
+/**
+ * Gaze heatmap accumulated on the GPU.
+ *
+ * Each frame the samples published since the previous frame are uploaded
+ * as one batch; a compute pass decays the accumulator by the configured
+ * half-life and adds one Gaussian per sample weighted by confidence, then a
+ * second pass colorizes it into the texture returned by GetHeatmapTexture.
+ * The game thread only copies new frames out of the ring.
+ */
+UCLASS(DisplayName = "Beam Heatmap Subsystem")
+class BEAMEYETRACKER_API UBeamHeatmapSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Lifecycle
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Heatmap", meta = (DisplayName = "Start Gaze Heatmap", ToolTip = "Begin accumulating live gaze into the heatmap"))
+	bool StartHeatmap();
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Heatmap", meta = (DisplayName = "Stop Gaze Heatmap", ToolTip = "Stop accumulating; the heatmap texture keeps its contents"))
+	void StopHeatmap();
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Heatmap", meta = (DisplayName = "Clear Gaze Heatmap", ToolTip = "Erase all accumulated heat"))
+	void ClearHeatmap();
+
+	UFUNCTION(BlueprintPure, Category = "Beam|Heatmap", meta = (DisplayName = "Is Gaze Heatmap Active"))
+	bool IsHeatmapActive() const { return bHeatmapActive; }
+
+	/** Colorized heatmap (RGBA8, alpha follows intensity); null until the heatmap is first started or merged into */
+	UFUNCTION(BlueprintPure, Category = "Beam|Heatmap", meta = (DisplayName = "Get Gaze Heatmap Texture"))
+	UTextureRenderTarget2D* GetHeatmapTexture() const { return DisplayTarget; }
+
+	/**
+	 * Configures accumulation. Sigma is a fraction of the screen height, a
+	 * HalfLifeSeconds of 0 keeps heat forever, and SaturationWeight is the accumulated
+	 * weight that reaches roughly two thirds of the color ramp.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Heatmap", meta = (DisplayName = "Set Gaze Heatmap Params"))
+	void SetHeatmapParams(float Sigma = 0.03f, float HalfLifeSeconds = 10.0f, float SaturationWeight = 4.0f, float ConfidenceThreshold = 0.3f);
+
+	/** Changes the heatmap resolution; existing heat is discarded */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Heatmap", meta = (DisplayName = "Set Gaze Heatmap Resolution"))
+	void SetHeatmapResolution(int32 Width = 256, int32 Height = 144);
+
+	/** Adds every valid sample of a .beamrec file to the heatmap without decay; returns false if the file cannot be read */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Heatmap", meta = (DisplayName = "Add Recorded Session To Heatmap"))
+	bool AddRecordedSession(const FString& FilePath);
+
+private:
+	UPROPERTY()
+	UBeamEyeTrackerSubsystem* BeamSubsystem = nullptr;
+
+	/** Float accumulator and its colorized view, both UAV-capable */
+	UPROPERTY(Transient)
+	UTextureRenderTarget2D* AccumulationTarget = nullptr;
+
+	UPROPERTY(Transient)
+	UTextureRenderTarget2D* DisplayTarget = nullptr;
+
+	bool bHeatmapActive = false;
+
+	// Configuration
+	int32 HeatmapWidth = 256;
+	int32 HeatmapHeight = 144;
+	float KernelSigma = 0.03f;
+	float DecayHalfLifeSeconds = 10.0f;
+	float Saturation = 4.0f;
+	float MinConfidence = 0.3f;
+
+	/** Newest ring sample already splatted */
+	double LastSampleTimestampMs = 0.0;
+	TArray<FBeamFrame> Scratch;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	bool EnsureTargets();
+	void ReleaseTargets();
+	void HandleFrameRingReleased();
+	bool Tick(float DeltaTime);
+
+	/** Appends the splat for Frame when its gaze is usable */
+	void AddSplat(const FBeamFrame& Frame, TArray<FVector4f>& OutSplats) const;
+
+	/** Queues one render graph update: optional clear, decay, splats, colorize */
+	void EnqueueUpdate(TArray<FVector4f>&& Splats, float Decay, bool bClearFirst);
+};
+
+/*=============================================================================
+    End of BeamHeatmapSubsystem.h
+=============================================================================*/
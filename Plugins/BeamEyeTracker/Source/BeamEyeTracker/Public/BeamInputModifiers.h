@@ -0,0 +1,86 @@
+/*=============================================================================
+    BeamInputModifiers.h: Enhanced Input sources for Beam gaze.
+
+    A modifier that replaces its mapping's value with the current gaze and
+    a trigger that fires while gaze is tracked. Both read the subsystem's
+    frame ring directly when Enhanced Input evaluates the mapping, so there
+    is no per-tick axis name lookup or message handler round trip.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputModifiers.h"
+#include "InputTriggers.h"
+#include "BeamInputModifiers.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+struct FBeamFrame;
+
+/** Space the gaze modifier reports positions in */
+UENUM(BlueprintType)
+enum class EBeamGazeInputSpace : uint8
+{
+	Screen01 UMETA(DisplayName = "Screen 0..1", ToolTip = "0..1 from the top-left corner of the viewport"),
+	Centered UMETA(DisplayName = "Centered -1..1", ToolTip = "-1..1 from the viewport center, Y up like a stick"),
+	Velocity UMETA(DisplayName = "Velocity", ToolTip = "Gaze velocity in Screen01 units per second")
+};
+
+/**
+ * Replaces the mapped key's value with Beam gaze as an Axis2D.
+ *
+ * Map any key to the action (an unused gamepad axis works) and add this
+ * modifier; the key's own value is ignored. When gaze is not valid the last
+ * valid value is held, or zero if bHoldLastValid is off.
+ */
+UCLASS(NotBlueprintable, meta = (DisplayName = "Beam Gaze"))
+class BEAMEYETRACKER_API UInputModifierBeamGaze : public UInputModifier
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditInstanceOnly, BlueprintReadWrite, Category = "Settings", Config)
+	EBeamGazeInputSpace Space = EBeamGazeInputSpace::Centered;
+
+	/** Keep reporting the last valid gaze through blinks and dropouts */
+	UPROPERTY(EditInstanceOnly, BlueprintReadWrite, Category = "Settings", Config)
+	bool bHoldLastValid = true;
+
+protected:
+	virtual FInputActionValue ModifyRaw_Implementation(const UEnhancedPlayerInput* PlayerInput, FInputActionValue CurrentValue, float DeltaTime) override;
+
+private:
+	/** Resolved once per modifier instance; mappings are instanced per player */
+	TWeakObjectPtr<UBeamEyeTrackerSubsystem> CachedSubsystem;
+	FVector2D LastValue = FVector2D::ZeroVector;
+};
+
+/**
+ * Fires while Beam is tracking gaze with at least MinConfidence.
+ * Works on its own or alongside key triggers, e.g. "button held while looking".
+ */
+UCLASS(NotBlueprintable, meta = (DisplayName = "Beam Gaze Tracked"))
+class BEAMEYETRACKER_API UInputTriggerBeamGaze : public UInputTrigger
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Config, Category = "Trigger Settings", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MinConfidence = 0.5f;
+
+	virtual ETriggerType GetTriggerType_Implementation() const override { return ETriggerType::Implicit; }
+
+protected:
+	virtual ETriggerState UpdateState_Implementation(const UEnhancedPlayerInput* PlayerInput, FInputActionValue ModifiedValue, float DeltaTime) override;
+
+private:
+	TWeakObjectPtr<UBeamEyeTrackerSubsystem> CachedSubsystem;
+};
+
+/*=============================================================================
+    End of BeamInputModifiers.h
+=============================================================================*/
@@ -0,0 +1,127 @@
+/*=============================================================================
+    BeamLatency.h: End-to-end frame latency histograms.
+
+    Lock-free fixed-bucket histograms for each stage a gaze frame passes
+    through, from tracker delivery to the render thread, reported as
+    p50/p95/p99 to "stat Beam", Unreal Insights and the log.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include <atomic>
+
+/** Stages of a frame's path through the plugin */
+enum class EBeamLatencyStage : uint8
+{
+	/**
+	 * Capture to conversion above the fastest delivery seen. Capture times are mapped through the
+	 * clock sync's lower-envelope offset, which absorbs the minimum transport delay, so this is the
+	 * delivery jitter on top of that floor rather than an absolute capture latency.
+	 */
+	DeliveryJitter,
+
+	/** SDK conversion to ring publish, including filtering */
+	ConversionToPublish,
+
+	/** Ring publish to the first game-thread read */
+	PublishToConsume,
+
+	/** First game-thread read to the render thread picking the same frame up */
+	ConsumeToRender,
+
+	Num
+};
+
+/**
+ * Lock-free latency histogram with fixed log-spaced buckets.
+ *
+ * Buckets split every power of two of microseconds into four, so any
+ * reported percentile is within 25% above the true value; the range tops
+ * out around 16 seconds. Recording is one relaxed atomic increment.
+ */
+class BEAMEYETRACKER_API FBeamLatencyHistogram
+{
+public:
+	static constexpr int32 NumBuckets = 100;
+
+	FBeamLatencyHistogram();
+
+	void Record(double Seconds);
+
+	uint64 GetCount() const;
+
+	/** Upper edge, in milliseconds, of the bucket holding the Percentile (0-100); 0 when empty */
+	double GetPercentileMs(double Percentile) const;
+
+	void Reset();
+
+private:
+	std::atomic<uint32> Buckets[NumBuckets];
+
+	static int32 GetBucketIndex(uint64 Micros);
+	static uint64 GetBucketUpperMicros(int32 Index);
+};
+
+/** Percentiles of one stage */
+struct FBeamLatencySummary
+{
+	double P50Ms = 0.0;
+	double P95Ms = 0.0;
+	double P99Ms = 0.0;
+	uint64 Count = 0;
+};
+
+/**
+ * Latency instrumentation surface for every stage of the frame path.
+ *
+ * Frames carry the local time they were converted and published; each
+ * stage is recorded where the later of its two ends happens. Sampling is
+ * keyed by FrameId so every stage of a sampled frame is recorded, and is
+ * set by beam.Latency.SampleEvery (0 disables recording).
+ */
+class BEAMEYETRACKER_API FBeamLatencyMonitor
+{
+public:
+	/** True when stages of this frame should be recorded */
+	bool ShouldSample(int64 FrameId) const;
+
+	void Record(EBeamLatencyStage Stage, double Seconds);
+
+	/** Stamps the publish time just before a frame is published and records conversion to publish */
+	void StampPublish(FBeamFrame& Frame);
+
+	/** Game thread: records publish to consume the first time a frame is read */
+	void NoteConsumed(const FBeamFrame& Frame, double NowSeconds);
+
+	/** Render thread: records consume to render the first time the last consumed frame is rendered */
+	void NoteRendered(const FBeamFrame& Frame, double NowSeconds);
+
+	FBeamLatencySummary GetSummary(EBeamLatencyStage Stage) const;
+
+	void Reset();
+
+	/** Pushes the current percentiles to "stat Beam" and Insights counters */
+	void PublishStats() const;
+
+	static const TCHAR* GetStageName(EBeamLatencyStage Stage);
+
+private:
+	FBeamLatencyHistogram Histograms[static_cast<int32>(EBeamLatencyStage::Num)];
+
+	std::atomic<int64> LastConsumedFrameId{INDEX_NONE};
+	std::atomic<double> LastConsumedSeconds{0.0};
+	std::atomic<int64> LastRenderedFrameId{INDEX_NONE};
+};
+
+/** Process-wide latency monitor */
+extern BEAMEYETRACKER_API FBeamLatencyMonitor GBeamLatency;
+
+/*=============================================================================
+    End of BeamLatency.h
+=============================================================================*/
@@ -0,0 +1,82 @@
+/*=============================================================================
+    BeamMemoryBudget.h: Memory budget profiles for plugin-owned buffers.
+
+    Derives the size of every runtime-sized buffer - recording chunks and
+    in-memory tail, component history, analytics window and flight
+    recorder - from one byte budget, so a profile pins the plugin's
+    footprint on constrained hardware.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamMemoryBudget.generated.h"
+
+// Memory budget presets; Custom sizes each buffer from its own setting
+UENUM(BlueprintType)
+enum class EBeamMemoryProfile : uint8
+{
+	LowMemoryKiosk UMETA(DisplayName = "Low Memory Kiosk"),
+	Default UMETA(DisplayName = "Default"),
+	Research UMETA(DisplayName = "Research"),
+	Custom UMETA(DisplayName = "Custom (Per-Buffer Settings)")
+};
+
+/**
+ * Buffer sizes derived from one memory budget.
+ *
+ * The two subsystem frame rings have compile-time capacity and are
+ * charged first, at the bytes they really allocate; when the main ring's
+ * snapshot blocks and gaze columns would take more than half the budget,
+ * the ring is built without them. What remains is split between the
+ * runtime-sized buffers in fixed shares. Component history can only pick
+ * one of the two component ring instantiations, so its cap is either the
+ * 64-frame or the 1024-frame ring. A zero AnalyticsWindowSeconds or
+ * FlightRecorderSeconds leaves that consumer on its own default. Rings of
+ * trackers added through the registry are not planned for.
+ */
+struct BEAMEYETRACKER_API FBeamMemoryBudget
+{
+	EBeamMemoryProfile Profile = EBeamMemoryProfile::Custom;
+
+	/** Total budget; 0 for Custom, which has none */
+	int64 BudgetBytes = 0;
+
+	/** Storage of the main and raw subsystem rings as built with the options below, charged before the shares */
+	int64 FixedRingBytes = 0;
+
+	/** Main ring options; without snapshots TakeFrameSnapshot returns nothing, without columns VisitGazeColumnsInRange fails */
+	bool bFrameRingSnapshots = true;
+	bool bFrameRingGazeColumns = true;
+
+	int32 RecordingBlockSizeBytes = 64 * 1024;
+	int32 RecordingMaxPendingBlocks = 16;
+	int32 RecordingMaxInMemoryFrames = 4096;
+
+	/** Largest history a tracker component may keep; selects its ring instantiation */
+	int32 MaxComponentHistoryFrames = 1024;
+
+	float AnalyticsWindowSeconds = 0.0f;
+	float FlightRecorderSeconds = 0.0f;
+
+	bool IsBudgeted() const { return BudgetBytes > 0; }
+
+	/** Sum of the derived buffer sizes at their worst case, for comparison with BudgetBytes */
+	int64 GetPlannedBytes() const;
+
+	/** Budget of a preset; 0 for Custom */
+	static int64 GetProfileBudgetBytes(EBeamMemoryProfile Profile);
+
+	/** Splits BudgetBytes between the buffers */
+	static FBeamMemoryBudget FromBudget(EBeamMemoryProfile Profile, int64 BudgetBytes);
+
+	static const TCHAR* GetProfileName(EBeamMemoryProfile Profile);
+};
+
+/*=============================================================================
+    End of BeamMemoryBudget.h
+=============================================================================*/
@@ -0,0 +1,102 @@
+/*=============================================================================
+    BeamMonitorSnapshot.h: Fixed-rate tracker statistics for monitors.
+
+    The subsystem samples its status into one compact snapshot at a fixed
+    rate and keeps the most recent ones in a fixed ring, so monitors and
+    dashboards read a single struct instead of querying the tracker field
+    by field every frame, and can draw history without keeping their own.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+
+/** One sample of the tracker's status */
+struct FBeamMonitorSnapshot
+{
+	/** Increments with every published snapshot; 0 means none has been published */
+	uint32 Sequence = 0;
+
+	/** FPlatformTime seconds when the snapshot was taken */
+	double TimeSeconds = 0.0;
+
+	float TrackingFPS = 0.0f;
+
+	/** Capture to snapshot, on the estimated tracker clock; 0 when no frame is available */
+	float LatencyMs = 0.0f;
+
+	/** Frame ring fill, 0-100 */
+	float BufferUtilization = 0.0f;
+
+	/** Newest gaze in 0..1 viewport space, valid when bGazeValid */
+	FVector2f GazeScreen01 = FVector2f::ZeroVector;
+
+	/** Newest head position in centimeters, valid when bHeadValid */
+	FVector3f HeadPositionCm = FVector3f::ZeroVector;
+
+	EBeamHealth Health = EBeamHealth::AppNotRunning;
+
+	uint8 bTracking : 1 = false;
+	uint8 bHasFrame : 1 = false;
+	uint8 bGazeValid : 1 = false;
+	uint8 bHeadValid : 1 = false;
+	uint8 bCalibrated : 1 = false;
+	uint8 bRecording : 1 = false;
+	uint8 bPlayingBack : 1 = false;
+};
+
+/**
+ * Fixed ring of the most recent monitor snapshots.
+ *
+ * Written and read on the game thread only, so there is no locking; the
+ * storage is allocated once with the subsystem and never grows.
+ */
+class FBeamMonitorHistory
+{
+public:
+	/** Ten seconds at the subsystem's publish rate */
+	static constexpr int32 Capacity = 128;
+
+	void Push(const FBeamMonitorSnapshot& Snapshot)
+	{
+		Entries[Head] = Snapshot;
+		Head = (Head + 1) % Capacity;
+		Count = FMath::Min(Count + 1, Capacity);
+	}
+
+	int32 Num() const { return Count; }
+
+	/** Index 0 is the oldest held snapshot, Num() - 1 the newest */
+	const FBeamMonitorSnapshot& Get(int32 Index) const
+	{
+		check(Index >= 0 && Index < Count);
+		return Entries[(Head - Count + Index + Capacity) % Capacity];
+	}
+
+	/** Newest snapshot; Sequence is 0 before the first publish */
+	const FBeamMonitorSnapshot& GetLatest() const
+	{
+		static const FBeamMonitorSnapshot Empty;
+		return Count > 0 ? Get(Count - 1) : Empty;
+	}
+
+	void Reset()
+	{
+		Head = 0;
+		Count = 0;
+	}
+
+private:
+	FBeamMonitorSnapshot Entries[Capacity];
+	int32 Head = 0;
+	int32 Count = 0;
+};
+
+/*=============================================================================
+    End of BeamMonitorSnapshot.h
+=============================================================================*/
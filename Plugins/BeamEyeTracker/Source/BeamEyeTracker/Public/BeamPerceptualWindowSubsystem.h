@@ -0,0 +1,184 @@
+/*=============================================================================
+    BeamPerceptualWindowSubsystem.h: Schedules hitch-prone work into saccades and blinks.
+
+    Vision is suppressed for a few tens of milliseconds from the onset of
+    a saccade and for the length of a blink. This subsystem detects both
+    live from the frame ring, announces each as a perceptual window, and
+    runs queued game-thread work inside the windows so unavoidable hitches
+    land where the player cannot see them.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "BeamEyeTrackerTypes.h"
+#include "Containers/Ticker.h"
+#include "Templates/Function.h"
+#include "BeamPerceptualWindowSubsystem.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+
+UENUM(BlueprintType)
+enum class EBeamPerceptualWindowKind : uint8
+{
+	Saccade		UMETA(DisplayName = "Saccade"),
+	Blink		UMETA(DisplayName = "Blink")
+};
+
+// Mirrors FShaderPipelineCache::BatchMode, which the engine can set but not report
+UENUM(BlueprintType)
+enum class EBeamShaderBatchMode : uint8
+{
+	Background	UMETA(DisplayName = "Background"),
+	Fast		UMETA(DisplayName = "Fast"),
+	Precompile	UMETA(DisplayName = "Precompile")
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBeamPerceptualWindow, EBeamPerceptualWindowKind, Kind, float, ExpectedSeconds);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnBeamPerceptualWindowNative, EBeamPerceptualWindowKind /*Kind*/, float /*ExpectedSeconds*/);
+
+/**
+ * Perceptual window detector and hidden-work queue.
+ *
+ * The completed-event classifier reports a saccade only once it has
+ * landed, which is too late, so onsets are detected here from the step
+ * velocity between measured samples; blinks are the first frame whose
+ * gaze is missing or was synthesized by gap filling. A window is timed
+ * from the frame's publish time, so detection latency eats into it and
+ * windows with too little left are not opened. Queued work runs inside
+ * windows within a time budget; work that waited past its deadline runs
+ * anyway, so nothing starves when no tracker is connected.
+ */
+UCLASS(DisplayName = "Beam Perceptual Window Subsystem")
+class BEAMEYETRACKER_API UBeamPerceptualWindowSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Runs Work on the game thread inside the next saccade or blink window, or after MaxDelaySeconds
+	 * at the latest. Work that cannot tolerate a hitch of its own should stay small
+	 */
+	void RequestPerceptuallyHiddenWork(TFunction<void()> Work, float MaxDelaySeconds = 1.0f);
+
+	UFUNCTION(BlueprintPure, Category = "Beam|Perception", meta = (DisplayName = "Is Perceptual Window Open"))
+	bool IsPerceptualWindowOpen() const { return bWindowOpen; }
+
+	/** Seconds left in the open window; 0 when none is open */
+	UFUNCTION(BlueprintPure, Category = "Beam|Perception", meta = (DisplayName = "Get Perceptual Window Remaining"))
+	float GetWindowSecondsRemaining() const;
+
+	UFUNCTION(BlueprintPure, Category = "Beam|Perception", meta = (DisplayName = "Get Pending Hidden Work"))
+	int32 GetNumPendingWork() const { return PendingWork.Num(); }
+
+	/** Windows opened, work items run inside a window and work items forced by their deadline, since Initialize */
+	UFUNCTION(BlueprintPure, Category = "Beam|Perception", meta = (DisplayName = "Get Hidden Work Stats"))
+	void GetHiddenWorkStats(int32& OutWindowsOpened, int32& OutRunInWindow, int32& OutRunAtDeadline) const;
+
+	/**
+	 * Sets the shader pipeline cache batch mode and remembers it. The engine cannot report the mode,
+	 * so code that switches it (loading screens) should go through here: windows then leave a Fast or
+	 * Precompile mode alone, and put back the mode in effect at open when they close
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Perception")
+	void SetShaderBatchMode(EBeamShaderBatchMode Mode);
+
+	/** The batch mode outside windows, as last set through SetShaderBatchMode */
+	UFUNCTION(BlueprintPure, Category = "Beam|Perception")
+	EBeamShaderBatchMode GetShaderBatchMode() const { return ShaderBatchMode; }
+
+	/** Fired on the game thread when a window opens, with its expected remaining length */
+	UPROPERTY(BlueprintAssignable, Category = "Beam|Perception")
+	FOnBeamPerceptualWindow OnPerceptualWindow;
+
+	FOnBeamPerceptualWindowNative OnPerceptualWindowNative;
+
+	/** Gaze step speed, in Screen01 units per second, that marks a saccade onset */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Perception", meta = (ClampMin = "0.1"))
+	float SaccadeOnsetVelocity = 3.0f;
+
+	/** Suppression after a saccade onset; the window closes earlier when the saccade lands */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Perception", meta = (ClampMin = "0.0", ClampMax = "0.15", Units = "s"))
+	float SaccadeWindowSeconds = 0.04f;
+
+	/** Suppression after the eyes close; the window closes earlier when gaze returns */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Perception", meta = (ClampMin = "0.0", ClampMax = "0.3", Units = "s"))
+	float BlinkWindowSeconds = 0.1f;
+
+	/** Windows with less than this left once detected are not opened */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Perception", meta = (ClampMin = "0.0", Units = "s"))
+	float MinWindowSeconds = 0.008f;
+
+	/** Share of each window queued work may use; the rest absorbs the hitch of the last item */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Perception", meta = (ClampMin = "0.05", ClampMax = "1.0"))
+	float WorkBudgetFraction = 0.5f;
+
+	/** Spend part of every window on pending incremental garbage purging */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Perception")
+	bool bPurgeGarbageInWindows = true;
+
+	/** Switch the shader pipeline cache to fast precompilation while a window is open, unless it is already past Background */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam|Perception")
+	bool bFastShaderPrecompileInWindows = false;
+
+private:
+	struct FHiddenWork
+	{
+		TFunction<void()> Work;
+		double DeadlineSeconds = 0.0;
+	};
+
+	UPROPERTY()
+	TObjectPtr<UBeamEyeTrackerSubsystem> BeamSubsystem;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	TArray<FHiddenWork> PendingWork;
+
+	// Open window
+	bool bWindowOpen = false;
+	EBeamPerceptualWindowKind WindowKind = EBeamPerceptualWindowKind::Saccade;
+	double WindowEndSeconds = 0.0;
+
+	/** Absolute end of the window's work budget, fixed when the window opens */
+	double WorkBudgetEndSeconds = 0.0;
+
+	// Shader pipeline cache batch mode
+	EBeamShaderBatchMode ShaderBatchMode = EBeamShaderBatchMode::Background;
+	EBeamShaderBatchMode ShaderBatchModeAtOpen = EBeamShaderBatchMode::Background;
+	bool bWindowChangedBatchMode = false;
+
+	// Detector state, carried across ticks
+	double LastTimestampMs = 0.0;
+	bool bHasTimestamp = false;
+	bool bPrevUsable = false;
+	FVector2D PrevGaze = FVector2D::ZeroVector;
+	double PrevSDKTimestampMs = 0.0;
+	bool bInSaccade = false;
+	TArray<FBeamFrame> Scratch;
+
+	// Counters
+	int32 WindowsOpened = 0;
+	int32 RunInWindow = 0;
+	int32 RunAtDeadline = 0;
+
+	bool Tick(float DeltaTime);
+	void DetectWindows();
+	void OpenWindow(EBeamPerceptualWindowKind Kind, double EndSeconds);
+	void CloseWindow();
+	static void ApplyShaderBatchMode(EBeamShaderBatchMode Mode);
+	void RunWindowWork();
+	void RunOverdueWork();
+};
+
+/*=============================================================================
+    End of BeamPerceptualWindowSubsystem.h
+=============================================================================*/
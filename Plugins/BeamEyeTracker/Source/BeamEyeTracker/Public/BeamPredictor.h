@@ -0,0 +1,137 @@
+/*=============================================================================
+    BeamPredictor.h: Latency-compensating gaze and head pose prediction.
+
+    Extrapolates the newest tracking sample forward to the time it will
+    actually be displayed, so foveation and gaze aim line up with where
+    the eye is at photon time rather than where it was at capture time.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamPredictor.generated.h"
+
+// Motion models for gaze prediction
+UENUM(BlueprintType)
+enum class EBeamPredictionModel : uint8
+{
+	None UMETA(DisplayName = "No Prediction"),
+	ConstantVelocity UMETA(DisplayName = "Constant Velocity"),
+	Kalman UMETA(DisplayName = "Kalman (Constant Velocity)")
+};
+
+// Gaze predictor parameters
+USTRUCT(BlueprintType)
+struct BEAMEYETRACKER_API FBeamPredictorParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction")
+	EBeamPredictionModel Model = EBeamPredictionModel::ConstantVelocity;
+
+	/** Hard limit on how far ahead any sample is extrapolated (milliseconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0", ClampMax = "200.0"))
+	float MaxHorizonMs = 50.0f;
+
+	/** Gaze speed above which the eye is treated as mid-saccade (screen widths per second) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.1", ClampMax = "50.0"))
+	float SaccadeVelocityThreshold = 3.0f;
+
+	/** Horizon limit during a saccade; saccades are ballistic and long extrapolation overshoots the landing point */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0", ClampMax = "50.0"))
+	float SaccadeMaxHorizonMs = 8.0f;
+
+	/** Gaze speed below which the eye is treated as fixating and no extrapolation is applied */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float FixationVelocityThreshold = 0.05f;
+
+	/** Kalman white-acceleration noise density (screen units^2 / s^3) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0"))
+	float ProcessNoise = 100.0f;
+
+	/** Kalman measurement noise variance (screen units^2) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0"))
+	float MeasurementNoise = 0.00003f;
+
+	/** Default constructor */
+	FBeamPredictorParams() = default;
+};
+
+/**
+ * Gaze and head pose predictor.
+ *
+ * Samples are fed in publish order; prediction extrapolates the newest
+ * one by a horizon using the configured motion model, with the horizon
+ * shortened during saccades and suppressed during fixations. Not thread
+ * safe: each consumer thread owns its own instance.
+ */
+class BEAMEYETRACKER_API FBeamGazePredictor
+{
+public:
+	FBeamGazePredictor(const FBeamPredictorParams& InParams = FBeamPredictorParams{});
+
+	/** Feeds one sample; samples at or before the newest FrameId are ignored */
+	void AddSample(const FBeamFrame& Frame);
+
+	/** Extrapolates the newest sample HorizonMs into the future */
+	bool Predict(double HorizonMs, FBeamFrame& OutFrame) const;
+
+	/** Applies the current gaze velocity estimate to an arbitrary sample */
+	FGazePoint PredictGaze(const FGazePoint& Sample, double HorizonMs) const;
+
+	/** Current gaze velocity estimate in Screen01 units per second; the frame's own filter velocity when it carries one */
+	FVector2D GetGazeVelocity() const;
+
+	/** True while the gaze speed is above the saccade threshold */
+	bool IsInSaccade() const;
+
+	/** FrameId of the newest sample fed so far (INDEX_NONE if none) */
+	int64 GetLastFrameId() const { return bHasLast ? LastFrame.FrameId : INDEX_NONE; }
+
+	/** Resets the predictor state to initial values */
+	void Reset();
+
+	/** Updates predictor parameters at runtime */
+	void UpdateParams(const FBeamPredictorParams& NewParams);
+
+	/**
+	 * Milliseconds from a sample's capture to when the frame being built now reaches the display:
+	 * sample age plus RenderLatencyFrames game frames of render and present queueing.
+	 */
+	static double GetDisplayHorizonMs(double SampleUETimestampSeconds, float RenderLatencyFrames);
+
+private:
+	/** Two-state (position, velocity) Kalman filter for one screen axis */
+	struct FKalmanAxis
+	{
+		double Position = 0.0;
+		double Velocity = 0.0;
+		double P00 = 1.0;
+		double P01 = 0.0;
+		double P11 = 1.0;
+
+		void Init(double Measurement);
+		void Update(double Measurement, double DeltaSeconds, double ProcessNoise, double MeasurementNoise);
+	};
+
+	FBeamPredictorParams Params;
+	FBeamFrame LastFrame;
+	FBeamFrame PreviousFrame;
+	bool bHasLast;
+	bool bHasPrevious;
+
+	FKalmanAxis GazeAxes[2];
+	FVector2D ConstantGazeVelocity;
+
+	/** Clamps the requested horizon by the saccade/fixation state of the current velocity estimate */
+	double GetEffectiveHorizonMs(double HorizonMs) const;
+};
+
+/*=============================================================================
+    End of BeamPredictor.h
+=============================================================================*/
@@ -0,0 +1,140 @@
+/*=============================================================================
+    BeamRecordingTimeline.h: Random-access view of a .beamrec recording.
+
+    Opens a recording in place through the memory-mapped reader and its
+    chunk index, so frames at any time are a binary search away and only
+    the chunks that are looked at get paged in. A min/max summary pyramid
+    is built on a worker thread so a timeline of any length can be drawn
+    one bucket per pixel column without touching the frames again.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "Async/Future.h"
+#include <atomic>
+
+class FBeamRecording;
+
+/** Gaze extent over a span of frames */
+struct FBeamTimelineBucket
+{
+	FVector2f GazeMin = FVector2f(MAX_flt, MAX_flt);
+	FVector2f GazeMax = FVector2f(-MAX_flt, -MAX_flt);
+	float ConfidenceMin = MAX_flt;
+	float ConfidenceMax = -MAX_flt;
+	uint32 NumFrames = 0;
+	uint32 NumValidFrames = 0;
+
+	bool HasGaze() const { return NumValidFrames > 0; }
+
+	void Add(const FBeamFrame& Frame)
+	{
+		++NumFrames;
+		if (Frame.Gaze.bValid)
+		{
+			const FVector2f Gaze(Frame.Gaze.Screen01);
+			GazeMin = FVector2f::Min(GazeMin, Gaze);
+			GazeMax = FVector2f::Max(GazeMax, Gaze);
+			ConfidenceMin = FMath::Min(ConfidenceMin, Frame.Gaze.Confidence);
+			ConfidenceMax = FMath::Max(ConfidenceMax, Frame.Gaze.Confidence);
+			++NumValidFrames;
+		}
+	}
+
+	void Merge(const FBeamTimelineBucket& Other)
+	{
+		NumFrames += Other.NumFrames;
+		if (Other.HasGaze())
+		{
+			GazeMin = FVector2f::Min(GazeMin, Other.GazeMin);
+			GazeMax = FVector2f::Max(GazeMax, Other.GazeMax);
+			ConfidenceMin = FMath::Min(ConfidenceMin, Other.ConfidenceMin);
+			ConfidenceMax = FMath::Max(ConfidenceMax, Other.ConfidenceMax);
+			NumValidFrames += Other.NumValidFrames;
+		}
+	}
+};
+
+/**
+ * Scrubbable recording.
+ *
+ * Queries run on the thread that opened the timeline. The summary worker
+ * reads through its own mapping of the file, so building the pyramid
+ * never contends with scrubbing; until it finishes, wide ranges are not
+ * summarized and narrow ones are read straight from the frames.
+ */
+class BEAMEYETRACKER_API FBeamRecordingTimeline
+{
+public:
+	/** Frames per bucket at the finest summary level; each coarser level doubles it */
+	static constexpr int32 FramesPerBaseBucket = 32;
+
+	FBeamRecordingTimeline();
+	~FBeamRecordingTimeline();
+
+	/** Opens FilePath and starts building its summary; false if it is not a readable recording */
+	bool Open(const FString& FilePath);
+
+	/** Cancels the summary build and releases the file */
+	void Close();
+
+	bool IsOpen() const;
+
+	/** False for v1 files, which have no chunk index and are read into memory */
+	bool IsMemoryMapped() const;
+
+	const FString& GetFilePath() const { return FilePath; }
+	int32 GetFrameCount() const { return FrameCount; }
+	double GetStartTimeMs() const { return StartTimeMs; }
+	double GetEndTimeMs() const { return EndTimeMs; }
+
+	/** Frame closest to TimestampMs */
+	bool GetFrameAtTime(double TimestampMs, FBeamFrame& OutFrame) const;
+
+	/** Frames in [StartMs, EndMs], thinned evenly to at most MaxFrames; returns the number written */
+	int32 GetFramesInRange(double StartMs, double EndMs, int32 MaxFrames, TArray<FBeamFrame>& OutFrames) const;
+
+	/** True once the summary pyramid covers the whole file */
+	bool IsSummaryReady() const { return bSummaryReady.load(std::memory_order_acquire); }
+
+	/** Fraction of the file the summary worker has read, 0-1 */
+	float GetSummaryProgress() const;
+
+	/**
+	 * Splits [StartMs, EndMs) into NumColumns equal spans and reports the gaze extent of each. Columns
+	 * holding few frames are read exactly; wider ones merge the coarsest summary buckets that fit, so the
+	 * cost is independent of recording length. False when nothing can be reported yet.
+	 */
+	bool GetSummary(double StartMs, double EndMs, int32 NumColumns, TArray<FBeamTimelineBucket>& OutColumns) const;
+
+private:
+	TUniquePtr<FBeamRecording> Reader;
+	FString FilePath;
+	int32 FrameCount = 0;
+	double StartTimeMs = 0.0;
+	double EndTimeMs = 0.0;
+
+	/** Level L holds buckets of FramesPerBaseBucket << L frames; only read once bSummaryReady is set */
+	TArray<TArray<FBeamTimelineBucket>> SummaryLevels;
+
+	TFuture<void> SummaryTask;
+	std::atomic<bool> bSummaryReady{false};
+	std::atomic<bool> bCancelSummary{false};
+	std::atomic<int32> SummaryFramesRead{0};
+
+	/** Worker body: reads every frame once into the base level, then halves it into coarser levels */
+	void BuildSummary();
+
+	/** Adds frames [FirstFrame, EndFrame) straight from the file */
+	void AccumulateFrames(int32 FirstFrame, int32 EndFrame, FBeamTimelineBucket& Bucket) const;
+};
+
+/*=============================================================================
+    End of BeamRecordingTimeline.h
+=============================================================================*/
@@ -0,0 +1,102 @@
+/*=============================================================================
+    BeamReplayDriver.h: Deterministic offline replay of .beamrec sessions.
+
+    Pushes a whole recording through the runtime filter, prediction and
+    analytics stages as fast as the CPU allows, on a virtual clock taken
+    from the recorded timestamps, and summarizes the run in a digest that
+    CI can compare between builds.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamFilters.h"
+#include "BeamPredictor.h"
+#include "Templates/Function.h"
+
+class UBeamEyeTrackerSettings;
+
+/** Pipeline configuration for an offline replay */
+struct BEAMEYETRACKER_API FBeamReplayConfig
+{
+	EBeamFilterType FilterType = EBeamFilterType::OneEuro;
+	FOneEuroFilterParams OneEuroParams;
+	FEmaFilterParams EmaParams;
+	FBeamGapFillParams GapFillParams;
+
+	/** Prediction stage; skipped when PredictionHorizonMs is zero */
+	FBeamPredictorParams PredictorParams;
+	float PredictionHorizonMs = 0.0f;
+
+	/** Analytics stage, mirroring UBeamAnalyticsSubsystem's sampling */
+	float AnalyticsSamplingRate = 60.0f;
+	float AnalyticsMinConfidence = 0.5f;
+	float MinFixationDuration = 0.1f;
+
+	/** Trailing analytics window in seconds; zero analyzes the whole session */
+	double AnalyticsWindowSeconds = 0.0;
+
+	/** The configuration the live subsystem runs with */
+	static FBeamReplayConfig FromSettings(const UBeamEyeTrackerSettings& Settings);
+};
+
+/** Results of one replay; everything except WallTimeSeconds is deterministic for a given recording and config */
+struct BEAMEYETRACKER_API FBeamReplayDigest
+{
+	FString RecordingPath;
+	int32 FrameCount = 0;
+	int32 ValidGazeFrames = 0;
+	int32 AnalyticsSamples = 0;
+
+	/** Recording time covered, on the virtual clock */
+	double DurationSeconds = 0.0;
+
+	/** Real time the replay took */
+	double WallTimeSeconds = 0.0;
+
+	FGazeAnalytics Analytics;
+
+	/** CRC32 over the pipeline output (filtered and predicted gaze and head pose, quantized) */
+	uint32 OutputChecksum = 0;
+
+	/** Single-line human readable summary */
+	FString ToString() const;
+
+	/** JSON object for CI result collection */
+	FString ToJson() const;
+};
+
+/**
+ * Offline replay driver.
+ *
+ * Owns its own pipeline state, so replays neither need a world or game
+ * instance nor disturb a running subsystem. Extra per-frame consumers
+ * (interaction logic under test) are plugged in as stages and see every
+ * frame at its virtual time.
+ */
+class BEAMEYETRACKER_API FBeamReplayDriver
+{
+public:
+	using FFrameStage = TFunction<void(const FBeamFrame& Frame, double VirtualTimeSeconds)>;
+
+	explicit FBeamReplayDriver(const FBeamReplayConfig& InConfig);
+
+	/** Adds a consumer run after filtering and prediction, in registration order */
+	void AddStage(FFrameStage Stage);
+
+	/** Replays an entire recording; false if it could not be opened or held no frames */
+	bool Run(const FString& RecordingPath, FBeamReplayDigest& OutDigest);
+
+private:
+	FBeamReplayConfig Config;
+	TArray<FFrameStage> Stages;
+};
+
+/*=============================================================================
+    End of BeamReplayDriver.h
+=============================================================================*/
@@ -0,0 +1,133 @@
+/*=============================================================================
+    BeamResources.h: Measured CPU, memory and GPU cost of the plugin.
+
+    Samples the CPU time of the plugin's own threads, the memory allocated
+    under the BeamEyeTracker LLM tag and the GPU time of Beam render passes
+    on a low-rate background timer.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+class FRHICommandListImmediate;
+
+/** CPU time of one registered thread over the last sampling interval */
+struct FBeamThreadUsage
+{
+	FString Name;
+
+	/** Percent of one core */
+	float CPUPercent = 0.0f;
+
+	/** CPU time since the thread registered */
+	double CPUSeconds = 0.0;
+};
+
+/** One reading of the sampler */
+struct FBeamResourceUsage
+{
+	bool bValid = false;
+
+	/** Sum over registered threads, in percent of one core; per-thread CPU time is unavailable on some platforms */
+	float CPUPercent = 0.0f;
+	bool bCPUMeasured = false;
+	TArray<FBeamThreadUsage> Threads;
+
+	/** Bytes allocated under the BeamEyeTracker LLM tag when LLM is running, else the plugin's ring and recording buffers */
+	int64 MemoryBytes = 0;
+	bool bMemoryFromLLM = false;
+
+	/** GPU time of Beam render passes, in milliseconds per second and percent of wall time */
+	double GPUMsPerSecond = 0.0;
+	float GPUPercent = 0.0f;
+
+	double SampleSeconds = 0.0;
+};
+
+/**
+ * Process-wide resource sampler.
+ *
+ * Plugin threads register themselves from inside their run loop so their
+ * CPU time can be read without any cooperation afterwards. Sampling runs
+ * on a pool task every beam.Resources.SampleInterval seconds while at
+ * least one owner has started the sampler; readers get the last finished
+ * sample and never block on a running one.
+ */
+class BEAMEYETRACKER_API FBeamResourceSampler
+{
+public:
+	/** Registers the calling thread under Name; call from the thread itself */
+	void RegisterCurrentThread(const TCHAR* Name);
+
+	/** Unregisters the calling thread; call before the thread exits */
+	void UnregisterCurrentThread();
+
+	/** Game thread: starts sampling for one more owner */
+	void Start();
+
+	/** Game thread: releases one owner, waiting for a sample still in flight when the last one goes */
+	void Stop();
+
+	/** Last finished sample */
+	FBeamResourceUsage GetLatest() const;
+
+	/** Adjusts the buffer-memory fallback used when LLM is not running */
+	void TrackBufferBytes(int64 DeltaBytes) { BufferBytes.fetch_add(DeltaBytes, std::memory_order_relaxed); }
+
+	/** Render thread: brackets a Beam render pass with GPU timestamps; unmatched or untimed passes are skipped */
+	void BeginGPUPass(FRHICommandListImmediate& RHICmdList);
+	void EndGPUPass(FRHICommandListImmediate& RHICmdList);
+
+private:
+	struct FThreadEntry
+	{
+		FString Name;
+		uint32 ThreadId = 0;
+
+		/** Thread handle on Windows, CPU clock id on Linux */
+		uint64 PlatformHandle = 0;
+
+		double RegisteredCPUSeconds = 0.0;
+		double LastCPUSeconds = 0.0;
+	};
+
+	mutable FCriticalSection Lock;
+	TArray<FThreadEntry> Threads;
+	FBeamResourceUsage Latest;
+	double LastSampleSeconds = 0.0;
+	uint64 LastGPUMicros = 0;
+
+	std::atomic<int64> BufferBytes{0};
+	std::atomic<uint64> GPUMicros{0};
+
+	int32 StartCount = 0;
+	FTSTicker::FDelegateHandle TickerHandle;
+	TFuture<void> PendingSample;
+
+	bool Tick(float DeltaTime);
+
+	/** Takes one sample; runs on a pool thread */
+	void Sample();
+
+	/** Adds GPU time resolved from finished timestamp queries */
+	void AddGPUMicros(uint64 Micros) { GPUMicros.fetch_add(Micros, std::memory_order_relaxed); }
+
+	static bool OpenCurrentThread(uint64& OutHandle);
+	static void CloseThread(uint64 Handle);
+	static bool ReadThreadCPUSeconds(uint64 Handle, double& OutSeconds);
+};
+
+/** Process-wide resource sampler */
+extern BEAMEYETRACKER_API FBeamResourceSampler GBeamResources;
+
+/*=============================================================================
+    End of BeamResources.h
+=============================================================================*/
@@ -0,0 +1,354 @@
+/*=============================================================================
+    BeamRing.h: High-performance SPSC ring buffer for Beam SDK.
+
+    Provides a lock-free single-producer ring buffer with wait-free
+    publishes and seqlock-protected slot reads for any number of
+    non-consuming readers, plus interpolation and performance statistics.
+
+    Consumers that need every frame register a cursor and drain from it.
+    The producer never waits on a cursor: a consumer that falls a full lap
+    behind skips to the oldest frame still held and the skipped frames are
+    counted against it, so one stalled consumer cannot slow the others.
+
+    Capacity is a compile-time power of two so the slot mask and bounds
+    fold into constants. Timestamp indexing and interpolation are policies,
+    and only instantiations that serve a snapshot consumer carry the
+    double-buffered capture path; the supported instantiations are declared
+    at the end of this file and compiled once in BeamRing.cpp.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamFrameCompact.h"
+#include "BeamGazeColumns.h"
+#include "HAL/Platform.h"
+#include "HAL/PlatformAtomics.h"
+#include "Containers/ArrayView.h"
+#include "Templates/Function.h"
+#include <atomic>
+
+// Performance optimization flags
+#define BEAM_RING_USE_SIMD 1
+#define BEAM_RING_USE_ADVANCED_INTERPOLATION 1
+#define BEAM_RING_USE_CACHE_ALIGNMENT 1
+#define BEAM_RING_USE_GAZE_COLUMNS 1
+
+// Cache line size for x86 architectures (64 bytes)
+#define BEAM_CACHE_LINE_SIZE 64
+
+// Optimistic read attempts before a reader gives up on a slot being rewritten
+#define BEAM_RING_MAX_READ_RETRIES 8
+
+// Fan-out cursors per ring
+#define BEAM_RING_MAX_CONSUMERS 16
+
+
+/** Timestamp policy: no time index, so timestamp queries always miss */
+struct FBeamRingNoTimestamps
+{
+	static constexpr bool bEnabled = false;
+
+	template<typename T>
+	static double GetTimestampMs(const T&) { return 0.0; }
+};
+
+/** Timestamp policy: frames are indexed (and must be published in order) by SDKTimestampMs */
+struct FBeamRingFrameTimestamps
+{
+	static constexpr bool bEnabled = true;
+
+	static double GetTimestampMs(const FBeamFrame& Frame) { return Frame.SDKTimestampMs; }
+};
+
+/** Timestamp policy for quantized frames; the timestamp is kept at full precision */
+struct FBeamRingCompactTimestamps
+{
+	static constexpr bool bEnabled = true;
+
+	static double GetTimestampMs(const FBeamFrameCompact& Frame) { return Frame.SDKTimestampMs; }
+};
+
+/** Interpolation policy: interpolated queries fall back to the nearest stored element */
+struct FBeamRingNoInterpolation
+{
+	static constexpr bool bEnabled = false;
+
+	template<typename T>
+	static void Interpolate(const T& A, const T&, double, T& Out) { Out = A; }
+};
+
+/** Interpolation policy: confidence-aware blend of gaze, head pose and timestamps */
+struct FBeamRingFrameInterpolation
+{
+	static constexpr bool bEnabled = true;
+
+	static void Interpolate(const FBeamFrame& Frame1, const FBeamFrame& Frame2, double Alpha, FBeamFrame& OutInterpolatedFrame);
+};
+
+/** Capture block filled by the producer between two snapshots; owned by exactly one side at a time */
+template<typename T>
+struct TBeamRingCaptureBlock
+{
+	TArray<T> Frames;
+	uint64 Count = 0;
+};
+
+/** Both capture blocks and the producer's hazard pointer; allocated only for rings built with snapshots */
+template<typename T>
+struct TBeamRingCapture
+{
+	TBeamRingCaptureBlock<T> Blocks[2];
+
+	// Producer appends into Active; the snapshot consumer owns the other block
+	alignas(BEAM_CACHE_LINE_SIZE) std::atomic<TBeamRingCaptureBlock<T>*> Active{ nullptr };
+
+	// Block the producer is currently writing (hazard pointer), so a snapshot knows when the retired block is quiescent
+	alignas(BEAM_CACHE_LINE_SIZE) std::atomic<TBeamRingCaptureBlock<T>*> Producer{ nullptr };
+};
+
+/** Lag and loss of one registered consumer */
+struct FBeamRingConsumerStats
+{
+	int32 ConsumerId = INDEX_NONE;
+	FName Name;
+
+	/** Frames published but not consumed yet */
+	uint64 LagFrames = 0;
+
+	/** Frames overwritten before the consumer reached them */
+	uint64 DroppedFrames = 0;
+
+	/** Drains that found the cursor lapped by the producer */
+	uint32 LapCount = 0;
+
+	/** Lag is past three quarters of the ring, so the next stall will drop frames */
+	bool bSlow = false;
+};
+
+/** Read position of one consumer; written only by that consumer, read by anyone for stats */
+struct alignas(BEAM_CACHE_LINE_SIZE) FBeamRingConsumerCursor
+{
+	enum : uint8 { Free, Claiming, Active };
+
+	std::atomic<uint8> State{ Free };
+
+	/** Bumped on every registration so stats readers can detect a cursor that was reused under them */
+	std::atomic<uint32> Generation{ 0 };
+	std::atomic<uint64> NextIndex{ 0 };
+	std::atomic<uint64> DroppedFrames{ 0 };
+	std::atomic<uint32> LapCount{ 0 };
+
+	/** Ring clear count the cursor last read under; a change means the stream restarted from index 0 */
+	std::atomic<uint32> ClearCount{ 0 };
+
+	/** Set while claiming, before State turns Active */
+	FName Name;
+};
+
+#if BEAM_RING_USE_GAZE_COLUMNS
+/** Structure-of-arrays companion to the frame slots; column element N mirrors slot N and shares its sequence */
+struct FBeamRingColumnStore
+{
+	TArray<float> GazeX;
+	TArray<float> GazeY;
+	TArray<float> GazeConfidence;
+	TArray<double> TimestampMs;
+	TArray<float> HeadPositionX;
+	TArray<float> HeadPositionY;
+	TArray<float> HeadPositionZ;
+	TArray<float> HeadPitch;
+	TArray<float> HeadYaw;
+	TArray<float> HeadRoll;
+	TArray<float> HeadConfidence;
+
+	void Allocate(int32 NumSlots);
+	void Write(int32 SlotIndex, const FBeamFrame& Frame);
+	FBeamGazeColumns MakeView(int32 Start, int32 Num) const;
+	SIZE_T GetAllocatedSize() const;
+
+	/** Upper bound of GetAllocatedSize after Allocate(NumSlots), allocator rounding included */
+	static SIZE_T GetAllocatedSizeFor(int32 NumSlots);
+};
+#endif
+
+/**
+ * High-performance, lock-free SPSC ring buffer with a compile-time power-of-two capacity.
+ * bDoubleBuffered compiles in the TakeSnapshot capture path; without it Publish never copies a frame twice.
+ */
+template<typename T, int32 Capacity, typename TimestampPolicy = FBeamRingNoTimestamps, typename InterpolationPolicy = FBeamRingNoInterpolation, bool bDoubleBuffered = false>
+class TBeamRing
+{
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "TBeamRing capacity must be a power of two");
+	static_assert(TimestampPolicy::bEnabled || !InterpolationPolicy::bEnabled, "TBeamRing interpolation requires a timestamp policy");
+
+public:
+	static constexpr int32 BufferSize = Capacity;
+	static constexpr uint32 BufferMask = static_cast<uint32>(Capacity - 1);
+
+	/**
+	 * Gaze columns are only available for FBeamFrame rings, and snapshot capture blocks only for double-buffered
+	 * instantiations; both are allocated up front when requested, so a ring that never serves them pays nothing
+	 */
+	explicit TBeamRing(bool bInWithGazeColumns = false, bool bInWithSnapshots = false);
+	~TBeamRing();
+
+	// Core ring buffer operations (Publish is single-producer; readers never consume)
+	bool Publish(const T& Frame);
+	bool ReadLatest(T& OutFrame) const;
+	bool GetFrameAt(double TimestampMs, T& OutFrame) const;
+	bool GetInterpolatedFrameAt(double TimestampMs, T& OutFrame) const;
+	bool GetLatestInterpolatedFrame(double DeltaSeconds, T& OutFrame) const;
+
+	// Range queries: frames with timestamps in [T0Ms, T1Ms], oldest first, copied in at most two memcpy segments
+	int32 CopyFramesInRange(double T0Ms, double T1Ms, TArray<T>& OutFrames) const;
+	int32 CopyLatestFrames(int32 Count, TArray<T>& OutFrames) const;
+
+	/**
+	 * Zero-copy range access: calls Visitor with up to two contiguous spans straight out of ring storage.
+	 * Returns false if the producer lapped the window while it was being visited, in which case the spans must be discarded.
+	 */
+	bool VisitFramesInRange(double T0Ms, double T1Ms, TFunctionRef<void(TArrayView<const T>)> Visitor) const;
+
+	/**
+	 * Column access for gaze-only consumers: same window and validation rules as VisitFramesInRange,
+	 * but each span is handed over as separate contiguous float columns. Returns false if the columns are disabled.
+	 */
+	bool VisitGazeColumnsInRange(double T0Ms, double T1Ms, TFunctionRef<void(const FBeamGazeColumns&)> Visitor) const;
+	bool HasGazeColumns() const;
+
+	// Buffer management (Clear must not race a running producer)
+	void Clear();
+	int32 GetNum() const;
+	int32 GetBufferUtilization() const;
+	static constexpr int32 GetMaxSize() { return Capacity; }
+
+	/**
+	 * Double-buffer batch access: flips the producer onto the spare capture block with one atomic exchange
+	 * and copies out everything published since the previous snapshot (newest Capacity frames, oldest first).
+	 * Single snapshot consumer only; the producer never waits on it. Returns the number of frames copied,
+	 * always 0 for a ring built without snapshots.
+	 */
+	int32 TakeSnapshot(TArray<T>& OutFrames);
+	bool HasSnapshots() const { return Capture.IsValid(); }
+
+	/**
+	 * Fan-out access: registers a cursor that starts BacklogFrames behind the newest frame (0 = only new frames).
+	 * Cursors are reader-side state, so a const ring accepts them. Returns INDEX_NONE when every cursor is taken.
+	 */
+	int32 RegisterConsumer(FName Name, int32 BacklogFrames = 0) const;
+	void UnregisterConsumer(int32 ConsumerId) const;
+
+	/**
+	 * Copies up to MaxFrames frames after the consumer's cursor, oldest first, and advances it. Only the owning
+	 * consumer may call this. Frames the producer overwrote first are skipped and counted as dropped.
+	 */
+	int32 ConsumeFrames(int32 ConsumerId, TArray<T>& OutFrames, int32 MaxFrames = Capacity) const;
+
+	/** Stats for one consumer, or every registered one; safe from any thread */
+	bool GetConsumerStats(int32 ConsumerId, FBeamRingConsumerStats& OutStats) const;
+	int32 GetAllConsumerStats(TArray<FBeamRingConsumerStats>& OutStats) const;
+
+	/** Incremented by Clear, so consumers can tell a restarted stream from a continued one */
+	uint32 GetClearCount() const { return ClearCount.load(std::memory_order_acquire); }
+
+	/** Frames the producer wrote over since construction, read or not; cumulative across Clear */
+	uint64 GetOverwrittenFrames() const;
+
+	/** Frames lost by every consumer ever registered, including released cursors; cumulative across Clear */
+	uint64 GetConsumerDroppedFrames() const { return ConsumerDroppedFrames.load(std::memory_order_relaxed); }
+
+	/** Heap bytes held by slots, columns and capture blocks; fixed after construction */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Upper bound of GetAllocatedSize for a ring constructed with these options, for budgeting before it exists */
+	static SIZE_T GetAllocatedSizeFor(bool bWithGazeColumns, bool bWithSnapshots);
+
+	// Performance optimization features
+	void SetAdvancedInterpolation(bool bEnable);
+	void GetPerformanceStats(int32& OutFrameCount, double& OutAverageLatency, double& OutPeakLatency) const;
+
+private:
+	// Cache-aligned counters to prevent false sharing; WriteIndex counts every publish and is never masked
+	alignas(BEAM_CACHE_LINE_SIZE) std::atomic<uint64> WriteIndex;
+	alignas(BEAM_CACHE_LINE_SIZE) std::atomic<uint32> PublishCount;
+
+	// Performance tracking (aligned to prevent false sharing)
+	alignas(BEAM_CACHE_LINE_SIZE) std::atomic<double> TotalLatency;
+	alignas(BEAM_CACHE_LINE_SIZE) std::atomic<double> PeakLatency;
+	alignas(BEAM_CACHE_LINE_SIZE) std::atomic<int32> LatencySampleCount;
+
+	// Seqlock-protected frame storage; frames stay contiguous so range reads are plain memcpy segments.
+	// Each sequence is odd while the producer writes its slot and 2 * (index + 1) once published.
+	TUniquePtr<std::atomic<uint64>[]> SlotSequences;
+	TArray<T> SlotFrames;
+
+	// Advanced features
+	bool bUseAdvancedInterpolation;
+
+	// Fan-out cursors; each one sits on its own cache line so consumers never share a line with each other
+	mutable FBeamRingConsumerCursor Consumers[BEAM_RING_MAX_CONSUMERS];
+	std::atomic<uint32> ClearCount{ 0 };
+
+	// Drop accounting that outlives cursors and Clear; the overwrite count is folded in by Clear
+	mutable std::atomic<uint64> ConsumerDroppedFrames{ 0 };
+	std::atomic<uint64> OverwrittenBeforeClear{ 0 };
+
+#if BEAM_RING_USE_GAZE_COLUMNS
+	// Optional SoA mirror of the slots, written under the same slot sequence as the frame itself
+	TUniquePtr<FBeamRingColumnStore> Columns;
+#endif
+
+	// Snapshot capture state; null unless the instantiation is double-buffered and the ring was built with snapshots
+	TUniquePtr<TBeamRingCapture<T>> Capture;
+
+	/** Producer side of the capture path */
+	void AppendToCapture(const T& Frame);
+
+	/** Copies the frame published at Index; fails if the slot is mid-write or was lapped by the producer */
+	bool ReadSlot(uint64 Index, T& OutFrame) const;
+
+	/** Reads only the timestamp of the frame published at Index under the same sequence check */
+	bool PeekSlotTimestamp(uint64 Index, double& OutTimestampMs) const;
+
+	/** Index of the oldest frame still held for a given publish count */
+	static uint64 GetOldestIndex(uint64 Count);
+
+	/** Binary search over timestamps: first held index whose timestamp is >= TimestampMs (Count if none) */
+	uint64 LowerBoundIndex(double TimestampMs, uint64 Count) const;
+
+	/** Resolves [T0Ms, T1Ms] to published indices [OutFirst, OutEnd); false if the window is empty */
+	bool GetRangeIndices(double T0Ms, double T1Ms, uint64 Count, uint64& OutFirst, uint64& OutEnd) const;
+
+	/** First index that cannot have been touched by the producer once WriteIndex reached Count */
+	static uint64 GetFirstStableIndex(uint64 Count);
+
+	/** Copies published indices [First, End) and drops any leading frames the producer overwrote mid-copy */
+	int32 CopyIndexRange(uint64 First, uint64 End, TArray<T>& OutFrames) const;
+
+	// Performance optimization functions
+	double CalculateInterpolationWeight(double TargetTime, double Frame1Time, double Frame2Time) const;
+	void UpdatePerformanceStats(double Latency);
+};
+
+/** Subsystem-wide frame history: timestamp index, interpolation, optional gaze columns and optional snapshots */
+using FBeamFrameRing = TBeamRing<FBeamFrame, 1024, FBeamRingFrameTimestamps, FBeamRingFrameInterpolation, true>;
+
+/** Small per-component history of quantized frames, used for component FrameBufferSize values up to 64 */
+using FBeamComponentFrameRing = TBeamRing<FBeamFrameCompact, 64, FBeamRingCompactTimestamps, FBeamRingNoInterpolation>;
+
+/** Quantized history at the subsystem ring's depth, for stores that never hand whole frames to Blueprint */
+using FBeamCompactFrameRing = TBeamRing<FBeamFrameCompact, 1024, FBeamRingCompactTimestamps, FBeamRingNoInterpolation>;
+
+extern template class BEAMEYETRACKER_API TBeamRing<FBeamFrame, 1024, FBeamRingFrameTimestamps, FBeamRingFrameInterpolation, true>;
+extern template class BEAMEYETRACKER_API TBeamRing<FBeamFrameCompact, 64, FBeamRingCompactTimestamps, FBeamRingNoInterpolation>;
+extern template class BEAMEYETRACKER_API TBeamRing<FBeamFrameCompact, 1024, FBeamRingCompactTimestamps, FBeamRingNoInterpolation>;
+
+/*=============================================================================
+    End of BeamRing.h
+=============================================================================*/
@@ -0,0 +1,54 @@
+/*=============================================================================
+    BeamRuntimeSettings.h: Immutable snapshot of the hot-reloadable settings.
+
+    The subsystem publishes a new snapshot whenever a runtime setting
+    changes and bumps a version counter. The producer thread, the filters
+    and components compare the version once per frame and only take the
+    new snapshot when it moved, so a settings change never restarts
+    tracking and never touches the config file on the frame path.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamFilters.h"
+
+class UBeamEyeTrackerSettings;
+
+/** Values are never modified after publication; changes publish a new snapshot */
+struct BEAMEYETRACKER_API FBeamRuntimeSettings
+{
+	/** Set by the subsystem on publication; 0 means the snapshot was never published */
+	uint32 Version = 0;
+
+	int32 PollingHz = 120;
+	bool bEnableSmoothing = true;
+	bool bAutoStart = false;
+	float TraceDistance = 5000.0f;
+
+	/** DataRate follows PollingHz */
+	FOneEuroFilterParams OneEuro;
+
+	/** Filter requested while smoothing is enabled */
+	EBeamFilterType FilterType = EBeamFilterType::OneEuro;
+
+	/** Filter the producer should run: None while smoothing is disabled */
+	EBeamFilterType GetEffectiveFilterType() const
+	{
+		return bEnableSmoothing ? FilterType : EBeamFilterType::None;
+	}
+
+	/** Copies the runtime fields of a settings object; FilterType is OneEuro when smoothing is enabled */
+	static FBeamRuntimeSettings FromSettings(const UBeamEyeTrackerSettings& Settings);
+
+	/** Writes the persisted fields back into a settings object */
+	void CopyToSettings(UBeamEyeTrackerSettings& Settings) const;
+};
+
+/*=============================================================================
+    End of BeamRuntimeSettings.h
+=============================================================================*/
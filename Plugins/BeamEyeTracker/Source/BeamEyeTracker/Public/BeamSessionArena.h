@@ -0,0 +1,184 @@
+/*=============================================================================
+    BeamSessionArena.h: Per-session linear allocation for analytics data.
+
+    Session-scoped records are bump-allocated from blocks that are kept
+    for the next session, so a long-running deployment settles on a fixed
+    set of blocks instead of growing and freeing arrays for hours. Ending
+    a session rewinds the arena in constant time.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <type_traits>
+
+/**
+ * Block-chained linear allocator.
+ *
+ * Allocation is a pointer bump; when the current block is full the next
+ * retained block is reused, and a new block is only allocated once the
+ * session outgrows every block it ever had. Nothing is freed individually
+ * and no destructors run, so only trivially destructible data belongs
+ * here. Reset rewinds to the first block in O(1) and invalidates every
+ * pointer handed out; Trim additionally frees all but the first block.
+ * Not thread safe.
+ */
+class BEAMEYETRACKER_API FBeamSessionArena
+{
+public:
+	static constexpr int32 DefaultBlockBytes = 64 * 1024;
+
+	/** Blocks are allocated on first use, so an idle arena costs nothing */
+	explicit FBeamSessionArena(int32 InBlockBytes = DefaultBlockBytes);
+	~FBeamSessionArena();
+
+	FBeamSessionArena(const FBeamSessionArena&) = delete;
+	FBeamSessionArena& operator=(const FBeamSessionArena&) = delete;
+
+	/** Uninitialized memory that stays valid until the next Reset or Trim */
+	void* Allocate(SIZE_T Size, SIZE_T Alignment);
+
+	template <typename T>
+	T* AllocateUninitialized(int32 Count = 1)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "Arena memory is released without running destructors");
+		return static_cast<T*>(Allocate(sizeof(T) * Count, alignof(T)));
+	}
+
+	/** Rewinds to the first block, keeping every block for reuse */
+	void Reset();
+
+	/** Rewinds and frees every block but the first */
+	void Trim();
+
+	/** Bytes handed out since the last reset, including alignment padding */
+	SIZE_T GetUsedBytes() const { return UsedBytes; }
+
+	/** Bytes held in blocks */
+	SIZE_T GetReservedBytes() const { return ReservedBytes; }
+
+private:
+	struct FBlock
+	{
+		FBlock* Next;
+		SIZE_T Bytes;
+
+		uint8* Begin() { return reinterpret_cast<uint8*>(this + 1); }
+		uint8* End() { return Begin() + Bytes; }
+	};
+
+	int32 BlockBytes;
+	FBlock* First = nullptr;
+	FBlock* Current = nullptr;
+	uint8* Cursor = nullptr;
+	uint8* Limit = nullptr;
+	SIZE_T UsedBytes = 0;
+	SIZE_T ReservedBytes = 0;
+
+	/** Moves to a block after Current that can hold Size bytes at Alignment, inserting a new one if none can */
+	void AdvanceBlock(SIZE_T Size, SIZE_T Alignment);
+
+	FBlock* AllocateBlock(SIZE_T Bytes);
+	void FreeBlocksAfter(FBlock* Block);
+};
+
+/**
+ * Append-only log of trivially copyable records in arena chunks.
+ *
+ * Appending never moves earlier records, so there is no reallocation and
+ * copy as the log grows, and records keep their addresses for the life of
+ * the session. Once MaxNum records are held further appends are counted
+ * as dropped. Reset forgets the chunks in O(1); the arena they came from
+ * must be reset along with it or the chunks stay allocated until it is.
+ */
+template <typename T, int32 ChunkSize = 256>
+class TBeamEventLog
+{
+	static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "Log records are copied and released bitwise");
+
+public:
+	/** A log without an arena must not be added to */
+	explicit TBeamEventLog(FBeamSessionArena* InArena = nullptr, int32 InMaxNum = MAX_int32)
+		: Arena(InArena)
+		, MaxNum(InMaxNum)
+	{
+	}
+
+	/** Appends Item; false if the log is full */
+	bool Add(const T& Item)
+	{
+		if (Count >= MaxNum)
+		{
+			++NumDropped;
+			return false;
+		}
+
+		if (!Tail || Tail->Num == ChunkSize)
+		{
+			checkSlow(Arena);
+			FChunk* Chunk = Arena->AllocateUninitialized<FChunk>();
+			Chunk->Next = nullptr;
+			Chunk->Num = 0;
+			(Tail ? Tail->Next : Head) = Chunk;
+			Tail = Chunk;
+		}
+
+		Tail->Items[Tail->Num++] = Item;
+		++Count;
+		return true;
+	}
+
+	/** Calls Visitor(const T&) for every record, oldest first */
+	template <typename VisitorType>
+	void ForEach(VisitorType&& Visitor) const
+	{
+		for (const FChunk* Chunk = Head; Chunk; Chunk = Chunk->Next)
+		{
+			for (int32 Index = 0; Index < Chunk->Num; ++Index)
+			{
+				Visitor(Chunk->Items[Index]);
+			}
+		}
+	}
+
+	/** Appends every record to Out with a single reservation */
+	void CopyTo(TArray<T>& Out) const
+	{
+		Out.Reserve(Out.Num() + Count);
+		ForEach([&Out](const T& Item) { Out.Add(Item); });
+	}
+
+	void Reset()
+	{
+		Head = nullptr;
+		Tail = nullptr;
+		Count = 0;
+		NumDropped = 0;
+	}
+
+	int32 Num() const { return Count; }
+	int32 GetNumDropped() const { return NumDropped; }
+
+private:
+	struct FChunk
+	{
+		FChunk* Next;
+		int32 Num;
+		T Items[ChunkSize];
+	};
+
+	FBeamSessionArena* Arena;
+	int32 MaxNum;
+	FChunk* Head = nullptr;
+	FChunk* Tail = nullptr;
+	int32 Count = 0;
+	int32 NumDropped = 0;
+};
+
+/*=============================================================================
+    End of BeamSessionArena.h
+=============================================================================*/
@@ -0,0 +1,59 @@
+/*=============================================================================
+    BeamSimCameraModifier.h: Head-look camera driven by the Beam sim game camera.
+
+    Applies the SDK's sim game camera transform on top of the player camera.
+    The transform is computed once per tracker frame where the SDK frame is
+    converted; the modifier only interpolates the cached values to the time
+    the rendered frame represents, so head-look stays smooth at display
+    rates well above the tracker rate.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/CameraModifier.h"
+#include "BeamSimCameraModifier.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+
+/** Camera modifier adding the Beam sim game camera rotation and translation to the view */
+UCLASS(BlueprintType, Blueprintable)
+class BEAMEYETRACKER_API UBeamSimCameraModifier : public UCameraModifier
+{
+	GENERATED_BODY()
+
+public:
+	UBeamSimCameraModifier();
+
+	/** Scales both rotation and translation; 1 reproduces the motion configured in the Beam app */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam", meta = (ClampMin = "0.0", ClampMax = "5.0"))
+	float Sensitivity = 1.0f;
+
+	/** Apply the translation component as well as the rotation */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam")
+	bool bApplyTranslation = true;
+
+	/**
+	 * How far behind the present the ring is sampled, so two tracker frames always bracket the sample.
+	 * 0 uses the tracker's own frame interval.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam", meta = (ClampMin = "0.0", ClampMax = "100.0", Units = "ms"))
+	float InterpolationDelayMs = 0.0f;
+
+	//~ Begin UCameraModifier Interface
+	virtual bool ModifyCamera(float DeltaTime, FVector ViewLocation, FRotator ViewRotation, float FOV, FVector& NewViewLocation, FRotator& NewViewRotation, float& NewFOV) override;
+	//~ End UCameraModifier Interface
+
+private:
+	UBeamEyeTrackerSubsystem* ResolveSubsystem();
+
+	TWeakObjectPtr<UBeamEyeTrackerSubsystem> CachedSubsystem;
+};
+
+/*=============================================================================
+    End of BeamSimCameraModifier.h
+=============================================================================*/
@@ -15,11 +15,13 @@
 #include "CoreMinimal.h"
 #include "GameFramework/HUD.h"
 #include "BeamEyeTrackerTypes.h"
+#include "BeamGazeTrail.h"
 #include "BeamEyeTrackerExampleHUD.generated.h"
 
 // Forward declarations
 class UBeamEyeTrackerSubsystem;
 class UBeamEyeTrackerComponent;
+class FBeamDebugBatch;
 
 // Example HUD with Beam Eye Tracker Integration
 
@@ -93,20 +95,19 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category="Beam Eye Tracker")
 	bool bIsPlayingBack = false;
 
-	// Gaze trail history
-	UPROPERTY(BlueprintReadOnly, Category="Beam Eye Tracker")
-	TArray<FVector2D> GazeTrailPoints;
+	// Gaze trail history, drawn as one triangle batch whatever its length
+	FBeamGazeTrail GazeTrail;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Beam Eye Tracker")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Beam Eye Tracker", meta=(ClampMin="2", ClampMax="1000"))
 	int32 MaxTrailPoints = 30;
 
 private:
-	// HUD update functions
+	// HUD update functions; drawing only queues primitives, which the debug overlay draws in one pass
 	void UpdateHUDData();
-	void DrawStatusPanel();
-	void DrawGazeCrosshair();
-	void DrawGazeTrail();
-	void DrawPerformanceMetrics();
+	void DrawStatusPanel(FBeamDebugBatch& Batch);
+	void DrawGazeCrosshair(FBeamDebugBatch& Batch);
+	void DrawGazeTrail(FBeamDebugBatch& Batch);
+	void DrawPerformanceMetrics(FBeamDebugBatch& Batch);
 
 	// Utility functions
 	FString GetHealthStatusString(EBeamHealth Health) const;
@@ -13,6 +13,10 @@
 
 #include "CoreMinimal.h"
 #include "BeamEyeTrackerTypes.h"
+#include "BeamRing.h"
+#include "HAL/PlatformProcess.h"
+
+class FEvent;
 
 /**
  * Essential interface for Beam data sources in UE integration.
@@ -34,6 +38,9 @@ public:
 	virtual bool FetchCurrentFrame(FBeamFrame& OutFrame) = 0;
 	virtual EBeamHealth GetHealth() const = 0;
 
+	/** Updates what GetHealth reports for sources not told about status changes; called by the watchdog, game thread */
+	virtual void RefreshHealth() {}
+
 	/** Camera recentering (core SDK functionality) */
 	virtual bool StartCameraRecentering() = 0;
 	virtual void EndCameraRecentering() = 0;
@@ -43,9 +50,32 @@ public:
 	virtual bool IsSDKInitialized() const = 0;
 	virtual void UpdateViewportGeometry(int32 ViewportWidth, int32 ViewportHeight) = 0;
 
+	/** Desktop rectangle the source normalizes gaze against; sources without desktop coordinates only use the size */
+	virtual void UpdateViewportRect(const FIntPoint& OriginPx, const FIntPoint& SizePx) { UpdateViewportGeometry(SizePx.X, SizePx.Y); }
+
 	/** Calibration support */
 	virtual bool StartCalibration(const FString& ProfileId) = 0;
 	virtual void StopCalibration() = 0;
+
+	/** Push ingestion: sources that can publish frames as they arrive write into this ring */
+	virtual void SetFrameSink(FBeamFrameRing* InFrameSink) {}
+	virtual bool IsPushingFrames() const { return false; }
+
+	/** Event-driven wake: the source triggers InEvent on every new frame; false when it cannot signal frames */
+	virtual bool SetFrameEvent(FEvent* InEvent) { return false; }
+
+	/** FPlatformTime seconds the source last heard from the tracker, whether or not that produced a frame; false when it cannot tell */
+	virtual bool GetLastActivitySeconds(double& OutSeconds) const { return false; }
+
+	/** Offset from the source's capture clock to FPlatformTime seconds; false when the source stamps frames locally */
+	virtual bool GetClockOffsetSeconds(double& OutOffsetSeconds) const { return false; }
+
+	/** Producer-thread access: blocks until a new frame is available; sources without a native wait sleep then poll */
+	virtual bool WaitForNextFrame(FBeamFrame& OutFrame, uint32 TimeoutMs)
+	{
+		FPlatformProcess::Sleep(TimeoutMs * 0.001f);
+		return FetchCurrentFrame(OutFrame);
+	}
 };
 
 /*=============================================================================
@@ -0,0 +1,39 @@
+/*=============================================================================
+    IBeamFrameObserver.h: Publish-time frame observers for Beam Eye Tracker.
+
+    Observers see each frame on the thread that publishes it, right after
+    it enters the frame ring, for consumers such as Live Link that must
+    forward frames with no game-thread hop in between.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeamEyeTrackerTypes.h"
+
+/**
+ * Receives published frames.
+ *
+ * Called on the producer thread for live data and on the game thread for
+ * playback, once per frame and never concurrently. This is the producer's
+ * hot path: implementations must not block, and should hand anything
+ * slow to another thread.
+ */
+class BEAMEYETRACKER_API IBeamFrameObserver
+{
+public:
+	virtual ~IBeamFrameObserver() = default;
+
+	/** Frame has just been published to the ring */
+	virtual void OnFramePublished(const FBeamFrame& Frame) = 0;
+};
+
+using FBeamFrameObserverRef = TSharedRef<IBeamFrameObserver, ESPMode::ThreadSafe>;
+
+/*=============================================================================
+    End of IBeamFrameObserver.h
+=============================================================================*/
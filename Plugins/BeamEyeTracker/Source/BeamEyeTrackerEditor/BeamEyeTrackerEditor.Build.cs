@@ -38,7 +38,8 @@ public class BeamEyeTrackerEditor : ModuleRules
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[] {
-			"BeamEyeTracker" // Our runtime module
+			"BeamEyeTracker", // Our runtime module
+			"DesktopPlatform"
 		});
 
 		// Editor-only module - use the correct property for UE 5.6
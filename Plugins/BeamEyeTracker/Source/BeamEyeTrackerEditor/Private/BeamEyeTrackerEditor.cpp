@@ -33,11 +33,13 @@
 #include "ComponentCustomization.h"
 // MonitorTab.h removed - using UMG widget approach instead
 #include "BeamK2Nodes.h"
+#include "SBeamRecordingTimeline.h"
 
 #define LOCTEXT_NAMESPACE "FBeamEyeTrackerEditorModule"
 
 // Define the static member
 const FName FBeamEyeTrackerEditorModule::BeamEyeTrackerMonitorTabName(TEXT("BeamEyeTrackerMonitor"));
+const FName FBeamEyeTrackerEditorModule::BeamRecordingTimelineTabName(TEXT("BeamRecordingTimeline"));
 
 void FBeamEyeTrackerEditorModule::StartupModule()
 {
@@ -88,6 +90,16 @@ void FBeamEyeTrackerEditorModule::StartupModule()
 	.SetGroup(WorkspaceMenu::GetMenuStructure().GetDeveloperToolsMiscCategory())
 	.SetIcon(FSlateIcon(FBeamEyeTrackerEditorStyle::GetStyleSetName(), "BeamEyeTrackerEditor.MonitorIcon"));
 
+	// Register the recording timeline tab spawner
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(
+		BeamRecordingTimelineTabName,
+		FOnSpawnTab::CreateRaw(this, &FBeamEyeTrackerEditorModule::OnSpawnRecordingTimelineTab)
+	)
+	.SetDisplayName(LOCTEXT("BeamRecordingTimelineTab", "Beam Recording Timeline"))
+	.SetTooltipText(LOCTEXT("BeamRecordingTimelineTabTooltip", "Browse and scrub .beamrec recordings"))
+	.SetGroup(WorkspaceMenu::GetMenuStructure().GetDeveloperToolsMiscCategory())
+	.SetIcon(FSlateIcon(FBeamEyeTrackerEditorStyle::GetStyleSetName(), "BeamEyeTrackerEditor.MonitorIcon"));
+
 	// Register component customization
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 	PropertyModule.RegisterCustomClassLayout(
@@ -109,6 +121,7 @@ void FBeamEyeTrackerEditorModule::ShutdownModule()
 
 	// Unregister the monitor tab spawner
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(BeamEyeTrackerMonitorTabName);
+	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(BeamRecordingTimelineTabName);
 
 	// Unregister component customization
 	if (FModuleManager::Get().IsModuleLoaded("PropertyEditor"))
@@ -199,6 +212,15 @@ TSharedRef<SDockTab> FBeamEyeTrackerEditorModule::OnSpawnMonitorTab(const FSpawn
 		];
 }
 
+TSharedRef<SDockTab> FBeamEyeTrackerEditorModule::OnSpawnRecordingTimelineTab(const FSpawnTabArgs& SpawnTabArgs)
+{
+	return SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		[
+			SNew(SBeamRecordingTimeline)
+		];
+}
+
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FBeamEyeTrackerEditorModule, BeamEyeTrackerEditor)
@@ -12,6 +12,11 @@
 #include "Components/VerticalBox.h"
 #include "Components/HorizontalBox.h"
 #include "Components/GridPanel.h"
+#include "Components/Image.h"
+#include "BeamHeatmapSubsystem.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/GameInstance.h"
+#include "Rendering/DrawElements.h"
 
 #include "TimerManager.h"
 #include "Misc/FileHelper.h"
@@ -37,7 +42,7 @@ void UBeamEyeTrackerMonitorWidget::NativeConstruct()
 	InitializeDefaults();
 	InitializeWidgetBindings();
 
-	// Set up timer for updates
+	// Texts follow the subsystem's snapshot rate, so a shorter interval only adds idle checks
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().SetTimer(UpdateTimerHandle, FTimerDelegate::CreateUObject(this, &UBeamEyeTrackerMonitorWidget::UpdateMonitor), UpdateInterval, true);
@@ -154,52 +159,143 @@ void UBeamEyeTrackerMonitorWidget::InitializeWidgetBindings()
 	}
 }
 
+UBeamEyeTrackerSubsystem* UBeamEyeTrackerMonitorWidget::GetBeamSubsystem() const
+{
+	if (UBeamEyeTrackerSubsystem* Subsystem = CachedSubsystem.Get())
+	{
+		return Subsystem;
+	}
+
+	UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	CachedSubsystem = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	return CachedSubsystem.Get();
+}
+
+const FBeamMonitorSnapshot& UBeamEyeTrackerMonitorWidget::GetSnapshot() const
+{
+	static const FBeamMonitorSnapshot Empty;
+	const UBeamEyeTrackerSubsystem* Subsystem = GetBeamSubsystem();
+	return Subsystem ? Subsystem->GetMonitorSnapshot() : Empty;
+}
+
 void UBeamEyeTrackerMonitorWidget::UpdateMonitor()
 {
-	// Update status text
+	UpdateHeatmapImage();
+
+	// The subsystem publishes at a fixed rate; between snapshots there is nothing new to format
+	const FBeamMonitorSnapshot& Snapshot = GetSnapshot();
+	if (Snapshot.Sequence != 0 && Snapshot.Sequence == DisplayedSequence)
+	{
+		return;
+	}
+	DisplayedSequence = Snapshot.Sequence;
+
+	if (HistoryGraph)
+	{
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+
 	if (StatusText)
 	{
-		StatusText->SetText(GetTrackingStatusText());
+		StatusText->SetText(GetTrackingStatusText(Snapshot));
 	}
 
 	if (HealthText)
 	{
-		HealthText->SetText(GetHealthStatusText());
+		HealthText->SetText(GetHealthStatusText(Snapshot));
 	}
 
 	if (FPSText)
 	{
-		FPSText->SetText(GetFPSText());
+		FPSText->SetText(GetFPSText(Snapshot));
 	}
 
 	if (GazeDataText)
 	{
-		GazeDataText->SetText(GetGazePointText());
+		GazeDataText->SetText(GetGazePointText(Snapshot));
 	}
 
 	if (BufferText)
 	{
-		BufferText->SetText(GetBufferUtilizationText());
+		BufferText->SetText(GetBufferUtilizationText(Snapshot));
 	}
 
 	if (HeadDataText)
 	{
-		HeadDataText->SetText(GetHeadPoseText());
+		HeadDataText->SetText(GetHeadPoseText(Snapshot));
 	}
 
 	if (CalibrationText)
 	{
-		CalibrationText->SetText(GetCalibrationStatusText());
+		CalibrationText->SetText(GetCalibrationStatusText(Snapshot));
 	}
 
 	if (RecordingText)
 	{
-		RecordingText->SetText(GetRecordingStatusText());
+		RecordingText->SetText(GetRecordingStatusText(Snapshot));
 	}
 
 	if (PlaybackText)
 	{
-		PlaybackText->SetText(GetPlaybackStatusText());
+		PlaybackText->SetText(GetPlaybackStatusText(Snapshot));
+	}
+}
+
+int32 UBeamEyeTrackerMonitorWidget::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	LayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+	const UBeamEyeTrackerSubsystem* Subsystem = GetBeamSubsystem();
+	if (!HistoryGraph || !HistoryGraph->IsVisible() || !Subsystem || Subsystem->GetMonitorHistory().Num() < 2)
+	{
+		return LayerId;
+	}
+
+	const FBeamMonitorHistory& History = Subsystem->GetMonitorHistory();
+	const FGeometry& GraphGeometry = HistoryGraph->GetPaintSpaceGeometry();
+	++LayerId;
+	PaintHistorySeries(History, &FBeamMonitorSnapshot::BufferUtilization, 100.0f, BufferGraphColor, GraphGeometry, OutDrawElements, LayerId);
+	PaintHistorySeries(History, &FBeamMonitorSnapshot::LatencyMs, GraphMaxLatencyMs, LatencyGraphColor, GraphGeometry, OutDrawElements, LayerId);
+	PaintHistorySeries(History, &FBeamMonitorSnapshot::TrackingFPS, GraphMaxFPS, FPSGraphColor, GraphGeometry, OutDrawElements, LayerId);
+	return LayerId;
+}
+
+void UBeamEyeTrackerMonitorWidget::PaintHistorySeries(const FBeamMonitorHistory& History, float FBeamMonitorSnapshot::* Field, float MaxValue, const FLinearColor& Color,
+	const FGeometry& Geometry, FSlateWindowElementList& OutDrawElements, int32 LayerId) const
+{
+	// The full ring spans the width, so the graph scrolls from the right as it fills
+	const FVector2D Size = Geometry.GetLocalSize();
+	const double StepX = Size.X / (FBeamMonitorHistory::Capacity - 1);
+	const double StartX = Size.X - StepX * (History.Num() - 1);
+	const float Scale = 1.0f / FMath::Max(MaxValue, UE_KINDA_SMALL_NUMBER);
+
+	GraphPoints.Reset(History.Num());
+	for (int32 Index = 0; Index < History.Num(); ++Index)
+	{
+		const float Value01 = FMath::Clamp(History.Get(Index).*Field * Scale, 0.0f, 1.0f);
+		GraphPoints.Emplace(StartX + StepX * Index, Size.Y * (1.0f - Value01));
+	}
+
+	FSlateDrawElement::MakeLines(OutDrawElements, LayerId, Geometry.ToPaintGeometry(), GraphPoints, ESlateDrawEffect::None, Color, true, 1.0f);
+}
+
+void UBeamEyeTrackerMonitorWidget::UpdateHeatmapImage()
+{
+	if (!HeatmapImage)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UBeamHeatmapSubsystem* Heatmap = GameInstance ? GameInstance->GetSubsystem<UBeamHeatmapSubsystem>() : nullptr;
+	UTextureRenderTarget2D* Texture = Heatmap ? Heatmap->GetHeatmapTexture() : nullptr;
+
+	// The texture updates on the GPU, so the brush only changes when the target is (re)created
+	if (Texture && HeatmapImage->GetBrush().GetResourceObject() != Texture)
+	{
+		HeatmapImage->SetBrushResourceObject(Texture);
 	}
 }
 
@@ -288,100 +384,39 @@ void UBeamEyeTrackerMonitorWidget::StopPlayback()
 // Public getter functions
 bool UBeamEyeTrackerMonitorWidget::IsTracking() const
 {
-	if (UWorld* World = GetWorld())
-	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			return Subsystem->IsBeamTracking();
-		}
-	}
-	return false;
+	return GetSnapshot().bTracking;
 }
 
 bool UBeamEyeTrackerMonitorWidget::IsRecording() const
 {
-	if (UWorld* World = GetWorld())
-	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			return Subsystem->IsRecording();
-		}
-	}
-	return false;
+	return GetSnapshot().bRecording;
 }
 
 bool UBeamEyeTrackerMonitorWidget::IsPlayingBack() const
 {
-	if (UWorld* World = GetWorld())
-	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			return Subsystem->IsPlayingBack();
-		}
-	}
-	return false;
+	return GetSnapshot().bPlayingBack;
 }
 
 float UBeamEyeTrackerMonitorWidget::GetCurrentFPS() const
 {
-	if (UWorld* World = GetWorld())
-	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			return Subsystem->GetCurrentFPS();
-		}
-	}
-	return 0.0f;
+	return GetSnapshot().TrackingFPS;
 }
 
 int32 UBeamEyeTrackerMonitorWidget::GetBufferUtilization() const
 {
-	if (UWorld* World = GetWorld())
-	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			return Subsystem->GetBufferUtilization();
-		}
-	}
-	return 0;
+	return FMath::RoundToInt32(GetSnapshot().BufferUtilization);
 }
 
 FVector2D UBeamEyeTrackerMonitorWidget::GetCurrentGazePoint() const
 {
-	if (UWorld* World = GetWorld())
-	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			FBeamFrame Frame;
-			if (Subsystem->GetLatestInterpolatedFrame(0.0, Frame))
-			{
-				if (Frame.Gaze.bValid)
-				{
-					return Frame.Gaze.Screen01;
-				}
-			}
-		}
-	}
-	return FVector2D::ZeroVector;
+	const FBeamMonitorSnapshot& Snapshot = GetSnapshot();
+	return Snapshot.bGazeValid ? FVector2D(Snapshot.GazeScreen01) : FVector2D::ZeroVector;
 }
 
 FVector UBeamEyeTrackerMonitorWidget::GetCurrentHeadPosition() const
 {
-	if (UWorld* World = GetWorld())
-	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			FBeamFrame Frame;
-			if (Subsystem->GetLatestInterpolatedFrame(0.0, Frame))
-			{
-				if (Frame.Head.Confidence > 0.0f)
-				{
-					return Frame.Head.PositionCm;
-				}
-			}
-		}
-	}
-	return FVector::ZeroVector;
+	const FBeamMonitorSnapshot& Snapshot = GetSnapshot();
+	return Snapshot.bHeadValid ? FVector(Snapshot.HeadPositionCm) : FVector::ZeroVector;
 }
 
 // Event handlers
@@ -486,182 +521,112 @@ void UBeamEyeTrackerMonitorWidget::OnPlaybackPathChanged(const FText& NewText)
 }
 
 // Status text getters
-FText UBeamEyeTrackerMonitorWidget::GetTrackingStatusText() const
+FText UBeamEyeTrackerMonitorWidget::GetTrackingStatusText(const FBeamMonitorSnapshot& Snapshot)
 {
-	if (UWorld* World = GetWorld())
+	if (Snapshot.Sequence == 0)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			if (Subsystem->IsBeamTracking())
-			{
-				FBeamFrame TestFrame;
-				if (Subsystem->GetLatestInterpolatedFrame(0.0, TestFrame))
-				{
-					return NSLOCTEXT("Beam", "TrackingActive", "Tracking: Active (Data Flowing)");
-				}
-				else
-				{
-					return NSLOCTEXT("Beam", "TrackingNoData", "Tracking: Active (No Data)");
-				}
-			}
-			else
-			{
-				return NSLOCTEXT("Beam", "TrackingInactive", "Tracking: Inactive");
-			}
-		}
+		return NSLOCTEXT("Beam", "StatusUnknown", "Unknown");
+	}
+	if (!Snapshot.bTracking)
+	{
+		return NSLOCTEXT("Beam", "TrackingInactive", "Tracking: Inactive");
 	}
-	return NSLOCTEXT("Beam", "StatusUnknown", "Unknown");
+	return Snapshot.bHasFrame
+		? NSLOCTEXT("Beam", "TrackingActive", "Tracking: Active (Data Flowing)")
+		: NSLOCTEXT("Beam", "TrackingNoData", "Tracking: Active (No Data)");
 }
 
-FText UBeamEyeTrackerMonitorWidget::GetHealthStatusText() const
+FText UBeamEyeTrackerMonitorWidget::GetHealthStatusText(const FBeamMonitorSnapshot& Snapshot)
 {
-	if (UWorld* World = GetWorld())
+	if (Snapshot.Sequence == 0)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			if (Subsystem->IsBeamTracking())
-			{
-				return NSLOCTEXT("Beam", "HealthGood", "Health: Good");
-			}
-			else
-			{
-				return NSLOCTEXT("Beam", "HealthInactive", "Health: Inactive");
-			}
-		}
+		return NSLOCTEXT("Beam", "HealthUnknown", "Unknown");
 	}
-	return NSLOCTEXT("Beam", "HealthUnknown", "Unknown");
+	if (!Snapshot.bTracking)
+	{
+		return NSLOCTEXT("Beam", "HealthInactive", "Health: Inactive");
+	}
+	return FText::Format(NSLOCTEXT("Beam", "HealthFormat", "Health: {0}"), UEnum::GetDisplayValueAsText(Snapshot.Health));
 }
 
-FText UBeamEyeTrackerMonitorWidget::GetFPSText() const
+FText UBeamEyeTrackerMonitorWidget::GetFPSText(const FBeamMonitorSnapshot& Snapshot)
 {
-	if (UWorld* World = GetWorld())
+	if (Snapshot.Sequence == 0)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			float FPS = Subsystem->GetCurrentFPS();
-			return FText::Format(NSLOCTEXT("Beam", "FPSFormat", "FPS: {0}"), FText::AsNumber(FPS));
-		}
+		return NSLOCTEXT("Beam", "FPSUnknown", "FPS: Unknown");
 	}
-	return NSLOCTEXT("Beam", "FPSUnknown", "FPS: Unknown");
+	return FText::Format(NSLOCTEXT("Beam", "FPSFormat", "FPS: {0}"), FText::AsNumber(Snapshot.TrackingFPS));
 }
 
-FText UBeamEyeTrackerMonitorWidget::GetGazePointText() const
+FText UBeamEyeTrackerMonitorWidget::GetGazePointText(const FBeamMonitorSnapshot& Snapshot)
 {
-	if (UWorld* World = GetWorld())
+	if (!Snapshot.bHasFrame)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			FBeamFrame Frame;
-			if (Subsystem->GetLatestInterpolatedFrame(0.0, Frame))
-			{
-				if (Frame.Gaze.bValid)
-				{
-					return FText::Format(NSLOCTEXT("Beam", "GazeFormat", "Gaze: ({0}, {1})"), 
-						FText::AsNumber(Frame.Gaze.Screen01.X), 
-						FText::AsNumber(Frame.Gaze.Screen01.Y));
-				}
-				else
-				{
-					return NSLOCTEXT("Beam", "GazeInvalid", "Gaze: Invalid");
-				}
-			}
-		}
+		return NSLOCTEXT("Beam", "GazeUnknown", "Gaze: Unknown");
+	}
+	if (!Snapshot.bGazeValid)
+	{
+		return NSLOCTEXT("Beam", "GazeInvalid", "Gaze: Invalid");
 	}
-	return NSLOCTEXT("Beam", "GazeUnknown", "Gaze: Unknown");
+	return FText::Format(NSLOCTEXT("Beam", "GazeFormat", "Gaze: ({0}, {1})"),
+		FText::AsNumber(Snapshot.GazeScreen01.X),
+		FText::AsNumber(Snapshot.GazeScreen01.Y));
 }
 
-FText UBeamEyeTrackerMonitorWidget::GetBufferUtilizationText() const
+FText UBeamEyeTrackerMonitorWidget::GetBufferUtilizationText(const FBeamMonitorSnapshot& Snapshot)
 {
-	if (UWorld* World = GetWorld())
+	if (Snapshot.Sequence == 0)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			int32 Utilization = Subsystem->GetBufferUtilization();
-			return FText::Format(NSLOCTEXT("Beam", "BufferFormat", "Buffer: {0}%"), FText::AsNumber(Utilization));
-		}
+		return NSLOCTEXT("Beam", "BufferUnknown", "Buffer: Unknown");
 	}
-	return NSLOCTEXT("Beam", "BufferUnknown", "Buffer: Unknown");
+	return FText::Format(NSLOCTEXT("Beam", "BufferFormat", "Buffer: {0}%"), FText::AsNumber(FMath::RoundToInt32(Snapshot.BufferUtilization)));
 }
 
-FText UBeamEyeTrackerMonitorWidget::GetHeadPoseText() const
+FText UBeamEyeTrackerMonitorWidget::GetHeadPoseText(const FBeamMonitorSnapshot& Snapshot)
 {
-	if (UWorld* World = GetWorld())
+	if (!Snapshot.bHasFrame)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			FBeamFrame Frame;
-			if (Subsystem->GetLatestInterpolatedFrame(0.0, Frame))
-			{
-				if (Frame.Head.Confidence > 0.0f)
-				{
-					return FText::Format(NSLOCTEXT("Beam", "HeadPoseFormat", "Head: ({0}, {1}, {2})"), 
-						FText::AsNumber(Frame.Head.PositionCm.X), 
-						FText::AsNumber(Frame.Head.PositionCm.Y),
-						FText::AsNumber(Frame.Head.PositionCm.Z));
-				}
-				else
-				{
-					return NSLOCTEXT("Beam", "HeadPoseInvalid", "Head: Invalid");
-				}
-			}
-		}
+		return NSLOCTEXT("Beam", "HeadPoseUnknown", "Head: Unknown");
+	}
+	if (!Snapshot.bHeadValid)
+	{
+		return NSLOCTEXT("Beam", "HeadPoseInvalid", "Head: Invalid");
 	}
-	return NSLOCTEXT("Beam", "HeadPoseUnknown", "Head: Unknown");
+	return FText::Format(NSLOCTEXT("Beam", "HeadPoseFormat", "Head: ({0}, {1}, {2})"),
+		FText::AsNumber(Snapshot.HeadPositionCm.X),
+		FText::AsNumber(Snapshot.HeadPositionCm.Y),
+		FText::AsNumber(Snapshot.HeadPositionCm.Z));
 }
 
-FText UBeamEyeTrackerMonitorWidget::GetCalibrationStatusText() const
+FText UBeamEyeTrackerMonitorWidget::GetCalibrationStatusText(const FBeamMonitorSnapshot& Snapshot)
 {
-	if (UWorld* World = GetWorld())
+	if (Snapshot.Sequence == 0)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			if (Subsystem->IsCalibrated())
-			{
-				return NSLOCTEXT("Beam", "CalibrationGood", "Calibration: Good");
-			}
-			else
-			{
-				return NSLOCTEXT("Beam", "CalibrationNeeded", "Calibration: Needed");
-			}
-		}
+		return NSLOCTEXT("Beam", "CalibrationUnknown", "Calibration: Unknown");
 	}
-	return NSLOCTEXT("Beam", "CalibrationUnknown", "Calibration: Unknown");
+	return Snapshot.bCalibrated
+		? NSLOCTEXT("Beam", "CalibrationGood", "Calibration: Good")
+		: NSLOCTEXT("Beam", "CalibrationNeeded", "Calibration: Needed");
 }
 
-FText UBeamEyeTrackerMonitorWidget::GetRecordingStatusText() const
+FText UBeamEyeTrackerMonitorWidget::GetRecordingStatusText(const FBeamMonitorSnapshot& Snapshot)
 {
-	if (UWorld* World = GetWorld())
+	if (Snapshot.Sequence == 0)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			if (Subsystem->IsRecording())
-			{
-				return NSLOCTEXT("Beam", "RecordingActive", "Recording: Active");
-			}
-			else
-			{
-				return NSLOCTEXT("Beam", "RecordingInactive", "Recording: Inactive");
-			}
-		}
+		return NSLOCTEXT("Beam", "RecordingUnknown", "Recording: Unknown");
 	}
-	return NSLOCTEXT("Beam", "RecordingUnknown", "Recording: Unknown");
+	return Snapshot.bRecording
+		? NSLOCTEXT("Beam", "RecordingActive", "Recording: Active")
+		: NSLOCTEXT("Beam", "RecordingInactive", "Recording: Inactive");
 }
 
-FText UBeamEyeTrackerMonitorWidget::GetPlaybackStatusText() const
+FText UBeamEyeTrackerMonitorWidget::GetPlaybackStatusText(const FBeamMonitorSnapshot& Snapshot)
 {
-	if (UWorld* World = GetWorld())
+	if (Snapshot.Sequence == 0)
 	{
-		if (UBeamEyeTrackerSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UBeamEyeTrackerSubsystem>())
-		{
-			if (Subsystem->IsPlayingBack())
-			{
-				return NSLOCTEXT("Beam", "PlaybackActive", "Playback: Active");
-			}
-			else
-			{
-				return NSLOCTEXT("Beam", "PlaybackInactive", "Playback: Inactive");
-			}
-		}
+		return NSLOCTEXT("Beam", "PlaybackUnknown", "Playback: Unknown");
 	}
-	return NSLOCTEXT("Beam", "PlaybackUnknown", "Playback: Unknown");
+	return Snapshot.bPlayingBack
+		? NSLOCTEXT("Beam", "PlaybackActive", "Playback: Active")
+		: NSLOCTEXT("Beam", "PlaybackInactive", "Playback: Inactive");
 }
@@ -16,6 +16,7 @@
 #include "EdGraphSchema_K2.h"
 #include "BeamEyeTrackerSubsystem.h"
 #include "BeamBlueprintLibrary.h"
+#include "BeamGazeTraceSubsystem.h"
 #include "BeamEyeTrackerTypes.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
@@ -30,6 +31,44 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "K2Node_SwitchEnum.h"
 
+namespace BeamK2Nodes
+{
+	/** Spawns a call to one of the UBeamBlueprintLibrary node entry points */
+	static UK2Node_CallFunction* SpawnLibraryCall(UK2Node* Node, FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, FName FunctionName)
+	{
+		UK2Node_CallFunction* CallNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(Node, SourceGraph);
+		CallNode->FunctionReference.SetExternalMember(FunctionName, UBeamBlueprintLibrary::StaticClass());
+		CallNode->AllocateDefaultPins();
+		return CallNode;
+	}
+
+	/** Feeds the calling graph's Self into the call's world context pin */
+	static void ConnectSelfWorldContext(UK2Node* Node, FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UK2Node_CallFunction* CallNode)
+	{
+		UEdGraphPin* WorldContextPin = CallNode->FindPin(TEXT("WorldContextObject"));
+		if (!WorldContextPin)
+		{
+			return;
+		}
+
+		UK2Node_Self* SelfNode = CompilerContext.SpawnIntermediateNode<UK2Node_Self>(Node, SourceGraph);
+		SelfNode->AllocateDefaultPins();
+		if (UEdGraphPin* SelfPin = SelfNode->FindPin(UEdGraphSchema_K2::PN_Self))
+		{
+			WorldContextPin->MakeLinkTo(SelfPin);
+		}
+	}
+
+	/** Moves the user's links on a node pin onto the matching intermediate pin, if both exist */
+	static void MoveLinks(FKismetCompilerContext& CompilerContext, UEdGraphPin* NodePin, UEdGraphPin* IntermediatePin)
+	{
+		if (NodePin && IntermediatePin)
+		{
+			CompilerContext.MovePinLinksToIntermediate(*NodePin, *IntermediatePin);
+		}
+	}
+}
+
 // ============================================================================
 // UK2Node_BeamGetSubsystem
 // ============================================================================
@@ -77,32 +116,10 @@ void UK2Node_BeamGetSubsystem::ExpandNode(FKismetCompilerContext& CompilerContex
 {
 	Super::ExpandNode(CompilerContext, SourceGraph);
 
-	// Create a call to GetBeamEyeTrackerSubsystem from the Blueprint Library
-	UK2Node_CallFunction* GetSubsystemNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-	GetSubsystemNode->FunctionReference.SetExternalMember(TEXT("GetBeamEyeTrackerSubsystem"), UBeamBlueprintLibrary::StaticClass());
-	GetSubsystemNode->AllocateDefaultPins();
-
-	// Get the WorldContext pin from the calling graph's Self
-	UEdGraphPin* WorldContextPin = GetSubsystemNode->FindPin(TEXT("WorldContextObject"));
-	if (WorldContextPin)
-	{
-		// Create a Self node to get the world context
-		UK2Node_Self* SelfNode = CompilerContext.SpawnIntermediateNode<UK2Node_Self>(this, SourceGraph);
-		SelfNode->AllocateDefaultPins();
-		
-		UEdGraphPin* SelfPin = SelfNode->FindPin(UEdGraphSchema_K2::PN_Self);
-		if (SelfPin)
-		{
-			WorldContextPin->MakeLinkTo(SelfPin);
-		}
-	}
-
-	// Connect subsystem output
-	UEdGraphPin* GetSubsystemReturnPin = GetSubsystemNode->FindPin(TEXT("ReturnValue"));
-	if (GetSubsystemReturnPin)
-	{
-		SubsystemPin->MakeLinkTo(GetSubsystemReturnPin);
-	}
+	// One call through the cached per-world lookup
+	UK2Node_CallFunction* GetSubsystemNode = BeamK2Nodes::SpawnLibraryCall(this, CompilerContext, SourceGraph, GET_FUNCTION_NAME_CHECKED(UBeamBlueprintLibrary, GetEyeTrackingSubsystem));
+	BeamK2Nodes::ConnectSelfWorldContext(this, CompilerContext, SourceGraph, GetSubsystemNode);
+	BeamK2Nodes::MoveLinks(CompilerContext, SubsystemPin, GetSubsystemNode->GetReturnValuePin());
 
 	// Break all links to this node
 	BreakAllNodeLinks();
@@ -173,56 +190,18 @@ void UK2Node_BeamIfTracking::ExpandNode(FKismetCompilerContext& CompilerContext,
 {
 	Super::ExpandNode(CompilerContext, SourceGraph);
 
-	// Create a call to IsBeamTracking from the Blueprint Library
-	UK2Node_CallFunction* IsTrackingNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-	IsTrackingNode->FunctionReference.SetExternalMember(TEXT("IsBeamTracking"), UBeamBlueprintLibrary::StaticClass());
-	IsTrackingNode->AllocateDefaultPins();
+	// Subsystem lookup, tracking state and frame age are one pure call; the branch compiles to a jump, not a call
+	UK2Node_CallFunction* IsFreshNode = BeamK2Nodes::SpawnLibraryCall(this, CompilerContext, SourceGraph, GET_FUNCTION_NAME_CHECKED(UBeamBlueprintLibrary, IsTrackingFresh));
+	BeamK2Nodes::ConnectSelfWorldContext(this, CompilerContext, SourceGraph, IsFreshNode);
+	BeamK2Nodes::MoveLinks(CompilerContext, FreshnessSecPin, IsFreshNode->FindPin(TEXT("FreshnessSec")));
 
-	// Create a branch node
 	UK2Node_IfThenElse* BranchNode = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
 	BranchNode->AllocateDefaultPins();
+	IsFreshNode->GetReturnValuePin()->MakeLinkTo(BranchNode->GetConditionPin());
 
-	// Connect IsTracking output to BranchNode condition
-	UEdGraphPin* IsTrackingReturnPin = IsTrackingNode->FindPin(TEXT("ReturnValue"));
-	UEdGraphPin* BranchConditionPin = BranchNode->GetConditionPin();
-	IsTrackingReturnPin->MakeLinkTo(BranchConditionPin);
-
-	// Connect exec pins
-	UEdGraphPin* IsTrackingExecPin = IsTrackingNode->GetExecPin();
-	UEdGraphPin* BranchExecPin = BranchNode->GetExecPin();
-	IsTrackingExecPin->MakeLinkTo(BranchExecPin);
-
-	// Connect input exec to IsTracking
-	ExecPin->MakeLinkTo(IsTrackingExecPin);
-
-	// Connect output exec pins
-	UEdGraphPin* BranchThenPin = BranchNode->GetThenPin();
-	UEdGraphPin* BranchElsePin = BranchNode->GetElsePin();
-
-	BranchThenPin->MakeLinkTo(ThenPin);
-	BranchElsePin->MakeLinkTo(ElsePin);
-
-	// Connect the FreshnessSec parameter
-	UEdGraphPin* IsTrackingFreshnessPin = IsTrackingNode->FindPin(TEXT("FreshnessSec"));
-	if (IsTrackingFreshnessPin && FreshnessSecPin)
-	{
-		FreshnessSecPin->MakeLinkTo(IsTrackingFreshnessPin);
-	}
-
-	// Get the WorldContext pin from the calling graph's Self
-	UEdGraphPin* WorldContextPin = IsTrackingNode->FindPin(TEXT("WorldContextObject"));
-	if (WorldContextPin)
-	{
-		// Create a Self node to get the world context
-		UK2Node_Self* SelfNode = CompilerContext.SpawnIntermediateNode<UK2Node_Self>(this, SourceGraph);
-		SelfNode->AllocateDefaultPins();
-		
-		UEdGraphPin* SelfPin = SelfNode->FindPin(UEdGraphSchema_K2::PN_Self);
-		if (SelfPin)
-		{
-			WorldContextPin->MakeLinkTo(SelfPin);
-		}
-	}
+	BeamK2Nodes::MoveLinks(CompilerContext, ExecPin, BranchNode->GetExecPin());
+	BeamK2Nodes::MoveLinks(CompilerContext, ThenPin, BranchNode->GetThenPin());
+	BeamK2Nodes::MoveLinks(CompilerContext, ElsePin, BranchNode->GetElsePin());
 
 	// Break all links to this node
 	BreakAllNodeLinks();
@@ -466,33 +445,16 @@ void UK2Node_BeamProjectGazeToWorld::ExpandNode(FKismetCompilerContext& Compiler
 {
 	Super::ExpandNode(CompilerContext, SourceGraph);
 
-	// Create a call to ProjectGazeToWorld
-	UK2Node_CallFunction* ProjectNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-	ProjectNode->FunctionReference.SetExternalMember(TEXT("ProjectGazeToWorld"), UBeamEyeTrackerSubsystem::StaticClass());
-	ProjectNode->AllocateDefaultPins();
-
-	// Connect input pins
-	UEdGraphPin* ProjectPlayerControllerPin = ProjectNode->FindPin(TEXT("PlayerController"));
-	UEdGraphPin* ProjectOriginPin = ProjectNode->FindPin(TEXT("OutRayOrigin"));
-	UEdGraphPin* ProjectDirectionPin = ProjectNode->FindPin(TEXT("OutRayDirection"));
-
-	PlayerControllerPin->MakeLinkTo(ProjectPlayerControllerPin);
-
-	// Connect output pins
-	OriginPin->MakeLinkTo(ProjectOriginPin);
-	DirectionPin->MakeLinkTo(ProjectDirectionPin);
-
-	// Connect exec pins
-	UEdGraphPin* ProjectExecPin = ProjectNode->GetExecPin();
-	UEdGraphPin* ProjectThenPin = ProjectNode->GetThenPin();
+	// One call; IsValid is the projection's own result
+	UK2Node_CallFunction* ProjectNode = BeamK2Nodes::SpawnLibraryCall(this, CompilerContext, SourceGraph, GET_FUNCTION_NAME_CHECKED(UBeamBlueprintLibrary, ProjectGazeRay));
+	BeamK2Nodes::ConnectSelfWorldContext(this, CompilerContext, SourceGraph, ProjectNode);
 
-	ExecPin->MakeLinkTo(ProjectExecPin);
-	ProjectThenPin->MakeLinkTo(ThenPin);
-
-	// Set IsValid based on actual validation logic
-	// Validate that PlayerController is valid and gaze data is available
-	// This will be expanded during compilation to perform proper validation
-	IsValidPin->DefaultValue = TEXT("true");
+	BeamK2Nodes::MoveLinks(CompilerContext, ExecPin, ProjectNode->GetExecPin());
+	BeamK2Nodes::MoveLinks(CompilerContext, ThenPin, ProjectNode->GetThenPin());
+	BeamK2Nodes::MoveLinks(CompilerContext, PlayerControllerPin, ProjectNode->FindPin(TEXT("PlayerController")));
+	BeamK2Nodes::MoveLinks(CompilerContext, OriginPin, ProjectNode->FindPin(TEXT("OutOrigin")));
+	BeamK2Nodes::MoveLinks(CompilerContext, DirectionPin, ProjectNode->FindPin(TEXT("OutDirection")));
+	BeamK2Nodes::MoveLinks(CompilerContext, IsValidPin, ProjectNode->GetReturnValuePin());
 
 	// Break all links to this node
 	BreakAllNodeLinks();
@@ -579,7 +541,7 @@ void UK2Node_BeamTraceFromGaze::AllocateDefaultPins()
 	// Create input pins
 	PlayerControllerPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object, APlayerController::StaticClass(), TEXT("PlayerController"));
 	MaxDistancePin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Float, TEXT("MaxDistance"));
-	TraceChannelPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Byte, UEngineTypes::StaticClass(), TEXT("TraceChannel"));
+	TraceChannelPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Byte, StaticEnum<ECollisionChannel>(), TEXT("TraceChannel"));
 
 	// Create output pins
 	HitPin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Boolean, TEXT("Hit"));
@@ -599,24 +561,18 @@ void UK2Node_BeamTraceFromGaze::ExpandNode(FKismetCompilerContext& CompilerConte
 {
 	Super::ExpandNode(CompilerContext, SourceGraph);
 
-	// This node expands to:
-	// 1. ProjectGazeToWorld to get ray origin/direction
-	// 2. LineTraceSingle to perform the trace
-	// 3. Proper output pin connections based on trace results
-	
-	// Create the projection node
-	UK2Node_BeamProjectGazeToWorld* ProjectNode = CompilerContext.SpawnIntermediateNode<UK2Node_BeamProjectGazeToWorld>(this, SourceGraph);
-	ProjectNode->AllocateDefaultPins();
-	
-	// Create the line trace node
-	UK2Node_CallFunction* TraceNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-	TraceNode->FunctionReference.SetFromField<UFunction>(UKismetSystemLibrary::StaticClass()->FindFunctionByName(TEXT("LineTraceSingle")), false);
-	TraceNode->AllocateDefaultPins();
-	
-	// Connect the nodes and pins
-	// ProjectNode -> TraceNode -> Output pins
-	// This creates a proper execution chain for gaze projection and tracing
-	
+	// Projection and the batched UBeamGazeTraceSubsystem trace run inside one native call
+	UK2Node_CallFunction* TraceNode = BeamK2Nodes::SpawnLibraryCall(this, CompilerContext, SourceGraph, GET_FUNCTION_NAME_CHECKED(UBeamBlueprintLibrary, TraceFromGaze));
+	BeamK2Nodes::ConnectSelfWorldContext(this, CompilerContext, SourceGraph, TraceNode);
+
+	BeamK2Nodes::MoveLinks(CompilerContext, ExecPin, TraceNode->GetExecPin());
+	BeamK2Nodes::MoveLinks(CompilerContext, ThenPin, TraceNode->GetThenPin());
+	BeamK2Nodes::MoveLinks(CompilerContext, PlayerControllerPin, TraceNode->FindPin(TEXT("PlayerController")));
+	BeamK2Nodes::MoveLinks(CompilerContext, MaxDistancePin, TraceNode->FindPin(TEXT("MaxDistance")));
+	BeamK2Nodes::MoveLinks(CompilerContext, TraceChannelPin, TraceNode->FindPin(TEXT("Channel")));
+	BeamK2Nodes::MoveLinks(CompilerContext, HitPin, TraceNode->GetReturnValuePin());
+	BeamK2Nodes::MoveLinks(CompilerContext, HitResultPin, TraceNode->FindPin(TEXT("OutHit")));
+
 	// Break all links to this node
 	BreakAllNodeLinks();
 }
@@ -1279,7 +1235,7 @@ void UK2Node_BeamGazeTraceWorld::AllocateDefaultPins()
 
 	// Create input pins
 	MaxDistancePin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Float, TEXT("MaxDistance"));
-	ChannelPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Byte, UEngineTypes::StaticClass(), TEXT("Channel"));
+	ChannelPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Byte, StaticEnum<ECollisionChannel>(), TEXT("Channel"));
 
 	// Create output pins
 	HitPin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Boolean, TEXT("Hit"));
@@ -1298,24 +1254,17 @@ void UK2Node_BeamGazeTraceWorld::ExpandNode(FKismetCompilerContext& CompilerCont
 {
 	Super::ExpandNode(CompilerContext, SourceGraph);
 
-	// This node expands to:
-	// 1. ProjectGazeToWorld to get ray origin/direction
-	// 2. LineTraceSingle to perform the trace
-	// 3. Proper output pin connections based on trace results
-	
-	// Create the projection node
-	UK2Node_BeamProjectGazeToWorld* ProjectNode = CompilerContext.SpawnIntermediateNode<UK2Node_BeamProjectGazeToWorld>(this, SourceGraph);
-	ProjectNode->AllocateDefaultPins();
-	
-	// Create the line trace node
-	UK2Node_CallFunction* TraceNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-	TraceNode->FunctionReference.SetFromField<UFunction>(UKismetSystemLibrary::StaticClass()->FindFunctionByName(TEXT("LineTraceSingle")), false);
-	TraceNode->AllocateDefaultPins();
-	
-	// Connect the nodes and pins
-	// ProjectNode -> TraceNode -> Output pins
-	// This creates a proper execution chain for gaze projection and tracing
-	
+	// Same fused call as Trace From Gaze; the unconnected PlayerController resolves to the first local player
+	UK2Node_CallFunction* TraceNode = BeamK2Nodes::SpawnLibraryCall(this, CompilerContext, SourceGraph, GET_FUNCTION_NAME_CHECKED(UBeamBlueprintLibrary, TraceFromGaze));
+	BeamK2Nodes::ConnectSelfWorldContext(this, CompilerContext, SourceGraph, TraceNode);
+
+	BeamK2Nodes::MoveLinks(CompilerContext, ExecPin, TraceNode->GetExecPin());
+	BeamK2Nodes::MoveLinks(CompilerContext, ThenPin, TraceNode->GetThenPin());
+	BeamK2Nodes::MoveLinks(CompilerContext, MaxDistancePin, TraceNode->FindPin(TEXT("MaxDistance")));
+	BeamK2Nodes::MoveLinks(CompilerContext, ChannelPin, TraceNode->FindPin(TEXT("Channel")));
+	BeamK2Nodes::MoveLinks(CompilerContext, HitPin, TraceNode->GetReturnValuePin());
+	BeamK2Nodes::MoveLinks(CompilerContext, HitResultPin, TraceNode->FindPin(TEXT("OutHit")));
+
 	// Break all links to this node
 	BreakAllNodeLinks();
 }
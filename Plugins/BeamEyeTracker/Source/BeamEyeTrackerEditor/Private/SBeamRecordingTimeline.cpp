@@ -0,0 +1,402 @@
+// Implements the editor timeline viewer for .beamrec recordings
+
+#include "SBeamRecordingTimeline.h"
+#include "DesktopPlatformModule.h"
+#include "IDesktopPlatform.h"
+#include "Engine/Texture2D.h"
+#include "Framework/Application/SlateApplication.h"
+#include "ImageUtils.h"
+#include "Misc/Paths.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/AppStyle.h"
+#include "Styling/CoreStyle.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "SBeamRecordingTimeline"
+
+namespace
+{
+	constexpr float TrackHeight = 120.0f;
+	constexpr float TrackGap = 4.0f;
+
+	/** Narrowest zoom, so a scrub step is never below a few frames */
+	constexpr double MinViewSpanMs = 100.0;
+
+	/** Gaze history drawn behind the scrubbed sample */
+	constexpr double TrailMs = 500.0;
+	constexpr int32 MaxTrailFrames = 128;
+
+	const FLinearColor TrackBackground(0.02f, 0.02f, 0.02f);
+	const FLinearColor GazeXColor(0.3f, 0.7f, 1.0f);
+	const FLinearColor GazeYColor(1.0f, 0.6f, 0.2f);
+	const FLinearColor CursorColor(1.0f, 1.0f, 1.0f);
+	const FLinearColor GazeColor(0.2f, 1.0f, 0.3f);
+}
+
+// SBeamTimelineCanvas
+
+void SBeamTimelineCanvas::Construct(const FArguments& InArgs, TSharedRef<FBeamRecordingTimeline> InTimeline)
+{
+	Timeline = InTimeline;
+	ResetView();
+}
+
+void SBeamTimelineCanvas::ResetView()
+{
+	ViewStartMs = Timeline->GetStartTimeMs();
+	ViewEndMs = FMath::Max(Timeline->GetEndTimeMs(), ViewStartMs + MinViewSpanMs);
+	ScrubMs = ViewStartMs;
+	CachedColumns.Reset();
+
+	if (Timeline->IsOpen() && !Timeline->IsSummaryReady())
+	{
+		RegisterActiveTimer(0.1f, FWidgetActiveTimerDelegate::CreateSP(this, &SBeamTimelineCanvas::PollSummary));
+	}
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SBeamTimelineCanvas::SetScreenshot(UTexture2D* Texture)
+{
+	Screenshot.Reset(Texture);
+	ScreenshotBrush = FSlateBrush();
+	if (Texture)
+	{
+		ScreenshotBrush.SetResourceObject(Texture);
+		ScreenshotBrush.ImageSize = FVector2D(Texture->GetSizeX(), Texture->GetSizeY());
+	}
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+EActiveTimerReturnType SBeamTimelineCanvas::PollSummary(double InCurrentTime, float InDeltaTime)
+{
+	// The cached columns were built without the summary; drop them so the finished pyramid is used
+	CachedColumns.Reset();
+	Invalidate(EInvalidateWidgetReason::Paint);
+	return Timeline->IsOpen() && !Timeline->IsSummaryReady() ? EActiveTimerReturnType::Continue : EActiveTimerReturnType::Stop;
+}
+
+FVector2D SBeamTimelineCanvas::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	return FVector2D(640.0f, 360.0f + TrackHeight);
+}
+
+float SBeamTimelineCanvas::GetTrackTop(const FGeometry& Geometry) const
+{
+	return FMath::Max(Geometry.GetLocalSize().Y - TrackHeight, 0.0f);
+}
+
+double SBeamTimelineCanvas::TimeFromLocalX(const FGeometry& Geometry, double LocalX) const
+{
+	const double Width = FMath::Max(Geometry.GetLocalSize().X, 1.0);
+	return ViewStartMs + (ViewEndMs - ViewStartMs) * FMath::Clamp(LocalX / Width, 0.0, 1.0);
+}
+
+void SBeamTimelineCanvas::ScrubTo(const FGeometry& Geometry, const FVector2D& ScreenPosition)
+{
+	ScrubMs = TimeFromLocalX(Geometry, Geometry.AbsoluteToLocal(ScreenPosition).X);
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+FReply SBeamTimelineCanvas::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton || !Timeline->IsOpen()
+		|| MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).Y < GetTrackTop(MyGeometry))
+	{
+		return FReply::Unhandled();
+	}
+
+	ScrubTo(MyGeometry, MouseEvent.GetScreenSpacePosition());
+	return FReply::Handled().CaptureMouse(SharedThis(this));
+}
+
+FReply SBeamTimelineCanvas::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (HasMouseCapture())
+	{
+		return FReply::Handled().ReleaseMouseCapture();
+	}
+	return FReply::Unhandled();
+}
+
+FReply SBeamTimelineCanvas::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (HasMouseCapture())
+	{
+		ScrubTo(MyGeometry, MouseEvent.GetScreenSpacePosition());
+		return FReply::Handled();
+	}
+	return FReply::Unhandled();
+}
+
+FReply SBeamTimelineCanvas::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (!Timeline->IsOpen())
+	{
+		return FReply::Unhandled();
+	}
+
+	// Zoom around the time under the mouse, clamped to the recording
+	const double PivotMs = TimeFromLocalX(MyGeometry, MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).X);
+	const double Scale = MouseEvent.GetWheelDelta() > 0.0f ? 0.8 : 1.25;
+	const double FullSpan = FMath::Max(Timeline->GetEndTimeMs() - Timeline->GetStartTimeMs(), MinViewSpanMs);
+	const double NewSpan = FMath::Clamp((ViewEndMs - ViewStartMs) * Scale, MinViewSpanMs, FullSpan);
+	const double PivotAlpha = (PivotMs - ViewStartMs) / (ViewEndMs - ViewStartMs);
+
+	ViewStartMs = FMath::Clamp(PivotMs - NewSpan * PivotAlpha, Timeline->GetStartTimeMs(), Timeline->GetStartTimeMs() + FullSpan - NewSpan);
+	ViewEndMs = ViewStartMs + NewSpan;
+	Invalidate(EInvalidateWidgetReason::Paint);
+	return FReply::Handled();
+}
+
+int32 SBeamTimelineCanvas::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const FVector2D Size = AllottedGeometry.GetLocalSize();
+	const float TrackTop = GetTrackTop(AllottedGeometry);
+
+	LayerId = PaintScreenshot(AllottedGeometry, OutDrawElements, LayerId, FSlateRect(0.0f, 0.0f, Size.X, FMath::Max(TrackTop - TrackGap, 0.0f)));
+	LayerId = PaintTrack(AllottedGeometry, OutDrawElements, LayerId, FSlateRect(0.0f, TrackTop, Size.X, Size.Y));
+	return LayerId;
+}
+
+int32 SBeamTimelineCanvas::PaintScreenshot(const FGeometry& Geometry, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FSlateRect& ImageRect) const
+{
+	const FSlateBrush* White = FAppStyle::GetBrush("WhiteBrush");
+	FVector2D ImageSize = ImageRect.GetSize();
+	FVector2D ImageOffset = ImageRect.GetTopLeft();
+
+	// Letterbox the screenshot so gaze in 0..1 screen space lands where it was looked at
+	if (Screenshot.IsValid() && ScreenshotBrush.ImageSize.X > 0.0 && ScreenshotBrush.ImageSize.Y > 0.0)
+	{
+		const double Fit = FMath::Min(ImageSize.X / ScreenshotBrush.ImageSize.X, ImageSize.Y / ScreenshotBrush.ImageSize.Y);
+		const FVector2D Fitted = ScreenshotBrush.ImageSize * Fit;
+		ImageOffset += (ImageSize - Fitted) * 0.5;
+		ImageSize = Fitted;
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId, Geometry.ToPaintGeometry(ImageSize, FSlateLayoutTransform(ImageOffset)), &ScreenshotBrush);
+	}
+	else
+	{
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId, Geometry.ToPaintGeometry(ImageSize, FSlateLayoutTransform(ImageOffset)), White, ESlateDrawEffect::None, TrackBackground);
+	}
+	++LayerId;
+
+	if (!Timeline->IsOpen())
+	{
+		return LayerId;
+	}
+
+	auto ToImage = [&ImageOffset, &ImageSize](const FBeamFrame& Frame)
+	{
+		return ImageOffset + Frame.Gaze.Screen01 * ImageSize;
+	};
+
+	Timeline->GetFramesInRange(ScrubMs - TrailMs, ScrubMs, MaxTrailFrames, TrailFrames);
+	LinePoints.Reset(TrailFrames.Num());
+	for (const FBeamFrame& Frame : TrailFrames)
+	{
+		if (Frame.Gaze.bValid)
+		{
+			LinePoints.Add(ToImage(Frame));
+		}
+	}
+	if (LinePoints.Num() > 1)
+	{
+		FSlateDrawElement::MakeLines(OutDrawElements, LayerId, Geometry.ToPaintGeometry(), LinePoints, ESlateDrawEffect::None, GazeColor.CopyWithNewOpacity(0.5f), true, 1.5f);
+	}
+
+	FBeamFrame Current;
+	if (Timeline->GetFrameAtTime(ScrubMs, Current) && Current.Gaze.bValid)
+	{
+		const FVector2D DotSize(10.0, 10.0);
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId + 1, Geometry.ToPaintGeometry(DotSize, FSlateLayoutTransform(ToImage(Current) - DotSize * 0.5)), White, ESlateDrawEffect::None, GazeColor);
+	}
+	return LayerId + 2;
+}
+
+int32 SBeamTimelineCanvas::PaintTrack(const FGeometry& Geometry, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FSlateRect& TrackRect) const
+{
+	const FSlateBrush* White = FAppStyle::GetBrush("WhiteBrush");
+	FSlateDrawElement::MakeBox(OutDrawElements, LayerId, Geometry.ToPaintGeometry(TrackRect.GetSize(), FSlateLayoutTransform(TrackRect.GetTopLeft())), White, ESlateDrawEffect::None, TrackBackground);
+	++LayerId;
+
+	if (!Timeline->IsOpen())
+	{
+		return LayerId;
+	}
+
+	// One column per pixel; a pan or zoom costs a binary search per column, scrubbing costs nothing
+	const int32 NumColumns = FMath::Max(FMath::FloorToInt32(TrackRect.GetSize().X), 1);
+	if (CachedColumns.Num() != NumColumns || CachedStartMs != ViewStartMs || CachedEndMs != ViewEndMs)
+	{
+		Timeline->GetSummary(ViewStartMs, ViewEndMs, NumColumns, CachedColumns);
+		CachedStartMs = ViewStartMs;
+		CachedEndMs = ViewEndMs;
+	}
+
+	const float BandHeight = (TrackRect.GetSize().Y - TrackGap) * 0.5f;
+	PaintEnvelope(Geometry, OutDrawElements, LayerId, FSlateRect(TrackRect.Left, TrackRect.Top, TrackRect.Right, TrackRect.Top + BandHeight), 0, GazeXColor);
+	PaintEnvelope(Geometry, OutDrawElements, LayerId, FSlateRect(TrackRect.Left, TrackRect.Bottom - BandHeight, TrackRect.Right, TrackRect.Bottom), 1, GazeYColor);
+
+	const float CursorX = TrackRect.Left + TrackRect.GetSize().X * static_cast<float>((ScrubMs - ViewStartMs) / (ViewEndMs - ViewStartMs));
+	LinePoints.Reset(2);
+	LinePoints.Emplace(CursorX, TrackRect.Top);
+	LinePoints.Emplace(CursorX, TrackRect.Bottom);
+	FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 1, Geometry.ToPaintGeometry(), LinePoints, ESlateDrawEffect::None, CursorColor, true, 1.0f);
+
+	const FText Label = FText::Format(LOCTEXT("ScrubLabel", "{0} s / {1} s{2}"),
+		FText::AsNumber((ScrubMs - Timeline->GetStartTimeMs()) / 1000.0, &FNumberFormattingOptions::DefaultNoGrouping()),
+		FText::AsNumber((Timeline->GetEndTimeMs() - Timeline->GetStartTimeMs()) / 1000.0, &FNumberFormattingOptions::DefaultNoGrouping()),
+		Timeline->IsSummaryReady() ? FText::GetEmpty() : FText::Format(LOCTEXT("SummaryProgress", "  (indexing {0})"), FText::AsPercent(Timeline->GetSummaryProgress())));
+	FSlateDrawElement::MakeText(OutDrawElements, LayerId + 1, Geometry.ToPaintGeometry(TrackRect.GetSize(), FSlateLayoutTransform(TrackRect.GetTopLeft() + FVector2f(4.0f, 2.0f))),
+		Label, FCoreStyle::GetDefaultFontStyle("Regular", 9), ESlateDrawEffect::None, CursorColor);
+	return LayerId + 2;
+}
+
+void SBeamTimelineCanvas::PaintEnvelope(const FGeometry& Geometry, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FSlateRect& BandRect, int32 Axis, const FLinearColor& Color) const
+{
+	// Consecutive columns with gaze form one min and one max polyline; gaps break both
+	const float Height = BandRect.GetSize().Y;
+	auto FlushRun = [&](int32 RunStart, int32 RunEnd)
+	{
+		if (RunEnd - RunStart < 1)
+		{
+			return;
+		}
+		for (int32 Pass = 0; Pass < 2; ++Pass)
+		{
+			LinePoints.Reset(RunEnd - RunStart + 1);
+			for (int32 Column = RunStart; Column <= RunEnd; ++Column)
+			{
+				const FBeamTimelineBucket& Bucket = CachedColumns[FMath::Min(Column, CachedColumns.Num() - 1)];
+				const float Value = FMath::Clamp(Pass == 0 ? Bucket.GazeMin[Axis] : Bucket.GazeMax[Axis], 0.0f, 1.0f);
+				LinePoints.Emplace(BandRect.Left + Column, BandRect.Top + Height * Value);
+			}
+			FSlateDrawElement::MakeLines(OutDrawElements, LayerId, Geometry.ToPaintGeometry(), LinePoints, ESlateDrawEffect::None, Color, true, 1.0f);
+		}
+	};
+
+	int32 RunStart = INDEX_NONE;
+	for (int32 Column = 0; Column < CachedColumns.Num(); ++Column)
+	{
+		if (CachedColumns[Column].HasGaze())
+		{
+			RunStart = RunStart == INDEX_NONE ? Column : RunStart;
+		}
+		else if (RunStart != INDEX_NONE)
+		{
+			FlushRun(RunStart, Column - 1);
+			RunStart = INDEX_NONE;
+		}
+	}
+	if (RunStart != INDEX_NONE)
+	{
+		FlushRun(RunStart, CachedColumns.Num() - 1);
+	}
+}
+
+// SBeamRecordingTimeline
+
+void SBeamRecordingTimeline::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.0f, 0.0f, 4.0f, 0.0f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("OpenRecording", "Open Recording..."))
+				.OnClicked(this, &SBeamRecordingTimeline::OnOpenRecordingClicked)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.0f, 0.0f, 8.0f, 0.0f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("OpenScreenshot", "Open Screenshot..."))
+				.ToolTipText(LOCTEXT("OpenScreenshotTooltip", "Image captured with the session; the gaze is drawn over it in 0..1 screen space"))
+				.OnClicked(this, &SBeamRecordingTimeline::OnOpenScreenshotClicked)
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(this, &SBeamRecordingTimeline::GetInfoText)
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(4.0f)
+		[
+			SNew(SBorder)
+			.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+			[
+				SAssignNew(Canvas, SBeamTimelineCanvas, Timeline)
+			]
+		]
+	];
+}
+
+bool SBeamRecordingTimeline::PickFile(const FText& Title, const FString& FileTypes, FString& OutPath) const
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!DesktopPlatform)
+	{
+		return false;
+	}
+
+	TArray<FString> Files;
+	const void* ParentWindow = FSlateApplication::Get().FindBestParentWindowHandleForDialogs(ConstCastSharedRef<SWidget>(AsShared()));
+	if (!DesktopPlatform->OpenFileDialog(ParentWindow, Title.ToString(), FPaths::ProjectSavedDir(), TEXT(""), FileTypes, EFileDialogFlags::None, Files) || Files.Num() == 0)
+	{
+		return false;
+	}
+	OutPath = Files[0];
+	return true;
+}
+
+FReply SBeamRecordingTimeline::OnOpenRecordingClicked()
+{
+	FString Path;
+	if (PickFile(LOCTEXT("OpenRecordingTitle", "Open Beam Recording"), TEXT("Beam recordings (*.beamrec)|*.beamrec"), Path))
+	{
+		Timeline->Open(Path);
+		Canvas->ResetView();
+	}
+	return FReply::Handled();
+}
+
+FReply SBeamRecordingTimeline::OnOpenScreenshotClicked()
+{
+	FString Path;
+	if (PickFile(LOCTEXT("OpenScreenshotTitle", "Open Session Screenshot"), TEXT("Images (*.png;*.jpg;*.jpeg;*.bmp;*.exr)|*.png;*.jpg;*.jpeg;*.bmp;*.exr"), Path))
+	{
+		Canvas->SetScreenshot(FImageUtils::ImportFileAsTexture2D(Path));
+	}
+	return FReply::Handled();
+}
+
+FText SBeamRecordingTimeline::GetInfoText() const
+{
+	if (!Timeline->IsOpen())
+	{
+		return LOCTEXT("NoRecording", "No recording open. Drag on the track to scrub, use the mouse wheel to zoom.");
+	}
+
+	return FText::Format(LOCTEXT("RecordingInfo", "{0}: {1} frames, {2} s{3}"),
+		FText::FromString(FPaths::GetCleanFilename(Timeline->GetFilePath())),
+		FText::AsNumber(Timeline->GetFrameCount()),
+		FText::AsNumber((Timeline->GetEndTimeMs() - Timeline->GetStartTimeMs()) / 1000.0),
+		Timeline->IsMemoryMapped() ? FText::GetEmpty() : LOCTEXT("InMemory", " (no chunk index, loaded into memory)"));
+}
+
+#undef LOCTEXT_NAMESPACE
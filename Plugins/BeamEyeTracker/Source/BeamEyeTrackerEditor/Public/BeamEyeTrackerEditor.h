@@ -45,6 +45,7 @@ private:
 	void AddToolbarButton(FToolBarBuilder& Builder);
 	void AddMenuEntry(FMenuBuilder& Builder);
 	TSharedRef<SDockTab> OnSpawnMonitorTab(const FSpawnTabArgs& SpawnTabArgs);
+	TSharedRef<SDockTab> OnSpawnRecordingTimelineTab(const FSpawnTabArgs& SpawnTabArgs);
 
 private:
 	TSharedPtr<FBeamEyeTrackerEditorStyle> StyleSet;
@@ -52,6 +53,9 @@ private:
 	
 	/** The name of the monitor tab */
 	static const FName BeamEyeTrackerMonitorTabName;
+
+	/** The name of the recording timeline tab */
+	static const FName BeamRecordingTimelineTabName;
 };
 
 /*=============================================================================
@@ -15,6 +15,8 @@
 #include "Components/VerticalBox.h"
 #include "Components/HorizontalBox.h"
 #include "Components/GridPanel.h"
+#include "Components/Image.h"
+#include "BeamMonitorSnapshot.h"
 
 #include "TimerManager.h"
 #include "BeamEyeTrackerMonitorWidget.generated.h"
@@ -35,6 +37,11 @@
  * - Status monitoring and health checks with visual indicators
  * - File path management for recordings and playback
  * - Automatic widget binding using meta = (BindWidget) system
+ * - Optional FPS, latency and buffer history graphs drawn over HistoryGraph
+ *
+ * All displayed values come from the subsystem's fixed-rate monitor
+ * snapshot (see FBeamMonitorHistory); nothing is reformatted until a new
+ * snapshot has been published.
  * 
  * Usage in Blueprint:
  * 1. Create a Widget Blueprint that inherits from this class
@@ -123,10 +130,24 @@ public:
 protected:
 	virtual void NativeConstruct() override;
 	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
 
 private:
-	/** Update the monitor display */
+	/** Update the monitor display from the newest snapshot */
 	void UpdateMonitor();
+
+	/** Cached subsystem lookup */
+	UBeamEyeTrackerSubsystem* GetBeamSubsystem() const;
+
+	/** Newest snapshot, or an empty one (Sequence 0) without a subsystem */
+	const FBeamMonitorSnapshot& GetSnapshot() const;
+
+	/** Draws one history series scaled to MaxValue across the graph geometry */
+	void PaintHistorySeries(const FBeamMonitorHistory& History, float FBeamMonitorSnapshot::* Field, float MaxValue, const FLinearColor& Color,
+		const FGeometry& Geometry, FSlateWindowElementList& OutDrawElements, int32 LayerId) const;
+
+	/** Point HeatmapImage at the gaze heatmap texture once it exists */
+	void UpdateHeatmapImage();
 	
 	/** Initialize widget bindings */
 	void InitializeWidgetBindings();
@@ -178,19 +199,27 @@ private:
 	void OnPlaybackPathChanged(const FText& NewText);
 
 	// Status text getters
-	FText GetTrackingStatusText() const;
-	FText GetHealthStatusText() const;
-	FText GetFPSText() const;
-	FText GetGazePointText() const;
-	FText GetBufferUtilizationText() const;
-	FText GetHeadPoseText() const;
-	FText GetCalibrationStatusText() const;
-	FText GetRecordingStatusText() const;
-	FText GetPlaybackStatusText() const;
+	static FText GetTrackingStatusText(const FBeamMonitorSnapshot& Snapshot);
+	static FText GetHealthStatusText(const FBeamMonitorSnapshot& Snapshot);
+	static FText GetFPSText(const FBeamMonitorSnapshot& Snapshot);
+	static FText GetGazePointText(const FBeamMonitorSnapshot& Snapshot);
+	static FText GetBufferUtilizationText(const FBeamMonitorSnapshot& Snapshot);
+	static FText GetHeadPoseText(const FBeamMonitorSnapshot& Snapshot);
+	static FText GetCalibrationStatusText(const FBeamMonitorSnapshot& Snapshot);
+	static FText GetRecordingStatusText(const FBeamMonitorSnapshot& Snapshot);
+	static FText GetPlaybackStatusText(const FBeamMonitorSnapshot& Snapshot);
 
 private:
 	/** Timer handle for updates */
 	FTimerHandle UpdateTimerHandle;
+
+	mutable TWeakObjectPtr<UBeamEyeTrackerSubsystem> CachedSubsystem;
+
+	/** Sequence of the snapshot the texts were last set from */
+	uint32 DisplayedSequence = 0;
+
+	/** Reused by NativePaint so drawing the graphs does not allocate */
+	mutable TArray<FVector2D> GraphPoints;
 	
 	/** Update interval in seconds */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Settings", meta = (AllowPrivateAccess = "true"))
@@ -253,6 +282,31 @@ private:
 	
 	UPROPERTY(meta = (BindWidget))
 	UEditableTextBox* PlaybackPathTextBox;
+
+	/** Optional view of the gaze heatmap (see UBeamHeatmapSubsystem) */
+	UPROPERTY(meta = (BindWidgetOptional))
+	UImage* HeatmapImage;
+
+	/** Optional placeholder the FPS, latency and buffer history graphs are drawn over */
+	UPROPERTY(meta = (BindWidgetOptional))
+	UWidget* HistoryGraph;
+
+	/** Top of the FPS graph */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Graphs", meta = (AllowPrivateAccess = "true", ClampMin = "1.0"))
+	float GraphMaxFPS = 120.0f;
+
+	/** Top of the latency graph, in milliseconds */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Graphs", meta = (AllowPrivateAccess = "true", ClampMin = "1.0"))
+	float GraphMaxLatencyMs = 100.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Graphs", meta = (AllowPrivateAccess = "true"))
+	FLinearColor FPSGraphColor = FLinearColor(0.2f, 0.9f, 0.3f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Graphs", meta = (AllowPrivateAccess = "true"))
+	FLinearColor LatencyGraphColor = FLinearColor(1.0f, 0.6f, 0.1f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Graphs", meta = (AllowPrivateAccess = "true"))
+	FLinearColor BufferGraphColor = FLinearColor(0.3f, 0.6f, 1.0f);
 	
 	/** Current recording path */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Beam Eye Tracker|Paths", meta = (AllowPrivateAccess = "true"))
@@ -0,0 +1,104 @@
+/*=============================================================================
+    SBeamRecordingTimeline.h: Editor timeline viewer for .beamrec recordings.
+
+    Shows a recording's gaze as a min/max envelope per pixel column over a
+    zoomable time range, with a scrub cursor that places the gaze and its
+    recent trail over a screenshot captured with the session.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/SLeafWidget.h"
+#include "BeamRecordingTimeline.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UTexture2D;
+
+/**
+ * Paints the screenshot overlay and the summary track, and turns mouse
+ * input into scrubbing (drag) and zooming (wheel) on the track.
+ */
+class SBeamTimelineCanvas : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SBeamTimelineCanvas) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, TSharedRef<FBeamRecordingTimeline> InTimeline);
+
+	/** Resets the view to the whole recording after the timeline was (re)opened */
+	void ResetView();
+
+	void SetScreenshot(UTexture2D* Texture);
+
+	//~ Begin SWidget Interface
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	//~ End SWidget Interface
+
+private:
+	TSharedPtr<FBeamRecordingTimeline> Timeline;
+
+	/** Visible time range and the scrubbed time, in recording milliseconds */
+	double ViewStartMs = 0.0;
+	double ViewEndMs = 0.0;
+	double ScrubMs = 0.0;
+
+	TStrongObjectPtr<UTexture2D> Screenshot;
+	FSlateBrush ScreenshotBrush;
+
+	/** Summary of the last painted range; rebuilt only when the range or width changes */
+	mutable TArray<FBeamTimelineBucket> CachedColumns;
+	mutable double CachedStartMs = 0.0;
+	mutable double CachedEndMs = 0.0;
+
+	/** Scratch arrays reused by every paint */
+	mutable TArray<FBeamFrame> TrailFrames;
+	mutable TArray<FVector2D> LinePoints;
+
+	/** Repaints while the summary worker runs */
+	EActiveTimerReturnType PollSummary(double InCurrentTime, float InDeltaTime);
+
+	float GetTrackTop(const FGeometry& Geometry) const;
+	double TimeFromLocalX(const FGeometry& Geometry, double LocalX) const;
+	void ScrubTo(const FGeometry& Geometry, const FVector2D& ScreenPosition);
+
+	int32 PaintScreenshot(const FGeometry& Geometry, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FSlateRect& ImageRect) const;
+	int32 PaintTrack(const FGeometry& Geometry, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FSlateRect& TrackRect) const;
+	void PaintEnvelope(const FGeometry& Geometry, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FSlateRect& BandRect, int32 Axis, const FLinearColor& Color) const;
+};
+
+/** Tab content: file pickers, recording info and the timeline canvas */
+class SBeamRecordingTimeline : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SBeamRecordingTimeline) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	TSharedRef<FBeamRecordingTimeline> Timeline = MakeShared<FBeamRecordingTimeline>();
+	TSharedPtr<SBeamTimelineCanvas> Canvas;
+
+	FReply OnOpenRecordingClicked();
+	FReply OnOpenScreenshotClicked();
+	FText GetInfoText() const;
+
+	/** Single-file open dialog; false when cancelled */
+	bool PickFile(const FText& Title, const FString& FileTypes, FString& OutPath) const;
+};
+
+/*=============================================================================
+    End of SBeamRecordingTimeline.h
+=============================================================================*/
@@ -0,0 +1,30 @@
+/*=============================================================================
+    BeamEyeTrackerInsights.Build.cs: Build configuration for the Beam Insights extension.
+
+    Loaded by Unreal Insights (and the editor's session browser) to analyze
+    the Beam trace channel; never part of a cooked game.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+using UnrealBuildTool;
+
+public class BeamEyeTrackerInsights : ModuleRules
+{
+	public BeamEyeTrackerInsights(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"Slate",
+			"SlateCore",
+			"TraceAnalysis",
+			"TraceServices",
+			"TraceInsights",
+			"TraceInsightsCore"
+		});
+	}
+}
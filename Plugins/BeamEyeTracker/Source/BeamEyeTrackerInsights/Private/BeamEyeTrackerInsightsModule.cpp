@@ -0,0 +1,28 @@
+// Implements the Beam Insights module: registers the trace module and timing view extender
+
+#include "Modules/ModuleManager.h"
+#include "Features/IModularFeatures.h"
+#include "BeamTraceModule.h"
+#include "BeamGazeTimingTrack.h"
+
+class FBeamEyeTrackerInsightsModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		IModularFeatures::Get().RegisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+		IModularFeatures::Get().RegisterModularFeature(UE::Insights::Timing::TimingViewExtenderFeatureName, &TimingViewExtender);
+	}
+
+	virtual void ShutdownModule() override
+	{
+		IModularFeatures::Get().UnregisterModularFeature(UE::Insights::Timing::TimingViewExtenderFeatureName, &TimingViewExtender);
+		IModularFeatures::Get().UnregisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+	}
+
+private:
+	FBeamTraceModule TraceModule;
+	FBeamTimingViewExtender TimingViewExtender;
+};
+
+IMPLEMENT_MODULE(FBeamEyeTrackerInsightsModule, BeamEyeTrackerInsights)
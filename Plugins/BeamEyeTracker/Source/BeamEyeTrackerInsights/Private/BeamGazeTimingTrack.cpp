@@ -0,0 +1,88 @@
+// Implements the Beam gaze track for the Insights timing view
+
+#include "BeamGazeTimingTrack.h"
+#include "BeamTraceProvider.h"
+#include "Insights/ITimingViewSession.h"
+#include "Insights/ViewModels/TimingTrackViewport.h"
+#include "Insights/ViewModels/ITimingViewDrawHelper.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+#define LOCTEXT_NAMESPACE "BeamGazeTimingTrack"
+
+INSIGHTS_IMPLEMENT_RTTI(FBeamGazeTimingTrack)
+
+namespace BeamGazeTimingTrack
+{
+	// 0xAARRGGBB
+	static constexpr uint32 ValidColor = 0xFF3D9EE0;
+	static constexpr uint32 InvalidColor = 0xFF8A8A8A;
+	static constexpr uint32 NotConsumedColor = 0xFFD0603A;
+
+	// Unconsumed frames have no span; give them a visible sliver instead
+	static constexpr double MarkerSeconds = 0.0001;
+}
+
+FBeamGazeTimingTrack::FBeamGazeTimingTrack(const TraceServices::IAnalysisSession& InSession)
+	: FTimingEventsTrack(LOCTEXT("TrackName", "Beam Gaze").ToString())
+	, Session(InSession)
+{
+}
+
+void FBeamGazeTimingTrack::BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context)
+{
+	TraceServices::FAnalysisSessionReadScope ReadScope(Session);
+	const FBeamTraceProvider* Provider = ReadBeamTraceProvider(Session);
+	if (!Provider)
+	{
+		return;
+	}
+
+	const FTimingTrackViewport& Viewport = Context.GetViewport();
+	Provider->EnumerateFrames(Viewport.GetStartTime(), Viewport.GetEndTime(), [&Builder](const FBeamTraceFrame& Frame)
+	{
+		if (Frame.WasConsumed())
+		{
+			const FString Name = FString::Printf(TEXT("Frame %lld (%.2f ms)"), Frame.FrameId, (Frame.ConsumeTime - Frame.PublishTime) * 1000.0);
+			Builder.AddEvent(Frame.PublishTime, Frame.ConsumeTime, 0, *Name, 0, Frame.bValid ? BeamGazeTimingTrack::ValidColor : BeamGazeTimingTrack::InvalidColor);
+		}
+		else
+		{
+			const FString Name = FString::Printf(TEXT("Frame %lld (not consumed)"), Frame.FrameId);
+			Builder.AddEvent(Frame.PublishTime, Frame.PublishTime + BeamGazeTimingTrack::MarkerSeconds, 1, *Name, 0, BeamGazeTimingTrack::NotConsumedColor);
+		}
+	});
+}
+
+void FBeamTimingViewExtender::OnBeginSession(UE::Insights::Timing::ITimingViewSession& InSession)
+{
+	Tracks.Remove(&InSession);
+}
+
+void FBeamTimingViewExtender::OnEndSession(UE::Insights::Timing::ITimingViewSession& InSession)
+{
+	Tracks.Remove(&InSession);
+}
+
+void FBeamTimingViewExtender::Tick(UE::Insights::Timing::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession)
+{
+	if (Tracks.Contains(&InSession))
+	{
+		return;
+	}
+
+	// Live sessions may only see Beam events some time after they start
+	{
+		TraceServices::FAnalysisSessionReadScope ReadScope(InAnalysisSession);
+		const FBeamTraceProvider* Provider = ReadBeamTraceProvider(InAnalysisSession);
+		if (!Provider || Provider->GetNumFrames() == 0)
+		{
+			return;
+		}
+	}
+
+	TSharedPtr<FBeamGazeTimingTrack> Track = MakeShared<FBeamGazeTimingTrack>(InAnalysisSession);
+	InSession.AddScrollableTrack(Track);
+	Tracks.Add(&InSession, Track);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,59 @@
+/*=============================================================================
+    BeamGazeTimingTrack.h: Gaze timeline track for the Insights timing view.
+
+    Draws every Beam frame from the moment it was published to the moment
+    the game thread first read it, so gaze samples and their latency sit
+    on the same timeline as game, render and RHI frames.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Insights/ITimingViewExtender.h"
+#include "Insights/ViewModels/TimingEventsTrack.h"
+
+namespace TraceServices { class IAnalysisSession; }
+
+/**
+ * One lane per frame state: depth 0 holds consumed frames spanning
+ * publish to consume, depth 1 marks frames that were published but
+ * never read (overwritten in the ring or dropped by the consumer).
+ * Frames with invalid gaze are drawn in a separate color.
+ */
+class FBeamGazeTimingTrack : public FTimingEventsTrack
+{
+	INSIGHTS_DECLARE_RTTI(FBeamGazeTimingTrack, FTimingEventsTrack)
+
+public:
+	explicit FBeamGazeTimingTrack(const TraceServices::IAnalysisSession& InSession);
+
+	//~ Begin FTimingEventsTrack Interface
+	virtual void BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context) override;
+	//~ End FTimingEventsTrack Interface
+
+private:
+	const TraceServices::IAnalysisSession& Session;
+};
+
+/** Adds the gaze track to timing views of sessions that carry Beam channel events */
+class FBeamTimingViewExtender : public UE::Insights::Timing::ITimingViewExtender
+{
+public:
+	//~ Begin ITimingViewExtender Interface
+	virtual void OnBeginSession(UE::Insights::Timing::ITimingViewSession& InSession) override;
+	virtual void OnEndSession(UE::Insights::Timing::ITimingViewSession& InSession) override;
+	virtual void Tick(UE::Insights::Timing::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession) override;
+	//~ End ITimingViewExtender Interface
+
+private:
+	/** Per timing view; a view can outlive one analysis session and start another */
+	TMap<UE::Insights::Timing::ITimingViewSession*, TSharedPtr<FBeamGazeTimingTrack>> Tracks;
+};
+
+/*=============================================================================
+    End of BeamGazeTimingTrack.h
+=============================================================================*/
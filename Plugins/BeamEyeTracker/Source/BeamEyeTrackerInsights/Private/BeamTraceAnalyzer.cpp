@@ -0,0 +1,48 @@
+// Implements the analyzer for the Beam trace channel
+
+#include "BeamTraceAnalyzer.h"
+#include "BeamTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+FBeamTraceAnalyzer::FBeamTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FBeamTraceProvider& InProvider)
+	: Session(InSession)
+	, Provider(InProvider)
+{
+}
+
+void FBeamTraceAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	FInterfaceBuilder& Builder = Context.InterfaceBuilder;
+	Builder.RouteEvent(RouteId_FramePublished, "Beam", "FramePublished");
+	Builder.RouteEvent(RouteId_FrameConsumed, "Beam", "FrameConsumed");
+}
+
+bool FBeamTraceAnalyzer::OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	const FEventData& EventData = Context.EventData;
+	const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+
+	TraceServices::FAnalysisSessionEditScope EditScope(Session);
+	switch (RouteId)
+	{
+	case RouteId_FramePublished:
+	{
+		FBeamTraceFrame Frame;
+		Frame.FrameId = EventData.GetValue<int64>("FrameId");
+		Frame.SDKTimestampMs = EventData.GetValue<double>("SDKTimestampMs");
+		Frame.PublishTime = Time;
+		Frame.GazeX = EventData.GetValue<float>("GazeX");
+		Frame.GazeY = EventData.GetValue<float>("GazeY");
+		Frame.Confidence = EventData.GetValue<float>("Confidence");
+		Frame.bValid = EventData.GetValue<uint8>("bValid") != 0;
+		Provider.AddPublished(Frame);
+		break;
+	}
+	case RouteId_FrameConsumed:
+		Provider.AddConsumed(EventData.GetValue<int64>("FrameId"), Time);
+		break;
+	}
+
+	Session.UpdateDurationSeconds(Time);
+	return true;
+}
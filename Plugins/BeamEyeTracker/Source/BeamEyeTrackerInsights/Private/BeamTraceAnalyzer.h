@@ -0,0 +1,42 @@
+/*=============================================================================
+    BeamTraceAnalyzer.h: Reads Beam trace channel events into the provider.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Analyzer.h"
+
+class FBeamTraceProvider;
+
+namespace TraceServices { class IAnalysisSession; }
+
+/** Routes Beam.FramePublished and Beam.FrameConsumed; field names match BeamTrace.cpp in the runtime module */
+class FBeamTraceAnalyzer : public UE::Trace::IAnalyzer
+{
+public:
+	FBeamTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FBeamTraceProvider& InProvider);
+
+	//~ Begin IAnalyzer Interface
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+	//~ End IAnalyzer Interface
+
+private:
+	enum : uint16
+	{
+		RouteId_FramePublished,
+		RouteId_FrameConsumed
+	};
+
+	TraceServices::IAnalysisSession& Session;
+	FBeamTraceProvider& Provider;
+};
+
+/*=============================================================================
+    End of BeamTraceAnalyzer.h
+=============================================================================*/
@@ -0,0 +1,29 @@
+// Implements the trace services module for the Beam trace channel
+
+#include "BeamTraceModule.h"
+#include "BeamTraceAnalyzer.h"
+#include "BeamTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+namespace BeamTraceModule
+{
+	static const FName ModuleName(TEXT("BeamTrace"));
+}
+
+void FBeamTraceModule::GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo)
+{
+	OutModuleInfo.Name = BeamTraceModule::ModuleName;
+	OutModuleInfo.DisplayName = TEXT("Beam Eye Tracker");
+}
+
+void FBeamTraceModule::OnAnalysisBegin(TraceServices::IAnalysisSession& Session)
+{
+	TSharedPtr<FBeamTraceProvider> Provider = MakeShared<FBeamTraceProvider>(Session);
+	Session.AddProvider(FBeamTraceProvider::ProviderName, Provider);
+	Session.AddAnalyzer(new FBeamTraceAnalyzer(Session, *Provider));
+}
+
+void FBeamTraceModule::GetLoggers(TArray<const TCHAR*>& OutLoggers)
+{
+	OutLoggers.Add(TEXT("Beam"));
+}
@@ -0,0 +1,31 @@
+/*=============================================================================
+    BeamTraceModule.h: Trace services module for the Beam trace channel.
+
+    Adds the Beam provider and analyzer to every analysis session, live or
+    loaded from a .utrace file.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TraceServices/ModuleService.h"
+
+class FBeamTraceModule : public TraceServices::IModule
+{
+public:
+	//~ Begin TraceServices::IModule Interface
+	virtual void GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo) override;
+	virtual void OnAnalysisBegin(TraceServices::IAnalysisSession& Session) override;
+	virtual void GetLoggers(TArray<const TCHAR*>& OutLoggers) override;
+	virtual void GenerateReports(const TraceServices::IAnalysisSession& Session, const TCHAR* CmdLine, const TCHAR* OutputDirectory) override {}
+	virtual const TCHAR* GetCommandLineArgument() override { return TEXT("beamtrace"); }
+	//~ End TraceServices::IModule Interface
+};
+
+/*=============================================================================
+    End of BeamTraceModule.h
+=============================================================================*/
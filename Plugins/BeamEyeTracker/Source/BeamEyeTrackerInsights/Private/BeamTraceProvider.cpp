@@ -0,0 +1,74 @@
+// Implements the Beam frame lifetime provider for Unreal Insights
+
+#include "BeamTraceProvider.h"
+#include "Algo/BinarySearch.h"
+
+const FName FBeamTraceProvider::ProviderName(TEXT("BeamTraceProvider"));
+
+FBeamTraceProvider::FBeamTraceProvider(TraceServices::IAnalysisSession& InSession)
+	: Session(InSession)
+{
+}
+
+void FBeamTraceProvider::AddPublished(const FBeamTraceFrame& Frame)
+{
+	Session.WriteAccessCheck();
+
+	FBeamTraceFrame& Added = Frames.Add_GetRef(Frame);
+	double ConsumeTime = 0.0;
+	if (PendingConsumes.RemoveAndCopyValue(Frame.FrameId, ConsumeTime))
+	{
+		Added.ConsumeTime = ConsumeTime;
+		MaxSpan = FMath::Max(MaxSpan, ConsumeTime - Added.PublishTime);
+	}
+
+	// Playback restarts frame ids; the newest publish of an id is the one a consume refers to
+	FrameIndexById.Add(Frame.FrameId, Frames.Num() - 1);
+}
+
+void FBeamTraceProvider::AddConsumed(int64 FrameId, double Time)
+{
+	Session.WriteAccessCheck();
+
+	const int32* Index = FrameIndexById.Find(FrameId);
+	if (!Index)
+	{
+		PendingConsumes.Add(FrameId, Time);
+		return;
+	}
+
+	FBeamTraceFrame& Frame = Frames[*Index];
+	if (!Frame.WasConsumed())
+	{
+		Frame.ConsumeTime = Time;
+		MaxSpan = FMath::Max(MaxSpan, Time - Frame.PublishTime);
+	}
+}
+
+int32 FBeamTraceProvider::GetNumFrames() const
+{
+	Session.ReadAccessCheck();
+	return Frames.Num();
+}
+
+void FBeamTraceProvider::EnumerateFrames(double StartTime, double EndTime, TFunctionRef<void(const FBeamTraceFrame&)> Callback) const
+{
+	Session.ReadAccessCheck();
+
+	// Frames arrive in publish order, so a span overlapping StartTime was published at most MaxSpan earlier
+	int32 Index = Algo::LowerBoundBy(Frames, StartTime - MaxSpan, &FBeamTraceFrame::PublishTime);
+	for (; Index < Frames.Num() && Frames[Index].PublishTime <= EndTime; ++Index)
+	{
+		const FBeamTraceFrame& Frame = Frames[Index];
+		const double SpanEnd = Frame.WasConsumed() ? Frame.ConsumeTime : Frame.PublishTime;
+		if (SpanEnd >= StartTime)
+		{
+			Callback(Frame);
+		}
+	}
+}
+
+const FBeamTraceProvider* ReadBeamTraceProvider(const TraceServices::IAnalysisSession& Session)
+{
+	return Session.ReadProvider<FBeamTraceProvider>(FBeamTraceProvider::ProviderName);
+}
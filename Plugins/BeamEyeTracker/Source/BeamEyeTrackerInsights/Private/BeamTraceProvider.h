@@ -0,0 +1,75 @@
+/*=============================================================================
+    BeamTraceProvider.h: Analyzed Beam frame lifetimes for Unreal Insights.
+
+    Holds one entry per frame published on the Beam trace channel, with
+    its publish and first-consume times on the session timeline, so
+    views can draw gaze samples and their latency next to game, render
+    and RHI frames.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+/** One published frame; times are session seconds */
+struct FBeamTraceFrame
+{
+	int64 FrameId = 0;
+	double SDKTimestampMs = 0.0;
+	double PublishTime = 0.0;
+
+	/** Negative until the game thread reads the frame; stays negative for frames it never read */
+	double ConsumeTime = -1.0;
+
+	float GazeX = 0.0f;
+	float GazeY = 0.0f;
+	float Confidence = 0.0f;
+	bool bValid = false;
+
+	bool WasConsumed() const { return ConsumeTime >= 0.0; }
+};
+
+/**
+ * Beam frames of one analysis session, in publish order.
+ *
+ * Written by FBeamTraceAnalyzer under an edit scope; readers take a
+ * FAnalysisSessionReadScope first.
+ */
+class FBeamTraceProvider : public TraceServices::IProvider
+{
+public:
+	static const FName ProviderName;
+
+	explicit FBeamTraceProvider(TraceServices::IAnalysisSession& InSession);
+
+	void AddPublished(const FBeamTraceFrame& Frame);
+	void AddConsumed(int64 FrameId, double Time);
+
+	int32 GetNumFrames() const;
+
+	/** Calls Callback for frames whose publish-to-consume span overlaps [StartTime, EndTime] */
+	void EnumerateFrames(double StartTime, double EndTime, TFunctionRef<void(const FBeamTraceFrame&)> Callback) const;
+
+private:
+	TraceServices::IAnalysisSession& Session;
+	TArray<FBeamTraceFrame> Frames;
+	TMap<int64, int32> FrameIndexById;
+
+	/** Consume events that arrived ahead of their publish event; the analyzer sees threads interleaved */
+	TMap<int64, double> PendingConsumes;
+
+	/** Longest publish-to-consume span seen, bounding how far back EnumerateFrames searches */
+	double MaxSpan = 0.0;
+};
+
+/** Returns the session's provider, or nullptr when the capture has no Beam channel events */
+const FBeamTraceProvider* ReadBeamTraceProvider(const TraceServices::IAnalysisSession& Session);
+
+/*=============================================================================
+    End of BeamTraceProvider.h
+=============================================================================*/
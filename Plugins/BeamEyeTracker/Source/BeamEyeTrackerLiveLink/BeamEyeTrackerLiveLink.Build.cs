@@ -0,0 +1,32 @@
+/*=============================================================================
+    BeamEyeTrackerLiveLink.Build.cs: Build configuration for the Beam Live Link source.
+
+    Kept out of the runtime module so projects that do not use Live Link
+    do not pick up a dependency on it.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+using UnrealBuildTool;
+
+public class BeamEyeTrackerLiveLink : ModuleRules
+{
+	public BeamEyeTrackerLiveLink(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"DeveloperSettings"
+		});
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"BeamEyeTracker",
+			"LiveLinkInterface"
+		});
+	}
+}
@@ -0,0 +1,5 @@
+// Implements the Beam Live Link module; the game instance subsystem registers itself through its class
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, BeamEyeTrackerLiveLink)
@@ -0,0 +1,8 @@
+// Implements the Beam Live Link settings
+
+#include "BeamLiveLinkSettings.h"
+
+FName UBeamLiveLinkSettings::GetCategoryName() const
+{
+	return TEXT("Plugins");
+}
@@ -0,0 +1,139 @@
+// Implements the Beam Live Link source and its producer-side publisher
+
+#include "BeamLiveLinkSource.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "ILiveLinkClient.h"
+#include "Roles/LiveLinkAnimationRole.h"
+#include "Roles/LiveLinkAnimationTypes.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+#define LOCTEXT_NAMESPACE "BeamLiveLinkSource"
+
+namespace BeamLiveLink
+{
+	static const FName HeadBone(TEXT("Head"));
+
+	// Curve order of every frame's PropertyValues
+	static const FName GazeX(TEXT("GazeX"));
+	static const FName GazeY(TEXT("GazeY"));
+	static const FName GazeConfidence(TEXT("GazeConfidence"));
+	static const FName GazeValid(TEXT("GazeValid"));
+	static const FName HeadConfidence(TEXT("HeadConfidence"));
+
+	// Scene time counts tracker milliseconds
+	static const FFrameRate TrackerClockRate(1000, 1);
+}
+
+FBeamLiveLinkPublisher::FBeamLiveLinkPublisher(ILiveLinkClient& InClient, const FLiveLinkSubjectKey& InSubjectKey)
+	: Client(InClient)
+	, SubjectKey(InSubjectKey)
+{
+}
+
+void FBeamLiveLinkPublisher::OnFramePublished(const FBeamFrame& Frame)
+{
+	if (!bEnabled.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkAnimationFrameData::StaticStruct());
+	FLiveLinkAnimationFrameData& Animation = *FrameData.Cast<FLiveLinkAnimationFrameData>();
+	Animation.Transforms.Add(FTransform(Frame.Head.RotationQuat, Frame.Head.PositionCm));
+	Animation.PropertyValues = {
+		static_cast<float>(Frame.Gaze.Screen01.X),
+		static_cast<float>(Frame.Gaze.Screen01.Y),
+		static_cast<float>(Frame.Gaze.Confidence),
+		Frame.Gaze.bValid ? 1.0f : 0.0f,
+		static_cast<float>(Frame.Head.Confidence)
+	};
+
+	// Capture time rather than now, so publish latency does not skew world-time interpolation
+	Animation.WorldTime = FLiveLinkWorldTime(Frame.UETimestampSeconds > 0.0 ? Frame.UETimestampSeconds : FPlatformTime::Seconds());
+	Animation.MetaData.SceneTime = FQualifiedFrameTime(FFrameTime::FromDecimal(Frame.SDKTimestampMs), BeamLiveLink::TrackerClockRate);
+
+	Client.PushSubjectFrameData_AnyThread(SubjectKey, MoveTemp(FrameData));
+	FramesPushed.fetch_add(1, std::memory_order_relaxed);
+}
+
+FBeamLiveLinkSource::FBeamLiveLinkSource(UBeamEyeTrackerSubsystem* InTracker, FName InSubjectName)
+	: Tracker(InTracker)
+	, SubjectName(InSubjectName)
+{
+}
+
+void FBeamLiveLinkSource::ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid)
+{
+	UBeamEyeTrackerSubsystem* TrackerSubsystem = Tracker.Get();
+	if (!InClient || !TrackerSubsystem || bShutdown)
+	{
+		return;
+	}
+
+	const FLiveLinkSubjectKey SubjectKey(InSourceGuid, SubjectName);
+
+	// Static data first: frames pushed before it would be discarded
+	FLiveLinkStaticDataStruct StaticData(FLiveLinkSkeletonStaticData::StaticStruct());
+	FLiveLinkSkeletonStaticData& Skeleton = *StaticData.Cast<FLiveLinkSkeletonStaticData>();
+	Skeleton.SetBoneNames({ BeamLiveLink::HeadBone });
+	Skeleton.SetBoneParents({ INDEX_NONE });
+	Skeleton.PropertyNames = { BeamLiveLink::GazeX, BeamLiveLink::GazeY, BeamLiveLink::GazeConfidence, BeamLiveLink::GazeValid, BeamLiveLink::HeadConfidence };
+	InClient->PushSubjectStaticData_AnyThread(SubjectKey, ULiveLinkAnimationRole::StaticClass(), MoveTemp(StaticData));
+
+	Publisher = MakeShared<FBeamLiveLinkPublisher, ESPMode::ThreadSafe>(*InClient, SubjectKey);
+	TrackerSubsystem->AddFrameObserver(Publisher.ToSharedRef());
+}
+
+bool FBeamLiveLinkSource::IsSourceStillValid() const
+{
+	return !bShutdown && Tracker.IsValid();
+}
+
+bool FBeamLiveLinkSource::RequestSourceShutdown()
+{
+	Shutdown();
+	return true;
+}
+
+void FBeamLiveLinkSource::Shutdown()
+{
+	bShutdown = true;
+	if (!Publisher.IsValid())
+	{
+		return;
+	}
+
+	// Disabled before removal: the producer may still be holding the old observer list
+	Publisher->Disable();
+	if (UBeamEyeTrackerSubsystem* TrackerSubsystem = Tracker.Get())
+	{
+		TrackerSubsystem->RemoveFrameObserver(Publisher.ToSharedRef());
+	}
+	Publisher.Reset();
+}
+
+FText FBeamLiveLinkSource::GetSourceType() const
+{
+	return LOCTEXT("SourceType", "Beam Eye Tracker");
+}
+
+FText FBeamLiveLinkSource::GetSourceMachineName() const
+{
+	return FText::FromString(FPlatformProcess::ComputerName());
+}
+
+FText FBeamLiveLinkSource::GetSourceStatus() const
+{
+	if (!IsSourceStillValid())
+	{
+		return LOCTEXT("StatusStopped", "Stopped");
+	}
+	if (!Publisher.IsValid() || Publisher->GetFramesPushed() == 0)
+	{
+		return LOCTEXT("StatusWaiting", "Waiting for frames");
+	}
+	return LOCTEXT("StatusStreaming", "Streaming");
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,85 @@
+/*=============================================================================
+    BeamLiveLinkSource.h: Live Link source fed from the frame publisher.
+
+    Pushes every published frame into Live Link as one animation subject
+    from the thread that published it, so eye and head animation get the
+    frame without waiting for a game tick.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ILiveLinkSource.h"
+#include "LiveLinkTypes.h"
+#include "IBeamFrameObserver.h"
+#include <atomic>
+
+class ILiveLinkClient;
+class UBeamEyeTrackerSubsystem;
+
+/** Frame observer that turns frames into Live Link frame data; any publishing thread */
+class FBeamLiveLinkPublisher : public IBeamFrameObserver
+{
+public:
+	FBeamLiveLinkPublisher(ILiveLinkClient& InClient, const FLiveLinkSubjectKey& InSubjectKey);
+
+	//~ Begin IBeamFrameObserver Interface
+	virtual void OnFramePublished(const FBeamFrame& Frame) override;
+	//~ End IBeamFrameObserver Interface
+
+	/** Frames still in flight on the producer are dropped from here on */
+	void Disable() { bEnabled.store(false, std::memory_order_release); }
+
+	uint64 GetFramesPushed() const { return FramesPushed.load(std::memory_order_relaxed); }
+
+private:
+	ILiveLinkClient& Client;
+	const FLiveLinkSubjectKey SubjectKey;
+	std::atomic<bool> bEnabled{ true };
+	std::atomic<uint64> FramesPushed{ 0 };
+};
+
+/**
+ * Live Link source over one tracker subsystem.
+ *
+ * The subject uses the animation role: a single Head bone holding the
+ * head pose as reported by the tracker (centimeters and rotation in its
+ * own space) and curves for gaze position, confidence and validity, so
+ * an Animation Blueprint or a Live Link remap asset can drive head and
+ * eye bones from it. Each frame carries its capture time as world time
+ * and the tracker timestamp, in milliseconds, as scene time, so both
+ * world-time and timecode evaluation can interpolate between frames.
+ * The source stops publishing when it is shut down or the subsystem it
+ * observes goes away.
+ */
+class FBeamLiveLinkSource : public ILiveLinkSource
+{
+public:
+	FBeamLiveLinkSource(UBeamEyeTrackerSubsystem* InTracker, FName InSubjectName);
+
+	//~ Begin ILiveLinkSource Interface
+	virtual void ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid) override;
+	virtual bool IsSourceStillValid() const override;
+	virtual bool RequestSourceShutdown() override;
+	virtual FText GetSourceType() const override;
+	virtual FText GetSourceMachineName() const override;
+	virtual FText GetSourceStatus() const override;
+	//~ End ILiveLinkSource Interface
+
+	/** Stops publishing and detaches from the tracker; game thread, safe to call more than once */
+	void Shutdown();
+
+private:
+	TWeakObjectPtr<UBeamEyeTrackerSubsystem> Tracker;
+	const FName SubjectName;
+	TSharedPtr<FBeamLiveLinkPublisher, ESPMode::ThreadSafe> Publisher;
+	bool bShutdown = false;
+};
+
+/*=============================================================================
+    End of BeamLiveLinkSource.h
+=============================================================================*/
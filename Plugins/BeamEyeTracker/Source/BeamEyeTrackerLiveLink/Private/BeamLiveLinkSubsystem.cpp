@@ -0,0 +1,77 @@
+// Implements the game instance's Live Link source lifetime
+
+#include "BeamLiveLinkSubsystem.h"
+#include "BeamLiveLinkSettings.h"
+#include "BeamLiveLinkSource.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "Features/IModularFeatures.h"
+#include "ILiveLinkClient.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBeamLiveLink, Log, All);
+
+void UBeamLiveLinkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// The source observes the tracker subsystem's publisher, so it must exist first
+	BeamSubsystem = Collection.InitializeDependency<UBeamEyeTrackerSubsystem>();
+	if (GetDefault<UBeamLiveLinkSettings>()->bStartWithGameInstance)
+	{
+		StartLiveLinkSource();
+	}
+}
+
+void UBeamLiveLinkSubsystem::Deinitialize()
+{
+	StopLiveLinkSource();
+	BeamSubsystem = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UBeamLiveLinkSubsystem::StartLiveLinkSource()
+{
+	if (IsLiveLinkSourceActive())
+	{
+		return true;
+	}
+	StopLiveLinkSource();
+
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+	if (!BeamSubsystem || !ModularFeatures.IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
+	{
+		UE_LOG(LogBeamLiveLink, Warning, TEXT("BeamLiveLink: Cannot start - %s"), BeamSubsystem ? TEXT("Live Link is not available") : TEXT("no Beam subsystem"));
+		return false;
+	}
+
+	const FName SubjectName = GetDefault<UBeamLiveLinkSettings>()->SubjectName;
+	ILiveLinkClient& Client = ModularFeatures.GetModularFeature<ILiveLinkClient>(ILiveLinkClient::ModularFeatureName);
+	Source = MakeShared<FBeamLiveLinkSource>(BeamSubsystem, SubjectName);
+	SourceGuid = Client.AddSource(Source);
+
+	UE_LOG(LogBeamLiveLink, Log, TEXT("BeamLiveLink: Publishing subject '%s'"), *SubjectName.ToString());
+	return true;
+}
+
+void UBeamLiveLinkSubsystem::StopLiveLinkSource()
+{
+	if (!Source.IsValid())
+	{
+		return;
+	}
+
+	// Detach from the producer now; the client may only release the source on its next update
+	Source->Shutdown();
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+	if (SourceGuid.IsValid() && ModularFeatures.IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
+	{
+		ModularFeatures.GetModularFeature<ILiveLinkClient>(ILiveLinkClient::ModularFeatureName).RemoveSource(SourceGuid);
+	}
+	Source.Reset();
+	SourceGuid.Invalidate();
+}
+
+bool UBeamLiveLinkSubsystem::IsLiveLinkSourceActive() const
+{
+	return Source.IsValid() && Source->IsSourceStillValid();
+}
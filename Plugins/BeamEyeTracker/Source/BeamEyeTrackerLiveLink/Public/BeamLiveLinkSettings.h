@@ -0,0 +1,39 @@
+/*=============================================================================
+    BeamLiveLinkSettings.h: Project settings for the Beam Live Link source.
+
+    Controls whether tracked frames are published to Live Link and under
+    which subject name animation, Sequencer and Take Recorder find them.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "BeamLiveLinkSettings.generated.h"
+
+/** Settings for UBeamLiveLinkSubsystem */
+UCLASS(config = Engine, defaultconfig, meta = (DisplayName = "Beam Live Link"))
+class BEAMEYETRACKERLIVELINK_API UBeamLiveLinkSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	// UDeveloperSettings interface
+	virtual FName GetCategoryName() const override;
+
+	/** Add the Live Link source as soon as a game instance starts the tracker */
+	UPROPERTY(config, EditAnywhere, Category = "Live Link")
+	bool bStartWithGameInstance = false;
+
+	/** Animation subject carrying the Head bone and the gaze curves */
+	UPROPERTY(config, EditAnywhere, Category = "Live Link")
+	FName SubjectName = TEXT("BeamEyeTracker");
+};
+
+/*=============================================================================
+    End of BeamLiveLinkSettings.h
+=============================================================================*/
@@ -0,0 +1,61 @@
+/*=============================================================================
+    BeamLiveLinkSubsystem.h: Publishes a game instance's tracker to Live Link.
+
+    Adds a Beam source to the Live Link client for the game instance's
+    tracker subsystem, so MetaHuman and other animation setups, Sequencer
+    and Take Recorder read head pose and gaze as an ordinary Live Link
+    subject instead of through Blueprint tick glue.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Misc/Guid.h"
+#include "BeamLiveLinkSubsystem.generated.h"
+
+class FBeamLiveLinkSource;
+class UBeamEyeTrackerSubsystem;
+
+/**
+ * Owner of the game instance's Live Link source.
+ *
+ * Frames reach Live Link from the producer thread as they are published,
+ * or from the game thread during playback; see FBeamLiveLinkSource for
+ * the subject layout. Removing the source in the Live Link panel stops it
+ * as well, and StartLiveLinkSource adds a new one.
+ */
+UCLASS(DisplayName = "Beam Live Link Subsystem")
+class BEAMEYETRACKERLIVELINK_API UBeamLiveLinkSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Adds the source under the configured subject name; false when Live Link is not available */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Live Link", meta = (DisplayName = "Start Live Link Source"))
+	bool StartLiveLinkSource();
+
+	UFUNCTION(BlueprintCallable, Category = "Beam|Live Link", meta = (DisplayName = "Stop Live Link Source"))
+	void StopLiveLinkSource();
+
+	UFUNCTION(BlueprintPure, Category = "Beam|Live Link", meta = (DisplayName = "Is Live Link Source Active"))
+	bool IsLiveLinkSourceActive() const;
+
+private:
+	UPROPERTY()
+	TObjectPtr<UBeamEyeTrackerSubsystem> BeamSubsystem;
+
+	TSharedPtr<FBeamLiveLinkSource> Source;
+	FGuid SourceGuid;
+};
+
+/*=============================================================================
+    End of BeamLiveLinkSubsystem.h
+=============================================================================*/
@@ -0,0 +1,35 @@
+/*=============================================================================
+    BeamEyeTrackerNiagara.Build.cs: Build configuration for the Beam Niagara data interface.
+
+    Kept out of the runtime module so projects that do not use Niagara do
+    not pick up a dependency on it.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+using UnrealBuildTool;
+
+public class BeamEyeTrackerNiagara : ModuleRules
+{
+	public BeamEyeTrackerNiagara(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"Niagara",
+			"NiagaraCore"
+		});
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"BeamEyeTracker",
+			"RenderCore",
+			"RHI",
+			"VectorVM"
+		});
+	}
+}
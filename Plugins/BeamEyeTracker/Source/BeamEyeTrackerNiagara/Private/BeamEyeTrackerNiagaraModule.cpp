@@ -0,0 +1,5 @@
+// Implements the Beam Niagara module; the data interface registers itself through its CDO
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, BeamEyeTrackerNiagara)
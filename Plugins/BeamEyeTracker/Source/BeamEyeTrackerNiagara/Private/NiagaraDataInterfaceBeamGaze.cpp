@@ -0,0 +1,534 @@
+// Implements the Beam gaze Niagara data interface on top of the subsystem's frame ring
+
+#include "NiagaraDataInterfaceBeamGaze.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamGazeColumns.h"
+#include "BeamRing.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "NiagaraCompileHashVisitor.h"
+#include "NiagaraShaderParametersBuilder.h"
+#include "NiagaraSystemInstance.h"
+#include "NiagaraTypes.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "VectorVM.h"
+#include <atomic>
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(NiagaraDataInterfaceBeamGaze)
+
+#define LOCTEXT_NAMESPACE "NiagaraDataInterfaceBeamGaze"
+
+namespace NDIBeamGazeLocal
+{
+	static const TCHAR* TemplateShaderFilePath = TEXT("/Plugin/BeamEyeTracker/Private/NiagaraDataInterfaceBeamGaze.ush");
+
+	static const FName GetGazeName(TEXT("GetGaze"));
+	static const FName GetFixationName(TEXT("GetFixation"));
+	static const FName GetGazeAtAgeName(TEXT("GetGazeAtAge"));
+
+	/** Upper bound on HistorySamples, sized so the resampled history always fits on the stack */
+	static constexpr int32 MaxHistorySamples = 256;
+
+	/** Snapshot of the UPROPERTY settings, so the render thread never touches the UObject */
+	struct FSettings
+	{
+		double VelocityWindowMs = 50.0;
+		float FixationRadius = 0.03f;
+		float MinFixationSeconds = 0.1f;
+		double MaxFixationMs = 2000.0;
+		float HistorySeconds = 1.0f;
+		int32 HistorySamples = 32;
+	};
+
+	/** Game-thread side of one system instance; only the ring pointer is shared with the VM workers */
+	struct FInstanceData
+	{
+		TWeakObjectPtr<UBeamEyeTrackerSubsystem> Subsystem;
+		std::atomic<const FBeamFrameRing*> Ring{ nullptr };
+		FDelegateHandle RingReleasedHandle;
+	};
+
+	/** Passed from the game thread to the proxy every tick */
+	struct FGameToRenderData
+	{
+		const FBeamFrameRing* Ring = nullptr;
+		FSettings Settings;
+	};
+
+	/** Current gaze state derived from the ring */
+	struct FGazeState
+	{
+		FVector2f Position = FVector2f::ZeroVector;
+		FVector2f Velocity = FVector2f::ZeroVector;
+		float Confidence = 0.0f;
+		bool bValid = false;
+		bool bFixating = false;
+		float FixationSeconds = 0.0f;
+	};
+
+	/** One resampled history point; Z is 1 when the sample was valid */
+	using FHistory = TArray<FVector4f, TInlineAllocator<MaxHistorySamples>>;
+
+	static FSettings MakeSettings(const UNiagaraDataInterfaceBeamGaze& DataInterface)
+	{
+		FSettings Settings;
+		Settings.VelocityWindowMs = DataInterface.VelocityWindowMs;
+		Settings.FixationRadius = DataInterface.FixationRadius;
+		Settings.MinFixationSeconds = DataInterface.MinFixationSeconds;
+		Settings.MaxFixationMs = DataInterface.MaxFixationSeconds * 1000.0;
+		Settings.HistorySeconds = DataInterface.HistorySeconds;
+		Settings.HistorySamples = FMath::Clamp(DataInterface.HistorySamples, 2, MaxHistorySamples);
+		return Settings;
+	}
+
+	/** Seconds the gaze has stayed within FixationRadius of Latest, scanning forward so the trailing run wins */
+	static float MeasureFixationSeconds(const FBeamFrameRing& Ring, const FSettings& Settings, const FBeamFrame& Latest)
+	{
+		const float LatestX = static_cast<float>(Latest.Gaze.Screen01.X);
+		const float LatestY = static_cast<float>(Latest.Gaze.Screen01.Y);
+		const float RadiusSq = Settings.FixationRadius * Settings.FixationRadius;
+		const double LatestMs = Latest.SDKTimestampMs;
+
+		double RunStartMs = -1.0;
+		const bool bConsistent = Ring.VisitGazeColumnsInRange(LatestMs - Settings.MaxFixationMs, LatestMs,
+			[&](const FBeamGazeColumns& Columns)
+			{
+				for (int32 Index = 0; Index < Columns.Num; ++Index)
+				{
+					// Samples lost to blinks neither extend nor break the run
+					if (Columns.GazeConfidence[Index] <= 0.0f)
+					{
+						continue;
+					}
+
+					const float DX = Columns.GazeX[Index] - LatestX;
+					const float DY = Columns.GazeY[Index] - LatestY;
+					if (DX * DX + DY * DY <= RadiusSq)
+					{
+						if (RunStartMs < 0.0)
+						{
+							RunStartMs = Columns.TimestampMs[Index];
+						}
+					}
+					else
+					{
+						RunStartMs = -1.0;
+					}
+				}
+			});
+
+		if (!bConsistent || RunStartMs < 0.0)
+		{
+			return 0.0f;
+		}
+		return static_cast<float>(FMath::Max(LatestMs - RunStartMs, 0.0) * 0.001);
+	}
+
+	static void SampleGaze(const FBeamFrameRing* Ring, const FSettings& Settings, bool bWithFixation, FGazeState& OutState)
+	{
+		OutState = FGazeState();
+
+		FBeamFrame Latest;
+		if (!Ring || !Ring->ReadLatest(Latest))
+		{
+			return;
+		}
+
+		OutState.bValid = Latest.Gaze.bValid;
+		OutState.Confidence = OutState.bValid ? static_cast<float>(Latest.Gaze.Confidence) : 0.0f;
+		OutState.Position = FVector2f(Latest.Gaze.Screen01);
+		if (!OutState.bValid)
+		{
+			return;
+		}
+
+		// Prefer the filter's own estimate; otherwise difference against the sample one window back
+		if (Latest.bHasVelocity)
+		{
+			OutState.Velocity = FVector2f(Latest.GazeVelocity01);
+		}
+		else
+		{
+			FBeamFrame Earlier;
+			if (Ring->GetFrameAt(Latest.SDKTimestampMs - Settings.VelocityWindowMs, Earlier) && Earlier.Gaze.bValid)
+			{
+				const double DeltaSeconds = (Latest.SDKTimestampMs - Earlier.SDKTimestampMs) * 0.001;
+				if (DeltaSeconds > UE_KINDA_SMALL_NUMBER)
+				{
+					OutState.Velocity = FVector2f((Latest.Gaze.Screen01 - Earlier.Gaze.Screen01) / DeltaSeconds);
+				}
+			}
+		}
+
+		if (bWithFixation)
+		{
+			OutState.FixationSeconds = MeasureFixationSeconds(*Ring, Settings, Latest);
+			OutState.bFixating = OutState.FixationSeconds >= Settings.MinFixationSeconds;
+		}
+	}
+
+	/** Resamples the last HistorySeconds into evenly spaced points, newest first */
+	static void SampleHistory(const FBeamFrameRing* Ring, const FSettings& Settings, FHistory& OutHistory)
+	{
+		OutHistory.Reset();
+
+		FBeamFrame Latest;
+		if (!Ring || !Ring->ReadLatest(Latest))
+		{
+			return;
+		}
+
+		auto AddSample = [&OutHistory](const FBeamFrame& Frame, bool bFound)
+		{
+			const bool bValid = bFound && Frame.Gaze.bValid;
+			OutHistory.Emplace(static_cast<float>(Frame.Gaze.Screen01.X), static_cast<float>(Frame.Gaze.Screen01.Y), bValid ? 1.0f : 0.0f, 0.0f);
+		};
+
+		AddSample(Latest, true);
+		const double StepMs = Settings.HistorySeconds * 1000.0 / (Settings.HistorySamples - 1);
+		for (int32 Index = 1; Index < Settings.HistorySamples; ++Index)
+		{
+			FBeamFrame Sample;
+			AddSample(Sample, Ring->GetInterpolatedFrameAt(Latest.SDKTimestampMs - StepMs * Index, Sample));
+		}
+	}
+
+	/** Same lookup the GPU template does: clamp to the history window and lerp the bracketing samples */
+	static bool LookupHistory(const FHistory& History, float HistorySeconds, float AgeSeconds, FVector2f& OutPosition)
+	{
+		if (History.Num() < 2 || AgeSeconds < 0.0f || AgeSeconds > HistorySeconds)
+		{
+			OutPosition = History.Num() > 0 ? FVector2f(History[0].X, History[0].Y) : FVector2f::ZeroVector;
+			return false;
+		}
+
+		const float Position = AgeSeconds / HistorySeconds * (History.Num() - 1);
+		const int32 Index0 = FMath::Min(FMath::FloorToInt32(Position), History.Num() - 2);
+		const float Alpha = Position - Index0;
+		const FVector4f& A = History[Index0];
+		const FVector4f& B = History[Index0 + 1];
+		OutPosition = FVector2f(FMath::Lerp(A.X, B.X, Alpha), FMath::Lerp(A.Y, B.Y, Alpha));
+		return A.Z > 0.0f && B.Z > 0.0f;
+	}
+}
+
+using namespace NDIBeamGazeLocal;
+
+/** Render-thread copy of each instance's ring pointer and settings */
+struct FNDIBeamGazeProxy : public FNiagaraDataInterfaceProxy
+{
+	virtual int32 PerInstanceDataPassedToRenderThreadSize() const override { return sizeof(FGameToRenderData); }
+
+	virtual void ConsumePerInstanceDataFromGameThread(void* PerInstanceData, const FNiagaraSystemInstanceID& Instance) override
+	{
+		FGameToRenderData* Data = static_cast<FGameToRenderData*>(PerInstanceData);
+		InstanceData.Add(Instance, *Data);
+		Data->~FGameToRenderData();
+	}
+
+	TMap<FNiagaraSystemInstanceID, FGameToRenderData> InstanceData;
+};
+
+UNiagaraDataInterfaceBeamGaze::UNiagaraDataInterfaceBeamGaze()
+{
+	Proxy.Reset(new FNDIBeamGazeProxy());
+}
+
+void UNiagaraDataInterfaceBeamGaze::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		const ENiagaraTypeRegistryFlags Flags = ENiagaraTypeRegistryFlags::AllowAnyVariable | ENiagaraTypeRegistryFlags::AllowParameter;
+		FNiagaraTypeRegistry::Register(FNiagaraTypeDefinition(GetClass()), Flags);
+	}
+}
+
+bool UNiagaraDataInterfaceBeamGaze::InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
+{
+	new (PerInstanceData) FInstanceData();
+	return true;
+}
+
+void UNiagaraDataInterfaceBeamGaze::DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
+{
+	FInstanceData* InstanceData = static_cast<FInstanceData*>(PerInstanceData);
+	if (UBeamEyeTrackerSubsystem* Subsystem = InstanceData->Subsystem.Get())
+	{
+		Subsystem->OnFrameRingReleased.Remove(InstanceData->RingReleasedHandle);
+	}
+	InstanceData->~FInstanceData();
+
+	ENQUEUE_RENDER_COMMAND(BeamGazeRemoveProxy)(
+		[RTProxy = GetProxyAs<FNDIBeamGazeProxy>(), InstanceID = SystemInstance->GetId()](FRHICommandListImmediate&)
+		{
+			RTProxy->InstanceData.Remove(InstanceID);
+		});
+}
+
+int32 UNiagaraDataInterfaceBeamGaze::PerInstanceDataSize() const
+{
+	return sizeof(FInstanceData);
+}
+
+bool UNiagaraDataInterfaceBeamGaze::PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds)
+{
+	FInstanceData* InstanceData = static_cast<FInstanceData*>(PerInstanceData);
+	if (InstanceData->Subsystem.IsValid())
+	{
+		return false;
+	}
+
+	// Resolve the subsystem once; after that the VM and render thread read its ring directly
+	UWorld* World = SystemInstance ? SystemInstance->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UBeamEyeTrackerSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		return false;
+	}
+
+	InstanceData->Subsystem = Subsystem;
+	InstanceData->Ring.store(Subsystem->GetFrameRing(), std::memory_order_release);
+	InstanceData->RingReleasedHandle = Subsystem->OnFrameRingReleased.AddLambda(
+		[InstanceData, RTProxy = GetProxyAs<FNDIBeamGazeProxy>(), InstanceID = SystemInstance->GetId()]()
+		{
+			InstanceData->Ring.store(nullptr, std::memory_order_release);
+			ENQUEUE_RENDER_COMMAND(BeamGazeReleaseRing)(
+				[RTProxy, InstanceID](FRHICommandListImmediate&)
+				{
+					if (FGameToRenderData* Data = RTProxy->InstanceData.Find(InstanceID))
+					{
+						Data->Ring = nullptr;
+					}
+				});
+
+			// The ring is deleted as soon as the broadcast returns
+			FlushRenderingCommands();
+		});
+	return false;
+}
+
+void UNiagaraDataInterfaceBeamGaze::ProvidePerInstanceDataForRenderThread(void* DataForRenderThread, void* PerInstanceData, const FNiagaraSystemInstanceID& SystemInstance)
+{
+	const FInstanceData* InstanceData = static_cast<const FInstanceData*>(PerInstanceData);
+	FGameToRenderData* Data = new (DataForRenderThread) FGameToRenderData();
+	Data->Ring = InstanceData->Ring.load(std::memory_order_acquire);
+	Data->Settings = MakeSettings(*this);
+}
+
+#if WITH_EDITORONLY_DATA
+void UNiagaraDataInterfaceBeamGaze::GetFunctionsInternal(TArray<FNiagaraFunctionSignature>& OutFunctions) const
+{
+	FNiagaraFunctionSignature DefaultSig;
+	DefaultSig.bMemberFunction = true;
+	DefaultSig.bRequiresContext = false;
+	DefaultSig.bSupportsCPU = true;
+	DefaultSig.bSupportsGPU = true;
+	DefaultSig.Inputs.Emplace(FNiagaraTypeDefinition(GetClass()), TEXT("BeamGaze"));
+
+	{
+		FNiagaraFunctionSignature& Sig = OutFunctions.Add_GetRef(DefaultSig);
+		Sig.Name = GetGazeName;
+		Sig.Outputs.Emplace(FNiagaraTypeDefinition::GetVec2Def(), TEXT("Position"));
+		Sig.Outputs.Emplace(FNiagaraTypeDefinition::GetVec2Def(), TEXT("Velocity"));
+		Sig.Outputs.Emplace(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Confidence"));
+		Sig.Outputs.Emplace(FNiagaraTypeDefinition::GetBoolDef(), TEXT("IsValid"));
+		Sig.SetDescription(LOCTEXT("GetGazeDesc", "Newest gaze point in Screen01 space, its velocity in Screen01 per second and its confidence."));
+	}
+	{
+		FNiagaraFunctionSignature& Sig = OutFunctions.Add_GetRef(DefaultSig);
+		Sig.Name = GetFixationName;
+		Sig.Outputs.Emplace(FNiagaraTypeDefinition::GetBoolDef(), TEXT("IsFixating"));
+		Sig.Outputs.Emplace(FNiagaraTypeDefinition::GetFloatDef(), TEXT("FixationSeconds"));
+		Sig.SetDescription(LOCTEXT("GetFixationDesc", "How long the gaze has stayed within the fixation radius of the newest point."));
+	}
+	{
+		FNiagaraFunctionSignature& Sig = OutFunctions.Add_GetRef(DefaultSig);
+		Sig.Name = GetGazeAtAgeName;
+		Sig.Inputs.Emplace(FNiagaraTypeDefinition::GetFloatDef(), TEXT("AgeSeconds"));
+		Sig.Outputs.Emplace(FNiagaraTypeDefinition::GetVec2Def(), TEXT("Position"));
+		Sig.Outputs.Emplace(FNiagaraTypeDefinition::GetBoolDef(), TEXT("IsValid"));
+		Sig.SetDescription(LOCTEXT("GetGazeAtAgeDesc", "Gaze point AgeSeconds before the newest one, interpolated from the resampled history."));
+	}
+}
+#endif
+
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceBeamGaze, VMGetGaze);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceBeamGaze, VMGetFixation);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceBeamGaze, VMGetGazeAtAge);
+
+void UNiagaraDataInterfaceBeamGaze::GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction& OutFunc)
+{
+	if (BindingInfo.Name == GetGazeName)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceBeamGaze, VMGetGaze)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetFixationName)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceBeamGaze, VMGetFixation)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetGazeAtAgeName)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceBeamGaze, VMGetGazeAtAge)::Bind(this, OutFunc);
+	}
+}
+
+void UNiagaraDataInterfaceBeamGaze::VMGetGaze(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FInstanceData> InstanceData(Context);
+	FNDIOutputParam<FVector2f> OutPosition(Context);
+	FNDIOutputParam<FVector2f> OutVelocity(Context);
+	FNDIOutputParam<float> OutConfidence(Context);
+	FNDIOutputParam<bool> OutIsValid(Context);
+
+	FGazeState State;
+	SampleGaze(InstanceData->Ring.load(std::memory_order_acquire), MakeSettings(*this), false, State);
+
+	for (int32 Instance = 0; Instance < Context.GetNumInstances(); ++Instance)
+	{
+		OutPosition.SetAndAdvance(State.Position);
+		OutVelocity.SetAndAdvance(State.Velocity);
+		OutConfidence.SetAndAdvance(State.Confidence);
+		OutIsValid.SetAndAdvance(State.bValid);
+	}
+}
+
+void UNiagaraDataInterfaceBeamGaze::VMGetFixation(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FInstanceData> InstanceData(Context);
+	FNDIOutputParam<bool> OutIsFixating(Context);
+	FNDIOutputParam<float> OutFixationSeconds(Context);
+
+	FGazeState State;
+	SampleGaze(InstanceData->Ring.load(std::memory_order_acquire), MakeSettings(*this), true, State);
+
+	for (int32 Instance = 0; Instance < Context.GetNumInstances(); ++Instance)
+	{
+		OutIsFixating.SetAndAdvance(State.bFixating);
+		OutFixationSeconds.SetAndAdvance(State.FixationSeconds);
+	}
+}
+
+void UNiagaraDataInterfaceBeamGaze::VMGetGazeAtAge(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FInstanceData> InstanceData(Context);
+	FNDIInputParam<float> InAgeSeconds(Context);
+	FNDIOutputParam<FVector2f> OutPosition(Context);
+	FNDIOutputParam<bool> OutIsValid(Context);
+
+	// One resample per chunk; particles then only interpolate between stack-resident points
+	const FSettings Settings = MakeSettings(*this);
+	FHistory History;
+	SampleHistory(InstanceData->Ring.load(std::memory_order_acquire), Settings, History);
+
+	for (int32 Instance = 0; Instance < Context.GetNumInstances(); ++Instance)
+	{
+		FVector2f Position;
+		const bool bValid = LookupHistory(History, Settings.HistorySeconds, InAgeSeconds.GetAndAdvance(), Position);
+		OutPosition.SetAndAdvance(Position);
+		OutIsValid.SetAndAdvance(bValid);
+	}
+}
+
+bool UNiagaraDataInterfaceBeamGaze::Equals(const UNiagaraDataInterface* Other) const
+{
+	if (!Super::Equals(Other))
+	{
+		return false;
+	}
+
+	const UNiagaraDataInterfaceBeamGaze* OtherTyped = CastChecked<const UNiagaraDataInterfaceBeamGaze>(Other);
+	return OtherTyped->VelocityWindowMs == VelocityWindowMs
+		&& OtherTyped->FixationRadius == FixationRadius
+		&& OtherTyped->MinFixationSeconds == MinFixationSeconds
+		&& OtherTyped->MaxFixationSeconds == MaxFixationSeconds
+		&& OtherTyped->HistorySeconds == HistorySeconds
+		&& OtherTyped->HistorySamples == HistorySamples;
+}
+
+bool UNiagaraDataInterfaceBeamGaze::CopyToInternal(UNiagaraDataInterface* Destination) const
+{
+	if (!Super::CopyToInternal(Destination))
+	{
+		return false;
+	}
+
+	UNiagaraDataInterfaceBeamGaze* DestinationTyped = CastChecked<UNiagaraDataInterfaceBeamGaze>(Destination);
+	DestinationTyped->VelocityWindowMs = VelocityWindowMs;
+	DestinationTyped->FixationRadius = FixationRadius;
+	DestinationTyped->MinFixationSeconds = MinFixationSeconds;
+	DestinationTyped->MaxFixationSeconds = MaxFixationSeconds;
+	DestinationTyped->HistorySeconds = HistorySeconds;
+	DestinationTyped->HistorySamples = HistorySamples;
+	return true;
+}
+
+#if WITH_EDITORONLY_DATA
+bool UNiagaraDataInterfaceBeamGaze::AppendCompileHash(FNiagaraCompileHashVisitor* InVisitor) const
+{
+	bool bSuccess = Super::AppendCompileHash(InVisitor);
+	bSuccess &= InVisitor->UpdateShaderFile(TemplateShaderFilePath);
+	bSuccess &= InVisitor->UpdateShaderParameters<FShaderParameters>();
+	return bSuccess;
+}
+
+void UNiagaraDataInterfaceBeamGaze::GetParameterDefinitionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, FString& OutHLSL)
+{
+	const TMap<FString, FStringFormatArg> TemplateArgs =
+	{
+		{ TEXT("ParameterName"), ParamInfo.DataInterfaceHLSLSymbol },
+	};
+	AppendTemplateHLSL(OutHLSL, TemplateShaderFilePath, TemplateArgs);
+}
+
+bool UNiagaraDataInterfaceBeamGaze::GetFunctionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, const FNiagaraDataInterfaceGeneratedFunction& FunctionInfo, int FunctionInstanceIndex, FString& OutHLSL)
+{
+	return FunctionInfo.DefinitionName == GetGazeName
+		|| FunctionInfo.DefinitionName == GetFixationName
+		|| FunctionInfo.DefinitionName == GetGazeAtAgeName;
+}
+#endif
+
+void UNiagaraDataInterfaceBeamGaze::BuildShaderParameters(FNiagaraShaderParametersBuilder& ShaderParametersBuilder) const
+{
+	ShaderParametersBuilder.AddNestedStruct<FShaderParameters>();
+}
+
+void UNiagaraDataInterfaceBeamGaze::SetShaderParameters(const FNiagaraDataInterfaceSetShaderParametersContext& Context) const
+{
+	const FNDIBeamGazeProxy& DIProxy = Context.GetProxy<FNDIBeamGazeProxy>();
+	const FGameToRenderData* Data = DIProxy.InstanceData.Find(Context.GetSystemInstanceID());
+	const FGameToRenderData Defaults;
+	const FGameToRenderData& InstanceData = Data ? *Data : Defaults;
+
+	// The render thread reads the ring itself, so GPU particles see the sample current at dispatch time
+	FGazeState State;
+	SampleGaze(InstanceData.Ring, InstanceData.Settings, true, State);
+
+	FHistory History;
+	SampleHistory(InstanceData.Ring, InstanceData.Settings, History);
+	const int32 HistoryCount = History.Num();
+	if (HistoryCount == 0)
+	{
+		History.AddZeroed(); // SRVs cannot be empty
+	}
+
+	FRDGBuilder& GraphBuilder = Context.GetGraphBuilder();
+	FRDGBufferRef HistoryBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("BeamGaze.History"), sizeof(FVector4f), History.Num(), History.GetData(), History.Num() * sizeof(FVector4f));
+
+	FShaderParameters* ShaderParameters = Context.GetParameterNestedStruct<FShaderParameters>();
+	ShaderParameters->GazePosition = State.Position;
+	ShaderParameters->GazeVelocity = State.Velocity;
+	ShaderParameters->GazeConfidence = State.Confidence;
+	ShaderParameters->GazeValid = State.bValid ? 1 : 0;
+	ShaderParameters->Fixating = State.bFixating ? 1 : 0;
+	ShaderParameters->FixationSeconds = State.FixationSeconds;
+	ShaderParameters->HistoryCount = HistoryCount;
+	ShaderParameters->HistorySeconds = InstanceData.Settings.HistorySeconds;
+	ShaderParameters->HistoryBuffer = GraphBuilder.CreateSRV(HistoryBuffer);
+}
+
+#undef LOCTEXT_NAMESPACE
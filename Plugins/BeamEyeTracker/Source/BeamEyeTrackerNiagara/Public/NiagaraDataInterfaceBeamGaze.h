@@ -0,0 +1,115 @@
+/*=============================================================================
+    NiagaraDataInterfaceBeamGaze.h: Niagara access to the Beam gaze ring.
+
+    Lets Niagara systems read gaze position, velocity, fixation state and
+    recent history straight from the subsystem's frame ring, on the CPU VM
+    and in GPU simulations, without any Blueprint or game-thread copies.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NiagaraDataInterface.h"
+#include "NiagaraDataInterfaceBeamGaze.generated.h"
+
+/**
+ * Gaze data interface backed by UBeamEyeTrackerSubsystem's frame ring.
+ *
+ * The game thread only resolves which ring an instance follows. CPU
+ * simulations read the ring from the VM worker once per execution chunk;
+ * GPU simulations read it on the render thread when their parameters are
+ * set and upload a small resampled history buffer. Either way the ring is
+ * read once per execution, never once per particle. Every read goes through
+ * the ring's non-consuming seqlock path, so the producer never waits.
+ *
+ * Positions are Screen01 (0..1 across the viewport), velocities Screen01
+ * per second. A fixation is the trailing run of samples that stay within
+ * FixationRadius of the newest one.
+ */
+UCLASS(EditInlineNew, Category = "Beam", CollapseCategories, meta = (DisplayName = "Beam Gaze"))
+class BEAMEYETRACKERNIAGARA_API UNiagaraDataInterfaceBeamGaze : public UNiagaraDataInterface
+{
+	GENERATED_BODY()
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FShaderParameters, )
+		SHADER_PARAMETER(FVector2f, GazePosition)
+		SHADER_PARAMETER(FVector2f, GazeVelocity)
+		SHADER_PARAMETER(float, GazeConfidence)
+		SHADER_PARAMETER(int, GazeValid)
+		SHADER_PARAMETER(int, Fixating)
+		SHADER_PARAMETER(float, FixationSeconds)
+		SHADER_PARAMETER(int, HistoryCount)
+		SHADER_PARAMETER(float, HistorySeconds)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, HistoryBuffer)
+	END_SHADER_PARAMETER_STRUCT()
+
+public:
+	UNiagaraDataInterfaceBeamGaze();
+
+	/** Span the velocity is measured over, in milliseconds */
+	UPROPERTY(EditAnywhere, Category = "Gaze", meta = (ClampMin = "5.0", ClampMax = "500.0", Units = "ms"))
+	float VelocityWindowMs = 50.0f;
+
+	/** Samples within this Screen01 distance of the newest one count as the same fixation */
+	UPROPERTY(EditAnywhere, Category = "Fixation", meta = (ClampMin = "0.001", ClampMax = "0.5"))
+	float FixationRadius = 0.03f;
+
+	/** Shortest run that reports IsFixating */
+	UPROPERTY(EditAnywhere, Category = "Fixation", meta = (ClampMin = "0.0", ClampMax = "2.0", Units = "s"))
+	float MinFixationSeconds = 0.1f;
+
+	/** Longest fixation measured; bounds how far back the ring is scanned */
+	UPROPERTY(EditAnywhere, Category = "Fixation", meta = (ClampMin = "0.1", ClampMax = "10.0", Units = "s"))
+	float MaxFixationSeconds = 2.0f;
+
+	/** Oldest age GetGazeAtAge can return */
+	UPROPERTY(EditAnywhere, Category = "History", meta = (ClampMin = "0.05", ClampMax = "5.0", Units = "s"))
+	float HistorySeconds = 1.0f;
+
+	/** Evenly spaced samples over HistorySeconds that GetGazeAtAge interpolates between */
+	UPROPERTY(EditAnywhere, Category = "History", meta = (ClampMin = "2", ClampMax = "256"))
+	int32 HistorySamples = 32;
+
+	//~ Begin UObject Interface
+	virtual void PostInitProperties() override;
+	//~ End UObject Interface
+
+	//~ Begin UNiagaraDataInterface Interface
+	virtual bool CanExecuteOnTarget(ENiagaraSimTarget Target) const override { return true; }
+	virtual bool InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
+	virtual void DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
+	virtual int32 PerInstanceDataSize() const override;
+	virtual bool PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds) override;
+	virtual void ProvidePerInstanceDataForRenderThread(void* DataForRenderThread, void* PerInstanceData, const FNiagaraSystemInstanceID& SystemInstance) override;
+	virtual void GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction& OutFunc) override;
+	virtual bool Equals(const UNiagaraDataInterface* Other) const override;
+#if WITH_EDITORONLY_DATA
+	virtual bool AppendCompileHash(FNiagaraCompileHashVisitor* InVisitor) const override;
+	virtual void GetParameterDefinitionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, FString& OutHLSL) override;
+	virtual bool GetFunctionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, const FNiagaraDataInterfaceGeneratedFunction& FunctionInfo, int FunctionInstanceIndex, FString& OutHLSL) override;
+#endif
+	virtual void BuildShaderParameters(FNiagaraShaderParametersBuilder& ShaderParametersBuilder) const override;
+	virtual void SetShaderParameters(const FNiagaraDataInterfaceSetShaderParametersContext& Context) const override;
+	//~ End UNiagaraDataInterface Interface
+
+protected:
+	//~ Begin UNiagaraDataInterface Interface
+#if WITH_EDITORONLY_DATA
+	virtual void GetFunctionsInternal(TArray<FNiagaraFunctionSignature>& OutFunctions) const override;
+#endif
+	virtual bool CopyToInternal(UNiagaraDataInterface* Destination) const override;
+	//~ End UNiagaraDataInterface Interface
+
+private:
+	void VMGetGaze(FVectorVMExternalFunctionContext& Context);
+	void VMGetFixation(FVectorVMExternalFunctionContext& Context);
+	void VMGetGazeAtAge(FVectorVMExternalFunctionContext& Context);
+};
+
+/*=============================================================================
+    End of NiagaraDataInterfaceBeamGaze.h
+=============================================================================*/
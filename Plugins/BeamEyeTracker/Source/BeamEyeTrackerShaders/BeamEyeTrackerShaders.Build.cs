@@ -0,0 +1,28 @@
+/*=============================================================================
+    BeamEyeTrackerShaders.Build.cs: Build configuration for Beam Eye Tracker shaders.
+
+    Global compute shaders must be registered before the engine compiles its
+    shader maps, so they live in their own PostConfigInit module.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+using UnrealBuildTool;
+
+public class BeamEyeTrackerShaders : ModuleRules
+{
+	public BeamEyeTrackerShaders(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"RenderCore",
+			"RHI"
+		});
+
+		PrivateDependencyModuleNames.AddRange(new string[] { "Projects" });
+	}
+}
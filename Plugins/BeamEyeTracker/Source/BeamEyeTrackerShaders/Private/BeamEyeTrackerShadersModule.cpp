@@ -0,0 +1,22 @@
+// Implements the shader module that maps the plugin's shader directory
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+#include "ShaderCore.h"
+
+class FBeamEyeTrackerShadersModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("BeamEyeTracker"));
+		if (Plugin.IsValid())
+		{
+			AddShaderSourceDirectoryMapping(TEXT("/Plugin/BeamEyeTracker"), FPaths::Combine(Plugin->GetBaseDir(), TEXT("Shaders")));
+		}
+	}
+};
+
+IMPLEMENT_MODULE(FBeamEyeTrackerShadersModule, BeamEyeTrackerShaders)
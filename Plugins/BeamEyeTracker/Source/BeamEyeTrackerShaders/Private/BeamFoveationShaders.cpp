@@ -0,0 +1,78 @@
+// Implements the foveated shading rate image compute shader and its render graph pass
+
+#include "BeamFoveationShaders.h"
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "DataDrivenShaderPlatformInfo.h"
+#include "RHIGlobals.h"
+
+#define BEAM_FOVEATION_THREADGROUP_SIZE 8
+
+class FBeamShadingRateCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FBeamShadingRateCS);
+	SHADER_USE_PARAMETER_STRUCT(FBeamShadingRateCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint>, ShadingRateImage)
+		SHADER_PARAMETER(FIntPoint, ImageSize)
+		SHADER_PARAMETER(FVector2f, TileSizePx)
+		SHADER_PARAMETER(FVector2f, CenterPx)
+		SHADER_PARAMETER(FVector3f, RadiiPx)
+		SHADER_PARAMETER(FUintVector4, Rates)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), BEAM_FOVEATION_THREADGROUP_SIZE);
+	}
+};
+
+IMPLEMENT_GLOBAL_SHADER(FBeamShadingRateCS, "/Plugin/BeamEyeTracker/Private/BeamFoveation.usf", "ShadingRateCS", SF_Compute);
+
+bool BeamFoveationShaders::IsShadingRateImageSupported()
+{
+	return GRHISupportsAttachmentVariableRateShading
+		&& GRHIVariableRateShadingImageDataType == VRSImage_Palette
+		&& GRHIVariableRateShadingImageTileMinWidth > 0
+		&& GRHIVariableRateShadingImageTileMinHeight > 0;
+}
+
+FIntPoint BeamFoveationShaders::GetShadingRateImageExtent(const FIntPoint& TargetExtent)
+{
+	const FIntPoint TileSize(FMath::Max<int32>(GRHIVariableRateShadingImageTileMinWidth, 1), FMath::Max<int32>(GRHIVariableRateShadingImageTileMinHeight, 1));
+	return FIntPoint::DivideAndRoundUp(TargetExtent, TileSize);
+}
+
+FRDGTextureRef BeamFoveationShaders::AddShadingRateImagePass(FRDGBuilder& GraphBuilder, const FIntPoint& TargetExtent, const FBeamShadingRatePassParams& Params)
+{
+	const FIntPoint TileSize(FMath::Max<int32>(GRHIVariableRateShadingImageTileMinWidth, 1), FMath::Max<int32>(GRHIVariableRateShadingImageTileMinHeight, 1));
+	const FIntPoint Extent = GetShadingRateImageExtent(TargetExtent);
+
+	FRDGTextureRef Image = GraphBuilder.CreateTexture(
+		FRDGTextureDesc::Create2D(Extent, GRHIVariableRateShadingImageFormat, FClearValueBinding::None,
+			TexCreate_ShaderResource | TexCreate_UAV | TexCreate_Foveation),
+		TEXT("BeamFoveation.ShadingRateImage"));
+
+	FBeamShadingRateCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FBeamShadingRateCS::FParameters>();
+	PassParameters->ShadingRateImage = GraphBuilder.CreateUAV(Image);
+	PassParameters->ImageSize = Extent;
+	PassParameters->TileSizePx = FVector2f(TileSize);
+	PassParameters->CenterPx = Params.CenterPx;
+	PassParameters->RadiiPx = FVector3f(Params.RadiiPx[0], FMath::Max(Params.RadiiPx[0], Params.RadiiPx[1]), FMath::Max3(Params.RadiiPx[0], Params.RadiiPx[1], Params.RadiiPx[2]));
+	PassParameters->Rates = FUintVector4(Params.Rates[0], Params.Rates[1], Params.Rates[2], Params.Rates[3]);
+
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("BeamFoveationShadingRate %dx%d", Extent.X, Extent.Y),
+		TShaderMapRef<FBeamShadingRateCS>(ShaderMap), PassParameters, FComputeShaderUtils::GetGroupCount(Extent, BEAM_FOVEATION_THREADGROUP_SIZE));
+
+	return Image;
+}
@@ -0,0 +1,149 @@
+// Implements the gaze heatmap compute shaders and their render graph passes
+
+#include "BeamHeatmapShaders.h"
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "DataDrivenShaderPlatformInfo.h"
+
+#define BEAM_HEATMAP_THREADGROUP_SIZE 8
+
+// Fixed-point scale for the atomic scratch; one full-weight texel per sample leaves headroom for 4M samples per pass
+#define BEAM_HEATMAP_FIXED_POINT_SCALE 1024.0f
+
+// Dispatch group count limit per dimension
+#define BEAM_HEATMAP_MAX_SPLATS_PER_PASS 65535
+
+class FBeamHeatmapShader : public FGlobalShader
+{
+public:
+	FBeamHeatmapShader() = default;
+	FBeamHeatmapShader(const ShaderMetaType::CompiledShaderInitializerType& Initializer) : FGlobalShader(Initializer) {}
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), BEAM_HEATMAP_THREADGROUP_SIZE);
+	}
+};
+
+class FBeamHeatmapSplatCS : public FBeamHeatmapShader
+{
+	DECLARE_GLOBAL_SHADER(FBeamHeatmapSplatCS);
+	SHADER_USE_PARAMETER_STRUCT(FBeamHeatmapSplatCS, FBeamHeatmapShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, Splats)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint>, Scratch)
+		SHADER_PARAMETER(FIntPoint, HeatmapSize)
+		SHADER_PARAMETER(uint32, FirstSplat)
+		SHADER_PARAMETER(int32, RadiusTexels)
+		SHADER_PARAMETER(float, InvTwoSigmaSq)
+		SHADER_PARAMETER(float, FixedPointScale)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+class FBeamHeatmapResolveCS : public FBeamHeatmapShader
+{
+	DECLARE_GLOBAL_SHADER(FBeamHeatmapResolveCS);
+	SHADER_USE_PARAMETER_STRUCT(FBeamHeatmapResolveCS, FBeamHeatmapShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<uint>, ScratchInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, Heatmap)
+		SHADER_PARAMETER(FIntPoint, HeatmapSize)
+		SHADER_PARAMETER(float, Decay)
+		SHADER_PARAMETER(float, InvFixedPointScale)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+class FBeamHeatmapColorizeCS : public FBeamHeatmapShader
+{
+	DECLARE_GLOBAL_SHADER(FBeamHeatmapColorizeCS);
+	SHADER_USE_PARAMETER_STRUCT(FBeamHeatmapColorizeCS, FBeamHeatmapShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, HeatmapInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, ColorOutput)
+		SHADER_PARAMETER(FIntPoint, HeatmapSize)
+		SHADER_PARAMETER(float, InvSaturation)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+IMPLEMENT_GLOBAL_SHADER(FBeamHeatmapSplatCS, "/Plugin/BeamEyeTracker/Private/BeamHeatmap.usf", "SplatCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FBeamHeatmapResolveCS, "/Plugin/BeamEyeTracker/Private/BeamHeatmap.usf", "ResolveCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FBeamHeatmapColorizeCS, "/Plugin/BeamEyeTracker/Private/BeamHeatmap.usf", "ColorizeCS", SF_Compute);
+
+void BeamHeatmapShaders::AddAccumulatePasses(FRDGBuilder& GraphBuilder, FRDGTextureRef Accumulation, TConstArrayView<FVector4f> Splats, const FBeamHeatmapPassParams& Params)
+{
+	RDG_EVENT_SCOPE(GraphBuilder, "BeamHeatmapAccumulate");
+
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	const FIntPoint Size = Accumulation->Desc.Extent;
+
+	// Splats land in a transient fixed-point scratch first so any number of them can be added with integer atomics
+	FRDGTextureRef Scratch = GraphBuilder.CreateTexture(
+		FRDGTextureDesc::Create2D(Size, PF_R32_UINT, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV),
+		TEXT("BeamHeatmap.Scratch"));
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(Scratch), 0u);
+
+	if (Splats.Num() > 0)
+	{
+		// RDG copies the upload, so the caller's array may be released once the graph is built
+		FRDGBufferRef SplatBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("BeamHeatmap.Splats"), sizeof(FVector4f), Splats.Num(), Splats.GetData(), Splats.Num() * sizeof(FVector4f));
+		FRDGBufferSRVRef SplatSRV = GraphBuilder.CreateSRV(SplatBuffer);
+		FRDGTextureUAVRef ScratchUAV = GraphBuilder.CreateUAV(Scratch);
+
+		const float SigmaTexels = FMath::Max(Params.SigmaNormalized * Size.Y, 0.5f);
+		const int32 RadiusTexels = FMath::CeilToInt(3.0f * SigmaTexels);
+		TShaderMapRef<FBeamHeatmapSplatCS> SplatShader(ShaderMap);
+
+		for (int32 First = 0; First < Splats.Num(); First += BEAM_HEATMAP_MAX_SPLATS_PER_PASS)
+		{
+			const int32 Count = FMath::Min(Splats.Num() - First, BEAM_HEATMAP_MAX_SPLATS_PER_PASS);
+
+			FBeamHeatmapSplatCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FBeamHeatmapSplatCS::FParameters>();
+			PassParameters->Splats = SplatSRV;
+			PassParameters->Scratch = ScratchUAV;
+			PassParameters->HeatmapSize = Size;
+			PassParameters->FirstSplat = First;
+			PassParameters->RadiusTexels = RadiusTexels;
+			PassParameters->InvTwoSigmaSq = 1.0f / (2.0f * SigmaTexels * SigmaTexels);
+			PassParameters->FixedPointScale = BEAM_HEATMAP_FIXED_POINT_SCALE;
+
+			// Chunks add into the same scratch; the atomics make their order irrelevant
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("BeamHeatmapSplat %d", Count), SplatShader, PassParameters, FIntVector(Count, 1, 1));
+		}
+	}
+
+	FBeamHeatmapResolveCS::FParameters* ResolveParameters = GraphBuilder.AllocParameters<FBeamHeatmapResolveCS::FParameters>();
+	ResolveParameters->ScratchInput = Scratch;
+	ResolveParameters->Heatmap = GraphBuilder.CreateUAV(Accumulation);
+	ResolveParameters->HeatmapSize = Size;
+	ResolveParameters->Decay = Params.Decay;
+	ResolveParameters->InvFixedPointScale = 1.0f / BEAM_HEATMAP_FIXED_POINT_SCALE;
+
+	FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("BeamHeatmapResolve"), TShaderMapRef<FBeamHeatmapResolveCS>(ShaderMap), ResolveParameters,
+		FComputeShaderUtils::GetGroupCount(Size, BEAM_HEATMAP_THREADGROUP_SIZE));
+}
+
+void BeamHeatmapShaders::AddColorizePass(FRDGBuilder& GraphBuilder, FRDGTextureRef Accumulation, FRDGTextureRef Output, const FBeamHeatmapPassParams& Params)
+{
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	const FIntPoint Size = Output->Desc.Extent;
+
+	FBeamHeatmapColorizeCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FBeamHeatmapColorizeCS::FParameters>();
+	PassParameters->HeatmapInput = Accumulation;
+	PassParameters->ColorOutput = GraphBuilder.CreateUAV(Output);
+	PassParameters->HeatmapSize = Size;
+	PassParameters->InvSaturation = 1.0f / FMath::Max(Params.Saturation, UE_KINDA_SMALL_NUMBER);
+
+	FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("BeamHeatmapColorize"), TShaderMapRef<FBeamHeatmapColorizeCS>(ShaderMap), PassParameters,
+		FComputeShaderUtils::GetGroupCount(Size, BEAM_HEATMAP_THREADGROUP_SIZE));
+}
@@ -0,0 +1,46 @@
+/*=============================================================================
+    BeamFoveationShaders.h: Render graph pass for the foveated shading rate image.
+
+    Declares the compute pass that fills a variable rate shading image
+    around a foveation center. Runs on the render thread inside the
+    caller's graph.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphFwd.h"
+#include "RHIDefinitions.h"
+
+/** Shape of one shading rate image */
+struct FBeamShadingRatePassParams
+{
+	/** Foveation center in render target pixels */
+	FVector2f CenterPx = FVector2f::ZeroVector;
+
+	/** Ring radii in pixels, innermost first; must not decrease */
+	float RadiiPx[3] = { 0.0f, 0.0f, 0.0f };
+
+	/** Rate inside the innermost radius, then per ring outwards */
+	EVRSShadingRate Rates[4] = { VRSSR_1x1, VRSSR_2x2, VRSSR_2x4, VRSSR_4x4 };
+};
+
+namespace BeamFoveationShaders
+{
+	/** True when the RHI takes a palette shading rate image on render passes (VRS Tier 2) */
+	BEAMEYETRACKERSHADERS_API bool IsShadingRateImageSupported();
+
+	/** Image extent covering a render target of TargetExtent pixels, one texel per VRS tile */
+	BEAMEYETRACKERSHADERS_API FIntPoint GetShadingRateImageExtent(const FIntPoint& TargetExtent);
+
+	/** Creates a transient shading rate image for TargetExtent and fills it; the caller extracts or binds it */
+	BEAMEYETRACKERSHADERS_API FRDGTextureRef AddShadingRateImagePass(FRDGBuilder& GraphBuilder, const FIntPoint& TargetExtent, const FBeamShadingRatePassParams& Params);
+}
+
+/*=============================================================================
+    End of BeamFoveationShaders.h
+=============================================================================*/
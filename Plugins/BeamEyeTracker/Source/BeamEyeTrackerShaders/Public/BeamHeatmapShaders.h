@@ -0,0 +1,46 @@
+/*=============================================================================
+    BeamHeatmapShaders.h: Render graph passes for the gaze heatmap.
+
+    Declares the passes that splat gaze samples into a decaying float
+    accumulator and colorize it for display. All functions run on the
+    render thread inside the caller's graph.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphFwd.h"
+
+/** Accumulation parameters for one heatmap update */
+struct FBeamHeatmapPassParams
+{
+	/** Multiplier applied to the accumulator before this update's splats are added */
+	float Decay = 1.0f;
+
+	/** Gaussian standard deviation as a fraction of the heatmap height */
+	float SigmaNormalized = 0.03f;
+
+	/** Accumulated weight that maps to roughly two thirds of the heat ramp */
+	float Saturation = 4.0f;
+};
+
+namespace BeamHeatmapShaders
+{
+	/**
+	 * Decays Accumulation (PF_R32_FLOAT, UAV) by Params.Decay and adds one Gaussian
+	 * per splat. Splats hold Screen01 position in xy and weight in z; any number is
+	 * accepted and cost grows with the kernel footprint, not the heatmap size.
+	 */
+	BEAMEYETRACKERSHADERS_API void AddAccumulatePasses(FRDGBuilder& GraphBuilder, FRDGTextureRef Accumulation, TConstArrayView<FVector4f> Splats, const FBeamHeatmapPassParams& Params);
+
+	/** Maps Accumulation onto a heat ramp in Output (PF_R8G8B8A8, UAV); alpha follows intensity */
+	BEAMEYETRACKERSHADERS_API void AddColorizePass(FRDGBuilder& GraphBuilder, FRDGTextureRef Accumulation, FRDGTextureRef Output, const FBeamHeatmapPassParams& Params);
+}
+
+/*=============================================================================
+    End of BeamHeatmapShaders.h
+=============================================================================*/
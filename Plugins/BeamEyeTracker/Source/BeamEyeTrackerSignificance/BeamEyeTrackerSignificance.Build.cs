@@ -0,0 +1,32 @@
+/*=============================================================================
+    BeamEyeTrackerSignificance.Build.cs: Build configuration for gaze-driven significance.
+
+    Kept out of the runtime module so projects that do not use the
+    Significance Manager plugin do not pick up a dependency on it.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+using UnrealBuildTool;
+
+public class BeamEyeTrackerSignificance : ModuleRules
+{
+	public BeamEyeTrackerSignificance(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"DeveloperSettings",
+			"SignificanceManager"
+		});
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"BeamEyeTracker"
+		});
+	}
+}
@@ -0,0 +1,5 @@
+// Implements the Beam significance module; the world subsystem registers itself through its class
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, BeamEyeTrackerSignificance)
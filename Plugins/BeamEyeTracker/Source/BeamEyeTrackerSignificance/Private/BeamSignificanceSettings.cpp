@@ -0,0 +1,27 @@
+// Implements defaults for the gaze significance settings
+
+#include "BeamSignificanceSettings.h"
+
+UBeamSignificanceSettings::UBeamSignificanceSettings()
+{
+	// Looked at: full rate. Peripheral: 30 Hz animation, one LOD down. Far periphery: 10 Hz animation, two LODs down
+	FBeamSignificanceTier& Focus = Tiers.AddDefaulted_GetRef();
+	Focus.MinSignificance = 0.5f;
+
+	FBeamSignificanceTier& Peripheral = Tiers.AddDefaulted_GetRef();
+	Peripheral.MinSignificance = 0.15f;
+	Peripheral.TickInterval = 1.0f / 30.0f;
+	Peripheral.AnimationTickInterval = 1.0f / 30.0f;
+	Peripheral.MinLOD = 1;
+
+	FBeamSignificanceTier& Background = Tiers.AddDefaulted_GetRef();
+	Background.MinSignificance = 0.0f;
+	Background.TickInterval = 0.25f;
+	Background.AnimationTickInterval = 0.1f;
+	Background.MinLOD = 2;
+}
+
+FName UBeamSignificanceSettings::GetCategoryName() const
+{
+	return TEXT("Plugins");
+}
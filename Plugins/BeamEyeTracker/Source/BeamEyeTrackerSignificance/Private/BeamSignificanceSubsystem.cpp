@@ -0,0 +1,331 @@
+// Implements gaze scoring and tier budgeting on top of the Significance Manager
+
+#include "BeamSignificanceSubsystem.h"
+#include "BeamSignificanceSettings.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamGazeTargetSubsystem.h"
+#include "BeamRing.h"
+#include "SignificanceManager.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBeamSignificance, Log, All);
+
+namespace
+{
+	int32 GetMinLOD(const UActorComponent* Component)
+	{
+		if (const USkinnedMeshComponent* SkinnedMesh = Cast<USkinnedMeshComponent>(Component))
+		{
+			return SkinnedMesh->bOverrideMinLod ? SkinnedMesh->MinLodModel : 0;
+		}
+		if (const UStaticMeshComponent* StaticMesh = Cast<UStaticMeshComponent>(Component))
+		{
+			return StaticMesh->bOverrideMinLOD ? StaticMesh->MinLOD : 0;
+		}
+		return 0;
+	}
+
+	void SetMinLOD(UActorComponent* Component, int32 MinLOD)
+	{
+		if (USkinnedMeshComponent* SkinnedMesh = Cast<USkinnedMeshComponent>(Component))
+		{
+			if (GetMinLOD(SkinnedMesh) != MinLOD)
+			{
+				SkinnedMesh->OverrideMinLOD(MinLOD);
+			}
+		}
+		else if (UStaticMeshComponent* StaticMesh = Cast<UStaticMeshComponent>(Component))
+		{
+			if (GetMinLOD(StaticMesh) != MinLOD)
+			{
+				StaticMesh->bOverrideMinLOD = MinLOD > 0;
+				StaticMesh->MinLOD = MinLOD;
+				StaticMesh->MarkRenderStateDirty();
+			}
+		}
+	}
+}
+
+bool UBeamSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UBeamSignificanceSubsystem::Deinitialize()
+{
+	USignificanceManager* Manager = USignificanceManager::Get(GetWorld());
+	for (TPair<TObjectKey<AActor>, FManagedActor>& Pair : Managed)
+	{
+		Release(Pair.Value, Manager);
+	}
+	Managed.Empty();
+	Scores.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UBeamSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBeamSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UBeamSignificanceSubsystem::RegisterActor(AActor* Actor)
+{
+	if (!Actor || Managed.Contains(Actor))
+	{
+		return;
+	}
+
+	USignificanceManager* Manager = USignificanceManager::Get(GetWorld());
+	if (!Manager)
+	{
+		if (!bWarnedNoManager)
+		{
+			UE_LOG(LogBeamSignificance, Warning, TEXT("No Significance Manager in this world; enable the SignificanceManager plugin to use gaze significance"));
+			bWarnedNoManager = true;
+		}
+		return;
+	}
+
+	FManagedActor& Entry = Managed.Add(Actor);
+	Entry.Actor = Actor;
+	Entry.OriginalTickInterval = Actor->GetActorTickInterval();
+
+	TInlineComponentArray<UActorComponent*> Components(Actor);
+	Entry.Components.Reserve(Components.Num());
+	for (UActorComponent* Component : Components)
+	{
+		FManagedComponent& ManagedComponent = Entry.Components.AddDefaulted_GetRef();
+		ManagedComponent.Component = Component;
+		ManagedComponent.OriginalTickInterval = Component->GetComponentTickInterval();
+		ManagedComponent.OriginalMinLOD = GetMinLOD(Component);
+	}
+
+	// Projection comes from the gaze target grid, which is built once per frame for every registered target
+	UBeamGazeTargetSubsystem* Targets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>();
+	if (Targets && !Targets->IsGazeTargetRegistered(Actor))
+	{
+		Targets->RegisterGazeTarget(Actor);
+		Entry.bRegisteredGazeTarget = true;
+	}
+
+	Actor->OnDestroyed.AddDynamic(this, &UBeamSignificanceSubsystem::HandleActorDestroyed);
+
+	// May run on worker threads during the manager update; reads only this frame's score map
+	auto Significance = [this](USignificanceManager::FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint) -> float
+	{
+		const float* Score = Scores.Find(Cast<AActor>(ObjectInfo->GetObject()));
+		return Score ? *Score : GetDefault<UBeamSignificanceSettings>()->OffScreenSignificance;
+	};
+	auto PostSignificance = [this](USignificanceManager::FManagedObjectInfo* ObjectInfo, float OldSignificance, float NewSignificance, bool bFinal)
+	{
+		OnSignificanceChanged(ObjectInfo->GetObject(), NewSignificance);
+	};
+
+	Manager->RegisterObject(Actor, GetDefault<UBeamSignificanceSettings>()->SignificanceTag, Significance,
+		USignificanceManager::EPostSignificanceType::Sequential, PostSignificance);
+}
+
+void UBeamSignificanceSubsystem::UnregisterActor(AActor* Actor)
+{
+	FManagedActor Entry;
+	if (Actor && Managed.RemoveAndCopyValue(Actor, Entry))
+	{
+		Release(Entry, USignificanceManager::Get(GetWorld()));
+		Scores.Remove(Actor);
+	}
+}
+
+void UBeamSignificanceSubsystem::HandleActorDestroyed(AActor* Actor)
+{
+	UnregisterActor(Actor);
+}
+
+float UBeamSignificanceSubsystem::GetGazeSignificance(const AActor* Actor) const
+{
+	const float* Score = Actor ? Scores.Find(Actor) : nullptr;
+	return Score ? *Score : GetDefault<UBeamSignificanceSettings>()->OffScreenSignificance;
+}
+
+int32 UBeamSignificanceSubsystem::GetSignificanceTier(const AActor* Actor) const
+{
+	const FManagedActor* Entry = Actor ? Managed.Find(Actor) : nullptr;
+	return Entry ? Entry->Tier : INDEX_NONE;
+}
+
+void UBeamSignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Managed.Num() == 0)
+	{
+		return;
+	}
+
+	UpdateScores();
+
+	if (GetDefault<UBeamSignificanceSettings>()->bUpdateSignificanceManager)
+	{
+		UpdateSignificanceManager(USignificanceManager::Get(GetWorld()));
+	}
+}
+
+void UBeamSignificanceSubsystem::UpdateScores()
+{
+	Scores.Reset();
+
+	UBeamGazeTargetSubsystem* Targets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>();
+	FIntRect ViewRect;
+	if (!Targets || !Targets->GetViewRect(ViewRect))
+	{
+		return;
+	}
+
+	// Without a valid gaze the view centre stands in, which degrades to classic centre-weighted significance
+	FVector2f GazePx = FVector2f(ViewRect.Min) + FVector2f(ViewRect.Size()) * 0.5f;
+	UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	const UBeamEyeTrackerSubsystem* Beam = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	const FBeamFrameRing* Ring = Beam ? Beam->GetFrameRing() : nullptr;
+	FBeamFrame Frame;
+	if (Ring && Ring->ReadLatest(Frame) && Frame.Gaze.bValid)
+	{
+		Targets->Screen01ToViewportPx(Frame.Gaze.Screen01, GazePx);
+	}
+
+	const UBeamSignificanceSettings* Settings = GetDefault<UBeamSignificanceSettings>();
+	const float FalloffPx = FMath::Max(Settings->GazeFalloff, 0.01f) * FVector2f(ViewRect.Size()).Size();
+
+	Scores.Reserve(Managed.Num());
+	Targets->ForEachScreenTarget([this, &GazePx, FalloffPx](AActor* Actor, const FBox2f& ScreenRect, float Depth)
+	{
+		if (Managed.Contains(Actor))
+		{
+			const float Distance = UBeamGazeTargetSubsystem::DistanceToRect(ScreenRect, GazePx) / FalloffPx;
+			Scores.Add(Actor, 1.0f / (1.0f + Distance * Distance));
+		}
+	});
+}
+
+void UBeamSignificanceSubsystem::UpdateSignificanceManager(USignificanceManager* Manager)
+{
+	if (!Manager)
+	{
+		return;
+	}
+
+	TArray<FTransform, TInlineAllocator<4>> Viewpoints;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector Location;
+			FRotator Rotation;
+			PC->GetPlayerViewPoint(Location, Rotation);
+			Viewpoints.Emplace(Rotation, Location);
+		}
+	}
+
+	if (Viewpoints.Num() > 0)
+	{
+		Manager->Update(Viewpoints);
+	}
+}
+
+void UBeamSignificanceSubsystem::OnSignificanceChanged(UObject* Object, float Significance)
+{
+	FManagedActor* Entry = Managed.Find(Cast<AActor>(Object));
+	if (!Entry)
+	{
+		return;
+	}
+
+	const int32 Tier = SelectTier(Significance, Entry->Tier);
+	if (Tier != Entry->Tier)
+	{
+		ApplyTier(*Entry, Tier);
+	}
+}
+
+int32 UBeamSignificanceSubsystem::SelectTier(float Significance, int32 CurrentTier) const
+{
+	const UBeamSignificanceSettings* Settings = GetDefault<UBeamSignificanceSettings>();
+	const TArray<FBeamSignificanceTier>& Tiers = Settings->Tiers;
+	if (Tiers.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Tier = Tiers.Num() - 1;
+	for (int32 Index = 0; Index < Tiers.Num(); ++Index)
+	{
+		if (Significance >= Tiers[Index].MinSignificance)
+		{
+			Tier = Index;
+			break;
+		}
+	}
+
+	// Promote immediately, demote only once clearly below the current tier
+	if (Tiers.IsValidIndex(CurrentTier) && Tier > CurrentTier && Significance >= Tiers[CurrentTier].MinSignificance - Settings->Hysteresis)
+	{
+		return CurrentTier;
+	}
+	return Tier;
+}
+
+void UBeamSignificanceSubsystem::ApplyTier(FManagedActor& Entry, int32 Tier)
+{
+	Entry.Tier = Tier;
+	AActor* Actor = Entry.Actor.Get();
+	if (!Actor)
+	{
+		return;
+	}
+
+	// INDEX_NONE restores the registration values, which also act as the floor for every tier
+	const TArray<FBeamSignificanceTier>& Tiers = GetDefault<UBeamSignificanceSettings>()->Tiers;
+	const FBeamSignificanceTier Budget = Tiers.IsValidIndex(Tier) ? Tiers[Tier] : FBeamSignificanceTier();
+
+	Actor->SetActorTickInterval(FMath::Max(Entry.OriginalTickInterval, Budget.TickInterval));
+	for (const FManagedComponent& ManagedComponent : Entry.Components)
+	{
+		UActorComponent* Component = ManagedComponent.Component.Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		const float Interval = Component->IsA<USkinnedMeshComponent>() ? Budget.AnimationTickInterval : Budget.TickInterval;
+		Component->SetComponentTickInterval(FMath::Max(ManagedComponent.OriginalTickInterval, Interval));
+		SetMinLOD(Component, FMath::Max(ManagedComponent.OriginalMinLOD, Budget.MinLOD));
+	}
+}
+
+void UBeamSignificanceSubsystem::Release(FManagedActor& Entry, USignificanceManager* Manager)
+{
+	ApplyTier(Entry, INDEX_NONE);
+
+	AActor* Actor = Entry.Actor.Get();
+	if (!Actor)
+	{
+		return;
+	}
+
+	if (Manager)
+	{
+		Manager->UnregisterObject(Actor);
+	}
+	if (Entry.bRegisteredGazeTarget)
+	{
+		if (UBeamGazeTargetSubsystem* Targets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>())
+		{
+			Targets->UnregisterGazeTarget(Actor);
+		}
+	}
+	Actor->OnDestroyed.RemoveDynamic(this, &UBeamSignificanceSubsystem::HandleActorDestroyed);
+}
@@ -0,0 +1,85 @@
+/*=============================================================================
+    BeamSignificanceSettings.h: Project settings for gaze-driven significance.
+
+    Defines how gaze distance maps to significance and the tick, animation
+    and LOD budget applied to actors at each significance tier.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "BeamSignificanceSettings.generated.h"
+
+/** Budget applied to actors whose significance reaches MinSignificance */
+USTRUCT(BlueprintType)
+struct FBeamSignificanceTier
+{
+	GENERATED_BODY()
+
+	/** Lowest significance that still falls into this tier */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tier", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MinSignificance = 0.0f;
+
+	/** Actor and component tick interval; 0 ticks every frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tier", meta = (ClampMin = "0.0", ClampMax = "2.0", Units = "s"))
+	float TickInterval = 0.0f;
+
+	/** Tick interval of skinned meshes, which drives their animation update rate */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tier", meta = (ClampMin = "0.0", ClampMax = "2.0", Units = "s"))
+	float AnimationTickInterval = 0.0f;
+
+	/** Highest-detail LOD meshes may use; 0 leaves the LOD to the engine */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tier", meta = (ClampMin = "0", ClampMax = "7"))
+	int32 MinLOD = 0;
+};
+
+/**
+ * Settings for UBeamSignificanceSubsystem.
+ *
+ * Significance is 1 where the player is looking and falls off with the
+ * on-screen distance between the gaze and an actor's projected bounds.
+ */
+UCLASS(config = Engine, defaultconfig, meta = (DisplayName = "Beam Gaze Significance"))
+class BEAMEYETRACKERSIGNIFICANCE_API UBeamSignificanceSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UBeamSignificanceSettings();
+
+	// UDeveloperSettings interface
+	virtual FName GetCategoryName() const override;
+
+	/** Call USignificanceManager::Update every frame with the local players' views; turn off when the game already does */
+	UPROPERTY(config, EditAnywhere, Category = "Significance")
+	bool bUpdateSignificanceManager = true;
+
+	/** Tag actors are registered under with the Significance Manager */
+	UPROPERTY(config, EditAnywhere, Category = "Significance")
+	FName SignificanceTag = TEXT("Beam.Gaze");
+
+	/** Gaze distance, as a fraction of the view diagonal, at which significance has dropped to one half */
+	UPROPERTY(config, EditAnywhere, Category = "Significance", meta = (ClampMin = "0.01", ClampMax = "1.0"))
+	float GazeFalloff = 0.15f;
+
+	/** Significance of registered actors that are not on screen */
+	UPROPERTY(config, EditAnywhere, Category = "Significance", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float OffScreenSignificance = 0.0f;
+
+	/** How far significance must fall below a tier's threshold before the actor drops out of it; stops tiers flickering at the boundary */
+	UPROPERTY(config, EditAnywhere, Category = "Significance", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+	float Hysteresis = 0.05f;
+
+	/** Tiers from most to least significant; the first tier an actor reaches applies */
+	UPROPERTY(config, EditAnywhere, Category = "Budget")
+	TArray<FBeamSignificanceTier> Tiers;
+};
+
+/*=============================================================================
+    End of BeamSignificanceSettings.h
+=============================================================================*/
@@ -0,0 +1,106 @@
+/*=============================================================================
+    BeamSignificanceSubsystem.h: Feeds gaze distance into the Significance Manager.
+
+    Registered actors are scored once per frame from the gaze target grid's
+    projected bounds and the newest gaze in the frame ring, and those scores
+    become their USignificanceManager significance. Significance tiers then
+    throttle the actors' tick, animation update rate and LOD, so CPU and GPU
+    time goes to what the player is looking at.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "BeamSignificanceSubsystem.generated.h"
+
+class UActorComponent;
+class USignificanceManager;
+
+/**
+ * Per-world gaze significance driver.
+ *
+ * Scoring happens on the game thread before the Significance Manager
+ * update, into a map the significance function only reads, so the
+ * manager can evaluate objects in parallel. Budget changes are applied in
+ * the sequential post-significance pass and only when an actor changes
+ * tier; the values an actor had when it was registered are the floor
+ * and are restored when it is unregistered.
+ */
+UCLASS()
+class BEAMEYETRACKERSIGNIFICANCE_API UBeamSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UTickableWorldSubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
+	/**
+	 * Manages Actor's budget by gaze. The actor also becomes a gaze target so it is projected with the
+	 * grid; components added after registration keep their own settings.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Significance", meta = (DisplayName = "Register Gaze Significance"))
+	void RegisterActor(AActor* Actor);
+
+	/** Restores the actor's original tick intervals and LODs */
+	UFUNCTION(BlueprintCallable, Category = "Beam|Significance", meta = (DisplayName = "Unregister Gaze Significance"))
+	void UnregisterActor(AActor* Actor);
+
+	/** Gaze significance computed this frame, 0..1; OffScreenSignificance when not on screen */
+	UFUNCTION(BlueprintPure, Category = "Beam|Significance", meta = (DisplayName = "Get Gaze Significance"))
+	float GetGazeSignificance(const AActor* Actor) const;
+
+	/** Index into the settings' tiers, INDEX_NONE when not registered or not yet evaluated */
+	UFUNCTION(BlueprintPure, Category = "Beam|Significance", meta = (DisplayName = "Get Significance Tier"))
+	int32 GetSignificanceTier(const AActor* Actor) const;
+
+	int32 GetNumManagedActors() const { return Managed.Num(); }
+
+private:
+	struct FManagedComponent
+	{
+		TWeakObjectPtr<UActorComponent> Component;
+		float OriginalTickInterval = 0.0f;
+		int32 OriginalMinLOD = 0;
+	};
+
+	struct FManagedActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		float OriginalTickInterval = 0.0f;
+		TArray<FManagedComponent> Components;
+		int32 Tier = INDEX_NONE;
+		bool bRegisteredGazeTarget = false;
+	};
+
+	TMap<TObjectKey<AActor>, FManagedActor> Managed;
+
+	/** This frame's scores; written before the manager update, read concurrently by the significance function */
+	TMap<TObjectKey<AActor>, float> Scores;
+
+	bool bWarnedNoManager = false;
+
+	UFUNCTION()
+	void HandleActorDestroyed(AActor* Actor);
+
+	void UpdateScores();
+	void UpdateSignificanceManager(USignificanceManager* Manager);
+	void OnSignificanceChanged(UObject* Object, float Significance);
+	int32 SelectTier(float Significance, int32 CurrentTier) const;
+	void ApplyTier(FManagedActor& Entry, int32 Tier);
+	void Release(FManagedActor& Entry, USignificanceManager* Manager);
+};
+
+/*=============================================================================
+    End of BeamSignificanceSubsystem.h
+=============================================================================*/
@@ -32,6 +32,11 @@ public class BEAMSDK : ModuleRules
 			"BeamEyeTracker" // Add the plugin dependency
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] {  });
+		// Benchmark scenario: UMG for the gaze widgets, RenderCore for game thread timing, Gauntlet for the unattended driver
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"UMG",
+			"RenderCore",
+			"Gauntlet"
+		});
 	}
 }
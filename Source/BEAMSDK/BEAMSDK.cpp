@@ -64,6 +64,26 @@ static FAutoConsoleCommand SpawnExampleActorCommand(
 	FConsoleCommandWithArgsDelegate::CreateStatic(&SpawnExampleActor)
 );
 
+// Console command to open the stress benchmark, optionally on a given map
+static void OpenBenchmark(const TArray<FString>& Args)
+{
+    if (GEngine && GEngine->GetWorldContexts().Num() > 0)
+    {
+        UWorld* World = GEngine->GetWorldContexts()[0].World();
+        if (World)
+        {
+            const FString Map = Args.Num() > 0 ? Args[0] : TEXT("/Engine/Maps/Entry");
+            GEngine->Exec(World, *FString::Printf(TEXT("open %s?game=/Script/BEAMSDK.BeamBenchmarkGameMode"), *Map));
+        }
+    }
+}
+
+static FAutoConsoleCommand OpenBenchmarkCommand(
+	TEXT("beam.benchmark"),
+	TEXT("Open the Beam stress benchmark (optional map path); results go to Saved/BeamBenchmark"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&OpenBenchmark)
+);
+
 /*=============================================================================
     End of BEAMSDK.cpp
 =============================================================================*/
@@ -0,0 +1,460 @@
+/*=============================================================================
+    BeamBenchmarkGameMode.cpp: Repeatable stress benchmark for the plugin.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#include "BeamBenchmarkGameMode.h"
+#include "BeamEyeTrackerSubsystem.h"
+#include "BeamEyeTrackerComponent.h"
+#include "BeamEyeTrackerSettings.h"
+#include "BeamGazeTargetSubsystem.h"
+#include "BeamGazeWidget.h"
+#include "BeamLatency.h"
+#include "BeamResources.h"
+#include "Blueprint/UserWidget.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "RenderCore.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBeamBenchmark, Log, All);
+
+namespace BeamBenchmark
+{
+	static constexpr int32 NumStages = static_cast<int32>(EBeamLatencyStage::Num);
+
+	// Targets are laid out on a wall this far in front of the default pawn
+	static constexpr double WallDistanceCm = 3000.0;
+	static constexpr double TargetSpacingCm = 60.0;
+
+	// Slack on top of the relative tolerance, so near-zero baselines do not fail on noise
+	static constexpr double CostSlackMs = 0.05;
+	static constexpr double CPUSlackPercent = 1.0;
+
+	static double Percentile(TArray<float> Samples, double Percent)
+	{
+		if (Samples.Num() == 0)
+		{
+			return 0.0;
+		}
+		Samples.Sort();
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Percent * 0.01 * Samples.Num()) - 1, 0, Samples.Num() - 1);
+		return Samples[Index];
+	}
+}
+
+ABeamBenchmarkGameMode::ABeamBenchmarkGameMode()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = true;
+	GazeWidgetClass = UBeamGazeWidget::StaticClass();
+}
+
+void ABeamBenchmarkGameMode::StartPlay()
+{
+	Super::StartPlay();
+
+	ApplyCommandLine();
+
+	UGameInstance* GameInstance = GetGameInstance();
+	BeamSubsystem = GameInstance ? GameInstance->GetSubsystem<UBeamEyeTrackerSubsystem>() : nullptr;
+	GazeTargets = GetWorld()->GetSubsystem<UBeamGazeTargetSubsystem>();
+	if (!BeamSubsystem || !GazeTargets)
+	{
+		UE_LOG(LogBeamBenchmark, Error, TEXT("Beam subsystems are not available; benchmark cannot run"));
+		Finish();
+		return;
+	}
+
+	SaveTrackerState();
+	SpawnScene();
+	GBeamResources.Start();
+	bResourceSamplerStarted = true;
+
+	// The idle phase first, then every configured rate
+	PhaseRates.Reset();
+	PhaseRates.Add(0);
+	PhaseRates.Append(SyntheticRatesHz);
+	BeginPhase(0);
+}
+
+void ABeamBenchmarkGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (BeamSubsystem)
+	{
+		BeamSubsystem->StopBeamTracking();
+	}
+	RestoreTrackerState();
+	for (UUserWidget* Widget : SpawnedWidgets)
+	{
+		if (Widget)
+		{
+			Widget->RemoveFromParent();
+		}
+	}
+	SpawnedWidgets.Reset();
+	if (bResourceSamplerStarted)
+	{
+		GBeamResources.Stop();
+		bResourceSamplerStarted = false;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ABeamBenchmarkGameMode::SaveTrackerState()
+{
+	// The settings object is the class default, so phase rates would otherwise leak into the editor session
+	const UBeamEyeTrackerSettings* Settings = GetDefault<UBeamEyeTrackerSettings>();
+	SavedTrackerState.SyntheticRateHz = Settings->SyntheticRateHz;
+	SavedTrackerState.bSyntheticRealtime = Settings->bSyntheticRealtime;
+	SavedTrackerState.DataSourceType = BeamSubsystem->GetDataSourceType();
+	const TSharedPtr<const FBeamRuntimeSettings, ESPMode::ThreadSafe> RuntimeSettings = BeamSubsystem->GetRuntimeSettings();
+	SavedTrackerState.PollingHz = RuntimeSettings ? RuntimeSettings->PollingHz : 0;
+	bTrackerStateSaved = true;
+}
+
+void ABeamBenchmarkGameMode::RestoreTrackerState()
+{
+	if (!bTrackerStateSaved)
+	{
+		return;
+	}
+	bTrackerStateSaved = false;
+
+	UBeamEyeTrackerSettings* Settings = GetMutableDefault<UBeamEyeTrackerSettings>();
+	Settings->SyntheticRateHz = SavedTrackerState.SyntheticRateHz;
+	Settings->bSyntheticRealtime = SavedTrackerState.bSyntheticRealtime;
+	if (BeamSubsystem)
+	{
+		if (BeamSubsystem->GetDataSourceType() != SavedTrackerState.DataSourceType)
+		{
+			BeamSubsystem->SetDataSourceType(SavedTrackerState.DataSourceType);
+		}
+		if (SavedTrackerState.PollingHz > 0)
+		{
+			BeamSubsystem->SetPollingRate(SavedTrackerState.PollingHz);
+		}
+	}
+}
+
+void ABeamBenchmarkGameMode::ApplyCommandLine()
+{
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("BeamBenchTargets="), NumGazeTargets);
+	FParse::Value(CommandLine, TEXT("BeamBenchComponents="), NumTrackerComponents);
+	FParse::Value(CommandLine, TEXT("BeamBenchWidgets="), NumGazeWidgets);
+	FParse::Value(CommandLine, TEXT("BeamBenchSeconds="), MeasureSeconds);
+
+	FString Rates;
+	if (FParse::Value(CommandLine, TEXT("BeamBenchRates="), Rates, false))
+	{
+		TArray<FString> Parts;
+		Rates.ParseIntoArray(Parts, TEXT(","));
+		SyntheticRatesHz.Reset();
+		for (const FString& Part : Parts)
+		{
+			const int32 RateHz = FCString::Atoi(*Part);
+			if (RateHz > 0)
+			{
+				SyntheticRatesHz.Add(RateHz);
+			}
+		}
+	}
+
+	NumGazeTargets = FMath::Max(0, NumGazeTargets);
+	NumTrackerComponents = FMath::Max(0, NumTrackerComponents);
+	NumGazeWidgets = FMath::Max(0, NumGazeWidgets);
+	MeasureSeconds = FMath::Max(1.0f, MeasureSeconds);
+}
+
+void ABeamBenchmarkGameMode::SpawnScene()
+{
+	UWorld* World = GetWorld();
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	// A square wall of small cubes facing the default pawn, most of them on screen
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	const int32 Columns = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumGazeTargets))));
+	const double HalfExtent = (Columns - 1) * BeamBenchmark::TargetSpacingCm * 0.5;
+	for (int32 Index = 0; Index < NumGazeTargets; ++Index)
+	{
+		const FVector Location(BeamBenchmark::WallDistanceCm, Index % Columns * BeamBenchmark::TargetSpacingCm - HalfExtent, Index / Columns * BeamBenchmark::TargetSpacingCm - HalfExtent);
+		AStaticMeshActor* Target = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator, SpawnParams);
+		if (!Target)
+		{
+			continue;
+		}
+		Target->SetMobility(EComponentMobility::Movable);
+		Target->GetStaticMeshComponent()->SetStaticMesh(Cube);
+		Target->SetActorScale3D(FVector(0.2));
+		GazeTargets->RegisterGazeTarget(Target);
+		SpawnedActors.Add(Target);
+	}
+
+	// Components are started by the phases, not by themselves
+	if (NumTrackerComponents > 0)
+	{
+		AActor* Holder = World->SpawnActor<AActor>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+		for (int32 Index = 0; Index < NumTrackerComponents; ++Index)
+		{
+			UBeamEyeTrackerComponent* Component = NewObject<UBeamEyeTrackerComponent>(Holder);
+			Component->bAutoStart = false;
+			Component->RegisterComponent();
+		}
+		SpawnedActors.Add(Holder);
+	}
+
+	APlayerController* PlayerController = World->GetFirstPlayerController();
+	if (PlayerController && GazeWidgetClass)
+	{
+		for (int32 Index = 0; Index < NumGazeWidgets; ++Index)
+		{
+			if (UUserWidget* Widget = CreateWidget<UUserWidget>(PlayerController, GazeWidgetClass))
+			{
+				Widget->AddToViewport(Index);
+				SpawnedWidgets.Add(Widget);
+			}
+		}
+	}
+
+	UE_LOG(LogBeamBenchmark, Log, TEXT("Scene: %d gaze targets, %d tracker components, %d gaze widgets"),
+		GazeTargets->GetNumTargets(), NumTrackerComponents, SpawnedWidgets.Num());
+}
+
+void ABeamBenchmarkGameMode::BeginPhase(int32 NewPhaseIndex)
+{
+	PhaseIndex = NewPhaseIndex;
+	const int32 RateHz = PhaseRates[PhaseIndex];
+
+	BeamSubsystem->StopBeamTracking();
+	if (RateHz > 0)
+	{
+		// The synthetic source reads its rate from the settings when it is created
+		UBeamEyeTrackerSettings* Settings = GetMutableDefault<UBeamEyeTrackerSettings>();
+		Settings->SyntheticRateHz = RateHz;
+		Settings->bSyntheticRealtime = true;
+		BeamSubsystem->SetDataSourceType(EBeamDataSourceType::Synthetic);
+		BeamSubsystem->SetPollingRate(RateHz);
+		if (!BeamSubsystem->StartBeamTracking())
+		{
+			UE_LOG(LogBeamBenchmark, Error, TEXT("Failed to start the synthetic source at %d Hz"), RateHz);
+		}
+	}
+
+	PhaseStartSeconds = FPlatformTime::Seconds();
+	bMeasuring = false;
+	GameThreadSamplesMs.Reset();
+	UE_LOG(LogBeamBenchmark, Log, TEXT("Phase %d/%d: %s"), PhaseIndex + 1, PhaseRates.Num(),
+		RateHz > 0 ? *FString::Printf(TEXT("synthetic %d Hz"), RateHz) : TEXT("idle"));
+}
+
+void ABeamBenchmarkGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (bFinished || PhaseIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// What a gaze-driven game asks every frame
+	GazeTargets->GetClosestTargetToGaze(50.0f);
+
+	const double Elapsed = FPlatformTime::Seconds() - PhaseStartSeconds;
+	if (!bMeasuring)
+	{
+		if (Elapsed >= WarmupSeconds)
+		{
+			bMeasuring = true;
+			PhaseStartSeconds = FPlatformTime::Seconds();
+			GBeamLatency.Reset();
+		}
+		return;
+	}
+
+	// Time of the last completed game thread frame, without waits for the render thread
+	GameThreadSamplesMs.Add(static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime)));
+
+	if (Elapsed >= MeasureSeconds)
+	{
+		EndPhase();
+		if (PhaseIndex + 1 < PhaseRates.Num())
+		{
+			BeginPhase(PhaseIndex + 1);
+		}
+		else
+		{
+			Finish();
+		}
+	}
+}
+
+void ABeamBenchmarkGameMode::EndPhase()
+{
+	FPhaseResult& Result = Results.AddDefaulted_GetRef();
+	Result.RateHz = PhaseRates[PhaseIndex];
+	Result.Frames = GameThreadSamplesMs.Num();
+
+	double Sum = 0.0;
+	for (const float Sample : GameThreadSamplesMs)
+	{
+		Sum += Sample;
+	}
+	Result.GameThreadMsAvg = Result.Frames > 0 ? Sum / Result.Frames : 0.0;
+	Result.GameThreadMsP95 = BeamBenchmark::Percentile(GameThreadSamplesMs, 95.0);
+	Result.PluginCostMs = Result.GameThreadMsAvg - Results[0].GameThreadMsAvg;
+
+	const FBeamResourceUsage Usage = GBeamResources.GetLatest();
+	Result.BeamCPUPercent = Usage.bCPUMeasured ? Usage.CPUPercent : 0.0;
+	Result.MemoryMB = Usage.MemoryBytes / (1024.0 * 1024.0);
+	Result.TrackerFPS = Result.RateHz > 0 ? BeamSubsystem->GetTrackingFPS() : 0.0;
+
+	for (int32 Stage = 0; Stage < BeamBenchmark::NumStages; ++Stage)
+	{
+		const FBeamLatencySummary Summary = GBeamLatency.GetSummary(static_cast<EBeamLatencyStage>(Stage));
+		Result.LatencyP50Ms[Stage] = Summary.P50Ms;
+		Result.LatencyP95Ms[Stage] = Summary.P95Ms;
+		Result.LatencyP99Ms[Stage] = Summary.P99Ms;
+	}
+
+	UE_LOG(LogBeamBenchmark, Log, TEXT("  %d frames, game thread %.3f ms avg / %.3f ms p95, plugin cost %.3f ms, Beam CPU %.1f%%, memory %.2f MB, tracker %.0f Hz"),
+		Result.Frames, Result.GameThreadMsAvg, Result.GameThreadMsP95, Result.PluginCostMs, Result.BeamCPUPercent, Result.MemoryMB, Result.TrackerFPS);
+}
+
+void ABeamBenchmarkGameMode::Finish()
+{
+	if (BeamSubsystem)
+	{
+		BeamSubsystem->StopBeamTracking();
+	}
+
+	bPassed = Results.Num() == PhaseRates.Num() && PhaseRates.Num() > 0;
+	if (bPassed)
+	{
+		ResultsPath = WriteResults();
+
+		FString BaselinePath;
+		if (FParse::Value(FCommandLine::Get(), TEXT("BeamBenchBaseline="), BaselinePath))
+		{
+			bPassed = CompareWithBaseline(BaselinePath);
+		}
+	}
+
+	bFinished = true;
+	PhaseIndex = INDEX_NONE;
+	UE_LOG(LogBeamBenchmark, Display, TEXT("Benchmark %s%s%s"), bPassed ? TEXT("passed") : TEXT("failed"),
+		ResultsPath.IsEmpty() ? TEXT("") : TEXT(", results in "), *ResultsPath);
+	OnFinished.Broadcast(bPassed, ResultsPath);
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("BeamBenchExit")))
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+	}
+}
+
+FString ABeamBenchmarkGameMode::WriteResults() const
+{
+	FString Csv = TEXT("Phase,RateHz,Frames,GameThreadMsAvg,GameThreadMsP95,PluginCostMs,BeamCPUPercent,MemoryMB,TrackerFPS");
+	for (int32 Stage = 0; Stage < BeamBenchmark::NumStages; ++Stage)
+	{
+		const TCHAR* Name = FBeamLatencyMonitor::GetStageName(static_cast<EBeamLatencyStage>(Stage));
+		Csv += FString::Printf(TEXT(",%sP50Ms,%sP95Ms,%sP99Ms"), Name, Name, Name);
+	}
+	Csv += LINE_TERMINATOR;
+
+	for (const FPhaseResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%.4f,%.4f,%.4f,%.2f,%.3f,%.1f"),
+			Result.RateHz > 0 ? TEXT("Synthetic") : TEXT("Idle"), Result.RateHz, Result.Frames, Result.GameThreadMsAvg, Result.GameThreadMsP95,
+			Result.PluginCostMs, Result.BeamCPUPercent, Result.MemoryMB, Result.TrackerFPS);
+		for (int32 Stage = 0; Stage < BeamBenchmark::NumStages; ++Stage)
+		{
+			Csv += FString::Printf(TEXT(",%.3f,%.3f,%.3f"), Result.LatencyP50Ms[Stage], Result.LatencyP95Ms[Stage], Result.LatencyP99Ms[Stage]);
+		}
+		Csv += LINE_TERMINATOR;
+	}
+
+	FString OutputPath;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("BeamBenchOutput="), OutputPath))
+	{
+		OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BeamBenchmark"), FString::Printf(TEXT("BeamBenchmark_%s.csv"), *FDateTime::Now().ToString()));
+	}
+	OutputPath = FPaths::ConvertRelativePathToFull(OutputPath);
+	if (!FFileHelper::SaveStringToFile(Csv, *OutputPath))
+	{
+		UE_LOG(LogBeamBenchmark, Error, TEXT("Failed to write %s"), *OutputPath);
+		return FString();
+	}
+	return OutputPath;
+}
+
+bool ABeamBenchmarkGameMode::CompareWithBaseline(const FString& BaselinePath) const
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *BaselinePath) || Lines.Num() < 2)
+	{
+		UE_LOG(LogBeamBenchmark, Warning, TEXT("Baseline %s is missing or empty; nothing to compare against"), *BaselinePath);
+		return true;
+	}
+
+	TArray<FString> Header;
+	Lines[0].ParseIntoArray(Header, TEXT(","));
+	const int32 RateColumn = Header.IndexOfByKey(TEXT("RateHz"));
+	const int32 CostColumn = Header.IndexOfByKey(TEXT("PluginCostMs"));
+	const int32 CPUColumn = Header.IndexOfByKey(TEXT("BeamCPUPercent"));
+	if (RateColumn == INDEX_NONE || CostColumn == INDEX_NONE || CPUColumn == INDEX_NONE)
+	{
+		UE_LOG(LogBeamBenchmark, Error, TEXT("Baseline %s is not a benchmark CSV"), *BaselinePath);
+		return false;
+	}
+
+	bool bWithinBaseline = true;
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		TArray<FString> Values;
+		Lines[LineIndex].ParseIntoArray(Values, TEXT(","), false);
+		if (Values.Num() != Header.Num())
+		{
+			continue;
+		}
+
+		const int32 RateHz = FCString::Atoi(*Values[RateColumn]);
+		const FPhaseResult* Result = Results.FindByPredicate([RateHz](const FPhaseResult& Candidate) { return Candidate.RateHz == RateHz; });
+		if (!Result || RateHz == 0)
+		{
+			continue;
+		}
+
+		const double BaseCost = FCString::Atod(*Values[CostColumn]);
+		const double BaseCPU = FCString::Atod(*Values[CPUColumn]);
+		if (Result->PluginCostMs > FMath::Max(BaseCost, 0.0) * (1.0 + RegressionTolerance) + BeamBenchmark::CostSlackMs)
+		{
+			UE_LOG(LogBeamBenchmark, Error, TEXT("%d Hz: plugin cost %.3f ms regressed from %.3f ms"), RateHz, Result->PluginCostMs, BaseCost);
+			bWithinBaseline = false;
+		}
+		if (Result->BeamCPUPercent > BaseCPU * (1.0 + RegressionTolerance) + BeamBenchmark::CPUSlackPercent)
+		{
+			UE_LOG(LogBeamBenchmark, Error, TEXT("%d Hz: Beam CPU %.1f%% regressed from %.1f%%"), RateHz, Result->BeamCPUPercent, BaseCPU);
+			bWithinBaseline = false;
+		}
+	}
+	return bWithinBaseline;
+}
+
+/*=============================================================================
+    End of BeamBenchmarkGameMode.cpp
+=============================================================================*/
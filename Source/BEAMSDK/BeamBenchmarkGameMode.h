@@ -0,0 +1,158 @@
+/*=============================================================================
+    BeamBenchmarkGameMode.h: Repeatable stress benchmark for the plugin.
+
+    Builds a heavy scene on any empty map - thousands of registered gaze
+    targets, hundreds of tracker components and a wall of gaze widgets -
+    and drives it from the synthetic data source at a series of rates,
+    measuring each against an idle phase. Results go to a CSV that later
+    runs are compared against.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameModeBase.h"
+#include "BeamEyeTrackerTypes.h"
+#include "BeamBenchmarkGameMode.generated.h"
+
+class UBeamEyeTrackerSubsystem;
+class UBeamGazeTargetSubsystem;
+class UUserWidget;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnBeamBenchmarkFinished, bool /*bPassed*/, const FString& /*ResultsPath*/);
+
+/**
+ * Benchmark scenario and measurement loop.
+ *
+ * Open with "beam.benchmark", or travel to any map with
+ * ?game=/Script/BEAMSDK.BeamBenchmarkGameMode. Every phase warms up and
+ * then measures game thread time, Beam thread CPU, plugin memory and the
+ * stage latency percentiles; plugin frame cost is a phase's game thread
+ * time over the idle phase, which has the same scene with tracking
+ * stopped. Config values can be overridden on the command line:
+ * -BeamBenchTargets=, -BeamBenchComponents=, -BeamBenchWidgets=,
+ * -BeamBenchRates=250,500,1000, -BeamBenchSeconds=, -BeamBenchOutput=
+ * and -BeamBenchBaseline=<csv>, which fails the run when a phase costs
+ * more than RegressionTolerance over the baseline's matching phase.
+ * -BeamBenchExit quits when done outside Gauntlet.
+ */
+UCLASS(Config = Game)
+class BEAMSDK_API ABeamBenchmarkGameMode : public AGameModeBase
+{
+	GENERATED_BODY()
+
+public:
+	ABeamBenchmarkGameMode();
+
+	//~ Begin AActor Interface
+	virtual void StartPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaSeconds) override;
+	//~ End AActor Interface
+
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark", meta = (ClampMin = "0"))
+	int32 NumGazeTargets = 4000;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark", meta = (ClampMin = "0"))
+	int32 NumTrackerComponents = 500;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark", meta = (ClampMin = "0"))
+	int32 NumGazeWidgets = 64;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+	TSubclassOf<UUserWidget> GazeWidgetClass;
+
+	/** Synthetic source rates measured after the idle phase, in order */
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+	TArray<int32> SyntheticRatesHz = { 250, 500, 1000 };
+
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark", meta = (ClampMin = "0", Units = "s"))
+	float WarmupSeconds = 3.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark", meta = (ClampMin = "1", Units = "s"))
+	float MeasureSeconds = 15.0f;
+
+	/** Fraction by which a phase's plugin frame cost or Beam thread CPU may exceed the baseline before the run fails */
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark", meta = (ClampMin = "0"))
+	float RegressionTolerance = 0.15f;
+
+	bool IsFinished() const { return bFinished; }
+	bool HasPassed() const { return bPassed; }
+	const FString& GetResultsPath() const { return ResultsPath; }
+
+	FOnBeamBenchmarkFinished OnFinished;
+
+private:
+	/** Measurements of one phase; RateHz 0 is the idle phase */
+	struct FPhaseResult
+	{
+		int32 RateHz = 0;
+		int32 Frames = 0;
+		double GameThreadMsAvg = 0.0;
+		double GameThreadMsP95 = 0.0;
+		double PluginCostMs = 0.0;
+		double BeamCPUPercent = 0.0;
+		double MemoryMB = 0.0;
+		double TrackerFPS = 0.0;
+		double LatencyP50Ms[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double LatencyP95Ms[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double LatencyP99Ms[4] = { 0.0, 0.0, 0.0, 0.0 };
+	};
+
+	UPROPERTY(Transient)
+	TObjectPtr<UBeamEyeTrackerSubsystem> BeamSubsystem;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UBeamGazeTargetSubsystem> GazeTargets;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> SpawnedActors;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUserWidget>> SpawnedWidgets;
+
+	TArray<int32> PhaseRates;
+	int32 PhaseIndex = INDEX_NONE;
+	double PhaseStartSeconds = 0.0;
+	bool bMeasuring = false;
+	TArray<float> GameThreadSamplesMs;
+	TArray<FPhaseResult> Results;
+
+	bool bFinished = false;
+	bool bPassed = false;
+	bool bResourceSamplerStarted = false;
+	FString ResultsPath;
+
+	/** Tracker configuration the phases overwrite, taken in StartPlay and put back in EndPlay */
+	struct FSavedTrackerState
+	{
+		float SyntheticRateHz = 0.0f;
+		bool bSyntheticRealtime = true;
+		EBeamDataSourceType DataSourceType = EBeamDataSourceType::Live;
+		int32 PollingHz = 0;
+	};
+	FSavedTrackerState SavedTrackerState;
+	bool bTrackerStateSaved = false;
+
+	void SaveTrackerState();
+	void RestoreTrackerState();
+
+	void ApplyCommandLine();
+	void SpawnScene();
+	void BeginPhase(int32 NewPhaseIndex);
+	void EndPhase();
+	void Finish();
+
+	FString WriteResults() const;
+
+	/** Compares Results with a previous CSV; true when nothing regressed or there is no baseline */
+	bool CompareWithBaseline(const FString& BaselinePath) const;
+};
+
+/*=============================================================================
+    End of BeamBenchmarkGameMode.h
+=============================================================================*/
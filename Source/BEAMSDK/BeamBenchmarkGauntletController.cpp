@@ -0,0 +1,71 @@
+/*=============================================================================
+    BeamBenchmarkGauntletController.cpp: Gauntlet driver for the benchmark.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#include "BeamBenchmarkGauntletController.h"
+#include "BeamBenchmarkGameMode.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBeamBenchmarkGauntlet, Log, All);
+
+void UBeamBenchmarkGauntletController::OnInit()
+{
+	BenchmarkMap = TEXT("/Engine/Maps/Entry");
+	FParse::Value(FCommandLine::Get(), TEXT("BeamBenchMap="), BenchmarkMap);
+	FParse::Value(FCommandLine::Get(), TEXT("BeamBenchTimeout="), TimeoutSeconds);
+	StartSeconds = FPlatformTime::Seconds();
+}
+
+void UBeamBenchmarkGauntletController::OnPostMapChange(UWorld* World)
+{
+	if (bTravelRequested || !World || World->GetAuthGameMode<ABeamBenchmarkGameMode>())
+	{
+		return;
+	}
+
+	// The scene is built by the game mode, so any map works as long as the mode is overridden
+	bTravelRequested = true;
+	UE_LOG(LogBeamBenchmarkGauntlet, Display, TEXT("Opening %s with the benchmark game mode"), *BenchmarkMap);
+	GEngine->Exec(World, *FString::Printf(TEXT("open %s?game=/Script/BEAMSDK.BeamBenchmarkGameMode"), *BenchmarkMap));
+}
+
+void UBeamBenchmarkGauntletController::OnTick(float TimeDelta)
+{
+	if (bEnded)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!bTravelRequested && World && World->HasBegunPlay())
+	{
+		OnPostMapChange(World);
+	}
+
+	const ABeamBenchmarkGameMode* Benchmark = World ? World->GetAuthGameMode<ABeamBenchmarkGameMode>() : nullptr;
+	if (Benchmark && Benchmark->IsFinished())
+	{
+		bEnded = true;
+		EndTest(Benchmark->HasPassed() ? 0 : 1);
+		return;
+	}
+
+	if (FPlatformTime::Seconds() - StartSeconds > TimeoutSeconds)
+	{
+		UE_LOG(LogBeamBenchmarkGauntlet, Error, TEXT("Benchmark did not finish within %.0f seconds"), TimeoutSeconds);
+		bEnded = true;
+		EndTest(1);
+	}
+}
+
+/*=============================================================================
+    End of BeamBenchmarkGauntletController.cpp
+=============================================================================*/
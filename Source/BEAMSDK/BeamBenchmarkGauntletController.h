@@ -0,0 +1,48 @@
+/*=============================================================================
+    BeamBenchmarkGauntletController.h: Gauntlet driver for the benchmark.
+
+    Runs the stress benchmark unattended and turns its result into the
+    process exit code, so a Gauntlet or CI job can launch the game with
+    -gauntlet=BeamBenchmarkGauntletController and gate on the baseline.
+
+    Copyright (c) 2025 Eyeware Tech SA. All Rights Reserved.
+
+    Eyeware® and Beam® are registered trademarks of Eyeware Tech SA.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GauntletTestController.h"
+#include "BeamBenchmarkGauntletController.generated.h"
+
+/**
+ * Opens the benchmark map unless the game already started in one, waits
+ * for the benchmark to finish and ends the test with 0 when it passed.
+ * The map defaults to /Engine/Maps/Entry and can be set with
+ * -BeamBenchMap=; a run longer than -BeamBenchTimeout= seconds (default
+ * 600) fails.
+ */
+UCLASS()
+class BEAMSDK_API UBeamBenchmarkGauntletController : public UGauntletTestController
+{
+	GENERATED_BODY()
+
+protected:
+	//~ Begin UGauntletTestController Interface
+	virtual void OnInit() override;
+	virtual void OnPostMapChange(UWorld* World) override;
+	virtual void OnTick(float TimeDelta) override;
+	//~ End UGauntletTestController Interface
+
+private:
+	FString BenchmarkMap;
+	double TimeoutSeconds = 600.0;
+	double StartSeconds = 0.0;
+	bool bTravelRequested = false;
+	bool bEnded = false;
+};
+
+/*=============================================================================
+    End of BeamBenchmarkGauntletController.h
+=============================================================================*/